@@ -0,0 +1,9 @@
+#include <sys/types.h>
+#include <sys/socket.h>
+
+int main() {
+    struct mmsghdr msgs[1];
+    int sent = sendmmsg(0, msgs, 0, 0);
+    int rcvd = recvmmsg(0, msgs, 0, MSG_DONTWAIT, 0);
+    return (sent + rcvd);
+}
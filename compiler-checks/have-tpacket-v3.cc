@@ -0,0 +1,13 @@
+#include <linux/if_packet.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+
+int main() {
+    struct tpacket_req3 req;
+    req.tp_retire_blk_tov = 0;
+    int version = TPACKET_V3;
+    struct tpacket_block_desc* block = 0;
+    struct tpacket3_hdr* hdr = 0;
+    return (setsockopt(0, SOL_PACKET, PACKET_RX_RING, &req, sizeof(req)) +
+            version + (block != 0) + (hdr != 0) + TP_STATUS_USER);
+}
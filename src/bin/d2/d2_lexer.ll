@@ -236,9 +236,37 @@ ControlCharacterFill            [^"\\]|\\["\\/bfnrtu]
     }
 }
 
+\"multi-threading\" {
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::DHCPDDNS:
+        return isc::d2::D2Parser::make_MULTI_THREADING(driver.loc_);
+    default:
+        return isc::d2::D2Parser::make_STRING("multi-threading", driver.loc_);
+    }
+}
+
+\"enable-multi-threading\" {
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::MULTI_THREADING:
+        return isc::d2::D2Parser::make_ENABLE_MULTI_THREADING(driver.loc_);
+    default:
+        return isc::d2::D2Parser::make_STRING("enable-multi-threading", driver.loc_);
+    }
+}
+
+\"thread-pool-size\" {
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::MULTI_THREADING:
+        return isc::d2::D2Parser::make_THREAD_POOL_SIZE(driver.loc_);
+    default:
+        return isc::d2::D2Parser::make_STRING("thread-pool-size", driver.loc_);
+    }
+}
+
 (?i:\"UDP\") {
     /* dhcp-ddns value keywords are case insensitive */
-    if (driver.ctx_ == isc::d2::D2ParserContext::NCR_PROTOCOL) {
+    if ((driver.ctx_ == isc::d2::D2ParserContext::NCR_PROTOCOL) ||
+        (driver.ctx_ == isc::d2::D2ParserContext::TRANSPORT)) {
         return isc::d2::D2Parser::make_UDP(driver.loc_);
     }
     std::string tmp(yytext+1);
@@ -248,7 +276,8 @@ ControlCharacterFill            [^"\\]|\\["\\/bfnrtu]
 
 (?i:\"TCP\") {
     /* dhcp-ddns value keywords are case insensitive */
-    if (driver.ctx_ == isc::d2::D2ParserContext::NCR_PROTOCOL) {
+    if ((driver.ctx_ == isc::d2::D2ParserContext::NCR_PROTOCOL) ||
+        (driver.ctx_ == isc::d2::D2ParserContext::TRANSPORT)) {
         return isc::d2::D2Parser::make_TCP(driver.loc_);
     }
     std::string tmp(yytext+1);
@@ -365,6 +394,16 @@ ControlCharacterFill            [^"\\]|\\["\\/bfnrtu]
 }
 
 
+\"transport\" {
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::DNS_SERVER:
+    case isc::d2::D2ParserContext::DNS_SERVERS:
+        return isc::d2::D2Parser::make_TRANSPORT(driver.loc_);
+    default:
+        return isc::d2::D2Parser::make_STRING("transport", driver.loc_);
+    }
+}
+
 \"tsig-keys\" {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DHCPDDNS:
@@ -711,6 +750,15 @@ ControlCharacterFill            [^"\\]|\\["\\/bfnrtu]
     }
 }
 
+\"async-queue-size\" {
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::OUTPUT_OPTIONS:
+        return isc::d2::D2Parser::make_ASYNC_QUEUE_SIZE(driver.loc_);
+    default:
+        return isc::d2::D2Parser::make_STRING("async-queue-size", driver.loc_);
+    }
+}
+
 \"name\" {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::LOGGERS:
@@ -1,4 +1,4 @@
-/* Copyright (C) 2017-2025 Internet Systems Consortium, Inc. ("ISC")
+/* Copyright (C) 2017-2026 Internet Systems Consortium, Inc. ("ISC")
 
    This Source Code Form is subject to the terms of the Mozilla Public
    License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -64,6 +64,9 @@ using namespace std;
   TCP "TCP"
   NCR_FORMAT "ncr-format"
   JSON "JSON"
+  MULTI_THREADING "multi-threading"
+  ENABLE_MULTI_THREADING "enable-multi-threading"
+  THREAD_POOL_SIZE "thread-pool-size"
   USER_CONTEXT "user-context"
   COMMENT "comment"
   FORWARD_DDNS "forward-ddns"
@@ -72,6 +75,7 @@ using namespace std;
   KEY_NAME "key-name"
   DNS_SERVERS "dns-servers"
   HOSTNAME "hostname"
+  TRANSPORT "transport"
   TSIG_KEYS "tsig-keys"
   ALGORITHM "algorithm"
   DIGEST_BITS "digest-bits"
@@ -115,6 +119,7 @@ using namespace std;
   MAXSIZE "maxsize"
   MAXVER "maxver"
   PATTERN "pattern"
+  ASYNC_QUEUE_SIZE "async-queue-size"
 
   // Not real tokens, just a way to signal what the parser is expected to
   // parse.
@@ -138,6 +143,7 @@ using namespace std;
 %type <ElementPtr> value
 %type <ElementPtr> map_value
 %type <ElementPtr> ncr_protocol_value
+%type <ElementPtr> transport_value
 %type <ElementPtr> control_socket_type_value
 %type <ElementPtr> auth_type_value
 
@@ -304,6 +310,7 @@ dhcpddns_param: ip_address
               | dns_server_timeout
               | ncr_protocol
               | ncr_format
+              | multi_threading
               | forward_ddns
               | reverse_ddns
               | tsig_keys
@@ -365,6 +372,49 @@ ncr_format: NCR_FORMAT {
     ctx.leave();
 };
 
+// --- multi-threading ------------------------------------------------
+
+multi_threading: MULTI_THREADING {
+    ctx.unique("multi-threading", ctx.loc2pos(@1));
+    ElementPtr mt(new MapElement(ctx.loc2pos(@1)));
+    ctx.stack_.back()->set("multi-threading", mt);
+    ctx.stack_.push_back(mt);
+    ctx.enter(ctx.MULTI_THREADING);
+} COLON LCURLY_BRACKET multi_threading_params RCURLY_BRACKET {
+    // The enable parameter is required.
+    ctx.require("enable-multi-threading", ctx.loc2pos(@4), ctx.loc2pos(@6));
+    ctx.stack_.pop_back();
+    ctx.leave();
+};
+
+multi_threading_params: multi_threading_param
+                      | multi_threading_params COMMA multi_threading_param
+                      | multi_threading_params COMMA {
+                          ctx.warnAboutExtraCommas(@2);
+                          }
+                      ;
+
+multi_threading_param: enable_multi_threading
+                     | thread_pool_size
+                     | unknown_map_entry
+                     ;
+
+enable_multi_threading: ENABLE_MULTI_THREADING COLON BOOLEAN {
+    ctx.unique("enable-multi-threading", ctx.loc2pos(@1));
+    ElementPtr b(new BoolElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("enable-multi-threading", b);
+};
+
+thread_pool_size: THREAD_POOL_SIZE COLON INTEGER {
+    ctx.unique("thread-pool-size", ctx.loc2pos(@1));
+    if ($3 < 0) {
+        error(@3, "thread-pool-size must not be negative");
+    } else {
+        ElementPtr i(new IntElement($3, ctx.loc2pos(@3)));
+        ctx.stack_.back()->set("thread-pool-size", i);
+    }
+};
+
 user_context: USER_CONTEXT {
     ctx.enter(ctx.NO_KEYWORD);
 } COLON map_value {
@@ -592,6 +642,7 @@ dns_server_params: dns_server_param
 dns_server_param: dns_server_hostname
               | dns_server_ip_address
               | dns_server_port
+              | dns_server_transport
               | ddns_key_name
               | user_context
               | comment
@@ -629,6 +680,19 @@ dns_server_port: PORT COLON INTEGER {
     ctx.stack_.back()->set("port", i);
 };
 
+dns_server_transport: TRANSPORT {
+    ctx.unique("transport", ctx.loc2pos(@1));
+    ctx.enter(ctx.TRANSPORT);
+} COLON transport_value {
+    ctx.stack_.back()->set("transport", $4);
+    ctx.leave();
+};
+
+transport_value:
+    UDP { $$ = ElementPtr(new StringElement("UDP", ctx.loc2pos(@1))); }
+  | TCP { $$ = ElementPtr(new StringElement("TCP", ctx.loc2pos(@1))); }
+  ;
+
 // --- end of dns-servers ---------------------------------
 
 
@@ -1211,6 +1275,7 @@ output_params: output
              | maxsize
              | maxver
              | pattern
+             | async_queue_size
              ;
 
 output: OUTPUT {
@@ -1249,6 +1314,12 @@ pattern: PATTERN {
     ctx.leave();
 };
 
+async_queue_size: ASYNC_QUEUE_SIZE COLON INTEGER {
+    ctx.unique("async-queue-size", ctx.loc2pos(@1));
+    ElementPtr size(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("async-queue-size", size);
+};
+
 %%
 
 void
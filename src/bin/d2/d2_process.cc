@@ -20,12 +20,17 @@
 #include <hooks/hooks.h>
 #include <hooks/hooks_manager.h>
 #include <util/filesystem.h>
+#include <util/multi_threading_mgr.h>
+
+#include <algorithm>
+#include <cstdlib>
 
 using namespace isc::asiolink;
 using namespace isc::config;
 using namespace isc::data;
 using namespace isc::hooks;
 using namespace isc::process;
+using namespace isc::util;
 using namespace isc::util::file;
 
 namespace {
@@ -73,6 +78,8 @@ D2Process::D2Process(const char* name, const asiolink::IOServicePtr& io_service)
     // Instantiate update manager.
     // Pass in both queue manager and configuration manager.
     // Pass in IOService for DNS update transaction IO event processing.
+    // In multi-threaded mode the transactions are run by worker threads.
+    // The worker threads are started by the configuration.
     D2CfgMgrPtr tmp = getD2CfgMgr();
     update_mgr_.reset(new D2UpdateMgr(queue_mgr_, tmp, getIOService()));
 
@@ -266,6 +273,9 @@ D2Process::configure(isc::data::ConstElementPtr config_set, bool check_only) {
         .arg(check_only ? "check" : "update")
         .arg(getD2CfgMgr()->redactConfig(config_set)->str());
 
+    // The DNS update workers read the configuration: pause them.
+    MultiThreadingCriticalSection cs;
+
     isc::data::ConstElementPtr answer;
     answer = getCfgMgr()->simpleParseConfig(config_set, check_only,
                 std::bind(&D2Process::reconfigureCommandChannel, this));
@@ -298,6 +308,9 @@ D2Process::configure(isc::data::ConstElementPtr config_set, bool check_only) {
     /// did some analysis to decide what if anything we need to do.)
     reconf_queue_flag_ = true;
 
+    // Start or stop the DNS update workers.
+    reconfigureUpdateMgr();
+
     // This hook point notifies hooks libraries that the configuration of the
     // D2 server has completed. It provides the hook library with the pointer
     // to the common IO service object, new server configuration in the JSON
@@ -478,10 +491,43 @@ D2Process::reconfigureQueueMgr() {
     }
 }
 
+void
+D2Process::reconfigureUpdateMgr() {
+    const D2ParamsPtr& d2_params = getD2CfgMgr()->getD2Params();
+    size_t thread_pool_size = 0;
+    if (d2_params->getEnableMultiThreading()) {
+        thread_pool_size = d2_params->getThreadPoolSize();
+        if (!thread_pool_size) {
+            // Might also return 0.
+            thread_pool_size = MultiThreadingMgr::detectThreadCount();
+        }
+    }
+
+    if (thread_pool_size != update_mgr_->getThreadPoolSize()) {
+        update_mgr_->setThreadPoolSize(thread_pool_size);
+        MultiThreadingMgr::instance().setMode(thread_pool_size != 0);
+        if (thread_pool_size) {
+            LOG_INFO(d2_logger, DHCP_DDNS_MULTI_THREADING_STARTED)
+                .arg(thread_pool_size);
+        }
+    }
+
+    // The maximum number of concurrent transactions is scaled by the
+    // number of worker threads.
+    size_t const max_transactions = D2UpdateMgr::MAX_TRANSACTIONS_DEFAULT *
+        std::max(thread_pool_size, static_cast<size_t>(1));
+    update_mgr_->setMaxTransactions(std::max(max_transactions,
+                                             update_mgr_->getTransactionCount()));
+}
+
 D2Process::~D2Process() {
     queue_mgr_->stopListening();
     getIOService()->stopAndPoll();
     queue_mgr_->removeListener();
+
+    // Stop the DNS update workers before leaving the multi-threaded mode.
+    update_mgr_.reset();
+    MultiThreadingMgr::instance().setMode(false);
 }
 
 D2CfgMgrPtr
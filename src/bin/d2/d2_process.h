@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2025 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -162,6 +162,8 @@ public:
                                                  bool check_only = false);
 
     /// @brief Destructor
+    ///
+    /// Stops the worker threads, if any, and leaves the multi-threaded mode.
     virtual ~D2Process();
 
 protected:
@@ -205,6 +207,17 @@ protected:
     /// This method is exception safe.
     virtual void reconfigureQueueMgr();
 
+    /// @brief Applies the multi-threading configuration to the update
+    /// manager.
+    ///
+    /// When the multi-threading is enabled the update manager carries out
+    /// the DNS updates with the configured number of worker threads, or
+    /// the number of CPUs when it is 0, and the multi-threaded mode is
+    /// set.  The maximum number of concurrent transactions is scaled by
+    /// the number of threads.  The worker threads are restarted only
+    /// when their number changes.
+    void reconfigureUpdateMgr();
+
     /// @brief Allows IO processing to run until at least callback is invoked.
     ///
     /// This method is called from within the D2Process main event loop and is
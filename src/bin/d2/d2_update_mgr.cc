@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2024 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -15,11 +15,18 @@
 #include <d2/check_exists_remove.h>
 #include <d2/simple_add_without_dhcid.h>
 #include <d2/simple_remove_without_dhcid.h>
+#include <util/multi_threading_mgr.h>
 
+#include <boost/weak_ptr.hpp>
+
+#include <functional>
 #include <sstream>
 #include <iostream>
 #include <vector>
 
+using namespace isc::asiolink;
+using namespace isc::util;
+
 namespace isc {
 namespace d2 {
 
@@ -27,8 +34,10 @@ const size_t D2UpdateMgr::MAX_TRANSACTIONS_DEFAULT;
 
 D2UpdateMgr::D2UpdateMgr(D2QueueMgrPtr& queue_mgr, D2CfgMgrPtr& cfg_mgr,
                          asiolink::IOServicePtr& io_service,
-                         const size_t max_transactions)
-    :queue_mgr_(queue_mgr), cfg_mgr_(cfg_mgr), io_service_(io_service) {
+                         const size_t max_transactions,
+                         const size_t thread_pool_size)
+    :queue_mgr_(queue_mgr), cfg_mgr_(cfg_mgr), io_service_(io_service),
+     worker_pools_(), socket_pools_() {
     if (!queue_mgr_) {
         isc_throw(D2UpdateMgrError, "D2UpdateMgr queue manager cannot be null");
     }
@@ -44,12 +53,145 @@ D2UpdateMgr::D2UpdateMgr(D2QueueMgrPtr& queue_mgr, D2CfgMgrPtr& cfg_mgr,
 
     // Use setter to do validation.
     setMaxTransactions(max_transactions);
+
+    startWorkers(thread_pool_size);
 }
 
 D2UpdateMgr::~D2UpdateMgr() {
+    stopWorkers();
     transaction_list_.clear();
 }
 
+void
+D2UpdateMgr::setThreadPoolSize(const size_t thread_pool_size) {
+    if (thread_pool_size == worker_pools_.size()) {
+        return;
+    }
+
+    // The transactions run by the workers are discarded. The ones run by
+    // the upper layer IOService keep their socket pool and complete.
+    stopWorkers();
+    worker_pools_.clear();
+    socket_pools_.clear();
+    startWorkers(thread_pool_size);
+}
+
+void
+D2UpdateMgr::startWorkers(const size_t thread_pool_size) {
+    if (thread_pool_size == 0) {
+        socket_pools_.push_back(DNSSocketPoolPtr(new DNSSocketPool(io_service_)));
+        return;
+    }
+
+    // One single thread pool per worker so the transactions of a worker,
+    // and its sockets, are only used by one thread.
+    for (size_t i = 0; i < thread_pool_size; ++i) {
+        IoServiceThreadPoolPtr pool(new IoServiceThreadPool(IOServicePtr(), 1,
+                                                            true));
+        socket_pools_.push_back(DNSSocketPoolPtr(new DNSSocketPool(pool->getIOService())));
+        worker_pools_.push_back(pool);
+    }
+
+    MultiThreadingMgr::instance().addCriticalSectionCallbacks("D2_UPDATE_MGR",
+        std::bind(&D2UpdateMgr::checkPermissions, this),
+        std::bind(&D2UpdateMgr::pauseWorkers, this),
+        std::bind(&D2UpdateMgr::resumeWorkers, this));
+
+    for (auto const& pool : worker_pools_) {
+        pool->run();
+    }
+}
+
+void
+D2UpdateMgr::stopWorkers() {
+    if (worker_pools_.empty()) {
+        return;
+    }
+
+    MultiThreadingMgr::instance().removeCriticalSectionCallbacks("D2_UPDATE_MGR");
+    for (auto const& pool : worker_pools_) {
+        pool->stop();
+    }
+
+    // The transactions can now be safely destroyed from this thread. Flush
+    // what is left in the worker IO services: starts of discarded
+    // transactions are ignored and the cancelled IO handlers do nothing.
+    // Transactions run by the upper layer IOService, started before the
+    // workers, are kept.
+    auto it = transaction_list_.begin();
+    while (it != transaction_list_.end()) {
+        if (it->second->getIOService() == io_service_) {
+            ++it;
+        } else {
+            it = transaction_list_.erase(it);
+        }
+    }
+    for (size_t i = 0; i < worker_pools_.size(); ++i) {
+        socket_pools_[i]->clear();
+        worker_pools_[i]->getIOService()->stopAndPoll();
+    }
+}
+
+void
+D2UpdateMgr::checkPermissions() {
+    // Since this function is used as CS callback all exceptions must be
+    // suppressed, except the one telling it is not allowed.
+    try {
+        for (auto const& pool : worker_pools_) {
+            pool->checkPausePermissions();
+        }
+    } catch (const isc::MultiThreadingInvalidOperation& ex) {
+        LOG_ERROR(dhcp_to_d2_logger, DHCP_DDNS_WORKERS_PAUSE_ILLEGAL)
+            .arg(ex.what());
+        // The exception needs to be propagated to the caller of the
+        // @ref MultiThreadingCriticalSection constructor.
+        throw;
+    } catch (const std::exception& ex) {
+        LOG_ERROR(dhcp_to_d2_logger, DHCP_DDNS_WORKERS_PAUSE_FAILED)
+            .arg(ex.what());
+    }
+}
+
+void
+D2UpdateMgr::pauseWorkers() {
+    try {
+        for (auto const& pool : worker_pools_) {
+            pool->pause();
+        }
+    } catch (const std::exception& ex) {
+        LOG_ERROR(dhcp_to_d2_logger, DHCP_DDNS_WORKERS_PAUSE_FAILED)
+            .arg(ex.what());
+    }
+}
+
+void
+D2UpdateMgr::resumeWorkers() {
+    try {
+        for (auto const& pool : worker_pools_) {
+            pool->run();
+        }
+    } catch (const std::exception& ex) {
+        LOG_ERROR(dhcp_to_d2_logger, DHCP_DDNS_WORKERS_RESUME_FAILED)
+            .arg(ex.what());
+    }
+}
+
+size_t
+D2UpdateMgr::selectWorker(const std::string& fqdn) const {
+    if (worker_pools_.size() < 2) {
+        return (0);
+    }
+    return (std::hash<std::string>()(fqdn) % worker_pools_.size());
+}
+
+IOServicePtr
+D2UpdateMgr::getWorkerIOService(const std::string& fqdn) const {
+    if (worker_pools_.empty()) {
+        return (io_service_);
+    }
+    return (worker_pools_[selectWorker(fqdn)]->getIOService());
+}
+
 void D2UpdateMgr::sweep() {
     // cleanup finished transactions;
     checkFinishedTransactions();
@@ -60,7 +202,9 @@ void D2UpdateMgr::sweep() {
     // start one new transaction per invocation.  On the other hand a busy
     // system will generate many IO events and this method will be called
     // frequently.  It will likely achieve max transactions quickly on its own.
-    if (getQueueCount() > 0) {
+    // This does not hold in multi-threaded mode where the transaction IO
+    // events are handled by the workers, so all the free slots are filled.
+    while (getQueueCount() > 0) {
         if (getTransactionCount() >= max_transactions_) {
             LOG_DEBUG(dhcp_to_d2_logger, isc::log::DBGLVL_TRACE_DETAIL_DATA,
                       DHCP_DDNS_AT_MAX_TRANSACTIONS).arg(getQueueCount())
@@ -70,7 +214,9 @@ void D2UpdateMgr::sweep() {
         }
 
         // We are not at maximum transactions, so pick and start the next job.
-        pickNextJob();
+        if (!pickNextJob() || worker_pools_.empty()) {
+            return;
+        }
     }
 }
 
@@ -90,6 +236,11 @@ D2UpdateMgr::checkFinishedTransactions() {
         if (trans->isModelDone()) {
             // @todo Additional actions based on NCR status could be
             // performed here.
+            if (!worker_pools_.empty()) {
+                // The worker may still be returning from the handler which
+                // ended the transaction: let it drop the last reference.
+                getWorkerIOService(trans->getNcr()->getFqdn())->post([trans]() {});
+            }
             transaction_list_.erase(it++);
         } else {
             ++it;
@@ -97,7 +248,7 @@ D2UpdateMgr::checkFinishedTransactions() {
     }
 }
 
-void D2UpdateMgr::pickNextJob() {
+bool D2UpdateMgr::pickNextJob() {
     // Start at the front of the queue, looking for the first entry for
     // which no transaction is in progress.  If we find an eligible entry
     // remove it from the queue and make a transaction for it.  If the
@@ -115,7 +266,7 @@ void D2UpdateMgr::pickNextJob() {
             // Dequeue it and try to make transaction for it.
             queue_mgr_->dequeueAt(index);
             if (makeTransaction(found_ncr)) {
-                return;
+                return (true);
             }
 
             // One less in the queue.
@@ -128,6 +279,7 @@ void D2UpdateMgr::pickNextJob() {
     LOG_DEBUG(dhcp_to_d2_logger, isc::log::DBGLVL_TRACE_DETAIL_DATA,
               DHCP_DDNS_NO_ELIGIBLE_JOBS)
         .arg(getQueueCount()).arg(getTransactionCount());
+    return (false);
 }
 
 bool
@@ -206,31 +358,30 @@ D2UpdateMgr::makeTransaction(dhcp_ddns::NameChangeRequestPtr& next_ncr) {
     }
 
     // We matched to the required servers, so construct the transaction.
-    // @todo If multi-threading is implemented, one would pass in an
-    // empty IOServicePtr, rather than our instance value.  This would cause
-    // the transaction to instantiate its own, separate IOService to handle
-    // the transaction's IO.
+    // In multi-threaded mode it is handled by the worker of its FQDN.
+    size_t const worker = selectWorker(next_ncr->getFqdn());
+    IOServicePtr io_service = getWorkerIOService(next_ncr->getFqdn());
     NameChangeTransactionPtr trans;
     if (next_ncr->getChangeType() == dhcp_ddns::CHG_ADD) {
         switch(next_ncr->getConflictResolutionMode()) {
         case dhcp_ddns::CHECK_WITH_DHCID:
-            trans.reset(new NameAddTransaction(io_service_, next_ncr,
+            trans.reset(new NameAddTransaction(io_service, next_ncr,
                                                forward_domain, reverse_domain,
                                                cfg_mgr_));
             break;
         case dhcp_ddns::CHECK_EXISTS_WITH_DHCID:
-            trans.reset(new CheckExistsAddTransaction(io_service_, next_ncr,
+            trans.reset(new CheckExistsAddTransaction(io_service, next_ncr,
                                                       forward_domain, reverse_domain,
                                                       cfg_mgr_));
             break;
         case dhcp_ddns::NO_CHECK_WITHOUT_DHCID:
-            trans.reset(new SimpleAddWithoutDHCIDTransaction(io_service_, next_ncr,
+            trans.reset(new SimpleAddWithoutDHCIDTransaction(io_service, next_ncr,
                                                              forward_domain, reverse_domain,
                                                              cfg_mgr_));
             break;
         default:
             // dhcp_ddns::NO_CHECK_WITH_DHCID
-            trans.reset(new SimpleAddTransaction(io_service_, next_ncr,
+            trans.reset(new SimpleAddTransaction(io_service, next_ncr,
                                                  forward_domain, reverse_domain,
                                                  cfg_mgr_));
             break;
@@ -238,34 +389,61 @@ D2UpdateMgr::makeTransaction(dhcp_ddns::NameChangeRequestPtr& next_ncr) {
     } else {
         switch(next_ncr->getConflictResolutionMode()) {
         case dhcp_ddns::CHECK_WITH_DHCID:
-            trans.reset(new NameRemoveTransaction(io_service_, next_ncr,
+            trans.reset(new NameRemoveTransaction(io_service, next_ncr,
                                                   forward_domain, reverse_domain,
                                                   cfg_mgr_));
             break;
         case dhcp_ddns::CHECK_EXISTS_WITH_DHCID:
-            trans.reset(new CheckExistsRemoveTransaction(io_service_, next_ncr,
+            trans.reset(new CheckExistsRemoveTransaction(io_service, next_ncr,
                                                          forward_domain, reverse_domain,
                                                          cfg_mgr_));
             break;
         case dhcp_ddns::NO_CHECK_WITHOUT_DHCID:
-            trans.reset(new SimpleRemoveWithoutDHCIDTransaction(io_service_, next_ncr,
+            trans.reset(new SimpleRemoveWithoutDHCIDTransaction(io_service, next_ncr,
                                                                 forward_domain, reverse_domain,
                                                                 cfg_mgr_));
             break;
         default:
             // dhcp_ddns::NO_CHECK_WITH_DHCID
-            trans.reset(new SimpleRemoveTransaction(io_service_, next_ncr,
+            trans.reset(new SimpleRemoveTransaction(io_service, next_ncr,
                                                     forward_domain, reverse_domain,
                                                     cfg_mgr_));
             break;
         }
     }
 
+    trans->setSocketPool(socket_pools_[worker]);
+
     // Add the new transaction to the list.
     transaction_list_[key] = trans;
 
-    // Start it.
-    trans->startTransaction();
+    if (worker_pools_.empty()) {
+        // Start it.
+        trans->startTransaction();
+        return (true);
+    }
+
+    // Wake up the upper layer when the transaction ends so it is swept.
+    IOServicePtr main_io_service = io_service_;
+    trans->setCompletionHandler([main_io_service]() {
+        main_io_service->post([]() {});
+    });
+
+    // Start it on its worker. Do not keep it alive: if it is discarded
+    // before the worker gets to it there is nothing to start.
+    boost::weak_ptr<NameChangeTransaction> weak_trans(trans);
+    io_service->post([weak_trans]() {
+        NameChangeTransactionPtr trans = weak_trans.lock();
+        if (!trans) {
+            return;
+        }
+        try {
+            trans->startTransaction();
+        } catch (const std::exception& ex) {
+            LOG_ERROR(dhcp_to_d2_logger, DHCP_DDNS_STATE_MODEL_UNEXPECTED_ERROR)
+                .arg(trans->getRequestId()).arg(ex.what());
+        }
+    });
     return (true);
 }
 
@@ -301,6 +479,8 @@ void
 D2UpdateMgr::clearTransactionList() {
     // @todo for now this just wipes them out. We might need something
     // more elegant, that allows a cancel first.
+    // The workers must not run transactions while they are destroyed.
+    MultiThreadingCriticalSection cs;
     transaction_list_.clear();
 }
 
@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2024 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -10,6 +10,7 @@
 /// @file d2_update_mgr.h This file defines the class D2UpdateMgr.
 
 #include <asiolink/io_service.h>
+#include <asiolink/io_service_thread_pool.h>
 #include <d2/d2_queue_mgr.h>
 #include <d2srv/nc_trans.h>
 #include <d2srv/d2_cfg_mgr.h>
@@ -19,6 +20,7 @@
 #include <boost/noncopyable.hpp>
 #include <boost/shared_ptr.hpp>
 #include <map>
+#include <vector>
 
 namespace isc {
 namespace d2 {
@@ -62,6 +64,19 @@ typedef std::map<TransactionKey, NameChangeTransactionPtr> TransactionList;
 /// The upper layer(s) are responsible for calling sweep in a timely and cyclic
 /// manner.
 ///
+/// In multi-threaded mode (a non zero thread pool size) the transactions are
+/// carried out by worker threads, each running its own IOService.  A request
+/// is dispatched to a worker by hashing its FQDN so the updates for a given
+/// name are always handled by the same thread.  The queue and the list of
+/// transactions remain owned by the thread calling sweep(): workers only
+/// run the transactions and wake it up when one of them ends.  The workers
+/// are paused while the multi-threading critical section is held, e.g.
+/// during a reconfiguration.
+///
+/// Each worker (or the upper layer IOService in single-threaded mode) has a
+/// pool of sockets to the DNS servers so consecutive updates sent to a
+/// server reuse the same sockets.
+///
 class D2UpdateMgr : public boost::noncopyable {
 public:
     /// @brief Maximum number of concurrent transactions
@@ -76,14 +91,19 @@ public:
     /// @param io_service IO service used by the upper layer(s) to manage
     /// IO events
     /// @param max_transactions the maximum number of concurrent transactions
+    /// @param thread_pool_size the number of worker threads, 0 (the default)
+    /// to carry out the transactions on the given IO service.
     ///
     /// @throw D2UpdateMgrError if either the queue manager or configuration
     /// managers are NULL, or max transactions is less than one.
     D2UpdateMgr(D2QueueMgrPtr& queue_mgr, D2CfgMgrPtr& cfg_mgr,
                 asiolink::IOServicePtr& io_service,
-                const size_t max_transactions = MAX_TRANSACTIONS_DEFAULT);
+                const size_t max_transactions = MAX_TRANSACTIONS_DEFAULT,
+                const size_t thread_pool_size = 0);
 
     /// @brief Destructor
+    ///
+    /// Stops the worker threads and discards the transactions.
     virtual ~D2UpdateMgr();
 
     /// @brief Check current transactions; start transactions for new requests.
@@ -100,6 +120,9 @@ public:
     ///
     /// - If a request was selected, start a new transaction for it and
     /// add the transaction to the list of transactions.
+    ///
+    /// In multi-threaded mode the last two steps are repeated until the
+    /// maximum number of transactions is reached or no request is eligible.
     void sweep();
 
 protected:
@@ -123,7 +146,9 @@ protected:
     /// It is possible that no such request exists, though this is likely to be
     /// rather rare unless a system is frequently seeing requests for the same
     /// clients in quick succession.
-    void pickNextJob();
+    ///
+    /// @return True if a transaction was started, false otherwise.
+    bool pickNextJob();
 
     /// @brief Create a new transaction for the given request.
     ///
@@ -155,6 +180,35 @@ protected:
     /// exists. Note this would be programmatic error.
     bool makeTransaction(isc::dhcp_ddns::NameChangeRequestPtr& ncr);
 
+    /// @brief Returns the worker handling the given FQDN.
+    ///
+    /// @param fqdn the FQDN of a request.
+    ///
+    /// @return the index of the worker, always 0 in single-threaded mode.
+    size_t selectWorker(const std::string& fqdn) const;
+
+    /// @brief Creates the socket pools and starts the worker threads.
+    ///
+    /// @param thread_pool_size the number of worker threads, 0 to carry
+    /// out the transactions on the upper layer IOService.
+    void startWorkers(const size_t thread_pool_size);
+
+    /// @brief Stops the worker threads.
+    ///
+    /// Transactions in progress are discarded.
+    void stopWorkers();
+
+    /// @brief Critical section callback checking the caller is not a worker.
+    ///
+    /// @throw MultiThreadingInvalidOperation if called from a worker thread.
+    void checkPermissions();
+
+    /// @brief Critical section entry callback pausing the workers.
+    void pauseWorkers();
+
+    /// @brief Critical section exit callback resuming the workers.
+    void resumeWorkers();
+
 public:
     /// @brief Gets the D2UpdateMgr's IOService.
     ///
@@ -168,6 +222,42 @@ public:
         return (max_transactions_);
     }
 
+    /// @brief Returns the number of worker threads.
+    ///
+    /// @return the number of worker threads, 0 in single-threaded mode.
+    size_t getThreadPoolSize() const {
+        return (worker_pools_.size());
+    }
+
+    /// @brief Changes the number of worker threads.
+    ///
+    /// The workers are stopped, discarding the transactions they run, and
+    /// new ones are started.  It does nothing when the number of worker
+    /// threads does not change.  Transactions run by the upper layer
+    /// IOService are not affected.
+    ///
+    /// @param thread_pool_size the number of worker threads, 0 to carry
+    /// out the transactions on the upper layer IOService.
+    void setThreadPoolSize(const size_t thread_pool_size);
+
+    /// @brief Returns the IOService of the worker handling the given FQDN.
+    ///
+    /// @param fqdn the FQDN of a request.
+    ///
+    /// @return the IOService of the worker, or the upper layer IOService
+    /// in single-threaded mode.
+    asiolink::IOServicePtr getWorkerIOService(const std::string& fqdn) const;
+
+    /// @brief Returns the pool of sockets of the worker handling the given
+    /// FQDN.
+    ///
+    /// @param fqdn the FQDN of a request.
+    ///
+    /// @return the socket pool.
+    const DNSSocketPoolPtr& getSocketPool(const std::string& fqdn) const {
+        return (socket_pools_[selectWorker(fqdn)]);
+    }
+
     /// @brief Sets the maximum number of entries allowed in the queue.
     ///
     /// @param max_transactions is the new maximum number of transactions
@@ -228,15 +318,23 @@ private:
 
     /// @brief Primary IOService instance.
     /// This is the IOService that the upper layer(s) use for IO events, such
-    /// as shutdown and configuration commands.  It is the IOService that is
-    /// passed into transactions to manager their IO events.
-    /// (For future reference, multi-threaded transactions would each use their
-    /// own IOService instance.)
+    /// as shutdown and configuration commands.  In single-threaded mode it
+    /// is the IOService that is passed into transactions to manager their
+    /// IO events.  In multi-threaded mode the transactions use the IOService
+    /// of their worker.
     asiolink::IOServicePtr io_service_;
 
     /// @brief Maximum number of concurrent transactions.
     size_t max_transactions_;
 
+    /// @brief Worker thread pools, one thread each (empty in single-threaded
+    /// mode).
+    std::vector<asiolink::IoServiceThreadPoolPtr> worker_pools_;
+
+    /// @brief Socket pools, one per worker or one for the upper layer
+    /// IOService in single-threaded mode.
+    std::vector<DNSSocketPoolPtr> socket_pools_;
+
     /// @brief List of transactions.
     TransactionList transaction_list_;
 };
@@ -1,4 +1,4 @@
-// Copyright (C) 2017-2024 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2017-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -203,6 +203,10 @@ D2ParserContext::contextName()
         return ("ncr-protocol");
     case NCR_FORMAT:
         return ("ncr-format");
+    case MULTI_THREADING:
+        return ("multi-threading");
+    case TRANSPORT:
+        return ("transport");
     case HOOKS_LIBRARIES:
         return ("hooks-libraries");
     default:
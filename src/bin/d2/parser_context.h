@@ -1,4 +1,4 @@
-// Copyright (C) 2017-2024 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2017-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -281,6 +281,12 @@ public:
         /// Used while parsing DhcpDdns/ncr-format
         NCR_FORMAT,
 
+        /// Used while parsing DhcpDdns/multi-threading
+        MULTI_THREADING,
+
+        /// Used while parsing DhcpDdns/.../dns-servers/transport
+        TRANSPORT,
+
         /// Used while parsing DhcpDdns/hooks-libraries.
         HOOKS_LIBRARIES
 
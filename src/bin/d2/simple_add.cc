@@ -1,4 +1,4 @@
-// Copyright (C) 2020-2024 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2020-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -201,9 +201,13 @@ SimpleAddTransaction::replacingFwdAddrsHandler() {
                 // We were able to add it. Mark it as done.
                 setForwardChangeCompleted(true);
 
-                // If request calls for reverse update then do that next,
-                // otherwise we can process ok.
-                if (getReverseDomain()) {
+                // If the reverse change was sent along with the forward
+                // change it is done too.  Otherwise if request calls for
+                // reverse update then do that next, else we can process ok.
+                if (isSingleZoneUpdate()) {
+                    setReverseChangeCompleted(true);
+                    transition(PROCESS_TRANS_OK_ST, UPDATE_OK_EVT);
+                } else if (getReverseDomain()) {
                     transition(SELECTING_REV_SERVER_ST, SELECT_SERVER_EVT);
                 } else {
                     transition(PROCESS_TRANS_OK_ST, UPDATE_OK_EVT);
@@ -503,6 +507,11 @@ SimpleAddTransaction::buildReplaceFwdAddressRequest() {
     addDhcidRdata(update);
     request->addRRset(D2UpdateMessage::SECTION_UPDATE, update);
 
+    // When the reverse change is in the same zone send it in this request.
+    if (isSingleZoneUpdate()) {
+        addReplaceRevPtrsUpdates(request);
+    }
+
     // Set the transaction's update request to the new request.
     setDnsUpdateRequest(request);
 }
@@ -512,6 +521,15 @@ SimpleAddTransaction::buildReplaceRevPtrsRequest() {
     // Construct an empty request.
     D2UpdateMessagePtr request = prepNewRequest(getReverseDomain());
 
+    // Add the reverse changes.
+    addReplaceRevPtrsUpdates(request);
+
+    // Set the transaction's update request to the new request.
+    setDnsUpdateRequest(request);
+}
+
+void
+SimpleAddTransaction::addReplaceRevPtrsUpdates(D2UpdateMessagePtr& request) {
     // Create the reverse IP address "FQDN".
     std::string rev_addr = D2CfgMgr::reverseIpAddress(getNcr()->getIpAddress());
     dns::Name rev_ip(rev_addr);
@@ -545,9 +563,6 @@ SimpleAddTransaction::buildReplaceRevPtrsRequest() {
                                 dns::RRType::DHCID(), lease_ttl));
     addDhcidRdata(update);
     request->addRRset(D2UpdateMessage::SECTION_UPDATE, update);
-
-    // Set the transaction's update request to the new request.
-    setDnsUpdateRequest(request);
 }
 
 } // namespace isc::d2
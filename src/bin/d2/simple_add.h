@@ -1,4 +1,4 @@
-// Copyright (C) 2020-2025 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2020-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -42,6 +42,10 @@ public:
 ///
 /// @endcode
 ///
+/// When the forward and reverse domains are the same zone, the reverse
+/// entry is replaced in the same request as the forward entry and no
+/// reverse server is selected.
+///
 /// This class derives from NameChangeTransaction from which it inherits
 /// states, events, and methods common to NameChangeRequest processing.
 class SimpleAddTransaction : public NameChangeTransaction {
@@ -212,10 +216,12 @@ protected:
     ///
     /// Transitions to:
     /// - SELECTING_REV_SERVER_ST with next event of SELECT_SERVER_EVT upon
-    /// successful addition and the request includes a reverse DNS update.
+    /// successful addition and the request includes a reverse DNS update
+    /// in another zone.
     ///
     /// - PROCESS_TRANS_OK_ST with next event of UPDATE_OK_EVT upon successful
-    /// addition and no reverse DNS update is required.
+    /// addition and no reverse DNS update is required, or it was sent in
+    /// the forward request.
     ///
     /// - PROCESS_TRANS_FAILED_ST with next event of UPDATE_FAILED_EVT if the
     /// DNS server rejected the update for any other reason or the IO completed
@@ -325,6 +331,9 @@ protected:
     /// -# An FQDN/IP RR addition    (type A for IPv4, AAAA for IPv6)
     /// -# An FQDN/DHCID RR addition (type DHCID)
     ///
+    /// When the reverse domain is the same zone, the reverse updates
+    /// RRsets are appended (see @ref addReplaceRevPtrsUpdates).
+    ///
     /// @throw This method does not throw but underlying methods may.
     void buildReplaceFwdAddressRequest();
 
@@ -345,6 +354,13 @@ protected:
     ///
     /// @throw This method does not throw but underlying methods may.
     void buildReplaceRevPtrsRequest();
+
+    /// @brief Adds the updates RRsets replacing a reverse DNS entry.
+    ///
+    /// @param request the DNS update request to add the RRsets to.
+    ///
+    /// @throw This method does not throw but underlying methods may.
+    void addReplaceRevPtrsUpdates(D2UpdateMessagePtr& request);
 };
 
 /// @brief Defines a pointer to a SimpleAddTransaction.
@@ -1,4 +1,4 @@
-// Copyright (C) 2023-2024 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2023-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -202,9 +202,13 @@ SimpleAddWithoutDHCIDTransaction::replacingFwdAddrsHandler() {
                 // We were able to add it. Mark it as done.
                 setForwardChangeCompleted(true);
 
-                // If request calls for reverse update then do that next,
-                // otherwise we can process ok.
-                if (getReverseDomain()) {
+                // If the reverse change was sent along with the forward
+                // change it is done too.  Otherwise if request calls for
+                // reverse update then do that next, else we can process ok.
+                if (isSingleZoneUpdate()) {
+                    setReverseChangeCompleted(true);
+                    transition(PROCESS_TRANS_OK_ST, UPDATE_OK_EVT);
+                } else if (getReverseDomain()) {
                     transition(SELECTING_REV_SERVER_ST, SELECT_SERVER_EVT);
                 } else {
                     transition(PROCESS_TRANS_OK_ST, UPDATE_OK_EVT);
@@ -490,6 +494,11 @@ SimpleAddWithoutDHCIDTransaction::buildReplaceFwdAddressRequest() {
     addLeaseAddressRdata(update);
     request->addRRset(D2UpdateMessage::SECTION_UPDATE, update);
 
+    // When the reverse change is in the same zone send it in this request.
+    if (isSingleZoneUpdate()) {
+        addReplaceRevPtrsUpdates(request);
+    }
+
     // Set the transaction's update request to the new request.
     setDnsUpdateRequest(request);
 }
@@ -499,6 +508,15 @@ SimpleAddWithoutDHCIDTransaction::buildReplaceRevPtrsRequest() {
     // Construct an empty request.
     D2UpdateMessagePtr request = prepNewRequest(getReverseDomain());
 
+    // Add the reverse changes.
+    addReplaceRevPtrsUpdates(request);
+
+    // Set the transaction's update request to the new request.
+    setDnsUpdateRequest(request);
+}
+
+void
+SimpleAddWithoutDHCIDTransaction::addReplaceRevPtrsUpdates(D2UpdateMessagePtr& request) {
     // Create the reverse IP address "FQDN".
     std::string rev_addr = D2CfgMgr::reverseIpAddress(getNcr()->getIpAddress());
     dns::Name rev_ip(rev_addr);
@@ -520,9 +538,6 @@ SimpleAddWithoutDHCIDTransaction::buildReplaceRevPtrsRequest() {
                                 dns::RRType::PTR(), lease_ttl));
     addPtrRdata(update);
     request->addRRset(D2UpdateMessage::SECTION_UPDATE, update);
-
-    // Set the transaction's update request to the new request.
-    setDnsUpdateRequest(request);
 }
 
 } // namespace isc::d2
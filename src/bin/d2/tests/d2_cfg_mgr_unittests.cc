@@ -393,6 +393,79 @@ TEST_F(D2CfgMgrTest, defaultValues) {
     ASSERT_TRUE(deflt);
     EXPECT_EQ(dhcp_ddns::stringToNcrFormat(deflt->stringValue()),
               d2_params_->getNcrFormat());
+
+    // Check that omitting multi-threading gets you its defaults
+    ConstElementPtr mt;
+    ASSERT_NO_THROW(mt = defaults->get("multi-threading"));
+    ASSERT_TRUE(mt);
+    ASSERT_NO_THROW(deflt = mt->get("enable-multi-threading"));
+    ASSERT_TRUE(deflt);
+    EXPECT_EQ(deflt->boolValue(), d2_params_->getEnableMultiThreading());
+    ASSERT_NO_THROW(deflt = mt->get("thread-pool-size"));
+    ASSERT_TRUE(deflt);
+    EXPECT_EQ(deflt->intValue(),
+              static_cast<int>(d2_params_->getThreadPoolSize()));
+}
+
+/// @brief Tests the multi-threading parameters.
+TEST_F(D2CfgMgrTest, multiThreading) {
+    std::string config =
+            "{"
+            " \"multi-threading\": {"
+            " \"enable-multi-threading\": true,"
+            " \"thread-pool-size\": 4 }, "
+            " \"tsig-keys\": [], "
+            " \"forward-ddns\" : {}, "
+            " \"reverse-ddns\" : {} "
+            "}";
+    RUN_CONFIG_OK(config);
+    EXPECT_TRUE(d2_params_->getEnableMultiThreading());
+    EXPECT_EQ(4U, d2_params_->getThreadPoolSize());
+    EXPECT_EQ("listening on 127.0.0.1, port 53001, using UDP,"
+              " multi-threading enabled with 4 threads",
+              d2_params_->getConfigSummary());
+
+    // The thread pool size defaults to 0 (number of CPUs).
+    config =
+            "{"
+            " \"multi-threading\": {"
+            " \"enable-multi-threading\": true }, "
+            " \"tsig-keys\": [], "
+            " \"forward-ddns\" : {}, "
+            " \"reverse-ddns\" : {} "
+            "}";
+    RUN_CONFIG_OK(config);
+    EXPECT_TRUE(d2_params_->getEnableMultiThreading());
+    EXPECT_EQ(0U, d2_params_->getThreadPoolSize());
+    EXPECT_EQ("listening on 127.0.0.1, port 53001, using UDP,"
+              " multi-threading enabled",
+              d2_params_->getConfigSummary());
+
+    // The enable flag is required.
+    config =
+            "{"
+            " \"multi-threading\": {"
+            " \"thread-pool-size\": 4 }, "
+            " \"tsig-keys\": [], "
+            " \"forward-ddns\" : {}, "
+            " \"reverse-ddns\" : {} "
+            "}";
+    SYNTAX_ERROR(config, "missing parameter 'enable-multi-threading' "
+                 "(<string>:1:3) [multi-threading map between "
+                 "<string>:1:22 and <string>:1:46]");
+
+    // The thread pool size must not be negative.
+    config =
+            "{"
+            " \"multi-threading\": {"
+            " \"enable-multi-threading\": true,"
+            " \"thread-pool-size\": -1 }, "
+            " \"tsig-keys\": [], "
+            " \"forward-ddns\" : {}, "
+            " \"reverse-ddns\" : {} "
+            "}";
+    SYNTAX_ERROR(config, "<string>:1.76-77: "
+                 "thread-pool-size must not be negative");
 }
 
 /// @brief Tests the unsupported scalar parameters and objects are detected.
@@ -282,8 +282,9 @@ TEST_F(D2SimpleParserTest, globalD2Defaults) {
 
     EXPECT_NO_THROW(num = D2SimpleParser::setAllDefaults(empty));
 
-    // We expect 5 parameters to be inserted.
-    EXPECT_EQ(num, 8U);
+    // We expect 5 parameters, the 2 multi-threading parameters and
+    // 3 maps or lists to be inserted.
+    EXPECT_EQ(num, 10U);
 
     // Let's go over all parameters we have defaults for.
     for (auto const& deflt : D2SimpleParser::D2_GLOBAL_DEFAULTS) {
@@ -305,6 +306,20 @@ TEST_F(D2SimpleParserTest, globalD2Defaults) {
             }
         }
     }
+
+    // Check the multi-threading defaults.
+    ConstElementPtr mt = empty->get("multi-threading");
+    ASSERT_TRUE(mt);
+    ASSERT_EQ(Element::map, mt->getType());
+    for (auto const& deflt : D2SimpleParser::D2_MULTI_THREADING_DEFAULTS) {
+        ConstElementPtr x = mt->get(deflt.name_);
+        ASSERT_TRUE(x) << deflt.name_;
+        if (deflt.type_ == Element::integer) {
+            checkIntegerValue(x, deflt);
+        } else {
+            checkBooleanValue(x, deflt);
+        }
+    }
 }
 
 /// @brief Test fixture class for testing TSIGKeyInfo parsing.
@@ -916,6 +931,7 @@ TEST_F(TSIGKeyInfoListParserTest, validTSIGKeyList) {
 /// 1. Specifying both a hostname and an ip address is not allowed.
 /// 2. Specifying both blank a hostname and blank ip address is not allowed.
 /// 3. Specifying a negative port number is not allowed.
+/// 4. Specifying an unknown transport is not allowed.
 
 TEST_F(DnsServerInfoParserTest, invalidEntry) {
     // Create a config in which both host and ip address are supplied.
@@ -940,6 +956,14 @@ TEST_F(DnsServerInfoParserTest, invalidEntry) {
              "  \"ip-address\": \"192.168.5.6\" ,"
              "  \"port\": -100 }";
     PARSE_FAIL(config, "<string>:1.60-63: port must be greater than zero but less than 65536");
+
+    // Create a config with an unknown transport.
+    // Verify that build fails.
+    config = "{ \"hostname\": \"\", "
+             "  \"ip-address\": \"192.168.5.6\" ,"
+             "  \"transport\": \"sctp\" }";
+    PARSE_FAIL(config, "<string>:1.65-70: syntax error, unexpected constant "
+                       "string, expecting UDP or TCP");
 }
 
 
@@ -949,6 +973,7 @@ TEST_F(DnsServerInfoParserTest, invalidEntry) {
 /// 1. A DnsServerInfo entry is correctly made, when given only a hostname.
 /// 2. A DnsServerInfo entry is correctly made, when given ip address and port.
 /// 3. A DnsServerInfo entry is correctly made, when given only an ip address.
+/// 4. A DnsServerInfo entry is correctly made, when given a transport.
 TEST_F(DnsServerInfoParserTest, validEntry) {
     /// @todo When resolvable hostname is supported you'll need this test.
     /// // Valid entries for dynamic host
@@ -975,10 +1000,12 @@ TEST_F(DnsServerInfoParserTest, validEntry) {
     // Valid entries for static ip
     std::string config = " { \"hostname\" : \"\", "
                          "  \"ip-address\": \"127.0.0.1\" , "
-                         "  \"port\": 100 }";
+                         "  \"port\": 100, "
+                         "  \"transport\": \"UDP\" }";
     PARSE_OK(config);
     ASSERT_TRUE(server_);
     EXPECT_TRUE(checkServer(server_, "", "127.0.0.1", 100));
+    EXPECT_EQ(DNSClient::UDP, server_->getTransport());
 
     // Verify unparsing.
     runToElementTest<DnsServerInfo>(config, *server_);
@@ -990,6 +1017,18 @@ TEST_F(DnsServerInfoParserTest, validEntry) {
     ASSERT_TRUE(server_);
     EXPECT_TRUE(checkServer(server_, "", "192.168.2.5",
                             DnsServerInfo::STANDARD_DNS_PORT));
+    EXPECT_EQ(DNSClient::UDP, server_->getTransport());
+
+    // Valid entries for static ip over TCP.
+    // Transport keywords are case insensitive.
+    config = " { \"ip-address\": \"192.168.2.5\", "
+             "   \"transport\": \"tcp\" }";
+    PARSE_OK(config);
+    ASSERT_TRUE(server_);
+    EXPECT_TRUE(checkServer(server_, "", "192.168.2.5",
+                            DnsServerInfo::STANDARD_DNS_PORT));
+    EXPECT_EQ(DNSClient::TCP, server_->getTransport());
+    EXPECT_EQ("192.168.2.5 port:53 transport:TCP", server_->toText());
 }
 
 /// @brief Verifies that attempting to parse an invalid list of DnsServerInfo
@@ -1142,6 +1181,8 @@ TEST_F(DdnsDomainParserTest, validDomain) {
         ASSERT_NO_THROW(server_json = servers_json->getNonConst(i));
         ASSERT_NO_THROW(server_json->set("hostname",
                                          Element::create(std::string())));
+        ASSERT_NO_THROW(server_json->set("transport",
+                                         Element::create(std::string("UDP"))));
     }
     runToElementTest<DdnsDomain>(json, *domain_);
 }
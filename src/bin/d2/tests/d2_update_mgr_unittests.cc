@@ -14,6 +14,7 @@
 #include <d2/simple_add.h>
 #include <d2/simple_remove.h>
 #include <process/testutils/d_test_stubs.h>
+#include <testutils/multi_threading_utils.h>
 
 #include <gtest/gtest.h>
 #include <algorithm>
@@ -25,6 +26,7 @@ using namespace isc::dhcp_ddns;
 using namespace isc::d2;
 using namespace isc::process;
 using namespace isc::util;
+using namespace isc::test;
 
 namespace {
 
@@ -39,8 +41,10 @@ public:
     /// Parameters match those needed by D2UpdateMgr.
     D2UpdateMgrWrapper(D2QueueMgrPtr& queue_mgr, D2CfgMgrPtr& cfg_mgr,
                        asiolink::IOServicePtr& io_service,
-                       const size_t max_transactions = MAX_TRANSACTIONS_DEFAULT)
-        : D2UpdateMgr(queue_mgr, cfg_mgr, io_service, max_transactions) {
+                       const size_t max_transactions = MAX_TRANSACTIONS_DEFAULT,
+                       const size_t thread_pool_size = 0)
+        : D2UpdateMgr(queue_mgr, cfg_mgr, io_service, max_transactions,
+                      thread_pool_size) {
     }
 
     /// @brief Destructor
@@ -294,6 +298,13 @@ TEST(D2UpdateMgr, construction) {
 
     // Verify that max transactions is correct.
     EXPECT_EQ(100U, update_mgr->getMaxTransactions());
+
+    // Verify that the default is the single-threaded mode.
+    EXPECT_EQ(0U, update_mgr->getThreadPoolSize());
+    EXPECT_EQ(io_service, update_mgr->getWorkerIOService("my.example.com."));
+    ASSERT_TRUE(update_mgr->getSocketPool("my.example.com."));
+    EXPECT_EQ(io_service,
+              update_mgr->getSocketPool("my.example.com.")->getIOService());
 }
 
 /// @brief Tests the D2UpdateManager's transaction list services
@@ -1041,4 +1052,91 @@ TEST_F(D2UpdateMgrTest, simpleRemoveTransaction) {
               trans->getLastEvent());
 }
 
+/// @brief Tests the multi-threaded mode of the update manager.
+/// This test verifies that:
+/// 1. Worker threads are created with their own IO service and socket pool.
+/// 2. The requests for a given FQDN are always handled by the same worker.
+/// 3. Transactions run by the workers complete and wake up the main
+/// IO service so they can be cleaned up.
+TEST_F(D2UpdateMgrTest, multiThreaded) {
+    MultiThreadingTest mt(true);
+    ASSERT_NO_THROW(update_mgr_.reset(new D2UpdateMgrWrapper(queue_mgr_,
+        cfg_mgr_, io_service_, D2UpdateMgr::MAX_TRANSACTIONS_DEFAULT, 2)));
+    EXPECT_EQ(2U, update_mgr_->getThreadPoolSize());
+
+    // Verify the worker of the canned requests.
+    asiolink::IOServicePtr worker = update_mgr_->getWorkerIOService("my.example.com.");
+    ASSERT_TRUE(worker);
+    EXPECT_NE(io_service_, worker);
+    EXPECT_EQ(worker, update_mgr_->getWorkerIOService("my.example.com."));
+    EXPECT_EQ(worker,
+              update_mgr_->getSocketPool("my.example.com.")->getIOService());
+
+    // Put each request on the queue.
+    for (size_t i = 0; i < canned_count_; i++) {
+        canned_ncrs_[i]->setChangeType(dhcp_ddns::CHG_ADD);
+        canned_ncrs_[i]->setReverseChange(true);
+        canned_ncrs_[i]->setConflictResolutionMode(dhcp_ddns::NO_CHECK_WITH_DHCID);
+        ASSERT_NO_THROW(queue_mgr_->enqueue(canned_ncrs_[i]));
+    }
+
+    // The server is run by the main IO service.
+    asiolink::IOAddress address("127.0.0.1");
+    server_.reset(new FauxServer(io_service_, address, 5301));
+    server_->receive(FauxServer::USE_RCODE, dns::Rcode::NOERROR());
+
+    // A single sweep starts all the transactions.
+    ASSERT_NO_THROW(update_mgr_->sweep());
+    EXPECT_EQ(0U, update_mgr_->getQueueCount());
+    EXPECT_EQ(canned_count_, update_mgr_->getTransactionCount());
+
+    // Run the main IO service until all the transactions are done.
+    for (size_t passes = 0;
+         update_mgr_->getTransactionCount() && (passes < 100); ++passes) {
+        runTimedIO(100);
+        ASSERT_NO_THROW(update_mgr_->sweep());
+    }
+    EXPECT_EQ(0U, update_mgr_->getTransactionCount());
+
+    // Verify that the requests succeeded.
+    for (size_t i = 0; i < canned_count_; i++) {
+        EXPECT_EQ(dhcp_ddns::ST_COMPLETED, canned_ncrs_[i]->getStatus());
+    }
+
+    // Stop the workers before leaving the multi-threaded mode.
+    update_mgr_.reset();
+}
+
+/// @brief Tests that the number of worker threads can be changed.
+TEST_F(D2UpdateMgrTest, setThreadPoolSize) {
+    MultiThreadingTest mt(true);
+    EXPECT_EQ(0U, update_mgr_->getThreadPoolSize());
+    EXPECT_EQ(io_service_, update_mgr_->getWorkerIOService("my.example.com."));
+
+    // Start workers.
+    ASSERT_NO_THROW(update_mgr_->setThreadPoolSize(2));
+    EXPECT_EQ(2U, update_mgr_->getThreadPoolSize());
+    asiolink::IOServicePtr worker = update_mgr_->getWorkerIOService("my.example.com.");
+    ASSERT_TRUE(worker);
+    EXPECT_NE(io_service_, worker);
+    EXPECT_EQ(worker,
+              update_mgr_->getSocketPool("my.example.com.")->getIOService());
+
+    // The same number keeps the workers.
+    ASSERT_NO_THROW(update_mgr_->setThreadPoolSize(2));
+    EXPECT_EQ(worker, update_mgr_->getWorkerIOService("my.example.com."));
+
+    // A different number replaces them.
+    ASSERT_NO_THROW(update_mgr_->setThreadPoolSize(3));
+    EXPECT_EQ(3U, update_mgr_->getThreadPoolSize());
+    EXPECT_NE(worker, update_mgr_->getWorkerIOService("my.example.com."));
+
+    // Back to the single-threaded mode.
+    ASSERT_NO_THROW(update_mgr_->setThreadPoolSize(0));
+    EXPECT_EQ(0U, update_mgr_->getThreadPoolSize());
+    EXPECT_EQ(io_service_, update_mgr_->getWorkerIOService("my.example.com."));
+    EXPECT_EQ(io_service_,
+              update_mgr_->getSocketPool("my.example.com.")->getIOService());
+}
+
 }
@@ -537,6 +537,45 @@ TEST_F(SimpleAddTransactionTest, replacingFwdAddrsHandler_FwdOnlyAddOK) {
                   NameChangeTransaction::UPDATE_OK_EVT);
 }
 
+// Tests replacingFwdAddrsHandler with the following scenario:
+//
+//  The request includes a forward and reverse change in the same zone.
+//  The update request holding both changes is sent without error.
+//  A server response is received which indicates successful update.
+//
+TEST_F(SimpleAddTransactionTest, replacingFwdAddrsHandler_SameZoneAddOK) {
+    // Create a transaction whose reverse domain is the forward domain.
+    setupForIPv4Transaction(dhcp_ddns::CHG_ADD, FWD_AND_REV_CHG);
+    SimpleAddStubPtr name_add(
+        new SimpleAddStub(io_service_, ncr_, forward_domain_,
+                          forward_domain_, cfg_mgr_));
+    name_add->initDictionaries();
+    name_add->postNextEvent(SimpleAddTransaction::SERVER_SELECTED_EVT);
+    name_add->setState(SimpleAddTransaction::REPLACING_FWD_ADDRS_ST);
+
+    // Run replacingFwdAddrsHandler to construct and send the request.
+    EXPECT_NO_THROW(name_add->replacingFwdAddrsHandler());
+
+    // Verify that the request holds the forward and the reverse updates.
+    D2UpdateMessagePtr update_msg = name_add->getDnsUpdateRequest();
+    ASSERT_TRUE(update_msg);
+    EXPECT_EQ(8U, update_msg->getRRCount(D2UpdateMessage::SECTION_UPDATE));
+
+    // Simulate receiving a successful update response.
+    name_add->fakeResponse(DNSClient::SUCCESS, dns::Rcode::NOERROR());
+
+    // Run replacingFwdAddrsHandler again to process the response.
+    EXPECT_NO_THROW(name_add->replacingFwdAddrsHandler());
+
+    // Both changes are completed by the single update.
+    EXPECT_TRUE(name_add->getForwardChangeCompleted());
+    EXPECT_TRUE(name_add->getReverseChangeCompleted());
+
+    // No reverse server is selected: we should be done.
+    CHECK_CONTEXT(name_add, NameChangeTransaction::PROCESS_TRANS_OK_ST,
+                  NameChangeTransaction::UPDATE_OK_EVT);
+}
+
 // Tests replacingFwdAddrsHandler with the following scenario:
 //
 //  The request includes a forward and reverse change.
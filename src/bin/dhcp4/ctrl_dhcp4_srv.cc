@@ -1297,7 +1297,10 @@ ControlledDhcpv4Srv::commandConfigBackendPullHandler(const std::string&,
     try {
         auto srv_cfg = CfgMgr::instance().getCurrentCfg();
         auto mode = CBControlDHCPv4::FetchMode::FETCH_UPDATE;
-        server_->getCBControl()->databaseConfigFetch(srv_cfg, mode);
+        // The command applies all the updates at once.
+        do {
+            server_->getCBControl()->databaseConfigFetch(srv_cfg, mode);
+        } while (server_->getCBControl()->hasPendingUpdates());
     } catch (const std::exception& ex) {
         LOG_ERROR(dhcp4_logger, DHCP4_CB_ON_DEMAND_FETCH_UPDATES_FAIL)
             .arg(ex.what());
@@ -2015,6 +2018,22 @@ ControlledDhcpv4Srv::cbFetchUpdates(const SrvConfigPtr& srv_cfg,
         }
     }
 
+    // When only a part of the updates was applied, fetch the others as
+    // soon as the packets received in the meantime were processed instead
+    // of waiting for the timer. The fetch is dropped if the server was
+    // reconfigured in the meantime as the new configuration has its own
+    // timer.
+    if (server_->getCBControl()->hasPendingUpdates() &&
+        TimerMgr::instance()->isTimerRegistered("Dhcp4CBFetchTimer")) {
+        getIOService()->post([this, srv_cfg, failure_count]() {
+            if ((CfgMgr::instance().getCurrentCfg() == srv_cfg) &&
+                TimerMgr::instance()->isTimerRegistered("Dhcp4CBFetchTimer")) {
+                cbFetchUpdates(srv_cfg, failure_count);
+            }
+        });
+        return;
+    }
+
     // Reschedule the timer to fetch new updates or re-try if
     // the previous attempt resulted in an error.
     if (TimerMgr::instance()->isTimerRegistered("Dhcp4CBFetchTimer")) {
@@ -509,7 +509,8 @@ private:
     /// from the Config Backends.
     ///
     /// This method calls @c CBControlDHCPv4::databaseConfigFetch and then
-    /// reschedules the timer.
+    /// reschedules the timer. When the fetch applied only a part of the
+    /// updates the next fetch is posted to the IO service instead.
     ///
     /// @param srv_cfg Server configuration holding the database credentials
     /// and server tag.
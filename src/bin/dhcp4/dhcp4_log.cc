@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -14,15 +14,6 @@
 namespace isc {
 namespace dhcp {
 
-extern const int DBG_DHCP4_START = isc::log::DBGLVL_START_SHUT;
-extern const int DBG_DHCP4_SHUT = isc::log::DBGLVL_START_SHUT;
-extern const int DBG_DHCP4_COMMAND = isc::log::DBGLVL_COMMAND;
-extern const int DBG_DHCP4_BASIC = isc::log::DBGLVL_TRACE_BASIC;
-extern const int DBG_DHCP4_HOOKS = isc::log::DBGLVL_TRACE_BASIC;
-extern const int DBG_DHCP4_BASIC_DATA = isc::log::DBGLVL_TRACE_BASIC_DATA;
-extern const int DBG_DHCP4_DETAIL = isc::log::DBGLVL_TRACE_DETAIL;
-extern const int DBG_DHCP4_DETAIL_DATA = isc::log::DBGLVL_TRACE_DETAIL_DATA;
-
 const char* DHCP4_ROOT_LOGGER_NAME = "kea-dhcp4";
 const char* DHCP4_APP_LOGGER_NAME = "dhcp4";
 const char* DHCP4_BAD_PACKET_LOGGER_NAME = "bad-packets";
@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -21,19 +21,19 @@ namespace dhcp {
 //@{
 
 /// @brief Debug level used to log information during server startup.
-extern const int DBG_DHCP4_START;
+constexpr int DBG_DHCP4_START = isc::log::DBGLVL_START_SHUT;
 
 /// @brief Debug level used to log information during server shutdown.
-extern const int DBG_DHCP4_SHUT;
+constexpr int DBG_DHCP4_SHUT = isc::log::DBGLVL_START_SHUT;
 
 /// @brief Debug level used to log receiving commands.
-extern const int DBG_DHCP4_COMMAND;
+constexpr int DBG_DHCP4_COMMAND = isc::log::DBGLVL_COMMAND;
 
 /// @brief Debug level used to trace basic operations within the code.
-extern const int DBG_DHCP4_BASIC;
+constexpr int DBG_DHCP4_BASIC = isc::log::DBGLVL_TRACE_BASIC;
 
 /// @brief Debug level used to trace hook related operations
-extern const int DBG_DHCP4_HOOKS;
+constexpr int DBG_DHCP4_HOOKS = isc::log::DBGLVL_TRACE_BASIC;
 
 /// @brief Debug level used to log the traces with some basic data.
 ///
@@ -42,7 +42,7 @@ extern const int DBG_DHCP4_HOOKS;
 /// more detailed information in cases when it is warranted and the
 /// extraction of the data doesn't impact the server's performance
 /// significantly.
-extern const int DBG_DHCP4_BASIC_DATA;
+constexpr int DBG_DHCP4_BASIC_DATA = isc::log::DBGLVL_TRACE_BASIC_DATA;
 
 /// @brief Debug level used to trace detailed errors.
 ///
@@ -50,10 +50,10 @@ extern const int DBG_DHCP4_BASIC_DATA;
 /// packets.  (These are not logged at severities of WARN or higher for fear
 /// that a set of deliberately invalid packets set to the server could overwhelm
 /// the logging.)
-extern const int DBG_DHCP4_DETAIL;
+constexpr int DBG_DHCP4_DETAIL = isc::log::DBGLVL_TRACE_DETAIL;
 
 /// @brief This level is used to log the contents of packets received and sent.
-extern const int DBG_DHCP4_DETAIL_DATA;
+constexpr int DBG_DHCP4_DETAIL_DATA = isc::log::DBGLVL_TRACE_DETAIL_DATA;
 
 //@}
 
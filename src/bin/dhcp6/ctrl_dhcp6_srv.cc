@@ -1061,7 +1061,10 @@ ControlledDhcpv6Srv::commandConfigBackendPullHandler(const std::string&,
     try {
         auto srv_cfg = CfgMgr::instance().getCurrentCfg();
         auto mode = CBControlDHCPv6::FetchMode::FETCH_UPDATE;
-        server_->getCBControl()->databaseConfigFetch(srv_cfg, mode);
+        // The command applies all the updates at once.
+        do {
+            server_->getCBControl()->databaseConfigFetch(srv_cfg, mode);
+        } while (server_->getCBControl()->hasPendingUpdates());
     } catch (const std::exception& ex) {
         LOG_ERROR(dhcp6_logger, DHCP6_CB_ON_DEMAND_FETCH_UPDATES_FAIL)
             .arg(ex.what());
@@ -1802,6 +1805,22 @@ ControlledDhcpv6Srv::cbFetchUpdates(const SrvConfigPtr& srv_cfg,
         }
     }
 
+    // When only a part of the updates was applied, fetch the others as
+    // soon as the packets received in the meantime were processed instead
+    // of waiting for the timer. The fetch is dropped if the server was
+    // reconfigured in the meantime as the new configuration has its own
+    // timer.
+    if (server_->getCBControl()->hasPendingUpdates() &&
+        TimerMgr::instance()->isTimerRegistered("Dhcp6CBFetchTimer")) {
+        getIOService()->post([this, srv_cfg, failure_count]() {
+            if ((CfgMgr::instance().getCurrentCfg() == srv_cfg) &&
+                TimerMgr::instance()->isTimerRegistered("Dhcp6CBFetchTimer")) {
+                cbFetchUpdates(srv_cfg, failure_count);
+            }
+        });
+        return;
+    }
+
     // Reschedule the timer to fetch new updates or re-try if
     // the previous attempt resulted in an error.
     if (TimerMgr::instance()->isTimerRegistered("Dhcp6CBFetchTimer")) {
@@ -290,6 +290,7 @@ using namespace std;
   MAXSIZE "maxsize"
   MAXVER "maxver"
   PATTERN "pattern"
+  ASYNC_QUEUE_SIZE "async-queue-size"
 
   COMPATIBILITY "compatibility"
   LENIENT_OPTION_PARSING "lenient-option-parsing"
@@ -3393,6 +3394,7 @@ output_params: output
              | maxsize
              | maxver
              | pattern
+             | async_queue_size
              ;
 
 output: OUTPUT {
@@ -3431,6 +3433,12 @@ pattern: PATTERN {
     ctx.leave();
 };
 
+async_queue_size: ASYNC_QUEUE_SIZE COLON INTEGER {
+    ctx.unique("async-queue-size", ctx.loc2pos(@1));
+    ElementPtr size(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("async-queue-size", size);
+};
+
 compatibility: COMPATIBILITY {
     ctx.unique("compatibility", ctx.loc2pos(@1));
     ElementPtr i(new MapElement(ctx.loc2pos(@1)));
@@ -917,6 +917,20 @@ configureDhcp6Server(Dhcpv6Srv& server, isc::data::ConstElementPtr config_set,
             // Runtime code path creates the managers after calling configureDhcp6Server
             // and they need to be reset just after successful configuration parsing.
             if (!IfaceMgr::instance().isTestMode()) {
+                // Keep the allocation states and the statistics of the
+                // subnets which pools and allocators did not change when the
+                // leases are going to be read back from the same lease
+                // database.
+                SrvConfigPtr current_cfg = CfgMgr::instance().getCurrentCfg();
+                SrvConfigPtr staging_cfg = CfgMgr::instance().getStagingCfg();
+                if (current_cfg->getCfgDbAccess()->getLeaseDbAccessString() ==
+                    staging_cfg->getCfgDbAccess()->getLeaseDbAccessString()) {
+                    staging_cfg->getCfgSubnets6()->
+                        carryOverAllocationStates(*current_cfg->getCfgSubnets6());
+                    staging_cfg->getCfgSubnets6()->
+                        keepStatistics(*current_cfg->getCfgSubnets6());
+                }
+
                 // Destroy lease manager before hooks unload.
                 LeaseMgrFactory::destroy();
 
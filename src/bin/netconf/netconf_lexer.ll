@@ -454,6 +454,15 @@ ControlCharacterFill            [^"\\]|\\["\\/bfnrtu]
     }
 }
 
+\"async-queue-size\" {
+    switch(driver.ctx_) {
+    case ParserContext::OUTPUT_OPTIONS:
+        return NetconfParser::make_ASYNC_QUEUE_SIZE(driver.loc_);
+    default:
+        return NetconfParser::make_STRING("async-queue-size", driver.loc_);
+    }
+}
+
 \"debuglevel\" {
     switch(driver.ctx_) {
     case ParserContext::LOGGERS:
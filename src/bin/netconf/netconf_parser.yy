@@ -92,6 +92,7 @@ using namespace std;
   MAXSIZE "maxsize"
   MAXVER "maxver"
   PATTERN "pattern"
+  ASYNC_QUEUE_SIZE "async-queue-size"
 
   // Not real tokens, just a way to signal what the parser is expected to
   // parse. This define the starting point. It either can be full grammar
@@ -701,6 +702,7 @@ output_params: output
              | maxsize
              | maxver
              | pattern
+             | async_queue_size
              ;
 
 output: OUTPUT {
@@ -739,6 +741,12 @@ pattern: PATTERN {
     ctx.leave();
 };
 
+async_queue_size: ASYNC_QUEUE_SIZE COLON INTEGER {
+    ctx.unique("async-queue-size", ctx.loc2pos(@1));
+    ElementPtr size(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("async-queue-size", size);
+};
+
 %%
 
 void
@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2025 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -123,6 +123,12 @@ BasicScen::checkExitConditions() {
 
 int
 BasicScen::run() {
+    exchange();
+    return (report());
+}
+
+void
+BasicScen::exchange() {
     StatsMgr& stats_mgr(tc_.getStatsMgr());
 
     // Preload server with the number of packets.
@@ -213,6 +219,11 @@ BasicScen::run() {
     }
 
     tc_.stop();
+}
+
+int
+BasicScen::report() {
+    StatsMgr& stats_mgr(tc_.getStatsMgr());
 
     tc_.printStats();
 
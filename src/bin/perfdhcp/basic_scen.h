@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -45,6 +45,27 @@ public:
     /// \return execution status.
     int run() override;
 
+    /// \brief Run the packet exchanges of the test.
+    ///
+    /// This is the first part of \ref run: it sends and receives packets
+    /// until an exit condition is met. The workers of a multi-worker test
+    /// run it in parallel.
+    ///
+    /// \throw isc::Unexpected if internal Test Controller error occurred.
+    void exchange();
+
+    /// \brief Print the final report of the test.
+    ///
+    /// This is the second part of \ref run.
+    ///
+    /// \return execution status.
+    int report();
+
+    /// \brief Returns the statistics of the test.
+    StatsMgr& getStatsMgr() {
+        return (tc_.getStatsMgr());
+    }
+
 protected:
     /// \brief A rate control class for Discover and Solicit messages.
     RateControl basic_rate_control_;
@@ -9,6 +9,7 @@
 
 #include <perfdhcp/command_options.h>
 
+#include <asiolink/addr_utilities.h>
 #include <asiolink/io_error.h>
 #include <exceptions/exceptions.h>
 #include <dhcp/iface_mgr.h>
@@ -19,6 +20,7 @@
 
 #include <boost/lexical_cast.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
+#include <algorithm>
 #include <sstream>
 #include <stdio.h>
 #include <stdlib.h>
@@ -34,8 +36,41 @@ extern int optreset;
 
 using namespace std;
 using namespace isc;
+using namespace isc::asiolink;
 using namespace isc::dhcp;
 
+namespace {
+
+/// @brief Returns the share of a worker.
+///
+/// @param total value to split between the workers.
+/// @param workers number of workers.
+/// @param index index of the worker.
+/// @return share of the worker: the first workers get the remainder.
+uint32_t
+workerShare(const uint32_t total, const uint32_t workers, const uint32_t index) {
+    return (total / workers + (index < total % workers ? 1 : 0));
+}
+
+/// @brief Adds an offset to the last bytes of a template.
+///
+/// The bytes are handled as a big endian number.
+///
+/// @param bytes the template.
+/// @param len number of the last bytes to which the offset is added.
+/// @param offset the offset.
+void
+addOffset(std::vector<uint8_t>& bytes, size_t len, uint64_t offset) {
+    for (auto it = bytes.rbegin(); (it != bytes.rend()) && (len > 0) &&
+         (offset > 0); ++it, --len) {
+        uint64_t sum = *it + (offset & 0xff);
+        *it = static_cast<uint8_t>(sum & 0xff);
+        offset = (offset >> 8) + (sum >> 8);
+    }
+}
+
+}
+
 namespace isc {
 namespace perfdhcp {
 
@@ -164,6 +199,13 @@ CommandOptions::reset() {
         single_thread_mode_ = false;
     }
     scenario_ = Scenario::BASIC;
+    workers_num_ = 1;
+    lifecycle_mix_.clear();
+    lifecycle_mix_[LifecycleEvent::RENEW] = 1;
+    lifecycle_time_scale_ = 1.;
+    lifecycle_reboot_storm_ = 0;
+    stats_file_.clear();
+    stats_format_ = StatsFormat::JSON;
     for (uint8_t i = 1; i <= RELAY_OPTIONS_MAX_ENCAPSULATION ; i++) {
         OptionCollection option_collection;
         relay_opts_[i] = option_collection;
@@ -218,6 +260,12 @@ CommandOptions::parse(int argc, char** const argv, bool print_cmd_line) {
 
 const int LONG_OPT_SCENARIO = 300;
 const int LONG_OPT_RELAY_OPTION = 400;
+const int LONG_OPT_WORKERS = 500;
+const int LONG_OPT_STATS_FILE = 600;
+const int LONG_OPT_STATS_FORMAT = 700;
+const int LONG_OPT_LIFECYCLE_MIX = 800;
+const int LONG_OPT_LIFECYCLE_TIME_SCALE = 900;
+const int LONG_OPT_LIFECYCLE_REBOOT_STORM = 1000;
 
 bool
 CommandOptions::initialize(int argc, char** argv, bool print_cmd_line) {
@@ -240,6 +288,12 @@ CommandOptions::initialize(int argc, char** argv, bool print_cmd_line) {
     struct option long_options[] = {
         {"scenario", required_argument, 0, LONG_OPT_SCENARIO},
         {"or",       required_argument, 0, LONG_OPT_RELAY_OPTION},
+        {"workers",  required_argument, 0, LONG_OPT_WORKERS},
+        {"stats-file", required_argument, 0, LONG_OPT_STATS_FILE},
+        {"stats-format", required_argument, 0, LONG_OPT_STATS_FORMAT},
+        {"lifecycle-mix", required_argument, 0, LONG_OPT_LIFECYCLE_MIX},
+        {"lifecycle-time-scale", required_argument, 0, LONG_OPT_LIFECYCLE_TIME_SCALE},
+        {"lifecycle-reboot-storm", required_argument, 0, LONG_OPT_LIFECYCLE_REBOOT_STORM},
         {0,          0,                 0, 0}
     };
 
@@ -606,8 +660,10 @@ CommandOptions::initialize(int argc, char** argv, bool print_cmd_line) {
                 scenario_ = Scenario::BASIC;
             } else if (optarg_text == "avalanche") {
                 scenario_ = Scenario::AVALANCHE;
+            } else if (optarg_text == "lifecycle") {
+                scenario_ = Scenario::LIFECYCLE;
             } else {
-                isc_throw(InvalidParameter, "scenario value '" << optarg_text << "' is wrong - should be 'basic' or 'avalanche'");
+                isc_throw(InvalidParameter, "scenario value '" << optarg_text << "' is wrong - should be 'basic', 'avalanche' or 'lifecycle'");
             }
             break;
         }
@@ -677,6 +733,56 @@ CommandOptions::initialize(int argc, char** argv, bool print_cmd_line) {
             relay_opts->second.insert(make_pair(code, option));
             break;
         }
+
+        case LONG_OPT_WORKERS:
+            workers_num_ = positiveInteger("value of workers:"
+                                           " --workers<value> must be a"
+                                           " positive integer");
+            break;
+
+        case LONG_OPT_STATS_FILE:
+            stats_file_ = std::string(optarg ? optarg : "");
+            check(stats_file_.empty(),
+                  "--stats-file<path> must be a non empty path");
+            break;
+
+        case LONG_OPT_STATS_FORMAT: {
+            std::string optarg_text(optarg ? optarg : "");
+            if (optarg_text == "json") {
+                stats_format_ = StatsFormat::JSON;
+            } else if (optarg_text == "csv") {
+                stats_format_ = StatsFormat::CSV;
+            } else {
+                isc_throw(InvalidParameter, "stats format value '" << optarg_text << "' is wrong - should be 'json' or 'csv'");
+            }
+            break;
+        }
+
+        case LONG_OPT_LIFECYCLE_MIX:
+            initLifecycleMix();
+            break;
+
+        case LONG_OPT_LIFECYCLE_TIME_SCALE:
+            try {
+                lifecycle_time_scale_ =
+                    boost::lexical_cast<double>(optarg ? optarg : "");
+            } catch (const boost::bad_lexical_cast&) {
+                isc_throw(isc::InvalidParameter,
+                          "value of time scale: --lifecycle-time-scale<value>"
+                          " must be a positive number");
+            }
+            check(lifecycle_time_scale_ <= 0.,
+                  "value of time scale: --lifecycle-time-scale<value>"
+                  " must be a positive number");
+            break;
+
+        case LONG_OPT_LIFECYCLE_REBOOT_STORM:
+            lifecycle_reboot_storm_ =
+                positiveInteger("value of reboot storm time:"
+                                " --lifecycle-reboot-storm<value> must be"
+                                " a positive integer");
+            break;
+
         default:
             isc_throw(isc::InvalidParameter, "wrong command line option");
         }
@@ -731,11 +837,17 @@ CommandOptions::initialize(int argc, char** argv, bool print_cmd_line) {
             std::cout << "Scenario: basic." << std::endl;
         } else if (scenario_ == Scenario::AVALANCHE) {
             std::cout << "Scenario: avalanche." << std::endl;
+        } else if (scenario_ == Scenario::LIFECYCLE) {
+            std::cout << "Scenario: lifecycle." << std::endl;
         }
 
         if (!isSingleThreaded()) {
             std::cout << "Multi-thread mode enabled." << std::endl;
         }
+
+        if (workers_num_ > 1) {
+            std::cout << "Workers: " << workers_num_ << "." << std::endl;
+        }
     }
 
     // Handle the local '-l' address/interface
@@ -1072,6 +1184,25 @@ CommandOptions::validate() {
 	  "Option -y can't be used without -Y");
     check((getWaitForElapsedTime() != -1 && getIncreaseElapsedTime() == -1),
 	  "Option -Y can't be used without -y");
+    if (workers_num_ > 1) {
+        check(scenario_ != Scenario::BASIC,
+              "--workers<value> can be used only with the basic scenario");
+        check(localname_.empty() || is_interface_,
+              "-l<local-address> must be set to use --workers<value>, each"
+              " worker binding to the next address");
+        check((rate_ != 0) && (rate_ < workers_num_),
+              "-r<rate> must not be lower than --workers<value>");
+        check((renew_rate_ != 0) && (renew_rate_ < workers_num_),
+              "-f<renew-rate> must not be lower than --workers<value>");
+        check((release_rate_ != 0) && (release_rate_ < workers_num_),
+              "-F<release-rate> must not be lower than --workers<value>");
+        check((getClientsNum() > 1) && (getClientsNum() < workers_num_),
+              "-R<num-clients> must not be lower than --workers<value>");
+        for (auto const& num : num_request_) {
+            check(static_cast<uint32_t>(num) < workers_num_,
+                  "-n<num-request> must not be lower than --workers<value>");
+        }
+    }
     auto nthreads = std::thread::hardware_concurrency();
     if (nthreads == 1 && isSingleThreaded() == false) {
         std::cout << "WARNING: Currently system can run only 1 thread in parallel." << std::endl
@@ -1083,6 +1214,28 @@ CommandOptions::validate() {
                   << "WARNING: To switch use -g multi option." << std::endl;
     }
 
+    if (scenario_ == Scenario::LIFECYCLE) {
+        check(ipversion_ != 4,
+              "lifecycle scenario is supported for DHCPv4 only");
+        check(getClientsNum() <= 0,
+              "in case of lifecycle scenario number of clients must be"
+              " specified using -R option explicitly");
+        check(exchange_mode_ != DORA_SARR,
+              "-i can't be used with the lifecycle scenario");
+        check(!template_file_.empty(),
+              "-T<template-file> can't be used with the lifecycle scenario");
+        check((renew_rate_ != 0) || (release_rate_ != 0),
+              "-f<renew-rate> and -F<release-rate> can't be used with the"
+              " lifecycle scenario, use --lifecycle-mix instead");
+        uint64_t total_weight = 0;
+        for (auto const& weight : lifecycle_mix_) {
+            total_weight += weight.second;
+        }
+        check(total_weight == 0,
+              "--lifecycle-mix<value> must have at least one event with a"
+              " positive weight");
+    }
+
     if (scenario_ == Scenario::AVALANCHE) {
         check(getClientsNum() <= 0,
               "in case of avalanche scenario number\nof clients must be specified"
@@ -1097,6 +1250,60 @@ CommandOptions::validate() {
     }
 }
 
+CommandOptions
+CommandOptions::getWorkerOptions(const uint32_t index) const {
+    if (index >= workers_num_) {
+        isc_throw(isc::OutOfRange, "worker index " << index
+                  << " is out of range, number of workers is "
+                  << workers_num_);
+    }
+    CommandOptions options(*this);
+    if (workers_num_ == 1) {
+        return (options);
+    }
+    options.workers_num_ = 1;
+    options.rate_ = workerShare(rate_, workers_num_, index);
+    options.renew_rate_ = workerShare(renew_rate_, workers_num_, index);
+    options.release_rate_ = workerShare(release_rate_, workers_num_, index);
+    options.preload_ = workerShare(preload_, workers_num_, index);
+    for (auto& num : options.num_request_) {
+        num = workerShare(num, workers_num_, index);
+    }
+    // A null maximum number of drops would stop the worker immediately.
+    for (auto& num : options.max_drop_) {
+        num = std::max(workerShare(num, workers_num_, index), uint32_t(1));
+    }
+
+    // Clients of a worker follow the clients of the previous workers.
+    uint64_t first_client = index;
+    if (clients_num_ > 0) {
+        options.clients_num_ = workerShare(clients_num_, workers_num_, index);
+        if (clients_num_ > 1) {
+            first_client = static_cast<uint64_t>(index) *
+                (clients_num_ / workers_num_) +
+                std::min(index, clients_num_ % workers_num_);
+        }
+    }
+    // The DUID template ends with the MAC address.
+    addOffset(options.mac_template_, mac_template_.size(), first_client);
+    addOffset(options.duid_template_, mac_template_.size(), first_client);
+
+    // Each worker binds its own socket to the next local address.
+    options.localname_ =
+        offsetAddress(IOAddress(localname_), index).toText();
+
+    // Reports and wrapped command are handled by the first worker.
+    if (index > 0) {
+        options.report_delay_ = 0;
+        options.stats_file_.clear();
+        options.wrapped_.clear();
+        options.diags_.erase(std::remove(options.diags_.begin(),
+                                         options.diags_.end(), 'a'),
+                             options.diags_.end());
+    }
+    return (options);
+}
+
 void
 CommandOptions::check(bool condition, const std::string& errmsg) const {
     // The same could have been done with macro or just if statement but
@@ -1145,6 +1352,63 @@ CommandOptions::initLeaseType() {
     lease_type_.fromCommandLine(lease_type_arg);
 }
 
+std::ostream& operator<<(std::ostream& os, LifecycleEvent event) {
+    switch (event) {
+    case LifecycleEvent::RENEW:
+        return (os << "renew");
+    case LifecycleEvent::REBIND:
+        return (os << "rebind");
+    case LifecycleEvent::RELEASE:
+        return (os << "release");
+    case LifecycleEvent::DECLINE:
+        return (os << "decline");
+    case LifecycleEvent::REBOOT:
+        return (os << "reboot");
+    case LifecycleEvent::ROAM:
+        return (os << "roam");
+    default:
+        return (os << "unknown");
+    }
+}
+
+void
+CommandOptions::initLifecycleMix() {
+    static const std::map<std::string, LifecycleEvent> events = {
+        { "renew", LifecycleEvent::RENEW },
+        { "rebind", LifecycleEvent::REBIND },
+        { "release", LifecycleEvent::RELEASE },
+        { "decline", LifecycleEvent::DECLINE },
+        { "reboot", LifecycleEvent::REBOOT },
+        { "roam", LifecycleEvent::ROAM }
+    };
+    std::string mix_arg(optarg ? optarg : "");
+    lifecycle_mix_.clear();
+    std::istringstream stream(mix_arg);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        size_t equal_loc = item.find('=');
+        check(equal_loc == std::string::npos,
+              "--lifecycle-mix<value> must be a comma separated list of"
+              " event=weight pairs");
+        auto event = events.find(item.substr(0, equal_loc));
+        if (event == events.end()) {
+            isc_throw(InvalidParameter, "lifecycle event '"
+                      << item.substr(0, equal_loc) << "' is wrong - should"
+                      " be 'renew', 'rebind', 'release', 'decline', 'reboot'"
+                      " or 'roam'");
+        }
+        try {
+            int weight = boost::lexical_cast<int>(item.substr(equal_loc + 1));
+            check(weight < 0, "weight of a lifecycle event must be a non"
+                  " negative integer");
+            lifecycle_mix_[event->second] = static_cast<uint32_t>(weight);
+        } catch (const boost::bad_lexical_cast&) {
+            isc_throw(InvalidParameter, "weight of a lifecycle event must be"
+                      " a non negative integer");
+        }
+    }
+}
+
 void
 CommandOptions::printCommandLine() const {
     std::cout << "IPv" << static_cast<int>(ipversion_) << std::endl;
@@ -1252,6 +1516,30 @@ CommandOptions::printCommandLine() const {
     } else {
         std::cout << "multi-thread-mode" << std::endl;
     }
+    if (workers_num_ > 1) {
+        std::cout << "workers=" << workers_num_ << std::endl;
+    }
+    if (scenario_ == Scenario::LIFECYCLE) {
+        std::cout << "lifecycle-mix=";
+        for (auto const& weight : lifecycle_mix_) {
+            if (weight.first != lifecycle_mix_.begin()->first) {
+                std::cout << ",";
+            }
+            std::cout << weight.first << "=" << weight.second;
+        }
+        std::cout << std::endl;
+        std::cout << "lifecycle-time-scale=" << lifecycle_time_scale_ << std::endl;
+        if (lifecycle_reboot_storm_ > 0) {
+            std::cout << "lifecycle-reboot-storm=" << lifecycle_reboot_storm_
+                      << std::endl;
+        }
+    }
+    if (!stats_file_.empty()) {
+        std::cout << "stats-file=" << stats_file_ << std::endl;
+        std::cout << "stats-format="
+                  << (stats_format_ == StatsFormat::CSV ? "csv" : "json")
+                  << std::endl;
+    }
 }
 
 void
@@ -1266,8 +1554,12 @@ R"(perfdhcp [-1] [-4 | -6] [-A encapsulation-level] [-b base] [-B] [-c]
          [-o code,hexstring] [--or encapsulation-level:code,hexstring]
          [-p test-period] [-P preload] [-r rate]
          [-R num-clients] [-s seed] [-S srvid-offset] [--scenario name]
+         [--lifecycle-mix mix] [--lifecycle-time-scale factor]
+         [--lifecycle-reboot-storm time]
+         [--stats-file path] [--stats-format format]
          [-t report] [-T template-file] [-u] [-v] [-W exit-wait-time]
-         [-w script_name] [-x diagnostic-selector] [-X xid-offset] [server]
+         [-w script_name] [--workers num-workers] [-x diagnostic-selector]
+         [-X xid-offset] [server]
 
 The [server] argument is the name/address of the DHCP server to
 contact.  For DHCPv4 operation, exchanges are initiated by
@@ -1290,6 +1582,11 @@ The other scenario is an avalanche which is selected by
 messages as request in -R option then back off mechanism is used for
 each simulated client until all requests are answered. At the end
 time of whole scenario is reported.
+The lifecycle scenario, selected by --scenario lifecycle, simulates
+a population of DHCPv4 clients as requested in -R option. Each client
+gets a lease and then performs an event of --lifecycle-mix when its
+renewal time expires: renew, rebind, release, decline, reboot or roam
+to another relay. It runs until the test period or an interrupt.
 
 Options:
 -1: Take the server-ID option from the first received message.
@@ -1362,7 +1659,14 @@ Options:
 -R<range>: Specify how many different clients are used. With 1
     (the default), all requests seem to come from the same client.
 -s<seed>: Specify the seed for randomization, making it repeatable.
---scenario <name>: where name is 'basic' (default) or 'avalanche'.
+--scenario <name>: where name is 'basic' (default), 'avalanche' or
+    'lifecycle'.
+--stats-file <path>: Write machine readable statistics to <path>: a
+    record after each periodic report (-t) with the delays of the
+    period and a final record with the delays of the whole test,
+    including their histogram in JSON.
+--stats-format <format>: Format of the statistics written to the
+    --stats-file: 'json' (default, one JSON map per line) or 'csv'.
 -S<srvid-offset>: Offset of the server-ID option in the
     (second/request) template.
 -T<template-file>: The name of a file containing the template to use
@@ -1377,6 +1681,12 @@ Options:
     packets without sending any new packets. Expressed in microseconds.
 -w<wrapped>: Command to call with start/stop at the beginning/end of
     the program.
+--workers <num-workers>: Run the basic scenario with <num-workers>
+    sender/receiver workers, each one with its own socket bound to
+    the next address after the -l<local-address> which is mandatory.
+    The rates, the number of requests, the preload and the clients
+    are split between the workers and their statistics are merged
+    in the final report. Periodic reports show the first worker only.
 -x<diagnostic-selector>: Include extended diagnostics in the output.
     <diagnostic-selector> is a string of single-keywords specifying
     the operations for which verbose output is desired.  The selector
@@ -1395,6 +1705,14 @@ Options:
     messages with increased elapsed time option.
 DHCPv4 only options:
 -B: Force broadcast handling.
+--lifecycle-mix <mix>: Comma separated list of <event>=<weight> pairs
+    giving the probability of the events of the bound clients of the
+    lifecycle scenario. Events are 'renew' (default), 'rebind',
+    'release', 'decline', 'reboot' and 'roam'.
+--lifecycle-time-scale <factor>: Divide the lease timers received by
+    the clients of the lifecycle scenario by <factor> (default 1).
+--lifecycle-reboot-storm <time>: Reboot all the bound clients of the
+    lifecycle scenario <time> seconds after the start of the test.
 
 DHCPv6 only options:
 -c: Add a rapid commit option (exchanges will be SA).
@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2024 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -9,7 +9,8 @@
 
 #include <dhcp/option.h>
 
-#include <boost/noncopyable.hpp>
+#include <map>
+#include <ostream>
 #include <stdint.h>
 #include <string>
 #include <vector>
@@ -19,7 +20,31 @@ namespace perfdhcp {
 
 enum class Scenario {
     BASIC,
-    AVALANCHE
+    AVALANCHE,
+    LIFECYCLE
+};
+
+/// \brief Events of the bound clients of the lifecycle scenario.
+enum class LifecycleEvent {
+    RENEW,   ///< Renew the lease from the server which granted it.
+    REBIND,  ///< Extend the lease from any server.
+    RELEASE, ///< Release the lease and come back later.
+    DECLINE, ///< Decline the leased address and get a new lease.
+    REBOOT,  ///< Reboot and verify the lease (INIT-REBOOT).
+    ROAM     ///< Move behind another relay and verify the lease.
+};
+
+/// \brief Return name of a lifecycle event.
+///
+/// \param os output stream.
+/// \param event lifecycle event.
+/// \return output stream.
+std::ostream& operator<<(std::ostream& os, LifecycleEvent event);
+
+/// \brief Format of the machine readable statistics (--stats-file).
+enum class StatsFormat {
+    JSON,
+    CSV
 };
 
 /// \brief Command Options.
@@ -27,7 +52,9 @@ enum class Scenario {
 /// This class is responsible for parsing the command-line and storing the
 /// specified options.
 ///
-class CommandOptions : public boost::noncopyable {
+/// The class is copyable so each worker of a multi-worker test can get
+/// its own share of the options (see \ref getWorkerOptions).
+class CommandOptions {
 public:
 
     /// \brief Default Constructor.
@@ -400,6 +427,58 @@ public:
     /// \return enum Scenario.
     Scenario getScenario() const { return scenario_; }
 
+    /// \brief Returns the event mix of the lifecycle scenario.
+    ///
+    /// \return the weight of each event a bound client performs when its
+    /// lease timer expires.
+    const std::map<LifecycleEvent, uint32_t>& getLifecycleMix() const {
+        return (lifecycle_mix_);
+    }
+
+    /// \brief Returns the time scale of the lifecycle scenario.
+    ///
+    /// \return the factor the lease timers are divided by, 1 by default.
+    double getLifecycleTimeScale() const { return lifecycle_time_scale_; }
+
+    /// \brief Returns the time of the reboot storm of the lifecycle scenario.
+    ///
+    /// \return the number of seconds after the start of the test when
+    /// all the bound clients reboot, 0 when there is no storm.
+    int getLifecycleRebootStorm() const { return lifecycle_reboot_storm_; }
+
+    /// \brief Returns the path of the machine readable statistics.
+    ///
+    /// \return path of the file, empty when statistics are only printed.
+    std::string getStatsFile() const { return stats_file_; }
+
+    /// \brief Returns the format of the machine readable statistics.
+    ///
+    /// \return enum StatsFormat, JSON by default.
+    StatsFormat getStatsFormat() const { return stats_format_; }
+
+    /// \brief Returns the number of workers.
+    ///
+    /// \return number of sender/receiver workers, 1 by default.
+    uint32_t getWorkersNum() const { return workers_num_; }
+
+    /// \brief Returns the options of a worker.
+    ///
+    /// Each worker of a multi-worker test runs its own exchanges from its
+    /// own socket. The rates, the number of requests, the preload, the
+    /// maximum number of drops and the number of clients are split between
+    /// the workers, the first workers getting the remainder. The MAC address
+    /// and DUID templates of a worker are shifted past the clients of the
+    /// previous workers and the local address is the -l<local-address>
+    /// shifted by the worker index. The periodic report, the machine
+    /// readable statistics and the wrapped command are kept by the first
+    /// worker only.
+    ///
+    /// \param index index of the worker, from 0 to the number of workers
+    /// minus 1.
+    /// \throw isc::OutOfRange if the index is out of range.
+    /// \return options of the worker.
+    CommandOptions getWorkerOptions(const uint32_t index) const;
+
     /// \brief Returns server name.
     ///
     /// \return server name.
@@ -503,6 +582,14 @@ private:
     /// \throw InvalidParameter if lease type value specified is invalid.
     void initLeaseType();
 
+    /// \brief Decodes the lifecycle event mix from optarg.
+    ///
+    /// The mix is a comma separated list of event=weight pairs, the
+    /// events not listed get a 0 weight.
+    ///
+    /// \throw InvalidParameter if the mix is invalid.
+    void initLifecycleMix();
+
     /// \brief Set number of clients.
     ///
     /// Interprets the getopt() "opt" global variable as the number of clients
@@ -773,6 +860,26 @@ private:
 
     /// @brief Selected performance scenario. Default is basic.
     Scenario scenario_;
+
+    /// @brief Number of sender/receiver workers, each with its own socket.
+    uint32_t workers_num_;
+
+    /// @brief Weights of the events of the lifecycle scenario.
+    std::map<LifecycleEvent, uint32_t> lifecycle_mix_;
+
+    /// @brief Factor the lease timers of the lifecycle scenario are
+    /// divided by.
+    double lifecycle_time_scale_;
+
+    /// @brief Time of the reboot storm of the lifecycle scenario in
+    /// seconds, 0 when disabled.
+    int lifecycle_reboot_storm_;
+
+    /// @brief Path of the machine readable statistics.
+    std::string stats_file_;
+
+    /// @brief Format of the machine readable statistics.
+    StatsFormat stats_format_;
 };
 
 }  // namespace perfdhcp
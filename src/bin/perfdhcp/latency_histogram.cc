@@ -0,0 +1,153 @@
+// Copyright (C) 2026 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <perfdhcp/latency_histogram.h>
+
+#include <exceptions/exceptions.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using namespace std;
+
+namespace {
+
+/// @brief Number of buckets of each power of two range.
+const uint64_t HALF_SUB_BUCKETS = isc::perfdhcp::LatencyHistogram::SUB_BUCKETS / 2;
+
+}
+
+namespace isc {
+namespace perfdhcp {
+
+LatencyHistogram::LatencyHistogram()
+    : counts_(), count_(0), sum_(0),
+      min_(numeric_limits<uint64_t>::max()), max_(0) {
+}
+
+size_t
+LatencyHistogram::getBucketIndex(const uint64_t value) {
+    // Number of low order bits dropped to fit the value in the
+    // sub-buckets: 0 for the values recorded exactly.
+    size_t shift = 0;
+    while ((value >> shift) >= SUB_BUCKETS) {
+        ++shift;
+    }
+    return (shift * HALF_SUB_BUCKETS + (value >> shift));
+}
+
+uint64_t
+LatencyHistogram::getBucketLowest(const size_t index) {
+    if (index < SUB_BUCKETS) {
+        return (index);
+    }
+    size_t const shift = index / HALF_SUB_BUCKETS - 1;
+    return ((index % HALF_SUB_BUCKETS + HALF_SUB_BUCKETS) << shift);
+}
+
+uint64_t
+LatencyHistogram::getBucketHighest(const size_t index) {
+    if (index < SUB_BUCKETS) {
+        return (index);
+    }
+    size_t const shift = index / HALF_SUB_BUCKETS - 1;
+    return (getBucketLowest(index) + ((static_cast<uint64_t>(1) << shift) - 1));
+}
+
+void
+LatencyHistogram::record(const uint64_t usecs) {
+    size_t const index = getBucketIndex(usecs);
+    if (index >= counts_.size()) {
+        counts_.resize(index + 1, 0);
+    }
+    ++counts_[index];
+    ++count_;
+    sum_ += usecs;
+    min_ = std::min(min_, usecs);
+    max_ = std::max(max_, usecs);
+}
+
+void
+LatencyHistogram::recordSeconds(const double secs) {
+    if (secs <= 0.) {
+        record(0);
+    } else {
+        record(static_cast<uint64_t>(llround(secs * 1e6)));
+    }
+}
+
+double
+LatencyHistogram::getMean() const {
+    if (count_ == 0) {
+        return (0.);
+    }
+    return (static_cast<double>(sum_) / static_cast<double>(count_));
+}
+
+uint64_t
+LatencyHistogram::getPercentile(const double percentile) const {
+    if ((percentile < 0.) || (percentile > 100.)) {
+        isc_throw(BadValue, "percentile " << percentile
+                  << " is out of range [0, 100]");
+    }
+    if (count_ == 0) {
+        return (0);
+    }
+    // Rank of the percentile value in the ordered recorded values,
+    // from 1 to count_.
+    uint64_t rank = static_cast<uint64_t>(ceil(percentile / 100. *
+                                               static_cast<double>(count_)));
+    rank = std::max(rank, static_cast<uint64_t>(1));
+    uint64_t seen = 0;
+    for (size_t index = 0; index < counts_.size(); ++index) {
+        seen += counts_[index];
+        if (seen >= rank) {
+            return (std::min(getBucketHighest(index), max_));
+        }
+    }
+    return (max_);
+}
+
+vector<pair<uint64_t, uint64_t>>
+LatencyHistogram::getBuckets() const {
+    vector<pair<uint64_t, uint64_t>> buckets;
+    for (size_t index = 0; index < counts_.size(); ++index) {
+        if (counts_[index] > 0) {
+            buckets.push_back(make_pair(getBucketHighest(index),
+                                        counts_[index]));
+        }
+    }
+    return (buckets);
+}
+
+void
+LatencyHistogram::merge(const LatencyHistogram& other) {
+    if (other.counts_.size() > counts_.size()) {
+        counts_.resize(other.counts_.size(), 0);
+    }
+    for (size_t index = 0; index < other.counts_.size(); ++index) {
+        counts_[index] += other.counts_[index];
+    }
+    count_ += other.count_;
+    sum_ += other.sum_;
+    min_ = std::min(min_, other.min_);
+    max_ = std::max(max_, other.max_);
+}
+
+void
+LatencyHistogram::reset() {
+    counts_.clear();
+    count_ = 0;
+    sum_ = 0;
+    min_ = numeric_limits<uint64_t>::max();
+    max_ = 0;
+}
+
+}  // namespace perfdhcp
+}  // namespace isc
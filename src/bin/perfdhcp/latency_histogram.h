@@ -0,0 +1,140 @@
+// Copyright (C) 2026 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef LATENCY_HISTOGRAM_H
+#define LATENCY_HISTOGRAM_H
+
+#include <cstddef>
+#include <stdint.h>
+#include <utility>
+#include <vector>
+
+namespace isc {
+namespace perfdhcp {
+
+/// \brief Log-bucketed histogram of packet delays.
+///
+/// The histogram records delays expressed in microseconds in buckets
+/// following the HDR histogram layout: values lower than
+/// \ref SUB_BUCKETS get their own bucket and each following power of
+/// two range is split in \ref SUB_BUCKETS / 2 buckets of the same
+/// width. So the width of the bucket of a value is at most 1/64 of the
+/// value, whatever its magnitude, and the memory used by the histogram
+/// does not depend on the number of recorded values: it is bounded by
+/// a few thousands counters for the whole 64 bit range.
+///
+/// The number of values, their sum, the minimum and the maximum are
+/// tracked exactly. Percentiles are returned with the precision of the
+/// buckets.
+class LatencyHistogram {
+public:
+    /// \brief Number of bits of the sub-bucket index.
+    static const unsigned SUB_BUCKET_BITS = 7;
+
+    /// \brief Number of values recorded exactly, and twice the number
+    /// of buckets of each following power of two range.
+    static const uint64_t SUB_BUCKETS = (1 << SUB_BUCKET_BITS);
+
+    /// \brief Constructor.
+    LatencyHistogram();
+
+    /// \brief Record a delay.
+    ///
+    /// \param usecs delay in microseconds.
+    void record(const uint64_t usecs);
+
+    /// \brief Record a delay.
+    ///
+    /// \param secs delay in seconds, negative delays are recorded as 0.
+    void recordSeconds(const double secs);
+
+    /// \brief Returns the number of recorded delays.
+    uint64_t getCount() const {
+        return (count_);
+    }
+
+    /// \brief Returns the minimum recorded delay in microseconds.
+    ///
+    /// \return the minimum delay or 0 when no delay was recorded.
+    uint64_t getMin() const {
+        return (count_ ? min_ : 0);
+    }
+
+    /// \brief Returns the maximum recorded delay in microseconds.
+    uint64_t getMax() const {
+        return (max_);
+    }
+
+    /// \brief Returns the mean of the recorded delays in microseconds.
+    ///
+    /// \return the mean delay or 0 when no delay was recorded.
+    double getMean() const;
+
+    /// \brief Returns a percentile of the recorded delays.
+    ///
+    /// The value is the highest delay of the bucket holding the
+    /// percentile, capped at the maximum recorded delay.
+    ///
+    /// \param percentile percentile between 0 and 100.
+    /// \throw isc::BadValue if the percentile is out of range.
+    /// \return the percentile in microseconds or 0 when no delay was
+    /// recorded.
+    uint64_t getPercentile(const double percentile) const;
+
+    /// \brief Returns the non empty buckets.
+    ///
+    /// \return pairs of the highest delay of the bucket in microseconds
+    /// and of the number of delays recorded in the bucket, ordered by
+    /// delay.
+    std::vector<std::pair<uint64_t, uint64_t>> getBuckets() const;
+
+    /// \brief Add the delays recorded by another histogram.
+    ///
+    /// \param other the other histogram.
+    void merge(const LatencyHistogram& other);
+
+    /// \brief Forget all recorded delays.
+    void reset();
+
+    /// \brief Returns the index of the bucket of a value.
+    ///
+    /// \param value the value.
+    /// \return the index of the bucket.
+    static size_t getBucketIndex(const uint64_t value);
+
+    /// \brief Returns the lowest value of a bucket.
+    ///
+    /// \param index index of the bucket.
+    static uint64_t getBucketLowest(const size_t index);
+
+    /// \brief Returns the highest value of a bucket.
+    ///
+    /// \param index index of the bucket.
+    static uint64_t getBucketHighest(const size_t index);
+
+private:
+    /// \brief Number of delays per bucket.
+    ///
+    /// It grows up to the bucket of the maximum recorded delay.
+    std::vector<uint64_t> counts_;
+
+    /// \brief Number of recorded delays.
+    uint64_t count_;
+
+    /// \brief Sum of the recorded delays.
+    uint64_t sum_;
+
+    /// \brief Minimum recorded delay.
+    uint64_t min_;
+
+    /// \brief Maximum recorded delay.
+    uint64_t max_;
+};
+
+}  // namespace perfdhcp
+}  // namespace isc
+
+#endif // LATENCY_HISTOGRAM_H
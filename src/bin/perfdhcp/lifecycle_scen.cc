@@ -0,0 +1,504 @@
+// Copyright (C) 2026 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <perfdhcp/lifecycle_scen.h>
+
+#include <dhcp/dhcp4.h>
+
+#include <algorithm>
+#include <limits>
+
+using namespace std;
+using namespace boost::posix_time;
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::dhcp;
+
+namespace {
+
+/// @brief Lease time used when the server does not send one.
+const uint32_t DEFAULT_LEASE_TIME = 3600;
+
+/// @brief Time a client waits after declining an address (RFC 2131
+/// section 3.1.5).
+const uint32_t DECLINE_WAIT_TIME = 10;
+
+/// @brief Maximum back off after a failed attempt to get a lease.
+const unsigned MAX_BACKOFF = 64;
+
+/// @brief Returns the value of an option holding a 32 bit integer.
+///
+/// @param pkt4 the packet holding the option.
+/// @param code code of the option.
+/// @param value the value of the option.
+/// @return true if the packet holds the option.
+bool
+getOptionUint32(const Pkt4Ptr& pkt4, const uint8_t code, uint32_t& value) {
+    OptionPtr opt = pkt4->getOption(code);
+    if (!opt || (opt->getData().size() < sizeof(uint32_t))) {
+        return (false);
+    }
+    value = opt->getUint32();
+    return (true);
+}
+
+}
+
+namespace isc {
+namespace perfdhcp {
+
+LifecycleScen::Client::Client()
+    : state_(State::INIT), mac_(), relay_(0), transid_(0),
+      address_(IOAddress::IPV4_ZERO_ADDRESS()), server_id_(),
+      renew_time_(0), retries_(0), generation_(0) {
+}
+
+LifecycleScen::LifecycleScen(CommandOptions& options, BasePerfSocket& socket)
+    : AbstractScen(options, socket), socket_(socket),
+      rate_control_(options.getRate()), clients_(options.getClientsNum()),
+      relays_(), timers_(), transids_(), events_(), total_weight_(0),
+      storm_done_(false) {
+    if (options_.checkMultiSubnet()) {
+        for (auto const& relay : options_.getRelayAddrList()) {
+            relays_.push_back(IOAddress(relay));
+        }
+    }
+    if (relays_.empty()) {
+        relays_.push_back(IOAddress::IPV4_ZERO_ADDRESS());
+    }
+    for (auto const& weight : options_.getLifecycleMix()) {
+        total_weight_ += weight.second;
+    }
+
+    // Clients get consecutive MAC addresses after the template one
+    // unless they are read from a file. They are spread over the relays.
+    const CommandOptions::MacAddrsVector& macs = options_.getMacsFromFile();
+    for (size_t index = 0; index < clients_.size(); ++index) {
+        Client& client = clients_[index];
+        if (!macs.empty()) {
+            client.mac_ = macs[index % macs.size()];
+        } else {
+            client.mac_ = options_.getMacTemplate();
+            uint64_t carry = index;
+            for (auto it = client.mac_.rbegin();
+                 (carry > 0) && (it != client.mac_.rend()); ++it) {
+                carry += *it;
+                *it = static_cast<uint8_t>(carry & 0xff);
+                carry >>= 8;
+            }
+        }
+        client.relay_ = index % relays_.size();
+    }
+}
+
+uint64_t
+LifecycleScen::getEventsNum(const LifecycleEvent event) const {
+    auto it = events_.find(event);
+    return (it == events_.end() ? 0 : it->second);
+}
+
+size_t
+LifecycleScen::getClientsNum(const State state) const {
+    return (count_if(clients_.begin(), clients_.end(),
+                     [state](const Client& client) {
+                         return (client.state_ == state);
+                     }));
+}
+
+time_duration
+LifecycleScen::scale(const double seconds) const {
+    return (microseconds(static_cast<int64_t>(seconds * 1e6 /
+                                              options_.getLifecycleTimeScale())));
+}
+
+void
+LifecycleScen::schedule(const size_t index, const time_duration& delay) {
+    Client& client = clients_[index];
+    ++client.generation_;
+    Timer timer;
+    timer.time_ = microsec_clock::universal_time() + delay;
+    timer.client_ = index;
+    timer.generation_ = client.generation_;
+    timers_.push(timer);
+}
+
+Pkt4Ptr
+LifecycleScen::createMessage(const size_t index, const uint8_t msg_type,
+                             const bool keep_transid) {
+    Client& client = clients_[index];
+    if (!keep_transid || (client.transid_ == 0)) {
+        if (client.transid_ != 0) {
+            transids_.erase(client.transid_);
+        }
+        // Pick a transaction id not used by another client.
+        uint32_t transid = 0;
+        do {
+            transid = static_cast<uint32_t>(random());
+        } while ((transid == 0) || (transids_.count(transid) > 0));
+        client.transid_ = transid;
+        transids_[transid] = index;
+    }
+
+    Pkt4Ptr pkt4(new Pkt4(msg_type, client.transid_));
+    pkt4->setHWAddr(HTYPE_ETHER, client.mac_.size(), client.mac_);
+
+    // The relay agent information identifies the relay and the port of
+    // the client.
+    OptionPtr rai(new Option(Option::V4, DHO_DHCP_AGENT_OPTIONS));
+    OptionBuffer circuit_id;
+    circuit_id.push_back(static_cast<uint8_t>(client.relay_ >> 8));
+    circuit_id.push_back(static_cast<uint8_t>(client.relay_));
+    circuit_id.push_back(static_cast<uint8_t>(index >> 8));
+    circuit_id.push_back(static_cast<uint8_t>(index));
+    rai->addOption(OptionPtr(new Option(Option::V4,
+                                        RAI_OPTION_AGENT_CIRCUIT_ID,
+                                        circuit_id)));
+    pkt4->addOption(rai);
+    return (pkt4);
+}
+
+void
+LifecycleScen::sendMessage(const size_t index, const Pkt4Ptr& pkt4,
+                           const ExchangeType xchg_type, const State state) {
+    Client& client = clients_[index];
+    tc_.sendClientMessage4(pkt4, relays_[client.relay_]);
+    tc_.getStatsMgr().passSentPacket(xchg_type, pkt4);
+    client.state_ = state;
+    if (state == State::INIT) {
+        // No response is expected.
+        transids_.erase(client.transid_);
+        client.transid_ = 0;
+        return;
+    }
+    double const drop_time = options_.getDropTime()[state == State::SELECTING ? 0 : 1];
+    schedule(index, microseconds(static_cast<int64_t>(drop_time * 1e6)));
+}
+
+void
+LifecycleScen::bind(const size_t index, const Pkt4Ptr& ack) {
+    Client& client = clients_[index];
+    transids_.erase(client.transid_);
+    client.transid_ = 0;
+    client.state_ = State::BOUND;
+    client.address_ = ack->getYiaddr();
+    OptionPtr server_id = ack->getOption(DHO_DHCP_SERVER_IDENTIFIER);
+    if (server_id) {
+        client.server_id_ = server_id;
+    }
+    client.retries_ = 0;
+    uint32_t lease_time = DEFAULT_LEASE_TIME;
+    getOptionUint32(ack, DHO_DHCP_LEASE_TIME, lease_time);
+    uint32_t renew_time = lease_time / 2;
+    getOptionUint32(ack, DHO_DHCP_RENEWAL_TIME, renew_time);
+    client.renew_time_ = renew_time;
+    schedule(index, scale(renew_time));
+}
+
+void
+LifecycleScen::restart(const size_t index, const time_duration& delay) {
+    Client& client = clients_[index];
+    if (client.transid_ != 0) {
+        transids_.erase(client.transid_);
+        client.transid_ = 0;
+    }
+    client.state_ = State::INIT;
+    client.address_ = IOAddress::IPV4_ZERO_ADDRESS();
+    client.server_id_.reset();
+    schedule(index, delay);
+}
+
+LifecycleEvent
+LifecycleScen::pickEvent() {
+    uint64_t pick = static_cast<uint64_t>(random()) % total_weight_;
+    for (auto const& weight : options_.getLifecycleMix()) {
+        if (pick < weight.second) {
+            return (weight.first);
+        }
+        pick -= weight.second;
+    }
+    return (LifecycleEvent::RENEW);
+}
+
+void
+LifecycleScen::performEvent(const size_t index, const LifecycleEvent event) {
+    Client& client = clients_[index];
+    ++events_[event];
+    switch (event) {
+    case LifecycleEvent::RENEW:
+    case LifecycleEvent::REBIND: {
+        // The lease is extended with a REQUEST from the leased address,
+        // sent to the server which granted it when renewing.
+        Pkt4Ptr pkt4 = createMessage(index, DHCPREQUEST);
+        pkt4->setCiaddr(client.address_);
+        sendMessage(index, pkt4, ExchangeType::RNA,
+                    event == LifecycleEvent::RENEW ? State::RENEWING :
+                                                     State::REBINDING);
+        break;
+    }
+    case LifecycleEvent::RELEASE: {
+        Pkt4Ptr pkt4 = createMessage(index, DHCPRELEASE);
+        pkt4->setCiaddr(client.address_);
+        if (client.server_id_) {
+            pkt4->addOption(client.server_id_);
+        }
+        sendMessage(index, pkt4, ExchangeType::RLA, State::INIT);
+        // The client comes back after an offline period.
+        restart(index, scale(client.renew_time_));
+        break;
+    }
+    case LifecycleEvent::DECLINE: {
+        Pkt4Ptr pkt4 = createMessage(index, DHCPDECLINE);
+        pkt4->addOption(OptionPtr(new Option(Option::V4,
+                                             DHO_DHCP_REQUESTED_ADDRESS,
+                                             client.address_.toBytes())));
+        if (client.server_id_) {
+            pkt4->addOption(client.server_id_);
+        }
+        tc_.sendClientMessage4(pkt4, relays_[client.relay_]);
+        restart(index, scale(DECLINE_WAIT_TIME));
+        break;
+    }
+    case LifecycleEvent::ROAM:
+    case LifecycleEvent::REBOOT: {
+        // A roaming client moves to another relay then verifies its
+        // lease like after a reboot: the server NAKs it if the address
+        // does not fit the new link.
+        if ((event == LifecycleEvent::ROAM) && (relays_.size() > 1)) {
+            client.relay_ = (client.relay_ + 1 +
+                             random() % (relays_.size() - 1)) % relays_.size();
+        }
+        Pkt4Ptr pkt4 = createMessage(index, DHCPREQUEST);
+        pkt4->addOption(OptionPtr(new Option(Option::V4,
+                                             DHO_DHCP_REQUESTED_ADDRESS,
+                                             client.address_.toBytes())));
+        sendMessage(index, pkt4, ExchangeType::RA, State::REBOOTING);
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+void
+LifecycleScen::processTimer(const size_t index) {
+    Client& client = clients_[index];
+    switch (client.state_) {
+    case State::INIT: {
+        Pkt4Ptr pkt4 = createMessage(index, DHCPDISCOVER);
+        pkt4->addOption(Option::factory(Option::V4,
+                                        DHO_DHCP_PARAMETER_REQUEST_LIST));
+        sendMessage(index, pkt4, ExchangeType::DO, State::SELECTING);
+        break;
+    }
+    case State::BOUND:
+        performEvent(index, pickEvent());
+        break;
+    case State::RENEWING:
+        // The server which granted the lease does not answer: try any
+        // server.
+        performEvent(index, LifecycleEvent::REBIND);
+        break;
+    default: {
+        // No answer to the DISCOVER, to the REQUEST or to the rebinding
+        // REQUEST: start again later.
+        unsigned backoff = MAX_BACKOFF;
+        if (client.retries_ < 6) {
+            backoff = std::min(MAX_BACKOFF, 1U << client.retries_);
+        }
+        ++client.retries_;
+        restart(index, seconds(backoff));
+        break;
+    }
+    }
+}
+
+void
+LifecycleScen::processPacket(const Pkt4Ptr& pkt4) {
+    auto it = transids_.find(pkt4->getTransid());
+    if (it == transids_.end()) {
+        // Late response to an abandoned exchange.
+        return;
+    }
+    size_t const index = it->second;
+    Client& client = clients_[index];
+    StatsMgr& stats_mgr(tc_.getStatsMgr());
+    uint8_t const type = pkt4->getType();
+    switch (client.state_) {
+    case State::SELECTING:
+        if (type == DHCPOFFER) {
+            stats_mgr.passRcvdPacket(ExchangeType::DO, pkt4);
+            // The REQUEST keeps the transaction id of the DISCOVER.
+            Pkt4Ptr request = createMessage(index, DHCPREQUEST, true);
+            client.address_ = pkt4->getYiaddr();
+            client.server_id_ = pkt4->getOption(DHO_DHCP_SERVER_IDENTIFIER);
+            request->addOption(OptionPtr(new Option(Option::V4,
+                                                    DHO_DHCP_REQUESTED_ADDRESS,
+                                                    client.address_.toBytes())));
+            if (client.server_id_) {
+                request->addOption(client.server_id_);
+            }
+            sendMessage(index, request, ExchangeType::RA, State::REQUESTING);
+        }
+        break;
+    case State::REQUESTING:
+    case State::REBOOTING:
+        if ((type == DHCPACK) || (type == DHCPNAK)) {
+            stats_mgr.passRcvdPacket(ExchangeType::RA, pkt4);
+            if (type == DHCPACK) {
+                bind(index, pkt4);
+            } else {
+                restart(index, seconds(0));
+            }
+        }
+        break;
+    case State::RENEWING:
+    case State::REBINDING:
+        if ((type == DHCPACK) || (type == DHCPNAK)) {
+            stats_mgr.passRcvdPacket(ExchangeType::RNA, pkt4);
+            if (type == DHCPACK) {
+                bind(index, pkt4);
+            } else {
+                restart(index, seconds(0));
+            }
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+void
+LifecycleScen::rebootStorm() {
+    for (size_t index = 0; index < clients_.size(); ++index) {
+        if (clients_[index].state_ == State::BOUND) {
+            performEvent(index, LifecycleEvent::REBOOT);
+        }
+    }
+}
+
+bool
+LifecycleScen::checkExitConditions() {
+    if (tc_.interrupted()) {
+        return (true);
+    }
+    if (options_.getPeriod() != 0) {
+        time_period period(tc_.getStatsMgr().getTestPeriod());
+        if (period.length().total_seconds() >= options_.getPeriod()) {
+            if (options_.testDiags('e')) {
+                std::cout << "reached test-period." << std::endl;
+            }
+            return (true);
+        }
+    }
+    return (false);
+}
+
+void
+LifecycleScen::printLifecycleStats() const {
+    std::cout << "***Lifecycle events***" << std::endl;
+    for (auto const& weight : options_.getLifecycleMix()) {
+        std::cout << weight.first << ": " << getEventsNum(weight.first)
+                  << std::endl;
+    }
+    std::cout << "***Clients***" << std::endl
+              << "init: " << getClientsNum(State::INIT) << std::endl
+              << "selecting: " << getClientsNum(State::SELECTING) << std::endl
+              << "requesting: " << getClientsNum(State::REQUESTING) << std::endl
+              << "rebooting: " << getClientsNum(State::REBOOTING) << std::endl
+              << "bound: " << getClientsNum(State::BOUND) << std::endl
+              << "renewing: " << getClientsNum(State::RENEWING) << std::endl
+              << "rebinding: " << getClientsNum(State::REBINDING) << std::endl;
+}
+
+int
+LifecycleScen::run() {
+    // All clients start from the INIT state. Then in a loop the received
+    // packets are dispatched to their clients, which answer the OFFERs
+    // and bind the leases, and the expired timers of the clients are
+    // processed at the rate: clients in the INIT state send a DISCOVER,
+    // bound clients perform an event of the mix and clients waiting for
+    // a response abandon the exchange.
+    StatsMgr& stats_mgr(tc_.getStatsMgr());
+
+    tc_.setPacketHandler4([this](const Pkt4Ptr& pkt4) {
+        processPacket(pkt4);
+    });
+
+    for (size_t index = 0; index < clients_.size(); ++index) {
+        schedule(index, seconds(0));
+    }
+
+    tc_.start();
+
+    for (;;) {
+        // Pull some packets from receiver thread and pass them to
+        // their clients.
+        auto pkt_count = tc_.consumeReceivedPackets();
+
+        if (checkExitConditions()) {
+            break;
+        }
+
+        if (!storm_done_ && (options_.getLifecycleRebootStorm() > 0) &&
+            (stats_mgr.getTestPeriod().length().total_seconds() >=
+             options_.getLifecycleRebootStorm())) {
+            storm_done_ = true;
+            rebootStorm();
+        }
+
+        // Process the expired timers within the rate.
+        uint64_t packets_due = std::numeric_limits<uint64_t>::max();
+        if (options_.getRate() != 0) {
+            packets_due = rate_control_.getOutboundMessageCount();
+        }
+        auto now = microsec_clock::universal_time();
+        uint64_t timers_count = 0;
+        while (!timers_.empty() && (timers_count < packets_due) &&
+               (timers_.top().time_ <= now)) {
+            Timer const timer = timers_.top();
+            timers_.pop();
+            if (timer.generation_ != clients_[timer.client_].generation_) {
+                // The client moved on since the timer was set.
+                continue;
+            }
+            processTimer(timer.client_);
+            ++timers_count;
+        }
+        socket_.flush();
+
+        if (options_.getReportDelay() > 0) {
+            tc_.printIntermediateStats();
+        }
+
+        if ((timers_count == 0) && (pkt_count == 0)) {
+            usleep(100);
+        }
+    }
+
+    tc_.stop();
+
+    tc_.setPacketHandler4(TestControl::PacketHandler4());
+
+    tc_.printStats();
+    printLifecycleStats();
+
+    // Print server id.
+    if (options_.testDiags('s') && tc_.serverIdReceived()) {
+        std::cout << "Server id: " << tc_.getServerId() << std::endl;
+    }
+
+    // Print any received leases.
+    if (options_.testDiags('l')) {
+        stats_mgr.printLeases();
+    }
+
+    return (0);
+}
+
+}  // namespace perfdhcp
+}  // namespace isc
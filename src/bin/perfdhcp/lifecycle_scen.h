@@ -0,0 +1,246 @@
+// Copyright (C) 2026 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef LIFECYCLE_SCEN_H
+#define LIFECYCLE_SCEN_H
+
+#include <config.h>
+
+#include <perfdhcp/abstract_scen.h>
+#include <perfdhcp/rate_control.h>
+
+#include <asiolink/io_address.h>
+#include <dhcp/option.h>
+#include <dhcp/pkt4.h>
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#include <functional>
+#include <map>
+#include <queue>
+#include <unordered_map>
+#include <vector>
+
+namespace isc {
+namespace perfdhcp {
+
+/// \brief Lifecycle Scenario class.
+///
+/// This class is used to run the performance test where a population of
+/// DHCPv4 clients (-R) is simulated. Each client runs its own lease state
+/// machine (RFC 2131 section 4.4): it gets a lease with a 4-way exchange
+/// and when the renewal time (T1) of the lease divided by the time scale
+/// expires it performs an event picked from the event mix: it renews or
+/// rebinds the lease, releases it and comes back later, declines the
+/// address, reboots or roams to another relay and verifies the lease
+/// with an INIT-REBOOT request. The clients are distributed between the
+/// relay addresses (-J) and send an option 82 with a circuit-id of their
+/// own. A reboot storm reboots all the bound clients at once.
+///
+/// The new exchanges and the events are sent at the rate (-r) when it is
+/// set. Requests without response are abandoned after the drop time (-d):
+/// a renewing client rebinds and the other clients restart from the INIT
+/// state with an exponential back off.
+class LifecycleScen : public AbstractScen {
+public:
+    /// \brief States of a simulated client.
+    enum class State {
+        INIT,       ///< Waiting to send a DISCOVER.
+        SELECTING,  ///< DISCOVER sent, waiting for an OFFER.
+        REQUESTING, ///< REQUEST sent, waiting for an ACK.
+        REBOOTING,  ///< INIT-REBOOT REQUEST sent, waiting for an ACK.
+        BOUND,      ///< Lease bound, waiting for the next event.
+        RENEWING,   ///< Renewing REQUEST sent, waiting for an ACK.
+        REBINDING   ///< Rebinding REQUEST sent, waiting for an ACK.
+    };
+
+    /// \brief Simulated client.
+    struct Client {
+        /// \brief Constructor.
+        Client();
+
+        /// \brief State of the client.
+        State state_;
+
+        /// \brief Hardware address of the client.
+        std::vector<uint8_t> mac_;
+
+        /// \brief Index of the relay the client is behind.
+        size_t relay_;
+
+        /// \brief Transaction id of the current exchange, 0 when none.
+        uint32_t transid_;
+
+        /// \brief Offered or leased address.
+        asiolink::IOAddress address_;
+
+        /// \brief Server identifier of the offer or of the lease.
+        dhcp::OptionPtr server_id_;
+
+        /// \brief Renewal time (T1) of the lease in seconds.
+        uint32_t renew_time_;
+
+        /// \brief Number of failed attempts to get a lease.
+        unsigned retries_;
+
+        /// \brief Version of the client timer: timers of a previous
+        /// version are ignored.
+        uint64_t generation_;
+    };
+
+    /// \brief Default and the only constructor of LifecycleScen.
+    ///
+    /// \param options reference to command options,
+    /// \param socket reference to a socket.
+    LifecycleScen(CommandOptions& options, BasePerfSocket& socket);
+
+    /// \brief Run performance test.
+    ///
+    /// Method runs whole performance test.
+    ///
+    /// \return execution status.
+    int run() override;
+
+    /// \brief Returns the number of events performed by the clients.
+    ///
+    /// \param event the event.
+    uint64_t getEventsNum(const LifecycleEvent event) const;
+
+    /// \brief Returns the number of clients in a state.
+    ///
+    /// \param state the state.
+    size_t getClientsNum(const State state) const;
+
+protected:
+    /// \brief Timer of a client.
+    struct Timer {
+        /// \brief Expiration time.
+        boost::posix_time::ptime time_;
+
+        /// \brief Index of the client.
+        size_t client_;
+
+        /// \brief Version of the client timer.
+        uint64_t generation_;
+
+        /// \brief Order timers by expiration time.
+        bool operator>(const Timer& other) const {
+            return (time_ > other.time_);
+        }
+    };
+
+    /// \brief Process a packet received from the server.
+    ///
+    /// \param pkt4 the packet.
+    void processPacket(const dhcp::Pkt4Ptr& pkt4);
+
+    /// \brief Process the expired timer of a client.
+    ///
+    /// \param index index of the client.
+    void processTimer(const size_t index);
+
+    /// \brief Reboot all the bound clients.
+    void rebootStorm();
+
+    /// \brief Pick an event from the event mix.
+    LifecycleEvent pickEvent();
+
+    /// \brief Perform an event of a bound client.
+    ///
+    /// \param index index of the client.
+    /// \param event the event.
+    void performEvent(const size_t index, const LifecycleEvent event);
+
+    /// \brief Create a message of a client.
+    ///
+    /// The message gets a new transaction id, the hardware address of
+    /// the client and its relay agent information option.
+    ///
+    /// \param index index of the client.
+    /// \param msg_type type of the message.
+    /// \param keep_transid keep the transaction id of the current
+    /// exchange instead of starting a new one.
+    /// \return the message.
+    dhcp::Pkt4Ptr createMessage(const size_t index, const uint8_t msg_type,
+                                const bool keep_transid = false);
+
+    /// \brief Send a message of a client and set its state.
+    ///
+    /// \param index index of the client.
+    /// \param pkt4 the message.
+    /// \param xchg_type exchange type the message is counted in.
+    /// \param state new state of the client.
+    void sendMessage(const size_t index, const dhcp::Pkt4Ptr& pkt4,
+                     const ExchangeType xchg_type, const State state);
+
+    /// \brief Bind a lease of a client.
+    ///
+    /// \param index index of the client.
+    /// \param ack the DHCPACK of the lease.
+    void bind(const size_t index, const dhcp::Pkt4Ptr& ack);
+
+    /// \brief Move a client to the INIT state.
+    ///
+    /// \param index index of the client.
+    /// \param delay delay before the client sends a new DISCOVER.
+    void restart(const size_t index,
+                 const boost::posix_time::time_duration& delay);
+
+    /// \brief Set the timer of a client.
+    ///
+    /// \param index index of the client.
+    /// \param delay delay of the timer.
+    void schedule(const size_t index,
+                  const boost::posix_time::time_duration& delay);
+
+    /// \brief Scale a lease timer.
+    ///
+    /// \param seconds the lease timer in seconds.
+    /// \return the lease timer divided by the time scale.
+    boost::posix_time::time_duration scale(const double seconds) const;
+
+    /// \brief Check if test exit conditions fulfilled.
+    ///
+    /// \return true if the test period passed or the test was
+    /// interrupted.
+    bool checkExitConditions();
+
+    /// \brief Print the number of events and of clients in each state.
+    void printLifecycleStats() const;
+
+    /// \brief A reference to socket.
+    BasePerfSocket& socket_;
+
+    /// \brief A rate control class for new exchanges and events.
+    RateControl rate_control_;
+
+    /// \brief Simulated clients.
+    std::vector<Client> clients_;
+
+    /// \brief Relay addresses, a zero address for the default one.
+    std::vector<asiolink::IOAddress> relays_;
+
+    /// \brief Timers of the clients ordered by expiration time.
+    std::priority_queue<Timer, std::vector<Timer>, std::greater<Timer>> timers_;
+
+    /// \brief Map of the transaction ids of the pending exchanges to
+    /// the indexes of the clients.
+    std::unordered_map<uint32_t, size_t> transids_;
+
+    /// \brief Number of events performed by the clients.
+    std::map<LifecycleEvent, uint64_t> events_;
+
+    /// \brief Sum of the weights of the event mix.
+    uint64_t total_weight_;
+
+    /// \brief Reboot storm already happened flag.
+    bool storm_done_;
+};
+
+}
+}
+
+#endif // LIFECYCLE_SCEN_H
@@ -11,6 +11,8 @@
 #include <perfdhcp/avalanche_scen.h>
 #include <perfdhcp/basic_scen.h>
 #include <perfdhcp/command_options.h>
+#include <perfdhcp/lifecycle_scen.h>
+#include <perfdhcp/parallel_scen.h>
 #include <util/filesystem.h>
 
 #include <iostream>
@@ -41,6 +43,12 @@ main(int argc, char* argv[]) {
         isc::log::initLogger("perfdhcp");
         parser_error = false;
         auto scenario = command_options.getScenario();
+        if (command_options.getWorkersNum() > 1) {
+            // Each worker opens its own socket.
+            ParallelScen scen(command_options);
+            ret_code = scen.run();
+            return (ret_code);
+        }
         PerfSocket socket(command_options);
         if (scenario == Scenario::BASIC) {
             BasicScen scen(command_options, socket);
@@ -48,6 +56,9 @@ main(int argc, char* argv[]) {
         } else if (scenario == Scenario::AVALANCHE) {
             AvalancheScen scen(command_options, socket);
             ret_code = scen.run();
+        } else if (scenario == Scenario::LIFECYCLE) {
+            LifecycleScen scen(command_options, socket);
+            ret_code = scen.run();
         }
     } catch (const std::exception& e) {
         ret_code = 1;
@@ -0,0 +1,67 @@
+// Copyright (C) 2026 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <perfdhcp/parallel_scen.h>
+
+#include <exception>
+#include <thread>
+
+using namespace std;
+
+namespace isc {
+namespace perfdhcp {
+
+ParallelScen::Worker::Worker(const CommandOptions& options)
+    : options_(options), socket_(options_), scen_(options_, socket_) {
+}
+
+ParallelScen::ParallelScen(CommandOptions& options)
+    : options_(options), workers_() {
+    for (uint32_t i = 0; i < options_.getWorkersNum(); ++i) {
+        CommandOptions const worker_options(options_.getWorkerOptions(i));
+        workers_.push_back(unique_ptr<Worker>(new Worker(worker_options)));
+    }
+}
+
+int
+ParallelScen::run() {
+    vector<exception_ptr> errors(workers_.size());
+    vector<thread> threads;
+    for (size_t i = 0; i < workers_.size(); ++i) {
+        threads.push_back(thread([this, i, &errors]() {
+            try {
+                workers_[i]->scen_.exchange();
+            } catch (...) {
+                errors[i] = current_exception();
+                // Stop the other workers.
+                TestControl::interrupt();
+            }
+        }));
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (auto const& error : errors) {
+        if (error) {
+            rethrow_exception(error);
+        }
+    }
+
+    Worker& first = *workers_[0];
+    for (size_t i = 1; i < workers_.size(); ++i) {
+        first.scen_.getStatsMgr().merge(workers_[i]->scen_.getStatsMgr());
+    }
+
+    // The test controller of the first worker refers to its options: make
+    // the report use the options of the whole test, e.g. the expected rate.
+    first.options_ = options_;
+    return (first.scen_.report());
+}
+
+}
+}
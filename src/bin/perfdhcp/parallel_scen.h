@@ -0,0 +1,86 @@
+// Copyright (C) 2026 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef PARALLEL_SCEN_H
+#define PARALLEL_SCEN_H
+
+#include <config.h>
+
+#include <perfdhcp/basic_scen.h>
+#include <perfdhcp/command_options.h>
+#include <perfdhcp/perf_socket.h>
+
+#include <boost/noncopyable.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace isc {
+namespace perfdhcp {
+
+/// \brief Parallel Scenario class.
+///
+/// This class runs the basic scenario with several sender/receiver
+/// workers (--workers option). Each worker has its own share of the
+/// options (see \ref CommandOptions::getWorkerOptions), its own socket
+/// bound to its own local address and sending and receiving packets in
+/// batches (see \ref BatchPerfSocket), and its own test controller. The
+/// workers run the packet exchanges in their own threads. When they are
+/// all done their statistics are merged into the statistics of the first
+/// worker which prints the final report.
+///
+/// Periodic reports (-t) are printed by the first worker only and show
+/// its own share of the traffic.
+class ParallelScen : public boost::noncopyable {
+public:
+    /// \brief Constructor.
+    ///
+    /// It opens the sockets of all workers.
+    ///
+    /// \param options reference to command options.
+    /// \throw isc::BadValue if a socket can't be opened.
+    explicit ParallelScen(CommandOptions& options);
+
+    /// \brief Run performance test.
+    ///
+    /// \throw isc::Unexpected if internal Test Controller error occurred.
+    /// \return execution status.
+    int run();
+
+    /// \brief Returns the number of workers.
+    size_t getWorkersNum() const {
+        return (workers_.size());
+    }
+
+private:
+    /// \brief A worker.
+    struct Worker {
+        /// \brief Constructor.
+        ///
+        /// \param options options of the worker.
+        explicit Worker(const CommandOptions& options);
+
+        /// \brief Options of the worker.
+        CommandOptions options_;
+
+        /// \brief Socket of the worker.
+        BatchPerfSocket socket_;
+
+        /// \brief Scenario run by the worker.
+        BasicScen scen_;
+    };
+
+    /// \brief Command options of the whole test.
+    CommandOptions& options_;
+
+    /// \brief The workers.
+    std::vector<std::unique_ptr<Worker>> workers_;
+};
+
+}
+}
+
+#endif // PARALLEL_SCEN_H
@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2024 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -14,6 +14,12 @@
 #include <dhcp/iface_mgr.h>
 #include <asiolink/io_address.h>
 
+#include <cerrno>
+#include <cstring>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+
 using namespace isc::dhcp;
 using namespace isc::asiolink;
 
@@ -139,6 +145,8 @@ PerfSocket::initSocketData() {
             if (s.sockfd_ == sockfd_) {
                 ifindex_ = iface->getIndex();
                 addr_ = s.addr_;
+                port_ = s.port_;
+                family_ = s.family_;
                 return;
             }
         }
@@ -191,5 +199,292 @@ PerfSocket::getIface() {
     return (IfaceMgr::instance().getIface(ifindex_));
 }
 
+struct BatchBuffers {
+    /// \brief Constructor.
+    ///
+    /// \param batch_size number of messages.
+    /// \param data_size size of the data of a received message, 0 when
+    /// sending.
+    BatchBuffers(const size_t batch_size, const size_t data_size)
+        : names_(batch_size), iovecs_(batch_size), msgs_(batch_size),
+          lengths_(batch_size), data_(batch_size * data_size) {
+    }
+
+    /// \brief Returns the header of a message.
+    ///
+    /// \param index index of the message.
+    struct msghdr& getHeader(const size_t index) {
+#ifdef HAVE_SENDMMSG
+        return (msgs_[index].msg_hdr);
+#else
+        return (msgs_[index]);
+#endif
+    }
+
+    /// \brief Returns the length of a received message.
+    ///
+    /// \param index index of the message.
+    size_t getLength(const size_t index) const {
+#ifdef HAVE_SENDMMSG
+        return (msgs_[index].msg_len);
+#else
+        return (lengths_[index]);
+#endif
+    }
+
+    /// \brief Addresses of the messages.
+    std::vector<struct sockaddr_storage> names_;
+
+    /// \brief Data of the messages.
+    std::vector<struct iovec> iovecs_;
+
+    /// \brief Headers of the messages.
+#ifdef HAVE_SENDMMSG
+    std::vector<struct mmsghdr> msgs_;
+#else
+    std::vector<struct msghdr> msgs_;
+#endif
+
+    /// \brief Lengths of the received messages when recvmmsg() is not
+    /// available.
+    std::vector<size_t> lengths_;
+
+    /// \brief Storage of the received messages.
+    std::vector<uint8_t> data_;
+};
+
+BatchPerfSocket::BatchPerfSocket(CommandOptions& options,
+                                 const size_t batch_size)
+    : PerfSocket(options), batch_size_(batch_size), iface_(),
+      send_queue_(), send_buffers_(), received_(), recv_buffers_() {
+    if (batch_size_ == 0) {
+        isc_throw(BadValue, "batch size must be greater than 0");
+    }
+    iface_ = IfaceMgr::instance().getIface(ifindex_);
+    send_queue_.reserve(batch_size_);
+    send_buffers_.reset(new BatchBuffers(batch_size_, 0));
+    recv_buffers_.reset(new BatchBuffers(batch_size_, IfaceMgr::RCVBUFSIZE));
+}
+
+BatchPerfSocket::~BatchPerfSocket() {
+}
+
+Pkt4Ptr
+BatchPerfSocket::receive4(uint32_t timeout_sec, uint32_t timeout_usec) {
+    if (received_.empty()) {
+        receiveBatch(timeout_sec, timeout_usec);
+        if (received_.empty()) {
+            return (Pkt4Ptr());
+        }
+    }
+    Pkt4Ptr pkt = boost::dynamic_pointer_cast<Pkt4>(received_.front());
+    received_.pop_front();
+    return (pkt);
+}
+
+Pkt6Ptr
+BatchPerfSocket::receive6(uint32_t timeout_sec, uint32_t timeout_usec) {
+    if (received_.empty()) {
+        receiveBatch(timeout_sec, timeout_usec);
+        if (received_.empty()) {
+            return (Pkt6Ptr());
+        }
+    }
+    Pkt6Ptr pkt = boost::dynamic_pointer_cast<Pkt6>(received_.front());
+    received_.pop_front();
+    return (pkt);
+}
+
+bool
+BatchPerfSocket::send(const Pkt4Ptr& pkt) {
+    queue(pkt);
+    return (true);
+}
+
+bool
+BatchPerfSocket::send(const Pkt6Ptr& pkt) {
+    queue(pkt);
+    return (true);
+}
+
+IfacePtr
+BatchPerfSocket::getIface() {
+    return (iface_);
+}
+
+void
+BatchPerfSocket::queue(const PktPtr& pkt) {
+    send_queue_.push_back(pkt);
+    if (send_queue_.size() >= batch_size_) {
+        flush();
+    }
+}
+
+void
+BatchPerfSocket::flush() {
+    const size_t count = send_queue_.size();
+    if (count == 0) {
+        return;
+    }
+    BatchBuffers& buffers = *send_buffers_;
+    for (size_t i = 0; i < count; ++i) {
+        const PktPtr& pkt = send_queue_[i];
+        const IOAddress& remote = pkt->getRemoteAddr();
+        struct sockaddr_storage& name = buffers.names_[i];
+        memset(&name, 0, sizeof(name));
+        socklen_t name_len = 0;
+        if (remote.isV4()) {
+            struct sockaddr_in* to = reinterpret_cast<struct sockaddr_in*>(&name);
+            to->sin_family = AF_INET;
+            to->sin_port = htons(pkt->getRemotePort());
+            to->sin_addr.s_addr = htonl(remote.toUint32());
+            name_len = sizeof(*to);
+        } else {
+            struct sockaddr_in6* to = reinterpret_cast<struct sockaddr_in6*>(&name);
+            to->sin6_family = AF_INET6;
+            to->sin6_port = htons(pkt->getRemotePort());
+            const std::vector<uint8_t> bytes = remote.toBytes();
+            memcpy(&to->sin6_addr, &bytes[0], bytes.size());
+            // Link scoped destinations need the interface of the socket.
+            if (remote.isV6Multicast() || remote.isV6LinkLocal()) {
+                to->sin6_scope_id = ifindex_;
+            }
+            name_len = sizeof(*to);
+        }
+
+        util::OutputBuffer& buffer = pkt->getBuffer();
+        buffers.iovecs_[i].iov_base =
+            const_cast<uint8_t*>(buffer.getData());
+        buffers.iovecs_[i].iov_len = buffer.getLength();
+
+        struct msghdr& hdr = buffers.getHeader(i);
+        memset(&hdr, 0, sizeof(hdr));
+        hdr.msg_name = &name;
+        hdr.msg_namelen = name_len;
+        hdr.msg_iov = &buffers.iovecs_[i];
+        hdr.msg_iovlen = 1;
+
+        // Timestamp the packet when it is actually sent.
+        pkt->updateTimestamp();
+    }
+
+    size_t sent = 0;
+    while (sent < count) {
+#ifdef HAVE_SENDMMSG
+        int result = sendmmsg(sockfd_, &buffers.msgs_[sent], count - sent, 0);
+#else
+        int result = sendmsg(sockfd_, &buffers.getHeader(sent), 0);
+        if (result >= 0) {
+            result = 1;
+        }
+#endif
+        if (result < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            int const error = errno;
+            send_queue_.clear();
+            isc_throw(SocketWriteError, "failed to send " << (count - sent)
+                      << " packets: " << strerror(error));
+        }
+        sent += result;
+    }
+    send_queue_.clear();
+}
+
+void
+BatchPerfSocket::receiveBatch(uint32_t timeout_sec, uint32_t timeout_usec) {
+    if ((timeout_sec > 0) || (timeout_usec > 0)) {
+        struct pollfd fds;
+        fds.fd = sockfd_;
+        fds.events = POLLIN;
+        fds.revents = 0;
+        int const timeout_ms = timeout_sec * 1000 + (timeout_usec + 999) / 1000;
+        if (poll(&fds, 1, timeout_ms) <= 0) {
+            // Timed out or interrupted.
+            return;
+        }
+    }
+
+    BatchBuffers& buffers = *recv_buffers_;
+    for (size_t i = 0; i < batch_size_; ++i) {
+        buffers.iovecs_[i].iov_base = &buffers.data_[i * IfaceMgr::RCVBUFSIZE];
+        buffers.iovecs_[i].iov_len = IfaceMgr::RCVBUFSIZE;
+        struct msghdr& hdr = buffers.getHeader(i);
+        memset(&hdr, 0, sizeof(hdr));
+        hdr.msg_name = &buffers.names_[i];
+        hdr.msg_namelen = sizeof(buffers.names_[i]);
+        hdr.msg_iov = &buffers.iovecs_[i];
+        hdr.msg_iovlen = 1;
+    }
+
+#ifdef HAVE_SENDMMSG
+    int count = recvmmsg(sockfd_, &buffers.msgs_[0], batch_size_,
+                         MSG_DONTWAIT, 0);
+#else
+    int count = 0;
+    while (count < static_cast<int>(batch_size_)) {
+        ssize_t length = recvmsg(sockfd_, &buffers.getHeader(count),
+                                 MSG_DONTWAIT);
+        if (length < 0) {
+            if (count == 0) {
+                count = -1;
+            }
+            break;
+        }
+        buffers.lengths_[count] = length;
+        ++count;
+    }
+#endif
+    if (count < 0) {
+        if ((errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == EINTR)) {
+            return;
+        }
+        isc_throw(SocketReadError, "failed to receive packets: "
+                  << strerror(errno));
+    }
+
+    for (int i = 0; i < count; ++i) {
+        const uint8_t* data = &buffers.data_[i * IfaceMgr::RCVBUFSIZE];
+        PktPtr pkt;
+        try {
+            if (family_ == AF_INET) {
+                const struct sockaddr_in* from =
+                    reinterpret_cast<const struct sockaddr_in*>(&buffers.names_[i]);
+                pkt.reset(new Pkt4(data, buffers.getLength(i)));
+                pkt->setRemoteAddr(IOAddress(ntohl(from->sin_addr.s_addr)));
+                pkt->setRemotePort(ntohs(from->sin_port));
+            } else {
+                const struct sockaddr_in6* from =
+                    reinterpret_cast<const struct sockaddr_in6*>(&buffers.names_[i]);
+                pkt.reset(new Pkt6(data, buffers.getLength(i)));
+                pkt->setRemoteAddr(IOAddress::fromBytes(AF_INET6,
+                                                        from->sin6_addr.s6_addr));
+                pkt->setRemotePort(ntohs(from->sin6_port));
+            }
+        } catch (const std::exception& e) {
+            ExchangeStats::malformed_pkts_++;
+            std::cout << "Incorrect DHCP packet received"
+                      << e.what() << std::endl;
+            continue;
+        }
+        pkt->updateTimestamp();
+        pkt->setLocalAddr(addr_);
+        pkt->setLocalPort(port_);
+        pkt->setIndex(ifindex_);
+        if (iface_) {
+            pkt->setIface(iface_->getName());
+        }
+        try {
+            pkt->unpack();
+        } catch (const std::exception& e) {
+            ExchangeStats::malformed_pkts_++;
+            std::cout << "Incorrect DHCP packet received"
+                      << e.what() << std::endl;
+        }
+        received_.push_back(pkt);
+    }
+}
+
 }
 }
@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2023 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -14,6 +14,10 @@
 #include <dhcp/socket_info.h>
 #include <dhcp/iface_mgr.h>
 
+#include <deque>
+#include <memory>
+#include <vector>
+
 namespace isc {
 namespace perfdhcp {
 
@@ -50,6 +54,13 @@ public:
 
     /// \brief See description of this method in PerfSocket class below.
     virtual dhcp::IfacePtr getIface() = 0;
+
+    /// \brief Send the packets queued by the socket.
+    ///
+    /// Sockets sending packets in batches queue them until the batch is
+    /// full. The test calls this method after each round of sends so no
+    /// packet waits in the queue. The default implementation does nothing.
+    virtual void flush() {}
 };
 
 /// \brief Socket wrapper structure.
@@ -137,6 +148,128 @@ protected:
     int openSocket(CommandOptions& options) const;
 };
 
+/// \brief Buffers of a batch of messages.
+struct BatchBuffers;
+
+/// \brief Socket wrapper sending and receiving packets in batches.
+///
+/// This socket is used by the workers of a multi-worker test, each one
+/// having its own socket bound to its own local address. Sent packets
+/// are queued and written with a single sendmmsg() system call when the
+/// batch is full or when flush() is called. Received packets are read
+/// up to a batch at a time with recvmmsg() directly from the socket,
+/// so the workers do not compete for the sockets of the IfaceMgr. When
+/// sendmmsg() and recvmmsg() are not available the packets of a batch
+/// are written and read one by one.
+///
+/// The sending and receiving sides use distinct members so they can
+/// be run by the sending and the receiving threads of a worker. The
+/// interface is looked up once at construction for the same reason.
+class BatchPerfSocket : public PerfSocket {
+public:
+    /// \brief Default number of packets in a batch.
+    static const size_t DEFAULT_BATCH_SIZE = 64;
+
+    /// \brief Constructor.
+    ///
+    /// \param options options of the worker.
+    /// \param batch_size maximum number of packets in a batch.
+    /// \throw isc::BadValue if the batch size is 0 or if the socket
+    /// can't be opened.
+    BatchPerfSocket(CommandOptions& options,
+                    const size_t batch_size = DEFAULT_BATCH_SIZE);
+
+    /// \brief Destructor.
+    ///
+    /// Packets still queued are not sent.
+    virtual ~BatchPerfSocket();
+
+    /// \brief Receive DHCPv4 packet.
+    ///
+    /// Returns the next packet of the last batch read from the socket,
+    /// reading a new batch when it is exhausted.
+    ///
+    /// \param timeout_sec number of seconds for waiting for a packet,
+    /// \param timeout_usec number of microseconds for waiting for a packet,
+    /// \throw isc::dhcp::SocketReadError if the socket can't be read.
+    /// \return received packet or nullptr if timed out
+    virtual dhcp::Pkt4Ptr receive4(uint32_t timeout_sec, uint32_t timeout_usec) override;
+
+    /// \brief Receive DHCPv6 packet.
+    ///
+    /// Returns the next packet of the last batch read from the socket,
+    /// reading a new batch when it is exhausted.
+    ///
+    /// \param timeout_sec number of seconds for waiting for a packet,
+    /// \param timeout_usec number of microseconds for waiting for a packet,
+    /// \throw isc::dhcp::SocketReadError if the socket can't be read.
+    /// \return received packet or nullptr if timed out
+    virtual dhcp::Pkt6Ptr receive6(uint32_t timeout_sec, uint32_t timeout_usec) override;
+
+    /// \brief Queue DHCPv4 packet for sending.
+    ///
+    /// \param pkt a packed packet for sending
+    /// \throw isc::dhcp::SocketWriteError if the batch is full and it
+    /// can't be sent.
+    /// \return true
+    virtual bool send(const dhcp::Pkt4Ptr& pkt) override;
+
+    /// \brief Queue DHCPv6 packet for sending.
+    ///
+    /// \param pkt a packed packet for sending
+    /// \throw isc::dhcp::SocketWriteError if the batch is full and it
+    /// can't be sent.
+    /// \return true
+    virtual bool send(const dhcp::Pkt6Ptr& pkt) override;
+
+    /// \brief Send the queued packets.
+    ///
+    /// The packets are timestamped just before being sent.
+    ///
+    /// \throw isc::dhcp::SocketWriteError if the packets can't be sent.
+    virtual void flush() override;
+
+    /// \brief Get the interface of the socket.
+    ///
+    /// \return shared pointer to Iface.
+    virtual dhcp::IfacePtr getIface() override;
+
+    /// \brief Returns the maximum number of packets in a batch.
+    size_t getBatchSize() const {
+        return (batch_size_);
+    }
+
+private:
+    /// \brief Queue a packet for sending.
+    ///
+    /// \param pkt a packed packet for sending.
+    void queue(const dhcp::PktPtr& pkt);
+
+    /// \brief Read a batch of packets from the socket.
+    ///
+    /// \param timeout_sec number of seconds for waiting for a packet,
+    /// \param timeout_usec number of microseconds for waiting for a packet,
+    void receiveBatch(uint32_t timeout_sec, uint32_t timeout_usec);
+
+    /// \brief Maximum number of packets in a batch.
+    size_t batch_size_;
+
+    /// \brief Interface of the socket.
+    dhcp::IfacePtr iface_;
+
+    /// \brief Packets waiting to be sent.
+    std::vector<dhcp::PktPtr> send_queue_;
+
+    /// \brief Buffers used to send a batch.
+    std::unique_ptr<BatchBuffers> send_buffers_;
+
+    /// \brief Packets read and not yet returned.
+    std::deque<dhcp::PktPtr> received_;
+
+    /// \brief Buffers used to receive a batch.
+    std::unique_ptr<BatchBuffers> recv_buffers_;
+};
+
 }
 }
 
@@ -1,4 +1,4 @@
-// Copyright (C) 2018-2021 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2018-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -133,6 +133,7 @@ Receiver::receivePackets() {
 
         // Drop the packet if not supported. Do not bother main thread about it.
         if (pkt->getType() == DHCPOFFER || pkt->getType() == DHCPACK ||
+            ((ip_version_ == 4) && (pkt->getType() == DHCPNAK)) ||
             pkt->getType() == DHCPV6_ADVERTISE || pkt->getType() == DHCPV6_REPLY) {
             // Otherwise push the packet to the queue, to main thread.
             std::lock_guard<std::mutex> lock(pkt_queue_mutex_);
@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2024 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -14,8 +14,15 @@
 #include <dhcp/pkt4.h>
 #include <perfdhcp/stats_mgr.h>
 #include <perfdhcp/test_control.h>
+#include <cc/data.h>
 #include <boost/foreach.hpp>
 
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+using isc::data::Element;
+using isc::data::ElementPtr;
 using isc::dhcp::DHO_DHCP_CLIENT_IDENTIFIER;
 using isc::dhcp::DUID;
 using isc::dhcp::Option6IAAddr;
@@ -76,17 +83,21 @@ std::ostream& operator<<(std::ostream& os, ExchangeType xchg_type)
 ExchangeStats::ExchangeStats(const ExchangeType xchg_type,
                              const double drop_time,
                              const bool archive_enabled,
-                             const boost::posix_time::ptime boot_time)
+                             const boost::posix_time::ptime boot_time,
+                             const size_t max_pending)
     : xchg_type_(xchg_type),
       sent_packets_(),
       rcvd_packets_(),
       archived_packets_(),
       archive_enabled_(archive_enabled),
       drop_time_(drop_time),
+      max_pending_(max_pending),
       min_delay_(std::numeric_limits<double>::max()),
       max_delay_(0.),
       sum_delay_(0.),
       sum_delay_squared_(0.),
+      delays_(),
+      interval_delays_(),
       orphans_(0),
       collected_(0),
       unordered_lookup_size_sum_(0),
@@ -150,6 +161,44 @@ ExchangeStats::updateDelays(const PktPtr& sent_packet,
     // mean delays.
     sum_delay_ += delta;
     sum_delay_squared_ += delta * delta;
+
+    delays_.recordSeconds(delta);
+    interval_delays_.recordSeconds(delta);
+}
+
+void
+ExchangeStats::collectPending() {
+    using namespace boost::posix_time;
+
+    PktList::nth_index<0>::type& seq = sent_packets_.template get<0>();
+    ptime now(not_a_date_time);
+    while (!seq.empty()) {
+        bool collect = (seq.size() >= max_pending_);
+        if (!collect && (drop_time_ > 0)) {
+            ptime packet_time = seq.front()->getTimestamp();
+            // Packets queued by a batching socket are not sent yet.
+            if (packet_time.is_not_a_date_time()) {
+                break;
+            }
+            if (now.is_not_a_date_time()) {
+                now = microsec_clock::universal_time();
+            }
+            time_period packet_period(packet_time, now);
+            collect = (!packet_period.is_null() &&
+                       (packet_period.length().total_microseconds() >
+                        drop_time_ * 1e6));
+        }
+        if (!collect) {
+            // Following packets were sent later.
+            break;
+        }
+        if (next_sent_ == seq.begin()) {
+            next_sent_ = eraseSent(seq.begin());
+        } else {
+            eraseSent(seq.begin());
+        }
+        ++collected_;
+    }
 }
 
 PktPtr
@@ -359,15 +408,25 @@ StatsMgr::StatsMgr(CommandOptions& options) :
     // it so as StatsMgr preserves all packets.
     archive_enabled_ = options.testDiags('l') || options.testDiags('t');
 
+    // The avalanche scenario needs all packets waiting for a response.
+    max_pending_ = 0;
+    if (options.getScenario() != Scenario::AVALANCHE) {
+        max_pending_ = ExchangeStats::DEFAULT_MAX_PENDING;
+    }
+
     if (options.getIpVersion() == 4) {
         addExchangeStats(ExchangeType::DO, options.getDropTime()[0]);
         if (options.getExchangeMode() == CommandOptions::DORA_SARR) {
             addExchangeStats(ExchangeType::RA, options.getDropTime()[1]);
         }
-        if (options.getRenewRate() != 0) {
+        // The clients of the lifecycle scenario renew and release
+        // their leases according to the lifecycle event mix.
+        if ((options.getRenewRate() != 0) ||
+            (options.getScenario() == Scenario::LIFECYCLE)) {
             addExchangeStats(ExchangeType::RNA);
         }
-        if (options.getReleaseRate() != 0) {
+        if ((options.getReleaseRate() != 0) ||
+            (options.getScenario() == Scenario::LIFECYCLE)) {
             addExchangeStats(ExchangeType::RLA);
         }
     } else if (options.getIpVersion() == 6) {
@@ -454,6 +513,155 @@ ExchangeStats::printLeases() const {
     std::cout << receivedLeases() << std::endl;
 }
 
+void
+ExchangeStats::merge(const ExchangeStats& other) {
+    if (other.xchg_type_ != xchg_type_) {
+        isc_throw(BadValue, "unable to merge statistics of exchange "
+                  << other.xchg_type_ << " into " << xchg_type_);
+    }
+    // Appending to the sequenced index does not invalidate next_sent_.
+    sent_packets_.insert(sent_packets_.end(), other.sent_packets_.begin(),
+                         other.sent_packets_.end());
+    rcvd_packets_.insert(rcvd_packets_.end(), other.rcvd_packets_.begin(),
+                         other.rcvd_packets_.end());
+    archived_packets_.insert(archived_packets_.end(),
+                             other.archived_packets_.begin(),
+                             other.archived_packets_.end());
+    min_delay_ = std::min(min_delay_, other.min_delay_);
+    max_delay_ = std::max(max_delay_, other.max_delay_);
+    sum_delay_ += other.sum_delay_;
+    sum_delay_squared_ += other.sum_delay_squared_;
+    delays_.merge(other.delays_);
+    interval_delays_.merge(other.interval_delays_);
+    orphans_ += other.orphans_;
+    collected_ += other.collected_;
+    unordered_lookup_size_sum_ += other.unordered_lookup_size_sum_;
+    unordered_lookups_ += other.unordered_lookups_;
+    ordered_lookups_ += other.ordered_lookups_;
+    sent_packets_num_ += other.sent_packets_num_;
+    rcvd_packets_num_ += other.rcvd_packets_num_;
+    non_unique_addr_num_ += other.non_unique_addr_num_;
+    rejected_leases_num_ += other.rejected_leases_num_;
+    boot_time_ = std::min(boot_time_, other.boot_time_);
+}
+
+namespace {
+
+/// @brief Percentiles of delays in the machine readable reports.
+const double REPORT_PERCENTILES[] = { 50., 90., 99., 99.9 };
+
+/// @brief Names of the percentiles in the machine readable reports.
+const char* REPORT_PERCENTILE_NAMES[] = { "p50", "p90", "p99", "p99.9" };
+
+/// @brief Converts a delay in microseconds to milliseconds.
+///
+/// @param usecs delay in microseconds.
+/// @return delay in milliseconds.
+double
+toMillis(const double usecs) {
+    return (usecs / 1e3);
+}
+
+}
+
+std::string
+StatsMgr::formatDelay(const LatencyHistogram& delays, const double percentile) {
+    if (delays.getCount() == 0) {
+        return ("n/a");
+    }
+    std::ostringstream s;
+    s << std::fixed << std::setprecision(3)
+      << toMillis(delays.getPercentile(percentile));
+    return (s.str());
+}
+
+void
+StatsMgr::writeCsvHeader(std::ostream& out) {
+    out << "report,time,exchange,sent,received,drops,orphans,rejected,"
+        << "collected,delays,min-delay,avg-delay,max-delay";
+    for (auto const& name : REPORT_PERCENTILE_NAMES) {
+        out << "," << name << "-delay";
+    }
+    out << std::endl;
+}
+
+void
+StatsMgr::writeReport(std::ostream& out, const StatsFormat format,
+                      const bool final) const {
+    const std::string report(final ? "final" : "interval");
+    const double time =
+        getTestPeriod().length().total_microseconds() / 1e6;
+    ElementPtr exchanges = Element::createList();
+    for (auto const& it : exchanges_) {
+        const ExchangeStats& xchg = *it.second;
+        const LatencyHistogram& delays =
+            (final ? xchg.getDelays() : xchg.getIntervalDelays());
+        std::ostringstream name;
+        name << it.first;
+        if (format == StatsFormat::CSV) {
+            out << std::fixed << std::setprecision(3)
+                << report << "," << time << "," << name.str()
+                << "," << xchg.getSentPacketsNum()
+                << "," << xchg.getRcvdPacketsNum()
+                << "," << xchg.getDroppedPacketsNum()
+                << "," << xchg.getOrphans()
+                << "," << xchg.getRejLeasesNum()
+                << "," << xchg.getCollectedNum()
+                << "," << delays.getCount()
+                << "," << toMillis(delays.getMin())
+                << "," << toMillis(delays.getMean())
+                << "," << toMillis(delays.getMax());
+            for (auto const& percentile : REPORT_PERCENTILES) {
+                out << "," << toMillis(delays.getPercentile(percentile));
+            }
+            out << std::endl;
+            continue;
+        }
+        ElementPtr map = Element::createMap();
+        map->set("exchange", Element::create(name.str()));
+        map->set("sent",
+                 Element::create(static_cast<int64_t>(xchg.getSentPacketsNum())));
+        map->set("received",
+                 Element::create(static_cast<int64_t>(xchg.getRcvdPacketsNum())));
+        map->set("drops",
+                 Element::create(static_cast<int64_t>(xchg.getDroppedPacketsNum())));
+        map->set("orphans",
+                 Element::create(static_cast<int64_t>(xchg.getOrphans())));
+        map->set("rejected",
+                 Element::create(static_cast<int64_t>(xchg.getRejLeasesNum())));
+        map->set("collected",
+                 Element::create(static_cast<int64_t>(xchg.getCollectedNum())));
+        map->set("delays",
+                 Element::create(static_cast<int64_t>(delays.getCount())));
+        map->set("min-delay", Element::create(toMillis(delays.getMin())));
+        map->set("avg-delay", Element::create(toMillis(delays.getMean())));
+        map->set("max-delay", Element::create(toMillis(delays.getMax())));
+        for (size_t i = 0; i < sizeof(REPORT_PERCENTILES) / sizeof(double); ++i) {
+            map->set(std::string(REPORT_PERCENTILE_NAMES[i]) + "-delay",
+                     Element::create(toMillis(delays.getPercentile(REPORT_PERCENTILES[i]))));
+        }
+        if (final) {
+            // Highest delay of each bucket in microseconds and count.
+            ElementPtr histogram = Element::createList();
+            for (auto const& bucket : delays.getBuckets()) {
+                ElementPtr pair = Element::createList();
+                pair->add(Element::create(static_cast<int64_t>(bucket.first)));
+                pair->add(Element::create(static_cast<int64_t>(bucket.second)));
+                histogram->add(pair);
+            }
+            map->set("histogram", histogram);
+        }
+        exchanges->add(map);
+    }
+    if (format == StatsFormat::JSON) {
+        ElementPtr json = Element::createMap();
+        json->set("report", Element::create(report));
+        json->set("time", Element::create(time));
+        json->set("exchanges", exchanges);
+        out << json->str() << std::endl;
+    }
+}
+
 void StatsMgr::printLeases() const {
     for (auto const& exchange : exchanges_) {
         std::cout << "***Leases for " << exchange.first << "***" << std::endl;
@@ -463,7 +671,24 @@ void StatsMgr::printLeases() const {
     }
 }
 
-int ExchangeStats::malformed_pkts_{0};
+void
+StatsMgr::merge(const StatsMgr& other) {
+    for (auto const& it : other.exchanges_) {
+        getExchangeStats(it.first)->merge(*it.second);
+    }
+    for (auto const& it : other.custom_counters_) {
+        auto counter = custom_counters_.find(it.first);
+        if (counter == custom_counters_.end()) {
+            custom_counters_[it.first] =
+                CustomCounterPtr(new CustomCounter(*it.second));
+        } else {
+            *counter->second += it.second->getValue();
+        }
+    }
+    boot_time_ = std::min(boot_time_, other.boot_time_);
+}
+
+std::atomic<int> ExchangeStats::malformed_pkts_{0};
 
 }  // namespace perfdhcp
 }  // namespace isc
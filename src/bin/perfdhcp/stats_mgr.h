@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2025 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -10,6 +10,7 @@
 #include <dhcp/pkt.h>
 #include <exceptions/exceptions.h>
 #include <perfdhcp/command_options.h>
+#include <perfdhcp/latency_histogram.h>
 
 #include <boost/noncopyable.hpp>
 #include <boost/shared_ptr.hpp>
@@ -20,6 +21,7 @@
 #include <boost/multi_index/mem_fun.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
 
+#include <atomic>
 #include <iostream>
 #include <map>
 #include <queue>
@@ -270,6 +272,10 @@ public:
     typedef typename std::queue<PktListTransidHashIterator>
     PktListRemovalQueue;
 
+    /// \brief Default maximum number of sent packets waiting for a
+    /// response in the basic scenario.
+    static const size_t DEFAULT_MAX_PENDING = 1 << 20;
+
     /// \brief Constructor
     ///
     /// \param xchg_type exchange type
@@ -278,21 +284,37 @@ public:
     /// \param archive_enabled if true packets archive mode is enabled.
     /// In this mode all packets are stored throughout the test execution.
     /// \param boot_time Holds the timestamp when perfdhcp has been started.
+    /// \param max_pending maximum number of sent packets waiting for a
+    /// response, 0 for no limit. When it is set the oldest sent packets
+    /// are garbage collected as new packets are sent, see
+    /// \ref appendSent.
     ExchangeStats(const ExchangeType xchg_type,
                   const double drop_time,
                   const bool archive_enabled,
-                  const boost::posix_time::ptime boot_time);
+                  const boost::posix_time::ptime boot_time,
+                  const size_t max_pending = 0);
 
     /// \brief Add new packet to list of sent packets.
     ///
     /// Method adds new packet to list of sent packets.
     ///
+    /// When the number of pending packets is bounded, the packets at the
+    /// head of the list which are older than the drop time are garbage
+    /// collected first, and so are the oldest packets when the list is
+    /// full. As packets are sent in order this only looks at the head of
+    /// the list, so the memory used by the sent packets stays bounded
+    /// even when the server drops most of them and the received packets
+    /// never trigger the unordered lookups which collect them otherwise.
+    ///
     /// \param packet packet object to be added.
     /// \throw isc::BadValue if packet is null.
     void appendSent(const dhcp::PktPtr& packet) {
         if (!packet) {
             isc_throw(BadValue, "Packet is null");
         }
+        if (max_pending_ > 0) {
+            collectPending();
+        }
         static_cast<void>(sent_packets_.template get<0>().push_back(packet));
         ++sent_packets_num_;
     }
@@ -387,6 +409,36 @@ public:
                     getAvgDelay() * getAvgDelay()));
     }
 
+    /// \brief Return a percentile of packet delays.
+    ///
+    /// The percentile is computed from the histogram of delays so its
+    /// precision is the width of the bucket holding it, see
+    /// \ref LatencyHistogram.
+    ///
+    /// \param percentile percentile between 0 and 100.
+    /// \throw isc::InvalidOperation if no packets for this exchange
+    /// have been received yet.
+    /// \throw isc::BadValue if the percentile is out of range.
+    /// \return the percentile of packet delays in seconds.
+    double getDelayPercentile(const double percentile) const {
+        if (delays_.getCount() == 0) {
+            isc_throw(InvalidOperation, "no packets received");
+        }
+        return (static_cast<double>(delays_.getPercentile(percentile)) / 1e6);
+    }
+
+    /// \brief Return the histogram of all packet delays.
+    const LatencyHistogram& getDelays() const { return (delays_); }
+
+    /// \brief Return the histogram of packet delays since the last
+    /// intermediate report.
+    const LatencyHistogram& getIntervalDelays() const {
+        return (interval_delays_);
+    }
+
+    /// \brief Start a new interval of packet delays.
+    void resetIntervalDelays() { interval_delays_.reset(); }
+
     /// \brief Return number of orphan packets.
     ///
     /// Method returns number of received packets that had no matching
@@ -528,9 +580,10 @@ public:
     ///
     /// Method prints round trip time packets statistics. Statistics
     /// includes minimum packet delay, maximum packet delay, average
-    /// packet delay and standard deviation of delays. Packet delay
-    /// is a duration between sending a packet to server and receiving
-    /// response from server.
+    /// packet delay, standard deviation of delays and the 50th, 99th
+    /// and 99.9th percentiles of delays. Packet delay is a duration
+    /// between sending a packet to server and receiving response from
+    /// server.
     void printRTTStats() const {
         using namespace std;
         // Save cout fmtflags.
@@ -542,6 +595,12 @@ public:
                  << "max delay: " << getMaxDelay() * 1e3 << " ms" << endl
                  << "std deviation: " << getStdDevDelay() * 1e3 << " ms"
                  << endl
+                 << "p50 delay: " << getDelayPercentile(50.) * 1e3 << " ms"
+                 << endl
+                 << "p99 delay: " << getDelayPercentile(99.) * 1e3 << " ms"
+                 << endl
+                 << "p99.9 delay: " << getDelayPercentile(99.9) * 1e3
+                 << " ms" << endl
                  << "collected packets: " << getCollectedNum() << endl;
         } catch (const Exception&) {
             // repeated output for easier automated parsing
@@ -549,6 +608,9 @@ public:
                  << "avg delay: n/a" << endl
                  << "max delay: n/a" << endl
                  << "std deviation: n/a" << endl
+                 << "p50 delay: n/a" << endl
+                 << "p99 delay: n/a" << endl
+                 << "p99.9 delay: n/a" << endl
                  << "collected packets: 0" << endl;
         }
         // Restore cout fmtflags.
@@ -584,7 +646,19 @@ public:
     /// \brief Print the list of received leases.
     void printLeases() const;
 
-    static int malformed_pkts_;
+    /// \brief Merge the statistics of another exchange.
+    ///
+    /// Counters and delay sums are added, delay bounds are combined and
+    /// the packets of the other exchange are appended to the packet lists
+    /// of this one. This is used to aggregate the statistics of the workers
+    /// of a multi-worker test once they are stopped.
+    ///
+    /// \param other statistics of the same exchange type.
+    /// \throw isc::BadValue if the exchange types differ.
+    void merge(const ExchangeStats& other);
+
+    /// \brief Number of malformed packets, updated by all workers.
+    static std::atomic<int> malformed_pkts_;
 
 // Private stuff of ExchangeStats class
 private:
@@ -595,6 +669,13 @@ private:
     /// class to specify exchange type explicitly.
     ExchangeStats();
 
+    /// \brief Garbage collect the oldest pending sent packets.
+    ///
+    /// It removes the packets at the head of the list of sent packets
+    /// which are older than the drop time, and the oldest packets when
+    /// the list holds the maximum number of pending packets.
+    void collectPending();
+
     /// \brief Erase packet from the list of sent packets.
     ///
     /// Method erases packet from the list of sent packets.
@@ -649,6 +730,10 @@ private:
     /// before packet is assumed dropped.
     double drop_time_;
 
+    /// Maximum number of sent packets waiting for a response, 0 for
+    /// no limit.
+    size_t max_pending_;
+
     double min_delay_;             ///< Minimum delay between sent
                                    ///< and received packets.
     double max_delay_;             ///< Maximum delay between sent
@@ -658,6 +743,10 @@ private:
     double sum_delay_squared_;     ///< Squared sum of delays between
                                    ///< sent and received packets.
 
+    LatencyHistogram delays_;          ///< Histogram of all delays.
+    LatencyHistogram interval_delays_; ///< Histogram of delays since the
+                                       ///< last intermediate report.
+
     uint64_t orphans_;   ///< Number of orphan received packets.
 
     uint64_t collected_; ///< Number of garbage collected packets.
@@ -742,7 +831,8 @@ public:
             ExchangeStatsPtr(new ExchangeStats(xchg_type,
                                                drop_time,
                                                archive_enabled_,
-                                               boot_time_));
+                                               boot_time_,
+                                               max_pending_));
     }
 
     /// \brief Check if the exchange type has been specified.
@@ -910,6 +1000,42 @@ public:
         return(xchg_stats->getStdDevDelay());
     }
 
+    /// \brief Return a percentile of packet delays.
+    ///
+    /// Method returns a percentile of packet delays for specified
+    /// exchange type.
+    ///
+    /// \param xchg_type exchange type.
+    /// \param percentile percentile between 0 and 100.
+    /// \throw isc::BadValue if invalid exchange type specified.
+    /// \throw isc::InvalidOperation if no packets have been received.
+    /// \return percentile of packet delays.
+    double getDelayPercentile(const ExchangeType xchg_type,
+                              const double percentile) const {
+        ExchangeStatsPtr xchg_stats = getExchangeStats(xchg_type);
+        return(xchg_stats->getDelayPercentile(percentile));
+    }
+
+    /// \brief Return the histogram of packet delays.
+    ///
+    /// \param xchg_type exchange type.
+    /// \throw isc::BadValue if invalid exchange type specified.
+    /// \return histogram of all packet delays.
+    const LatencyHistogram& getDelays(const ExchangeType xchg_type) const {
+        return(getExchangeStats(xchg_type)->getDelays());
+    }
+
+    /// \brief Return the histogram of packet delays since the last
+    /// intermediate report.
+    ///
+    /// \param xchg_type exchange type.
+    /// \throw isc::BadValue if invalid exchange type specified.
+    /// \return histogram of packet delays since the last report.
+    const LatencyHistogram&
+    getIntervalDelays(const ExchangeType xchg_type) const {
+        return(getExchangeStats(xchg_type)->getIntervalDelays());
+    }
+
     /// \brief Return number of orphan packets.
     ///
     /// Method returns number of orphan packets for specified
@@ -1113,7 +1239,8 @@ public:
     ///
     /// Method prints intermediate statistics for all exchanges.
     /// Statistics includes sent, received and dropped packets
-    /// counters.
+    /// counters and the 50th, 99th and 99.9th percentiles of the
+    /// packet delays since the previous intermediate report.
     ///
     /// \param clean_report value to generate easy to parse report.
     /// \param clean_sep string used as separator if clean_report enabled..
@@ -1123,6 +1250,9 @@ public:
         std::ostringstream stream_rcvd;
         std::ostringstream stream_drops;
         std::ostringstream stream_reject;
+        std::ostringstream stream_p50;
+        std::ostringstream stream_p99;
+        std::ostringstream stream_p999;
         std::string sep("");
         bool first = true;
         for (auto const& it : exchanges_) {
@@ -1139,6 +1269,10 @@ public:
             stream_rcvd << sep << it.second->getRcvdPacketsNum();
             stream_drops << sep << it.second->getDroppedPacketsNum();
             stream_reject << sep << it.second->getRejLeasesNum();
+            const LatencyHistogram& delays = it.second->getIntervalDelays();
+            stream_p50 << sep << formatDelay(delays, 50.);
+            stream_p99 << sep << formatDelay(delays, 99.);
+            stream_p999 << sep << formatDelay(delays, 99.9);
         }
 
         if (clean_report) {
@@ -1146,6 +1280,9 @@ public:
                       << clean_sep << stream_rcvd.str()
                       << clean_sep << stream_drops.str()
                       << clean_sep << stream_reject.str()
+                      << clean_sep << stream_p50.str()
+                      << clean_sep << stream_p99.str()
+                      << clean_sep << stream_p999.str()
                       << std::endl;
 
         } else {
@@ -1153,10 +1290,45 @@ public:
                       << "; received: " << stream_rcvd.str()
                       << "; drops: " << stream_drops.str()
                       << "; rejected: " << stream_reject.str()
+                      << "; p50/p99/p99.9 delay (ms): " << stream_p50.str()
+                      << " " << stream_p99.str()
+                      << " " << stream_p999.str()
                       << std::endl;
         }
     }
 
+    /// \brief Start a new interval of packet delays for all exchanges.
+    ///
+    /// It is called after each intermediate report.
+    void resetIntervalStats() {
+        for (auto const& it : exchanges_) {
+            it.second->resetIntervalDelays();
+        }
+    }
+
+    /// \brief Write the header of the CSV reports.
+    ///
+    /// \param out the output stream.
+    static void writeCsvHeader(std::ostream& out);
+
+    /// \brief Write a machine readable report.
+    ///
+    /// The report holds for each exchange the packet counters since
+    /// the start of the test and the minimum, average, maximum and the
+    /// 50th, 90th, 99th and 99.9th percentiles of the packet delays in
+    /// milliseconds, since the previous intermediate report for an
+    /// intermediate report or since the start of the test for the final
+    /// report. In JSON the report is a map on a single line (JSON Lines)
+    /// and the final report includes the non empty buckets of the delays
+    /// histograms. In CSV the report has a line per exchange.
+    ///
+    /// \param out the output stream.
+    /// \param format format of the report.
+    /// \param final true for the final report, false for an intermediate
+    /// report.
+    void writeReport(std::ostream& out, const StatsFormat format,
+                     const bool final) const;
+
     /// \brief Print timestamps of all packets.
     ///
     /// Method prints timestamps of all sent and received
@@ -1186,6 +1358,18 @@ public:
     /// \brief Delegate to all exchanges to print their leases.
     void printLeases() const;
 
+    /// \brief Merge the statistics of another manager.
+    ///
+    /// The statistics of each exchange and the custom counters of the
+    /// other manager are added to the ones of this manager, and the test
+    /// is considered started at the earliest of both start times. This is
+    /// used to report the statistics of a multi-worker test as a whole.
+    ///
+    /// \param other statistics manager of another worker.
+    /// \throw isc::BadValue if an exchange of the other manager is not
+    /// tracked by this manager.
+    void merge(const StatsMgr& other);
+
     /// \brief Print names and values of custom counters.
     ///
     /// Method prints names and values of custom counters. Custom counters
@@ -1213,6 +1397,14 @@ public:
 
 private:
 
+    /// \brief Format a percentile of delays in milliseconds.
+    ///
+    /// \param delays the histogram of delays.
+    /// \param percentile the percentile.
+    /// \return the percentile or "n/a" when the histogram is empty.
+    static std::string formatDelay(const LatencyHistogram& delays,
+                                   const double percentile);
+
     /// \brief Return exchange stats object for given exchange type.
     ///
     /// Method returns exchange stats object for given exchange type.
@@ -1242,6 +1434,12 @@ private:
     /// archived.
     bool archive_enabled_;
 
+    /// Maximum number of sent packets waiting for a response per
+    /// exchange, 0 for no limit. The avalanche scenario resends the
+    /// pending packets until they get a response so it does not limit
+    /// them.
+    size_t max_pending_;
+
     boost::posix_time::ptime boot_time_; ///< Time when test is started.
 };
 
@@ -42,7 +42,7 @@ using namespace isc::asiolink;
 namespace isc {
 namespace perfdhcp {
 
-bool TestControl::interrupted_ = false;
+std::atomic<bool> TestControl::interrupted_(false);
 
 bool
 TestControl::waitToExit() {
@@ -100,11 +100,8 @@ TestControl::cleanCachedPackets() {
         return;
     }
 
-    static boost::posix_time::ptime last_clean =
-        microsec_clock::universal_time();
-
     // Check how much time has passed since last cleanup.
-    time_period time_since_clean(last_clean,
+    time_period time_since_clean(last_clean_,
                                  microsec_clock::universal_time());
     // Cleanup every 1 second.
     if (time_since_clean.length().total_seconds() >= 1) {
@@ -119,7 +116,7 @@ TestControl::cleanCachedPackets() {
         }
         // Remember when we performed a cleanup for the last time.
         // We want to do the next cleanup not earlier than in one second.
-        last_clean = microsec_clock::universal_time();
+        last_clean_ = microsec_clock::universal_time();
     }
 }
 
@@ -573,28 +570,33 @@ TestControl::sendPackets(const uint64_t packets_num,
             }
         }
     }
+    socket_.flush();
 }
 
 uint64_t
 TestControl::sendMultipleMessages4(const uint32_t msg_type,
                                    const uint64_t msg_num) {
-    for (uint64_t i = 0; i < msg_num; ++i) {
+    uint64_t i = 0;
+    for (; i < msg_num; ++i) {
         if (!sendMessageFromAck(msg_type)) {
-            return (i);
+            break;
         }
     }
-    return (msg_num);
+    socket_.flush();
+    return (i);
 }
 
 uint64_t
 TestControl::sendMultipleMessages6(const uint32_t msg_type,
                                    const uint64_t msg_num) {
-    for (uint64_t i = 0; i < msg_num; ++i) {
+    uint64_t i = 0;
+    for (; i < msg_num; ++i) {
         if (!sendMessageFromReply(msg_type)) {
-            return (i);
+            break;
         }
     }
-    return (msg_num);
+    socket_.flush();
+    return (i);
 }
 
 void
@@ -721,6 +723,11 @@ TestControl::printIntermediateStats() {
     if (time_since_report.length().total_seconds() >= delay) {
         stats_mgr_.printIntermediateStats(options_.getCleanReport(),
                                           options_.getCleanReportSeparator());
+        if (stats_file_) {
+            stats_mgr_.writeReport(*stats_file_, options_.getStatsFormat(),
+                                   false);
+        }
+        stats_mgr_.resetIntervalStats();
         last_report_ = now;
     }
 }
@@ -732,6 +739,9 @@ TestControl::printStats() const {
     if (options_.testDiags('i')) {
         stats_mgr_.printCustomCounters();
     }
+    if (stats_file_) {
+        stats_mgr_.writeReport(*stats_file_, options_.getStatsFormat(), true);
+    }
 }
 
 std::string
@@ -1001,12 +1011,18 @@ TestControl::consumeReceivedPackets() {
         pkt_count += 1;
         if (options_.getIpVersion() == 4) {
             Pkt4Ptr pkt4 = boost::dynamic_pointer_cast<Pkt4>(pkt);
-            processReceivedPacket4(pkt4);
+            if (packet_handler4_) {
+                packet_handler4_(pkt4);
+            } else {
+                processReceivedPacket4(pkt4);
+            }
         } else {
             Pkt6Ptr pkt6 = boost::dynamic_pointer_cast<Pkt6>(pkt);
             processReceivedPacket6(pkt6);
         }
     }
+    // Send the messages answering the received packets.
+    socket_.flush();
     return pkt_count;
 }
 void
@@ -1099,6 +1115,7 @@ TestControl::TestControl(CommandOptions& options, BasePerfSocket &socket) :
     exit_time_(not_a_date_time),
     socket_(socket),
     receiver_(socket, options.isSingleThreaded(), options.getIpVersion()),
+    last_clean_(microsec_clock::universal_time()),
     stats_mgr_(options),
     random_generator_(new RandomGenerator(0, options.getMacsFromFile().size())),
     options_(options) {
@@ -1142,6 +1159,18 @@ TestControl::TestControl(CommandOptions& options, BasePerfSocket &socket) :
         srandom(duration.length().total_seconds()
                 + duration.length().fractional_seconds());
     }
+    // Open the machine readable statistics output.
+    if (!options_.getStatsFile().empty()) {
+        stats_file_.reset(new std::ofstream(options_.getStatsFile().c_str(),
+                                            ios::out | ios::trunc));
+        if (!stats_file_->is_open()) {
+            isc_throw(BadValue, "unable to open stats file "
+                      << options_.getStatsFile());
+        }
+        if (options_.getStatsFormat() == StatsFormat::CSV) {
+            StatsMgr::writeCsvHeader(*stats_file_);
+        }
+    }
     // If user interrupts the program we will exit gracefully.
     signal(SIGINT, TestControl::handleInterrupt);
 }
@@ -1324,6 +1353,19 @@ TestControl::sendMessageFromAck(const uint16_t msg_type) {
     return (true);
 }
 
+void
+TestControl::sendClientMessage4(const Pkt4Ptr& pkt4,
+                                const IOAddress& giaddr) {
+    setDefaults4(pkt4);
+    if (!giaddr.isV4Zero()) {
+        pkt4->setGiaddr(giaddr);
+    }
+    pkt4->addOption(generateClientId(pkt4->getHWAddr()));
+    addExtraOpts(pkt4);
+    pkt4->pack();
+    socket_.send(pkt4);
+    saveFirstPacket(pkt4);
+}
 
 bool
 TestControl::sendMessageFromReply(const uint16_t msg_type) {
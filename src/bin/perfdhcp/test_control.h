@@ -24,6 +24,10 @@
 #include <boost/shared_ptr.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
 
+#include <atomic>
+#include <fstream>
+#include <functional>
+#include <memory>
 #include <random>
 #include <string>
 #include <vector>
@@ -256,6 +260,11 @@ public:
     /// \brief Get interrupted flag.
     bool interrupted() const { return interrupted_; }
 
+    /// \brief Interrupt the test as SIGINT does.
+    ///
+    /// It is used to stop all the workers of a test when one fails.
+    static void interrupt() { interrupted_ = true; }
+
     /// \brief Get stats manager.
     StatsMgr& getStatsMgr() { return stats_mgr_; };
 
@@ -324,15 +333,46 @@ public:
     /// It runs in a loop until there are no packets in receiver.
     unsigned int consumeReceivedPackets();
 
+    /// \brief Handler of the received DHCPv4 packets.
+    typedef std::function<void(const dhcp::Pkt4Ptr&)> PacketHandler4;
+
+    /// \brief Set the handler of the received DHCPv4 packets.
+    ///
+    /// Scenarios driving the exchanges of their own clients install a
+    /// handler which replaces the processing of the received packets
+    /// by \ref consumeReceivedPackets.
+    ///
+    /// \param handler handler of the received packets.
+    void setPacketHandler4(const PacketHandler4& handler) {
+        packet_handler4_ = handler;
+    }
+
+    /// \brief Send a DHCPv4 message of a simulated client.
+    ///
+    /// The message gets the default interface, ports and addresses, a
+    /// client identifier built from its hardware address and the extra
+    /// options before it is packed and sent.
+    ///
+    /// \param pkt4 message with its type, transaction id, hardware
+    /// address and exchange specific fields and options.
+    /// \param giaddr relay address of the client, used instead of the
+    /// default relay address when not zero.
+    /// \throw isc::BadValue if the socket has no interface.
+    void sendClientMessage4(const dhcp::Pkt4Ptr& pkt4,
+                            const asiolink::IOAddress& giaddr);
+
     /// \brief Print intermediate statistics.
     ///
     /// Print brief statistics regarding number of sent packets,
-    /// received packets and dropped packets so far.
+    /// received packets and dropped packets so far, and the delays
+    /// since the previous intermediate report. The same statistics
+    /// are written to the --stats-file when it is set.
     void printIntermediateStats();
 
     /// \brief Print performance statistics.
     ///
-    /// Method prints performance statistics.
+    /// Method prints performance statistics and writes them to the
+    /// --stats-file when it is set.
     /// \throws isc::InvalidOperation if Statistics Manager was
     /// not initialized.
     void printStats() const;
@@ -1090,9 +1130,15 @@ protected:
     /// \brief Last intermediate report time.
     boost::posix_time::ptime last_report_;
 
+    /// \brief Last time cached packets were cleaned.
+    boost::posix_time::ptime last_clean_;
+
     /// \brief Statistics Manager.
     StatsMgr stats_mgr_;
 
+    /// \brief Machine readable statistics output (--stats-file).
+    std::unique_ptr<std::ofstream> stats_file_;
+
     /// \brief Storage for DHCPACK messages.
     PacketStorage<dhcp::Pkt4> ack_storage_;
 
@@ -1125,10 +1171,13 @@ protected:
     std::map<uint8_t, dhcp::Pkt6Ptr> template_packets_v6_;
 
     /// \brief Program interrupted flag.
-    static bool interrupted_;
+    static std::atomic<bool> interrupted_;
 
     /// \brief Command options.
     CommandOptions& options_;
+
+    /// \brief Handler of the received DHCPv4 packets set by a scenario.
+    PacketHandler4 packet_handler4_;
 };
 
 }  // namespace perfdhcp
@@ -6,6 +6,7 @@
 
 #include <config.h>
 
+#include <algorithm>
 #include <cstddef>
 #include <fstream>
 #include <gtest/gtest.h>
@@ -1017,3 +1018,183 @@ TEST_F(CommandOptionsTest, UseRelayV6OptionsDuplicated) {
 }
 
 
+
+TEST_F(CommandOptionsTest, Workers) {
+    CommandOptions opt;
+    EXPECT_NO_THROW(process(opt, "perfdhcp -l 127.0.0.1 all"));
+    EXPECT_EQ(1U, opt.getWorkersNum());
+
+    EXPECT_NO_THROW(process(opt, "perfdhcp --workers 4 -r 100 -l 127.0.0.1 all"));
+    EXPECT_EQ(4U, opt.getWorkersNum());
+
+    // The number of workers must be a positive integer.
+    EXPECT_THROW(process(opt, "perfdhcp --workers 0 -l 127.0.0.1 all"),
+                 isc::InvalidParameter);
+    EXPECT_THROW(process(opt, "perfdhcp --workers -2 -l 127.0.0.1 all"),
+                 isc::InvalidParameter);
+    EXPECT_THROW(process(opt, "perfdhcp --workers x -l 127.0.0.1 all"),
+                 isc::InvalidParameter);
+
+    // Workers need a local address, not an interface.
+    EXPECT_THROW(process(opt, "perfdhcp --workers 2 -r 100 all"),
+                 isc::InvalidParameter);
+    const dhcp::IfaceCollection& ifaces = dhcp::IfaceMgr::instance().getIfaces();
+    if (!ifaces.empty()) {
+        std::string iface_name = (*ifaces.begin())->getName();
+        EXPECT_THROW(process(opt, "perfdhcp --workers 2 -r 100 -l " +
+                             iface_name + " all"),
+                     isc::InvalidParameter);
+    }
+
+    // Workers run the basic scenario only.
+    EXPECT_THROW(process(opt, "perfdhcp --workers 2 -r 100 -l 127.0.0.1"
+                         " --scenario avalanche all"),
+                 isc::InvalidParameter);
+
+    // Each worker needs a share of the rate, of the requests and of the
+    // clients.
+    EXPECT_THROW(process(opt, "perfdhcp --workers 4 -r 3 -l 127.0.0.1 all"),
+                 isc::InvalidParameter);
+    EXPECT_THROW(process(opt, "perfdhcp --workers 4 -r 100 -n 3"
+                         " -l 127.0.0.1 all"),
+                 isc::InvalidParameter);
+    EXPECT_THROW(process(opt, "perfdhcp --workers 4 -r 100 -R 3"
+                         " -l 127.0.0.1 all"),
+                 isc::InvalidParameter);
+}
+
+TEST_F(CommandOptionsTest, WorkerOptions) {
+    CommandOptions opt;
+    ASSERT_NO_THROW(process(opt, "perfdhcp -4 --workers 3 -r 100 -f 10"
+                            " -n 50 -p 10 -P 7 -R 1000 -D 5 -t 1"
+                            " -b mac=00:00:00:00:00:fe -l 127.0.0.1 all"));
+    ASSERT_EQ(3U, opt.getWorkersNum());
+
+    // The first worker gets the remainders and the periodic report.
+    CommandOptions opt0 = opt.getWorkerOptions(0);
+    EXPECT_EQ(1U, opt0.getWorkersNum());
+    EXPECT_EQ(34, opt0.getRate());
+    EXPECT_EQ(4, opt0.getRenewRate());
+    EXPECT_EQ(17, opt0.getNumRequests()[0]);
+    EXPECT_EQ(3, opt0.getPreload());
+    EXPECT_EQ(334U, opt0.getClientsNum());
+    EXPECT_EQ(2U, opt0.getMaxDrop()[0]);
+    EXPECT_EQ(1, opt0.getReportDelay());
+    EXPECT_EQ("127.0.0.1", opt0.getLocalName());
+    const uint8_t mac0[] = { 0, 0, 0, 0, 0, 0xfe };
+    EXPECT_TRUE(std::equal(mac0, mac0 + 6, opt0.getMacTemplate().begin()));
+
+    // The next workers bind to the next addresses and their clients follow
+    // the clients of the previous workers.
+    CommandOptions opt2 = opt.getWorkerOptions(2);
+    EXPECT_EQ(33, opt2.getRate());
+    EXPECT_EQ(3, opt2.getRenewRate());
+    EXPECT_EQ(16, opt2.getNumRequests()[0]);
+    EXPECT_EQ(2, opt2.getPreload());
+    EXPECT_EQ(333U, opt2.getClientsNum());
+    EXPECT_EQ(1U, opt2.getMaxDrop()[0]);
+    EXPECT_EQ(0, opt2.getReportDelay());
+    EXPECT_EQ("127.0.0.3", opt2.getLocalName());
+    // 0xfe + 667 = 0x399.
+    const uint8_t mac2[] = { 0, 0, 0, 0, 0x03, 0x99 };
+    EXPECT_TRUE(std::equal(mac2, mac2 + 6, opt2.getMacTemplate().begin()));
+    std::vector<uint8_t> duid2 = opt2.getDuidTemplate();
+    ASSERT_GE(duid2.size(), 6U);
+    EXPECT_TRUE(std::equal(mac2, mac2 + 6, duid2.end() - 6));
+
+    EXPECT_THROW(opt.getWorkerOptions(3), isc::OutOfRange);
+}
+
+TEST_F(CommandOptionsTest, StatsFile) {
+    CommandOptions opt;
+    EXPECT_NO_THROW(process(opt, "perfdhcp -l 127.0.0.1 all"));
+    EXPECT_TRUE(opt.getStatsFile().empty());
+    EXPECT_EQ(StatsFormat::JSON, opt.getStatsFormat());
+
+    EXPECT_NO_THROW(process(opt, "perfdhcp --stats-file /tmp/stats.json"
+                            " -l 127.0.0.1 all"));
+    EXPECT_EQ("/tmp/stats.json", opt.getStatsFile());
+    EXPECT_EQ(StatsFormat::JSON, opt.getStatsFormat());
+
+    EXPECT_NO_THROW(process(opt, "perfdhcp --stats-file /tmp/stats.csv"
+                            " --stats-format csv -l 127.0.0.1 all"));
+    EXPECT_EQ("/tmp/stats.csv", opt.getStatsFile());
+    EXPECT_EQ(StatsFormat::CSV, opt.getStatsFormat());
+
+    EXPECT_THROW(process(opt, "perfdhcp --stats-file /tmp/stats.xml"
+                         " --stats-format xml -l 127.0.0.1 all"),
+                 isc::InvalidParameter);
+
+    // Only the first worker writes the statistics.
+    EXPECT_NO_THROW(process(opt, "perfdhcp --workers 2 -r 100"
+                            " --stats-file /tmp/stats.json"
+                            " -l 127.0.0.1 all"));
+    EXPECT_EQ("/tmp/stats.json", opt.getWorkerOptions(0).getStatsFile());
+    EXPECT_TRUE(opt.getWorkerOptions(1).getStatsFile().empty());
+}
+
+TEST_F(CommandOptionsTest, Lifecycle) {
+    CommandOptions opt;
+    EXPECT_NO_THROW(process(opt, "perfdhcp -R 100 --scenario lifecycle"
+                            " -l 127.0.0.1 all"));
+    EXPECT_EQ(Scenario::LIFECYCLE, opt.getScenario());
+    // Clients renew their leases by default.
+    ASSERT_EQ(1U, opt.getLifecycleMix().size());
+    EXPECT_EQ(LifecycleEvent::RENEW, opt.getLifecycleMix().begin()->first);
+    EXPECT_EQ(1., opt.getLifecycleTimeScale());
+    EXPECT_EQ(0, opt.getLifecycleRebootStorm());
+
+    EXPECT_NO_THROW(process(opt, "perfdhcp -R 100 --scenario lifecycle"
+                            " --lifecycle-mix renew=70,rebind=5,release=10,"
+                            "decline=1,reboot=10,roam=4,renew=60"
+                            " --lifecycle-time-scale 3600"
+                            " --lifecycle-reboot-storm 30"
+                            " -l 127.0.0.1 all"));
+    std::map<LifecycleEvent, uint32_t> mix = opt.getLifecycleMix();
+    EXPECT_EQ(6U, mix.size());
+    EXPECT_EQ(60U, mix[LifecycleEvent::RENEW]);
+    EXPECT_EQ(5U, mix[LifecycleEvent::REBIND]);
+    EXPECT_EQ(10U, mix[LifecycleEvent::RELEASE]);
+    EXPECT_EQ(1U, mix[LifecycleEvent::DECLINE]);
+    EXPECT_EQ(10U, mix[LifecycleEvent::REBOOT]);
+    EXPECT_EQ(4U, mix[LifecycleEvent::ROAM]);
+    EXPECT_EQ(3600., opt.getLifecycleTimeScale());
+    EXPECT_EQ(30, opt.getLifecycleRebootStorm());
+
+    // Malformed mixes.
+    EXPECT_THROW(process(opt, "perfdhcp -R 100 --scenario lifecycle"
+                         " --lifecycle-mix renew -l 127.0.0.1 all"),
+                 isc::InvalidParameter);
+    EXPECT_THROW(process(opt, "perfdhcp -R 100 --scenario lifecycle"
+                         " --lifecycle-mix expire=1 -l 127.0.0.1 all"),
+                 isc::InvalidParameter);
+    EXPECT_THROW(process(opt, "perfdhcp -R 100 --scenario lifecycle"
+                         " --lifecycle-mix renew=-1 -l 127.0.0.1 all"),
+                 isc::InvalidParameter);
+    EXPECT_THROW(process(opt, "perfdhcp -R 100 --scenario lifecycle"
+                         " --lifecycle-mix renew=0 -l 127.0.0.1 all"),
+                 isc::InvalidParameter);
+
+    // Timers.
+    EXPECT_THROW(process(opt, "perfdhcp -R 100 --scenario lifecycle"
+                         " --lifecycle-time-scale 0 -l 127.0.0.1 all"),
+                 isc::InvalidParameter);
+    EXPECT_THROW(process(opt, "perfdhcp -R 100 --scenario lifecycle"
+                         " --lifecycle-reboot-storm 0 -l 127.0.0.1 all"),
+                 isc::InvalidParameter);
+
+    // The lifecycle scenario simulates a number of DHCPv4 clients
+    // through their own leases.
+    EXPECT_THROW(process(opt, "perfdhcp --scenario lifecycle"
+                         " -l 127.0.0.1 all"),
+                 isc::InvalidParameter);
+    EXPECT_THROW(process(opt, "perfdhcp -6 -R 100 --scenario lifecycle"
+                         " -l ::1 all"),
+                 isc::InvalidParameter);
+    EXPECT_THROW(process(opt, "perfdhcp -i -R 100 --scenario lifecycle"
+                         " -l 127.0.0.1 all"),
+                 isc::InvalidParameter);
+    EXPECT_THROW(process(opt, "perfdhcp -f 10 -R 100 --scenario lifecycle"
+                         " -l 127.0.0.1 all"),
+                 isc::InvalidParameter);
+}
@@ -0,0 +1,134 @@
+// Copyright (C) 2026 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <exceptions/exceptions.h>
+#include <perfdhcp/latency_histogram.h>
+
+#include <gtest/gtest.h>
+
+#include <limits>
+
+using namespace isc;
+using namespace isc::perfdhcp;
+
+namespace {
+
+// Check that the buckets cover all values without gaps and that their
+// width stays within the expected precision.
+TEST(LatencyHistogramTest, buckets) {
+    // Small values have their own bucket.
+    for (uint64_t value = 0; value < LatencyHistogram::SUB_BUCKETS; ++value) {
+        EXPECT_EQ(value, LatencyHistogram::getBucketIndex(value));
+        EXPECT_EQ(value, LatencyHistogram::getBucketLowest(value));
+        EXPECT_EQ(value, LatencyHistogram::getBucketHighest(value));
+    }
+
+    // Consecutive buckets are contiguous.
+    size_t const last =
+        LatencyHistogram::getBucketIndex(std::numeric_limits<uint64_t>::max());
+    for (size_t index = 1; index <= last; ++index) {
+        uint64_t const lowest = LatencyHistogram::getBucketLowest(index);
+        uint64_t const highest = LatencyHistogram::getBucketHighest(index);
+        ASSERT_EQ(LatencyHistogram::getBucketHighest(index - 1) + 1, lowest)
+            << "index " << index;
+        ASSERT_LE(lowest, highest);
+        EXPECT_EQ(index, LatencyHistogram::getBucketIndex(lowest));
+        EXPECT_EQ(index, LatencyHistogram::getBucketIndex(highest));
+        // The width of a bucket is at most 1/64 of its values.
+        EXPECT_LE((highest - lowest) * 64, lowest);
+    }
+    EXPECT_EQ(std::numeric_limits<uint64_t>::max(),
+              LatencyHistogram::getBucketHighest(last));
+}
+
+// Check the statistics of an empty histogram.
+TEST(LatencyHistogramTest, empty) {
+    LatencyHistogram histogram;
+    EXPECT_EQ(0U, histogram.getCount());
+    EXPECT_EQ(0U, histogram.getMin());
+    EXPECT_EQ(0U, histogram.getMax());
+    EXPECT_EQ(0., histogram.getMean());
+    EXPECT_EQ(0U, histogram.getPercentile(99.));
+    EXPECT_TRUE(histogram.getBuckets().empty());
+    EXPECT_THROW(histogram.getPercentile(-1.), BadValue);
+    EXPECT_THROW(histogram.getPercentile(100.1), BadValue);
+}
+
+// Check the statistics of recorded values.
+TEST(LatencyHistogramTest, record) {
+    LatencyHistogram histogram;
+    // 1000 values from 1 to 1000 us and one outlier at 1 s.
+    for (uint64_t value = 1; value <= 1000; ++value) {
+        histogram.record(value);
+    }
+    histogram.recordSeconds(1.);
+    EXPECT_EQ(1001U, histogram.getCount());
+    EXPECT_EQ(1U, histogram.getMin());
+    EXPECT_EQ(1000000U, histogram.getMax());
+    EXPECT_NEAR((500500. + 1000000.) / 1001., histogram.getMean(), 1e-6);
+
+    // Percentiles are exact for small values and within the bucket
+    // precision otherwise.
+    EXPECT_EQ(1U, histogram.getPercentile(0.));
+    EXPECT_EQ(101U, histogram.getPercentile(10.));
+    EXPECT_NEAR(501., histogram.getPercentile(50.), 501. / 64.);
+    EXPECT_NEAR(991., histogram.getPercentile(99.), 991. / 64.);
+    EXPECT_EQ(1000000U, histogram.getPercentile(99.95));
+    EXPECT_EQ(1000000U, histogram.getPercentile(100.));
+
+    // Buckets are ordered and sum up to the count.
+    uint64_t count = 0;
+    uint64_t previous = 0;
+    for (auto const& bucket : histogram.getBuckets()) {
+        EXPECT_LE(previous, bucket.first);
+        previous = bucket.first;
+        count += bucket.second;
+    }
+    EXPECT_EQ(1001U, count);
+
+    // Negative delays are recorded as 0.
+    histogram.recordSeconds(-1.);
+    EXPECT_EQ(0U, histogram.getMin());
+
+    histogram.reset();
+    EXPECT_EQ(0U, histogram.getCount());
+    EXPECT_EQ(0U, histogram.getMax());
+    EXPECT_TRUE(histogram.getBuckets().empty());
+}
+
+// Check that merging histograms gives the same result as recording all
+// values in one histogram.
+TEST(LatencyHistogramTest, merge) {
+    LatencyHistogram all;
+    LatencyHistogram low;
+    LatencyHistogram high;
+    for (uint64_t value = 0; value < 5000; value += 7) {
+        all.record(value);
+        if (value < 2000) {
+            low.record(value);
+        } else {
+            high.record(value);
+        }
+    }
+    low.merge(high);
+    EXPECT_EQ(all.getCount(), low.getCount());
+    EXPECT_EQ(all.getMin(), low.getMin());
+    EXPECT_EQ(all.getMax(), low.getMax());
+    EXPECT_EQ(all.getMean(), low.getMean());
+    EXPECT_EQ(all.getPercentile(50.), low.getPercentile(50.));
+    EXPECT_EQ(all.getPercentile(99.9), low.getPercentile(99.9));
+    EXPECT_EQ(all.getBuckets(), low.getBuckets());
+
+    // Merging an empty histogram changes nothing.
+    LatencyHistogram empty;
+    low.merge(empty);
+    EXPECT_EQ(all.getMin(), low.getMin());
+    EXPECT_EQ(all.getBuckets(), low.getBuckets());
+}
+
+}
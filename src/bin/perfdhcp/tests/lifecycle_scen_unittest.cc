@@ -0,0 +1,265 @@
+// Copyright (C) 2026 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include "command_options_helper.h"
+#include "../lifecycle_scen.h"
+
+#include <asiolink/io_address.h>
+#include <exceptions/exceptions.h>
+#include <dhcp/dhcp4.h>
+#include <dhcp/pkt4.h>
+#include <dhcp/iface_mgr.h>
+
+#include <list>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <gtest/gtest.h>
+
+using namespace std;
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::dhcp;
+using namespace isc::perfdhcp;
+
+/// \brief FakeLifecycleScenPerfSocket class that mocks PerfSocket.
+///
+/// It stubs send and receive operations, collects statistics and
+/// simulates a DHCPv4 server granting leases with a renewal time of
+/// 1 second.
+class FakeLifecycleScenPerfSocket: public BasePerfSocket {
+public:
+    /// \brief Default constructor for FakeLifecycleScenPerfSocket.
+    FakeLifecycleScenPerfSocket() :
+        iface_(boost::make_shared<Iface>("fake", 0)),
+        nak_reboots_(false),
+        without_rai_cnt_(0) {};
+
+    IfacePtr iface_;  ///< Local fake interface.
+
+    /// Answer INIT-REBOOT requests with a DHCPNAK.
+    bool nak_reboots_;
+
+    /// Number of sent packets per message type.
+    std::map<uint8_t, int> sent_cnt_;
+
+    /// Relay addresses of the sent packets.
+    std::set<std::string> giaddrs_;
+
+    /// Number of sent packets without a relay agent information option.
+    int without_rai_cnt_;
+
+    /// Responses planned to send to perfdhcp.
+    std::list<Pkt4Ptr> planned_responses_;
+
+    /// \brief Simulate receiving DHCPv4 packet.
+    virtual dhcp::Pkt4Ptr receive4(uint32_t /* timeout_sec */,
+                                   uint32_t /* timeout_usec */) override {
+        if (planned_responses_.empty()) {
+            return (Pkt4Ptr());
+        }
+        Pkt4Ptr pkt = planned_responses_.front();
+        planned_responses_.pop_front();
+        pkt->updateTimestamp();
+        return (pkt);
+    };
+
+    /// \brief Simulate receiving DHCPv6 packet.
+    virtual dhcp::Pkt6Ptr receive6(uint32_t /* timeout_sec */,
+                                   uint32_t /* timeout_usec */) override {
+        return (Pkt6Ptr());
+    };
+
+    /// \brief Simulate sending DHCPv4 packet.
+    virtual bool send(const dhcp::Pkt4Ptr& pkt) override {
+        pkt->updateTimestamp();
+        ++sent_cnt_[pkt->getType()];
+        giaddrs_.insert(pkt->getGiaddr().toText());
+        if (!pkt->getOption(DHO_DHCP_AGENT_OPTIONS)) {
+            ++without_rai_cnt_;
+        }
+        uint8_t response_type = 0;
+        if (pkt->getType() == DHCPDISCOVER) {
+            response_type = DHCPOFFER;
+        } else if (pkt->getType() == DHCPREQUEST) {
+            // An INIT-REBOOT request has no server identifier and no
+            // client address.
+            bool const reboot = pkt->getCiaddr().isV4Zero() &&
+                !pkt->getOption(DHO_DHCP_SERVER_IDENTIFIER);
+            response_type = (reboot && nak_reboots_) ? DHCPNAK : DHCPACK;
+        } else {
+            return (true);
+        }
+        Pkt4Ptr response(new Pkt4(response_type, pkt->getTransid()));
+        if (response_type != DHCPNAK) {
+            response->setYiaddr(IOAddress("192.0.2.1"));
+            OptionBuffer lease_time = { 0, 0, 0, 2 };
+            response->addOption(Option::factory(Option::V4,
+                                                DHO_DHCP_LEASE_TIME,
+                                                lease_time));
+            OptionBuffer renew_time = { 0, 0, 0, 1 };
+            response->addOption(Option::factory(Option::V4,
+                                                DHO_DHCP_RENEWAL_TIME,
+                                                renew_time));
+        }
+        response->addOption(Option::factory(Option::V4,
+                                            DHO_DHCP_SERVER_IDENTIFIER,
+                                            OptionBuffer(4, 1)));
+        planned_responses_.push_back(response);
+        return (true);
+    };
+
+    /// \brief Simulate sending DHCPv6 packet.
+    virtual bool send(const dhcp::Pkt6Ptr& /* pkt */) override {
+        return (false);
+    };
+
+    /// \brief Override getting interface.
+    virtual IfacePtr getIface() override { return iface_; }
+};
+
+
+/// \brief NakedLifecycleScen class.
+///
+/// It exposes LifecycleScen internals for UT.
+class NakedLifecycleScen: public LifecycleScen {
+public:
+    using LifecycleScen::tc_;
+
+    FakeLifecycleScenPerfSocket fake_sock_;
+
+    NakedLifecycleScen(CommandOptions &opt) : LifecycleScen(opt, fake_sock_) {};
+};
+
+
+/// \brief Test Fixture Class
+///
+/// This test fixture class is used to perform
+/// unit tests on perfdhcp LifecycleScen class.
+class LifecycleScenTest : public virtual ::testing::Test
+{
+public:
+    LifecycleScenTest() { }
+
+    /// \brief Parse command line string with CommandOptions.
+    ///
+    /// \param cmdline command line string to be parsed.
+    /// \throw isc::Unexpected if unexpected error occurred.
+    /// \throw isc::InvalidParameter if command line is invalid.
+    void processCmdLine(CommandOptions &opt, const std::string& cmdline) const {
+        CommandOptionsHelper::process(opt, cmdline);
+    }
+
+    /// \brief Get full path to a file in testdata directory.
+    ///
+    /// \param filename filename being appended to absolute
+    /// path to testdata directory
+    ///
+    /// \return full path to a file in testdata directory.
+    std::string getFullPath(const std::string& filename) const {
+        std::ostringstream stream;
+        stream << TEST_DATA_DIR << "/" << filename;
+        return (stream.str());
+    }
+};
+
+
+TEST_F(LifecycleScenTest, Renew) {
+    CommandOptions opt;
+    // Leases are renewed every 1/10 second.
+    processCmdLine(opt, "perfdhcp -l fake -4 -R 10 -p 1 --scenario lifecycle"
+                   " --lifecycle-time-scale 10 -g single 127.0.0.1");
+    NakedLifecycleScen ls(opt);
+
+    ls.run();
+
+    // Each client got its lease once then renewed it.
+    const StatsMgr& stats_mgr = ls.tc_.getStatsMgr();
+    EXPECT_EQ(10U, stats_mgr.getSentPacketsNum(ExchangeType::DO));
+    EXPECT_EQ(10U, stats_mgr.getRcvdPacketsNum(ExchangeType::DO));
+    EXPECT_EQ(10U, stats_mgr.getSentPacketsNum(ExchangeType::RA));
+    EXPECT_EQ(10U, stats_mgr.getRcvdPacketsNum(ExchangeType::RA));
+    EXPECT_GE(stats_mgr.getRcvdPacketsNum(ExchangeType::RNA), 10U);
+    EXPECT_EQ(stats_mgr.getSentPacketsNum(ExchangeType::RNA),
+              ls.getEventsNum(LifecycleEvent::RENEW));
+    EXPECT_EQ(0U, ls.getEventsNum(LifecycleEvent::RELEASE));
+    EXPECT_EQ(10U, ls.getClientsNum(LifecycleScen::State::BOUND) +
+                   ls.getClientsNum(LifecycleScen::State::RENEWING));
+    EXPECT_EQ(0, ls.fake_sock_.without_rai_cnt_);
+}
+
+
+TEST_F(LifecycleScenTest, EventMix) {
+    CommandOptions opt;
+    processCmdLine(opt, "perfdhcp -l fake -4 -R 20 -p 1 --scenario lifecycle"
+                   " --lifecycle-time-scale 20 --lifecycle-mix"
+                   " release=1,decline=1,reboot=1,roam=1 -J " +
+                   getFullPath("relay4-list.txt") + " -g single 127.0.0.1");
+    NakedLifecycleScen ls(opt);
+
+    ls.run();
+
+    // All the events of the mix happened.
+    EXPECT_EQ(0U, ls.getEventsNum(LifecycleEvent::RENEW));
+    EXPECT_EQ(0U, ls.getEventsNum(LifecycleEvent::REBIND));
+    EXPECT_GT(ls.getEventsNum(LifecycleEvent::RELEASE), 0U);
+    EXPECT_GT(ls.getEventsNum(LifecycleEvent::DECLINE), 0U);
+    EXPECT_GT(ls.getEventsNum(LifecycleEvent::REBOOT), 0U);
+    EXPECT_GT(ls.getEventsNum(LifecycleEvent::ROAM), 0U);
+    const StatsMgr& stats_mgr = ls.tc_.getStatsMgr();
+    EXPECT_EQ(ls.getEventsNum(LifecycleEvent::RELEASE),
+              stats_mgr.getSentPacketsNum(ExchangeType::RLA));
+    EXPECT_EQ(ls.getEventsNum(LifecycleEvent::RELEASE),
+              static_cast<uint64_t>(ls.fake_sock_.sent_cnt_[DHCPRELEASE]));
+    EXPECT_EQ(ls.getEventsNum(LifecycleEvent::DECLINE),
+              static_cast<uint64_t>(ls.fake_sock_.sent_cnt_[DHCPDECLINE]));
+    EXPECT_EQ(0U, stats_mgr.getSentPacketsNum(ExchangeType::RNA));
+
+    // Clients are spread over the relays.
+    EXPECT_EQ(5U, ls.fake_sock_.giaddrs_.size());
+    EXPECT_EQ(0, ls.fake_sock_.without_rai_cnt_);
+}
+
+
+TEST_F(LifecycleScenTest, RebootNak) {
+    CommandOptions opt;
+    processCmdLine(opt, "perfdhcp -l fake -4 -R 10 -p 1 --scenario lifecycle"
+                   " --lifecycle-time-scale 10 --lifecycle-mix reboot=1"
+                   " -g single 127.0.0.1");
+    NakedLifecycleScen ls(opt);
+    ls.fake_sock_.nak_reboots_ = true;
+
+    ls.run();
+
+    // Clients whose INIT-REBOOT is NAKed get a new lease.
+    const StatsMgr& stats_mgr = ls.tc_.getStatsMgr();
+    EXPECT_GT(ls.getEventsNum(LifecycleEvent::REBOOT), 0U);
+    EXPECT_GT(stats_mgr.getSentPacketsNum(ExchangeType::DO), 10U);
+    EXPECT_GT(stats_mgr.getRcvdPacketsNum(ExchangeType::RA), 10U);
+    EXPECT_EQ(0U, ls.getClientsNum(LifecycleScen::State::REBINDING));
+}
+
+
+TEST_F(LifecycleScenTest, RebootStorm) {
+    CommandOptions opt;
+    // Leases are renewed every 100 seconds so only the storm happens.
+    processCmdLine(opt, "perfdhcp -l fake -4 -R 10 -p 2 --scenario lifecycle"
+                   " --lifecycle-time-scale 0.01 --lifecycle-reboot-storm 1"
+                   " -g single 127.0.0.1");
+    NakedLifecycleScen ls(opt);
+
+    ls.run();
+
+    EXPECT_EQ(0U, ls.getEventsNum(LifecycleEvent::RENEW));
+    EXPECT_EQ(10U, ls.getEventsNum(LifecycleEvent::REBOOT));
+    const StatsMgr& stats_mgr = ls.tc_.getStatsMgr();
+    EXPECT_EQ(20U, stats_mgr.getSentPacketsNum(ExchangeType::RA));
+    EXPECT_EQ(20U, stats_mgr.getRcvdPacketsNum(ExchangeType::RA));
+    EXPECT_EQ(10U, ls.getClientsNum(LifecycleScen::State::BOUND));
+}
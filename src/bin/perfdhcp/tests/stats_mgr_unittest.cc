@@ -10,6 +10,7 @@
 
 #include <perfdhcp/stats_mgr.h>
 
+#include <cc/data.h>
 #include <exceptions/exceptions.h>
 #include <dhcp/dhcp4.h>
 #include <dhcp/dhcp6.h>
@@ -24,6 +25,7 @@
 
 using namespace std;
 using namespace isc;
+using namespace isc::data;
 using namespace isc::dhcp;
 using namespace isc::perfdhcp;
 
@@ -531,6 +533,159 @@ TEST_F(StatsMgrTest, CustomCounters) {
 
 }
 
+TEST_F(StatsMgrTest, Merge) {
+    CommandOptions opt;
+    boost::shared_ptr<StatsMgr> stats_mgr(new StatsMgr(opt));
+    boost::shared_ptr<StatsMgr> other(new StatsMgr(opt));
+    stats_mgr->addExchangeStats(ExchangeType::DO);
+    other->addExchangeStats(ExchangeType::DO);
+    stats_mgr->addCustomCounter("toolate", "Packets sent too late");
+    other->addCustomCounter("toolate", "Packets sent too late");
+    other->addCustomCounter("tooshort", "Too short packets");
+
+    // Two exchanges with a delay of 2s in the first manager, one exchange
+    // with a delay of 1s and an orphan in the other.
+    passDOPacketsWithDelay(stats_mgr, 2, common_transid);
+    passDOPacketsWithDelay(stats_mgr, 2, common_transid + 1);
+    passDOPacketsWithDelay(other, 1, common_transid);
+    boost::shared_ptr<Pkt4> orphan(createPacket4(DHCPOFFER, 1000));
+    ASSERT_NO_THROW(other->passRcvdPacket(ExchangeType::DO, orphan));
+    stats_mgr->incrementCounter("toolate");
+    other->incrementCounter("toolate", 2);
+    other->incrementCounter("tooshort");
+
+    ASSERT_NO_THROW(stats_mgr->merge(*other));
+    EXPECT_EQ(3U, stats_mgr->getSentPacketsNum(ExchangeType::DO));
+    EXPECT_EQ(4U, stats_mgr->getRcvdPacketsNum(ExchangeType::DO));
+    EXPECT_EQ(1U, stats_mgr->getOrphans(ExchangeType::DO));
+    EXPECT_GT(stats_mgr->getMinDelay(ExchangeType::DO), 0.9);
+    EXPECT_LT(stats_mgr->getMinDelay(ExchangeType::DO), 1.9);
+    EXPECT_GT(stats_mgr->getMaxDelay(ExchangeType::DO), 1.9);
+    EXPECT_GT(stats_mgr->getStdDevDelay(ExchangeType::DO), 0);
+    EXPECT_EQ(3U, stats_mgr->getCounter("toolate")->getValue());
+    EXPECT_EQ(1U, stats_mgr->getCounter("tooshort")->getValue());
+
+    // The other manager is left unchanged.
+    EXPECT_EQ(1U, other->getSentPacketsNum(ExchangeType::DO));
+
+    // Exchanges not tracked by the manager can't be merged.
+    boost::shared_ptr<StatsMgr> other_type(new StatsMgr(opt));
+    other_type->addExchangeStats(ExchangeType::RA);
+    EXPECT_THROW(stats_mgr->merge(*other_type), isc::BadValue);
+}
+
+TEST_F(StatsMgrTest, DelayPercentiles) {
+    CommandOptions opt;
+    boost::shared_ptr<StatsMgr> stats_mgr(new StatsMgr(opt));
+    stats_mgr->addExchangeStats(ExchangeType::DO);
+
+    // No packets received yet.
+    EXPECT_THROW(stats_mgr->getDelayPercentile(ExchangeType::DO, 50.),
+                 isc::InvalidOperation);
+
+    // 98 exchanges of 1s and 2 of 2s.
+    for (uint32_t transid = 0; transid < 100; ++transid) {
+        passDOPacketsWithDelay(stats_mgr, transid < 98 ? 1 : 2, transid);
+    }
+    const ExchangeType xchg = ExchangeType::DO;
+    EXPECT_EQ(100U, stats_mgr->getDelays(xchg).getCount());
+    // Percentiles are within the precision of the histogram.
+    EXPECT_NEAR(1., stats_mgr->getDelayPercentile(xchg, 50.), 1. / 64.);
+    EXPECT_NEAR(1., stats_mgr->getDelayPercentile(xchg, 98.), 1. / 64.);
+    EXPECT_NEAR(2., stats_mgr->getDelayPercentile(xchg, 99.), 2. / 64.);
+
+    // The interval delays are reset after each intermediate report.
+    EXPECT_EQ(100U, stats_mgr->getIntervalDelays(xchg).getCount());
+    stats_mgr->resetIntervalStats();
+    EXPECT_EQ(0U, stats_mgr->getIntervalDelays(xchg).getCount());
+    EXPECT_EQ(100U, stats_mgr->getDelays(xchg).getCount());
+    passDOPacketsWithDelay(stats_mgr, 1, 100);
+    EXPECT_EQ(1U, stats_mgr->getIntervalDelays(xchg).getCount());
+}
+
+TEST_F(StatsMgrTest, WriteReport) {
+    CommandOptions opt;
+    boost::shared_ptr<StatsMgr> stats_mgr(new StatsMgr(opt));
+    stats_mgr->addExchangeStats(ExchangeType::DO);
+    passDOPacketsWithDelay(stats_mgr, 1, common_transid);
+    boost::shared_ptr<Pkt4> sent_packet(createPacket4(DHCPDISCOVER,
+                                                      common_transid + 1));
+    stats_mgr->passSentPacket(ExchangeType::DO, sent_packet);
+
+    // The final JSON report includes the histogram.
+    std::ostringstream json;
+    stats_mgr->writeReport(json, StatsFormat::JSON, true);
+    ConstElementPtr report;
+    ASSERT_NO_THROW(report = Element::fromJSON(json.str()));
+    EXPECT_EQ("final", report->get("report")->stringValue());
+    ConstElementPtr exchanges = report->get("exchanges");
+    ASSERT_TRUE(exchanges);
+    ASSERT_EQ(1U, exchanges->size());
+    ConstElementPtr xchg = exchanges->get(0);
+    EXPECT_EQ("DISCOVER-OFFER", xchg->get("exchange")->stringValue());
+    EXPECT_EQ(2, xchg->get("sent")->intValue());
+    EXPECT_EQ(1, xchg->get("received")->intValue());
+    EXPECT_EQ(1, xchg->get("drops")->intValue());
+    EXPECT_EQ(1, xchg->get("delays")->intValue());
+    EXPECT_NEAR(1000., xchg->get("p99.9-delay")->doubleValue(), 1000. / 64.);
+    ConstElementPtr histogram = xchg->get("histogram");
+    ASSERT_TRUE(histogram);
+    ASSERT_EQ(1U, histogram->size());
+    EXPECT_EQ(1, histogram->get(0)->get(1)->intValue());
+
+    // Intermediate JSON reports don't.
+    json.str("");
+    stats_mgr->writeReport(json, StatsFormat::JSON, false);
+    ASSERT_NO_THROW(report = Element::fromJSON(json.str()));
+    EXPECT_EQ("interval", report->get("report")->stringValue());
+    EXPECT_FALSE(report->get("exchanges")->get(0)->get("histogram"));
+
+    // CSV reports have a line per exchange with the columns of the header.
+    std::ostringstream csv;
+    StatsMgr::writeCsvHeader(csv);
+    stats_mgr->writeReport(csv, StatsFormat::CSV, true);
+    std::istringstream lines(csv.str());
+    std::string header;
+    std::string line;
+    ASSERT_TRUE(std::getline(lines, header));
+    ASSERT_TRUE(std::getline(lines, line));
+    EXPECT_EQ(0U, header.find("report,time,exchange,sent,received,drops"));
+    EXPECT_EQ(0U, line.find("final,"));
+    EXPECT_NE(std::string::npos, line.find(",DISCOVER-OFFER,2,1,1,"));
+    EXPECT_EQ(std::count(header.begin(), header.end(), ','),
+              std::count(line.begin(), line.end(), ','));
+    EXPECT_FALSE(std::getline(lines, line));
+}
+
+TEST_F(StatsMgrTest, BoundedPending) {
+    boost::posix_time::ptime now =
+        boost::posix_time::microsec_clock::universal_time();
+    ExchangeStats xchg(ExchangeType::DO, 1., false, now, 3);
+
+    // Packets older than the drop time are collected when a packet is
+    // sent.
+    Pkt4ModifiablePtr old_packet(createPacket4(DHCPDISCOVER, 1));
+    old_packet->modifyTimestamp(-2);
+    xchg.appendSent(old_packet);
+    EXPECT_EQ(0U, xchg.getCollectedNum());
+    xchg.appendSent(PktPtr(createPacket4(DHCPDISCOVER, 2)));
+    EXPECT_EQ(1U, xchg.getCollectedNum());
+
+    // The oldest packets are collected when the list is full.
+    for (uint32_t transid = 3; transid < 7; ++transid) {
+        xchg.appendSent(PktPtr(createPacket4(DHCPDISCOVER, transid)));
+    }
+    EXPECT_EQ(3U, xchg.getCollectedNum());
+    EXPECT_EQ(6U, xchg.getSentPacketsNum());
+    auto sent = xchg.getSentPackets();
+    EXPECT_EQ(3, std::distance(std::get<0>(sent), std::get<1>(sent)));
+
+    // Collected packets are not matched anymore.
+    EXPECT_FALSE(xchg.matchPackets(PktPtr(createPacket4(DHCPOFFER, 2))));
+    EXPECT_TRUE(xchg.matchPackets(PktPtr(createPacket4(DHCPOFFER, 5))));
+    EXPECT_TRUE(xchg.matchPackets(PktPtr(createPacket4(DHCPOFFER, 4))));
+}
+
 TEST_F(StatsMgrTest, PrintStats) {
     std::cout << "This unit test is checking statistics printing "
               << "capabilities. It is expected that some counters "
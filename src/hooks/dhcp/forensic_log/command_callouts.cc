@@ -1,4 +1,4 @@
-// Copyright (C) 2017-2025 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2017-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -163,7 +163,7 @@ void addContext(ostringstream& os, ConstElementPtr& arguments) {
 bool checkLoggingEnabledSubnet4(ConstElementPtr& arguments) {
     // Check if the subnet identifier has been specified for the command.
     // In some cases it may be missing, i.e. lease4-del command, when deleting a
-    // lease by an IP address.
+    // lease by an IP address or lease4-bulk-apply command.
     int64_t subnet_id_value = 0;
     if (getOptionalInt(arguments, "subnet-id", subnet_id_value) && (subnet_id_value > 0)) {
         // The subnet identifier is present and valid.
@@ -180,14 +180,148 @@ bool checkLoggingEnabledSubnet4(ConstElementPtr& arguments) {
     return (true);
 }
 
+/// @brief Pointer to a function handling a single lease command.
+typedef int (*LeaseCmdHandler)(CalloutHandle&, string&, ConstElementPtr&,
+                               ConstElementPtr&);
+
+/// @brief Handle lease4-bulk-apply and lease6-bulk-apply commands.
+///
+/// Each deleted or added/updated lease which is not listed in the
+/// response as failed is logged as if it was conveyed in a separate
+/// delete or update command.
+///
+/// @param handle CalloutHandle which provides access to context.
+/// @param arguments The command arguments.
+/// @param response The command response.
+/// @param origin The command origin.
+/// @param del_name The name of the command deleting a single lease.
+/// @param update_name The name of the command updating a single lease.
+/// @param handler The function handling a single lease command.
+///
+/// @return 0 upon success, non-zero otherwise.
+/// @throw BadValue if the arguments or the response are malformed.
+int handleBulkApply(CalloutHandle& handle, ConstElementPtr& arguments,
+                    ConstElementPtr& response, const string& origin,
+                    const string& del_name, const string& update_name,
+                    LeaseCmdHandler handler) {
+    // At least one of the 'deleted-leases' or 'leases' must be present.
+    auto deleted_leases = arguments->get("deleted-leases");
+    auto leases = arguments->get("leases");
+
+    if (!deleted_leases && !leases) {
+        isc_throw(BadValue, "neither 'deleted-leases' nor 'leases' parameter"
+                  " specified");
+    }
+
+    // Make sure that 'deleted-leases' is a list, if present.
+    if (deleted_leases && (deleted_leases->getType() != Element::list)) {
+        isc_throw(BadValue, "the 'deleted-leases' parameter must be a list");
+    }
+
+    // Make sure that 'leases' is a list, if present.
+    if (leases && (leases->getType() != Element::list)) {
+        isc_throw(BadValue, "the 'leases' parameter must be a list");
+    }
+
+    ConstElementPtr failed_deleted_leases;
+    ConstElementPtr failed_leases;
+
+    auto response_args = response->get("arguments");
+
+    if (response_args) {
+        failed_deleted_leases = response_args->get("failed-deleted-leases");
+        failed_leases = response_args->get("failed-leases");
+    }
+
+    int status = 0;
+
+    if (deleted_leases) {
+        unordered_set<string> failed_deleted_leases_set;
+        if (failed_deleted_leases) {
+            // Make sure that 'failed-deleted-leases' is a list, if present.
+            if (failed_deleted_leases->getType() != Element::list) {
+                isc_throw(BadValue, "the 'failed-deleted-leases' parameter must be a list");
+            }
+            auto leases_list = failed_deleted_leases->listValue();
+
+            for (auto const& lease_params : leases_list) {
+                auto address = lease_params->get("ip-address");
+                if (address) {
+                    failed_deleted_leases_set.emplace(address->stringValue());
+                }
+            }
+        }
+
+        auto leases_list = deleted_leases->listValue();
+        for (auto const& lease_params : leases_list) {
+            auto address = lease_params->get("ip-address");
+            if (address && failed_deleted_leases_set.count(address->stringValue()) == 0) {
+                ElementPtr copy;
+                if (!origin.empty()) {
+                    copy = data::copy(lease_params);
+                    copy->set("origin", Element::create(origin));
+                } else {
+                    copy = lease_params;
+                }
+                ConstElementPtr args(copy);
+                ConstElementPtr resp;
+                string cmd_name(del_name);
+                int result = handler(handle, cmd_name, args, resp);
+                if (result) {
+                    status = result;
+                }
+            }
+        }
+    }
+
+    if (leases) {
+        unordered_set<string> failed_leases_set;
+        if (failed_leases) {
+            // Make sure that 'failed-leases' is a list, if present.
+            if (failed_leases->getType() != Element::list) {
+                isc_throw(BadValue, "the 'failed-leases' parameter must be a list");
+            }
+            auto leases_list = failed_leases->listValue();
+
+            for (auto const& lease_params : leases_list) {
+                auto address = lease_params->get("ip-address");
+                if (address) {
+                    failed_leases_set.emplace(address->stringValue());
+                }
+            }
+        }
+        auto leases_list = leases->listValue();
+        for (auto const& lease_params : leases_list) {
+            auto address = lease_params->get("ip-address");
+            if (address && failed_leases_set.count(address->stringValue()) == 0) {
+                ElementPtr copy;
+                if (!origin.empty()) {
+                    copy = data::copy(lease_params);
+                    copy->set("origin", Element::create(origin));
+                } else {
+                    copy = lease_params;
+                }
+                ConstElementPtr args(copy);
+                ConstElementPtr resp;
+                string cmd_name(update_name);
+                int result = handler(handle, cmd_name, args, resp);
+                if (result) {
+                    status = result;
+                }
+            }
+        }
+    }
+    return (status);
+}
+
 /// @brief Handle lease4 related commands.
 ///
 /// @param handle CalloutHandle which provides access to context.
 /// @param name The command name.
 /// @param arguments The command arguments.
-/// @param 4 The command response.
+/// @param response The command response.
 int handleLease4Cmds(CalloutHandle& handle, string& name, ConstElementPtr& arguments,
-                     ConstElementPtr& /*response*/) {
+                     ConstElementPtr& response) {
     if (!LegalLogMgrFactory::instance(handle.getCurrentLibrary())) {
         LOG_ERROR(legal_log_logger,
                   LEGAL_LOG_COMMAND_NO_LEGAL_STORE);
@@ -244,6 +378,10 @@ int handleLease4Cmds(CalloutHandle& handle, string& name, ConstElementPtr& argum
                    << SimpleParser::getString(arguments, "identifier-type")
                    << " of " << SimpleParser::getString(arguments, "identifier");
             }
+        } else if (name == "lease4-bulk-apply") {
+            return (handleBulkApply(handle, arguments, response, origin,
+                                    "lease4-del", "lease4-update",
+                                    handleLease4Cmds));
         }
 
         LegalLogMgrFactory::instance(handle.getCurrentLibrary())->writeln(os.str(), osa.str());
@@ -349,114 +487,9 @@ int handleLease6Cmds(CalloutHandle& handle, string& name, ConstElementPtr& argum
                    << " of " << SimpleParser::getString(arguments, "identifier");
             }
         } else if (name == "lease6-bulk-apply") {
-            // At least one of the 'deleted-leases' or 'leases' must be present.
-            auto deleted_leases = arguments->get("deleted-leases");
-            auto leases = arguments->get("leases");
-
-            if (!deleted_leases && !leases) {
-                isc_throw(BadValue, "neither 'deleted-leases' nor 'leases' parameter"
-                          " specified");
-            }
-
-            // Make sure that 'deleted-leases' is a list, if present.
-            if (deleted_leases && (deleted_leases->getType() != Element::list)) {
-                isc_throw(BadValue, "the 'deleted-leases' parameter must be a list");
-            }
-
-            // Make sure that 'leases' is a list, if present.
-            if (leases && (leases->getType() != Element::list)) {
-                isc_throw(BadValue, "the 'leases' parameter must be a list");
-            }
-
-            ConstElementPtr failed_deleted_leases;
-            ConstElementPtr failed_leases;
-
-            auto response_args = response->get("arguments");
-
-            if (response_args) {
-                failed_deleted_leases = response_args->get("failed-deleted-leases");
-                failed_leases = response_args->get("failed-leases");
-            }
-
-            int status = 0;
-
-            if (deleted_leases) {
-                unordered_set<string> failed_deleted_leases_set;
-                if (failed_deleted_leases) {
-                    // Make sure that 'failed-deleted-leases' is a list, if present.
-                    if (failed_deleted_leases->getType() != Element::list) {
-                        isc_throw(BadValue, "the 'failed-deleted-leases' parameter must be a list");
-                    }
-                    auto leases_list = failed_deleted_leases->listValue();
-
-                    for (auto const& lease_params : leases_list) {
-                        auto address = lease_params->get("ip-address");
-                        if (address) {
-                            failed_deleted_leases_set.emplace(address->stringValue());
-                        }
-                    }
-                }
-
-                auto leases_list = deleted_leases->listValue();
-                for (auto const& lease_params : leases_list) {
-                    auto address = lease_params->get("ip-address");
-                    if (address && failed_deleted_leases_set.count(address->stringValue()) == 0) {
-                        ElementPtr copy;
-                        if (!origin.empty()) {
-                            copy = data::copy(lease_params);
-                            copy->set("origin", Element::create(origin));
-                        } else {
-                            copy = lease_params;
-                        }
-                        ConstElementPtr args(copy);
-                        ConstElementPtr resp;
-                        string cmd_name("lease6-del");
-                        int result = handleLease6Cmds(handle, cmd_name, args, resp);
-                        if (result) {
-                            status = result;
-                        }
-                    }
-                }
-            }
-
-            if (leases) {
-                unordered_set<string> failed_leases_set;
-                if (failed_leases) {
-                    // Make sure that 'failed-leases' is a list, if present.
-                    if (failed_leases->getType() != Element::list) {
-                        isc_throw(BadValue, "the 'failed-leases' parameter must be a list");
-                    }
-                    auto leases_list = failed_leases->listValue();
-
-                    for (auto const& lease_params : leases_list) {
-                        auto address = lease_params->get("ip-address");
-                        if (address) {
-                            failed_leases_set.emplace(address->stringValue());
-                        }
-                    }
-                }
-                auto leases_list = leases->listValue();
-                for (auto const& lease_params : leases_list) {
-                    auto address = lease_params->get("ip-address");
-                    if (address && failed_leases_set.count(address->stringValue()) == 0) {
-                        ElementPtr copy;
-                        if (!origin.empty()) {
-                            copy = data::copy(lease_params);
-                            copy->set("origin", Element::create(origin));
-                        } else {
-                            copy = lease_params;
-                        }
-                        ConstElementPtr args(copy);
-                        ConstElementPtr resp;
-                        string cmd_name("lease6-update");
-                        int result = handleLease6Cmds(handle, cmd_name, args, resp);
-                        if (result) {
-                            status = result;
-                        }
-                    }
-                }
-            }
-            return (status);
+            return (handleBulkApply(handle, arguments, response, origin,
+                                    "lease6-del", "lease6-update",
+                                    handleLease6Cmds));
         }
 
         LegalLogMgrFactory::instance(handle.getCurrentLibrary())->writeln(os.str(), osa.str());
@@ -505,8 +538,8 @@ int command_processed(CalloutHandle& handle) {
 
         // We are only interested in the following commands.
         static unordered_set<string> const supported = {
-            "lease4-add", "lease4-update","lease4-del", "lease6-add",
-            "lease6-update", "lease6-del", "lease6-bulk-apply"
+            "lease4-add", "lease4-update","lease4-del", "lease4-bulk-apply",
+            "lease6-add", "lease6-update", "lease6-del", "lease6-bulk-apply"
         };
         if (supported.count(name) == 0) {
             return (0);
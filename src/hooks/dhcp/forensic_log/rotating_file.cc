@@ -15,6 +15,7 @@
 #include <boost/date_time/posix_time/posix_time.hpp>
 
 #include <errno.h>
+#include <functional>
 #include <iostream>
 #include <list>
 #include <set>
@@ -35,7 +36,8 @@ namespace legal_log {
 
 RotatingFile::RotatingFile(const DatabaseConnection::ParameterMap& parameters)
     : LegalLogMgr(parameters), time_unit_(TimeUnit::Day), count_(1),
-      timestamp_(0), mark_continuation_lines_(true) {
+      timestamp_(0), queue_size_(0), running_(false), csv_format_(false),
+      mark_continuation_lines_(true) {
     apply(parameters);
 }
 
@@ -45,6 +47,8 @@ RotatingFile::apply(const DatabaseConnection::ParameterMap& parameters) {
     string base("kea-legal");
     RotatingFile::TimeUnit unit(RotatingFile::TimeUnit::Day);
     int64_t count(1);
+    int64_t queue_size(0);
+    bool csv_format(false);
     string count_str;
     string prerotate;
     string postrotate;
@@ -85,6 +89,30 @@ RotatingFile::apply(const DatabaseConnection::ParameterMap& parameters) {
                     << numeric_limits<uint32_t>::max());
         }
     }
+    if (parameters.find("queue-size") != parameters.end()) {
+        try {
+            queue_size = boost::lexical_cast<int64_t>(parameters.at("queue-size"));
+        } catch (...) {
+            isc_throw(BadValue, "bad value: " << parameters.at("queue-size")
+                      << " for queue-size parameter");
+        }
+        if ((queue_size < 0) ||
+            (queue_size > numeric_limits<uint32_t>::max())) {
+            isc_throw(OutOfRange, "queue-size value: " << queue_size
+                    << " is out of range, expected value: 0.."
+                    << numeric_limits<uint32_t>::max());
+        }
+    }
+    if (parameters.find("output-format") != parameters.end()) {
+        string output_format(parameters.at("output-format"));
+
+        if (output_format == "csv") {
+            csv_format = true;
+        } else if (output_format != "text") {
+            isc_throw(BadValue, "unknown output format: " << output_format
+                      << ", expected one of: text, csv");
+        }
+    }
     if (parameters.find("prerotate") != parameters.end()) {
         prerotate = parameters.at("prerotate");
     }
@@ -100,6 +128,8 @@ RotatingFile::apply(const DatabaseConnection::ParameterMap& parameters) {
     base_name_ = base;
     time_unit_ = unit;
     count_ = static_cast<uint32_t>(count);
+    queue_size_ = static_cast<size_t>(queue_size);
+    csv_format_ = csv_format;
     prerotate_ = prerotate;
     postrotate_ = postrotate;
 
@@ -283,12 +313,18 @@ RotatingFile::useExistingFiles(struct tm& time_info) {
 
 void
 RotatingFile::open() {
-    if (isOpen() || MultiThreadingMgr::instance().isTestMode()) {
+    if (MultiThreadingMgr::instance().isTestMode()) {
         return;
     }
 
-    struct tm current_time_info = currentTimeInfo();
-    openInternal(current_time_info, true);
+    if (!isOpen()) {
+        struct tm current_time_info = currentTimeInfo();
+        openInternal(current_time_info, true);
+    }
+
+    if (queue_size_ && !writer_) {
+        startWriter();
+    }
 }
 
 void
@@ -357,7 +393,7 @@ RotatingFile::rotate() {
     }
 
     if (rotate_file) {
-        close();
+        closeFile();
 
         if (!prerotate_.empty()) {
             ProcessArgs args;
@@ -378,42 +414,97 @@ RotatingFile::rotate() {
 }
 
 void
-RotatingFile::writeln(const string& text, const string&) {
-    if (util::MultiThreadingMgr::instance().getMode()) {
+RotatingFile::writeln(const string& text, const string& addr) {
+    if (writer_) {
+        if (text.empty()) {
+            return;
+        }
+
+        // The record is formatted here so it gets the time of the event.
+        string record = format(text, addr, getNowString());
+
+        unique_lock<mutex> lock(queue_mutex_);
+        space_cv_.wait(lock, [this]() {
+            return (!running_ || (queue_.size() < queue_size_));
+        });
+        if (running_) {
+            queue_.push_back(std::move(record));
+            queue_cv_.notify_one();
+            return;
+        }
+        // The writer is being stopped: write the record directly.
+    }
+
+    if (util::MultiThreadingMgr::instance().getMode() || writer_) {
         lock_guard<mutex> lock(mutex_);
-        writelnInternal(text);
+        writelnInternal(text, addr);
     } else {
-        writelnInternal(text);
+        writelnInternal(text, addr);
     }
 }
 
 void
-RotatingFile::writelnInternal(const string& text) {
+RotatingFile::writelnInternal(const string& text, const string& addr) {
     if (text.empty()) {
         return;
     }
 
-    // Call rotate in case we've crossed days since we last wrote.
-    rotate();
+    writeRecords(vector<string>(1, format(text, addr, getNowString())));
+}
+
+string
+RotatingFile::format(const string& text, const string& addr,
+                     const string& timestamp) const {
+    if (csv_format_) {
+        string record;
+        for (auto const& field : { &timestamp, &addr, &text }) {
+            if (!record.empty()) {
+                record += ",";
+            }
+            record += "\"";
+            for (auto const c : *field) {
+                if (c == '"') {
+                    record += "\"";
+                }
+                record += c;
+            }
+            record += "\"";
+        }
+        record += "\n";
+        return (record);
+    }
 
-    string timestamp = getNowString();
     stringstream ss(text);
     // Collect lines.
     list<string> lines;
     for (string line; getline(ss, line, '\n');) {
         lines.push_back(line);
     }
+    string record;
     while (!lines.empty()) {
         string line = lines.front();
         lines.pop_front();
-        file_ << timestamp;
+        record += timestamp;
         if (mark_continuation_lines_ && !lines.empty()) {
-            file_ << "-";
+            record += "-";
         } else {
-            file_ << " ";
+            record += " ";
         }
-        file_ << line << endl;
+        record += line;
+        record += "\n";
+    }
+    return (record);
+}
+
+void
+RotatingFile::writeRecords(const vector<string>& records) {
+    // Call rotate in case we've crossed days since we last wrote.
+    rotate();
+
+    for (auto const& record : records) {
+        file_ << record;
     }
+    file_.flush();
     int sav_error = errno;
     if (!file_.good()) {
         isc_throw(LegalLogMgrError, "error writing to file:" << file_name_
@@ -421,6 +512,60 @@ RotatingFile::writelnInternal(const string& text) {
     }
 }
 
+void
+RotatingFile::startWriter() {
+    {
+        lock_guard<mutex> lock(queue_mutex_);
+        running_ = true;
+    }
+    queue_.reserve(queue_size_);
+    writer_.reset(new thread(std::bind(&RotatingFile::run, this)));
+}
+
+void
+RotatingFile::stopWriter() {
+    if (!writer_) {
+        return;
+    }
+    {
+        lock_guard<mutex> lock(queue_mutex_);
+        running_ = false;
+    }
+    queue_cv_.notify_all();
+    space_cv_.notify_all();
+    writer_->join();
+    writer_.reset();
+}
+
+void
+RotatingFile::run() {
+    vector<string> records;
+    records.reserve(queue_size_);
+    for (;;) {
+        {
+            unique_lock<mutex> lock(queue_mutex_);
+            queue_cv_.wait(lock, [this]() {
+                return (!running_ || !queue_.empty());
+            });
+            if (queue_.empty()) {
+                // Stopped and all records written.
+                return;
+            }
+            records.swap(queue_);
+        }
+        space_cv_.notify_all();
+
+        try {
+            lock_guard<mutex> lock(mutex_);
+            writeRecords(records);
+        } catch (const exception& ex) {
+            LOG_ERROR(legal_log_logger, LEGAL_LOG_STORE_WRITE_ERROR)
+                .arg(records.size()).arg(ex.what());
+        }
+        records.clear();
+    }
+}
+
 bool
 RotatingFile::isOpen() const {
     return (file_.is_open());
@@ -428,6 +573,12 @@ RotatingFile::isOpen() const {
 
 void
 RotatingFile::close() {
+    stopWriter();
+    closeFile();
+}
+
+void
+RotatingFile::closeFile() {
     try {
         if (file_.is_open()) {
             LOG_INFO(legal_log_logger, LEGAL_LOG_STORE_CLOSED)
@@ -9,7 +9,12 @@
 
 #include <dhcpsrv/legal_log_mgr_factory.h>
 
+#include <boost/shared_ptr.hpp>
+
+#include <condition_variable>
 #include <mutex>
+#include <thread>
+#include <vector>
 
 /// @file rotating_file.h Defines the class, RotatingFile, which implements
 /// an appending text file that rotates to a new file on a daily basis.
@@ -43,7 +48,16 @@ namespace legal_log {
 ///
 /// Content is added to the file by passing the desired line text into
 /// the method, writeln().  This method prepends the content  with the current
-/// date and time and appends an EOL.
+/// date and time and appends an EOL. When the output format is CSV each
+/// record is instead written as one row with the quoted timestamp,
+/// address and text fields.
+///
+/// When the queue size is not zero, writeln() only formats the record,
+/// using the timestamp of the call, and appends it to a bounded queue.
+/// A background thread started by open() takes all queued records at
+/// once and writes them with a single rotation check and a single flush.
+/// When the queue is full the callers wait for the writer: records are
+/// never dropped. close() writes all queued records before returning.
 ///
 /// The class implements virtual methods in facilitate unit testing
 /// and derives from @c LegalLogMgr abstract class.
@@ -76,6 +90,8 @@ public:
     ///       - postrotate
     ///       - count
     ///       - mark-continuation-lines
+    ///       - queue-size
+    ///       - output-format - one of: text, csv
     ///
     /// @param parameters A data structure relating keywords and values
     ///        concerned with the manager configuration.
@@ -121,6 +137,15 @@ public:
     /// lines so only the last line in a multiple line record gets a space
     /// (vs hyphen) after the leading timestamp.
     ///
+    /// @b queue-size - The maximum number of records waiting to be written
+    /// by the background writer. It defaults to 0 which disables the
+    /// background writer: records are written by the caller.
+    ///
+    /// @b output-format - The format of the records: "text" (default)
+    /// or "csv". With "csv" each record is a RFC 4180 row with the
+    /// timestamp, the address and the text, embedded EOLs being kept
+    /// in the quoted text field.
+    ///
     /// @param parameters The library parameters.
     void apply(const isc::db::DatabaseConnection::ParameterMap& parameters);
 
@@ -139,15 +164,16 @@ public:
     /// where CCYYMMDD is the current date in local time,
     ///
     /// and opens the file for appending. If the file does not exist
-    /// it is created.  If the file is already open, the method simply
-    /// returns.
+    /// it is created.  If the file is already open, the method only
+    /// starts the background writer when it is enabled and not running.
     ///
     /// @throw LegalLogMgrError if the file cannot be opened.
     virtual void open();
 
     /// @brief Closes the underlying file.
     ///
-    /// Method is exception safe.
+    /// Stops the background writer after it has written all queued
+    /// records. Method is exception safe.
     virtual void close();
 
     /// @brief Appends a string to the current file.
@@ -172,7 +198,16 @@ public:
     ///     "<timestamp>-<text2><EOL>"
     ///     "<timestamp>SP<text3><EOL>"
     ///
-    /// @param addr Address or prefix (ignored).
+    /// When the output format is CSV the content is:
+    ///
+    ///     "<timestamp>","<addr>","<text>"<EOL>
+    ///
+    /// with double quotes in the fields doubled.
+    ///
+    /// When the background writer is running the record is queued and
+    /// write errors are logged by the writer instead of being thrown.
+    ///
+    /// @param addr Address or prefix (used only by the CSV format).
     /// @param text String to append.
     ///
     /// @throw LegalLogMgrError if the write fails.
@@ -208,6 +243,20 @@ public:
         return (path_);
     }
 
+    /// @brief Returns the maximum number of queued records.
+    ///
+    /// @return The queue size (0 when the background writer is disabled).
+    size_t getQueueSize() const {
+        return (queue_size_);
+    }
+
+    /// @brief Returns the output format.
+    ///
+    /// @return "csv" or "text".
+    std::string getOutputFormat() const {
+        return (csv_format_ ? "csv" : "text");
+    }
+
     /// @brief Build the year-month-day string from a date.
     ///
     /// @param time_info The time info to be converted to string.
@@ -255,9 +304,50 @@ private:
     /// The caller must hold the mutex.
     ///
     /// @param text String to append.
+    /// @param addr Address or prefix.
     ///
     /// @throw LegalLogMgrError if the write fails.
-    void writelnInternal(const std::string& text);
+    void writelnInternal(const std::string& text, const std::string& addr);
+
+    /// @brief Formats a record.
+    ///
+    /// In the text format each line of the text is prefixed with the
+    /// timestamp and followed by EOL, continuation lines being marked
+    /// according to mark_continuation_lines_. In the CSV format the
+    /// record is a single row.
+    ///
+    /// @param text The record text.
+    /// @param addr The record address or prefix.
+    /// @param timestamp The record timestamp.
+    /// @return The formatted record.
+    std::string format(const std::string& text, const std::string& addr,
+                       const std::string& timestamp) const;
+
+    /// @brief Writes formatted records to the current file.
+    ///
+    /// Rotates the file if needed, writes the records and flushes the
+    /// file once. The caller must hold the mutex.
+    ///
+    /// @param records The formatted records.
+    ///
+    /// @throw LegalLogMgrError if the write fails.
+    void writeRecords(const std::vector<std::string>& records);
+
+    /// @brief Closes the underlying file without stopping the writer.
+    ///
+    /// Method is exception safe.
+    void closeFile();
+
+    /// @brief Starts the background writer.
+    void startWriter();
+
+    /// @brief Stops the background writer.
+    ///
+    /// Waits for the writer to write all queued records.
+    void stopWriter();
+
+    /// @brief Background writer thread function.
+    void run();
 
     /// @brief Directory in which the file(s) will be created.
     std::string path_;
@@ -291,6 +381,32 @@ private:
     /// @brief Mutex to protect output.
     std::mutex mutex_;
 
+    /// @brief The maximum number of queued records.
+    ///
+    /// @note 0 means the background writer is disabled.
+    size_t queue_size_;
+
+    /// @brief Formatted records waiting to be written.
+    std::vector<std::string> queue_;
+
+    /// @brief Mutex to protect the queue and the running flag.
+    std::mutex queue_mutex_;
+
+    /// @brief Condition variable signaled when records are queued.
+    std::condition_variable queue_cv_;
+
+    /// @brief Condition variable signaled when the queue is emptied.
+    std::condition_variable space_cv_;
+
+    /// @brief The background writer running flag.
+    bool running_;
+
+    /// @brief The background writer thread.
+    boost::shared_ptr<std::thread> writer_;
+
+    /// @brief The CSV output format flag.
+    bool csv_format_;
+
 protected:
     /// @brief The mark continuation lines flag.
     bool mark_continuation_lines_;
@@ -1,4 +1,4 @@
-// Copyright (C) 2017-2025 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2017-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -839,6 +839,55 @@ TEST_F(CalloutTest, responseWithErrorsLease6BulkApplyCommandEntries) {
     checkFileLines(genName(today()), today_now_string, lines);
 }
 
+// Verifies that each lease conveyed in the lease4-bulk-apply command
+// which is not reported as failed produces a log entry.
+TEST_F(CalloutTest, lease4BulkApplyCommandEntries) {
+    ASSERT_NO_THROW(LegalLogMgrFactory::instance().reset(new TestableRotatingFile(time_)));
+
+    // Make a callout handle
+    CalloutHandle handle(getCalloutManager());
+    handle.setCurrentLibrary(0);
+
+    string arguments_text =
+    "{\"origin\": \"ha-partner\", \"leases\": [{\"subnet-id\": 44,"
+    " \"ip-address\": \"192.0.2.1\", \"hw-address\": \"1a:1b:1c:1d:1e:1f\"},"
+    "{\"subnet-id\": 44, \"ip-address\": \"192.0.2.2\","
+    " \"hw-address\": \"2a:2b:2c:2d:2e:2f\"}],"
+    " \"deleted-leases\": [{\"ip-address\": \"192.0.2.3\"},"
+    "{\"ip-address\": \"192.0.2.4\"}]}";
+
+    // The second lease failed to update and the first lease failed to delete.
+    ElementPtr response_args = Element::fromJSON(
+    "{ \"failed-leases\": [{ \"ip-address\": \"192.0.2.2\","
+    " \"type\": \"V4\", \"result\": 1, \"error-message\": \"error\"}],"
+    " \"failed-deleted-leases\": [{ \"ip-address\": \"192.0.2.3\","
+    " \"type\": \"V4\", \"result\": 3, \"error-message\": \"lease not found\"}]}");
+    ConstElementPtr response = createAnswer(CONTROL_RESULT_SUCCESS, "", response_args);
+
+    handle.setArgument("name", string("lease4-bulk-apply"));
+    ConstElementPtr arguments;
+    ASSERT_NO_THROW(arguments = Element::fromJSON(arguments_text));
+    handle.setArgument("arguments", arguments);
+    handle.setArgument("response", response);
+
+    int ret;
+    ASSERT_NO_THROW(ret = command_processed(handle));
+    ASSERT_EQ(0, ret);
+
+    vector<string> lines = {
+        "HA partner deleted the lease for address: 192.0.2.4",
+        "HA partner updated information on the lease of address: 192.0.2.1"
+        " to a device with hardware address: 1a:1b:1c:1d:1e:1f"
+    };
+
+    // Close it to flush any unwritten data
+    LegalLogMgrFactory::instance()->close();
+
+    // Verify that the file content is correct.
+    string today_now_string = LegalLogMgrFactory::instance()->getNowString();
+    checkFileLines(genName(today()), today_now_string, lines);
+}
+
 // This test verifies that it is possible to disable logging for selected IPv4
 // subnets.
 TEST_F(CalloutTest, disableLoggingForSubnet4) {
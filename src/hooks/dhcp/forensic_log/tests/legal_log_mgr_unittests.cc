@@ -272,12 +272,26 @@ TEST_F(LegalLogMgrTest, parseExtraRotatingFileParameters) {
     params->set("count", Element::create(static_cast<int64_t>(1) << 32));
     EXPECT_THROW(LegalLogMgr::parseFile(params, map), OutOfRange);
 
-    params->set("time-unit", Element::create("year"));
     params->set("count", Element::create(1));
+    params->set("queue-size", Element::create(-1));
+    EXPECT_THROW(LegalLogMgr::parseFile(params, map), OutOfRange);
+
+    params->set("time-unit", Element::create("year"));
+    params->set("queue-size", Element::create(1000));
+    params->set("output-format", Element::create(0));
+    EXPECT_THROW(LegalLogMgr::parseFile(params, map), TypeError);
+
+    params->set("output-format", Element::create("binary"));
+    EXPECT_NO_THROW(LegalLogMgr::parseFile(params, map));
+    EXPECT_THROW(rotating_file.apply(map), BadValue);
+
+    params->set("output-format", Element::create("csv"));
     params->set("prerotate", Element::create(FORENSIC_PREROTATE_TEST_SH));
     params->set("postrotate", Element::create(FORENSIC_POSTROTATE_TEST_SH));
     EXPECT_NO_THROW(LegalLogMgr::parseFile(params, map));
     EXPECT_NO_THROW(rotating_file.apply(map));
+    EXPECT_EQ(1000U, rotating_file.getQueueSize());
+    EXPECT_EQ("csv", rotating_file.getOutputFormat());
 }
 
 // Verify that parsing extra parameters works
@@ -341,6 +355,19 @@ TEST_F(LegalLogMgrTest, wrongDatabaseType) {
                      "The type of the forensic log backend: 'awesomesql' is not supported");
 }
 
+// Verify that the database queue size is parsed.
+TEST_F(LegalLogMgrTest, databaseQueueSize) {
+    db::DatabaseConnection::ParameterMap map;
+    ElementPtr parameters = Element::createMap();
+    parameters->set("type", Element::create("mysql"));
+    parameters->set("queue-size", Element::create(-1));
+    EXPECT_THROW(LegalLogMgr::parseDatabase(parameters, map), OutOfRange);
+
+    parameters->set("queue-size", Element::create(1000));
+    EXPECT_NO_THROW(LegalLogMgr::parseDatabase(parameters, map));
+    EXPECT_EQ("1000", map["queue-size"]);
+}
+
 TEST_F(LegalLogMgrTest, syslogNoParameters) {
     db::DatabaseConnection::ParameterMap map;
     EXPECT_THROW(LegalLogMgr::parseSyslog(ConstElementPtr(), map), BadValue);
@@ -1,4 +1,4 @@
-// Copyright (C) 2016-2025 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2016-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -17,6 +17,8 @@
 
 #include <boost/date_time/posix_time/posix_time.hpp>
 
+#include <fstream>
+#include <iterator>
 #include <sstream>
 
 using namespace isc;
@@ -216,6 +218,83 @@ TEST_F(RotatingFileTest, writeFile) {
     checkFileLines(genName(tomorrow), tomorrow_now_string, tomorrow_lines);
 }
 
+/// @brief Tests writing to a file with the background writer
+TEST_F(RotatingFileTest, writeFileQueued) {
+    // Construct the legal file
+    ASSERT_NO_THROW(rotating_file_.reset(new TestableRotatingFile(time_)));
+
+    // Enable the background writer with a queue smaller than the
+    // number of records so the writer is waited for.
+    db::DatabaseConnection::ParameterMap map;
+    map["path"] = TEST_DATA_BUILDDIR;
+    map["base-name"] = "legal";
+    map["queue-size"] = "4";
+    ASSERT_NO_THROW(rotating_file_->apply(map));
+    EXPECT_EQ(4U, rotating_file_->getQueueSize());
+
+    // Open the file
+    ASSERT_NO_THROW(rotating_file_->open());
+
+    // Write to the file
+    std::string today_now_string = rotating_file_->getNowString();
+    std::vector<std::string> today_lines;
+    for (unsigned i = 0; i < 100; ++i) {
+        std::ostringstream line;
+        line << "line " << i;
+        today_lines.push_back(line.str());
+        ASSERT_NO_THROW(rotating_file_->writeln(today_lines.back(), ""));
+    }
+
+    // Close the file to write queued records
+    ASSERT_NO_THROW(rotating_file_->close());
+
+    // Make sure we have the correct content in the file.
+    checkFileLines(genName(today()), today_now_string, today_lines);
+
+    // Writing after close still works.
+    ASSERT_NO_THROW(rotating_file_->writeln("after close", ""));
+    ASSERT_NO_THROW(rotating_file_->close());
+    today_lines.push_back("after close");
+    checkFileLines(genName(today()), today_now_string, today_lines);
+}
+
+/// @brief Tests writing to a file with the CSV output format
+TEST_F(RotatingFileTest, writeFileCsv) {
+    // Construct the legal file
+    ASSERT_NO_THROW(rotating_file_.reset(new TestableRotatingFile(time_)));
+
+    db::DatabaseConnection::ParameterMap map;
+    map["path"] = TEST_DATA_BUILDDIR;
+    map["base-name"] = "legal";
+    map["output-format"] = "csv";
+    ASSERT_NO_THROW(rotating_file_->apply(map));
+    EXPECT_EQ("csv", rotating_file_->getOutputFormat());
+
+    // Open the file
+    ASSERT_NO_THROW(rotating_file_->open());
+
+    // Write to the file: a record with quotes and a record with
+    // two lines.
+    std::string now_string = rotating_file_->getNowString();
+    ASSERT_NO_THROW(rotating_file_->writeln("say \"hello\"", "192.0.2.1"));
+    ASSERT_NO_THROW(rotating_file_->writeln("one\ntwo", ""));
+    ASSERT_NO_THROW(rotating_file_->close());
+
+    // Each record is a row, embedded EOLs being kept in the quoted field.
+    std::ifstream is(genName(today()).c_str());
+    ASSERT_TRUE(is.good());
+    std::string content((std::istreambuf_iterator<char>(is)),
+                        std::istreambuf_iterator<char>());
+    std::string expected;
+    expected += "\"" + now_string + "\",\"192.0.2.1\",\"say \"\"hello\"\"\"\n";
+    expected += "\"" + now_string + "\",\"\",\"one\ntwo\"\n";
+    EXPECT_EQ(expected, content);
+
+    // Unknown formats are rejected.
+    map["output-format"] = "binary";
+    EXPECT_THROW(rotating_file_->apply(map), BadValue);
+}
+
 /// @brief Tests open file when other files are or are not present
 TEST_F(RotatingFileTest, useSecondAsTimeUnitOpenFile) {
     // Construct the legal file
@@ -1,4 +1,4 @@
-// Copyright (C) 2018-2024 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2018-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -12,6 +12,7 @@
 #include <exceptions/exceptions.h>
 #include <boost/pointer_cast.hpp>
 
+using namespace isc::asiolink;
 using namespace isc::data;
 using namespace isc::dhcp;
 using namespace std;
@@ -23,6 +24,7 @@ unordered_set<string> CommandCreator::ha_commands4_ = {
     "list-commands", "status-get",
     "dhcp-disable", "dhcp-enable",
     "ha-reset", "ha-heartbeat",
+    "lease4-bulk-apply",
     "lease4-update", "lease4-del",
     "lease4-get-all", "lease4-get-page",
     "ha-maintenance-notify", "ha-sync-complete-notify"
@@ -110,6 +112,37 @@ CommandCreator::createLease4Delete(const Lease4& lease4) {
     return (command);
 }
 
+ConstElementPtr
+CommandCreator::createLease4BulkApply(LeaseUpdateBacklog& leases,
+                                      const size_t max_leases) {
+    ElementPtr deleted_leases_list = Element::createList();
+    ElementPtr leases_list = Element::createList();
+
+    LeaseUpdateBacklog::OpType op_type;
+    Lease4Ptr lease;
+    size_t count = 0;
+    while (((max_leases == 0) || (count < max_leases)) &&
+           (lease = boost::dynamic_pointer_cast<Lease4>(leases.pop(op_type)))) {
+        ElementPtr lease_as_json = lease->toElement();
+        insertLeaseExpireTime(lease_as_json);
+        if (op_type == LeaseUpdateBacklog::DELETE) {
+            deleted_leases_list->add(lease_as_json);
+        } else {
+            leases_list->add(lease_as_json);
+        }
+        ++count;
+    }
+
+    ElementPtr args = Element::createMap();
+    args->set("deleted-leases", deleted_leases_list);
+    args->set("leases", leases_list);
+    args->set("origin", Element::create("ha-partner"));
+
+    ConstElementPtr command = config::createCommand("lease4-bulk-apply", args);
+    insertService(command, HAServerType::DHCPv4);
+    return (command);
+}
+
 ConstElementPtr
 CommandCreator::createLease4GetAll() {
     ConstElementPtr command = config::createCommand("lease4-get-all");
@@ -120,15 +153,25 @@ CommandCreator::createLease4GetAll() {
 ConstElementPtr
 CommandCreator::createLease4GetPage(const Lease4Ptr& last_lease4,
                                     const uint32_t limit) {
+    // Get the last lease returned on the previous page. A null pointer means that
+    // we're fetching first page.
+    return (createLease4GetPage(last_lease4 ? last_lease4->addr_ : IOAddress::IPV4_ZERO_ADDRESS(),
+                                IOAddress::IPV4_ZERO_ADDRESS(), limit, 0));
+}
+
+ConstElementPtr
+CommandCreator::createLease4GetPage(const IOAddress& from,
+                                    const IOAddress& to,
+                                    const uint32_t limit,
+                                    const int64_t min_cltt) {
     // Zero value is not allowed.
     if (limit == 0) {
         isc_throw(BadValue, "limit value for lease4-get-page command must not be 0");
     }
 
-    // Get the last lease returned on the previous page. A null pointer means that
-    // we're fetching first page. In that case a keyword "start" is used to indicate
-    // that first page should be returned.
-    ElementPtr from_element = Element::create(last_lease4 ? last_lease4->addr_.toText() : "start");
+    // The zero address means that we're fetching first page. In that case a
+    // keyword "start" is used to indicate that first page should be returned.
+    ElementPtr from_element = Element::create(from.isV4Zero() ? "start" : from.toText());
     // Set the maximum size of the page.
     ElementPtr limit_element = Element::create(static_cast<long long int>(limit));
     // Put both parameters into arguments map.
@@ -136,6 +179,16 @@ CommandCreator::createLease4GetPage(const Lease4Ptr& last_lease4,
     args->set("from", from_element);
     args->set("limit", limit_element);
 
+    // The end of the range and the minimum cltt are only set when they
+    // restrict the page, so the command is unchanged for the partners
+    // which don't support them.
+    if (!to.isV4Zero()) {
+        args->set("to", Element::create(to.toText()));
+    }
+    if (min_cltt > 0) {
+        args->set("min-cltt", Element::create(static_cast<long long int>(min_cltt)));
+    }
+
     // Create the command.
     ConstElementPtr command = config::createCommand("lease4-get-page", args);
     insertService(command, HAServerType::DHCPv4);
@@ -178,13 +231,16 @@ CommandCreator::createLease6BulkApply(const Lease6CollectionPtr& leases,
 }
 
 ConstElementPtr
-CommandCreator::createLease6BulkApply(LeaseUpdateBacklog& leases) {
+CommandCreator::createLease6BulkApply(LeaseUpdateBacklog& leases,
+                                      const size_t max_leases) {
     ElementPtr deleted_leases_list = Element::createList();
     ElementPtr leases_list = Element::createList();
 
     LeaseUpdateBacklog::OpType op_type;
     Lease6Ptr lease;
-    while ((lease = boost::dynamic_pointer_cast<Lease6>(leases.pop(op_type)))) {
+    size_t count = 0;
+    while (((max_leases == 0) || (count < max_leases)) &&
+           (lease = boost::dynamic_pointer_cast<Lease6>(leases.pop(op_type)))) {
         ElementPtr lease_as_json = lease->toElement();
         insertLeaseExpireTime(lease_as_json);
         if (op_type == LeaseUpdateBacklog::DELETE) {
@@ -192,6 +248,7 @@ CommandCreator::createLease6BulkApply(LeaseUpdateBacklog& leases) {
         } else {
             leases_list->add(lease_as_json);
         }
+        ++count;
     }
 
     ElementPtr args = Element::createMap();
@@ -235,15 +292,25 @@ CommandCreator::createLease6GetAll() {
 ConstElementPtr
 CommandCreator::createLease6GetPage(const Lease6Ptr& last_lease6,
                                     const uint32_t limit) {
+    // Get the last lease returned on the previous page. A null pointer means that
+    // we're fetching first page.
+    return (createLease6GetPage(last_lease6 ? last_lease6->addr_ : IOAddress::IPV6_ZERO_ADDRESS(),
+                                IOAddress::IPV6_ZERO_ADDRESS(), limit, 0));
+}
+
+ConstElementPtr
+CommandCreator::createLease6GetPage(const IOAddress& from,
+                                    const IOAddress& to,
+                                    const uint32_t limit,
+                                    const int64_t min_cltt) {
     // Zero value is not allowed.
     if (limit == 0) {
         isc_throw(BadValue, "limit value for lease6-get-page command must not be 0");
     }
 
-    // Get the last lease returned on the previous page. A null pointer means that
-    // we're fetching first page. In that case a keyword "start" is used to indicate
-    // that first page should be returned.
-    ElementPtr from_element = Element::create(last_lease6 ? last_lease6->addr_.toText() : "start");
+    // The zero address means that we're fetching first page. In that case a
+    // keyword "start" is used to indicate that first page should be returned.
+    ElementPtr from_element = Element::create(from.isV6Zero() ? "start" : from.toText());
     // Set the maximum size of the page.
     ElementPtr limit_element = Element::create(static_cast<long long int>(limit));
     // Put both parameters into arguments map.
@@ -251,6 +318,16 @@ CommandCreator::createLease6GetPage(const Lease6Ptr& last_lease6,
     args->set("from", from_element);
     args->set("limit", limit_element);
 
+    // The end of the range and the minimum cltt are only set when they
+    // restrict the page, so the command is unchanged for the partners
+    // which don't support them.
+    if (!to.isV6Zero()) {
+        args->set("to", Element::create(to.toText()));
+    }
+    if (min_cltt > 0) {
+        args->set("min-cltt", Element::create(static_cast<long long int>(min_cltt)));
+    }
+
     // Create the command.
     ConstElementPtr command = config::createCommand("lease6-get-page", args);
     insertService(command, HAServerType::DHCPv6);
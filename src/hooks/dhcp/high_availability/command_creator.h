@@ -9,6 +9,7 @@
 
 #include <lease_update_backlog.h>
 #include <ha_server_type.h>
+#include <asiolink/io_address.h>
 #include <cc/data.h>
 #include <dhcpsrv/lease.h>
 #include <unordered_set>
@@ -89,6 +90,18 @@ public:
     static data::ConstElementPtr
     createLease4Delete(const dhcp::Lease4& lease4);
 
+    /// @brief Creates lease4-bulk-apply command.
+    ///
+    /// This command pops at most @c max_leases leases from the backlog.
+    ///
+    /// @param leases Reference to the collection of DHCPv4 leases backlog.
+    /// @param max_leases Maximum number of leases in the command or 0 for
+    /// all leases in the backlog.
+    /// @return Pointer to the JSON representation of the command.
+    static data::ConstElementPtr
+    createLease4BulkApply(LeaseUpdateBacklog& leases,
+                          const size_t max_leases = 0);
+
     /// @brief Creates lease4-get-all command.
     ///
     /// @return Pointer to the JSON representation of the command.
@@ -108,6 +121,22 @@ public:
     createLease4GetPage(const dhcp::Lease4Ptr& lease4,
                         const uint32_t limit);
 
+    /// @brief Creates lease4-get-page command for a range of addresses.
+    ///
+    /// @param from Address after which the page starts. The zero address
+    /// is used to fetch the first page.
+    /// @param to Last address of the range or the zero address when the
+    /// range extends to the end of the address space.
+    /// @param limit Limit of leases on the page.
+    /// @param min_cltt When not 0 only the leases with a greater or equal
+    /// cltt are fetched.
+    /// @return Pointer to the JSON representation of the command.
+    static data::ConstElementPtr
+    createLease4GetPage(const asiolink::IOAddress& from,
+                        const asiolink::IOAddress& to,
+                        const uint32_t limit,
+                        const int64_t min_cltt);
+
     /// @brief Creates lease6-bulk-apply command.
     ///
     /// @param leases Pointer to the collection of leases to be created
@@ -121,13 +150,17 @@ public:
 
     /// @brief Creates lease6-bulk-apply command.
     ///
-    /// This command pops the leases from the backlog. As a result, the
-    /// backlog is empty after calling this function.
+    /// This command pops at most @c max_leases leases from the backlog.
+    /// As a result, the backlog is empty after calling this function
+    /// when @c max_leases is 0.
     ///
     /// @param leases Reference to the collection of DHCPv6 leases backlog.
+    /// @param max_leases Maximum number of leases in the command or 0 for
+    /// all leases in the backlog.
     /// @return Pointer to the JSON representation of the command.
     static data::ConstElementPtr
-    createLease6BulkApply(LeaseUpdateBacklog& leases);
+    createLease6BulkApply(LeaseUpdateBacklog& leases,
+                          const size_t max_leases = 0);
 
     /// @brief Creates lease6-update command.
     ///
@@ -170,6 +203,22 @@ public:
     createLease6GetPage(const dhcp::Lease6Ptr& lease6,
                         const uint32_t limit);
 
+    /// @brief Creates lease6-get-page command for a range of addresses.
+    ///
+    /// @param from Address after which the page starts. The zero address
+    /// is used to fetch the first page.
+    /// @param to Last address of the range or the zero address when the
+    /// range extends to the end of the address space.
+    /// @param limit Limit of leases on the page.
+    /// @param min_cltt When not 0 only the leases with a greater or equal
+    /// cltt are fetched.
+    /// @return Pointer to the JSON representation of the command.
+    static data::ConstElementPtr
+    createLease6GetPage(const asiolink::IOAddress& from,
+                        const asiolink::IOAddress& to,
+                        const uint32_t limit,
+                        const int64_t min_cltt);
+
     /// @brief Creates ha-maintenance-notify command.
     ///
     /// @param server_name name of the server sending the command allowing
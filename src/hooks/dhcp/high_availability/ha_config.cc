@@ -1,4 +1,4 @@
-// Copyright (C) 2018-2025 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2018-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -166,10 +166,12 @@ HAConfig::StateMachineConfig::getStateConfig(const int state) {
 HAConfig::HAConfig()
     : this_server_name_(), ha_mode_(HOT_STANDBY), send_lease_updates_(true),
       sync_leases_(true), sync_timeout_(60000), sync_page_limit_(10000),
-      delayed_updates_limit_(0), heartbeat_delay_(10000), max_response_delay_(60000),
+      sync_ranges_(1), sync_delta_(false), delayed_updates_limit_(0),
+      heartbeat_delay_(10000), max_response_delay_(60000),
       max_ack_delay_(10000), max_unacked_clients_(10), max_rejected_lease_updates_(10),
       wait_backup_ack_(false), enable_multi_threading_(false),
       http_dedicated_listener_(false), http_listener_threads_(0), http_client_threads_(0),
+      http_client_pipeline_depth_(1),
       trust_anchor_(), cert_file_(), key_file_(), require_client_certs_(true),
       restrict_commands_(true), peers_(),
       state_machine_(new StateMachineConfig()) {
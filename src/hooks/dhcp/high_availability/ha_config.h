@@ -460,6 +460,37 @@ public:
         sync_page_limit_ = sync_page_limit;
     }
 
+    /// @brief Returns the number of address ranges fetched in parallel
+    /// during database synchronization.
+    ///
+    /// @return Number of ranges (1 disables the parallel synchronization).
+    uint32_t getSyncRanges() const {
+        return (sync_ranges_);
+    }
+
+    /// @brief Sets the number of address ranges fetched in parallel during
+    /// database synchronization.
+    ///
+    /// @param sync_ranges New number of ranges.
+    void setSyncRanges(const uint32_t sync_ranges) {
+        sync_ranges_ = sync_ranges;
+    }
+
+    /// @brief Checks if only the leases modified since the servers were
+    /// last in sync are fetched during database synchronization.
+    ///
+    /// @return true if the delta synchronization is enabled.
+    bool getSyncDelta() const {
+        return (sync_delta_);
+    }
+
+    /// @brief Enables or disables the delta synchronization.
+    ///
+    /// @param sync_delta New value.
+    void setSyncDelta(const bool sync_delta) {
+        sync_delta_ = sync_delta;
+    }
+
     /// @brief Returns the maximum number of lease updates which can be held
     /// unsent in the communication-recovery state.
     ///
@@ -692,6 +723,24 @@ public:
         http_client_threads_ = http_client_threads;
     }
 
+    /// @brief Fetches the maximum number of requests the HTTP client may
+    /// pipeline over a connection.
+    ///
+    /// @return maximum number of requests sent over a connection and not
+    /// yet answered (1 means no pipelining).
+    uint32_t getHttpClientPipelineDepth() const {
+        return (http_client_pipeline_depth_);
+    }
+
+    /// @brief Sets the maximum number of requests the HTTP client may
+    /// pipeline over a connection.
+    ///
+    /// @param http_client_pipeline_depth maximum number of requests sent
+    /// over a connection and not yet answered.
+    void setHttpClientPipelineDepth(uint32_t http_client_pipeline_depth) {
+        http_client_pipeline_depth_ = http_client_pipeline_depth;
+    }
+
     /// @brief Returns global trust-anchor.
     util::Optional<std::string> getTrustAnchor() const {
         return (trust_anchor_);
@@ -834,6 +883,9 @@ public:
     uint32_t sync_timeout_;                   ///< Timeout for syncing lease database (ms)
     uint32_t sync_page_limit_;                ///< Page size limit while
                                               ///< synchronizing leases.
+    uint32_t sync_ranges_;                    ///< Number of ranges synchronized
+                                              ///< in parallel.
+    bool sync_delta_;                         ///< Fetch only modified leases?
     uint32_t delayed_updates_limit_;          ///< Maximum number of lease updates held
                                               ///< for later send in communication-recovery.
     uint32_t heartbeat_delay_;                ///< Heartbeat delay in milliseconds.
@@ -846,6 +898,8 @@ public:
     bool http_dedicated_listener_;            ///< Enable use of own HTTP listener.
     uint32_t http_listener_threads_;          ///< Number of HTTP listener threads.
     uint32_t http_client_threads_;            ///< Number of HTTP client threads.
+    uint32_t http_client_pipeline_depth_;     ///< Maximum number of pipelined
+                                              ///< HTTP requests per connection.
     util::Optional<std::string> trust_anchor_; ///< Trust anchor.
     util::Optional<std::string> cert_file_;    ///< Certificate file.
     util::Optional<std::string> key_file_;     ///< Private key file.
@@ -36,9 +36,11 @@ const SimpleDefaults HA_CONFIG_DEFAULTS = {
     { "require-client-certs",       Element::boolean, "true" },
     { "restrict-commands",          Element::boolean, "true" },
     { "send-lease-updates",         Element::boolean, "true" },
+    { "sync-delta",                 Element::boolean, "false" },
     { "sync-leases",                Element::boolean, "true" },
     { "sync-timeout",               Element::integer, "60000" },
     { "sync-page-limit",            Element::integer, "10000" },
+    { "sync-ranges",                Element::integer, "1" },
     { "wait-backup-ack",            Element::boolean, "false" }
 };
 
@@ -46,6 +48,7 @@ const SimpleDefaults HA_CONFIG_DEFAULTS = {
 const SimpleDefaults HA_CONFIG_MT_DEFAULTS = {
     { "enable-multi-threading",    Element::boolean, "true" },
     { "http-client-threads",       Element::integer, "0" },
+    { "http-client-pipeline-depth", Element::integer, "1" },
     { "http-dedicated-listener",   Element::boolean, "true" },
     { "http-listener-threads",     Element::integer, "0" }
 };
@@ -179,6 +182,16 @@ HAConfigParser::parseOne(const HAConfigMapperPtr& config_storage,
     uint32_t sync_page_limit = getAndValidateInteger<uint32_t>(config, "sync-page-limit");
     rel_config->setSyncPageLimit(sync_page_limit);
 
+    // Get 'sync-ranges'.
+    uint32_t sync_ranges = getAndValidateInteger<uint32_t>(config, "sync-ranges");
+    if (sync_ranges == 0) {
+        isc_throw(ConfigError, "'sync-ranges' must be greater than 0");
+    }
+    rel_config->setSyncRanges(sync_ranges);
+
+    // Get 'sync-delta'.
+    rel_config->setSyncDelta(getBoolean(config, "sync-delta"));
+
     // Get 'delayed-updates-limit'.
     uint32_t delayed_updates_limit = getAndValidateInteger<uint32_t>(config, "delayed-updates-limit");
     rel_config->setDelayedUpdatesLimit(delayed_updates_limit);
@@ -247,6 +260,13 @@ HAConfigParser::parseOne(const HAConfigMapperPtr& config_storage,
     threads = getAndValidateInteger<uint32_t>(mt_config, "http-client-threads");
     rel_config->setHttpClientThreads(threads);
 
+    // Get 'http-client-pipeline-depth'.
+    uint32_t pipeline_depth = getAndValidateInteger<uint32_t>(mt_config, "http-client-pipeline-depth");
+    if (pipeline_depth == 0) {
+        isc_throw(ConfigError, "'http-client-pipeline-depth' must be greater than 0");
+    }
+    rel_config->setHttpClientPipelineDepth(pipeline_depth);
+
     // Get optional 'trust-anchor'.
     ConstElementPtr ca = config->get("trust-anchor");
     if (ca) {
@@ -27,7 +27,10 @@
 #include <util/stopwatch.h>
 #include <boost/pointer_cast.hpp>
 #include <boost/make_shared.hpp>
+#include <boost/scoped_ptr.hpp>
 #include <boost/weak_ptr.hpp>
+#include <algorithm>
+#include <ctime>
 #include <functional>
 #include <sstream>
 
@@ -80,7 +83,8 @@ HAService::HAService(const unsigned int id, const IOServicePtr& io_service,
       server_type_(server_type), client_(), listener_(), communication_state_(),
       query_filter_(config), lease_sync_filter_(server_type, config), mutex_(),
       pending_requests_(), lease_update_backlog_(config->getDelayedUpdatesLimit()),
-      sync_complete_notified_(false) {
+      sync_complete_notified_(false), sync_delta_mark_(0),
+      lease4_bulk_apply_unsupported_(false) {
 
     if (server_type == HAServerType::DHCPv4) {
         communication_state_.reset(new CommunicationState4(io_service_, config));
@@ -96,11 +100,13 @@ HAService::HAService(const unsigned int id, const IOServicePtr& io_service,
     // Create the client and(or) listener as appropriate.
     if (!config_->getEnableMultiThreading()) {
         // Not configured for multi-threading, start a client in ST mode.
-        client_.reset(new HttpClient(io_service_, false));
+        client_.reset(new HttpClient(io_service_, false, 0, false,
+                                     config_->getHttpClientPipelineDepth()));
     } else {
         // Create an MT-mode client.
         client_.reset(new HttpClient(io_service_, true,
-                      config_->getHttpClientThreads(), true));
+                      config_->getHttpClientThreads(), true,
+                      config_->getHttpClientPipelineDepth()));
 
         // If we're configured to use our own listener create and start it.
         if (config_->getHttpDedicatedListener()) {
@@ -781,7 +787,8 @@ HAService::syncingStateHandler() {
         std::string status_message;
         int sync_status = synchronize(status_message,
                                       config_->getFailoverPeerConfig(),
-                                      dhcp_disable_timeout);
+                                      dhcp_disable_timeout,
+                                      getSyncMinCltt());
 
         // If the leases synchronization was successful, let's transition
         // to the ready state.
@@ -1905,6 +1912,14 @@ HAService::asyncSendHeartbeat() {
             if (heartbeat_success) {
                 communication_state_->poke();
 
+                // Both servers in the normal state exchange lease updates,
+                // so the lease databases are in sync.
+                if (config_->amSendingLeaseUpdates() &&
+                    (getCurrState() == getNormalState()) &&
+                    (communication_state_->getPartnerState() == getNormalState())) {
+                    sync_delta_mark_ = time(0);
+                }
+
             } else {
                 // We were unable to retrieve partner's state, so let's mark it
                 // as unavailable.
@@ -2137,14 +2152,14 @@ HAService::asyncSyncLeases() {
 
     lease_sync_filter_.apply();
     asyncSyncLeases(*client_, config_->getFailoverPeerConfig(),
-                    dhcp_disable_timeout, LeasePtr(), null_action);
+                    dhcp_disable_timeout, getSyncMinCltt(), null_action);
 }
 
 void
 HAService::asyncSyncLeases(http::HttpClient& http_client,
                            const HAConfig::PeerConfigPtr& remote_config,
                            const unsigned int max_period,
-                           const dhcp::LeasePtr& last_lease,
+                           const int64_t min_cltt,
                            PostSyncCallback post_sync_action,
                            const bool dhcp_disabled) {
     // Synchronization starts with a command to disable DHCP service of the
@@ -2153,17 +2168,28 @@ HAService::asyncSyncLeases(http::HttpClient& http_client,
     // be disabled for a certain amount of time and will be automatically
     // re-enabled if we die during the synchronization.
     asyncDisableDHCPService(http_client, remote_config, max_period,
-                            [this, &http_client, remote_config, max_period, last_lease,
+                            [this, &http_client, remote_config, max_period, min_cltt,
                              post_sync_action, dhcp_disabled]
                             (const bool success, const std::string& error_message, const int) {
 
         // If we have successfully disabled the DHCP service on the peer,
         // we can start fetching the leases.
         if (success) {
-            // The last argument indicates that disabling the DHCP
-            // service on the partner server was successful.
-            asyncSyncLeasesInternal(http_client, remote_config, max_period,
-                                    last_lease, post_sync_action, true);
+            // Fetch the first page of all ranges at once. Each range then
+            // continues independently until its last page.
+            std::vector<SyncRange> ranges = getSyncRanges();
+            SyncProgressPtr progress(new SyncProgress(ranges.size(), min_cltt));
+
+            LOG_INFO(ha_logger, HA_LEASES_SYNC_RANGES)
+                .arg(config_->getThisServerName())
+                .arg(remote_config->getLogLabel())
+                .arg(ranges.size())
+                .arg(min_cltt);
+
+            for (auto const& range : ranges) {
+                asyncSyncLeasesInternal(http_client, remote_config, max_period,
+                                        range, progress, post_sync_action);
+            }
 
         } else {
             post_sync_action(success, error_message, dhcp_disabled);
@@ -2171,13 +2197,37 @@ HAService::asyncSyncLeases(http::HttpClient& http_client,
     });
 }
 
+void
+HAService::asyncSyncLeasesRange(http::HttpClient& http_client,
+                                const HAConfig::PeerConfigPtr& remote_config,
+                                const unsigned int max_period,
+                                const SyncRange& range,
+                                const SyncProgressPtr& progress,
+                                PostSyncCallback post_sync_action) {
+    // Extend the time the DHCP service of the peer is disabled before
+    // fetching the next page.
+    asyncDisableDHCPService(http_client, remote_config, max_period,
+                            [this, &http_client, remote_config, max_period, range,
+                             progress, post_sync_action]
+                            (const bool success, const std::string& error_message, const int) {
+        if (success) {
+            asyncSyncLeasesInternal(http_client, remote_config, max_period,
+                                    range, progress, post_sync_action);
+
+        } else if (progress->complete(error_message) && post_sync_action) {
+            // The DHCP service was disabled for the first page.
+            post_sync_action(false, progress->error_message_, true);
+        }
+    });
+}
+
 void
 HAService::asyncSyncLeasesInternal(http::HttpClient& http_client,
                                    const HAConfig::PeerConfigPtr& remote_config,
                                    const unsigned int max_period,
-                                   const dhcp::LeasePtr& last_lease,
-                                   PostSyncCallback post_sync_action,
-                                   const bool dhcp_disabled) {
+                                   const SyncRange& range,
+                                   const SyncProgressPtr& progress,
+                                   PostSyncCallback post_sync_action) {
     // Create HTTP/1.1 request including our command.
     PostHttpRequestJsonPtr request = boost::make_shared<PostHttpRequestJson>
         (HttpRequest::Method::HTTP_POST, "/", HttpVersion::HTTP_11(),
@@ -2185,11 +2235,11 @@ HAService::asyncSyncLeasesInternal(http::HttpClient& http_client,
     remote_config->addBasicAuthHttpHeader(request);
     if (server_type_ == HAServerType::DHCPv4) {
         request->setBodyAsJson(CommandCreator::createLease4GetPage(
-            boost::dynamic_pointer_cast<Lease4>(last_lease), config_->getSyncPageLimit()));
+            range.from_, range.to_, config_->getSyncPageLimit(), progress->min_cltt_));
 
     } else {
         request->setBodyAsJson(CommandCreator::createLease6GetPage(
-            boost::dynamic_pointer_cast<Lease6>(last_lease), config_->getSyncPageLimit()));
+            range.from_, range.to_, config_->getSyncPageLimit(), progress->min_cltt_));
     }
     request->finalize();
 
@@ -2201,7 +2251,7 @@ HAService::asyncSyncLeasesInternal(http::HttpClient& http_client,
     http_client.asyncSendRequest(remote_config->getUrl(),
                                  remote_config->getTlsContext(),
                                  request, response,
-        [this, remote_config, post_sync_action, &http_client, max_period, dhcp_disabled]
+        [this, remote_config, post_sync_action, &http_client, max_period, range, progress]
             (const boost::system::error_code& ec,
              const HttpResponsePtr& http_response,
              const std::string& error_str) {
@@ -2210,6 +2260,15 @@ HAService::asyncSyncLeasesInternal(http::HttpClient& http_client,
              // page was hit, this value remains null.
              LeasePtr last_lease_in_callback;
 
+             // Holds the address returned by the partner when it stopped
+             // reading its lease database before filling the page.
+             boost::scoped_ptr<IOAddress> next_address;
+
+             // Leases beyond the end of the range belong to the next range.
+             // They are only returned by partners which don't support the
+             // "to" parameter.
+             bool bounded = !range.to_.isV4Zero() && !range.to_.isV6Zero();
+
             // There are three possible groups of errors during the heartbeat.
             // One is the IO error causing issues in communication with the peer.
             // Another one is an HTTP parsing error. The last type of error is
@@ -2255,12 +2314,26 @@ HAService::asyncSyncLeasesInternal(http::HttpClient& http_client,
 
                     // Count actually applied leases.
                     uint64_t applied_lease_count = 0;
+
+                    // The leases to be added and updated are gathered and
+                    // written in batches, i.e. in one transaction each with
+                    // the database backends.
+                    Lease4Collection new_leases4;
+                    Lease4Collection updated_leases4;
+                    Lease4Collection existing_leases4;
+                    Lease6Collection new_leases6;
+                    Lease6Collection updated_leases6;
+                    Lease6Collection existing_leases6;
                     for (auto l = leases_element.begin(); l != leases_element.end(); ++l) {
                         try {
 
                             if (server_type_ == HAServerType::DHCPv4) {
                                 Lease4Ptr lease = Lease4::fromElement(*l);
 
+                                if (bounded && (range.to_ < lease->addr_)) {
+                                    break;
+                                }
+
                                 // If we're not on the last page and we're processing final lease on
                                 // this page, let's record the lease as input to the next
                                 // lease4-get-page command.
@@ -2277,9 +2350,7 @@ HAService::asyncSyncLeasesInternal(http::HttpClient& http_client,
                                 Lease4Ptr existing_lease = LeaseMgrFactory::instance().getLease4(lease->addr_);
                                 if (!existing_lease) {
                                     // There is no such lease, so let's add it.
-                                    LeaseMgrFactory::instance().addLease(lease);
-                                    ++applied_lease_count;
-                                    LeaseMgr::updateStatsOnAdd(lease);
+                                    new_leases4.push_back(lease);
                                 } else if (existing_lease->cltt_ < lease->cltt_) {
                                     // If the existing lease is older than the fetched lease, update
                                     // the lease in our local database.
@@ -2287,9 +2358,8 @@ HAService::asyncSyncLeasesInternal(http::HttpClient& http_client,
                                     // database. Some database backends reject operations on the lease if
                                     // the current expiration time value does not match what is stored.
                                     Lease::syncCurrentExpirationTime(*existing_lease, *lease);
-                                    LeaseMgrFactory::instance().updateLease4(lease);
-                                    ++applied_lease_count;
-                                    LeaseMgr::updateStatsOnUpdate(existing_lease, lease);
+                                    updated_leases4.push_back(lease);
+                                    existing_leases4.push_back(existing_lease);
                                 } else {
                                     LOG_DEBUG(ha_logger, DBGLVL_TRACE_BASIC, HA_LEASE_SYNC_STALE_LEASE4_SKIP)
                                         .arg(config_->getThisServerName())
@@ -2300,6 +2370,10 @@ HAService::asyncSyncLeasesInternal(http::HttpClient& http_client,
                             } else {
                                 Lease6Ptr lease = Lease6::fromElement(*l);
 
+                                if (bounded && (range.to_ < lease->addr_)) {
+                                    break;
+                                }
+
                                 // If we're not on the last page and we're processing final lease on
                                 // this page, let's record the lease as input to the next
                                 // lease6-get-page command.
@@ -2317,9 +2391,7 @@ HAService::asyncSyncLeasesInternal(http::HttpClient& http_client,
                                                                                                  lease->addr_);
                                 if (!existing_lease) {
                                     // There is no such lease, so let's add it.
-                                    LeaseMgrFactory::instance().addLease(lease);
-                                    ++applied_lease_count;
-                                    LeaseMgr::updateStatsOnAdd(lease);
+                                    new_leases6.push_back(lease);
                                 } else if (existing_lease->cltt_ < lease->cltt_) {
                                     // If the existing lease is older than the fetched lease, update
                                     // the lease in our local database.
@@ -2327,9 +2399,8 @@ HAService::asyncSyncLeasesInternal(http::HttpClient& http_client,
                                     // database. Some database backends reject operations on the lease if
                                     // the current expiration time value does not match what is stored.
                                     Lease::syncCurrentExpirationTime(*existing_lease, *lease);
-                                    LeaseMgrFactory::instance().updateLease6(lease);
-                                    ++applied_lease_count;
-                                    LeaseMgr::updateStatsOnUpdate(existing_lease, lease);
+                                    updated_leases6.push_back(lease);
+                                    existing_leases6.push_back(existing_lease);
                                 } else {
                                     LOG_DEBUG(ha_logger, DBGLVL_TRACE_BASIC, HA_LEASE_SYNC_STALE_LEASE6_SKIP)
                                         .arg(config_->getThisServerName())
@@ -2346,10 +2417,31 @@ HAService::asyncSyncLeasesInternal(http::HttpClient& http_client,
                         }
                     }
 
+                    if (server_type_ == HAServerType::DHCPv4) {
+                        applied_lease_count += applySyncedLeases4(new_leases4,
+                                                                  updated_leases4,
+                                                                  existing_leases4);
+                    } else {
+                        applied_lease_count += applySyncedLeases6(new_leases6,
+                                                                  updated_leases6,
+                                                                  existing_leases6);
+                    }
+
                     LOG_INFO(ha_logger, HA_LEASES_SYNC_APPLIED_LEASES)
                         .arg(config_->getThisServerName())
                         .arg(applied_lease_count);
 
+                    // A short page with the 'next' argument is not the last
+                    // one: the partner capped the number of database pages
+                    // read with 'min-cltt'.
+                    ConstElementPtr next = args->get("next");
+                    if (next && (next->getType() == Element::string)) {
+                        next_address.reset(new IOAddress(next->stringValue()));
+                        if (bounded && (range.to_ < *next_address)) {
+                            next_address.reset();
+                        }
+                    }
+
                 } catch (const std::exception& ex) {
                     error_message = ex.what();
                     LOG_ERROR(ha_logger, HA_LEASES_SYNC_FAILED)
@@ -2364,19 +2456,26 @@ HAService::asyncSyncLeasesInternal(http::HttpClient& http_client,
              if (!error_message.empty()) {
                  communication_state_->setPartnerUnavailable();
 
-             } else if (last_lease_in_callback) {
-                 // This indicates that there are more leases to be fetched.
-                 // Therefore, we have to send another leaseX-get-page command.
-                 asyncSyncLeases(http_client, remote_config, max_period, last_lease_in_callback,
-                                 post_sync_action, dhcp_disabled);
+             } else if ((last_lease_in_callback || next_address) &&
+                        !progress->failed()) {
+                 // This indicates that there are more leases to be fetched
+                 // in this range. Therefore, we have to send another
+                 // leaseX-get-page command.
+                 IOAddress from = (next_address ? *next_address :
+                                   last_lease_in_callback->addr_);
+                 asyncSyncLeasesRange(http_client, remote_config, max_period,
+                                      SyncRange(from, range.to_),
+                                      progress, post_sync_action);
                  return;
              }
 
-            // Invoke post synchronization action if it was specified.
-            if (post_sync_action) {
-                post_sync_action(error_message.empty(),
-                                 error_message,
-                                 dhcp_disabled);
+            // This range is complete. Invoke post synchronization action if
+            // it was specified and all ranges are complete. The DHCP service
+            // of the partner was disabled before the first page.
+            if (progress->complete(error_message) && post_sync_action) {
+                post_sync_action(progress->error_message_.empty(),
+                                 progress->error_message_,
+                                 true);
             }
         },
         HttpClient::RequestTimeout(config_->getSyncTimeout()),
@@ -2387,6 +2486,210 @@ HAService::asyncSyncLeasesInternal(http::HttpClient& http_client,
 
 }
 
+uint64_t
+HAService::applySyncedLeases4(const Lease4Collection& new_leases,
+                              const Lease4Collection& updated_leases,
+                              const Lease4Collection& existing_leases) {
+    uint64_t applied_lease_count = 0;
+    if (!new_leases.empty()) {
+        try {
+            Lease4Collection not_added = LeaseMgrFactory::instance().addLeases(new_leases);
+            for (auto const& lease : new_leases) {
+                if (std::find(not_added.begin(), not_added.end(), lease) == not_added.end()) {
+                    ++applied_lease_count;
+                    LeaseMgr::updateStatsOnAdd(lease);
+                }
+            }
+
+        } catch (const std::exception&) {
+            // The database backends roll back the whole batch: add the
+            // leases one at a time to find out which one fails.
+            for (auto const& lease : new_leases) {
+                try {
+                    if (LeaseMgrFactory::instance().addLease(lease)) {
+                        ++applied_lease_count;
+                        LeaseMgr::updateStatsOnAdd(lease);
+                    }
+                } catch (const std::exception& ex) {
+                    LOG_WARN(ha_logger, HA_LEASE_SYNC_FAILED)
+                        .arg(config_->getThisServerName())
+                        .arg(lease->toElement()->str())
+                        .arg(ex.what());
+                }
+            }
+        }
+    }
+
+    if (!updated_leases.empty()) {
+        Lease4Collection not_updated;
+        try {
+            not_updated = LeaseMgrFactory::instance().updateLeases4(updated_leases);
+
+        } catch (const std::exception&) {
+            // The database backends roll back the whole batch: update the
+            // leases one at a time to find out which one fails.
+            for (size_t i = 0; i < updated_leases.size(); ++i) {
+                try {
+                    LeaseMgrFactory::instance().updateLease4(updated_leases[i]);
+                    ++applied_lease_count;
+                    LeaseMgr::updateStatsOnUpdate(existing_leases[i], updated_leases[i]);
+                } catch (const std::exception& ex) {
+                    LOG_WARN(ha_logger, HA_LEASE_SYNC_FAILED)
+                        .arg(config_->getThisServerName())
+                        .arg(updated_leases[i]->toElement()->str())
+                        .arg(ex.what());
+                }
+            }
+            return (applied_lease_count);
+        }
+
+        for (size_t i = 0; i < updated_leases.size(); ++i) {
+            if (std::find(not_updated.begin(), not_updated.end(), updated_leases[i]) !=
+                not_updated.end()) {
+                LOG_WARN(ha_logger, HA_LEASE_SYNC_FAILED)
+                    .arg(config_->getThisServerName())
+                    .arg(updated_leases[i]->toElement()->str())
+                    .arg("the lease has been deleted or it has changed in the database");
+            } else {
+                ++applied_lease_count;
+                LeaseMgr::updateStatsOnUpdate(existing_leases[i], updated_leases[i]);
+            }
+        }
+    }
+    return (applied_lease_count);
+}
+
+uint64_t
+HAService::applySyncedLeases6(const Lease6Collection& new_leases,
+                              const Lease6Collection& updated_leases,
+                              const Lease6Collection& existing_leases) {
+    uint64_t applied_lease_count = 0;
+    if (!new_leases.empty()) {
+        try {
+            Lease6Collection not_added = LeaseMgrFactory::instance().addLeases(new_leases);
+            for (auto const& lease : new_leases) {
+                if (std::find(not_added.begin(), not_added.end(), lease) == not_added.end()) {
+                    ++applied_lease_count;
+                    LeaseMgr::updateStatsOnAdd(lease);
+                }
+            }
+
+        } catch (const std::exception&) {
+            // The database backends roll back the whole batch: add the
+            // leases one at a time to find out which one fails.
+            for (auto const& lease : new_leases) {
+                try {
+                    if (LeaseMgrFactory::instance().addLease(lease)) {
+                        ++applied_lease_count;
+                        LeaseMgr::updateStatsOnAdd(lease);
+                    }
+                } catch (const std::exception& ex) {
+                    LOG_WARN(ha_logger, HA_LEASE_SYNC_FAILED)
+                        .arg(config_->getThisServerName())
+                        .arg(lease->toElement()->str())
+                        .arg(ex.what());
+                }
+            }
+        }
+    }
+
+    if (!updated_leases.empty()) {
+        Lease6Collection not_updated;
+        try {
+            not_updated = LeaseMgrFactory::instance().updateLeases6(updated_leases);
+
+        } catch (const std::exception&) {
+            // The database backends roll back the whole batch: update the
+            // leases one at a time to find out which one fails.
+            for (size_t i = 0; i < updated_leases.size(); ++i) {
+                try {
+                    LeaseMgrFactory::instance().updateLease6(updated_leases[i]);
+                    ++applied_lease_count;
+                    LeaseMgr::updateStatsOnUpdate(existing_leases[i], updated_leases[i]);
+                } catch (const std::exception& ex) {
+                    LOG_WARN(ha_logger, HA_LEASE_SYNC_FAILED)
+                        .arg(config_->getThisServerName())
+                        .arg(updated_leases[i]->toElement()->str())
+                        .arg(ex.what());
+                }
+            }
+            return (applied_lease_count);
+        }
+
+        for (size_t i = 0; i < updated_leases.size(); ++i) {
+            if (std::find(not_updated.begin(), not_updated.end(), updated_leases[i]) !=
+                not_updated.end()) {
+                LOG_WARN(ha_logger, HA_LEASE_SYNC_FAILED)
+                    .arg(config_->getThisServerName())
+                    .arg(updated_leases[i]->toElement()->str())
+                    .arg("the lease has been deleted or it has changed in the database");
+            } else {
+                ++applied_lease_count;
+                LeaseMgr::updateStatsOnUpdate(existing_leases[i], updated_leases[i]);
+            }
+        }
+    }
+    return (applied_lease_count);
+}
+
+std::vector<HAService::SyncRange>
+HAService::getSyncRanges() const {
+    bool v4 = (server_type_ == HAServerType::DHCPv4);
+    const IOAddress& zero = (v4 ? IOAddress::IPV4_ZERO_ADDRESS() :
+                             IOAddress::IPV6_ZERO_ADDRESS());
+    uint32_t count = config_->getSyncRanges();
+
+    // Collect the first addresses of the configured subnets.
+    std::vector<IOAddress> starts;
+    if (count > 1) {
+        auto const& cfg = CfgMgr::instance().getCurrentCfg();
+        if (v4) {
+            for (auto const& subnet : *cfg->getCfgSubnets4()->getAll()) {
+                starts.push_back(subnet->get().first);
+            }
+        } else {
+            for (auto const& subnet : *cfg->getCfgSubnets6()->getAll()) {
+                starts.push_back(subnet->get().first);
+            }
+        }
+        std::sort(starts.begin(), starts.end());
+    }
+
+    // Each range ends before the next boundary. Boundaries giving an empty
+    // range are skipped, so there may be fewer ranges than configured.
+    std::vector<SyncRange> ranges;
+    IOAddress from(zero);
+    const IOAddress one(v4 ? "0.0.0.1" : "::1");
+    for (uint32_t i = 1; i < count; ++i) {
+        size_t index = starts.size() * i / count;
+        if (index == 0) {
+            continue;
+        }
+        IOAddress to = IOAddress::subtract(starts[index], one);
+        if (from < to) {
+            ranges.push_back(SyncRange(from, to));
+            from = to;
+        }
+    }
+    ranges.push_back(SyncRange(from, zero));
+    return (ranges);
+}
+
+int64_t
+HAService::getSyncMinCltt() const {
+    if (!config_->getSyncDelta() || (sync_delta_mark_ == 0)) {
+        return (0);
+    }
+
+    // Lease updates sent shortly before the communication was interrupted
+    // may have failed, and the cltt is set by the partner using its own
+    // clock. The margin covers the time to detect the interruption and the
+    // clock skew tolerated before the servers terminate.
+    int64_t margin = config_->getMaxResponseDelay() / 1000 + 60;
+    int64_t min_cltt = static_cast<int64_t>(sync_delta_mark_) - margin;
+    return (min_cltt > 0 ? min_cltt : 0);
+}
+
 ConstElementPtr
 HAService::processSynchronize(const std::string& server_name,
                               const unsigned int max_period) {
@@ -2409,13 +2712,22 @@ HAService::processSynchronize(const std::string& server_name,
 int
 HAService::synchronize(std::string& status_message,
                        const HAConfig::PeerConfigPtr& remote_config,
-                       const unsigned int max_period) {
+                       const unsigned int max_period,
+                       const int64_t min_cltt) {
     lease_sync_filter_.apply();
 
     IOServicePtr io_service(new IOService());
-    HttpClient client(io_service, false);
 
-    asyncSyncLeases(client, remote_config, max_period, Lease4Ptr(),
+    // When multi-threading is enabled the ranges are fetched over
+    // separate connections, each handled by its own thread. Otherwise
+    // the requests share a single connection.
+    size_t client_threads = 0;
+    if (config_->getEnableMultiThreading() && (config_->getSyncRanges() > 1)) {
+        client_threads = config_->getSyncRanges();
+    }
+    HttpClient client(io_service, client_threads > 0, client_threads);
+
+    asyncSyncLeases(client, remote_config, max_period, min_cltt,
                     [&](const bool success, const std::string& error_message,
                         const bool dhcp_disabled) {
         // If there was a fatal error while fetching the leases, let's
@@ -2550,18 +2862,40 @@ HAService::asyncSendLeaseUpdatesFromBacklog(HttpClient& http_client,
         return;
     }
 
+    // Send the leases in batches of the synchronization page size.
     ConstElementPtr command;
+
+    // The DHCPv4 updates sent in a lease4-bulk-apply command. They are put
+    // back in the backlog if the partner does not support this command.
+    typedef std::vector<std::pair<LeaseUpdateBacklog::OpType, LeasePtr> > LeaseUpdates;
+    auto sent_updates = boost::make_shared<LeaseUpdates>();
+
     if (server_type_ == HAServerType::DHCPv4) {
         LeaseUpdateBacklog::OpType op_type;
-        Lease4Ptr lease = boost::dynamic_pointer_cast<Lease4>(lease_update_backlog_.pop(op_type));
-        if (op_type == LeaseUpdateBacklog::ADD) {
-            command = CommandCreator::createLease4Update(*lease);
+        if (lease4_bulk_apply_unsupported_) {
+            // The partner runs an older version: send the updates one
+            // at a time.
+            Lease4Ptr lease = boost::dynamic_pointer_cast<Lease4>(lease_update_backlog_.pop(op_type));
+            if (op_type == LeaseUpdateBacklog::ADD) {
+                command = CommandCreator::createLease4Update(*lease);
+            } else {
+                command = CommandCreator::createLease4Delete(*lease);
+            }
+
         } else {
-            command = CommandCreator::createLease4Delete(*lease);
+            LeaseUpdateBacklog batch(config_->getSyncPageLimit());
+            LeasePtr lease;
+            while ((sent_updates->size() < config_->getSyncPageLimit()) &&
+                   (lease = lease_update_backlog_.pop(op_type))) {
+                batch.push(op_type, lease);
+                sent_updates->push_back(std::make_pair(op_type, lease));
+            }
+            command = CommandCreator::createLease4BulkApply(batch);
         }
 
     } else {
-        command = CommandCreator::createLease6BulkApply(lease_update_backlog_);
+        command = CommandCreator::createLease6BulkApply(lease_update_backlog_,
+                                                        config_->getSyncPageLimit());
     }
 
     // Create HTTP/1.1 request including our command.
@@ -2578,7 +2912,7 @@ HAService::asyncSendLeaseUpdatesFromBacklog(HttpClient& http_client,
 
     http_client.asyncSendRequest(config->getUrl(), config->getTlsContext(),
                                  request, response,
-        [this, &http_client, config, post_request_action]
+        [this, &http_client, config, post_request_action, sent_updates]
             (const boost::system::error_code& ec,
              const HttpResponsePtr& http_response,
              const std::string& error_str) {
@@ -2597,6 +2931,25 @@ HAService::asyncSendLeaseUpdatesFromBacklog(HttpClient& http_client,
                  // Handle third group of errors.
                  try {
                     auto args = verifyAsyncResponse(http_response, rcode);
+                 } catch (const CommandUnsupportedError& ex) {
+                     if (!sent_updates->empty()) {
+                         // The partner does not support lease4-bulk-apply.
+                         // Put the updates back and send them one at a time.
+                         LOG_INFO(ha_logger, HA_LEASES_BACKLOG_BULK_APPLY_UNSUPPORTED)
+                             .arg(config_->getThisServerName())
+                             .arg(config->getLogLabel());
+                         lease4_bulk_apply_unsupported_ = true;
+                         for (auto update = sent_updates->rbegin();
+                              update != sent_updates->rend(); ++update) {
+                             lease_update_backlog_.pushFront(update->first, update->second);
+                         }
+                     } else {
+                         error_message = ex.what();
+                         LOG_WARN(ha_logger, HA_LEASES_BACKLOG_FAILED)
+                             .arg(config_->getThisServerName())
+                             .arg(config->getLogLabel())
+                             .arg(ex.what());
+                     }
                  } catch (const std::exception& ex) {
                      error_message = ex.what();
                      LOG_WARN(ha_logger, HA_LEASES_BACKLOG_FAILED)
@@ -2607,10 +2960,8 @@ HAService::asyncSendLeaseUpdatesFromBacklog(HttpClient& http_client,
              }
 
              // Recursively send all outstanding lease updates or break when an
-             // error occurs. In DHCPv6, this is a single iteration because we use
-             // lease6-bulk-apply, which combines many lease updates in a single
-             // transaction. In the case of DHCPv4, each update is sent in its own
-             // transaction.
+             // error occurs. Each iteration sends a batch of lease updates with
+             // the lease4-bulk-apply or lease6-bulk-apply command.
              if (error_message.empty()) {
                  asyncSendLeaseUpdatesFromBacklog(http_client, config, post_request_action);
              } else {
@@ -2633,6 +2984,9 @@ HAService::sendLeaseUpdatesFromBacklog() {
     auto remote_config = config_->getFailoverPeerConfig();
     bool updates_successful = true;
 
+    // The partner may have been upgraded since the last time.
+    lease4_bulk_apply_unsupported_ = false;
+
     LOG_INFO(ha_logger, HA_LEASES_BACKLOG_START)
         .arg(config_->getThisServerName())
         .arg(num_updates)
@@ -3236,7 +3590,7 @@ HAService::verifyAsyncResponse(const HttpResponsePtr& response, int& rcode) {
 
     std::ostringstream s;
 
-    // The empty status can occur for the lease6-bulk-apply command. In that
+    // The empty status can occur for the bulk apply commands. In that
     // case, the response may contain conflicted or erred leases within the
     // arguments, rather than globally. For other error cases let's construct
     // the error message from the global values.
@@ -3257,7 +3611,7 @@ HAService::verifyAsyncResponse(const HttpResponsePtr& response, int& rcode) {
         isc_throw(ConflictError, s.str());
 
     case CONTROL_RESULT_EMPTY:
-        // Handle the lease6-bulk-apply error cases.
+        // Handle the lease4-bulk-apply and lease6-bulk-apply error cases.
         if (args && (args->getType() == Element::map)) {
             auto failed_leases = args->get("failed-leases");
             if (!failed_leases || (failed_leases->getType() != Element::list)) {
@@ -855,6 +855,75 @@ protected:
     /// This method variant uses default HTTP client for communication.
     void asyncSyncLeases();
 
+    /// @brief Range of addresses fetched by a chain of lease page queries.
+    struct SyncRange {
+        /// @brief Constructor.
+        ///
+        /// @param from Address after which the range starts.
+        /// @param to Last address of the range or the zero address when
+        /// the range extends to the end of the address space.
+        SyncRange(const asiolink::IOAddress& from, const asiolink::IOAddress& to)
+            : from_(from), to_(to) {
+        }
+
+        /// @brief Address after which the next page starts.
+        asiolink::IOAddress from_;
+
+        /// @brief Last address of the range or the zero address.
+        asiolink::IOAddress to_;
+    };
+
+    /// @brief Progress of a lease database synchronization.
+    ///
+    /// The ranges of a synchronization are fetched concurrently. This
+    /// structure is shared by them to find which one completes last and
+    /// to stop all of them at the first error.
+    struct SyncProgress {
+        /// @brief Constructor.
+        ///
+        /// @param pending Number of ranges being fetched.
+        /// @param min_cltt Minimum cltt of the fetched leases.
+        SyncProgress(const size_t pending, const int64_t min_cltt)
+            : mutex_(), pending_(pending), error_message_(), min_cltt_(min_cltt) {
+        }
+
+        /// @brief Checks if the synchronization failed.
+        ///
+        /// @return true if one of the ranges reported an error.
+        bool failed() {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return (!error_message_.empty());
+        }
+
+        /// @brief Records the completion of a range.
+        ///
+        /// @param error_message Error message or an empty string on success.
+        /// The first error message is kept.
+        /// @return true if this was the last range being fetched.
+        bool complete(const std::string& error_message) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (error_message_.empty()) {
+                error_message_ = error_message;
+            }
+            return (--pending_ == 0);
+        }
+
+        /// @brief Mutex protecting the progress.
+        std::mutex mutex_;
+
+        /// @brief Number of ranges being fetched.
+        size_t pending_;
+
+        /// @brief First error message.
+        std::string error_message_;
+
+        /// @brief Minimum cltt of the fetched leases (0 fetches all leases).
+        const int64_t min_cltt_;
+    };
+
+    /// @brief Pointer to the synchronization progress.
+    typedef boost::shared_ptr<SyncProgress> SyncProgressPtr;
+
     /// @brief Asynchronously reads leases from a peer and updates local
     /// lease database using a provided client instance.
     ///
@@ -873,11 +942,17 @@ protected:
     /// longer period of time. If the synchronization is progressing the
     /// timeout must be deferred.
     ///
-    /// The @c asyncSyncLeases method calls itself (recurses) when the previous
-    /// @c lease4-get-page or @c lease6-get-page command has completed
-    /// successfully. If the last page of leases was fetched or if any
-    /// error occurred, the synchronization is terminated and the
-    /// @c post_sync_action callback is invoked.
+    /// When the @c sync-ranges parameter is greater than 1, the address
+    /// space is split in ranges (see @c HAService::getSyncRanges) and the
+    /// pages of the ranges are fetched concurrently. When @c min_cltt is
+    /// not 0 only the leases modified since this time are fetched.
+    ///
+    /// The @c HAService::asyncSyncLeasesInternal method continues with
+    /// the next page of a range when the previous @c lease4-get-page or
+    /// @c lease6-get-page command has completed successfully. When the last
+    /// page of all ranges was fetched or if any error occurred, the
+    /// synchronization is terminated and the @c post_sync_action callback
+    /// is invoked.
     ///
     /// The last parameter passed to the @c post_sync_action callback indicates
     /// whether this server has successfully disabled DHCP service on
@@ -893,11 +968,8 @@ protected:
     /// with the other server.
     /// @param remote_config config of the partner to fetch leases from.
     /// @param max_period maximum number of seconds to disable DHCP service
-    /// @param last_lease Pointer to the last lease returned on the previous
-    /// page of leases. This lease is used to set the value of the "from"
-    /// parameter in the @c lease4-get-page and @c lease6-get-page commands. If this
-    /// command is sent to fetch the first page, the @c last_lease parameter
-    /// should be set to null.
+    /// @param min_cltt When not 0 only the leases with a greater or equal
+    /// cltt are fetched.
     /// @param post_sync_action pointer to the function to be executed when
     /// lease database synchronization is complete. If this is null, no
     /// post synchronization action is invoked.
@@ -908,42 +980,111 @@ protected:
     void asyncSyncLeases(http::HttpClient& http_client,
                          const HAConfig::PeerConfigPtr& remote_config,
                          const unsigned int max_period,
-                         const dhcp::LeasePtr& last_lease,
+                         const int64_t min_cltt,
                          PostSyncCallback post_sync_action,
                          const bool dhcp_disabled = false);
 
+    /// @brief Fetches the next page of a range during synchronization.
+    ///
+    /// It sends the @c dhcp-disable command to defer the automatic
+    /// re-enabling of the DHCP service on the partner and then calls
+    /// @c HAService::asyncSyncLeasesInternal.
+    ///
+    /// @param http_client reference to the client to be used to communicate
+    /// with the other server.
+    /// @param remote_config config of the partner to fetch leases from.
+    /// @param max_period maximum number of seconds to disable DHCP service
+    /// @param range The range with the address after which the page starts.
+    /// @param progress The synchronization progress.
+    /// @param post_sync_action pointer to the function to be executed when
+    /// lease database synchronization is complete.
+    void asyncSyncLeasesRange(http::HttpClient& http_client,
+                              const HAConfig::PeerConfigPtr& remote_config,
+                              const unsigned int max_period,
+                              const SyncRange& range,
+                              const SyncProgressPtr& progress,
+                              PostSyncCallback post_sync_action);
+
     /// @brief Implements fetching one page of leases during synchronization.
     ///
     /// This method implements the actual lease fetching from the partner
     /// and synchronization of the database. It excludes sending @c dhcp-disable
-    /// command. This command is sent by @c HAService::asyncSyncLeases.
+    /// command. This command is sent by @c HAService::asyncSyncLeases and
+    /// @c HAService::asyncSyncLeasesRange.
     ///
-    /// When the page of leases is successfully synchronized, this method
-    /// will call @c HAService::asyncSyncLeases to schedule synchronization of
-    /// the next page of leases.
+    /// When the page of leases is successfully synchronized and the end of
+    /// the range was not reached, this method calls
+    /// @c HAService::asyncSyncLeasesRange to schedule synchronization of
+    /// the next page of leases. Otherwise it records the completion of the
+    /// range in the progress and invokes the @c post_sync_action when it
+    /// was the last range.
     ///
     /// @param http_client reference to the client to be used to communicate
     /// with the other server.
     /// @param remote_config config of the partner to fetch leases from.
     /// @param max_period maximum number of seconds to disable DHCP service
-    /// @param last_lease Pointer to the last lease returned on the previous
-    /// page of leases. This lease is used to set the value of the "from"
-    /// parameter in the lease4-get-page and lease6-get-page commands. If this
-    /// command is sent to fetch the first page, the @c last_lease parameter
-    /// should be set to null.
+    /// @param range The range with the address after which the page starts.
+    /// @param progress The synchronization progress.
     /// @param post_sync_action pointer to the function to be executed when
     /// lease database synchronization is complete. If this is null, no
     /// post synchronization action is invoked.
-    /// @param dhcp_disabled Boolean flag indicating if the remote DHCP
-    /// server is disabled. This flag propagates down to the
-    /// @c post_sync_action to indicate whether the DHCP service has to
-    /// be enabled after the leases synchronization.
     void asyncSyncLeasesInternal(http::HttpClient& http_client,
                                  const HAConfig::PeerConfigPtr& remote_config,
                                  const unsigned int max_period,
-                                 const dhcp::LeasePtr& last_lease,
-                                 PostSyncCallback post_sync_action,
-                                 const bool dhcp_disabled);
+                                 const SyncRange& range,
+                                 const SyncProgressPtr& progress,
+                                 PostSyncCallback post_sync_action);
+
+    /// @brief Writes a page of IPv4 leases fetched from the partner.
+    ///
+    /// The new leases are written with @c LeaseMgr::addLeases and the
+    /// existing ones with @c LeaseMgr::updateLeases4, i.e. in one
+    /// transaction each with the database backends. If a batch write
+    /// fails its leases are written one at a time and the failing ones
+    /// are logged.
+    ///
+    /// @param new_leases The leases which are not in the local database.
+    /// @param updated_leases The leases which are newer than the local ones.
+    /// @param existing_leases The local leases, in the order of
+    /// @c updated_leases, used to update the statistics.
+    ///
+    /// @return The number of leases written.
+    uint64_t applySyncedLeases4(const dhcp::Lease4Collection& new_leases,
+                                const dhcp::Lease4Collection& updated_leases,
+                                const dhcp::Lease4Collection& existing_leases);
+
+    /// @brief Writes a page of IPv6 leases fetched from the partner.
+    ///
+    /// See the IPv4 version for details.
+    ///
+    /// @param new_leases The leases which are not in the local database.
+    /// @param updated_leases The leases which are newer than the local ones.
+    /// @param existing_leases The local leases, in the order of
+    /// @c updated_leases, used to update the statistics.
+    ///
+    /// @return The number of leases written.
+    uint64_t applySyncedLeases6(const dhcp::Lease6Collection& new_leases,
+                                const dhcp::Lease6Collection& updated_leases,
+                                const dhcp::Lease6Collection& existing_leases);
+
+    /// @brief Splits the address space in ranges synchronized in parallel.
+    ///
+    /// The boundaries are the first addresses of the configured subnets,
+    /// chosen so that each of the @c sync-ranges ranges holds about the same
+    /// number of subnets. Together the ranges always cover the whole address
+    /// space, so leases outside of the configured subnets are synchronized too.
+    ///
+    /// @return The ranges, at least one.
+    std::vector<SyncRange> getSyncRanges() const;
+
+    /// @brief Returns the minimum cltt of the leases to synchronize.
+    ///
+    /// When @c sync-delta is enabled and the servers were in sync before,
+    /// only the leases modified after the servers were last known to be
+    /// exchanging lease updates, minus a safety margin, need to be fetched.
+    ///
+    /// @return The minimum cltt or 0 when all leases must be fetched.
+    int64_t getSyncMinCltt() const;
 
 public:
 
@@ -988,21 +1129,23 @@ protected:
     /// @param max_period maximum number of seconds to disable DHCP service
     /// of the peer. This value is used in dhcp-disable command issued to
     /// the peer before the lease4-get-page command.
+    /// @param min_cltt When not 0 only the leases with a greater or equal
+    /// cltt are fetched.
     ///
     /// @return Synchronization result according to the status codes returned
     /// in responses to control commands.
     int synchronize(std::string& status_message,
                     const HAConfig::PeerConfigPtr& remote_config,
-                    const unsigned int max_period);
+                    const unsigned int max_period,
+                    const int64_t min_cltt = 0);
 
     /// @brief Sends lease updates from backlog to partner asynchronously.
     ///
     /// This method checks if there are any outstanding DHCPv4 or DHCPv6 leases
-    /// in the backlog and schedules asynchronous sends of these leases. In
-    /// DHCPv6 case it sends a single lease6-bulk-apply command with all
-    /// outstanding leases. In DHCPv4 case, it sends lease4-update or lease4-delete
-    /// commands recursively (when one lease update completes successfully it
-    /// schedules sending next lease update).
+    /// in the backlog and schedules asynchronous sends of these leases. It
+    /// sends lease4-bulk-apply or lease6-bulk-apply commands holding at most
+    /// the synchronization page limit of leases recursively (when one command
+    /// completes successfully it schedules sending the next one).
     ///
     /// If there are no lease updates in the backlog it calls @c post_request_action
     /// callback.
@@ -1215,7 +1358,7 @@ protected:
     /// @throw CommandUnsupportedError if sent command is unsupported.
     /// @throw ConflictError if the response comprises the conflict status
     /// code or it contains an empty status code in response to the
-    /// lease6-bulk-apply and there are leases with the conflict status
+    /// bulk apply commands and there are leases with the conflict status
     /// codes listed in the response.
     data::ConstElementPtr verifyAsyncResponse(const http::HttpResponsePtr& response,
                                               int& rcode);
@@ -1421,6 +1564,22 @@ protected:
     /// re-established. If the communication remains broken, the server clears
     /// this flag and enables DHCP service to continue the service.
     bool sync_complete_notified_;
+
+    /// @brief Last time the servers were known to be in sync.
+    ///
+    /// It is set when a heartbeat succeeds while both servers are in the
+    /// normal state and exchange lease updates. It is 0 until then, e.g.
+    /// after a restart, so the first synchronization fetches all leases.
+    time_t sync_delta_mark_;
+
+    /// @brief Indicates that the partner does not support lease4-bulk-apply.
+    ///
+    /// It is set when the partner, e.g. running an older version during a
+    /// rolling upgrade, rejects the lease4-bulk-apply command while the
+    /// lease updates backlog is sent. The remaining updates are then sent
+    /// one at a time with lease4-update and lease4-del. It is reset each
+    /// time the sending of the backlog starts.
+    bool lease4_bulk_apply_unsupported_;
 };
 
 /// @brief Pointer to the @c HAService class.
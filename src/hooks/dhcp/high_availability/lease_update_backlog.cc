@@ -1,4 +1,4 @@
-// Copyright (C) 2020-2021 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2020-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -36,6 +36,16 @@ LeaseUpdateBacklog::pop(LeaseUpdateBacklog::OpType& op_type) {
     return (popInternal(op_type));
 }
 
+void
+LeaseUpdateBacklog::pushFront(const LeaseUpdateBacklog::OpType op_type, const LeasePtr& lease) {
+    if (util::MultiThreadingMgr::instance().getMode()) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pushFrontInternal(op_type, lease);
+        return;
+    }
+    pushFrontInternal(op_type, lease);
+}
+
 bool
 LeaseUpdateBacklog::wasOverflown() {
     if (util::MultiThreadingMgr::instance().getMode()) {
@@ -67,14 +77,34 @@ LeaseUpdateBacklog::size() {
 
 bool
 LeaseUpdateBacklog::pushInternal(const LeaseUpdateBacklog::OpType op_type, const LeasePtr& lease) {
+    // Replace the previous update of the lease: only its latest state
+    // matters to the partner.
+    auto& index = outstanding_updates_.get<1>();
+    auto existing = index.find(boost::make_tuple(lease->getType(), lease->addr_));
+    if (existing != index.end()) {
+        index.replace(existing, LeaseUpdate(op_type, lease));
+        auto& sequence = outstanding_updates_.get<0>();
+        sequence.relocate(sequence.end(), outstanding_updates_.project<0>(existing));
+        return (true);
+    }
     if (outstanding_updates_.size() >= limit_) {
         overflown_ = true;
         return (false);
     }
-    outstanding_updates_.push_back(std::make_pair(op_type, lease));
+    outstanding_updates_.push_back(LeaseUpdate(op_type, lease));
     return (true);
 }
 
+void
+LeaseUpdateBacklog::pushFrontInternal(const LeaseUpdateBacklog::OpType op_type, const LeasePtr& lease) {
+    // A newer update of the lease supersedes this one.
+    auto& index = outstanding_updates_.get<1>();
+    if (index.find(boost::make_tuple(lease->getType(), lease->addr_)) != index.end()) {
+        return;
+    }
+    outstanding_updates_.push_front(LeaseUpdate(op_type, lease));
+}
+
 LeasePtr
 LeaseUpdateBacklog::popInternal(LeaseUpdateBacklog::OpType& op_type) {
     if (outstanding_updates_.empty()) {
@@ -82,8 +112,8 @@ LeaseUpdateBacklog::popInternal(LeaseUpdateBacklog::OpType& op_type) {
     }
     auto item = outstanding_updates_.front();
     outstanding_updates_.pop_front();
-    op_type = item.first;
-    return (item.second);
+    op_type = item.op_type_;
+    return (item.lease_);
 }
 
 } // end of namespace isc::ha
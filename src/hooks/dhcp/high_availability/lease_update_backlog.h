@@ -1,4 +1,4 @@
-// Copyright (C) 2020-2021 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2020-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -7,8 +7,13 @@
 #ifndef HA_LEASE_BACKLOG_H
 #define HA_LEASE_BACKLOG_H
 
+#include <asiolink/io_address.h>
 #include <dhcpsrv/lease.h>
-#include <deque>
+#include <boost/multi_index_container.hpp>
+#include <boost/multi_index/composite_key.hpp>
+#include <boost/multi_index/hashed_index.hpp>
+#include <boost/multi_index/member.hpp>
+#include <boost/multi_index/sequenced_index.hpp>
 #include <mutex>
 #include <utility>
 
@@ -32,16 +37,15 @@ namespace ha {
 /// There are two types of lease updates: "Add" and "Delete". The type
 /// is specified when the lease is appended to the queue.
 ///
-/// The backlog queue holds both "Add" and "Delete" lease updates in a
-/// single std::deque container, which allows for ordering them
-/// chronologically and using this ordering for queue optimizations in
-/// the future. For example, if the queue contains consecutive "Delete"
-/// updates for a particular IP address, the server could only delete
-/// the lease once. If the queue contains multiple "Delete" lease updates
-/// followed by an "Add" update, the server could skip sending "Delete"
-/// updates.
-///
-/// Queue optimizations will be subject to future work!
+/// The queue holds at most one update per lease, identified by the lease
+/// type and address. When an update is appended for a lease which already
+/// has an update in the queue, the previous update is replaced with the new
+/// one and moved to the end of the queue: only the latest state of the lease
+/// is sent to the partner. For example, a client renewing its lease many
+/// times during the communication interruption results in a single update,
+/// and a lease allocated and then released results in a single "Delete"
+/// update. Therefore, the size limit is expressed in distinct leases rather
+/// than in lease updates.
 class LeaseUpdateBacklog {
 public:
 
@@ -53,12 +57,15 @@ public:
 
     /// @brief Constructor.
     ///
-    /// @param limit specifies the maximum number of lease updates which
+    /// @param limit specifies the maximum number of distinct leases which
     /// can be stored in the queue.
     LeaseUpdateBacklog(const size_t limit);
 
     /// @brief Appends lease update to the queue.
     ///
+    /// If the queue already holds an update for the lease, this update is
+    /// replaced (this never exceeds the limit).
+    ///
     /// @param op_type type of the lease update (operation type).
     /// @param lease pointer to the lease being added, or deleted.
     /// @return boolean value indicating whether the lease was successfully
@@ -72,6 +79,17 @@ public:
     /// when the queue is empty.
     dhcp::LeasePtr pop(OpType& op_type);
 
+    /// @brief Puts back a lease update at the front of the queue.
+    ///
+    /// It is used to return an update which was popped but could not be
+    /// sent. The update is dropped if the queue already holds a newer
+    /// update of the lease. The size limit is not checked because the
+    /// update was in the queue before.
+    ///
+    /// @param op_type type of the lease update (operation type).
+    /// @param lease pointer to the lease being added, or deleted.
+    void pushFront(const OpType op_type, const dhcp::LeasePtr& lease);
+
     /// @brief Checks if the queue was overflown.
     ///
     /// This method returns true if the number of lease updates exceeded
@@ -105,6 +123,12 @@ private:
     /// appended to the queue (if true) or not (if false).
     bool pushInternal(const OpType op_type, const dhcp::LeasePtr& lease);
 
+    /// @brief Puts back a lease update at the front of the queue (thread unsafe).
+    ///
+    /// @param op_type type of the lease update (operation type).
+    /// @param lease pointer to the lease being added, or deleted.
+    void pushFrontInternal(const OpType op_type, const dhcp::LeasePtr& lease);
+
     /// @brief Returns the next lease update and removes it from the queue (thread unsafe).
     ///
     /// @param [out] op_type reference to the value receiving lease update type.
@@ -112,6 +136,56 @@ private:
     /// when the queue is empty.
     dhcp::LeasePtr popInternal(OpType& op_type);
 
+    /// @brief Lease update held in the queue.
+    struct LeaseUpdate {
+
+        /// @brief Constructor.
+        ///
+        /// @param op_type type of the lease update (operation type).
+        /// @param lease pointer to the lease being added, or deleted.
+        LeaseUpdate(const OpType op_type, const dhcp::LeasePtr& lease)
+            : op_type_(op_type), lease_(lease), type_(lease->getType()),
+              addr_(lease->addr_) {
+        }
+
+        /// @brief Type of the lease update.
+        OpType op_type_;
+
+        /// @brief The lease.
+        dhcp::LeasePtr lease_;
+
+        /// @brief Lease type (part of the key).
+        dhcp::Lease::Type type_;
+
+        /// @brief Lease address (part of the key).
+        asiolink::IOAddress addr_;
+    };
+
+    /// @brief Container of lease updates.
+    ///
+    /// The first index keeps the updates in the order of their last
+    /// change, the second index finds the update of a lease.
+    typedef boost::multi_index_container<
+        LeaseUpdate,
+        boost::multi_index::indexed_by<
+            // Chronological order.
+            boost::multi_index::sequenced<>,
+
+            // Lease type and address.
+            boost::multi_index::hashed_unique<
+                boost::multi_index::composite_key<
+                    LeaseUpdate,
+                    boost::multi_index::member<
+                        LeaseUpdate, dhcp::Lease::Type, &LeaseUpdate::type_
+                    >,
+                    boost::multi_index::member<
+                        LeaseUpdate, asiolink::IOAddress, &LeaseUpdate::addr_
+                    >
+                >
+            >
+        >
+    > LeaseUpdateContainer;
+
     /// @brief Holds the queue size limit.
     size_t limit_;
 
@@ -119,7 +193,7 @@ private:
     bool overflown_;
 
     /// @brief Actual queue of lease updates and their types.
-    std::deque<std::pair<OpType, dhcp::LeasePtr> > outstanding_updates_;
+    LeaseUpdateContainer outstanding_updates_;
 
     /// @brief Mutex to protect internal state.
     std::mutex mutex_;
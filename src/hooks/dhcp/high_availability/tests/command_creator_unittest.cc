@@ -248,6 +248,61 @@ TEST(CommandCreatorTest, createLease4Delete) {
     EXPECT_EQ(lease_as_json->str(), arguments->str());
 }
 
+// This test verifies that the lease4-bulk-apply command can be created
+// from DHCPv4 leases backlog.
+TEST(CommandCreatorTest, createLease4BulkApplyFromBacklog) {
+    Lease4Ptr lease = createLease4();
+    Lease4Ptr deleted_lease = createLease4();
+    deleted_lease->addr_ = IOAddress("192.2.3.4");
+    Lease4Ptr other_lease = createLease4();
+    other_lease->addr_ = IOAddress("192.3.4.5");
+
+    LeaseUpdateBacklog backlog(100);
+    backlog.push(LeaseUpdateBacklog::ADD, lease);
+    backlog.push(LeaseUpdateBacklog::DELETE, deleted_lease);
+    backlog.push(LeaseUpdateBacklog::ADD, other_lease);
+
+    // Take the first two leases.
+    ConstElementPtr command = CommandCreator::createLease4BulkApply(backlog, 2);
+    ConstElementPtr arguments;
+    ASSERT_NO_FATAL_FAILURE(testCommandBasics(command, "lease4-bulk-apply",
+                                              "dhcp4", arguments));
+
+    ConstElementPtr origin = arguments->get("origin");
+    ASSERT_TRUE(origin);
+    ASSERT_EQ("ha-partner", origin->stringValue());
+
+    // Verify deleted-leases.
+    auto deleted_leases_json = arguments->get("deleted-leases");
+    ASSERT_TRUE(deleted_leases_json);
+    ASSERT_EQ(Element::list, deleted_leases_json->getType());
+    ASSERT_EQ(1U, deleted_leases_json->size());
+    auto lease_as_json = deleted_leases_json->get(0);
+    EXPECT_EQ(leaseAsJson(deleted_lease)->str(), lease_as_json->str());
+
+    // Verify leases.
+    auto leases_json = arguments->get("leases");
+    ASSERT_TRUE(leases_json);
+    ASSERT_EQ(Element::list, leases_json->getType());
+    ASSERT_EQ(1U, leases_json->size());
+    lease_as_json = leases_json->get(0);
+    EXPECT_EQ(leaseAsJson(lease)->str(), lease_as_json->str());
+
+    // The third lease remains in the backlog.
+    EXPECT_EQ(1U, backlog.size());
+    command = CommandCreator::createLease4BulkApply(backlog);
+    ASSERT_NO_FATAL_FAILURE(testCommandBasics(command, "lease4-bulk-apply",
+                                              "dhcp4", arguments));
+    leases_json = arguments->get("leases");
+    ASSERT_TRUE(leases_json);
+    ASSERT_EQ(1U, leases_json->size());
+    EXPECT_EQ(leaseAsJson(other_lease)->str(), leases_json->get(0)->str());
+    EXPECT_EQ(0U, arguments->get("deleted-leases")->size());
+
+    // Make sure the backlog is now empty.
+    EXPECT_EQ(0U, backlog.size());
+}
+
 // This test verifies that the lease4-get-all command is correct.
 TEST(CommandCreatorTest, createLease4GetAll) {
     ConstElementPtr command = CommandCreator::createLease4GetAll();
@@ -303,6 +358,52 @@ TEST(CommandCreatorTest, createLease4GetPageZeroLimit) {
     EXPECT_THROW(CommandCreator::createLease4GetPage(lease4, 0), BadValue);
 }
 
+// This test verifies that the lease4-get-page command is correct when
+// a range of addresses and a minimum cltt are specified.
+TEST(CommandCreatorTest, createLease4GetPageRange) {
+    ConstElementPtr command =
+        CommandCreator::createLease4GetPage(IOAddress("192.0.2.255"),
+                                            IOAddress("192.0.3.255"),
+                                            20, 1000);
+    ConstElementPtr arguments;
+    ASSERT_NO_FATAL_FAILURE(testCommandBasics(command, "lease4-get-page", "dhcp4",
+                                              arguments));
+
+    ConstElementPtr from = arguments->get("from");
+    ASSERT_TRUE(from);
+    EXPECT_EQ("192.0.2.255", from->stringValue());
+
+    ConstElementPtr to = arguments->get("to");
+    ASSERT_TRUE(to);
+    EXPECT_EQ("192.0.3.255", to->stringValue());
+
+    ConstElementPtr limit = arguments->get("limit");
+    ASSERT_TRUE(limit);
+    EXPECT_EQ(20, limit->intValue());
+
+    ConstElementPtr min_cltt = arguments->get("min-cltt");
+    ASSERT_TRUE(min_cltt);
+    ASSERT_EQ(Element::integer, min_cltt->getType());
+    EXPECT_EQ(1000, min_cltt->intValue());
+
+    // The zero addresses and the 0 minimum cltt give the first page
+    // without restrictions.
+    command = CommandCreator::createLease4GetPage(IOAddress::IPV4_ZERO_ADDRESS(),
+                                                  IOAddress::IPV4_ZERO_ADDRESS(),
+                                                  20, 0);
+    ASSERT_NO_FATAL_FAILURE(testCommandBasics(command, "lease4-get-page", "dhcp4",
+                                              arguments));
+    from = arguments->get("from");
+    ASSERT_TRUE(from);
+    EXPECT_EQ("start", from->stringValue());
+    EXPECT_FALSE(arguments->get("to"));
+    EXPECT_FALSE(arguments->get("min-cltt"));
+
+    EXPECT_THROW(CommandCreator::createLease4GetPage(IOAddress::IPV4_ZERO_ADDRESS(),
+                                                     IOAddress::IPV4_ZERO_ADDRESS(),
+                                                     0, 0), BadValue);
+}
+
 // This test verifies that the dhcp-disable command (DHCPv6 case) is
 // correct.
 TEST(CommandCreatorTest, createDHCPDisable6) {
@@ -470,6 +571,7 @@ TEST(CommandCreatorTest, createLease6BulkApplySoftDelete) {
 TEST(CommandCreatorTest, createLease6BulkApplyFromBacklog) {
     Lease6Ptr lease = createLease6();
     Lease6Ptr deleted_lease = createLease6();
+    deleted_lease->addr_ = IOAddress("2001:db8:1::efac");
 
     LeaseUpdateBacklog backlog(100);
     backlog.push(LeaseUpdateBacklog::ADD, lease);
@@ -490,7 +592,7 @@ TEST(CommandCreatorTest, createLease6BulkApplyFromBacklog) {
     ASSERT_EQ(Element::list, deleted_leases_json->getType());
     ASSERT_EQ(1U, deleted_leases_json->size());
     auto lease_as_json = deleted_leases_json->get(0);
-    EXPECT_EQ(leaseAsJson(createLease6())->str(), lease_as_json->str());
+    EXPECT_EQ(leaseAsJson(deleted_lease)->str(), lease_as_json->str());
 
     // Verify leases.
     auto leases_json = arguments->get("leases");
@@ -560,6 +662,52 @@ TEST(CommandCreatorTest, createLease6GetPageZeroLimit) {
     EXPECT_THROW(CommandCreator::createLease6GetPage(lease6, 0), BadValue);
 }
 
+// This test verifies that the lease6-get-page command is correct when
+// a range of addresses and a minimum cltt are specified.
+TEST(CommandCreatorTest, createLease6GetPageRange) {
+    ConstElementPtr command =
+        CommandCreator::createLease6GetPage(IOAddress("2001:db8:1::ffff"),
+                                            IOAddress("2001:db8:2::ffff"),
+                                            20, 1000);
+    ConstElementPtr arguments;
+    ASSERT_NO_FATAL_FAILURE(testCommandBasics(command, "lease6-get-page", "dhcp6",
+                                              arguments));
+
+    ConstElementPtr from = arguments->get("from");
+    ASSERT_TRUE(from);
+    EXPECT_EQ("2001:db8:1::ffff", from->stringValue());
+
+    ConstElementPtr to = arguments->get("to");
+    ASSERT_TRUE(to);
+    EXPECT_EQ("2001:db8:2::ffff", to->stringValue());
+
+    ConstElementPtr limit = arguments->get("limit");
+    ASSERT_TRUE(limit);
+    EXPECT_EQ(20, limit->intValue());
+
+    ConstElementPtr min_cltt = arguments->get("min-cltt");
+    ASSERT_TRUE(min_cltt);
+    ASSERT_EQ(Element::integer, min_cltt->getType());
+    EXPECT_EQ(1000, min_cltt->intValue());
+
+    // The zero addresses and the 0 minimum cltt give the first page
+    // without restrictions.
+    command = CommandCreator::createLease6GetPage(IOAddress::IPV6_ZERO_ADDRESS(),
+                                                  IOAddress::IPV6_ZERO_ADDRESS(),
+                                                  20, 0);
+    ASSERT_NO_FATAL_FAILURE(testCommandBasics(command, "lease6-get-page", "dhcp6",
+                                              arguments));
+    from = arguments->get("from");
+    ASSERT_TRUE(from);
+    EXPECT_EQ("start", from->stringValue());
+    EXPECT_FALSE(arguments->get("to"));
+    EXPECT_FALSE(arguments->get("min-cltt"));
+
+    EXPECT_THROW(CommandCreator::createLease6GetPage(IOAddress::IPV6_ZERO_ADDRESS(),
+                                                     IOAddress::IPV6_ZERO_ADDRESS(),
+                                                     0, 0), BadValue);
+}
+
 // This test verifies that the ha-maintenance-notify command is correct
 // while being sent to the DHCPv4 server.
 TEST(CommandCreatorTest, createMaintenanceNotify4) {
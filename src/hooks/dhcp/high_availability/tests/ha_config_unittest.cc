@@ -78,6 +78,8 @@ TEST_F(HAConfigTest, configureLoadBalancing) {
         "        \"sync-leases\": false,"
         "        \"sync-timeout\": 20000,"
         "        \"sync-page-limit\": 3,"
+        "        \"sync-ranges\": 4,"
+        "        \"sync-delta\": true,"
         "        \"delayed-updates-limit\": 111,"
         "        \"heartbeat-delay\": 8,"
         "        \"max-response-delay\": 11,"
@@ -135,6 +137,8 @@ TEST_F(HAConfigTest, configureLoadBalancing) {
     EXPECT_FALSE(impl->getConfig()->amSyncingLeases());
     EXPECT_EQ(20000U, impl->getConfig()->getSyncTimeout());
     EXPECT_EQ(3U, impl->getConfig()->getSyncPageLimit());
+    EXPECT_EQ(4U, impl->getConfig()->getSyncRanges());
+    EXPECT_TRUE(impl->getConfig()->getSyncDelta());
     EXPECT_EQ(111U, impl->getConfig()->getDelayedUpdatesLimit());
     EXPECT_TRUE(impl->getConfig()->amAllowingCommRecovery());
     EXPECT_EQ(8U, impl->getConfig()->getHeartbeatDelay());
@@ -230,6 +234,7 @@ TEST_F(HAConfigTest, configureLoadBalancing) {
     EXPECT_TRUE(impl->getConfig()->getHttpDedicatedListener());
     EXPECT_EQ(hardware_threads_, impl->getConfig()->getHttpListenerThreads());
     EXPECT_EQ(hardware_threads_, impl->getConfig()->getHttpClientThreads());
+    EXPECT_EQ(1U, impl->getConfig()->getHttpClientPipelineDepth());
 }
 
 // Verifies that hot standby configuration is parsed correctly.
@@ -271,6 +276,8 @@ TEST_F(HAConfigTest, configureHotStandby) {
     EXPECT_TRUE(impl->getConfig()->amSyncingLeases());
     EXPECT_EQ(60000U, impl->getConfig()->getSyncTimeout());
     EXPECT_EQ(10000U, impl->getConfig()->getSyncPageLimit());
+    EXPECT_EQ(1U, impl->getConfig()->getSyncRanges());
+    EXPECT_FALSE(impl->getConfig()->getSyncDelta());
     EXPECT_EQ(0U, impl->getConfig()->getDelayedUpdatesLimit());
     EXPECT_FALSE(impl->getConfig()->amAllowingCommRecovery());
     EXPECT_EQ(10000U, impl->getConfig()->getHeartbeatDelay());
@@ -597,6 +604,35 @@ TEST_F(HAConfigTest, unsupportedMode) {
         "unsupported value 'unsupported-mode' for mode parameter");
 }
 
+// Error should be returned when http-client-pipeline-depth is 0.
+TEST_F(HAConfigTest, zeroHttpClientPipelineDepth) {
+    testInvalidConfig(
+        "["
+        "    {"
+        "        \"this-server-name\": \"server1\","
+        "        \"mode\": \"load-balancing\","
+        "        \"multi-threading\": {"
+        "            \"http-client-pipeline-depth\": 0"
+        "        },"
+        "        \"peers\": ["
+        "            {"
+        "                \"name\": \"server1\","
+        "                \"url\": \"http://127.0.0.1:8080/\","
+        "                \"role\": \"primary\","
+        "                \"auto-failover\": false"
+        "            },"
+        "            {"
+        "                \"name\": \"server2\","
+        "                \"url\": \"http://127.0.0.1:8080/\","
+        "                \"role\": \"secondary\","
+        "                \"auto-failover\": true"
+        "            }"
+        "        ]"
+        "    }"
+        "]",
+        "'http-client-pipeline-depth' must be greater than 0");
+}
+
 // Error should be returned when heartbeat-delay is negative.
 TEST_F(HAConfigTest, negativeHeartbeatDelay) {
     testInvalidConfig(
@@ -624,6 +660,33 @@ TEST_F(HAConfigTest, negativeHeartbeatDelay) {
         "'heartbeat-delay' must not be negative");
 }
 
+// Error should be returned when sync-ranges is 0.
+TEST_F(HAConfigTest, zeroSyncRanges) {
+    testInvalidConfig(
+        "["
+        "    {"
+        "        \"this-server-name\": \"server1\","
+        "        \"mode\": \"load-balancing\","
+        "        \"sync-ranges\": 0,"
+        "        \"peers\": ["
+        "            {"
+        "                \"name\": \"server1\","
+        "                \"url\": \"http://127.0.0.1:8080/\","
+        "                \"role\": \"primary\","
+        "                \"auto-failover\": false"
+        "            },"
+        "            {"
+        "                \"name\": \"server2\","
+        "                \"url\": \"http://127.0.0.1:8080/\","
+        "                \"role\": \"secondary\","
+        "                \"auto-failover\": true"
+        "            }"
+        "        ]"
+        "    }"
+        "]",
+        "'sync-ranges' must be greater than 0");
+}
+
 // Error should be returned when heartbeat-delay is too large.
 TEST_F(HAConfigTest, largeHeartbeatDelay) {
     int64_t heartbeat_delay_max = std::numeric_limits<uint32_t>::max();
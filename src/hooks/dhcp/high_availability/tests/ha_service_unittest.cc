@@ -203,6 +203,8 @@ public:
 
     using HAService::asyncSendHeartbeat;
     using HAService::asyncSyncLeases;
+    using HAService::getSyncRanges;
+    using HAService::getSyncMinCltt;
     using HAService::postNextEvent;
     using HAService::transition;
     using HAService::verboseTransition;
@@ -217,6 +219,7 @@ public:
     using HAService::lease_update_backlog_;
     using HAService::client_;
     using HAService::listener_;
+    using HAService::sync_delta_mark_;
 };
 
 /// @brief Pointer to the @c TestHAService.
@@ -1254,11 +1257,68 @@ public:
             EXPECT_EQ(HA_LOAD_BALANCING_ST, service_->getCurrState());
         });
 
-        // Lease updates should have been sent.
+        // Bulk lease update should have been sent.
+        auto update_request = factory2_->getResponseCreator()->findRequest("lease4-bulk-apply",
+                                                                           "192.1.2.3",
+                                                                           "192.2.3.4");
+        ASSERT_TRUE(update_request);
+
+        // Verify that there is one lease to be updated and one to be deleted.
+        auto arguments = update_request->getBodyAsJson()->get("arguments");
+        EXPECT_EQ(Element::map, arguments->getType());
+        auto leases = arguments->get("leases");
+        ASSERT_TRUE(leases);
+        EXPECT_EQ(Element::list, leases->getType());
+        EXPECT_EQ(1U, leases->size());
+        auto deleted_leases = arguments->get("deleted-leases");
+        ASSERT_TRUE(deleted_leases);
+        EXPECT_EQ(Element::list, deleted_leases->getType());
+        EXPECT_EQ(1U, deleted_leases->size());
+
+        // Backlog should be empty.
+        EXPECT_EQ(0U, service_->lease_update_backlog_.size());
+    }
+
+    /// @brief Tests that the outstanding DHCPv4 lease updates are sent one at a
+    /// time when the partner does not support lease4-bulk-apply.
+    void testSendUpdatesCommunicationRecoveryBulkUnsupported() {
+        // The partner runs an older version without lease4-bulk-apply.
+        factory2_->getResponseCreator()->setControlResult("lease4-bulk-apply",
+                                                          CONTROL_RESULT_COMMAND_UNSUPPORTED);
+
+        // Start HTTP servers.
+        ASSERT_NO_THROW({
+                listener_->start();
+                listener2_->start();
+                listener3_->start();
+        });
+
+        // This flag will be set to true if unpark is called.
+        bool unpark_called = false;
+        testSendLeaseUpdates([&unpark_called] { unpark_called = true; },
+                             false, 0, MyState(HA_COMMUNICATION_RECOVERY_ST));
+        EXPECT_FALSE(unpark_called);
+        EXPECT_EQ(2U, service_->lease_update_backlog_.size());
+
+        // Make partner available.
+        service_->communication_state_->poke();
+        service_->communication_state_->setPartnerState("load-balancing");
+
+        // The updates are sent with lease4-update and lease4-del after the
+        // bulk apply was rejected, so the server returns to load-balancing.
+        testSynchronousCommands([this]() {
+            service_->runModel(HAService::NOP_EVT);
+            EXPECT_EQ(HA_LOAD_BALANCING_ST, service_->getCurrState());
+        });
+
+        EXPECT_TRUE(factory2_->getResponseCreator()->findRequest("lease4-bulk-apply",
+                                                                 "192.1.2.3",
+                                                                 "192.2.3.4"));
         EXPECT_TRUE(factory2_->getResponseCreator()->findRequest("lease4-update",
                                                                  "192.1.2.3"));
         EXPECT_TRUE(factory2_->getResponseCreator()->findRequest("lease4-del",
                                                                  "192.2.3.4"));
+        EXPECT_FALSE(factory2_->getResponseCreator()->findRequest("ha-reset", ""));
 
         // Backlog should be empty.
         EXPECT_EQ(0U, service_->lease_update_backlog_.size());
@@ -1299,11 +1359,19 @@ public:
             EXPECT_EQ(HA_LOAD_BALANCING_ST, service_->getCurrState());
         });
 
-        // Lease updates should have been sent.
-        EXPECT_TRUE(factory2_->getResponseCreator()->findRequest("lease4-update",
-                                                                 "192.1.2.3"));
-        EXPECT_TRUE(factory2_->getResponseCreator()->findRequest("lease4-update",
-                                                                 "192.2.3.4"));
+        // Bulk lease update should have been sent.
+        auto update_request = factory2_->getResponseCreator()->findRequest("lease4-bulk-apply",
+                                                                           "192.1.2.3",
+                                                                           "192.2.3.4");
+        ASSERT_TRUE(update_request);
+
+        // Make sure that both leases are to be updated in the partner's
+        // database.
+        auto arguments = update_request->getBodyAsJson()->get("arguments");
+        EXPECT_EQ(Element::map, arguments->getType());
+        auto leases = arguments->get("leases");
+        EXPECT_EQ(Element::list, leases->getType());
+        EXPECT_EQ(2U, leases->size());
 
         // Backlog should be empty.
         EXPECT_EQ(0U, service_->lease_update_backlog_.size());
@@ -1323,9 +1391,7 @@ public:
                                                     const int ha_reset_result,
                                                     const bool overflow = false) {
         // Partner responds with a specified control result to lease updates.
-        factory2_->getResponseCreator()->setControlResult("lease4-update",
-                                                          lease_update_result);
-        factory2_->getResponseCreator()->setControlResult("lease4-del",
+        factory2_->getResponseCreator()->setControlResult("lease4-bulk-apply",
                                                           lease_update_result);
         // Partner returns specified control result to ha-reset.
         factory2_->getResponseCreator()->setControlResult("ha-reset", ha_reset_result);
@@ -1381,13 +1447,10 @@ public:
         // it is overflown, it will rather transition to the waiting state to
         // initiate full synchronization.
         if (!overflow) {
-            // Deletions are scheduled first and this should cause the failure.
-            EXPECT_TRUE(factory2_->getResponseCreator()->findRequest("lease4-del",
+            // The server should have sent lease updates in a single command.
+            EXPECT_TRUE(factory2_->getResponseCreator()->findRequest("lease4-bulk-apply",
+                                                                     "192.1.2.3",
                                                                      "192.2.3.4"));
-            // This lease update should not be sent because the first update
-            // triggered an error.
-            EXPECT_FALSE(factory2_->getResponseCreator()->findRequest("lease4-update",
-                                                                      "192.1.2.3"));
         }
 
         if ((partner_state == "load-balancing") || (partner_state == "communication-recovery")) {
@@ -2780,6 +2843,20 @@ TEST_F(HAServiceTest, sendUpdatesCommunicationRecoveryMultiThreading) {
     testSendUpdatesCommunicationRecovery();
 }
 
+// Test that lease updates queued in the communication-recovery state are
+// sent one at a time to a partner which does not support lease4-bulk-apply.
+TEST_F(HAServiceTest, sendUpdatesCommunicationRecoveryBulkUnsupported) {
+    testSendUpdatesCommunicationRecoveryBulkUnsupported();
+}
+
+// Test that lease updates queued in the communication-recovery state are
+// sent one at a time to a partner which does not support lease4-bulk-apply.
+// Multi threading case.
+TEST_F(HAServiceTest, sendUpdatesCommunicationRecoveryBulkUnsupportedMultiThreading) {
+    MultiThreadingMgr::instance().setMode(true);
+    testSendUpdatesCommunicationRecoveryBulkUnsupported();
+}
+
 // Tests sending outstanding lease updates in the communication-recovery
 // state when released leases are preserved in the database.
 TEST_F(HAServiceTest, sendUpdatesCommunicationRecoverySoftDelete) {
@@ -3844,6 +3921,137 @@ TEST_F(HAServiceTest, asyncSyncLeases4Hub) {
     }
 }
 
+// This test verifies that only the leases modified since the servers were
+// last in sync are requested when the delta synchronization is enabled.
+TEST_F(HAServiceTest, asyncSyncLeases4Delta) {
+    // Create lease manager.
+    ASSERT_NO_THROW(LeaseMgrFactory::create("universe=4 type=memfile persist=false"));
+
+    // Create IPv4 leases which will be fetched from the other server.
+    ASSERT_NO_THROW(generateTestLeases4());
+
+    // Create HA configuration.
+    HAConfigPtr config_storage = createValidConfiguration();
+    config_storage->setSyncDelta(true);
+    setBasicAuth(config_storage);
+
+    // Leases are fetched in pages, so the lease4-get-page should be
+    // sent multiple times. The server is configured to return leases
+    // in 3-element chunks.
+    createPagedSyncResponses4();
+
+    // Start the servers.
+    ASSERT_NO_THROW({
+        listener_->start();
+        listener2_->start();
+    });
+
+    TestHAService service(1, io_service_, network_state_, config_storage);
+    // Setting the heartbeat delay to 0 disables the recurring heartbeat.
+    // We just want to synchronize leases and not send the heartbeat.
+    config_storage->setHeartbeatDelay(0);
+
+    // Pretend the servers were in sync a while ago.
+    service.sync_delta_mark_ = 1000000;
+
+    // Start fetching leases asynchronously.
+    ASSERT_NO_THROW(service.asyncSyncLeases());
+
+    // Run IO service to actually perform the transaction.
+    ASSERT_NO_THROW(runIOService(TEST_TIMEOUT, []() {
+        return (!LeaseMgrFactory::instance().getLeases4(SubnetID(10)).empty());
+    }));
+
+    // The minimum cltt is the mark minus the margin.
+    EXPECT_TRUE(factory2_->getResponseCreator()->findRequest("lease4-get-page",
+                                                             "\"min-cltt\": 999939"));
+}
+
+// This test verifies that the address space is split in ranges using the
+// configured subnets.
+TEST_F(HAServiceTest, getSyncRanges4) {
+    for (auto i = 1; i <= 10; ++i) {
+        auto subnet = Subnet4::create(IOAddress(static_cast<uint32_t>(i << 24)), 24,
+                                      30, 40, 50, SubnetID(i));
+        CfgMgr::instance().getStagingCfg()->getCfgSubnets4()->add(subnet);
+    }
+    CfgMgr::instance().commit();
+
+    HAConfigPtr config_storage = createValidConfiguration();
+    TestHAService service(1, io_service_, network_state_, config_storage);
+
+    // By default there is one range covering the whole address space.
+    auto ranges = service.getSyncRanges();
+    ASSERT_EQ(1, ranges.size());
+    EXPECT_EQ("0.0.0.0", ranges[0].from_.toText());
+    EXPECT_EQ("0.0.0.0", ranges[0].to_.toText());
+
+    // Three ranges holding about the same number of subnets.
+    config_storage->setSyncRanges(3);
+    ranges = service.getSyncRanges();
+    ASSERT_EQ(3, ranges.size());
+    EXPECT_EQ("0.0.0.0", ranges[0].from_.toText());
+    EXPECT_EQ("3.255.255.255", ranges[0].to_.toText());
+    EXPECT_EQ("3.255.255.255", ranges[1].from_.toText());
+    EXPECT_EQ("6.255.255.255", ranges[1].to_.toText());
+    EXPECT_EQ("6.255.255.255", ranges[2].from_.toText());
+    EXPECT_EQ("0.0.0.0", ranges[2].to_.toText());
+
+    // There are no more ranges than subnets.
+    config_storage->setSyncRanges(20);
+    ranges = service.getSyncRanges();
+    ASSERT_EQ(10, ranges.size());
+    EXPECT_EQ("1.255.255.255", ranges[0].to_.toText());
+    EXPECT_EQ("9.255.255.255", ranges[9].from_.toText());
+    EXPECT_EQ("0.0.0.0", ranges[9].to_.toText());
+}
+
+// This test verifies that the address space is split in ranges using the
+// configured subnets.
+TEST_F(HAServiceTest, getSyncRanges6) {
+    for (auto i = 1; i <= 4; ++i) {
+        std::ostringstream prefix;
+        prefix << "2001:db8:" << i << "::";
+        auto subnet = Subnet6::create(IOAddress(prefix.str()), 64, 30, 40, 50, 60,
+                                      SubnetID(i));
+        CfgMgr::instance().getStagingCfg()->getCfgSubnets6()->add(subnet);
+    }
+    CfgMgr::instance().commit();
+
+    HAConfigPtr config_storage = createValidConfiguration();
+    config_storage->setSyncRanges(2);
+    TestHAService service(1, io_service_, network_state_, config_storage,
+                          HAServerType::DHCPv6);
+
+    auto ranges = service.getSyncRanges();
+    ASSERT_EQ(2, ranges.size());
+    EXPECT_EQ("::", ranges[0].from_.toText());
+    EXPECT_EQ("2001:db8:2:ffff:ffff:ffff:ffff:ffff", ranges[0].to_.toText());
+    EXPECT_EQ("2001:db8:2:ffff:ffff:ffff:ffff:ffff", ranges[1].from_.toText());
+    EXPECT_EQ("::", ranges[1].to_.toText());
+}
+
+// This test verifies the minimum cltt of the delta synchronization.
+TEST_F(HAServiceTest, getSyncMinCltt) {
+    HAConfigPtr config_storage = createValidConfiguration();
+    TestHAService service(1, io_service_, network_state_, config_storage);
+
+    // The servers were never in sync.
+    EXPECT_EQ(0, service.getSyncMinCltt());
+
+    // The delta synchronization is disabled.
+    service.sync_delta_mark_ = 1000000;
+    EXPECT_EQ(0, service.getSyncMinCltt());
+
+    // The margin is the max-response-delay plus one minute.
+    config_storage->setSyncDelta(true);
+    config_storage->setMaxResponseDelay(10000);
+    EXPECT_EQ(1000000 - 10 - 60, service.getSyncMinCltt());
+
+    service.sync_delta_mark_ = 0;
+    EXPECT_EQ(0, service.getSyncMinCltt());
+}
+
 // This test verifies that IPv6 leases can be fetched from the peer and inserted
 // or updated in the local lease database.
 TEST_F(HAServiceTest, asyncSyncLeases6) {
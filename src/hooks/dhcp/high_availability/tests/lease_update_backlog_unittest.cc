@@ -64,6 +64,97 @@ TEST(LeaseUpdateBacklogTest, pushAndPop) {
     EXPECT_FALSE(backlog.wasOverflown());
 }
 
+// This test verifies that updates of the same lease are coalesced.
+TEST(LeaseUpdateBacklogTest, coalesce) {
+    // Create the queue with limit of 2 leases.
+    LeaseUpdateBacklog backlog(2);
+
+    HWAddrPtr hwaddr = boost::make_shared<HWAddr>(std::vector<uint8_t>(6, 1),
+                                                  HTYPE_ETHER);
+    Lease4Ptr lease1 = boost::make_shared<Lease4>(IOAddress("192.0.2.1"), hwaddr,
+                                                  ClientIdPtr(), 60, 0, 1);
+    Lease4Ptr lease2 = boost::make_shared<Lease4>(IOAddress("192.0.2.2"), hwaddr,
+                                                  ClientIdPtr(), 60, 0, 1);
+
+    // Many updates of the same leases do not exceed the limit.
+    for (auto i = 0; i < 10; ++i) {
+        Lease4Ptr renewed = boost::make_shared<Lease4>(*lease1);
+        renewed->valid_lft_ = 60 + i;
+        ASSERT_TRUE(backlog.push(LeaseUpdateBacklog::ADD, renewed));
+        ASSERT_TRUE(backlog.push(LeaseUpdateBacklog::ADD, lease2));
+    }
+    EXPECT_EQ(2U, backlog.size());
+    EXPECT_FALSE(backlog.wasOverflown());
+
+    // The first lease is deleted: the update is moved after the second one.
+    ASSERT_TRUE(backlog.push(LeaseUpdateBacklog::DELETE, lease1));
+    EXPECT_EQ(2U, backlog.size());
+
+    // A third lease exceeds the limit.
+    Lease4Ptr lease3 = boost::make_shared<Lease4>(IOAddress("192.0.2.3"), hwaddr,
+                                                  ClientIdPtr(), 60, 0, 1);
+    EXPECT_FALSE(backlog.push(LeaseUpdateBacklog::ADD, lease3));
+    EXPECT_TRUE(backlog.wasOverflown());
+
+    // Only the latest states are returned in the order of their last change.
+    LeaseUpdateBacklog::OpType op_type;
+    auto lease = backlog.pop(op_type);
+    ASSERT_TRUE(lease);
+    EXPECT_EQ(LeaseUpdateBacklog::ADD, op_type);
+    EXPECT_EQ(lease2, lease);
+    lease = backlog.pop(op_type);
+    ASSERT_TRUE(lease);
+    EXPECT_EQ(LeaseUpdateBacklog::DELETE, op_type);
+    EXPECT_EQ(lease1, lease);
+    EXPECT_FALSE(backlog.pop(op_type));
+
+    // The same address with another lease type is another lease.
+    DuidPtr duid = boost::make_shared<DUID>(std::vector<uint8_t>(8, 2));
+    Lease6Ptr na = boost::make_shared<Lease6>(Lease::TYPE_NA, IOAddress("2001:db8::"),
+                                              duid, 1, 50, 60, 1);
+    Lease6Ptr pd = boost::make_shared<Lease6>(Lease::TYPE_PD, IOAddress("2001:db8::"),
+                                              duid, 1, 50, 60, 1, HWAddrPtr(), 64);
+    ASSERT_TRUE(backlog.push(LeaseUpdateBacklog::ADD, na));
+    ASSERT_TRUE(backlog.push(LeaseUpdateBacklog::ADD, pd));
+    EXPECT_EQ(2U, backlog.size());
+}
+
+// This test verifies that a popped update can be put back at the front.
+TEST(LeaseUpdateBacklogTest, pushFront) {
+    // Create the queue with limit of 2 leases.
+    LeaseUpdateBacklog backlog(2);
+
+    HWAddrPtr hwaddr = boost::make_shared<HWAddr>(std::vector<uint8_t>(6, 1),
+                                                  HTYPE_ETHER);
+    Lease4Ptr lease1 = boost::make_shared<Lease4>(IOAddress("192.0.2.1"), hwaddr,
+                                                  ClientIdPtr(), 60, 0, 1);
+    Lease4Ptr lease2 = boost::make_shared<Lease4>(IOAddress("192.0.2.2"), hwaddr,
+                                                  ClientIdPtr(), 60, 0, 1);
+    ASSERT_TRUE(backlog.push(LeaseUpdateBacklog::ADD, lease1));
+    ASSERT_TRUE(backlog.push(LeaseUpdateBacklog::ADD, lease2));
+
+    // Pop both updates and put them back in the reverse order.
+    LeaseUpdateBacklog::OpType op_type;
+    ASSERT_EQ(lease1, backlog.pop(op_type));
+    ASSERT_EQ(lease2, backlog.pop(op_type));
+    backlog.pushFront(LeaseUpdateBacklog::ADD, lease2);
+    backlog.pushFront(LeaseUpdateBacklog::ADD, lease1);
+    EXPECT_EQ(2U, backlog.size());
+    EXPECT_FALSE(backlog.wasOverflown());
+
+    // The original order is restored.
+    EXPECT_EQ(lease1, backlog.pop(op_type));
+    EXPECT_EQ(lease2, backlog.pop(op_type));
+
+    // A newer update of the lease is kept.
+    ASSERT_TRUE(backlog.push(LeaseUpdateBacklog::DELETE, lease1));
+    backlog.pushFront(LeaseUpdateBacklog::ADD, lease1);
+    EXPECT_EQ(1U, backlog.size());
+    EXPECT_EQ(lease1, backlog.pop(op_type));
+    EXPECT_EQ(LeaseUpdateBacklog::DELETE, op_type);
+    EXPECT_FALSE(backlog.pop(op_type));
+}
+
 // This test verifies that all lease updates can be removed.
 TEST(LeaseUpdateBacklogTest, clear) {
     // Create the queue with limit of 5 lease updates.
@@ -13,6 +13,7 @@
 #include <asiolink/io_address.h>
 #include <dhcpsrv/cache_host_data_source.h>
 #include <dhcpsrv/host.h>
+#include <dhcpsrv/host_lookup_cache.h>
 #include <dhcpsrv/subnet_id.h>
 #include <config/cmds_impl.h>
 #include <boost/scoped_ptr.hpp>
@@ -54,6 +55,20 @@ public:
     /// @brief Get maximum number of cached hosts.
     virtual size_t getMaximum() const;
 
+    /// @brief Set the host lookup cache to install in the host manager.
+    ///
+    /// @param lookup_cache Host lookup cache (null when disabled).
+    void setLookupCache(const isc::dhcp::HostLookupCachePtr& lookup_cache) {
+        lookup_cache_ = lookup_cache;
+    }
+
+    /// @brief Get the host lookup cache to install in the host manager.
+    ///
+    /// @return the host lookup cache (null when disabled).
+    isc::dhcp::HostLookupCachePtr getLookupCache() const {
+        return (lookup_cache_);
+    }
+
     ///
     /// BaseHostDataSource methods
     ///
@@ -675,6 +690,10 @@ protected:
 
     /// @brief mutex
     boost::scoped_ptr<std::mutex> mutex_;
+
+    /// @brief Host lookup cache configured by the "lookup-cache-size"
+    /// and related parameters.
+    isc::dhcp::HostLookupCachePtr lookup_cache_;
 };
 
 /// @brief Pointer to the Host Cache hooks library implementation.
@@ -12,6 +12,8 @@
 
 #include <host_cache.h>
 #include <host_cache_log.h>
+#include <asiolink/interval_timer.h>
+#include <asiolink/io_service.h>
 #include <cc/command_interpreter.h>
 #include <hooks/hooks.h>
 #include <dhcpsrv/cfgmgr.h>
@@ -19,6 +21,7 @@
 #include <dhcpsrv/host_data_source_factory.h>
 #include <process/daemon.h>
 
+using namespace isc::asiolink;
 using namespace isc::db;
 using namespace isc::dhcp;
 using namespace isc::process;
@@ -29,6 +32,40 @@ namespace host_cache {
 /// @brief Pointer to the Host Cache instance.
 HostCachePtr hcptr;
 
+/// @brief Interval in milliseconds between two publications of the host
+/// lookup cache statistics.
+const long LOOKUP_CACHE_STATS_INTERVAL = 1000;
+
+/// @brief Timer publishing the host lookup cache statistics.
+IntervalTimerPtr lookup_cache_stats_timer;
+
+/// @brief Publishes the host lookup cache statistics.
+void
+publishLookupCacheStatistics() {
+    if (hcptr && hcptr->getLookupCache()) {
+        hcptr->getLookupCache()->publishStatistics();
+    }
+}
+
+/// @brief Starts the host lookup cache statistics timer.
+///
+/// @param handle Callout handle of the server configured hook point.
+void
+startLookupCacheStatsTimer(hooks::CalloutHandle& handle) {
+    if (lookup_cache_stats_timer || !hcptr || !hcptr->getLookupCache()) {
+        return;
+    }
+    IOServicePtr io_service;
+    handle.getArgument("io_context", io_service);
+    if (!io_service) {
+        return;
+    }
+    lookup_cache_stats_timer.reset(new IntervalTimer(io_service));
+    lookup_cache_stats_timer->setup(publishLookupCacheStatistics,
+                                    LOOKUP_CACHE_STATS_INTERVAL,
+                                    IntervalTimer::REPEATING);
+}
+
 /// @brief Host Cache factory.
 HostDataSourcePtr
 factory(const DatabaseConnection::ParameterMap&) {
@@ -45,6 +82,28 @@ using namespace isc::host_cache;
 
 extern "C" {
 
+/// @brief dhcp4_srv_configured callout implementation.
+///
+/// Starts the timer publishing the host lookup cache statistics.
+///
+/// @param handle callout handle.
+/// @return 0 on success.
+int dhcp4_srv_configured(CalloutHandle& handle) {
+    startLookupCacheStatsTimer(handle);
+    return (0);
+}
+
+/// @brief dhcp6_srv_configured callout implementation.
+///
+/// Starts the timer publishing the host lookup cache statistics.
+///
+/// @param handle callout handle.
+/// @return 0 on success.
+int dhcp6_srv_configured(CalloutHandle& handle) {
+    startLookupCacheStatsTimer(handle);
+    return (0);
+}
+
 /// @brief This is a command callout for 'cache-size' command.
 ///
 /// @param handle Callout handle used to retrieve a command and
@@ -171,6 +230,15 @@ int load(LibraryHandle& handle) {
         handle.registerCommandCallout("cache-size", cache_size);
         handle.registerCommandCallout("cache-write", cache_write);
         HostMgr::instance().addBackend("type=cache");
+        HostLookupCachePtr lookup_cache = hcptr->getLookupCache();
+        HostMgr::instance().setLookupCache(lookup_cache);
+        if (lookup_cache) {
+            LOG_INFO(host_cache_logger, HOST_CACHE_LOOKUP_CACHE_ENABLED)
+                .arg(lookup_cache->getCapacity())
+                .arg(lookup_cache->getTTL())
+                .arg(lookup_cache->getNegativeTTL())
+                .arg(lookup_cache->getAdmission() ? "true" : "false");
+        }
     } catch (const std::exception& ex) {
         LOG_ERROR(host_cache_logger, HOST_CACHE_CONFIGURATION_FAILED)
             .arg(ex.what());
@@ -186,6 +254,12 @@ int load(LibraryHandle& handle) {
 /// @return 0 if deregistration was successful, 1 otherwise
 int unload() {
     LOG_INFO(host_cache_logger, HOST_CACHE_DEINIT_OK);
+    if (lookup_cache_stats_timer) {
+        lookup_cache_stats_timer->cancel();
+        lookup_cache_stats_timer.reset();
+    }
+    publishLookupCacheStatistics();
+    HostMgr::instance().setLookupCache(HostLookupCachePtr());
     HostMgr::delBackend("cache");
     hcptr.reset();
     HostDataSourceFactory::deregisterFactory("cache");
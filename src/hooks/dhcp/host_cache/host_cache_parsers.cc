@@ -22,7 +22,11 @@ namespace host_cache {
 
 /// @brief Defaults for Host Cache configuration.
 const SimpleDefaults HCConfigParser::HOST_CACHE_DEFAULTS = {
-    { "maximum",       Element::integer, "0" }
+    { "maximum",                    Element::integer, "0" },
+    { "lookup-cache-size",          Element::integer, "0" },
+    { "lookup-cache-ttl",           Element::integer, "300" },
+    { "lookup-cache-negative-ttl",  Element::integer, "60" },
+    { "lookup-cache-admission",     Element::boolean, "false" }
 };
 
 /// @todo: Remove this duplicated code (see trac #5578)
@@ -51,6 +55,21 @@ HCConfigParser::parse(HostCache& hcref, const ConstElementPtr& config) {
                       << "(" << maximum << " > " << MAXIMUM << ")");
         }
         hcref.setMaximum(static_cast<size_t>(maximum));
+
+        // Host lookup cache in front of the host backends.
+        int64_t size = getInteger(mutable_cfg, "lookup-cache-size",
+                                  0, MAXIMUM);
+        uint32_t ttl = getUint32(mutable_cfg, "lookup-cache-ttl");
+        uint32_t negative_ttl = getUint32(mutable_cfg,
+                                          "lookup-cache-negative-ttl");
+        bool admission = getBoolean(mutable_cfg, "lookup-cache-admission");
+        HostLookupCachePtr lookup_cache;
+        if (size > 0) {
+            lookup_cache.reset(new HostLookupCache(static_cast<size_t>(size),
+                                                   ttl, negative_ttl,
+                                                   admission));
+        }
+        hcref.setLookupCache(lookup_cache);
     } catch (const ConfigError&) {
         throw;
     } catch (const exception& ex) {
@@ -434,6 +434,26 @@ TEST_F(CommandTest, config) {
 
     config = Element::fromJSON("{ \"foo\": \"bar\" }");
     EXPECT_NO_THROW(hcptr_->configure(config));
+
+    // Host lookup cache is disabled by default.
+    EXPECT_FALSE(hcptr_->getLookupCache());
+
+    config = Element::fromJSON("{ \"lookup-cache-size\": 1000,"
+                               " \"lookup-cache-ttl\": 120,"
+                               " \"lookup-cache-negative-ttl\": 10,"
+                               " \"lookup-cache-admission\": true }");
+    EXPECT_NO_THROW(hcptr_->configure(config));
+    HostLookupCachePtr lookup_cache = hcptr_->getLookupCache();
+    ASSERT_TRUE(lookup_cache);
+    EXPECT_EQ(1000U, lookup_cache->getCapacity());
+    EXPECT_EQ(120U, lookup_cache->getTTL());
+    EXPECT_EQ(10U, lookup_cache->getNegativeTTL());
+    EXPECT_TRUE(lookup_cache->getAdmission());
+
+    config = Element::fromJSON("{ \"lookup-cache-size\": -1 }");
+    EXPECT_THROW(hcptr_->configure(config), ConfigError);
+    config = Element::fromJSON("{ \"lookup-cache-ttl\": -1 }");
+    EXPECT_THROW(hcptr_->configure(config), ConfigError);
 }
 
 // Verifies that cache-size works as expected.
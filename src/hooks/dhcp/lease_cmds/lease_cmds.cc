@@ -9,6 +9,7 @@
 #include <config/cmds_impl.h>
 #include <cc/command_interpreter.h>
 #include <cc/data.h>
+#include <cc/json_stream.h>
 #include <asiolink/io_address.h>
 #include <database/db_exceptions.h>
 #include <dhcpsrv/cfgmgr.h>
@@ -33,7 +34,10 @@
 
 #include <boost/scoped_ptr.hpp>
 #include <boost/algorithm/string.hpp>
+#include <algorithm>
+#include <functional>
 #include <limits>
+#include <set>
 #include <string>
 #include <sstream>
 
@@ -57,6 +61,11 @@ namespace {
 const int128_t uint32_min = numeric_limits<uint32_t>::min();
 const int128_t uint32_max = numeric_limits<uint32_t>::max();
 
+/// @brief Maximum number of lease database pages read by one
+/// lease4-get-page or lease6-get-page command when the leases are
+/// filtered with 'min-cltt'.
+const size_t MAX_FILTERED_PAGES = 16;
+
 }
 
 /// @brief Wrapper class around reservation command handlers.
@@ -145,6 +154,18 @@ public:
     int
     leaseAddHandler(CalloutHandle& handle);
 
+    /// @brief lease4-bulk-apply command handler
+    ///
+    /// Provides the implementation for the
+    /// @ref isc::lease_cmds::LeaseCmds::lease4BulkApplyHandler.
+    ///
+    /// @param handle Callout context - which is expected to contain the
+    /// add command JSON text in the "command" argument
+    ///
+    /// @return 0 upon success, non-zero otherwise
+    int
+    lease4BulkApplyHandler(CalloutHandle& handle);
+
     /// @brief lease6-bulk-apply command handler
     ///
     /// Provides the implementation for the
@@ -390,6 +411,21 @@ public:
     /// @throw InvalidOperation if the query type is unknown.
     Lease6Ptr getIPv6LeaseForDelete(const Parameters& parameters) const;
 
+    /// @brief Convenience function fetching IPv4 lease to be deleted.
+    ///
+    /// If the query type is by address and the lease is not found, a
+    /// lease holding only the address is returned so the caller can
+    /// report the address of the lease which failed to be deleted.
+    /// Otherwise a null pointer is returned when the lease is not found.
+    ///
+    /// @param parameters parameters extracted from the command.
+    ///
+    /// @return Lease to be deleted.
+    ///
+    /// @throw InvalidParameter if the query type is by DUID.
+    /// @throw InvalidOperation if the query type is unknown.
+    Lease4Ptr getIPv4LeaseForDelete(const Parameters& parameters) const;
+
     /// @brief Returns a map holding brief information about a lease which
     /// failed to be deleted, updated or added.
     ///
@@ -442,6 +478,77 @@ public:
     /// @return true if lease has been successfully added, false otherwise.
     static bool addOrUpdate6(Lease6Ptr lease, bool force_create);
 
+    /// @brief Callback reporting an IPv4 lease which failed to be deleted,
+    /// added or updated by a bulk apply.
+    ///
+    /// The arguments are the lease, the control result and the error text.
+    typedef std::function<void(const Lease4Ptr&, int,
+                               const std::string&)> FailedLease4Callback;
+
+    /// @brief Callback reporting an IPv6 lease which failed to be deleted,
+    /// added or updated by a bulk apply.
+    ///
+    /// The arguments are the lease, the control result and the error text.
+    typedef std::function<void(const Lease6Ptr&, int,
+                               const std::string&)> FailedLease6Callback;
+
+    /// @brief Deletes IPv4 leases in one batch.
+    ///
+    /// The leases are deleted with @c LeaseMgr::deleteLeases so the
+    /// database backends use one transaction. If the batch fails the
+    /// leases are deleted one at a time to report the failing ones.
+    ///
+    /// @param leases The leases to be deleted.
+    /// @param failed The callback invoked for each lease which was not
+    /// deleted.
+    ///
+    /// @return The number of deleted leases.
+    static size_t deleteLeases4(const Lease4Collection& leases,
+                                const FailedLease4Callback& failed);
+
+    /// @brief Deletes IPv6 leases in one batch.
+    ///
+    /// See the IPv4 version for details.
+    ///
+    /// @param leases The leases to be deleted.
+    /// @param failed The callback invoked for each lease which was not
+    /// deleted.
+    ///
+    /// @return The number of deleted leases.
+    static size_t deleteLeases6(const Lease6Collection& leases,
+                                const FailedLease6Callback& failed);
+
+    /// @brief Adds or updates IPv4 leases in batches.
+    ///
+    /// The existing leases are read one at a time, then the new leases
+    /// are written with @c LeaseMgr::addLeases and the existing ones with
+    /// @c LeaseMgr::updateLeases4, so the database backends use one
+    /// transaction for each instead of one per lease. A batch holds
+    /// distinct addresses only: a later lease for an address already in
+    /// the batch starts the next batch, so the leases are applied in
+    /// order. If a batch write fails its leases are applied one at a time
+    /// with @c addOrUpdate4 to report the failing ones.
+    ///
+    /// @param leases The leases to be added or updated.
+    /// @param failed The callback invoked for each lease which was not
+    /// added or updated.
+    ///
+    /// @return The number of added or updated leases.
+    static size_t addOrUpdateLeases4(const Lease4Collection& leases,
+                                     const FailedLease4Callback& failed);
+
+    /// @brief Adds or updates IPv6 leases in batches.
+    ///
+    /// See the IPv4 version for details.
+    ///
+    /// @param leases The leases to be added or updated.
+    /// @param failed The callback invoked for each lease which was not
+    /// added or updated.
+    ///
+    /// @return The number of added or updated leases.
+    static size_t addOrUpdateLeases6(const Lease6Collection& leases,
+                                     const FailedLease6Callback& failed);
+
     /// @brief Get DHCPv6 extended info.
     ///
     /// @param lease The lease to get extended info from.
@@ -590,6 +697,355 @@ LeaseCmdsImpl::addOrUpdate6(Lease6Ptr lease, bool force_create) {
     return (false);
 }
 
+size_t
+LeaseCmdsImpl::deleteLeases4(const Lease4Collection& leases,
+                             const FailedLease4Callback& failed) {
+    if (leases.empty()) {
+        return (0);
+    }
+    Lease4Collection not_deleted;
+    try {
+        not_deleted = LeaseMgrFactory::instance().deleteLeases(leases);
+
+    } catch (const std::exception&) {
+        // The database backends roll back the whole batch: delete the
+        // leases one at a time to find out which one fails.
+        size_t success_count = 0;
+        for (auto const& lease : leases) {
+            try {
+                if (LeaseMgrFactory::instance().deleteLease(lease)) {
+                    ++success_count;
+                    LeaseMgr::updateStatsOnDelete(lease);
+                } else {
+                    failed(lease, CONTROL_RESULT_EMPTY, "lease not found");
+                }
+            } catch (const std::exception& ex) {
+                failed(lease, CONTROL_RESULT_ERROR, ex.what());
+            }
+        }
+        return (success_count);
+    }
+
+    size_t success_count = 0;
+    for (auto const& lease : leases) {
+        if (std::find(not_deleted.begin(), not_deleted.end(), lease) !=
+            not_deleted.end()) {
+            failed(lease, CONTROL_RESULT_EMPTY, "lease not found");
+        } else {
+            ++success_count;
+            LeaseMgr::updateStatsOnDelete(lease);
+        }
+    }
+    return (success_count);
+}
+
+size_t
+LeaseCmdsImpl::deleteLeases6(const Lease6Collection& leases,
+                             const FailedLease6Callback& failed) {
+    if (leases.empty()) {
+        return (0);
+    }
+    Lease6Collection not_deleted;
+    try {
+        not_deleted = LeaseMgrFactory::instance().deleteLeases(leases);
+
+    } catch (const std::exception&) {
+        // The database backends roll back the whole batch: delete the
+        // leases one at a time to find out which one fails.
+        size_t success_count = 0;
+        for (auto const& lease : leases) {
+            try {
+                if (LeaseMgrFactory::instance().deleteLease(lease)) {
+                    ++success_count;
+                    LeaseMgr::updateStatsOnDelete(lease);
+                } else {
+                    failed(lease, CONTROL_RESULT_EMPTY, "lease not found");
+                }
+            } catch (const std::exception& ex) {
+                failed(lease, CONTROL_RESULT_ERROR, ex.what());
+            }
+        }
+        return (success_count);
+    }
+
+    size_t success_count = 0;
+    for (auto const& lease : leases) {
+        if (std::find(not_deleted.begin(), not_deleted.end(), lease) !=
+            not_deleted.end()) {
+            failed(lease, CONTROL_RESULT_EMPTY, "lease not found");
+        } else {
+            ++success_count;
+            LeaseMgr::updateStatsOnDelete(lease);
+        }
+    }
+    return (success_count);
+}
+
+size_t
+LeaseCmdsImpl::addOrUpdateLeases4(const Lease4Collection& leases,
+                                  const FailedLease4Callback& failed) {
+    // Applies one lease with addOrUpdate4 when a batch write failed.
+    auto apply_one = [&failed](const Lease4Ptr& lease) -> bool {
+        try {
+            addOrUpdate4(lease, true);
+            return (true);
+
+        } catch (const LeaseCmdsConflict& ex) {
+            failed(lease, CONTROL_RESULT_CONFLICT, ex.what());
+
+        } catch (const std::exception& ex) {
+            failed(lease, CONTROL_RESULT_ERROR, ex.what());
+        }
+        return (false);
+    };
+
+    size_t success_count = 0;
+    auto next = leases.begin();
+    while (next != leases.end()) {
+        // Gather a batch of leases with distinct addresses. In
+        // multi-threading mode the addresses stay locked until the
+        // batch is written.
+        ResourceHandler4 resource_handler;
+        std::set<IOAddress> addresses;
+        Lease4Collection new_leases;
+        Lease4Collection updated_leases;
+        Lease4Collection existing_leases;
+        for (; next != leases.end(); ++next) {
+            auto const& lease = *next;
+            if (!addresses.insert(lease->addr_).second) {
+                break;
+            }
+            try {
+                if (lease->stateRegistered()) {
+                    isc_throw(BadValue, "DHCPv4 leases do not support registered state");
+                }
+                if (MultiThreadingMgr::instance().getMode() &&
+                    !resource_handler.tryLock4(lease->addr_)) {
+                    isc_throw(LeaseCmdsConflict,
+                              "ResourceBusy: IP address:" << lease->addr_
+                              << " could not be updated.");
+                }
+                Lease4Ptr existing = LeaseMgrFactory::instance().getLease4(lease->addr_);
+                if (!existing) {
+                    new_leases.push_back(lease);
+                } else {
+                    // Update lease current expiration time with value received
+                    // from the database. Some database backends reject operations
+                    // on the lease if the current expiration time value does not
+                    // match what is stored.
+                    Lease::syncCurrentExpirationTime(*existing, *lease);
+                    updated_leases.push_back(lease);
+                    existing_leases.push_back(existing);
+                }
+
+            } catch (const LeaseCmdsConflict& ex) {
+                failed(lease, CONTROL_RESULT_CONFLICT, ex.what());
+
+            } catch (const std::exception& ex) {
+                failed(lease, CONTROL_RESULT_ERROR, ex.what());
+            }
+        }
+
+        // Write the new leases.
+        if (!new_leases.empty()) {
+            try {
+                Lease4Collection not_added =
+                    LeaseMgrFactory::instance().addLeases(new_leases);
+                for (auto const& lease : new_leases) {
+                    if (std::find(not_added.begin(), not_added.end(), lease) !=
+                        not_added.end()) {
+                        failed(lease, CONTROL_RESULT_CONFLICT,
+                               "lost race between calls to get and add");
+                    } else {
+                        ++success_count;
+                        LeaseMgr::updateStatsOnAdd(lease);
+                    }
+                }
+
+            } catch (const std::exception&) {
+                for (auto const& lease : new_leases) {
+                    if (apply_one(lease)) {
+                        ++success_count;
+                    }
+                }
+            }
+        }
+
+        // Write the updated leases.
+        if (!updated_leases.empty()) {
+            try {
+                Lease4Collection not_updated =
+                    LeaseMgrFactory::instance().updateLeases4(updated_leases);
+                for (size_t i = 0; i < updated_leases.size(); ++i) {
+                    auto const& lease = updated_leases[i];
+                    if (std::find(not_updated.begin(), not_updated.end(), lease) !=
+                        not_updated.end()) {
+                        std::ostringstream text;
+                        text << "failed to update the lease with address "
+                             << lease->addr_ << " either because the lease has been "
+                             "deleted or it has changed in the database, in both cases a "
+                             "retry might succeed";
+                        failed(lease, CONTROL_RESULT_CONFLICT, text.str());
+                    } else {
+                        ++success_count;
+                        LeaseMgr::updateStatsOnUpdate(existing_leases[i], lease);
+                    }
+                }
+
+            } catch (const std::exception&) {
+                for (auto const& lease : updated_leases) {
+                    if (apply_one(lease)) {
+                        ++success_count;
+                    }
+                }
+            }
+        }
+    }
+    return (success_count);
+}
+
+size_t
+LeaseCmdsImpl::addOrUpdateLeases6(const Lease6Collection& leases,
+                                  const FailedLease6Callback& failed) {
+    // Applies one lease with addOrUpdate6 when a batch write failed.
+    auto apply_one = [&failed](const Lease6Ptr& lease) -> bool {
+        try {
+            addOrUpdate6(lease, true);
+            return (true);
+
+        } catch (const LeaseCmdsConflict& ex) {
+            failed(lease, CONTROL_RESULT_CONFLICT, ex.what());
+
+        } catch (const std::exception& ex) {
+            failed(lease, CONTROL_RESULT_ERROR, ex.what());
+        }
+        return (false);
+    };
+
+    size_t success_count = 0;
+    auto next = leases.begin();
+    while (next != leases.end()) {
+        // Gather a batch of leases with distinct addresses. In
+        // multi-threading mode the addresses stay locked until the
+        // batch is written.
+        ResourceHandler resource_handler;
+        std::set<IOAddress> addresses;
+        Lease6Collection new_leases;
+        Lease6Collection updated_leases;
+        Lease6Collection existing_leases;
+        for (; next != leases.end(); ++next) {
+            auto const& lease = *next;
+            if (!addresses.insert(lease->addr_).second) {
+                break;
+            }
+            try {
+                if (MultiThreadingMgr::instance().getMode() &&
+                    !resource_handler.tryLock(lease->type_, lease->addr_)) {
+                    isc_throw(LeaseCmdsConflict,
+                              "ResourceBusy: IP address:" << lease->addr_
+                              << " could not be updated.");
+                }
+                Lease6Ptr existing =
+                    LeaseMgrFactory::instance().getLease6(lease->type_, lease->addr_);
+                if (!existing) {
+                    new_leases.push_back(lease);
+                    continue;
+                }
+
+                // Refuse used <-> registered transitions.
+                if (existing->stateRegistered() && !lease->stateRegistered()) {
+                    isc_throw(BadValue, "illegal reuse of registered address "
+                              << lease->addr_);
+                } else if (!existing->stateRegistered() && lease->stateRegistered()) {
+                    isc_throw(BadValue, "address in use: " << lease->addr_
+                              << " can't be registered");
+                }
+
+                // Update lease current expiration time with value received
+                // from the database. Some database backends reject operations
+                // on the lease if the current expiration time value does not
+                // match what is stored.
+                Lease::syncCurrentExpirationTime(*existing, *lease);
+
+                // Check what is the action about extended info.
+                ConstElementPtr old_extended_info = getExtendedInfo6(existing);
+                ConstElementPtr extended_info = getExtendedInfo6(lease);
+                if ((!old_extended_info && !extended_info) ||
+                    (old_extended_info && extended_info &&
+                     (*old_extended_info == *extended_info))) {
+                    // Leave the default Lease6::ACTION_IGNORE.
+                } else {
+                    lease->extended_info_action_ = Lease6::ACTION_UPDATE;
+                }
+                updated_leases.push_back(lease);
+                existing_leases.push_back(existing);
+
+            } catch (const LeaseCmdsConflict& ex) {
+                failed(lease, CONTROL_RESULT_CONFLICT, ex.what());
+
+            } catch (const std::exception& ex) {
+                failed(lease, CONTROL_RESULT_ERROR, ex.what());
+            }
+        }
+
+        // Write the new leases.
+        if (!new_leases.empty()) {
+            try {
+                Lease6Collection not_added =
+                    LeaseMgrFactory::instance().addLeases(new_leases);
+                for (auto const& lease : new_leases) {
+                    if (std::find(not_added.begin(), not_added.end(), lease) !=
+                        not_added.end()) {
+                        failed(lease, CONTROL_RESULT_CONFLICT,
+                               "lost race between calls to get and add");
+                    } else {
+                        ++success_count;
+                        LeaseMgr::updateStatsOnAdd(lease);
+                    }
+                }
+
+            } catch (const std::exception&) {
+                for (auto const& lease : new_leases) {
+                    if (apply_one(lease)) {
+                        ++success_count;
+                    }
+                }
+            }
+        }
+
+        // Write the updated leases.
+        if (!updated_leases.empty()) {
+            try {
+                Lease6Collection not_updated =
+                    LeaseMgrFactory::instance().updateLeases6(updated_leases);
+                for (size_t i = 0; i < updated_leases.size(); ++i) {
+                    auto const& lease = updated_leases[i];
+                    if (std::find(not_updated.begin(), not_updated.end(), lease) !=
+                        not_updated.end()) {
+                        std::ostringstream text;
+                        text << "failed to update the lease with address "
+                             << lease->addr_ << " either because the lease has been "
+                             "deleted or it has changed in the database, in both cases a "
+                             "retry might succeed";
+                        failed(lease, CONTROL_RESULT_CONFLICT, text.str());
+                    } else {
+                        ++success_count;
+                        LeaseMgr::updateStatsOnUpdate(existing_leases[i], lease);
+                    }
+                }
+
+            } catch (const std::exception&) {
+                for (auto const& lease : updated_leases) {
+                    if (apply_one(lease)) {
+                        ++success_count;
+                    }
+                }
+            }
+        }
+    }
+    return (success_count);
+}
+
 int
 LeaseCmdsImpl::leaseAddHandler(CalloutHandle& handle) {
     // Arbitrary defaulting to DHCPv4 or with other words extractCommand
@@ -929,7 +1385,22 @@ LeaseCmdsImpl::leaseGetAllHandler(CalloutHandle& handle) {
         extractCommand(handle);
         v4 = (cmd_name_ == "lease4-get-all");
 
-        ElementPtr leases_json = Element::createList();
+        // The leases are written one by one as JSON text rather than
+        // building one element per lease.
+        std::ostringstream leases_text;
+        JSONWriter writer(leases_text);
+        size_t count = 0;
+        auto write4 = [&writer, &count](const Lease4Ptr& lease) {
+            writer.element(lease->toElement());
+            ++count;
+            return (true);
+        };
+        auto write6 = [&writer, &count](const Lease6Ptr& lease) {
+            writer.element(lease->toElement());
+            ++count;
+            return (true);
+        };
+        writer.startList();
 
         // The argument may contain a list of subnets for which leases should
         // be returned.
@@ -954,47 +1425,38 @@ LeaseCmdsImpl::leaseGetAllHandler(CalloutHandle& handle) {
                 }
 
                 if (v4) {
-                    Lease4Collection leases =
-                        LeaseMgrFactory::instance().getLeases4(subnet_id_);
-                    for (auto const& lease : leases) {
-                        ElementPtr lease_json = lease->toElement();
-                        leases_json->add(lease_json);
-                    }
+                    LeaseMgrFactory::instance().visitLeases4(subnet_id_,
+                                                             write4);
                 } else {
-                    Lease6Collection leases =
-                        LeaseMgrFactory::instance().getLeases6(subnet_id_);
-                    for (auto const& lease : leases) {
-                        ElementPtr lease_json = lease->toElement();
-                        leases_json->add(lease_json);
-                    }
+                    LeaseMgrFactory::instance().visitLeases6(subnet_id_,
+                                                             write6);
                 }
             }
 
         } else {
             // There is no 'subnets' argument so let's return all leases.
+            // Visit them by pages rather than getting a copy of the
+            // whole lease database before building the response.
             if (v4) {
-                Lease4Collection leases = LeaseMgrFactory::instance().getLeases4();
-                for (auto const& lease : leases) {
-                    ElementPtr lease_json = lease->toElement();
-                    leases_json->add(lease_json);
-                }
+                LeaseMgrFactory::instance().visitLeases4(write4);
             } else {
-                Lease6Collection leases = LeaseMgrFactory::instance().getLeases6();
-                for (auto const& lease : leases) {
-                    ElementPtr lease_json = lease->toElement();
-                    leases_json->add(lease_json);
-                }
+                LeaseMgrFactory::instance().visitLeases6(write6);
             }
         }
+        writer.endList();
+        ElementPtr leases_json(new JSONTextListElement(leases_text.str(),
+                                                       count));
+        // Release the stream buffer before the response is serialized.
+        std::ostringstream().swap(leases_text);
 
         std::ostringstream s;
-        s << leases_json->size()
+        s << count
           << " IPv" << (v4 ? "4" : "6")
           << " lease(s) found.";
         ElementPtr args = Element::createMap();
         args->set("leases", leases_json);
         ConstElementPtr response =
-            createAnswer(leases_json->size() > 0 ?
+            createAnswer(count > 0 ?
                          CONTROL_RESULT_SUCCESS :
                          CONTROL_RESULT_EMPTY,
                          s.str(), args);
@@ -1083,29 +1545,93 @@ LeaseCmdsImpl::leaseGetPageHandler(CalloutHandle& handle) {
         // Retrieve the desired page size.
         size_t page_limit_value = static_cast<size_t>(tmp128);
 
-        ElementPtr leases_json = Element::createList();
+        // The optional 'to' argument is the last address of the page range.
+        boost::scoped_ptr<IOAddress> to_address;
+        ConstElementPtr to = cmd_args_->get("to");
+        if (to) {
+            if (to->getType() != Element::string) {
+                isc_throw(BadValue, "'to' parameter must be a string");
+            }
+            try {
+                to_address.reset(new IOAddress(to->stringValue()));
 
-        if (v4) {
-            // Get page of IPv4 leases.
-            Lease4Collection leases =
-                LeaseMgrFactory::instance().getLeases4(*from_address,
-                                                       LeasePageSize(page_limit_value));
+            } catch (...) {
+                isc_throw(BadValue, "'to' parameter value is not a valid IPv"
+                          << (v4 ? "4" : "6") << " address");
+            }
+            if (v4 != to_address->isV4()) {
+                isc_throw(BadValue, "'to' parameter value " << to_address->toText()
+                          << " is not an IPv" << (v4 ? "4" : "6") << " address");
+            }
+        }
 
-            // Convert leases into JSON list.
+        // The optional 'min-cltt' argument excludes the leases which were
+        // not modified since the specified time.
+        int64_t min_cltt = 0;
+        ConstElementPtr min_cltt_json = cmd_args_->get("min-cltt");
+        if (min_cltt_json) {
+            if (min_cltt_json->getType() != Element::integer) {
+                isc_throw(BadValue, "'min-cltt' parameter must be a number");
+            }
+            if (min_cltt_json->intValue() < 0) {
+                isc_throw(BadValue, "'min-cltt' parameter must not be negative");
+            }
+            min_cltt = min_cltt_json->intValue();
+        }
+
+        ElementPtr leases_json = Element::createList();
+
+        // Leases are returned in the ascending order of addresses. When
+        // leases are filtered out the pages are read until the requested
+        // number of leases is gathered, or the end of the range is reached,
+        // so a short page still means it is the last one. To bound the
+        // time spent in one command no more than MAX_FILTERED_PAGES pages
+        // are read: when this limit is hit the last address read is
+        // returned in 'next' and the caller continues from it.
+        IOAddress lower_bound_address(*from_address);
+        size_t pages = 0;
+        bool truncated = false;
+        auto add_page = [&](auto const& leases) -> bool {
+            ++pages;
             for (auto const& lease : leases) {
-                ElementPtr lease_json = lease->toElement();
-                leases_json->add(lease_json);
+                if (to_address && (*to_address < lease->addr_)) {
+                    return (false);
+                }
+                lower_bound_address = lease->addr_;
+                if (lease->cltt_ < min_cltt) {
+                    continue;
+                }
+                leases_json->add(lease->toElement());
+                if (leases_json->size() >= page_limit_value) {
+                    return (false);
+                }
+            }
+            if (leases.size() < page_limit_value) {
+                return (false);
+            }
+            if ((min_cltt > 0) && (pages >= MAX_FILTERED_PAGES)) {
+                truncated = true;
+                return (false);
+            }
+            return (true);
+        };
+
+        if (v4) {
+            // Get pages of IPv4 leases.
+            for (bool more = true; more; ) {
+                Lease4Collection leases =
+                    LeaseMgrFactory::instance().getLeases4(lower_bound_address,
+                                                           LeasePageSize(page_limit_value));
+                more = add_page(leases);
             }
 
         } else {
-            // Get page of IPv6 leases.
-            Lease6Collection leases =
-                LeaseMgrFactory::instance().getLeases6(*from_address,
-                                                       LeasePageSize(page_limit_value));
-            // Convert leases into JSON list.
-            for (auto const& lease : leases) {
-                ElementPtr lease_json = lease->toElement();
-                leases_json->add(lease_json);
+            // Get pages of IPv6 leases.
+            for (bool more = true; more; ) {
+                Lease6Collection leases =
+                    LeaseMgrFactory::instance().getLeases6(lower_bound_address,
+                                                           LeasePageSize(page_limit_value));
+                more = add_page(leases);
             }
         }
 
@@ -1119,6 +1645,9 @@ LeaseCmdsImpl::leaseGetPageHandler(CalloutHandle& handle) {
         // Put gathered data into arguments map.
         args->set("leases", leases_json);
         args->set("count", Element::create(static_cast<int64_t>(leases_json->size())));
+        if (truncated) {
+            args->set("next", Element::create(lower_bound_address.toText()));
+        }
 
         // Create the response.
         ConstElementPtr response =
@@ -1574,7 +2103,7 @@ LeaseCmdsImpl::lease4DelHandler(CalloutHandle& handle) {
 }
 
 int
-LeaseCmdsImpl::lease6BulkApplyHandler(CalloutHandle& handle) {
+LeaseCmdsImpl::lease4BulkApplyHandler(CalloutHandle& handle) {
     try {
         extractCommand(handle);
 
@@ -1605,7 +2134,7 @@ LeaseCmdsImpl::lease6BulkApplyHandler(CalloutHandle& handle) {
         // Parse deleted leases without deleting them from the database
         // yet. If any of the deleted leases or new leases appears to be
         // malformed we can easily rollback.
-        std::list<std::pair<Parameters, Lease6Ptr> > parsed_deleted_list;
+        std::list<std::pair<Parameters, Lease4Ptr> > parsed_deleted_list;
         if (deleted_leases) {
             auto leases_list = deleted_leases->listValue();
 
@@ -1613,15 +2142,15 @@ LeaseCmdsImpl::lease6BulkApplyHandler(CalloutHandle& handle) {
             for (auto const& lease_params : leases_list) {
                 // Parsing the lease may throw and it means that the lease
                 // information is malformed.
-                Parameters p = getParameters(true, lease_params);
-                auto lease = getIPv6LeaseForDelete(p);
+                Parameters p = getParameters(false, lease_params);
+                auto lease = getIPv4LeaseForDelete(p);
                 parsed_deleted_list.push_back(std::make_pair(p, lease));
             }
         }
 
         // Parse new/updated leases without affecting the database to detect
         // any errors that should cause an error response.
-        std::list<Lease6Ptr> parsed_leases_list;
+        Lease4Collection parsed_leases_list;
         if (leases) {
             ConstSrvConfigPtr config = CfgMgr::instance().getCurrentCfg();
 
@@ -1629,13 +2158,13 @@ LeaseCmdsImpl::lease6BulkApplyHandler(CalloutHandle& handle) {
             auto leases_list = leases->listValue();
             for (auto const& lease_params : leases_list) {
 
-                Lease6Parser parser;
+                Lease4Parser parser;
                 bool force_update;
 
                 // If parsing the lease fails we throw, as it indicates that the
                 // command is malformed.
-                Lease6Ptr lease6 = parser.parse(config, lease_params, force_update);
-                parsed_leases_list.push_back(lease6);
+                Lease4Ptr lease4 = parser.parse(config, lease_params, force_update);
+                parsed_leases_list.push_back(lease4);
             }
         }
 
@@ -1644,102 +2173,212 @@ LeaseCmdsImpl::lease6BulkApplyHandler(CalloutHandle& handle) {
 
         ElementPtr failed_deleted_list;
         if (!parsed_deleted_list.empty()) {
+            auto failed_delete = [&](const Lease4Ptr& lease, int result,
+                                     const std::string& text) {
+                // Lazy creation of the list of leases which failed to delete.
+                if (!failed_deleted_list) {
+                    failed_deleted_list = Element::createList();
+                }
+                failed_deleted_list->add(createFailedLeaseMap(Lease::TYPE_V4,
+                                                              lease->addr_, DuidPtr(),
+                                                              result, text));
+            };
 
-            // Iterate over leases to be deleted.
+            // Gather the leases to be deleted in one batch.
+            Lease4Collection deleted_batch;
             for (auto const& lease_params_pair : parsed_deleted_list) {
-
-                // This part is outside of the try-catch because an exception
-                // indicates that the command is malformed.
                 Parameters p = lease_params_pair.first;
                 auto lease = lease_params_pair.second;
+                if (lease) {
+                    deleted_batch.push_back(lease);
 
-                try {
-                    if (lease) {
-                        // This may throw if the lease couldn't be deleted for
-                        // any reason, but we still want to proceed with other
-                        // leases.
-                        if (LeaseMgrFactory::instance().deleteLease(lease)) {
-                            ++success_count;
-                            LeaseMgr::updateStatsOnDelete(lease);
-
-                        } else {
-                            // Lazy creation of the list of leases which failed to delete.
-                            if (!failed_deleted_list) {
-                                failed_deleted_list = Element::createList();
-                            }
-
-                            // If the lease doesn't exist we also want to put it
-                            // on the list of leases which failed to delete. That
-                            // corresponds to the lease6-del command which returns
-                            // an error when the lease doesn't exist.
-                            failed_deleted_list->add(createFailedLeaseMap(p.lease_type,
-                                                                          p.addr, p.duid,
-                                                                          CONTROL_RESULT_EMPTY,
-                                                                          "lease not found"));
-                        }
-                    }
-
-                } catch (const std::exception& ex) {
+                } else {
                     // Lazy creation of the list of leases which failed to delete.
                     if (!failed_deleted_list) {
-                         failed_deleted_list = Element::createList();
+                        failed_deleted_list = Element::createList();
                     }
-                    failed_deleted_list->add(createFailedLeaseMap(p.lease_type,
-                                                                  p.addr, p.duid,
-                                                                  CONTROL_RESULT_ERROR,
-                                                                  ex.what()));
+
+                    // If the lease doesn't exist we also want to put it
+                    // on the list of leases which failed to delete. That
+                    // corresponds to the lease4-del command which returns
+                    // an error when the lease doesn't exist.
+                    failed_deleted_list->add(createFailedLeaseMap(Lease::TYPE_V4,
+                                                                  p.addr, DuidPtr(),
+                                                                  CONTROL_RESULT_EMPTY,
+                                                                  "lease not found"));
                 }
             }
+            success_count += deleteLeases4(deleted_batch, failed_delete);
         }
 
         // Process leases to be added or/and updated.
         ElementPtr failed_leases_list;
         if (!parsed_leases_list.empty()) {
+            auto failed_lease = [&](const Lease4Ptr& lease, int result,
+                                    const std::string& text) {
+                // Lazy creation of the list of leases which failed to add/update.
+                if (!failed_leases_list) {
+                    failed_leases_list = Element::createList();
+                }
+                failed_leases_list->add(createFailedLeaseMap(Lease::TYPE_V4,
+                                                             lease->addr_,
+                                                             DuidPtr(),
+                                                             result,
+                                                             text));
+            };
+            success_count += addOrUpdateLeases4(parsed_leases_list, failed_lease);
+        }
+
+        // Start preparing the response.
+        ElementPtr args;
+
+        if (failed_deleted_list || failed_leases_list) {
+            // If there are any failed leases, let's include them in the response.
+            args = Element::createMap();
+
+            // failed-deleted-leases
+            if (failed_deleted_list) {
+                args->set("failed-deleted-leases", failed_deleted_list);
+            }
+
+            // failed-leases
+            if (failed_leases_list) {
+                args->set("failed-leases", failed_leases_list);
+            }
+        }
+
+        // Send the success response and include failed leases.
+        std::ostringstream resp_text;
+        resp_text << "Bulk apply of " << success_count << " IPv4 leases completed.";
+        auto answer = createAnswer(success_count > 0 ? CONTROL_RESULT_SUCCESS :
+                                   CONTROL_RESULT_EMPTY, resp_text.str(), args);
+        setResponse(handle, answer);
+
+        LOG_DEBUG(lease_cmds_logger, LEASE_CMDS_DBG_COMMAND_DATA,
+                  LEASE_CMDS_BULK_APPLY4)
+            .arg(success_count);
+
+    } catch (const std::exception& ex) {
+        // Unable to parse the command and similar issues.
+        LOG_ERROR(lease_cmds_logger, LEASE_CMDS_BULK_APPLY4_FAILED)
+            .arg(cmd_args_ ? cmd_args_->str() : "<no args>")
+            .arg(ex.what());
+        setErrorResponse(handle, ex.what());
+        return (CONTROL_RESULT_ERROR);
+    }
+
+    return (0);
+}
+
+int
+LeaseCmdsImpl::lease6BulkApplyHandler(CalloutHandle& handle) {
+    try {
+        extractCommand(handle);
+
+        // Arguments are mandatory.
+        if (!cmd_args_ || (cmd_args_->getType() != Element::map)) {
+            isc_throw(BadValue, "Command arguments missing or a not a map.");
+        }
+
+        // At least one of the 'deleted-leases' or 'leases' must be present.
+        auto deleted_leases = cmd_args_->get("deleted-leases");
+        auto leases = cmd_args_->get("leases");
+
+        if (!deleted_leases && !leases) {
+            isc_throw(BadValue, "neither 'deleted-leases' nor 'leases' parameter"
+                      " specified");
+        }
+
+        // Make sure that 'deleted-leases' is a list, if present.
+        if (deleted_leases && (deleted_leases->getType() != Element::list)) {
+            isc_throw(BadValue, "the 'deleted-leases' parameter must be a list");
+        }
+
+        // Make sure that 'leases' is a list, if present.
+        if (leases && (leases->getType() != Element::list)) {
+            isc_throw(BadValue, "the 'leases' parameter must be a list");
+        }
+
+        // Parse deleted leases without deleting them from the database
+        // yet. If any of the deleted leases or new leases appears to be
+        // malformed we can easily rollback.
+        std::list<std::pair<Parameters, Lease6Ptr> > parsed_deleted_list;
+        if (deleted_leases) {
+            auto leases_list = deleted_leases->listValue();
+
+            // Iterate over leases to be deleted.
+            for (auto const& lease_params : leases_list) {
+                // Parsing the lease may throw and it means that the lease
+                // information is malformed.
+                Parameters p = getParameters(true, lease_params);
+                auto lease = getIPv6LeaseForDelete(p);
+                parsed_deleted_list.push_back(std::make_pair(p, lease));
+            }
+        }
+
+        // Parse new/updated leases without affecting the database to detect
+        // any errors that should cause an error response.
+        Lease6Collection parsed_leases_list;
+        if (leases) {
             ConstSrvConfigPtr config = CfgMgr::instance().getCurrentCfg();
 
             // Iterate over all leases.
-            for (auto const& lease : parsed_leases_list) {
-
-                auto result = CONTROL_RESULT_SUCCESS;
-                std::ostringstream text;
-                try {
-                    if (!MultiThreadingMgr::instance().getMode()) {
-                        // Not multi-threading.
-                        addOrUpdate6(lease, true);
-                    } else {
-                        // Multi-threading, try to lock first to avoid a race.
-                        ResourceHandler resource_handler;
-                        if (resource_handler.tryLock(lease->type_, lease->addr_)) {
-                            addOrUpdate6(lease, true);
-                        } else {
-                            isc_throw(LeaseCmdsConflict,
-                                      "ResourceBusy: IP address:" << lease->addr_
-                                      << " could not be updated.");
-                        }
-                    }
+            auto leases_list = leases->listValue();
+            for (auto const& lease_params : leases_list) {
 
-                    ++success_count;
-                } catch (const LeaseCmdsConflict& ex) {
-                    result = CONTROL_RESULT_CONFLICT;
-                    text << ex.what();
+                Lease6Parser parser;
+                bool force_update;
 
-                } catch (const std::exception& ex) {
-                    result = CONTROL_RESULT_ERROR;
-                    text << ex.what();
+                // If parsing the lease fails we throw, as it indicates that the
+                // command is malformed.
+                Lease6Ptr lease6 = parser.parse(config, lease_params, force_update);
+                parsed_leases_list.push_back(lease6);
+            }
+        }
+
+        // Count successful deletions and updates.
+        size_t success_count = 0;
+
+        ElementPtr failed_deleted_list;
+        if (!parsed_deleted_list.empty()) {
+            auto failed_delete = [&](const Lease6Ptr& lease, int result,
+                                     const std::string& text) {
+                // Lazy creation of the list of leases which failed to delete.
+                if (!failed_deleted_list) {
+                    failed_deleted_list = Element::createList();
                 }
-                // Handle an error.
-                if (result != CONTROL_RESULT_SUCCESS) {
-                    // Lazy creation of the list of leases which failed to add/update.
-                    if (!failed_leases_list) {
-                        failed_leases_list = Element::createList();
-                    }
-                    failed_leases_list->add(createFailedLeaseMap(lease->type_,
-                                                                 lease->addr_,
-                                                                 lease->duid_,
-                                                                 result,
-                                                                 text.str()));
+                failed_deleted_list->add(createFailedLeaseMap(lease->type_,
+                                                              lease->addr_,
+                                                              lease->duid_,
+                                                              result, text));
+            };
+
+            // Gather the leases to be deleted in one batch.
+            Lease6Collection deleted_batch;
+            for (auto const& lease_params_pair : parsed_deleted_list) {
+                if (lease_params_pair.second) {
+                    deleted_batch.push_back(lease_params_pair.second);
                 }
             }
+            success_count += deleteLeases6(deleted_batch, failed_delete);
+        }
+
+        // Process leases to be added or/and updated.
+        ElementPtr failed_leases_list;
+        if (!parsed_leases_list.empty()) {
+            auto failed_lease = [&](const Lease6Ptr& lease, int result,
+                                    const std::string& text) {
+                // Lazy creation of the list of leases which failed to add/update.
+                if (!failed_leases_list) {
+                    failed_leases_list = Element::createList();
+                }
+                failed_leases_list->add(createFailedLeaseMap(lease->type_,
+                                                             lease->addr_,
+                                                             lease->duid_,
+                                                             result,
+                                                             text));
+            };
+            success_count += addOrUpdateLeases6(parsed_leases_list, failed_lease);
         }
 
         // Start preparing the response.
@@ -2284,6 +2923,52 @@ LeaseCmdsImpl::lease6WipeHandler(CalloutHandle& handle) {
     return (0);
 }
 
+Lease4Ptr
+LeaseCmdsImpl::getIPv4LeaseForDelete(const Parameters& parameters) const {
+    Lease4Ptr lease4;
+
+    switch (parameters.query_type) {
+    case Parameters::TYPE_ADDR: {
+        // Let's see if there's such a lease at all.
+        lease4 = LeaseMgrFactory::instance().getLease4(parameters.addr);
+        if (!lease4) {
+            lease4.reset(new Lease4());
+            lease4->addr_ = parameters.addr;
+        }
+        break;
+    }
+    case Parameters::TYPE_HWADDR: {
+        if (!parameters.hwaddr) {
+            isc_throw(InvalidParameter, "Program error: Query by hw-address "
+                      "requires hwaddr to be specified");
+        }
+
+        lease4 = LeaseMgrFactory::instance().getLease4(*parameters.hwaddr,
+                                                       parameters.subnet_id);
+        break;
+    }
+    case Parameters::TYPE_CLIENT_ID: {
+        if (!parameters.client_id) {
+            isc_throw(InvalidParameter, "Program error: Query by client-id "
+                      "requires client-id to be specified");
+        }
+
+        lease4 = LeaseMgrFactory::instance().getLease4(*parameters.client_id,
+                                                       parameters.subnet_id);
+        break;
+    }
+    case Parameters::TYPE_DUID: {
+        isc_throw(InvalidParameter, "Delete by duid is not allowed in v4.");
+        break;
+    }
+    default:
+        isc_throw(InvalidOperation, "Unknown query type: "
+                  << static_cast<int>(parameters.query_type));
+    }
+
+    return (lease4);
+}
+
 Lease6Ptr
 LeaseCmdsImpl::getIPv6LeaseForDelete(const Parameters& parameters) const {
     Lease6Ptr lease6;
@@ -2682,6 +3367,11 @@ LeaseCmds::leaseAddHandler(CalloutHandle& handle) {
     return (impl_->leaseAddHandler(handle));
 }
 
+int
+LeaseCmds::lease4BulkApplyHandler(CalloutHandle& handle) {
+    return (impl_->lease4BulkApplyHandler(handle));
+}
+
 int
 LeaseCmds::lease6BulkApplyHandler(CalloutHandle& handle) {
     return (impl_->lease6BulkApplyHandler(handle));
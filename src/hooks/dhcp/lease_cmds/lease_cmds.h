@@ -1,4 +1,4 @@
-// Copyright (C) 2017-2025 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2017-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -82,6 +82,48 @@ public:
     int
     leaseAddHandler(hooks::CalloutHandle& handle);
 
+    /// @brief lease4-bulk-apply command handler
+    ///
+    /// This is the DHCPv4 counterpart of the lease6-bulk-apply command.
+    /// It conveys information about multiple IPv4 leases to be added,
+    /// updated or deleted. The High Availability hooks library uses it
+    /// to send the lease updates accumulated in the backlog to the
+    /// partner in batches rather than one lease per command.
+    ///
+    /// @note Unlike leaseX-del, this command does not support "update-ddns" and
+    /// this will not generate CHG_REMOVEs for deleted leases.
+    ///
+    /// Example structure of the command:
+    ///
+    /// {
+    ///     "command": "lease4-bulk-apply",
+    ///     "arguments": {
+    ///         "deleted-leases": [
+    ///             {
+    ///                 "ip-address": "192.0.2.1",
+    ///                 ...
+    ///             }
+    ///         ],
+    ///         "leases": [
+    ///             {
+    ///                 "subnet-id": 44,
+    ///                 "ip-address": "192.0.2.2",
+    ///                 "hw-address": "1a:1b:1c:1d:1e:1f",
+    ///                 ...
+    ///             }
+    ///         ]
+    ///     }
+    /// }
+    ///
+    /// The response has the same structure as the lease6-bulk-apply
+    /// response.
+    ///
+    /// @param handle Callout context - which is expected to contain the
+    /// add command JSON text in the "command" argument
+    /// @return result of the operation
+    int
+    lease4BulkApplyHandler(hooks::CalloutHandle& handle);
+
     /// @brief lease6-bulk-apply command handler
     ///
     /// This command conveys information about multiple leases to be added,
@@ -255,6 +297,14 @@ public:
     /// returned the IPv4 zero address, IPv6 zero address or the keyword
     /// "start" should be provided instead of the last address.
     ///
+    /// The optional "to" argument gives the last address of the range
+    /// and the optional "min-cltt" argument excludes leases which were
+    /// not modified since this time. They are used by the HA lease
+    /// synchronization to fetch address ranges in parallel and only the
+    /// recently modified leases. When "min-cltt" skips many leases the
+    /// number of database pages read is capped and the response carries
+    /// a "next" argument with the address to continue from.
+    ///
     /// @param handle Callout context - which is expected to contain the
     /// get commands JSON text in the "command" argument.
     /// @return 0 if the handler has been invoked successfully, 1 if an
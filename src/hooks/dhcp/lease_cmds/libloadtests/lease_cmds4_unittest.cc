@@ -276,6 +276,18 @@ public:
     /// @brief Verifies that the limit of negative value is rejected.
     void testLease4GetPagedLimitIsNegative();
 
+    /// @brief Verifies that the 'to' and 'min-cltt' parameters of
+    /// lease4-get-page filter the returned leases.
+    void testLease4GetPagedFiltered();
+
+    /// @brief Verifies that lease4-get-page returns a continuation address
+    /// when 'min-cltt' skips too many leases.
+    void testLease4GetPagedFilteredNext();
+
+    /// @brief Verifies that invalid 'to' and 'min-cltt' parameters are
+    /// rejected.
+    void testLease4GetPagedInvalidFilters();
+
     /// @brief Check that lease4-get-by-hw-address can handle a situation when
     /// the query is broken (required parameter is missing).
     void testLease4GetByHwAddressParams();
@@ -352,6 +364,18 @@ public:
     /// a hostname.
     void testLease4UpdateDeclinedLeases();
 
+    /// @brief Check that IPv4 leases can be deleted, updated and added
+    /// with the single lease4-bulk-apply command.
+    void testLease4BulkApply();
+
+    /// @brief Check that lease4-bulk-apply reports the deleted leases
+    /// which do not exist.
+    void testLease4BulkApplyDeleteNonExisting();
+
+    /// @brief Check that lease4-bulk-apply applies in order several leases
+    /// for the same address.
+    void testLease4BulkApplySameAddress();
+
     /// @brief Check that a lease4 can be updated. We're changing hw-address and
     /// a hostname. The subnet-id is not specified.
     void testLease4UpdateNoSubnetId();
@@ -1945,6 +1969,196 @@ void Lease4CmdsTest::testLease4GetPagedLimitIsNegative() {
     testCommand(cmd, CONTROL_RESULT_ERROR, exp_rsp);
 }
 
+void Lease4CmdsTest::testLease4GetPagedFiltered() {
+    // Initialize lease manager (false = v4, true = add leases)
+    initLeaseMgr(false, true);
+
+    // Make two leases more recent than the others.
+    for (auto const& address : { "192.0.2.2", "192.0.3.2" }) {
+        Lease4Ptr lease = LeaseMgrFactory::instance().getLease4(IOAddress(address));
+        ASSERT_TRUE(lease);
+        lease->cltt_ = DEC_2030_TIME + 100;
+        ASSERT_NO_THROW(LeaseMgrFactory::instance().updateLease4(lease));
+    }
+
+    // Only the recent leases are returned, one per page.
+    std::string last_address = "start";
+    std::vector<std::string> returned;
+    for (auto i = 0; i < 3; ++i) {
+        string cmd =
+            "{\n"
+            "    \"command\": \"lease4-get-page\",\n"
+            "    \"arguments\": {"
+            "        \"from\": \"" + last_address + "\","
+            "        \"limit\": 1,"
+            "        \"min-cltt\": " + std::to_string(DEC_2030_TIME + 100) +
+            "    }"
+            "}";
+
+        ConstElementPtr rsp;
+        if (i < 2) {
+            rsp = testCommand(cmd, CONTROL_RESULT_SUCCESS, "1 IPv4 lease(s) found.");
+        } else {
+            rsp = testCommand(cmd, CONTROL_RESULT_EMPTY, "0 IPv4 lease(s) found.");
+        }
+        ASSERT_TRUE(rsp);
+        ConstElementPtr leases = rsp->get("arguments")->get("leases");
+        ASSERT_TRUE(leases);
+        for (auto const& lease : leases->listValue()) {
+            last_address = lease->get("ip-address")->stringValue();
+            returned.push_back(last_address);
+        }
+    }
+    ASSERT_EQ(2, returned.size());
+    EXPECT_EQ("192.0.2.2", returned[0]);
+    EXPECT_EQ("192.0.3.2", returned[1]);
+
+    // The page ends at the 'to' address.
+    string cmd =
+        "{\n"
+        "    \"command\": \"lease4-get-page\",\n"
+        "    \"arguments\": {"
+        "        \"from\": \"start\","
+        "        \"to\": \"192.0.2.255\","
+        "        \"limit\": 10"
+        "    }"
+        "}";
+    ConstElementPtr rsp = testCommand(cmd, CONTROL_RESULT_SUCCESS,
+                                      "2 IPv4 lease(s) found.");
+    ASSERT_TRUE(rsp);
+    ConstElementPtr leases = rsp->get("arguments")->get("leases");
+    ASSERT_TRUE(leases);
+    ASSERT_EQ(2, leases->size());
+    EXPECT_EQ("192.0.2.1", leases->get(0)->get("ip-address")->stringValue());
+    EXPECT_EQ("192.0.2.2", leases->get(1)->get("ip-address")->stringValue());
+
+    // Both filters can be combined.
+    cmd =
+        "{\n"
+        "    \"command\": \"lease4-get-page\",\n"
+        "    \"arguments\": {"
+        "        \"from\": \"192.0.2.2\","
+        "        \"to\": \"192.0.3.1\","
+        "        \"limit\": 10,"
+        "        \"min-cltt\": " + std::to_string(DEC_2030_TIME + 100) +
+        "    }"
+        "}";
+    testCommand(cmd, CONTROL_RESULT_EMPTY, "0 IPv4 lease(s) found.");
+}
+
+void Lease4CmdsTest::testLease4GetPagedFilteredNext() {
+    // Initialize lease manager (false = v4, true = add leases)
+    initLeaseMgr(false, true);
+
+    // Add many old leases before the only recent one.
+    for (auto i = 10; i < 30; ++i) {
+        string address = "192.0.2." + std::to_string(i);
+        ASSERT_NO_THROW(LeaseMgrFactory::instance().addLease(createLease4(address, 44, i, i)));
+    }
+    Lease4Ptr lease = LeaseMgrFactory::instance().getLease4(IOAddress("192.0.3.2"));
+    ASSERT_TRUE(lease);
+    lease->cltt_ = DEC_2030_TIME + 100;
+    ASSERT_NO_THROW(LeaseMgrFactory::instance().updateLease4(lease));
+
+    // The server stops after 16 pages of 1 lease and returns the
+    // address to continue from.
+    string cmd =
+        "{\n"
+        "    \"command\": \"lease4-get-page\",\n"
+        "    \"arguments\": {"
+        "        \"from\": \"start\","
+        "        \"limit\": 1,"
+        "        \"min-cltt\": " + std::to_string(DEC_2030_TIME + 100) +
+        "    }"
+        "}";
+    ConstElementPtr rsp = testCommand(cmd, CONTROL_RESULT_EMPTY, "0 IPv4 lease(s) found.");
+    ASSERT_TRUE(rsp);
+    ConstElementPtr next = rsp->get("arguments")->get("next");
+    ASSERT_TRUE(next);
+    EXPECT_EQ("192.0.2.23", next->stringValue());
+
+    // The next call finds the recent lease and reaches the end.
+    cmd =
+        "{\n"
+        "    \"command\": \"lease4-get-page\",\n"
+        "    \"arguments\": {"
+        "        \"from\": \"192.0.2.23\","
+        "        \"limit\": 1,"
+        "        \"min-cltt\": " + std::to_string(DEC_2030_TIME + 100) +
+        "    }"
+        "}";
+    rsp = testCommand(cmd, CONTROL_RESULT_SUCCESS, "1 IPv4 lease(s) found.");
+    ASSERT_TRUE(rsp);
+    ConstElementPtr leases = rsp->get("arguments")->get("leases");
+    ASSERT_TRUE(leases);
+    ASSERT_EQ(1, leases->size());
+    EXPECT_EQ("192.0.3.2", leases->get(0)->get("ip-address")->stringValue());
+    EXPECT_FALSE(rsp->get("arguments")->get("next"));
+
+    // Without 'min-cltt' the number of pages is not capped.
+    cmd =
+        "{\n"
+        "    \"command\": \"lease4-get-page\",\n"
+        "    \"arguments\": {"
+        "        \"from\": \"start\","
+        "        \"limit\": 100"
+        "    }"
+        "}";
+    rsp = testCommand(cmd, CONTROL_RESULT_SUCCESS, "24 IPv4 lease(s) found.");
+    ASSERT_TRUE(rsp);
+    EXPECT_FALSE(rsp->get("arguments")->get("next"));
+}
+
+void Lease4CmdsTest::testLease4GetPagedInvalidFilters() {
+    // Initialize lease manager (false = v4, true = add leases)
+    initLeaseMgr(false, true);
+
+    string cmd =
+        "{\n"
+        "    \"command\": \"lease4-get-page\",\n"
+        "    \"arguments\": {"
+        "        \"from\": \"start\","
+        "        \"to\": 1,"
+        "        \"limit\": 2"
+        "    }"
+        "}";
+    testCommand(cmd, CONTROL_RESULT_ERROR, "'to' parameter must be a string");
+
+    cmd =
+        "{\n"
+        "    \"command\": \"lease4-get-page\",\n"
+        "    \"arguments\": {"
+        "        \"from\": \"start\","
+        "        \"to\": \"2001:db8::1\","
+        "        \"limit\": 2"
+        "    }"
+        "}";
+    testCommand(cmd, CONTROL_RESULT_ERROR,
+                "'to' parameter value 2001:db8::1 is not an IPv4 address");
+
+    cmd =
+        "{\n"
+        "    \"command\": \"lease4-get-page\",\n"
+        "    \"arguments\": {"
+        "        \"from\": \"start\","
+        "        \"limit\": 2,"
+        "        \"min-cltt\": \"now\""
+        "    }"
+        "}";
+    testCommand(cmd, CONTROL_RESULT_ERROR, "'min-cltt' parameter must be a number");
+
+    cmd =
+        "{\n"
+        "    \"command\": \"lease4-get-page\",\n"
+        "    \"arguments\": {"
+        "        \"from\": \"start\","
+        "        \"limit\": 2,"
+        "        \"min-cltt\": -1"
+        "    }"
+        "}";
+    testCommand(cmd, CONTROL_RESULT_ERROR, "'min-cltt' parameter must not be negative");
+}
+
 void Lease4CmdsTest::testLease4GetByHwAddressParams() {
     // No parameters whatsoever.
     string cmd =
@@ -2625,6 +2839,171 @@ void Lease4CmdsTest::testLease4Update() {
     EXPECT_FALSE(l->getContext());
 }
 
+void Lease4CmdsTest::testLease4BulkApply() {
+    // Initialize lease manager (false = v4, true = add leases)
+    initLeaseMgr(false, true);
+
+    checkLease4Stats(0, 4, 0);
+
+    checkLease4Stats(44, 2, 0);
+
+    checkLease4Stats(88, 2, 0);
+
+    // Now send the command.
+    string txt =
+        "{\n"
+        "    \"command\": \"lease4-bulk-apply\",\n"
+        "    \"arguments\": {"
+        "        \"deleted-leases\": ["
+        "            {"
+        "                \"ip-address\": \"192.0.2.1\""
+        "            },"
+        "            {"
+        "                \"ip-address\": \"192.0.2.2\""
+        "            }"
+        "        ],"
+        "        \"leases\": ["
+        "            {"
+        "                \"subnet-id\": 88,\n"
+        "                \"ip-address\": \"192.0.3.1\",\n"
+        "                \"hw-address\": \"1a:1b:1c:1d:1e:1f\"\n"
+        "            },"
+        "            {"
+        "                \"subnet-id\": 88,\n"
+        "                \"ip-address\": \"192.0.3.202\",\n"
+        "                \"hw-address\": \"2a:2b:2c:2d:2e:2f\"\n"
+        "            }"
+        "        ]"
+        "    }"
+        "}";
+    string exp_rsp = "Bulk apply of 4 IPv4 leases completed.";
+
+    // The status expected is success.
+    testCommand(txt, CONTROL_RESULT_SUCCESS, exp_rsp);
+
+    checkLease4Stats(0, 3, 0);
+
+    checkLease4Stats(44, 0, 0);
+
+    checkLease4Stats(88, 3, 0);
+
+    // Check that the leases we deleted are gone.
+    EXPECT_FALSE(lmptr_->getLease4(IOAddress("192.0.2.1")));
+    EXPECT_FALSE(lmptr_->getLease4(IOAddress("192.0.2.2")));
+
+    // Check that the lease has been updated.
+    Lease4Ptr l = lmptr_->getLease4(IOAddress("192.0.3.1"));
+    ASSERT_TRUE(l);
+    ASSERT_TRUE(l->hwaddr_);
+    EXPECT_EQ("1a:1b:1c:1d:1e:1f", l->hwaddr_->toText(false));
+
+    // Check that the new lease has been added.
+    EXPECT_TRUE(lmptr_->getLease4(IOAddress("192.0.3.202")));
+}
+
+void Lease4CmdsTest::testLease4BulkApplyDeleteNonExisting() {
+    // Initialize lease manager (false = v4, true = add leases)
+    initLeaseMgr(false, true);
+
+    // Now send the command.
+    string txt =
+        "{\n"
+        "    \"command\": \"lease4-bulk-apply\",\n"
+        "    \"arguments\": {"
+        "        \"deleted-leases\": ["
+        "            {"
+        "                \"ip-address\": \"192.0.2.123\""
+        "            },"
+        "            {"
+        "                \"ip-address\": \"192.0.2.234\""
+        "            }"
+        "        ]"
+        "    }"
+        "}";
+    string exp_rsp = "Bulk apply of 0 IPv4 leases completed.";
+
+    auto resp = testCommand(txt, CONTROL_RESULT_EMPTY, exp_rsp);
+    ASSERT_TRUE(resp);
+    ASSERT_EQ(Element::map, resp->getType());
+
+    checkLease4Stats(0, 4, 0);
+
+    checkLease4Stats(44, 2, 0);
+
+    checkLease4Stats(88, 2, 0);
+
+    auto args = resp->get("arguments");
+    ASSERT_TRUE(args);
+    ASSERT_EQ(Element::map, args->getType());
+
+    auto failed_deleted_leases = args->get("failed-deleted-leases");
+    ASSERT_TRUE(failed_deleted_leases);
+    ASSERT_EQ(Element::list, failed_deleted_leases->getType());
+    ASSERT_EQ(2U, failed_deleted_leases->size());
+
+    {
+        SCOPED_TRACE("lease address 192.0.2.123");
+        checkFailedLease(failed_deleted_leases, "V4", "192.0.2.123",
+                         CONTROL_RESULT_EMPTY, "lease not found");
+    }
+
+    {
+        SCOPED_TRACE("lease address 192.0.2.234");
+        checkFailedLease(failed_deleted_leases, "V4", "192.0.2.234",
+                         CONTROL_RESULT_EMPTY, "lease not found");
+    }
+}
+
+void Lease4CmdsTest::testLease4BulkApplySameAddress() {
+    // Initialize lease manager (false = v4, true = add leases)
+    initLeaseMgr(false, true);
+
+    // The leases are written in batches of distinct addresses: the
+    // second lease for an address is written after the first one.
+    string txt =
+        "{\n"
+        "    \"command\": \"lease4-bulk-apply\",\n"
+        "    \"arguments\": {"
+        "        \"leases\": ["
+        "            {"
+        "                \"subnet-id\": 88,\n"
+        "                \"ip-address\": \"192.0.3.202\",\n"
+        "                \"hw-address\": \"1a:1b:1c:1d:1e:1f\"\n"
+        "            },"
+        "            {"
+        "                \"subnet-id\": 88,\n"
+        "                \"ip-address\": \"192.0.3.1\",\n"
+        "                \"hw-address\": \"1a:1b:1c:1d:1e:1f\"\n"
+        "            },"
+        "            {"
+        "                \"subnet-id\": 88,\n"
+        "                \"ip-address\": \"192.0.3.202\",\n"
+        "                \"hw-address\": \"2a:2b:2c:2d:2e:2f\"\n"
+        "            }"
+        "        ]"
+        "    }"
+        "}";
+    string exp_rsp = "Bulk apply of 3 IPv4 leases completed.";
+    auto resp = testCommand(txt, CONTROL_RESULT_SUCCESS, exp_rsp);
+    ASSERT_TRUE(resp);
+    EXPECT_FALSE(resp->get("arguments"));
+
+    checkLease4Stats(0, 5, 0);
+
+    checkLease4Stats(88, 3, 0);
+
+    // The last lease for the address wins.
+    Lease4Ptr l = lmptr_->getLease4(IOAddress("192.0.3.202"));
+    ASSERT_TRUE(l);
+    ASSERT_TRUE(l->hwaddr_);
+    EXPECT_EQ("2a:2b:2c:2d:2e:2f", l->hwaddr_->toText(false));
+
+    l = lmptr_->getLease4(IOAddress("192.0.3.1"));
+    ASSERT_TRUE(l);
+    ASSERT_TRUE(l->hwaddr_);
+    EXPECT_EQ("1a:1b:1c:1d:1e:1f", l->hwaddr_->toText(false));
+}
+
 void Lease4CmdsTest::testLease4UpdateDeclinedLeases() {
     // Initialize lease manager (false = v4, true = add leases)
     initLeaseMgr(false, true, true);
@@ -4426,6 +4805,33 @@ TEST_F(Lease4CmdsTest, lease4GetPagedLimitIsNegativeMultiThreading) {
     testLease4GetPagedLimitIsNegative();
 }
 
+TEST_F(Lease4CmdsTest, lease4GetPagedFiltered) {
+    testLease4GetPagedFiltered();
+}
+
+TEST_F(Lease4CmdsTest, lease4GetPagedFilteredMultiThreading) {
+    MultiThreadingTest mt(true);
+    testLease4GetPagedFiltered();
+}
+
+TEST_F(Lease4CmdsTest, lease4GetPagedFilteredNext) {
+    testLease4GetPagedFilteredNext();
+}
+
+TEST_F(Lease4CmdsTest, lease4GetPagedFilteredNextMultiThreading) {
+    MultiThreadingTest mt(true);
+    testLease4GetPagedFilteredNext();
+}
+
+TEST_F(Lease4CmdsTest, lease4GetPagedInvalidFilters) {
+    testLease4GetPagedInvalidFilters();
+}
+
+TEST_F(Lease4CmdsTest, lease4GetPagedInvalidFiltersMultiThreading) {
+    MultiThreadingTest mt(true);
+    testLease4GetPagedInvalidFilters();
+}
+
 TEST_F(Lease4CmdsTest, lease4GetByHwAddressParams) {
     testLease4GetByHwAddressParams();
 }
@@ -4588,6 +4994,33 @@ TEST_F(Lease4CmdsTest, lease4UpdateMultiThreading) {
     testLease4Update();
 }
 
+TEST_F(Lease4CmdsTest, lease4BulkApply) {
+    testLease4BulkApply();
+}
+
+TEST_F(Lease4CmdsTest, lease4BulkApplyMultiThreading) {
+    MultiThreadingTest mt(true);
+    testLease4BulkApply();
+}
+
+TEST_F(Lease4CmdsTest, lease4BulkApplyDeleteNonExisting) {
+    testLease4BulkApplyDeleteNonExisting();
+}
+
+TEST_F(Lease4CmdsTest, lease4BulkApplyDeleteNonExistingMultiThreading) {
+    MultiThreadingTest mt(true);
+    testLease4BulkApplyDeleteNonExisting();
+}
+
+TEST_F(Lease4CmdsTest, lease4BulkApplySameAddress) {
+    testLease4BulkApplySameAddress();
+}
+
+TEST_F(Lease4CmdsTest, lease4BulkApplySameAddressMultiThreading) {
+    MultiThreadingTest mt(true);
+    testLease4BulkApplySameAddress();
+}
+
 TEST_F(Lease4CmdsTest, lease4UpdateDeclinedLeases) {
     testLease4UpdateDeclinedLeases();
 }
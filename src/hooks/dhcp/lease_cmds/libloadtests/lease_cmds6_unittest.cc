@@ -305,6 +305,18 @@ public:
     /// @brief Verifies that the limit of negative value is rejected.
     void testLease6GetPagedLimitIsNegative();
 
+    /// @brief Verifies that the 'to' and 'min-cltt' parameters of
+    /// lease6-get-page filter the returned leases.
+    void testLease6GetPagedFiltered();
+
+    /// @brief Verifies that lease6-get-page returns a continuation address
+    /// when 'min-cltt' skips too many leases.
+    void testLease6GetPagedFilteredNext();
+
+    /// @brief Verifies that invalid 'to' and 'min-cltt' parameters are
+    /// rejected.
+    void testLease6GetPagedInvalidFilters();
+
     /// @brief Check that lease6-get-by-hw-address can handle a situation when
     /// the query is broken (required parameter is missing).
     void testLease6GetByHwAddressParams();
@@ -2222,6 +2234,198 @@ void Lease6CmdsTest::testLease6GetPagedLimitIsNegative() {
     testCommand(cmd, CONTROL_RESULT_ERROR, exp_rsp);
 }
 
+void Lease6CmdsTest::testLease6GetPagedFiltered() {
+    // Initialize lease manager (true = v6, true = add leases)
+    initLeaseMgr(true, true);
+
+    // Make two leases more recent than the others.
+    for (auto const& address : { "2001:db8:1::2", "2001:db8:2::2" }) {
+        Lease6Ptr lease = LeaseMgrFactory::instance().getLease6(Lease::TYPE_NA,
+                                                                     IOAddress(address));
+        ASSERT_TRUE(lease);
+        lease->cltt_ = DEC_2030_TIME + 100;
+        ASSERT_NO_THROW(LeaseMgrFactory::instance().updateLease6(lease));
+    }
+
+    // Only the recent leases are returned, one per page.
+    std::string last_address = "start";
+    std::vector<std::string> returned;
+    for (auto i = 0; i < 3; ++i) {
+        string cmd =
+            "{\n"
+            "    \"command\": \"lease6-get-page\",\n"
+            "    \"arguments\": {"
+            "        \"from\": \"" + last_address + "\","
+            "        \"limit\": 1,"
+            "        \"min-cltt\": " + std::to_string(DEC_2030_TIME + 100) +
+            "    }"
+            "}";
+
+        ConstElementPtr rsp;
+        if (i < 2) {
+            rsp = testCommand(cmd, CONTROL_RESULT_SUCCESS, "1 IPv6 lease(s) found.");
+        } else {
+            rsp = testCommand(cmd, CONTROL_RESULT_EMPTY, "0 IPv6 lease(s) found.");
+        }
+        ASSERT_TRUE(rsp);
+        ConstElementPtr leases = rsp->get("arguments")->get("leases");
+        ASSERT_TRUE(leases);
+        for (auto const& lease : leases->listValue()) {
+            last_address = lease->get("ip-address")->stringValue();
+            returned.push_back(last_address);
+        }
+    }
+    ASSERT_EQ(2, returned.size());
+    EXPECT_EQ("2001:db8:1::2", returned[0]);
+    EXPECT_EQ("2001:db8:2::2", returned[1]);
+
+    // The page ends at the 'to' address.
+    string cmd =
+        "{\n"
+        "    \"command\": \"lease6-get-page\",\n"
+        "    \"arguments\": {"
+        "        \"from\": \"start\","
+        "        \"to\": \"2001:db8:1::ffff\","
+        "        \"limit\": 10"
+        "    }"
+        "}";
+    ConstElementPtr rsp = testCommand(cmd, CONTROL_RESULT_SUCCESS,
+                                      "2 IPv6 lease(s) found.");
+    ASSERT_TRUE(rsp);
+    ConstElementPtr leases = rsp->get("arguments")->get("leases");
+    ASSERT_TRUE(leases);
+    ASSERT_EQ(2, leases->size());
+    EXPECT_EQ("2001:db8:1::1", leases->get(0)->get("ip-address")->stringValue());
+    EXPECT_EQ("2001:db8:1::2", leases->get(1)->get("ip-address")->stringValue());
+
+    // Both filters can be combined.
+    cmd =
+        "{\n"
+        "    \"command\": \"lease6-get-page\",\n"
+        "    \"arguments\": {"
+        "        \"from\": \"2001:db8:1::2\","
+        "        \"to\": \"2001:db8:2::1\","
+        "        \"limit\": 10,"
+        "        \"min-cltt\": " + std::to_string(DEC_2030_TIME + 100) +
+        "    }"
+        "}";
+    testCommand(cmd, CONTROL_RESULT_EMPTY, "0 IPv6 lease(s) found.");
+}
+
+void Lease6CmdsTest::testLease6GetPagedFilteredNext() {
+    // Initialize lease manager (true = v6, true = add leases)
+    initLeaseMgr(true, true);
+
+    // Add many old leases before the only recent one.
+    for (auto i = 10; i < 30; ++i) {
+        string address = "2001:db8:1::" + std::to_string(i);
+        ASSERT_NO_THROW(LeaseMgrFactory::instance().addLease(createLease6(address, 66, i)));
+    }
+    Lease6Ptr lease = LeaseMgrFactory::instance().getLease6(Lease::TYPE_NA,
+                                                            IOAddress("2001:db8:2::2"));
+    ASSERT_TRUE(lease);
+    lease->cltt_ = DEC_2030_TIME + 100;
+    ASSERT_NO_THROW(LeaseMgrFactory::instance().updateLease6(lease));
+
+    // The server stops after 16 pages of 1 lease and returns the
+    // address to continue from.
+    string cmd =
+        "{\n"
+        "    \"command\": \"lease6-get-page\",\n"
+        "    \"arguments\": {"
+        "        \"from\": \"start\","
+        "        \"limit\": 1,"
+        "        \"min-cltt\": " + std::to_string(DEC_2030_TIME + 100) +
+        "    }"
+        "}";
+    ConstElementPtr rsp = testCommand(cmd, CONTROL_RESULT_EMPTY, "0 IPv6 lease(s) found.");
+    ASSERT_TRUE(rsp);
+    ConstElementPtr next = rsp->get("arguments")->get("next");
+    ASSERT_TRUE(next);
+    EXPECT_EQ("2001:db8:1::23", next->stringValue());
+
+    // The next call finds the recent lease and reaches the end.
+    cmd =
+        "{\n"
+        "    \"command\": \"lease6-get-page\",\n"
+        "    \"arguments\": {"
+        "        \"from\": \"2001:db8:1::23\","
+        "        \"limit\": 1,"
+        "        \"min-cltt\": " + std::to_string(DEC_2030_TIME + 100) +
+        "    }"
+        "}";
+    rsp = testCommand(cmd, CONTROL_RESULT_SUCCESS, "1 IPv6 lease(s) found.");
+    ASSERT_TRUE(rsp);
+    ConstElementPtr leases = rsp->get("arguments")->get("leases");
+    ASSERT_TRUE(leases);
+    ASSERT_EQ(1, leases->size());
+    EXPECT_EQ("2001:db8:2::2", leases->get(0)->get("ip-address")->stringValue());
+    EXPECT_FALSE(rsp->get("arguments")->get("next"));
+
+    // Without 'min-cltt' the number of pages is not capped.
+    cmd =
+        "{\n"
+        "    \"command\": \"lease6-get-page\",\n"
+        "    \"arguments\": {"
+        "        \"from\": \"start\","
+        "        \"limit\": 100"
+        "    }"
+        "}";
+    rsp = testCommand(cmd, CONTROL_RESULT_SUCCESS, "24 IPv6 lease(s) found.");
+    ASSERT_TRUE(rsp);
+    EXPECT_FALSE(rsp->get("arguments")->get("next"));
+}
+
+void Lease6CmdsTest::testLease6GetPagedInvalidFilters() {
+    // Initialize lease manager (true = v6, true = add leases)
+    initLeaseMgr(true, true);
+
+    string cmd =
+        "{\n"
+        "    \"command\": \"lease6-get-page\",\n"
+        "    \"arguments\": {"
+        "        \"from\": \"start\","
+        "        \"to\": 1,"
+        "        \"limit\": 2"
+        "    }"
+        "}";
+    testCommand(cmd, CONTROL_RESULT_ERROR, "'to' parameter must be a string");
+
+    cmd =
+        "{\n"
+        "    \"command\": \"lease6-get-page\",\n"
+        "    \"arguments\": {"
+        "        \"from\": \"start\","
+        "        \"to\": \"192.0.2.1\","
+        "        \"limit\": 2"
+        "    }"
+        "}";
+    testCommand(cmd, CONTROL_RESULT_ERROR,
+                "'to' parameter value 192.0.2.1 is not an IPv6 address");
+
+    cmd =
+        "{\n"
+        "    \"command\": \"lease6-get-page\",\n"
+        "    \"arguments\": {"
+        "        \"from\": \"start\","
+        "        \"limit\": 2,"
+        "        \"min-cltt\": \"now\""
+        "    }"
+        "}";
+    testCommand(cmd, CONTROL_RESULT_ERROR, "'min-cltt' parameter must be a number");
+
+    cmd =
+        "{\n"
+        "    \"command\": \"lease6-get-page\",\n"
+        "    \"arguments\": {"
+        "        \"from\": \"start\","
+        "        \"limit\": 2,"
+        "        \"min-cltt\": -1"
+        "    }"
+        "}";
+    testCommand(cmd, CONTROL_RESULT_ERROR, "'min-cltt' parameter must not be negative");
+}
+
 void Lease6CmdsTest::testLease6GetByHwAddressParams() {
     // No parameters whatsoever.
     string cmd =
@@ -5500,6 +5704,33 @@ TEST_F(Lease6CmdsTest, lease6GetPagedLimitIsNegativeMultiThreading) {
     testLease6GetPagedLimitIsNegative();
 }
 
+TEST_F(Lease6CmdsTest, lease6GetPagedFiltered) {
+    testLease6GetPagedFiltered();
+}
+
+TEST_F(Lease6CmdsTest, lease6GetPagedFilteredMultiThreading) {
+    MultiThreadingTest mt(true);
+    testLease6GetPagedFiltered();
+}
+
+TEST_F(Lease6CmdsTest, lease6GetPagedFilteredNext) {
+    testLease6GetPagedFilteredNext();
+}
+
+TEST_F(Lease6CmdsTest, lease6GetPagedFilteredNextMultiThreading) {
+    MultiThreadingTest mt(true);
+    testLease6GetPagedFilteredNext();
+}
+
+TEST_F(Lease6CmdsTest, lease6GetPagedInvalidFilters) {
+    testLease6GetPagedInvalidFilters();
+}
+
+TEST_F(Lease6CmdsTest, lease6GetPagedInvalidFiltersMultiThreading) {
+    MultiThreadingTest mt(true);
+    testLease6GetPagedInvalidFilters();
+}
+
 TEST_F(Lease6CmdsTest, lease6GetByHwAddressParams) {
     testLease6GetByHwAddressParams();
 }
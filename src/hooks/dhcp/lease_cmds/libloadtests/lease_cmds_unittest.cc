@@ -43,6 +43,7 @@ namespace {
 TEST_F(LeaseCmdsTest, commands) {
     vector<string> cmds = {
         "lease4-add",               "lease6-add",
+        "lease4-bulk-apply",        "lease6-bulk-apply",
         "lease4-get",               "lease6-get",
         "lease4-get-all",           "lease6-get-all",
         "lease4-get-page",          "lease6-get-page",
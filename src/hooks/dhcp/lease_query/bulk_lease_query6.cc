@@ -503,12 +503,11 @@ BulkLeaseQuery6::bulkQueryByLinkAddress() {
 void
 BulkLeaseQuery6::bulkQueryByLinkAddressNext() {
     Lease6Collection leases;
-    const IOAddress position = start_addr_;
     LeaseQueryImpl6::queryByLinkNext(start_addr_,
                                      page_size_,
                                      links_,
                                      leases);
-    if (start_addr_ == position) {
+    if (leases.empty()) {
         // Construct and send the done message.
         Pkt6Ptr done = LeaseQueryImpl6::initDone(query6_);
         send(done);
@@ -524,45 +524,13 @@ LeaseQueryImpl6::queryByLinkStart(IOAddress& start_addr,
         return (makeStatusOption(STATUS_NotConfigured, "not a configured link"));
     }
 
-    Lease6Collection found_leases;
-    // Iterate over subnets.
-    for (;;) {
-        // Try first subnet.
-        auto it = links.begin();
-        if (it == links.end()) {
-            // No subnet: done.
-            return (makeStatusOption(STATUS_Success, "no active leases"));
-        }
-        // Fetch an initial page of leases on the subnet.
-        start_addr = IOAddress::IPV6_ZERO_ADDRESS();
-        for (;;) {
-            // Database possible call: check if the hook was terminated.
-            CHECK_TERMINATED;
-
-            found_leases =
-                LeaseMgrFactory::instance().getLeases6(*it, start_addr,
-                                                       LeasePageSize(page_size));
-            if (found_leases.empty()) {
-                // Remove the current subnet and try the next one.
-                links.erase(it);
-                start_addr = IOAddress::IPV6_ZERO_ADDRESS();
-                break;
-            }
-
-            // Record the last address to restart from this point.
-            start_addr = found_leases.back()->addr_;
-            for (auto const& lease : found_leases) {
-                if (lease->state_ == Lease::STATE_DEFAULT &&
-                    !lease->expired()) {
-                    // It's a match, keep it.
-                    leases.push_back(lease);
-                }
-            }
-            if (!leases.empty()) {
-                return (makeStatusOption(STATUS_Success, "active lease(s) found"));
-            }
-        }
+    // Fetch an initial page of leases on the link.
+    start_addr = IOAddress::IPV6_ZERO_ADDRESS();
+    queryByLinkNext(start_addr, page_size, links, leases);
+    if (leases.empty()) {
+        return (makeStatusOption(STATUS_Success, "no active leases"));
     }
+    return (makeStatusOption(STATUS_Success, "active lease(s) found"));
 }
 
 void
@@ -571,7 +539,6 @@ LeaseQueryImpl6::queryByLinkNext(IOAddress& start_addr,
                                  SubnetIDSet& links,
                                  Lease6Collection& leases) {
 
-    Lease6Collection found_leases;
     // Iterate over subnets.
     for (;;) {
         // Try first subnet.
@@ -580,40 +547,35 @@ LeaseQueryImpl6::queryByLinkNext(IOAddress& start_addr,
             // No subnet: done.
             return;
         }
-        // Fetch next page of leases on the subnet.
-        for (;;) {
-            // Database possible call: check if the hook was terminated.
-            CHECK_TERMINATED;
-
-            found_leases =
-                LeaseMgrFactory::instance().getLeases6(*it, start_addr,
-                                                       LeasePageSize(page_size));
-            if (found_leases.empty()) {
-                // Remove the current subnet and try the next one.
-                links.erase(it);
-                start_addr = IOAddress::IPV6_ZERO_ADDRESS();
-                break;
-            }
-
-            const IOAddress seen = start_addr;
-            // Record the last address to restart from this point.
-            start_addr = found_leases.back()->addr_;
-            if (start_addr == seen) {
-                return;
-            }
-            for (auto const& lease : found_leases) {
-                if (lease->addr_ == seen) {
-                    continue;
-                }
+        // Visit the leases of the subnet from the restart point until
+        // a page of active leases was collected.
+        bool full = false;
+        LeaseMgrFactory::instance().visitLeases6(*it, start_addr,
+            [&start_addr, page_size, &leases, &full](const Lease6Ptr& lease) {
+                // Database possible call: check if the hook was terminated.
+                CHECK_TERMINATED;
+
+                // Record the last address to restart from this point.
+                start_addr = lease->addr_;
                 if (lease->state_ == Lease::STATE_DEFAULT &&
                     !lease->expired()) {
                     // It's a match, keep it.
                     leases.push_back(lease);
+                    if (leases.size() >= page_size) {
+                        full = true;
+                        return (false);
+                    }
                 }
-            }
-            if (!leases.empty()) {
-                return;
-            }
+                return (true);
+            }, page_size);
+        if (full) {
+            return;
+        }
+        // Remove the current subnet and try the next one.
+        links.erase(it);
+        start_addr = IOAddress::IPV6_ZERO_ADDRESS();
+        if (!leases.empty()) {
+            return;
         }
     }
 }
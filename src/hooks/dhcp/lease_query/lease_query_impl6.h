@@ -132,9 +132,10 @@ public:
     /// A lease matches if it was relayed by the given relay, is active,
     /// and it belongs to the subnet whose range includes the link address
     /// if the specified link address is not ::.
-    /// The start address is used to note progress: if it is not updated
-    /// there is no more leases to retrieve, otherwise the method should be
-    /// called again with the updated value to retrieve remaining leases.
+    /// The leases are visited page by page from the start address which
+    /// is updated to note progress: when no lease is returned there is no
+    /// more leases to retrieve, otherwise the method should be called again
+    /// with the updated value to retrieve remaining leases.
     ///
     /// @param relay_id relay DUID for which to search.
     /// @param page_size maximum number of returned leases in this call.
@@ -180,9 +181,10 @@ public:
     /// A lease matches if it was remoteed by the given relay, is active,
     /// and it belongs to the subnet whose range includes the link address
     /// if the specified link address is not ::.
-    /// The start address is used to note progress: if it is not updated
-    /// there is no more leases to retrieve, otherwise the method should be
-    /// called again with the updated value to retrieve remaining leases.
+    /// The leases are visited page by page from the start address which
+    /// is updated to note progress: when no lease is returned there is no
+    /// more leases to retrieve, otherwise the method should be called again
+    /// with the updated value to retrieve remaining leases.
     ///
     /// @param remote_id remote id for which to search.
     /// @param[inout] start_addr address to start from.
@@ -224,9 +226,10 @@ public:
     /// matching leases, sorted by address.
     /// A lease matches if it to the subnet whose range includes
     /// the link address.
-    /// The start address is used to note progress: if it is not updated
-    /// there is no more leases to retrieve, otherwise the method should be
-    /// called again with the updated value to retrieve remaining leases.
+    /// The leases are visited page by page from the start address which
+    /// is updated to note progress: when no lease is returned there is no
+    /// more leases to retrieve, otherwise the method should be called again
+    /// with the updated value to retrieve remaining leases.
     ///
     /// @param[inout] start_addr address to start from.
     /// @param page_size maximum number of returned leases in this call.
@@ -1,4 +1,4 @@
-// Copyright (C) 2022-2025 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2022-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -16,6 +16,7 @@
 #include <limits/limit_manager.h>
 #include <util/dhcp_space.h>
 
+#include <algorithm>
 #include <string>
 
 using namespace isc::data;
@@ -23,10 +24,52 @@ using namespace isc::dhcp;
 using namespace isc::util;
 
 using namespace std;
+using namespace std::chrono;
 
 namespace isc {
 namespace limits {
 
+bool
+RateLimiter::conform(RateLimit const& limit, TimePoint const& now) {
+    // A limit of 0 packets drops everything.
+    if (limit.allowed_packets_ == 0) {
+        return (false);
+    }
+
+    int64_t const interval(emissionInterval(limit));
+    int64_t const tolerance(interval * (limit.allowed_packets_ - 1));
+    int64_t const arrival(duration_cast<nanoseconds>(now.time_since_epoch()).count());
+
+    int64_t tat(tat_.load(memory_order_relaxed));
+    int64_t next_tat;
+    do {
+        // An idle limiter starts over from the arrival time.
+        int64_t const start(max(tat, arrival));
+        if (start - arrival > tolerance) {
+            return (false);
+        }
+        next_tat = start + interval;
+    } while (!tat_.compare_exchange_weak(tat, next_tat, memory_order_relaxed));
+
+    return (true);
+}
+
+void
+RateLimiter::uncount(RateLimit const& limit) {
+    if (limit.allowed_packets_ == 0) {
+        return;
+    }
+
+    tat_.fetch_sub(emissionInterval(limit), memory_order_relaxed);
+}
+
+int64_t
+RateLimiter::emissionInterval(RateLimit const& limit) {
+    int64_t const interval(duration_cast<nanoseconds>(limit.time_unit_).count() /
+                           limit.allowed_packets_);
+    return (max(interval, static_cast<int64_t>(1)));
+}
+
 LimitManager&
 LimitManager::instance() {
     static LimitManager instance;
@@ -35,8 +78,8 @@ LimitManager::instance() {
 
 void
 LimitManager::clear() {
-    clocked_in_times_by_class_.clear();
-    clocked_in_times_by_subnet_id_.clear();
+    rate_limiters_by_class_.clear();
+    rate_limiters_by_subnet_id_.clear();
 }
 
 void
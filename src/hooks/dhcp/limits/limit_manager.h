@@ -23,34 +23,131 @@
 #include <util/dhcp_space.h>
 #include <util/multi_threading_mgr.h>
 
-#include <boost/circular_buffer.hpp>
-
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace isc {
 namespace limits {
 
 /// @brief a point in time
-using TimePoint = std::chrono::time_point<std::chrono::system_clock>;
+///
+/// A monotonic clock is used so that wall clock adjustments do not affect rate limiting.
+using TimePoint = std::chrono::time_point<std::chrono::steady_clock>;
+
+/// @brief Rate limiting state of a single criterion.
+///
+/// Implements the generic cell rate algorithm (GCRA), a token bucket which keeps a single time
+/// point: the theoretical arrival time (TAT) of the next packet. A rate limit of n packets per time
+/// unit spaces packets by an emission interval of one time unit divided by n, and tolerates bursts
+/// of n packets. A packet conforms to the limit if the TAT is not later than its arrival time plus
+/// n - 1 emission intervals, and it is then counted by moving the TAT to one emission interval
+/// after the latest of the TAT and of its arrival time.
+///
+/// The TAT is kept in an atomic integer updated with a compare-and-swap, so concurrent packets do
+/// not need a lock, and the memory used does not depend on the limit.
+class RateLimiter {
+public:
+    /// @brief Constructor.
+    RateLimiter() : tat_(0) {
+    }
+
+    /// @brief Checks if a packet conforms to a rate limit and counts it if it does.
+    ///
+    /// @param limit the rate limit
+    /// @param now the arrival time of the packet
+    ///
+    /// @return true if the packet conforms to the limit, false if it exceeds it
+    bool conform(RateLimit const& limit, TimePoint const& now);
 
-/// @brief Holds a number of time points, used in limiting by a single criterion.
-/// It is important to use a data structure that ensures O(1) deletion.
-using TimeSeries = boost::circular_buffer<TimePoint>;
+    /// @brief Uncounts a packet which conformed to a rate limit but was dropped because of another
+    /// limit.
+    ///
+    /// @param limit the rate limit the packet conformed to
+    void uncount(RateLimit const& limit);
 
-/// @brief Holds a number of time points, used in limiting by a single criterion, and a mutex to
-/// protect concurrent reads and writes.
-struct ProtectedTimeSeries {
-    /// @brief Protects against races on the time points which can be edited at each hook callout.
-    std::mutex mutex_;
+    /// @brief Returns the time between two packets at the limit rate.
+    ///
+    /// @param limit the rate limit, which must allow at least one packet
+    ///
+    /// @return the emission interval in nanoseconds, at least 1
+    static int64_t emissionInterval(RateLimit const& limit);
 
-    /// @brief Holds the actual time points.
-    TimeSeries time_points_;
+private:
+    /// @brief The theoretical arrival time of the next packet in nanoseconds since the clock
+    /// epoch.
+    std::atomic<int64_t> tat_;
 };
 
-/// @brief Defines a smart pointer to a ProtectedTimeSeries.
-typedef std::shared_ptr<ProtectedTimeSeries> ProtectedTimeSeriesPtr;
+/// @brief Defines a smart pointer to a RateLimiter.
+typedef std::shared_ptr<RateLimiter> RateLimiterPtr;
+
+/// @brief Holds the rate limiters of a criterion, indexed by client class or subnet ID.
+///
+/// The table is split into shards, each with its own mutex which is only held to find or create a
+/// limiter, so that packets limited by different keys rarely contend with each other.
+///
+/// @tparam Key the type of the criterion
+template <typename Key>
+class RateLimiterTable {
+public:
+    /// @brief Number of shards.
+    static const size_t SHARDS = 64;
+
+    /// @brief Returns the limiter of a key, creating it if it does not exist yet.
+    ///
+    /// @param key the key
+    ///
+    /// @return the limiter
+    RateLimiterPtr get(Key const& key) {
+        Shard& shard(shards_[std::hash<Key>()(key) % SHARDS]);
+        isc::util::MultiThreadingLock lock(shard.mutex_);
+        RateLimiterPtr& limiter(shard.limiters_[key]);
+        if (!limiter) {
+            limiter = std::make_shared<RateLimiter>();
+        }
+        return (limiter);
+    }
+
+    /// @brief Removes all limiters.
+    void clear() {
+        for (Shard& shard : shards_) {
+            isc::util::MultiThreadingLock lock(shard.mutex_);
+            shard.limiters_.clear();
+        }
+    }
+
+    /// @brief Returns the number of limiters.
+    ///
+    /// @return the number of limiters
+    size_t size() {
+        size_t result(0);
+        for (Shard& shard : shards_) {
+            isc::util::MultiThreadingLock lock(shard.mutex_);
+            result += shard.limiters_.size();
+        }
+        return (result);
+    }
+
+private:
+    /// @brief A part of the table.
+    struct Shard {
+        /// @brief Protects the limiters map, not the limiters themselves.
+        std::mutex mutex_;
+
+        /// @brief The limiters indexed by key.
+        std::unordered_map<Key, RateLimiterPtr> limiters_;
+    };
+
+    /// @brief The shards.
+    std::array<Shard, SHARDS> shards_;
+};
 
 /// @brief Provides the capability to limit the number of leases or the response rate.
 struct LimitManager {
@@ -59,12 +156,12 @@ struct LimitManager {
     /// @return the singleton
     static LimitManager& instance();
 
-    /// @brief Clears the time series circular buffers in order to start over rate limiting.
+    /// @brief Clears the rate limiters in order to start over rate limiting.
     void clear();
 
     /// @brief Reinitialize data structures required for limiting
     ///
-    /// First clears the time series circular buffers, then proceeds to parse
+    /// First clears the rate limiters, then proceeds to parse
     /// the relevant configuration.
     ///
     /// @param config the configuration to be parsed - usually current or staging
@@ -72,8 +169,8 @@ struct LimitManager {
 
     /// @brief Fetches limits from the given Kea configuration.
     ///
-    /// Searches the Kea configuration for any limits in user contexts, then
-    /// sets the new capacities on the buffers.
+    /// Searches the Kea configuration for any limits in user contexts and
+    /// logs them.
     ///
     /// @param config the configuration to be parsed - usually current or staging
     void parse(isc::dhcp::SrvConfigPtr const& config);
@@ -81,7 +178,7 @@ struct LimitManager {
     /// @brief cbX_updated hook point
     ///
     /// If changes are detected for any client classes or subnets, the whole limits
-    /// configuration is updated. Time points are not reset, because there might be a significant
+    /// configuration is updated. Rate limiters are not reset, because there might be a significant
     /// amount of client classes and subnets that remain the same. On top of that, the ones who
     /// changed might still match clients that have been limited with the same client class or
     /// subnet prior to the CB update, so there is some relevancy to the current calculation.
@@ -158,9 +255,9 @@ struct LimitManager {
 
     /// @brief pktX_receive hook point
     ///
-    /// Handles per-client-class rate limits. For every packet, remove all expired counted packets
-    /// from the buffer, check if the limit is reached i.e. if the buffer is full, and finally count
-    /// the current packet toward the limit if there is still room in the buffer.
+    /// Handles per-client-class rate limits. The packet is counted toward the limit of each of its
+    /// limited client classes it conforms to. If it exceeds one of them, it is dropped and
+    /// uncounted from the limits of the previous classes.
     ///
     /// @tparam D DHCP space
     /// @param handle callout handle used for the subnet ID
@@ -188,16 +285,11 @@ struct LimitManager {
         auto const& relations = packet->getSubClassesRelations();
 
         // Get the current time.
-        TimePoint const now(std::chrono::system_clock::now());
-
-        // Should contain client classes that are both in the packet and that are limited.
-        std::vector<isc::dhcp::ClientClass> common_client_classes;
+        TimePoint const now(std::chrono::steady_clock::now());
 
-        // Lock a global-wide mutex for all client classes. It's not a necessary condition, but it's
-        // sufficient. Locking per client class, similarly to how it happens for subnet IDs would
-        // have been more efficient in a more heterogeneous class-to-packet distribution, but that
-        // situation is not guaranteed.
-        isc::util::MultiThreadingLock lock(mutex_);
+        // Should contain the limiters of the client classes that are both in the packet and that
+        // are limited, with their limit.
+        std::vector<std::pair<RateLimiterPtr, RateLimit>> counted;
 
         // Check if the rate limit is respected.
         for (auto const& c : relations) {
@@ -215,24 +307,11 @@ struct LimitManager {
             // Get the limit.
             RateLimit const& limit(limit_cfg->stringValue());
 
-            // Get the time series. Create a list on this class if not already added to the map.
-            TimeSeries& time_series(clocked_in_times_by_class_[c.class_]);
-
-            time_series.set_capacity(limit.allowed_packets_);
-
-            // Remove all expired times.
-            while (!time_series.empty()) {
-                if (time_series.back() + limit.time_unit_ < now) {
-                    time_series.pop_back();
-                } else {
-                    // This is an optimization. Job is finished at the first time point that is not
-                    // expired. The rest are sorted and higher in value, thus not expired.
-                    break;
-                }
-            }
+            // Get the limiter. Create one for this class if not already added to the table.
+            RateLimiterPtr const limiter(rate_limiters_by_class_.get(c.class_));
 
             // Effectively check the limit.
-            if (time_series.size() == limit.allowed_packets_) {
+            if (!limiter->conform(limit, now)) {
                 // Drop the packet.
                 handle.setStatus(isc::hooks::CalloutHandle::NEXT_STEP_DROP);
 
@@ -246,14 +325,17 @@ struct LimitManager {
                 break;
             }
 
-            // Cache the set of client classes that are both in the packet and limited. If packet is
-            // not dropped, they will be iterated through one more time further below. As such, the
-            // configuration lookup for each client class at the beginning of this loop will no
-            // longer be required.
-            common_client_classes.push_back(c.class_);
+            // Remember the limiter. If the packet is dropped because of a subsequent client class,
+            // the packet is uncounted from it.
+            counted.push_back(std::make_pair(limiter, limit));
         }
 
         if (handle.getStatus() == isc::hooks::CalloutHandle::NEXT_STEP_DROP) {
+            // Dropped packets are not counted.
+            for (auto const& limiter_limit : counted) {
+                limiter_limit.first->uncount(limiter_limit.second);
+            }
+
             isc::stats::StatsMgr& stats_mgr = isc::stats::StatsMgr::instance();
             if (D == isc::util::DhcpSpace::DHCPv4) {
                 stats_mgr.addValue("pkt4-limit-exceeded",
@@ -266,19 +348,11 @@ struct LimitManager {
                 stats_mgr.addValue("pkt6-receive-drop",
                                    static_cast<int64_t>(1));
             }
-        } else {
-            // Honor the packet and keep track of it.
-            for (auto const& c : common_client_classes) {
-                TimeSeries& time_series(clocked_in_times_by_class_.at(c));
-                time_series.push_front(now);
-            }
-
+        } else if (!counted.empty()) {
             // Only log that the packet is within the limit if this packet is being rate limited.
-            if (!common_client_classes.empty()) {
-                LOG_DEBUG(limits_logger, isc::log::DBGLVL_TRACE_DETAIL_DATA,
-                          LIMITS_PACKET_WITH_CLIENT_CLASSES_RATE_LIMIT_HONORED)
-                    .arg(classes.toText());
-            }
+            LOG_DEBUG(limits_logger, isc::log::DBGLVL_TRACE_DETAIL_DATA,
+                      LIMITS_PACKET_WITH_CLIENT_CLASSES_RATE_LIMIT_HONORED)
+                .arg(classes.toText());
         }
 
         return (0);
@@ -286,9 +360,8 @@ struct LimitManager {
 
     /// @brief subnetX_select hook point
     ///
-    /// Handles per-subnet rate limits. For every packet, remove all expired counted packets from
-    /// the buffer, check if the limit is reached i.e. if the buffer is full, and finally count the
-    /// current packet toward the limit if there is still room in the buffer. This function also
+    /// Handles per-subnet rate limits. The packet is counted toward the limit of the subnet if it
+    /// conforms to it, otherwise it is dropped. This function also
     /// checks if subnets were updated through subnet commands, or any other method that
     /// circumvented reconfiguration, and updates the limits accordingly.
     ///
@@ -323,44 +396,14 @@ struct LimitManager {
             return (0);
         }
 
-        ProtectedTimeSeriesPtr time_series;
-
-        // Lock a global-wide mutex while configuration can be read-to and written-from.
-        {
-            isc::util::MultiThreadingLock lock(mutex_);
-
-            // Create a time series on this subnet ID if not already added to the map.
-            ProtectedTimeSeriesPtr& time_series_ref(clocked_in_times_by_subnet_id_[subnet_id]);
-            if (!time_series_ref) {
-                time_series_ref = std::make_shared<ProtectedTimeSeries>();
-            }
-            time_series = time_series_ref;
-        }
+        // Get the limiter. Create one for this subnet ID if not already added to the table.
+        RateLimiterPtr const limiter(rate_limiters_by_subnet_id_.get(subnet_id));
 
         // Get the current time.
-        TimePoint const now(std::chrono::system_clock::now());
-
-        // Lock the mutex on this subnet ID.
-        isc::util::MultiThreadingLock lock(time_series->mutex_);
-
-        time_series->time_points_.set_capacity(limit.allowed_packets_);
-
-        // Remove all expired times.
-        while (!time_series->time_points_.empty()) {
-            if (time_series->time_points_.back() + limit.time_unit_ < now) {
-                time_series->time_points_.pop_back();
-            } else {
-                // This is an optimization. Job is finished at the first time point that is not
-                // expired. The rest are sorted and higher in value, thus not expired.
-                break;
-            }
-        }
+        TimePoint const now(std::chrono::steady_clock::now());
 
         // Check the limit.
-        if (time_series->time_points_.size() < limit.allowed_packets_) {
-            // Honor the packet and keep track of it.
-            time_series->time_points_.push_front(now);
-        } else {
+        if (!limiter->conform(limit, now)) {
             // Drop the packet.
             handle.setStatus(isc::hooks::CalloutHandle::NEXT_STEP_DROP);
 
@@ -552,17 +595,11 @@ private:
     template <isc::util::DhcpSpace D>
     void recountClassLeases() const;
 
-    /// @brief arrival times of packets for a time span equal to the configured
-    /// time unit indexed by client class
-    std::unordered_map<isc::dhcp::ClientClass, TimeSeries> clocked_in_times_by_class_;
-
-    /// @brief arrival times of packets for a time span equal to the configured
-    /// time unit indexed by subnet ID
-    std::unordered_map<isc::dhcp::SubnetID, ProtectedTimeSeriesPtr> clocked_in_times_by_subnet_id_;
+    /// @brief rate limiting state indexed by client class
+    RateLimiterTable<isc::dhcp::ClientClass> rate_limiters_by_class_;
 
-    /// @brief A mutex used to protect read and write access to all the client
-    /// classes' time points and to all the limits configuration.
-    std::mutex mutex_;
+    /// @brief rate limiting state indexed by subnet ID
+    RateLimiterTable<isc::dhcp::SubnetID> rate_limiters_by_subnet_id_;
 
     /// @brief Holds the configured address limits.
     AddressLimitConfiguration address_limit_configuration_;
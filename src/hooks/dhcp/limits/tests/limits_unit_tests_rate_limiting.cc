@@ -1,4 +1,4 @@
-// Copyright (C) 2022-2025 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2022-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -18,8 +18,10 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <chrono>
 #include <thread>
+#include <vector>
 
 namespace {
 
@@ -1235,4 +1237,100 @@ TEST_F(RateLimitV6, limitExpiresWithTemplateClientClassMultiThreading) {
     sendPacketAndExpectStatus(manager, {"foo", "bar"}, CalloutHandle::NEXT_STEP_DROP, true);
 }
 
+// Check that a rate limiter lets a burst of the limit through then spaces packets by the
+// emission interval.
+TEST(RateLimiterTest, conform) {
+    RateLimiter limiter;
+    RateLimit const limit("4 packets per second");
+    EXPECT_EQ(250000000, RateLimiter::emissionInterval(limit));
+
+    // A burst of 4 packets conforms, the 5th does not.
+    TimePoint const now(std::chrono::steady_clock::now());
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(limiter.conform(limit, now)) << "packet " << i;
+    }
+    EXPECT_FALSE(limiter.conform(limit, now));
+
+    // One packet conforms after each emission interval.
+    EXPECT_FALSE(limiter.conform(limit, now + std::chrono::milliseconds(249)));
+    EXPECT_TRUE(limiter.conform(limit, now + std::chrono::milliseconds(250)));
+    EXPECT_FALSE(limiter.conform(limit, now + std::chrono::milliseconds(250)));
+
+    // An uncounted packet makes room for another one.
+    limiter.uncount(limit);
+    EXPECT_TRUE(limiter.conform(limit, now + std::chrono::milliseconds(250)));
+
+    // A full burst conforms again after one time unit of inactivity.
+    TimePoint const later(now + std::chrono::milliseconds(1500));
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(limiter.conform(limit, later)) << "packet " << i;
+    }
+    EXPECT_FALSE(limiter.conform(limit, later));
+}
+
+// Check that a limit of 0 packets drops everything and that huge limits still conform.
+TEST(RateLimiterTest, boundaries) {
+    RateLimiter zero;
+    RateLimit const zero_limit("0 packets per second");
+    TimePoint const now(std::chrono::steady_clock::now());
+    EXPECT_FALSE(zero.conform(zero_limit, now));
+    EXPECT_NO_THROW(zero.uncount(zero_limit));
+    EXPECT_FALSE(zero.conform(zero_limit, now + std::chrono::hours(1)));
+
+    RateLimiter huge;
+    RateLimit const huge_limit("4294967295 packets per second");
+    EXPECT_EQ(1, RateLimiter::emissionInterval(huge_limit));
+    for (int i = 0; i < 1000; ++i) {
+        EXPECT_TRUE(huge.conform(huge_limit, now)) << "packet " << i;
+    }
+
+    RateLimiter yearly;
+    RateLimit const yearly_limit("1 packet per year");
+    EXPECT_TRUE(yearly.conform(yearly_limit, now));
+    EXPECT_FALSE(yearly.conform(yearly_limit, now + std::chrono::hours(364 * 24)));
+    EXPECT_TRUE(yearly.conform(yearly_limit, now + std::chrono::hours(365 * 24)));
+}
+
+// Check that concurrent packets are counted exactly once.
+TEST(RateLimiterTest, concurrency) {
+    RateLimiter limiter;
+    RateLimit const limit("1000 packets per year");
+    TimePoint const now(std::chrono::steady_clock::now());
+    std::atomic<int> conforming(0);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; ++t) {
+        threads.push_back(std::thread([&]() {
+            for (int i = 0; i < 500; ++i) {
+                if (limiter.conform(limit, now)) {
+                    ++conforming;
+                }
+            }
+        }));
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(1000, conforming);
+}
+
+// Check that the rate limiter table creates one limiter per key.
+TEST(RateLimiterTableTest, get) {
+    RateLimiterTable<SubnetID> table;
+    EXPECT_EQ(0U, table.size());
+
+    RateLimiterPtr const first(table.get(1));
+    ASSERT_TRUE(first);
+    EXPECT_EQ(first, table.get(1));
+    RateLimiterPtr const second(table.get(2));
+    ASSERT_TRUE(second);
+    EXPECT_NE(first, second);
+    EXPECT_EQ(2U, table.size());
+
+    table.clear();
+    EXPECT_EQ(0U, table.size());
+    EXPECT_NE(first, table.get(1));
+}
+
 }  // namespace
@@ -175,6 +175,15 @@ tagged_statements = { {
                         "state, user_context, relay_id, remote_id, pool_id "
                             "FROM lease4 "
                             "WHERE subnet_id = ?"},
+    {MySqlLeaseMgr::GET_LEASE4_SUBID_PAGE,
+                    "SELECT address, hwaddr, client_id, "
+                        "valid_lifetime, expire, subnet_id, "
+                        "fqdn_fwd, fqdn_rev, hostname, "
+                        "state, user_context, relay_id, remote_id, pool_id "
+                            "FROM lease4 "
+                            "WHERE subnet_id = ? AND address > ? "
+                            "ORDER BY address "
+                            "LIMIT ?"},
     {MySqlLeaseMgr::GET_LEASE4_STATE,
                     "SELECT address, hwaddr, client_id, "
                         "valid_lifetime, expire, subnet_id, "
@@ -470,37 +479,57 @@ tagged_statements = { {
                         "state = ?, user_context = ?, pool_id = ? "
                             "WHERE address = ? AND expire = ?"},
     {MySqlLeaseMgr::ALL_LEASE4_STATS,
-                    "SELECT subnet_id, state, leases as state_count "
-                        "FROM lease4_stat ORDER BY subnet_id, state"},
+                    "SELECT subnet_id, state, "
+                        "CAST(SUM(leases) AS SIGNED) as state_count "
+                        "FROM lease4_stat "
+                        "GROUP BY subnet_id, state "
+                        "ORDER BY subnet_id, state"},
     {MySqlLeaseMgr::SUBNET_LEASE4_STATS,
-                    "SELECT subnet_id, state, leases as state_count "
+                    "SELECT subnet_id, state, "
+                        "CAST(SUM(leases) AS SIGNED) as state_count "
                         "FROM lease4_stat "
                         "WHERE subnet_id = ? "
+                        "GROUP BY subnet_id, state "
                         "ORDER BY state"},
     {MySqlLeaseMgr::SUBNET_RANGE_LEASE4_STATS,
-                    "SELECT subnet_id, state, leases as state_count "
+                    "SELECT subnet_id, state, "
+                        "CAST(SUM(leases) AS SIGNED) as state_count "
                         "FROM lease4_stat "
                         "WHERE subnet_id >= ? and subnet_id <= ? "
+                        "GROUP BY subnet_id, state "
                         "ORDER BY subnet_id, state"},
     {MySqlLeaseMgr::ALL_POOL_LEASE4_STATS,
-                    "SELECT subnet_id, pool_id, state, leases as state_count "
-                        "FROM lease4_pool_stat ORDER BY subnet_id, pool_id, state"},
+                    "SELECT subnet_id, pool_id, state, "
+                        "CAST(SUM(leases) AS SIGNED) as state_count "
+                        "FROM lease4_pool_stat "
+                        "GROUP BY subnet_id, pool_id, state "
+                        "ORDER BY subnet_id, pool_id, state"},
     {MySqlLeaseMgr::ALL_LEASE6_STATS,
-                    "SELECT subnet_id, lease_type, state, leases as state_count "
-                        "FROM lease6_stat ORDER BY subnet_id, lease_type, state"},
+                    "SELECT subnet_id, lease_type, state, "
+                        "CAST(SUM(leases) AS SIGNED) as state_count "
+                        "FROM lease6_stat "
+                        "GROUP BY subnet_id, lease_type, state "
+                        "ORDER BY subnet_id, lease_type, state"},
     {MySqlLeaseMgr::SUBNET_LEASE6_STATS,
-                    "SELECT subnet_id, lease_type, state, leases as state_count "
+                    "SELECT subnet_id, lease_type, state, "
+                        "CAST(SUM(leases) AS SIGNED) as state_count "
                         "FROM lease6_stat "
                         "WHERE subnet_id = ? "
+                        "GROUP BY subnet_id, lease_type, state "
                         "ORDER BY lease_type, state"},
     {MySqlLeaseMgr::SUBNET_RANGE_LEASE6_STATS,
-                    "SELECT subnet_id, lease_type, state, leases as state_count "
+                    "SELECT subnet_id, lease_type, state, "
+                        "CAST(SUM(leases) AS SIGNED) as state_count "
                         "FROM lease6_stat "
                         "WHERE subnet_id >= ? and subnet_id <= ? "
+                        "GROUP BY subnet_id, lease_type, state "
                         "ORDER BY subnet_id, lease_type, state"},
     {MySqlLeaseMgr::ALL_POOL_LEASE6_STATS,
-                    "SELECT subnet_id, pool_id, lease_type, state, leases as state_count "
-                        "FROM lease6_pool_stat ORDER BY subnet_id, pool_id, lease_type, state"},
+                    "SELECT subnet_id, pool_id, lease_type, state, "
+                        "CAST(SUM(leases) AS SIGNED) as state_count "
+                        "FROM lease6_pool_stat "
+                        "GROUP BY subnet_id, pool_id, lease_type, state "
+                        "ORDER BY subnet_id, pool_id, lease_type, state"},
     {MySqlLeaseMgr::CHECK_LEASE4_LIMITS,
                     "SELECT checkLease4Limits(?)"},
     {MySqlLeaseMgr::CHECK_LEASE6_LIMITS,
@@ -2525,6 +2554,32 @@ MySqlLeaseMgr::addLeaseCommon(MySqlLeaseContextPtr& ctx,
     return (true);
 }
 
+bool
+MySqlLeaseMgr::addLeaseInternal(MySqlLeaseContextPtr& ctx,
+                                const Lease4Ptr& lease) {
+    // Create the MYSQL_BIND array for the lease
+    std::vector<MYSQL_BIND> bind = ctx->exchange4_->createBindForSend(lease);
+
+    // ... and drop to common code.
+    if (!useSharedFlqStatement(lease)) {
+        return (addLeaseCommon(ctx, INSERT_LEASE4, bind));
+    }
+    return (addLeaseCommon(ctx, SFLQ_INSERT_LEASE4, bind, true));
+}
+
+bool
+MySqlLeaseMgr::addLeaseInternal(MySqlLeaseContextPtr& ctx,
+                                const Lease6Ptr& lease) {
+    // Create the MYSQL_BIND array for the lease
+    std::vector<MYSQL_BIND> bind = ctx->exchange6_->createBindForSend(lease);
+
+    // ... and drop to common code.
+    if (!useSharedFlqStatement(lease)) {
+        return (addLeaseCommon(ctx, INSERT_LEASE6, bind));
+    }
+    return (addLeaseCommon(ctx, SFLQ_INSERT_LEASE6, bind, true));
+}
+
 bool
 MySqlLeaseMgr::addLease(const Lease4Ptr& lease) {
     LOG_DEBUG(mysql_lb_logger, MYSQL_LB_DBG_TRACE_DETAIL, MYSQL_LB_ADD_ADDR4)
@@ -2534,16 +2589,7 @@ MySqlLeaseMgr::addLease(const Lease4Ptr& lease) {
     MySqlLeaseTrackingContextAlloc get_context(*this, lease);
     MySqlLeaseContextPtr ctx = get_context.ctx_;
 
-    // Create the MYSQL_BIND array for the lease
-    std::vector<MYSQL_BIND> bind = ctx->exchange4_->createBindForSend(lease);
-
-    // ... and drop to common code.
-    bool result = false;
-    if (!useSharedFlqStatement(lease)) {
-        result = addLeaseCommon(ctx, INSERT_LEASE4, bind);
-    } else {
-        result = addLeaseCommon(ctx, SFLQ_INSERT_LEASE4, bind, true);
-    }
+    bool result = addLeaseInternal(ctx, lease);
 
     // Update lease current expiration time (allows update between the creation
     // of the Lease up to the point of insertion in the database).
@@ -2569,16 +2615,7 @@ MySqlLeaseMgr::addLease(const Lease6Ptr& lease) {
     MySqlLeaseTrackingContextAlloc get_context(*this, lease);
     MySqlLeaseContextPtr ctx = get_context.ctx_;
 
-    // Create the MYSQL_BIND array for the lease
-    std::vector<MYSQL_BIND> bind = ctx->exchange6_->createBindForSend(lease);
-
-    // ... and drop to common code.
-    bool result = false;
-    if (!useSharedFlqStatement(lease)) {
-        result = addLeaseCommon(ctx, INSERT_LEASE6, bind);
-    } else {
-        result = addLeaseCommon(ctx, SFLQ_INSERT_LEASE6, bind, true);
-    }
+    bool result = addLeaseInternal(ctx, lease);
 
     // Update lease current expiration time (allows update between the creation
     // of the Lease up to the point of insertion in the database).
@@ -2596,6 +2633,100 @@ MySqlLeaseMgr::addLease(const Lease6Ptr& lease) {
     return (result);
 }
 
+Lease4Collection
+MySqlLeaseMgr::addLeases(const Lease4Collection& leases) {
+    // In multi-threaded mode the callbacks require to lock each lease:
+    // add them one by one.
+    if (leases.empty() ||
+        (hasCallbacks() && MultiThreadingMgr::instance().getMode())) {
+        return (LeaseMgr::addLeases(leases));
+    }
+
+    LOG_DEBUG(mysql_lb_logger, MYSQL_LB_DBG_TRACE_DETAIL, MYSQL_LB_ADD_LEASES4)
+        .arg(leases.size());
+
+    // Get a context
+    MySqlLeaseContextAlloc get_context(*this);
+    MySqlLeaseContextPtr ctx = get_context.ctx_;
+
+    // Insert all leases in one transaction so they are committed at once.
+    Lease4Collection added;
+    Lease4Collection failed;
+    MySqlTransaction transaction(ctx->conn_);
+    for (auto const& lease : leases) {
+        if (addLeaseInternal(ctx, lease)) {
+            added.push_back(lease);
+        } else {
+            failed.push_back(lease);
+        }
+    }
+    transaction.commit();
+
+    for (auto const& lease : leases) {
+        lease->updateCurrentExpirationTime();
+    }
+
+    // Run installed callbacks.
+    if (hasCallbacks()) {
+        for (auto const& lease : added) {
+            trackAddLease(lease);
+        }
+    }
+
+    return (failed);
+}
+
+Lease6Collection
+MySqlLeaseMgr::addLeases(const Lease6Collection& leases) {
+    // In multi-threaded mode the callbacks require to lock each lease:
+    // add them one by one.
+    if (leases.empty() ||
+        (hasCallbacks() && MultiThreadingMgr::instance().getMode())) {
+        return (LeaseMgr::addLeases(leases));
+    }
+
+    LOG_DEBUG(mysql_lb_logger, MYSQL_LB_DBG_TRACE_DETAIL, MYSQL_LB_ADD_LEASES6)
+        .arg(leases.size());
+
+    // Get a context
+    MySqlLeaseContextAlloc get_context(*this);
+    MySqlLeaseContextPtr ctx = get_context.ctx_;
+
+    // Insert all leases in one transaction so they are committed at once.
+    Lease6Collection added;
+    Lease6Collection failed;
+    MySqlTransaction transaction(ctx->conn_);
+    for (auto const& lease : leases) {
+        lease->extended_info_action_ = Lease6::ACTION_IGNORE;
+        if (addLeaseInternal(ctx, lease)) {
+            added.push_back(lease);
+        } else {
+            failed.push_back(lease);
+        }
+    }
+    transaction.commit();
+
+    for (auto const& lease : leases) {
+        lease->updateCurrentExpirationTime();
+    }
+
+    // The extended info tables reference the committed leases.
+    if (getExtendedInfoTablesEnabled()) {
+        for (auto const& lease : added) {
+            static_cast<void>(addExtendedInfo6(lease));
+        }
+    }
+
+    // Run installed callbacks.
+    if (hasCallbacks()) {
+        for (auto const& lease : added) {
+            trackAddLease(lease);
+        }
+    }
+
+    return (failed);
+}
+
 // Extraction of leases from the database.
 //
 // All getLease() methods ultimately call getLeaseCollection().  This
@@ -3077,6 +3208,56 @@ MySqlLeaseMgr::getLeases4(const IOAddress& lower_bound_address,
     return (result);
 }
 
+Lease4Collection
+MySqlLeaseMgr::getLeases4(SubnetID subnet_id,
+                          const IOAddress& lower_bound_address,
+                          const LeasePageSize& page_size) const {
+    // Expecting IPv4 address.
+    if (!lower_bound_address.isV4()) {
+        isc_throw(InvalidAddressFamily, "expected IPv4 address while "
+                  "retrieving leases from the lease database, got "
+                  << lower_bound_address);
+    }
+
+    LOG_DEBUG(mysql_lb_logger, MYSQL_LB_DBG_TRACE_DETAIL,
+              MYSQL_LB_GET_SUBID_PAGE4)
+        .arg(page_size.page_size_)
+        .arg(lower_bound_address.toText())
+        .arg(subnet_id);
+
+    // Prepare WHERE clause
+    MYSQL_BIND inbind[3];
+    memset(inbind, 0, sizeof(inbind));
+
+    // Bind the subnet id.
+    inbind[0].buffer_type = MYSQL_TYPE_LONG;
+    inbind[0].buffer = reinterpret_cast<char*>(&subnet_id);
+    inbind[0].is_unsigned = MLM_TRUE;
+
+    // Bind lower bound address
+    uint32_t lb_address_data = lower_bound_address.toUint32();
+    inbind[1].buffer_type = MYSQL_TYPE_LONG;
+    inbind[1].buffer = reinterpret_cast<char*>(&lb_address_data);
+    inbind[1].is_unsigned = MLM_TRUE;
+
+    // Bind page size value
+    uint32_t ps = static_cast<uint32_t>(page_size.page_size_);
+    inbind[2].buffer_type = MYSQL_TYPE_LONG;
+    inbind[2].buffer = reinterpret_cast<char*>(&ps);
+    inbind[2].is_unsigned = MLM_TRUE;
+
+    // Get the leases
+    Lease4Collection result;
+
+    // Get a context
+    MySqlLeaseContextAlloc get_context(*this);
+    MySqlLeaseContextPtr ctx = get_context.ctx_;
+
+    getLeaseCollection(ctx, GET_LEASE4_SUBID_PAGE, inbind, result);
+
+    return (result);
+}
+
 Lease6Ptr
 MySqlLeaseMgr::getLease6(Lease::Type lease_type,
                          const IOAddress& addr) const {
@@ -3650,14 +3831,8 @@ MySqlLeaseMgr::updateLeaseCommon(MySqlLeaseContextPtr& ctx,
 }
 
 void
-MySqlLeaseMgr::updateLease4(const Lease4Ptr& lease) {
-    LOG_DEBUG(mysql_lb_logger, MYSQL_LB_DBG_TRACE_DETAIL, MYSQL_LB_UPDATE_ADDR4)
-        .arg(lease->addr_.toText());
-
-    // Get a context
-    MySqlLeaseTrackingContextAlloc get_context(*this, lease);
-    MySqlLeaseContextPtr ctx = get_context.ctx_;
-
+MySqlLeaseMgr::updateLeaseInternal(MySqlLeaseContextPtr& ctx,
+                                   const Lease4Ptr& lease) {
     // Create the MYSQL_BIND array for the data being updated
     std::vector<MYSQL_BIND> bind = ctx->exchange4_->createBindForSend(lease);
 
@@ -3693,6 +3868,18 @@ MySqlLeaseMgr::updateLease4(const Lease4Ptr& lease) {
     } else {
         updateLeaseCommon(ctx, SFLQ_UPDATE_LEASE4, &bind[0], lease, true);
     }
+}
+
+void
+MySqlLeaseMgr::updateLease4(const Lease4Ptr& lease) {
+    LOG_DEBUG(mysql_lb_logger, MYSQL_LB_DBG_TRACE_DETAIL, MYSQL_LB_UPDATE_ADDR4)
+        .arg(lease->addr_.toText());
+
+    // Get a context
+    MySqlLeaseTrackingContextAlloc get_context(*this, lease);
+    MySqlLeaseContextPtr ctx = get_context.ctx_;
+
+    updateLeaseInternal(ctx, lease);
 
     // Update lease current expiration time.
     lease->updateCurrentExpirationTime();
@@ -3704,19 +3891,8 @@ MySqlLeaseMgr::updateLease4(const Lease4Ptr& lease) {
 }
 
 void
-MySqlLeaseMgr::updateLease6(const Lease6Ptr& lease) {
-    LOG_DEBUG(mysql_lb_logger, MYSQL_LB_DBG_TRACE_DETAIL, MYSQL_LB_UPDATE_ADDR6)
-        .arg(lease->addr_.toText())
-        .arg(Lease::typeToText(lease->type_));
-
-    // Get the recorded action and reset it.
-    Lease6::ExtendedInfoAction recorded_action = lease->extended_info_action_;
-    lease->extended_info_action_ = Lease6::ACTION_IGNORE;
-
-    // Get a context
-    MySqlLeaseTrackingContextAlloc get_context(*this, lease);
-    MySqlLeaseContextPtr ctx = get_context.ctx_;
-
+MySqlLeaseMgr::updateLeaseInternal(MySqlLeaseContextPtr& ctx,
+                                   const Lease6Ptr& lease) {
     // Create the MYSQL_BIND array for the data being updated
     std::vector<MYSQL_BIND> bind = ctx->exchange6_->createBindForSend(lease);
 
@@ -3759,31 +3935,152 @@ MySqlLeaseMgr::updateLease6(const Lease6Ptr& lease) {
     } else {
         updateLeaseCommon(ctx, SFLQ_UPDATE_LEASE6, &bind[0], lease, true);
     }
+}
+
+void
+MySqlLeaseMgr::updateLease6(const Lease6Ptr& lease) {
+    LOG_DEBUG(mysql_lb_logger, MYSQL_LB_DBG_TRACE_DETAIL, MYSQL_LB_UPDATE_ADDR6)
+        .arg(lease->addr_.toText())
+        .arg(Lease::typeToText(lease->type_));
+
+    // Get the recorded action and reset it.
+    Lease6::ExtendedInfoAction recorded_action = lease->extended_info_action_;
+    lease->extended_info_action_ = Lease6::ACTION_IGNORE;
+
+    // Get a context
+    MySqlLeaseTrackingContextAlloc get_context(*this, lease);
+    MySqlLeaseContextPtr ctx = get_context.ctx_;
+
+    updateLeaseInternal(ctx, lease);
 
     // Update lease current expiration time.
     lease->updateCurrentExpirationTime();
 
     // Update extended info tables.
     if (getExtendedInfoTablesEnabled()) {
-        switch (recorded_action) {
-        case Lease6::ACTION_IGNORE:
-            break;
+        updateExtendedInfo6(lease, recorded_action);
+    }
 
-        case Lease6::ACTION_DELETE:
-            deleteExtendedInfo6(lease->addr_);
-            break;
+    // Run installed callbacks.
+    if (hasCallbacks()) {
+        trackUpdateLease(lease);
+    }
+}
 
-        case Lease6::ACTION_UPDATE:
-            deleteExtendedInfo6(lease->addr_);
-            static_cast<void>(addExtendedInfo6(lease));
-            break;
+void
+MySqlLeaseMgr::updateExtendedInfo6(const Lease6Ptr& lease,
+                                   Lease6::ExtendedInfoAction action) {
+    switch (action) {
+    case Lease6::ACTION_IGNORE:
+        break;
+
+    case Lease6::ACTION_DELETE:
+        deleteExtendedInfo6(lease->addr_);
+        break;
+
+    case Lease6::ACTION_UPDATE:
+        deleteExtendedInfo6(lease->addr_);
+        static_cast<void>(addExtendedInfo6(lease));
+        break;
+    }
+}
+
+Lease4Collection
+MySqlLeaseMgr::updateLeases4(const Lease4Collection& leases) {
+    // In multi-threaded mode the callbacks require to lock each lease:
+    // update them one by one.
+    if (leases.empty() ||
+        (hasCallbacks() && MultiThreadingMgr::instance().getMode())) {
+        return (LeaseMgr::updateLeases4(leases));
+    }
+
+    LOG_DEBUG(mysql_lb_logger, MYSQL_LB_DBG_TRACE_DETAIL, MYSQL_LB_UPDATE_LEASES4)
+        .arg(leases.size());
+
+    // Get a context
+    MySqlLeaseContextAlloc get_context(*this);
+    MySqlLeaseContextPtr ctx = get_context.ctx_;
+
+    // Update all leases in one transaction so they are committed at once.
+    Lease4Collection updated;
+    Lease4Collection failed;
+    MySqlTransaction transaction(ctx->conn_);
+    for (auto const& lease : leases) {
+        try {
+            updateLeaseInternal(ctx, lease);
+            updated.push_back(lease);
+        } catch (const NoSuchLease&) {
+            failed.push_back(lease);
         }
     }
+    transaction.commit();
+
+    for (auto const& lease : updated) {
+        lease->updateCurrentExpirationTime();
+    }
 
     // Run installed callbacks.
     if (hasCallbacks()) {
-        trackUpdateLease(lease);
+        for (auto const& lease : updated) {
+            trackUpdateLease(lease);
+        }
+    }
+
+    return (failed);
+}
+
+Lease6Collection
+MySqlLeaseMgr::updateLeases6(const Lease6Collection& leases) {
+    // In multi-threaded mode the callbacks require to lock each lease:
+    // update them one by one.
+    if (leases.empty() ||
+        (hasCallbacks() && MultiThreadingMgr::instance().getMode())) {
+        return (LeaseMgr::updateLeases6(leases));
+    }
+
+    LOG_DEBUG(mysql_lb_logger, MYSQL_LB_DBG_TRACE_DETAIL, MYSQL_LB_UPDATE_LEASES6)
+        .arg(leases.size());
+
+    // Get a context
+    MySqlLeaseContextAlloc get_context(*this);
+    MySqlLeaseContextPtr ctx = get_context.ctx_;
+
+    // Update all leases in one transaction so they are committed at once.
+    std::vector<std::pair<Lease6Ptr, Lease6::ExtendedInfoAction>> updated;
+    Lease6Collection failed;
+    MySqlTransaction transaction(ctx->conn_);
+    for (auto const& lease : leases) {
+        // Get the recorded action and reset it.
+        Lease6::ExtendedInfoAction recorded_action = lease->extended_info_action_;
+        lease->extended_info_action_ = Lease6::ACTION_IGNORE;
+        try {
+            updateLeaseInternal(ctx, lease);
+            updated.push_back(std::make_pair(lease, recorded_action));
+        } catch (const NoSuchLease&) {
+            failed.push_back(lease);
+        }
+    }
+    transaction.commit();
+
+    for (auto const& item : updated) {
+        item.first->updateCurrentExpirationTime();
     }
+
+    // Update extended info tables.
+    if (getExtendedInfoTablesEnabled()) {
+        for (auto const& item : updated) {
+            updateExtendedInfo6(item.first, item.second);
+        }
+    }
+
+    // Run installed callbacks.
+    if (hasCallbacks()) {
+        for (auto const& item : updated) {
+            trackUpdateLease(item.first);
+        }
+    }
+
+    return (failed);
 }
 
 // Delete lease methods.  Similar to other groups of methods, these comprise
@@ -3842,11 +4139,9 @@ MySqlLeaseMgr::deleteLeaseCommon(MySqlLeaseContextPtr& ctx,
 }
 
 bool
-MySqlLeaseMgr::deleteLease(const Lease4Ptr& lease) {
+MySqlLeaseMgr::deleteLeaseInternal(MySqlLeaseContextPtr& ctx,
+                                   const Lease4Ptr& lease) {
     const IOAddress& addr = lease->addr_;
-    LOG_DEBUG(mysql_lb_logger, MYSQL_LB_DBG_TRACE_DETAIL,
-              MYSQL_LB_DELETE_ADDR4)
-        .arg(addr.toText());
 
     // Set up the WHERE clause value
     MYSQL_BIND inbind[2];
@@ -3871,10 +4166,6 @@ MySqlLeaseMgr::deleteLease(const Lease4Ptr& lease) {
     inbind[1].buffer = reinterpret_cast<char*>(&expire);
     inbind[1].buffer_length = sizeof(expire);
 
-    // Get a context
-    MySqlLeaseTrackingContextAlloc get_context(*this, lease);
-    MySqlLeaseContextPtr ctx = get_context.ctx_;
-
     // Drop to common delete code
     int32_t affected_rows = 0;
     if (!useSharedFlqStatement(lease)) {
@@ -3885,9 +4176,6 @@ MySqlLeaseMgr::deleteLease(const Lease4Ptr& lease) {
 
     // Check success case first as it is the most likely outcome.
     if (affected_rows == 1) {
-        if (hasCallbacks()) {
-            trackDeleteLease(lease);
-        }
         return (true);
     }
 
@@ -3903,13 +4191,9 @@ MySqlLeaseMgr::deleteLease(const Lease4Ptr& lease) {
 }
 
 bool
-MySqlLeaseMgr::deleteLease(const Lease6Ptr& lease) {
+MySqlLeaseMgr::deleteLeaseInternal(MySqlLeaseContextPtr& ctx,
+                                   const Lease6Ptr& lease) {
     const IOAddress& addr = lease->addr_;
-    LOG_DEBUG(mysql_lb_logger, MYSQL_LB_DBG_TRACE_DETAIL,
-              MYSQL_LB_DELETE_ADDR6)
-        .arg(addr.toText());
-
-    lease->extended_info_action_ = Lease6::ACTION_IGNORE;
 
     // Set up the WHERE clause value
     MYSQL_BIND inbind[2];
@@ -3940,10 +4224,6 @@ MySqlLeaseMgr::deleteLease(const Lease6Ptr& lease) {
     inbind[1].buffer = reinterpret_cast<char*>(&expire);
     inbind[1].buffer_length = sizeof(expire);
 
-    // Get a context
-    MySqlLeaseTrackingContextAlloc get_context(*this, lease);
-    MySqlLeaseContextPtr ctx = get_context.ctx_;
-
     // Drop to common delete code
     int32_t affected_rows = 0;
     if (!useSharedFlqStatement(lease)) {
@@ -3956,11 +4236,6 @@ MySqlLeaseMgr::deleteLease(const Lease6Ptr& lease) {
     if (affected_rows == 1) {
         // Delete references from extended info tables.
         // Performed by the delete cascade.
-
-        // Run installed callbacks.
-        if (hasCallbacks()) {
-            trackDeleteLease(lease);
-        }
         return (true);
     }
 
@@ -3975,6 +4250,129 @@ MySqlLeaseMgr::deleteLease(const Lease6Ptr& lease) {
               "that had the address " << lease->addr_.toText());
 }
 
+bool
+MySqlLeaseMgr::deleteLease(const Lease4Ptr& lease) {
+    LOG_DEBUG(mysql_lb_logger, MYSQL_LB_DBG_TRACE_DETAIL,
+              MYSQL_LB_DELETE_ADDR4)
+        .arg(lease->addr_.toText());
+
+    // Get a context
+    MySqlLeaseTrackingContextAlloc get_context(*this, lease);
+    MySqlLeaseContextPtr ctx = get_context.ctx_;
+
+    if (!deleteLeaseInternal(ctx, lease)) {
+        return (false);
+    }
+
+    // Run installed callbacks.
+    if (hasCallbacks()) {
+        trackDeleteLease(lease);
+    }
+    return (true);
+}
+
+bool
+MySqlLeaseMgr::deleteLease(const Lease6Ptr& lease) {
+    LOG_DEBUG(mysql_lb_logger, MYSQL_LB_DBG_TRACE_DETAIL,
+              MYSQL_LB_DELETE_ADDR6)
+        .arg(lease->addr_.toText());
+
+    lease->extended_info_action_ = Lease6::ACTION_IGNORE;
+
+    // Get a context
+    MySqlLeaseTrackingContextAlloc get_context(*this, lease);
+    MySqlLeaseContextPtr ctx = get_context.ctx_;
+
+    if (!deleteLeaseInternal(ctx, lease)) {
+        return (false);
+    }
+
+    // Run installed callbacks.
+    if (hasCallbacks()) {
+        trackDeleteLease(lease);
+    }
+    return (true);
+}
+
+Lease4Collection
+MySqlLeaseMgr::deleteLeases(const Lease4Collection& leases) {
+    // In multi-threaded mode the callbacks require to lock each lease:
+    // delete them one by one.
+    if (leases.empty() ||
+        (hasCallbacks() && MultiThreadingMgr::instance().getMode())) {
+        return (LeaseMgr::deleteLeases(leases));
+    }
+
+    LOG_DEBUG(mysql_lb_logger, MYSQL_LB_DBG_TRACE_DETAIL, MYSQL_LB_DELETE_LEASES4)
+        .arg(leases.size());
+
+    // Get a context
+    MySqlLeaseContextAlloc get_context(*this);
+    MySqlLeaseContextPtr ctx = get_context.ctx_;
+
+    // Delete all leases in one transaction so they are committed at once.
+    Lease4Collection deleted;
+    Lease4Collection failed;
+    MySqlTransaction transaction(ctx->conn_);
+    for (auto const& lease : leases) {
+        if (deleteLeaseInternal(ctx, lease)) {
+            deleted.push_back(lease);
+        } else {
+            failed.push_back(lease);
+        }
+    }
+    transaction.commit();
+
+    // Run installed callbacks.
+    if (hasCallbacks()) {
+        for (auto const& lease : deleted) {
+            trackDeleteLease(lease);
+        }
+    }
+
+    return (failed);
+}
+
+Lease6Collection
+MySqlLeaseMgr::deleteLeases(const Lease6Collection& leases) {
+    // In multi-threaded mode the callbacks require to lock each lease:
+    // delete them one by one.
+    if (leases.empty() ||
+        (hasCallbacks() && MultiThreadingMgr::instance().getMode())) {
+        return (LeaseMgr::deleteLeases(leases));
+    }
+
+    LOG_DEBUG(mysql_lb_logger, MYSQL_LB_DBG_TRACE_DETAIL, MYSQL_LB_DELETE_LEASES6)
+        .arg(leases.size());
+
+    // Get a context
+    MySqlLeaseContextAlloc get_context(*this);
+    MySqlLeaseContextPtr ctx = get_context.ctx_;
+
+    // Delete all leases in one transaction so they are committed at once.
+    Lease6Collection deleted;
+    Lease6Collection failed;
+    MySqlTransaction transaction(ctx->conn_);
+    for (auto const& lease : leases) {
+        lease->extended_info_action_ = Lease6::ACTION_IGNORE;
+        if (deleteLeaseInternal(ctx, lease)) {
+            deleted.push_back(lease);
+        } else {
+            failed.push_back(lease);
+        }
+    }
+    transaction.commit();
+
+    // Run installed callbacks.
+    if (hasCallbacks()) {
+        for (auto const& lease : deleted) {
+            trackDeleteLease(lease);
+        }
+    }
+
+    return (failed);
+}
+
 uint64_t
 MySqlLeaseMgr::deleteExpiredReclaimedLeases4(const uint32_t secs) {
     LOG_DEBUG(mysql_lb_logger, MYSQL_LB_DBG_TRACE_DETAIL, MYSQL_LB_DELETE_EXPIRED_RECLAIMED4)
@@ -15,9 +15,12 @@
 #include <util/multi_threading_mgr.h>
 
 #include <boost/array.hpp>
+#include <boost/lexical_cast.hpp>
 #include <mysqld_error.h>
 
+#include <functional>
 #include <iomanip>
+#include <limits>
 #include <limits.h>
 #include <sstream>
 #include <string>
@@ -38,6 +41,10 @@ tagged_statements = { {
     }
 };
 
+/// @brief Size above which queued records are split into several
+/// INSERT statements so they stay below max_allowed_packet.
+const size_t MAX_INSERT_SIZE = 1024 * 1024;
+
 };
 
 namespace isc {
@@ -268,7 +275,25 @@ MySqlStore::MySqlStoreContextAlloc::~MySqlStoreContextAlloc() {
 // MySqlStore
 
 MySqlStore::MySqlStore(const DatabaseConnection::ParameterMap& parameters)
-    : LegalLogMgr(parameters), timer_name_(""), unusable_(false) {
+    : LegalLogMgr(parameters), timer_name_(""), unusable_(false),
+      queue_size_(0), running_(false) {
+
+    if (parameters.count("queue-size")) {
+        int64_t queue_size(0);
+        try {
+            queue_size = boost::lexical_cast<int64_t>(parameters.at("queue-size"));
+        } catch (...) {
+            isc_throw(BadValue, "bad value: " << parameters.at("queue-size")
+                      << " for queue-size parameter");
+        }
+        if ((queue_size < 0) ||
+            (queue_size > numeric_limits<uint32_t>::max())) {
+            isc_throw(OutOfRange, "queue-size value: " << queue_size
+                      << " is out of range, expected value: 0.."
+                      << numeric_limits<uint32_t>::max());
+        }
+        queue_size_ = static_cast<size_t>(queue_size);
+    }
 
     // Create unique timer name per instance.
     timer_name_ = "MySqlLegalStore[";
@@ -306,6 +331,11 @@ void MySqlStore::open() {
     // Create an initial context.
     pool_.reset(new MySqlStoreContextPool());
     pool_->pool_.push_back(createContext());
+
+    if (queue_size_ && !writer_ &&
+        !MultiThreadingMgr::instance().isTestMode()) {
+        startWriter();
+    }
 }
 
 // Create context.
@@ -348,10 +378,12 @@ MySqlStore::createContext() const {
 MySqlStore::~MySqlStore() {
     // There is no need to close the database in this destructor: it is
     // closed in the destructor of the mysql_ member variable.
+    stopWriter();
 }
 
 void
 MySqlStore::close() {
+    stopWriter();
 }
 
 void
@@ -363,6 +395,21 @@ MySqlStore::writeln(const string& text, const std::string& addr) {
     LOG_DEBUG(mysql_fb_logger, DB_DBG_TRACE_DETAIL,
               LEGAL_LOG_MYSQL_INSERT_LOG).arg(text);
 
+    if (writer_) {
+        Record record = { now().tv_sec, addr, text };
+
+        unique_lock<mutex> lock(queue_mutex_);
+        space_cv_.wait(lock, [this]() {
+            return (!running_ || (queue_.size() < queue_size_));
+        });
+        if (running_) {
+            queue_.push_back(std::move(record));
+            queue_cv_.notify_one();
+            return;
+        }
+        // The writer is being stopped: insert the record directly.
+    }
+
     LegalLogDbLogger pushed(mysql_legal_log_db_logger);
 
     // Get a context
@@ -386,6 +433,114 @@ MySqlStore::writeln(const string& text, const std::string& addr) {
     // Insert succeeded
 }
 
+void
+MySqlStore::insertRecords(MySqlStoreContextPtr& ctx,
+                          const vector<Record>& records) {
+    LOG_DEBUG(mysql_fb_logger, DB_DBG_TRACE_DETAIL,
+              LEGAL_LOG_MYSQL_INSERT_LOGS).arg(records.size());
+
+    LegalLogDbLogger pushed(mysql_legal_log_db_logger);
+
+    MYSQL* mysql = ctx->conn_.mysql_;
+    auto quote = [mysql](string& sql, const string& value) {
+        vector<char> escaped(2 * value.size() + 1);
+        unsigned long length = mysql_real_escape_string(mysql, &escaped[0],
+                                                        value.c_str(),
+                                                        value.size());
+        sql += "'";
+        sql.append(&escaped[0], length);
+        sql += "'";
+    };
+
+    const string prefix("INSERT INTO logs(timestamp, address, log) VALUES ");
+    string sql;
+    for (auto const& record : records) {
+        sql += (sql.empty() ? prefix : string(", "));
+        // FROM_UNIXTIME uses the session time zone, as does the
+        // CURRENT_TIMESTAMP default of the column.
+        sql += "(FROM_UNIXTIME(";
+        sql += boost::lexical_cast<string>(record.timestamp_);
+        sql += "), ";
+        if (record.addr_.empty()) {
+            sql += "NULL";
+        } else {
+            quote(sql, record.addr_);
+        }
+        sql += ", ";
+        quote(sql, record.text_);
+        sql += ")";
+
+        if (sql.size() >= MAX_INSERT_SIZE) {
+            int status = MysqlQuery(mysql, sql.c_str());
+            checkError(ctx, status, INSERT_LOG, "unable to insert queued records");
+            sql.clear();
+        }
+    }
+    if (!sql.empty()) {
+        int status = MysqlQuery(mysql, sql.c_str());
+        checkError(ctx, status, INSERT_LOG, "unable to insert queued records");
+    }
+}
+
+void
+MySqlStore::startWriter() {
+    writer_ctx_ = createContext();
+    {
+        lock_guard<mutex> lock(queue_mutex_);
+        running_ = true;
+    }
+    queue_.reserve(queue_size_);
+    writer_.reset(new thread(std::bind(&MySqlStore::run, this)));
+}
+
+void
+MySqlStore::stopWriter() {
+    if (!writer_) {
+        return;
+    }
+    {
+        lock_guard<mutex> lock(queue_mutex_);
+        running_ = false;
+    }
+    queue_cv_.notify_all();
+    space_cv_.notify_all();
+    writer_->join();
+    writer_.reset();
+    writer_ctx_.reset();
+}
+
+void
+MySqlStore::run() {
+    vector<Record> records;
+    records.reserve(queue_size_);
+    for (;;) {
+        {
+            unique_lock<mutex> lock(queue_mutex_);
+            queue_cv_.wait(lock, [this]() {
+                return (!running_ || !queue_.empty());
+            });
+            if (queue_.empty()) {
+                // Stopped and all records inserted.
+                return;
+            }
+            records.swap(queue_);
+        }
+        space_cv_.notify_all();
+
+        try {
+            insertRecords(writer_ctx_, records);
+        } catch (const exception& ex) {
+            LOG_ERROR(mysql_fb_logger, LEGAL_LOG_MYSQL_WRITE_ERROR)
+                .arg(records.size()).arg(ex.what());
+        }
+        if (writer_ctx_->conn_.isUnusable()) {
+            lock_guard<mutex> lock(pool_->mutex_);
+            unusable_ = true;
+        }
+        records.clear();
+    }
+}
+
 pair<uint32_t, uint32_t>
 MySqlStore::getVersion(const std::string& timer_name) const {
     LOG_DEBUG(mysql_fb_logger, DB_DBG_TRACE_DETAIL,
@@ -97,12 +97,17 @@ public:
     }
 
     /// @brief Open the store
-    void openStore() {
+    ///
+    /// @param queue_size The queue size (0 disables the background writer).
+    void openStore(size_t queue_size = 0) {
         // Construct the store
         DatabaseConnection::ParameterMap params;
         params["name"] = "keatest";
         params["user"] = "keatest";
         params["password"] = "keatest";
+        if (queue_size) {
+            params["queue-size"] = boost::lexical_cast<string>(queue_size);
+        }
         ASSERT_NO_THROW_LOG(store_.reset(new MySqlStore(params)));
 
         // Open the database
@@ -111,7 +116,7 @@ public:
 
     /// @brief Close the store
     void closeStore() {
-        // Close does nothing
+        // Close stops the background writer, if any
         EXPECT_NO_THROW_LOG(store_->close());
 
         // Destructor close the database
@@ -410,6 +415,32 @@ TEST_F(MySqlTest, entries) {
     }
 }
 
+/// @brief Check log entries inserted by the background writer
+TEST_F(MySqlTest, queuedEntries) {
+    // Open the store with a queue smaller than the number of entries
+    // so the writer is waited for
+    openStore(2);
+    EXPECT_EQ(2U, store_->getQueueSize());
+
+    // Fill the store
+    fillStore();
+
+    // Close the store to insert queued entries
+    closeStore();
+
+    setQuery("SELECT log FROM logs");
+    setCommand("mysql -N -B --host=localhost --user=keatest "
+               "--password=keatest --database=keatest --execute=");
+    EXPECT_NO_THROW_LOG(execute());
+    EXPECT_EQ(0, getResult());
+    vector<string> output;
+    EXPECT_TRUE(getOutput(output));
+    ASSERT_EQ(samples_.size(), output.size());
+    for (size_t i = 0; i < output.size(); ++i) {
+        EXPECT_EQ(samples_[i], output[i]);
+    }
+}
+
 /// @brief Check timestamps
 TEST_F(MySqlTest, timestamps) {
     // Open the store
@@ -805,6 +805,19 @@ TEST_F(MySqlHostDataSourceTest, get4ByCircuitIdMultiThreading) {
     testGet4ByIdentifier(Host::IDENT_CIRCUIT_ID);
 }
 
+/// @brief Test verifies if host reservations can be retrieved by several
+/// identifiers at once.
+TEST_F(MySqlHostDataSourceTest, getByIdentifiers) {
+    testGetByIdentifiers();
+}
+
+/// @brief Test verifies if host reservations can be retrieved by several
+/// identifiers at once.
+TEST_F(MySqlHostDataSourceTest, getByIdentifiersMultiThreading) {
+    MultiThreadingTest mt(true);
+    testGetByIdentifiers();
+}
+
 /// @brief Test verifies if a host reservation can be added and later retrieved by
 /// client-id.
 TEST_F(MySqlHostDataSourceTest, get4ByClientId) {
@@ -365,6 +365,17 @@ TEST_F(MySqlLeaseMgrTest, basicLease4MultiThreading) {
     testBasicLease4();
 }
 
+/// @brief Checks the batch operations on IPv4 leases.
+TEST_F(MySqlLeaseMgrTest, batchLease4) {
+    testBatchLease4();
+}
+
+/// @brief Checks the batch operations on IPv4 leases.
+TEST_F(MySqlLeaseMgrTest, batchLease4MultiThreading) {
+    MultiThreadingTest mt(true);
+    testBatchLease4();
+}
+
 /// @brief Check that Lease4 code safely handles invalid dates.
 TEST_F(MySqlLeaseMgrTest, maxDate4) {
     testMaxDate4();
@@ -742,6 +753,17 @@ TEST_F(MySqlLeaseMgrTest, basicLease6MultiThreading) {
     testBasicLease6();
 }
 
+/// @brief Checks the batch operations on IPv6 leases.
+TEST_F(MySqlLeaseMgrTest, batchLease6) {
+    testBatchLease6();
+}
+
+/// @brief Checks the batch operations on IPv6 leases.
+TEST_F(MySqlLeaseMgrTest, batchLease6MultiThreading) {
+    MultiThreadingTest mt(true);
+    testBatchLease6();
+}
+
 /// @brief Check that Lease6 code safely handles invalid dates.
 TEST_F(MySqlLeaseMgrTest, maxDate6) {
     testMaxDate6();
@@ -1226,6 +1248,53 @@ TEST_F(MySqlLeaseMgrTest, leaseStatsQuery6MultiThreading) {
     testLeaseStatsQuery6();
 }
 
+/// @brief Checks lease stats and limits with sharded statistics counters.
+TEST_F(MySqlLeaseMgrTest, leaseStatsQuery4Sharded) {
+    // Enable the sharding of the lease statistics counters. The lease
+    // manager connections pick their shard at their first lease update.
+    DatabaseConnection::ParameterMap params =
+        DatabaseConnection::parse(validMySQLConnectionString());
+    MySqlConnection conn(params);
+    conn.openDatabase();
+    ASSERT_EQ(0, mysql_query(conn.mysql_,
+                             "UPDATE lease_stat_shards SET shards = 8"))
+        << mysql_error(conn.mysql_);
+
+    // Add leases through the lease manager.
+    makeLease4("192.0.1.1", 1);
+    makeLease4("192.0.1.2", 1);
+    makeLease4("192.0.1.3", 1, Lease::STATE_DECLINED);
+
+    // Delete 192.0.1.1 through another connection, so likely decrementing
+    // the counter of another shard.
+    ASSERT_EQ(0, mysql_query(conn.mysql_,
+                             "DELETE FROM lease4 WHERE address = 3221225729"))
+        << mysql_error(conn.mysql_);
+
+    RowSet expected_rows;
+    expected_rows.insert(LeaseStatsRow(1, Lease::STATE_DEFAULT, 1));
+    expected_rows.insert(LeaseStatsRow(1, Lease::STATE_DECLINED, 1));
+
+    LeaseStatsQueryPtr query;
+    ASSERT_NO_THROW(query = lmptr_->startLeaseStatsQuery4());
+    checkQueryAgainstRowSet(query, expected_rows);
+    ASSERT_NO_THROW(query = lmptr_->startSubnetLeaseStatsQuery4(1));
+    checkQueryAgainstRowSet(query, expected_rows);
+    ASSERT_NO_THROW(query = lmptr_->startSubnetRangeLeaseStatsQuery4(1, 2));
+    checkQueryAgainstRowSet(query, expected_rows);
+
+    // Limits use the sum of the shards too.
+    data::ConstElementPtr ctx = data::Element::fromJSON(
+        "{ \"ISC\": { \"limits\": { \"subnet\": { \"id\": 1, \"address-limit\": 2 } } } }");
+    std::string text;
+    ASSERT_NO_THROW_LOG(text = lmptr_->checkLimits4(ctx));
+    EXPECT_TRUE(text.empty()) << text;
+    ctx = data::Element::fromJSON(
+        "{ \"ISC\": { \"limits\": { \"subnet\": { \"id\": 1, \"address-limit\": 1 } } } }");
+    ASSERT_NO_THROW_LOG(text = lmptr_->checkLimits4(ctx));
+    EXPECT_EQ("address limit 1 for subnet ID 1, current lease count 1", text);
+}
+
 /// @brief Tests v4 lease stats to be attributed to the wrong subnet.
 TEST_F(MySqlLeaseMgrTest, leaseStatsQueryAttribution4) {
     testLeaseStatsQueryAttribution4();
@@ -1570,6 +1570,13 @@ public:
                           PsqlBindArrayPtr& bind,
                           const bool return_last_id = false);
 
+    /// @brief Checks the result of a successful insert.
+    ///
+    /// @param r Result of the insert.
+    ///
+    /// @throw isc::db::DuplicateEntry when no row was inserted.
+    static void checkAddResult(const PgSqlResult& r);
+
     /// @brief Executes statements that delete records.
     ///
     /// @param ctx Context
@@ -1583,15 +1590,23 @@ public:
 
     /// @brief Inserts IPv6 Reservation into ipv6_reservation table.
     ///
+    /// The insert is queued in the pipeline: the caller checks the
+    /// result with @c checkAddResult.
+    ///
     /// @param ctx Context
     /// @param resv IPv6 Reservation to be added
     /// @param id ID of a host owning this reservation
+    /// @param pipeline Pipeline of the host insert.
     void addResv(PgSqlHostContextPtr& ctx,
                  const IPv6Resrv& resv,
-                 const HostID& id);
+                 const HostID& id,
+                 PgSqlPipeline& pipeline);
 
     /// @brief Inserts a single DHCP option into the database.
     ///
+    /// The insert is queued in the pipeline: the caller checks the
+    /// result with @c checkAddResult.
+    ///
     /// @param ctx Context
     /// @param stindex Index of a statement being executed.
     /// @param opt_desc Option descriptor holding information about an option
@@ -1599,12 +1614,14 @@ public:
     /// @param opt_space Option space name.
     /// @param subnet_id Subnet identifier.
     /// @param host_id Host identifier.
+    /// @param pipeline Pipeline of the host insert.
     void addOption(PgSqlHostContextPtr& ctx,
                    const PgSqlHostDataSourceImpl::StatementIndex& stindex,
                    const OptionDescriptor& opt_desc,
                    const std::string& opt_space,
                    const Optional<SubnetID>& subnet_id,
-                   const HostID& host_id);
+                   const HostID& host_id,
+                   PgSqlPipeline& pipeline);
 
     /// @brief Inserts multiple options into the database.
     ///
@@ -1614,10 +1631,12 @@ public:
     /// inserted into the database.
     /// @param host_id Host identifier retrieved using getColumnValue
     ///                in addStatement method
+    /// @param pipeline Pipeline of the host insert.
     void addOptions(PgSqlHostContextPtr& ctx,
                     const StatementIndex& stindex,
                     const ConstCfgOptionPtr& options_cfg,
-                    const uint64_t host_id);
+                    const uint64_t host_id,
+                    PgSqlPipeline& pipeline);
 
     /// @brief Creates collection of @ref Host objects with associated
     /// information such as IPv6 reservations and/or DHCP options.
@@ -1669,6 +1688,27 @@ public:
                          StatementIndex stindex,
                          boost::shared_ptr<PgSqlHostExchange> exchange) const;
 
+    /// @brief Retrieves hosts by subnet and several client identifiers.
+    ///
+    /// This method is used by both PgSqlHostDataSource::getByIdentifiers4
+    /// and PgSqlHostDataSource::getByIdentifiers6 methods. The lookups
+    /// are sent at once in pipeline mode.
+    ///
+    /// @param ctx Context
+    /// @param subnet_id Subnet identifier.
+    /// @param identifiers Identifiers to look up.
+    /// @param stindex Statement index.
+    /// @param exchange Pointer to the exchange object used for the
+    /// particular query.
+    ///
+    /// @return Pointers to const instances of Host in the order of the
+    /// identifiers, null pointers when no host was found.
+    ConstHostCollection getHosts(PgSqlHostContextPtr& ctx,
+                                 const SubnetID& subnet_id,
+                                 const HostIdentifierList& identifiers,
+                                 StatementIndex stindex,
+                                 boost::shared_ptr<PgSqlHostExchange> exchange) const;
+
     /// @brief Throws exception if database is read only.
     ///
     /// This method should be called by the methods which write to the
@@ -2503,6 +2543,17 @@ PgSqlHostDataSourceImpl::addStatement(PgSqlHostContextPtr& ctx,
         ctx->conn_.checkStatementError(r, tagged_statements[stindex]);
     }
 
+    checkAddResult(r);
+
+    if (return_last_id) {
+        PgSqlExchange::getColumnValue(r, 0, 0, last_id);
+    }
+
+    return (last_id);
+}
+
+void
+PgSqlHostDataSourceImpl::checkAddResult(const PgSqlResult& r) {
     // Get the number of affected rows.
     char* rows_affected = PQcmdTuples(r);
     if (!rows_affected) {
@@ -2518,12 +2569,6 @@ PgSqlHostDataSourceImpl::addStatement(PgSqlHostContextPtr& ctx,
     if (rows_affected[0] == '0') {
         isc_throw(DuplicateEntry, "Database duplicate entry error");
     }
-
-    if (return_last_id) {
-        PgSqlExchange::getColumnValue(r, 0, 0, last_id);
-    }
-
-    return (last_id);
 }
 
 bool
@@ -2557,13 +2602,15 @@ PgSqlHostDataSourceImpl::delStatement(PgSqlHostContextPtr& ctx,
 void
 PgSqlHostDataSourceImpl::addResv(PgSqlHostContextPtr& ctx,
                                  const IPv6Resrv& resv,
-                                 const HostID& id) {
+                                 const HostID& id,
+                                 PgSqlPipeline& pipeline) {
     PsqlBindArrayPtr bind_array = ctx->host_ipv6_reservation_exchange_->
         createBindForSend(resv, id, ip_reservations_unique_);
 
-    addStatement(ctx,
-                 ip_reservations_unique_ ? INSERT_V6_RESRV_UNIQUE : INSERT_V6_RESRV_NON_UNIQUE,
-                 bind_array);
+    pipeline.add(tagged_statements[ip_reservations_unique_ ?
+                                   INSERT_V6_RESRV_UNIQUE :
+                                   INSERT_V6_RESRV_NON_UNIQUE],
+                 *bind_array);
 }
 
 void
@@ -2572,17 +2619,19 @@ PgSqlHostDataSourceImpl::addOption(PgSqlHostContextPtr& ctx,
                                    const OptionDescriptor& opt_desc,
                                    const std::string& opt_space,
                                    const Optional<SubnetID>&,
-                                   const HostID& id) {
+                                   const HostID& id,
+                                   PgSqlPipeline& pipeline) {
     PsqlBindArrayPtr bind_array = ctx->host_option_exchange_->createBindForSend(opt_desc, opt_space, id);
 
-    addStatement(ctx, stindex, bind_array);
+    pipeline.add(tagged_statements[stindex], *bind_array);
 }
 
 void
 PgSqlHostDataSourceImpl::addOptions(PgSqlHostContextPtr& ctx,
                                     const StatementIndex& stindex,
                                     const ConstCfgOptionPtr& options_cfg,
-                                    const uint64_t host_id) {
+                                    const uint64_t host_id,
+                                    PgSqlPipeline& pipeline) {
     // Get option space names and vendor space names and combine them within a
     // single list.
     std::list<std::string> option_spaces = options_cfg->getOptionSpaceNames();
@@ -2596,7 +2645,8 @@ PgSqlHostDataSourceImpl::addOptions(PgSqlHostContextPtr& ctx,
         OptionContainerPtr options = options_cfg->getAllCombined(space);
         if (options && !options->empty()) {
             for (auto const& opt : *options) {
-                addOption(ctx, stindex, opt, space, Optional<SubnetID>(), host_id);
+                addOption(ctx, stindex, opt, space, Optional<SubnetID>(), host_id,
+                          pipeline);
             }
         }
     }
@@ -2664,6 +2714,55 @@ PgSqlHostDataSourceImpl::getHost(PgSqlHostContextPtr& ctx,
     return (result);
 }
 
+ConstHostCollection
+PgSqlHostDataSourceImpl::getHosts(PgSqlHostContextPtr& ctx,
+                                  const SubnetID& subnet_id,
+                                  const HostIdentifierList& identifiers,
+                                  StatementIndex stindex,
+                                  boost::shared_ptr<PgSqlHostExchange> exchange) const {
+    PgSqlPipeline pipeline(ctx->conn_);
+    for (auto const& id_pair : identifiers) {
+        // Set up the WHERE clause value
+        PsqlBindArray bind_array;
+
+        // Add the subnet id.
+        bind_array.add(subnet_id);
+
+        // Add the Identifier type.
+        bind_array.add(static_cast<uint8_t>(id_pair.first));
+
+        // Add the identifier value.
+        bind_array.add(id_pair.second);
+
+        pipeline.add(tagged_statements[stindex], bind_array);
+    }
+
+    ConstHostCollection hosts;
+    for (auto const& r : pipeline.execute()) {
+        exchange->clear();
+        ConstHostCollection collection;
+        int rows = r->getRows();
+        for (int row = 0; row < rows; ++row) {
+            exchange->processRowData(collection, *r, row);
+
+            if (collection.size() > 1) {
+                isc_throw(MultipleRecords, "multiple records were found in the "
+                          "database where only one was expected for query "
+                          << tagged_statements[stindex].name);
+            }
+        }
+
+        // Add the single record if present, else a null host.
+        ConstHostPtr result;
+        if (!collection.empty()) {
+            result = *collection.begin();
+        }
+        hosts.push_back(result);
+    }
+
+    return (hosts);
+}
+
 std::pair<uint32_t, uint32_t>
 PgSqlHostDataSourceImpl::getVersion(const std::string& timer_name) const {
     LOG_DEBUG(pgsql_hb_logger, PGSQL_HB_DBG_TRACE_DETAIL, PGSQL_HB_DB_GET_VERSION);
@@ -2727,28 +2826,37 @@ PgSqlHostDataSource::add(const HostPtr& host) {
                                            PgSqlHostDataSourceImpl::INSERT_HOST_NON_UNIQUE_IP,
                                            bind_array, true);
 
+    // The options and reservations are sent at once and their results
+    // are read in one round trip.
+    PgSqlPipeline pipeline(ctx->conn_);
+
     // Insert DHCPv4 options.
     ConstCfgOptionPtr cfg_option4 = host->getCfgOption4();
     if (cfg_option4) {
         impl_->addOptions(ctx, PgSqlHostDataSourceImpl::INSERT_V4_HOST_OPTION,
-                          cfg_option4, host_id);
+                          cfg_option4, host_id, pipeline);
     }
 
     // Insert DHCPv6 options.
     ConstCfgOptionPtr cfg_option6 = host->getCfgOption6();
     if (cfg_option6) {
         impl_->addOptions(ctx, PgSqlHostDataSourceImpl::INSERT_V6_HOST_OPTION,
-                          cfg_option6, host_id);
+                          cfg_option6, host_id, pipeline);
     }
 
     // Insert IPv6 reservations.
     IPv6ResrvRange v6resv = host->getIPv6Reservations();
     if (std::distance(v6resv.first, v6resv.second) > 0) {
         BOOST_FOREACH(auto const& resv, v6resv) {
-            impl_->addResv(ctx, resv.second, host_id);
+            impl_->addResv(ctx, resv.second, host_id, pipeline);
         }
     }
 
+    // Check the results.
+    for (auto const& r : pipeline.execute()) {
+        PgSqlHostDataSourceImpl::checkAddResult(*r);
+    }
+
     // Everything went fine, so explicitly commit the transaction.
     transaction.commit();
 }
@@ -3106,6 +3214,18 @@ PgSqlHostDataSource::get4(const SubnetID& subnet_id,
                            ctx->host_ipv4_exchange_));
 }
 
+ConstHostCollection
+PgSqlHostDataSource::getByIdentifiers4(const SubnetID& subnet_id,
+                                       const HostIdentifierList& identifiers) const {
+    // Get a context
+    PgSqlHostContextAlloc get_context(*impl_);
+    PgSqlHostContextPtr ctx = get_context.ctx_;
+
+    return (impl_->getHosts(ctx, subnet_id, identifiers,
+                            PgSqlHostDataSourceImpl::GET_HOST_SUBID4_DHCPID,
+                            ctx->host_ipv4_exchange_));
+}
+
 ConstHostPtr
 PgSqlHostDataSource::get4(const SubnetID& subnet_id,
                           const asiolink::IOAddress& address) const {
@@ -3181,6 +3301,18 @@ PgSqlHostDataSource::get6(const SubnetID& subnet_id,
                            ctx->host_ipv6_exchange_));
 }
 
+ConstHostCollection
+PgSqlHostDataSource::getByIdentifiers6(const SubnetID& subnet_id,
+                                       const HostIdentifierList& identifiers) const {
+    // Get a context
+    PgSqlHostContextAlloc get_context(*impl_);
+    PgSqlHostContextPtr ctx = get_context.ctx_;
+
+    return (impl_->getHosts(ctx, subnet_id, identifiers,
+                            PgSqlHostDataSourceImpl::GET_HOST_SUBID6_DHCPID,
+                            ctx->host_ipv6_exchange_));
+}
+
 ConstHostPtr
 PgSqlHostDataSource::get6(const asiolink::IOAddress& prefix,
                           const uint8_t prefix_len) const {
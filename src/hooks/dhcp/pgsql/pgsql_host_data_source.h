@@ -347,6 +347,21 @@ public:
                               const uint8_t* identifier_begin,
                               const size_t identifier_len) const;
 
+    /// @brief Returns the hosts connected to the IPv4 subnet for
+    /// several identifiers.
+    ///
+    /// The lookups are sent at once in pipeline mode so their results
+    /// are read in one round trip.
+    ///
+    /// @param subnet_id Subnet identifier.
+    /// @param identifiers Identifiers to look up.
+    ///
+    /// @return Const @c Host objects in the order of the identifiers,
+    /// null when there is no reservation for an identifier.
+    virtual ConstHostCollection
+    getByIdentifiers4(const SubnetID& subnet_id,
+                      const HostIdentifierList& identifiers) const;
+
     /// @brief Returns a host connected to the IPv4 subnet and having
     /// a reservation for a specified IPv4 address.
     ///
@@ -406,6 +421,21 @@ public:
                               const uint8_t* identifier_begin,
                               const size_t identifier_len) const;
 
+    /// @brief Returns the hosts connected to the IPv6 subnet for
+    /// several identifiers.
+    ///
+    /// The lookups are sent at once in pipeline mode so their results
+    /// are read in one round trip.
+    ///
+    /// @param subnet_id Subnet identifier.
+    /// @param identifiers Identifiers to look up.
+    ///
+    /// @return Const @c Host objects in the order of the identifiers,
+    /// null when there is no reservation for an identifier.
+    virtual ConstHostCollection
+    getByIdentifiers6(const SubnetID& subnet_id,
+                      const HostIdentifierList& identifiers) const;
+
     /// @brief Returns a host using the specified IPv6 prefix.
     ///
     /// @param prefix IPv6 prefix for which the @c Host object is searched.
@@ -170,6 +170,18 @@ PgSqlTaggedStatement tagged_statements[] = {
       "FROM lease4 "
       "WHERE subnet_id = $1" },
 
+    // GET_LEASE4_SUBID_PAGE
+    { 3, { OID_INT8, OID_INT8, OID_INT8 },
+      "get_lease4_subid_page",
+      "SELECT address, hwaddr, client_id, "
+        "valid_lifetime, extract(epoch from expire)::bigint, subnet_id, "
+        "fqdn_fwd, fqdn_rev, hostname, "
+        "state, user_context, relay_id, remote_id, pool_id "
+      "FROM lease4 "
+      "WHERE subnet_id = $1 AND address > $2 "
+      "ORDER BY address "
+      "LIMIT $3" },
+
     // GET_LEASE4_STATE
     { 1, { OID_INT8 },
       "get_lease4_state",
@@ -511,6 +523,31 @@ PgSqlTaggedStatement tagged_statements[] = {
         "state, user_context, pool_id) "
       "VALUES (cast($1 as inet), $2, $3, $4, $5, $6, $7, $8, $9, $10, $11, $12, $13, $14, $15, $16, $17, $18)" },
 
+    // INSERT_LEASE4_BATCH
+    { 14, { OID_INT8, OID_BYTEA, OID_BYTEA, OID_INT8, OID_TIMESTAMP, OID_INT8,
+            OID_BOOL, OID_BOOL, OID_VARCHAR, OID_INT8, OID_TEXT, OID_BYTEA,
+            OID_BYTEA, OID_INT8 },
+      "insert_lease4_batch",
+      "INSERT INTO lease4(address, hwaddr, client_id, "
+        "valid_lifetime, expire, subnet_id, fqdn_fwd, fqdn_rev, hostname, "
+        "state, user_context, relay_id, remote_id, pool_id) "
+      "VALUES ($1, $2, $3, $4, $5, $6, $7, $8, $9, $10, $11, $12, $13, $14) "
+      "ON CONFLICT DO NOTHING" },
+
+    // INSERT_LEASE6_BATCH
+    { 18, { OID_VARCHAR, OID_BYTEA, OID_INT8, OID_TIMESTAMP, OID_INT8,
+            OID_INT8, OID_INT2, OID_INT8, OID_INT2, OID_BOOL, OID_BOOL,
+            OID_VARCHAR, OID_BYTEA, OID_INT2, OID_INT2, OID_INT8, OID_TEXT,
+            OID_INT8},
+      "insert_lease6_batch",
+      "INSERT INTO lease6(address, duid, valid_lifetime, "
+        "expire, subnet_id, pref_lifetime, "
+        "lease_type, iaid, prefix_len, fqdn_fwd, fqdn_rev, hostname, "
+        "hwaddr, hwtype, hwaddr_source, "
+        "state, user_context, pool_id) "
+      "VALUES (cast($1 as inet), $2, $3, $4, $5, $6, $7, $8, $9, $10, $11, $12, $13, $14, $15, $16, $17, $18) "
+      "ON CONFLICT DO NOTHING" },
+
     // UPDATE_LEASE4
     { 16, { OID_INT8, OID_BYTEA, OID_BYTEA, OID_INT8, OID_TIMESTAMP, OID_INT8,
             OID_BOOL, OID_BOOL, OID_VARCHAR, OID_INT8, OID_TEXT, OID_BYTEA,
@@ -539,58 +576,67 @@ PgSqlTaggedStatement tagged_statements[] = {
     // ALL_LEASE4_STATS
     { 0, { OID_NONE },
       "all_lease4_stats",
-      "SELECT subnet_id, state, leases as state_count"
-      "  FROM lease4_stat ORDER BY subnet_id, state" },
+      "SELECT subnet_id, state, SUM(leases)::BIGINT as state_count"
+      "  FROM lease4_stat "
+      "  GROUP BY subnet_id, state ORDER BY subnet_id, state" },
 
     // SUBNET_LEASE4_STATS
     { 1, { OID_INT8 },
       "subnet_lease4_stats",
-      "SELECT subnet_id, state, leases as state_count"
+      "SELECT subnet_id, state, SUM(leases)::BIGINT as state_count"
       "  FROM lease4_stat "
       "  WHERE subnet_id = $1 "
-      "  ORDER BY state" },
+      "  GROUP BY subnet_id, state ORDER BY state" },
 
     // SUBNET_RANGE_LEASE4_STATS
     { 2, { OID_INT8, OID_INT8 },
       "subnet_range_lease4_stats",
-      "SELECT subnet_id, state, leases as state_count"
+      "SELECT subnet_id, state, SUM(leases)::BIGINT as state_count"
       "  FROM lease4_stat "
       "  WHERE subnet_id >= $1 and subnet_id <= $2 "
-      "  ORDER BY subnet_id, state" },
+      "  GROUP BY subnet_id, state ORDER BY subnet_id, state" },
 
     // ALL_POOL_LEASE4_STATS
     { 0, { OID_NONE },
       "all_pool_lease4_stats",
-      "SELECT subnet_id, pool_id, state, leases as state_count"
-      "  FROM lease4_pool_stat ORDER BY subnet_id, pool_id, state" },
+      "SELECT subnet_id, pool_id, state, SUM(leases)::BIGINT as state_count"
+      "  FROM lease4_pool_stat "
+      "  GROUP BY subnet_id, pool_id, state"
+      "  ORDER BY subnet_id, pool_id, state" },
 
     // ALL_LEASE6_STATS,
     { 0, { OID_NONE },
       "all_lease6_stats",
-      "SELECT subnet_id, lease_type, state, leases as state_count"
-      "  FROM lease6_stat ORDER BY subnet_id, lease_type, state" },
+      "SELECT subnet_id, lease_type, state, SUM(leases)::BIGINT as state_count"
+      "  FROM lease6_stat "
+      "  GROUP BY subnet_id, lease_type, state"
+      "  ORDER BY subnet_id, lease_type, state" },
 
     // SUBNET_LEASE6_STATS
     { 1, { OID_INT8 },
       "subnet_lease6_stats",
-      "SELECT subnet_id, lease_type, state, leases as state_count"
+      "SELECT subnet_id, lease_type, state, SUM(leases)::BIGINT as state_count"
       "  FROM lease6_stat "
       "  WHERE subnet_id = $1 "
-      "  ORDER BY lease_type, state" },
+      "  GROUP BY subnet_id, lease_type, state ORDER BY lease_type, state" },
 
     // SUBNET_RANGE_LEASE6_STATS
     { 2, { OID_INT8, OID_INT8 },
       "subnet_range_lease6_stats",
-      "SELECT subnet_id, lease_type, state, leases as state_count"
+      "SELECT subnet_id, lease_type, state, SUM(leases)::BIGINT as state_count"
       "  FROM lease6_stat "
       "  WHERE subnet_id >= $1 and subnet_id <= $2 "
+      "  GROUP BY subnet_id, lease_type, state"
       "  ORDER BY subnet_id, lease_type, state" },
 
     // ALL_POOL_LEASE6_STATS,
     { 0, { OID_NONE },
       "all_pool_lease6_stats",
-      "SELECT subnet_id, pool_id, lease_type, state, leases as state_count"
-      "  FROM lease6_pool_stat ORDER BY subnet_id, pool_id, lease_type, state" },
+      "SELECT subnet_id, pool_id, lease_type, state,"
+      "  SUM(leases)::BIGINT as state_count"
+      "  FROM lease6_pool_stat "
+      "  GROUP BY subnet_id, pool_id, lease_type, state"
+      "  ORDER BY subnet_id, pool_id, lease_type, state" },
 
     // CHECK_LEASE4_LIMITS
     { 1, { OID_TEXT },
@@ -885,6 +931,28 @@ PgSqlTaggedStatement tagged_statements[] = {
     { 0, { 0 }, 0, 0 }
 };
 
+/// @brief Checks the result of a pipelined lease update or delete.
+///
+/// @param r The result of the statement.
+/// @param lease The updated or deleted lease.
+/// @param what "updated" or "deleted", used in the error message.
+/// @return true if the lease was found, false if it does not exist.
+/// @throw DbOperationError if more than one lease was affected.
+template<typename LeasePtr>
+bool
+checkAffectedRows(const PgSqlResult& r, const LeasePtr& lease,
+                  const char* what) {
+    int affected_rows = boost::lexical_cast<int>(PQcmdTuples(r));
+    if (affected_rows > 1) {
+        // Should not happen - primary key constraint should only have
+        // selected one row.
+        isc_throw(DbOperationError, "apparently " << what << " more than "
+                  "one lease that had the address " << lease->addr_.toText()
+                  << ", row count: " << affected_rows);
+    }
+    return (affected_rows == 1);
+}
+
 }  // namespace
 
 namespace isc {
@@ -2041,11 +2109,62 @@ PgSqlLeaseMgr::addLeaseCommon(PgSqlLeaseContextPtr& ctx,
     if (outputs_row_count) {
         getRowCount(r);
         trans->commit();
+    } else if (boost::lexical_cast<int>(PQcmdTuples(r)) == 0) {
+        // The batch statements skip duplicates instead of failing.
+        return (false);
     }
 
     return (true);
 }
 
+bool
+PgSqlLeaseMgr::addLeaseInternal(PgSqlLeaseContextPtr& ctx,
+                                const Lease4Ptr& lease, bool batch) {
+    PsqlBindArray bind_array;
+    ctx->exchange4_->createBindForSend(lease, bind_array);
+
+    if (!useSharedFlqStatement(lease)) {
+        return (addLeaseCommon(ctx, batch ? INSERT_LEASE4_BATCH : INSERT_LEASE4,
+                               bind_array));
+    }
+    if (!batch) {
+        return (addLeaseCommon(ctx, SFLQ_INSERT_LEASE4, bind_array, true));
+    }
+
+    // A duplicate aborts the whole transaction so protect the batch
+    // with a savepoint.
+    ctx->conn_.createSavepoint("add_lease");
+    if (addLeaseCommon(ctx, SFLQ_INSERT_LEASE4, bind_array, true)) {
+        return (true);
+    }
+    ctx->conn_.rollbackToSavepoint("add_lease");
+    return (false);
+}
+
+bool
+PgSqlLeaseMgr::addLeaseInternal(PgSqlLeaseContextPtr& ctx,
+                                const Lease6Ptr& lease, bool batch) {
+    PsqlBindArray bind_array;
+    ctx->exchange6_->createBindForSend(lease, bind_array);
+
+    if (!useSharedFlqStatement(lease)) {
+        return (addLeaseCommon(ctx, batch ? INSERT_LEASE6_BATCH : INSERT_LEASE6,
+                               bind_array));
+    }
+    if (!batch) {
+        return (addLeaseCommon(ctx, SFLQ_INSERT_LEASE6, bind_array, true));
+    }
+
+    // A duplicate aborts the whole transaction so protect the batch
+    // with a savepoint.
+    ctx->conn_.createSavepoint("add_lease");
+    if (addLeaseCommon(ctx, SFLQ_INSERT_LEASE6, bind_array, true)) {
+        return (true);
+    }
+    ctx->conn_.rollbackToSavepoint("add_lease");
+    return (false);
+}
+
 bool
 PgSqlLeaseMgr::addLease(const Lease4Ptr& lease) {
     LOG_DEBUG(pgsql_lb_logger, PGSQL_LB_DBG_TRACE_DETAIL, PGSQL_LB_ADD_ADDR4)
@@ -2055,15 +2174,7 @@ PgSqlLeaseMgr::addLease(const Lease4Ptr& lease) {
     PgSqlLeaseTrackingContextAlloc get_context(*this, lease);
     PgSqlLeaseContextPtr ctx = get_context.ctx_;
 
-    PsqlBindArray bind_array;
-    ctx->exchange4_->createBindForSend(lease, bind_array);
-
-    bool result;
-    if (!useSharedFlqStatement(lease)) {
-        result = addLeaseCommon(ctx, INSERT_LEASE4, bind_array);
-    } else {
-        result = addLeaseCommon(ctx, SFLQ_INSERT_LEASE4, bind_array, true);
-    }
+    bool result = addLeaseInternal(ctx, lease);
 
     // Update lease current expiration time (allows update between the creation
     // of the Lease up to the point of insertion in the database).
@@ -2089,15 +2200,7 @@ PgSqlLeaseMgr::addLease(const Lease6Ptr& lease) {
     PgSqlLeaseTrackingContextAlloc get_context(*this, lease);
     PgSqlLeaseContextPtr ctx = get_context.ctx_;
 
-    PsqlBindArray bind_array;
-    ctx->exchange6_->createBindForSend(lease, bind_array);
-
-    bool result;
-    if (!useSharedFlqStatement(lease)) {
-        result = addLeaseCommon(ctx, INSERT_LEASE6, bind_array);
-    } else {
-        result = addLeaseCommon(ctx, SFLQ_INSERT_LEASE6, bind_array, true);
-    }
+    bool result = addLeaseInternal(ctx, lease);
 
     // Update lease current expiration time (allows update between the creation
     // of the Lease up to the point of insertion in the database).
@@ -2115,6 +2218,148 @@ PgSqlLeaseMgr::addLease(const Lease6Ptr& lease) {
     return (result);
 }
 
+Lease4Collection
+PgSqlLeaseMgr::addLeases(const Lease4Collection& leases) {
+    // In multi-threaded mode the callbacks require to lock each lease:
+    // add them one by one.
+    if (leases.empty() ||
+        (hasCallbacks() && MultiThreadingMgr::instance().getMode())) {
+        return (LeaseMgr::addLeases(leases));
+    }
+
+    LOG_DEBUG(pgsql_lb_logger, PGSQL_LB_DBG_TRACE_DETAIL, PGSQL_LB_ADD_LEASES4)
+        .arg(leases.size());
+
+    // Get a context
+    PgSqlLeaseContextAlloc get_context(*this);
+    PgSqlLeaseContextPtr ctx = get_context.ctx_;
+
+    // Insert all leases in one transaction so they are committed at once.
+    // Plain inserts are pipelined, the shared free lease queue ones are
+    // executed one by one after them.
+    Lease4Collection added;
+    Lease4Collection failed;
+    Lease4Collection queued;
+    Lease4Collection others;
+    PgSqlTransaction transaction(ctx->conn_);
+    PgSqlPipeline pipeline(ctx->conn_);
+    for (auto const& lease : leases) {
+        if (useSharedFlqStatement(lease)) {
+            others.push_back(lease);
+            continue;
+        }
+        PsqlBindArray bind_array;
+        ctx->exchange4_->createBindForSend(lease, bind_array);
+        pipeline.add(tagged_statements[INSERT_LEASE4_BATCH], bind_array);
+        queued.push_back(lease);
+    }
+    std::vector<PgSqlResultPtr> results = pipeline.execute();
+    for (size_t i = 0; i < queued.size(); ++i) {
+        // The batch statements skip duplicates instead of failing.
+        if (boost::lexical_cast<int>(PQcmdTuples(*results[i])) == 0) {
+            failed.push_back(queued[i]);
+        } else {
+            added.push_back(queued[i]);
+        }
+    }
+    for (auto const& lease : others) {
+        if (addLeaseInternal(ctx, lease, true)) {
+            added.push_back(lease);
+        } else {
+            failed.push_back(lease);
+        }
+    }
+    transaction.commit();
+
+    for (auto const& lease : leases) {
+        lease->updateCurrentExpirationTime();
+    }
+
+    // Run installed callbacks.
+    if (hasCallbacks()) {
+        for (auto const& lease : added) {
+            trackAddLease(lease);
+        }
+    }
+
+    return (failed);
+}
+
+Lease6Collection
+PgSqlLeaseMgr::addLeases(const Lease6Collection& leases) {
+    // In multi-threaded mode the callbacks require to lock each lease:
+    // add them one by one.
+    if (leases.empty() ||
+        (hasCallbacks() && MultiThreadingMgr::instance().getMode())) {
+        return (LeaseMgr::addLeases(leases));
+    }
+
+    LOG_DEBUG(pgsql_lb_logger, PGSQL_LB_DBG_TRACE_DETAIL, PGSQL_LB_ADD_LEASES6)
+        .arg(leases.size());
+
+    // Get a context
+    PgSqlLeaseContextAlloc get_context(*this);
+    PgSqlLeaseContextPtr ctx = get_context.ctx_;
+
+    // Insert all leases in one transaction so they are committed at once.
+    // Plain inserts are pipelined, the shared free lease queue ones are
+    // executed one by one after them.
+    Lease6Collection added;
+    Lease6Collection failed;
+    Lease6Collection queued;
+    Lease6Collection others;
+    PgSqlTransaction transaction(ctx->conn_);
+    PgSqlPipeline pipeline(ctx->conn_);
+    for (auto const& lease : leases) {
+        lease->extended_info_action_ = Lease6::ACTION_IGNORE;
+        if (useSharedFlqStatement(lease)) {
+            others.push_back(lease);
+            continue;
+        }
+        PsqlBindArray bind_array;
+        ctx->exchange6_->createBindForSend(lease, bind_array);
+        pipeline.add(tagged_statements[INSERT_LEASE6_BATCH], bind_array);
+        queued.push_back(lease);
+    }
+    std::vector<PgSqlResultPtr> results = pipeline.execute();
+    for (size_t i = 0; i < queued.size(); ++i) {
+        // The batch statements skip duplicates instead of failing.
+        if (boost::lexical_cast<int>(PQcmdTuples(*results[i])) == 0) {
+            failed.push_back(queued[i]);
+        } else {
+            added.push_back(queued[i]);
+        }
+    }
+    for (auto const& lease : others) {
+        if (addLeaseInternal(ctx, lease, true)) {
+            added.push_back(lease);
+        } else {
+            failed.push_back(lease);
+        }
+    }
+    transaction.commit();
+
+    for (auto const& lease : leases) {
+        lease->updateCurrentExpirationTime();
+    }
+
+    // The extended info tables reference the committed leases.
+    if (getExtendedInfoTablesEnabled()) {
+        for (auto const& lease : added) {
+            static_cast<void>(addExtendedInfo6(lease));
+        }
+    }
+
+    // Run installed callbacks.
+    if (hasCallbacks()) {
+        for (auto const& lease : added) {
+            trackAddLease(lease);
+        }
+    }
+
+    return (failed);
+}
+
 template <typename Exchange, typename LeaseCollection>
 void
 PgSqlLeaseMgr::getLeaseCollection(PgSqlLeaseContextPtr& ctx,
@@ -2478,6 +2723,50 @@ PgSqlLeaseMgr::getLeases4(const IOAddress& lower_bound_address,
     return (result);
 }
 
+Lease4Collection
+PgSqlLeaseMgr::getLeases4(SubnetID subnet_id,
+                          const IOAddress& lower_bound_address,
+                          const LeasePageSize& page_size) const {
+    // Expecting IPv4 address.
+    if (!lower_bound_address.isV4()) {
+        isc_throw(InvalidAddressFamily, "expected IPv4 address while "
+                  "retrieving leases from the lease database, got "
+                  << lower_bound_address);
+    }
+
+    LOG_DEBUG(pgsql_lb_logger, PGSQL_LB_DBG_TRACE_DETAIL,
+              PGSQL_LB_GET_SUBID_PAGE4)
+        .arg(page_size.page_size_)
+        .arg(lower_bound_address.toText())
+        .arg(subnet_id);
+
+    // Prepare WHERE clause
+    PsqlBindArray bind_array;
+
+    // Bind subnet id.
+    std::string subnet_id_str = boost::lexical_cast<std::string>(subnet_id);
+    bind_array.add(subnet_id_str);
+
+    // Bind lower bound address
+    std::string lb_address_data = boost::lexical_cast<std::string>(lower_bound_address.toUint32());
+    bind_array.add(lb_address_data);
+
+    // Bind page size value
+    std::string page_size_data = boost::lexical_cast<std::string>(page_size.page_size_);
+    bind_array.add(page_size_data);
+
+    // Get the leases
+    Lease4Collection result;
+
+    // Get a context
+    PgSqlLeaseContextAlloc get_context(*this);
+    PgSqlLeaseContextPtr ctx = get_context.ctx_;
+
+    getLeaseCollection(ctx, GET_LEASE4_SUBID_PAGE, bind_array, result);
+
+    return (result);
+}
+
 Lease6Ptr
 PgSqlLeaseMgr::getLease6(Lease::Type lease_type,
                          const IOAddress& addr) const {
@@ -2927,14 +3216,9 @@ PgSqlLeaseMgr::updateLeaseCommon(PgSqlLeaseContextPtr& ctx,
 }
 
 void
-PgSqlLeaseMgr::updateLease4(const Lease4Ptr& lease) {
-    LOG_DEBUG(pgsql_lb_logger, PGSQL_LB_DBG_TRACE_DETAIL, PGSQL_LB_UPDATE_ADDR4)
-        .arg(lease->addr_.toText());
-
-    // Get a context
-    PgSqlLeaseTrackingContextAlloc get_context(*this, lease);
-    PgSqlLeaseContextPtr ctx = get_context.ctx_;
-
+PgSqlLeaseMgr::updateLeaseInternal(PgSqlLeaseContextPtr& ctx,
+                                   const Lease4Ptr& lease,
+                                   PgSqlPipeline* pipeline) {
     // Create the BIND array for the data being updated
     PsqlBindArray bind_array;
     ctx->exchange4_->createBindForSend(lease, bind_array);
@@ -2955,10 +3239,26 @@ PgSqlLeaseMgr::updateLease4(const Lease4Ptr& lease) {
 
     // Drop to common update code
     if (!useSharedFlqStatement(lease)) {
+        if (pipeline) {
+            pipeline->add(tagged_statements[UPDATE_LEASE4], bind_array);
+            return;
+        }
         updateLeaseCommon(ctx, UPDATE_LEASE4, bind_array, lease);
     } else {
         updateLeaseCommon(ctx, SFLQ_UPDATE_LEASE4, bind_array, lease, true);
     }
+}
+
+void
+PgSqlLeaseMgr::updateLease4(const Lease4Ptr& lease) {
+    LOG_DEBUG(pgsql_lb_logger, PGSQL_LB_DBG_TRACE_DETAIL, PGSQL_LB_UPDATE_ADDR4)
+        .arg(lease->addr_.toText());
+
+    // Get a context
+    PgSqlLeaseTrackingContextAlloc get_context(*this, lease);
+    PgSqlLeaseContextPtr ctx = get_context.ctx_;
+
+    updateLeaseInternal(ctx, lease);
 
     // Update lease current expiration time.
     lease->updateCurrentExpirationTime();
@@ -2970,19 +3270,9 @@ PgSqlLeaseMgr::updateLease4(const Lease4Ptr& lease) {
 }
 
 void
-PgSqlLeaseMgr::updateLease6(const Lease6Ptr& lease) {
-    LOG_DEBUG(pgsql_lb_logger, PGSQL_LB_DBG_TRACE_DETAIL, PGSQL_LB_UPDATE_ADDR6)
-        .arg(lease->addr_.toText())
-        .arg(Lease::typeToText(lease->type_));
-
-    // Get the recorded action and reset it.
-    Lease6::ExtendedInfoAction recorded_action = lease->extended_info_action_;
-    lease->extended_info_action_ = Lease6::ACTION_IGNORE;
-
-    // Get a context
-    PgSqlLeaseTrackingContextAlloc get_context(*this, lease);
-    PgSqlLeaseContextPtr ctx = get_context.ctx_;
-
+PgSqlLeaseMgr::updateLeaseInternal(PgSqlLeaseContextPtr& ctx,
+                                   const Lease6Ptr& lease,
+                                   PgSqlPipeline* pipeline) {
     // Create the BIND array for the data being updated
     PsqlBindArray bind_array;
     ctx->exchange6_->createBindForSend(lease, bind_array);
@@ -3003,35 +3293,203 @@ PgSqlLeaseMgr::updateLease6(const Lease6Ptr& lease) {
 
     // Drop to common update code
     if (!useSharedFlqStatement(lease)) {
+        if (pipeline) {
+            pipeline->add(tagged_statements[UPDATE_LEASE6], bind_array);
+            return;
+        }
         updateLeaseCommon(ctx, UPDATE_LEASE6, bind_array, lease);
     } else {
         updateLeaseCommon(ctx, SFLQ_UPDATE_LEASE6, bind_array, lease, true);
     }
+}
+
+void
+PgSqlLeaseMgr::updateLease6(const Lease6Ptr& lease) {
+    LOG_DEBUG(pgsql_lb_logger, PGSQL_LB_DBG_TRACE_DETAIL, PGSQL_LB_UPDATE_ADDR6)
+        .arg(lease->addr_.toText())
+        .arg(Lease::typeToText(lease->type_));
+
+    // Get the recorded action and reset it.
+    Lease6::ExtendedInfoAction recorded_action = lease->extended_info_action_;
+    lease->extended_info_action_ = Lease6::ACTION_IGNORE;
+
+    // Get a context
+    PgSqlLeaseTrackingContextAlloc get_context(*this, lease);
+    PgSqlLeaseContextPtr ctx = get_context.ctx_;
+
+    updateLeaseInternal(ctx, lease);
 
     // Update lease current expiration time.
     lease->updateCurrentExpirationTime();
 
     // Update extended info tables.
     if (getExtendedInfoTablesEnabled()) {
-        switch (recorded_action) {
-        case Lease6::ACTION_IGNORE:
-            break;
+        updateExtendedInfo6(lease, recorded_action);
+    }
 
-        case Lease6::ACTION_DELETE:
-            deleteExtendedInfo6(lease->addr_);
-            break;
+    // Run installed callbacks.
+    if (hasCallbacks()) {
+        trackUpdateLease(lease);
+    }
+}
 
-        case Lease6::ACTION_UPDATE:
-            deleteExtendedInfo6(lease->addr_);
-            static_cast<void>(addExtendedInfo6(lease));
-            break;
+void
+PgSqlLeaseMgr::updateExtendedInfo6(const Lease6Ptr& lease,
+                                   Lease6::ExtendedInfoAction action) {
+    switch (action) {
+    case Lease6::ACTION_IGNORE:
+        break;
+
+    case Lease6::ACTION_DELETE:
+        deleteExtendedInfo6(lease->addr_);
+        break;
+
+    case Lease6::ACTION_UPDATE:
+        deleteExtendedInfo6(lease->addr_);
+        static_cast<void>(addExtendedInfo6(lease));
+        break;
+    }
+}
+
+Lease4Collection
+PgSqlLeaseMgr::updateLeases4(const Lease4Collection& leases) {
+    // In multi-threaded mode the callbacks require to lock each lease:
+    // update them one by one.
+    if (leases.empty() ||
+        (hasCallbacks() && MultiThreadingMgr::instance().getMode())) {
+        return (LeaseMgr::updateLeases4(leases));
+    }
+
+    LOG_DEBUG(pgsql_lb_logger, PGSQL_LB_DBG_TRACE_DETAIL, PGSQL_LB_UPDATE_LEASES4)
+        .arg(leases.size());
+
+    // Get a context
+    PgSqlLeaseContextAlloc get_context(*this);
+    PgSqlLeaseContextPtr ctx = get_context.ctx_;
+
+    // Update all leases in one transaction so they are committed at once.
+    // Plain updates are pipelined, the shared free lease queue ones are
+    // executed one by one after them.
+    Lease4Collection updated;
+    Lease4Collection failed;
+    Lease4Collection queued;
+    Lease4Collection others;
+    PgSqlTransaction transaction(ctx->conn_);
+    PgSqlPipeline pipeline(ctx->conn_);
+    for (auto const& lease : leases) {
+        if (useSharedFlqStatement(lease)) {
+            others.push_back(lease);
+            continue;
+        }
+        updateLeaseInternal(ctx, lease, &pipeline);
+        queued.push_back(lease);
+    }
+    std::vector<PgSqlResultPtr> results = pipeline.execute();
+    for (size_t i = 0; i < queued.size(); ++i) {
+        if (checkAffectedRows(*results[i], queued[i], "updated")) {
+            updated.push_back(queued[i]);
+        } else {
+            failed.push_back(queued[i]);
         }
     }
+    for (auto const& lease : others) {
+        try {
+            updateLeaseInternal(ctx, lease);
+            updated.push_back(lease);
+        } catch (const NoSuchLease&) {
+            failed.push_back(lease);
+        }
+    }
+    transaction.commit();
+
+    for (auto const& lease : updated) {
+        lease->updateCurrentExpirationTime();
+    }
 
     // Run installed callbacks.
     if (hasCallbacks()) {
-        trackUpdateLease(lease);
+        for (auto const& lease : updated) {
+            trackUpdateLease(lease);
+        }
+    }
+
+    return (failed);
+}
+
+Lease6Collection
+PgSqlLeaseMgr::updateLeases6(const Lease6Collection& leases) {
+    // In multi-threaded mode the callbacks require to lock each lease:
+    // update them one by one.
+    if (leases.empty() ||
+        (hasCallbacks() && MultiThreadingMgr::instance().getMode())) {
+        return (LeaseMgr::updateLeases6(leases));
+    }
+
+    LOG_DEBUG(pgsql_lb_logger, PGSQL_LB_DBG_TRACE_DETAIL, PGSQL_LB_UPDATE_LEASES6)
+        .arg(leases.size());
+
+    // Get a context
+    PgSqlLeaseContextAlloc get_context(*this);
+    PgSqlLeaseContextPtr ctx = get_context.ctx_;
+
+    // Update all leases in one transaction so they are committed at once.
+    // Plain updates are pipelined, the shared free lease queue ones are
+    // executed one by one after them.
+    typedef std::pair<Lease6Ptr, Lease6::ExtendedInfoAction> LeaseAction;
+    std::vector<LeaseAction> updated;
+    Lease6Collection failed;
+    std::vector<LeaseAction> queued;
+    std::vector<LeaseAction> others;
+    PgSqlTransaction transaction(ctx->conn_);
+    PgSqlPipeline pipeline(ctx->conn_);
+    for (auto const& lease : leases) {
+        // Get the recorded action and reset it.
+        Lease6::ExtendedInfoAction recorded_action = lease->extended_info_action_;
+        lease->extended_info_action_ = Lease6::ACTION_IGNORE;
+        if (useSharedFlqStatement(lease)) {
+            others.push_back(std::make_pair(lease, recorded_action));
+            continue;
+        }
+        updateLeaseInternal(ctx, lease, &pipeline);
+        queued.push_back(std::make_pair(lease, recorded_action));
+    }
+    std::vector<PgSqlResultPtr> results = pipeline.execute();
+    for (size_t i = 0; i < queued.size(); ++i) {
+        if (checkAffectedRows(*results[i], queued[i].first, "updated")) {
+            updated.push_back(queued[i]);
+        } else {
+            failed.push_back(queued[i].first);
+        }
+    }
+    for (auto const& item : others) {
+        try {
+            updateLeaseInternal(ctx, item.first);
+            updated.push_back(item);
+        } catch (const NoSuchLease&) {
+            failed.push_back(item.first);
+        }
+    }
+    transaction.commit();
+
+    for (auto const& item : updated) {
+        item.first->updateCurrentExpirationTime();
+    }
+
+    // Update extended info tables.
+    if (getExtendedInfoTablesEnabled()) {
+        for (auto const& item : updated) {
+            updateExtendedInfo6(item.first, item.second);
+        }
+    }
+
+    // Run installed callbacks.
+    if (hasCallbacks()) {
+        for (auto const& item : updated) {
+            trackUpdateLease(item.first);
+        }
     }
+
+    return (failed);
 }
 
 uint64_t
@@ -3064,11 +3522,10 @@ PgSqlLeaseMgr::deleteLeaseCommon(PgSqlLeaseContextPtr& ctx,
 }
 
 bool
-PgSqlLeaseMgr::deleteLease(const Lease4Ptr& lease) {
+PgSqlLeaseMgr::deleteLeaseInternal(PgSqlLeaseContextPtr& ctx,
+                                   const Lease4Ptr& lease,
+                                   PgSqlPipeline* pipeline) {
     const IOAddress& addr = lease->addr_;
-    LOG_DEBUG(pgsql_lb_logger, PGSQL_LB_DBG_TRACE_DETAIL,
-              PGSQL_LB_DELETE_ADDR4)
-        .arg(addr.toText());
 
     // Set up the WHERE clause value
     PsqlBindArray bind_array;
@@ -3086,12 +3543,12 @@ PgSqlLeaseMgr::deleteLease(const Lease4Ptr& lease) {
     }
     bind_array.add(expire_str);
 
-    // Get a context
-    PgSqlLeaseTrackingContextAlloc get_context(*this, lease);
-    PgSqlLeaseContextPtr ctx = get_context.ctx_;
-
     int affected_rows;
     if (!useSharedFlqStatement(lease)) {
+        if (pipeline) {
+            pipeline->add(tagged_statements[DELETE_LEASE4], bind_array);
+            return (false);
+        }
         affected_rows = deleteLeaseCommon(ctx, DELETE_LEASE4, bind_array);
     } else {
         affected_rows = deleteLeaseCommon(ctx, SFLQ_DELETE_LEASE4, bind_array, true);
@@ -3099,9 +3556,6 @@ PgSqlLeaseMgr::deleteLease(const Lease4Ptr& lease) {
 
     // Check success case first as it is the most likely outcome.
     if (affected_rows == 1) {
-        if (hasCallbacks()) {
-            trackDeleteLease(lease);
-        }
         return (true);
     }
 
@@ -3117,13 +3571,10 @@ PgSqlLeaseMgr::deleteLease(const Lease4Ptr& lease) {
 }
 
 bool
-PgSqlLeaseMgr::deleteLease(const Lease6Ptr& lease) {
+PgSqlLeaseMgr::deleteLeaseInternal(PgSqlLeaseContextPtr& ctx,
+                                   const Lease6Ptr& lease,
+                                   PgSqlPipeline* pipeline) {
     const IOAddress& addr = lease->addr_;
-    LOG_DEBUG(pgsql_lb_logger, PGSQL_LB_DBG_TRACE_DETAIL,
-              PGSQL_LB_DELETE_ADDR6)
-        .arg(addr.toText());
-
-    lease->extended_info_action_ = Lease6::ACTION_IGNORE;
 
     // Set up the WHERE clause value
     PsqlBindArray bind_array;
@@ -3141,12 +3592,12 @@ PgSqlLeaseMgr::deleteLease(const Lease6Ptr& lease) {
     }
     bind_array.add(expire_str);
 
-    // Get a context
-    PgSqlLeaseTrackingContextAlloc get_context(*this, lease);
-    PgSqlLeaseContextPtr ctx = get_context.ctx_;
-
     int affected_rows;
     if (!useSharedFlqStatement(lease)) {
+        if (pipeline) {
+            pipeline->add(tagged_statements[DELETE_LEASE6], bind_array);
+            return (false);
+        }
         affected_rows = deleteLeaseCommon(ctx, DELETE_LEASE6, bind_array);
     } else {
         affected_rows = deleteLeaseCommon(ctx, SFLQ_DELETE_LEASE6, bind_array, true);
@@ -3156,11 +3607,6 @@ PgSqlLeaseMgr::deleteLease(const Lease6Ptr& lease) {
     if (affected_rows == 1) {
         // Delete references from extended info tables.
         // Performed by the delete cascade.
-
-        // Run installed callbacks.
-        if (hasCallbacks()) {
-            trackDeleteLease(lease);
-        }
         return (true);
     }
 
@@ -3175,6 +3621,171 @@ PgSqlLeaseMgr::deleteLease(const Lease6Ptr& lease) {
               "that had the address " << lease->addr_.toText());
 }
 
+bool
+PgSqlLeaseMgr::deleteLease(const Lease4Ptr& lease) {
+    LOG_DEBUG(pgsql_lb_logger, PGSQL_LB_DBG_TRACE_DETAIL,
+              PGSQL_LB_DELETE_ADDR4)
+        .arg(lease->addr_.toText());
+
+    // Get a context
+    PgSqlLeaseTrackingContextAlloc get_context(*this, lease);
+    PgSqlLeaseContextPtr ctx = get_context.ctx_;
+
+    if (!deleteLeaseInternal(ctx, lease)) {
+        return (false);
+    }
+
+    // Run installed callbacks.
+    if (hasCallbacks()) {
+        trackDeleteLease(lease);
+    }
+    return (true);
+}
+
+bool
+PgSqlLeaseMgr::deleteLease(const Lease6Ptr& lease) {
+    LOG_DEBUG(pgsql_lb_logger, PGSQL_LB_DBG_TRACE_DETAIL,
+              PGSQL_LB_DELETE_ADDR6)
+        .arg(lease->addr_.toText());
+
+    lease->extended_info_action_ = Lease6::ACTION_IGNORE;
+
+    // Get a context
+    PgSqlLeaseTrackingContextAlloc get_context(*this, lease);
+    PgSqlLeaseContextPtr ctx = get_context.ctx_;
+
+    if (!deleteLeaseInternal(ctx, lease)) {
+        return (false);
+    }
+
+    // Run installed callbacks.
+    if (hasCallbacks()) {
+        trackDeleteLease(lease);
+    }
+    return (true);
+}
+
+Lease4Collection
+PgSqlLeaseMgr::deleteLeases(const Lease4Collection& leases) {
+    // In multi-threaded mode the callbacks require to lock each lease:
+    // delete them one by one.
+    if (leases.empty() ||
+        (hasCallbacks() && MultiThreadingMgr::instance().getMode())) {
+        return (LeaseMgr::deleteLeases(leases));
+    }
+
+    LOG_DEBUG(pgsql_lb_logger, PGSQL_LB_DBG_TRACE_DETAIL, PGSQL_LB_DELETE_LEASES4)
+        .arg(leases.size());
+
+    // Get a context
+    PgSqlLeaseContextAlloc get_context(*this);
+    PgSqlLeaseContextPtr ctx = get_context.ctx_;
+
+    // Delete all leases in one transaction so they are committed at once.
+    // Plain deletes are pipelined, the shared free lease queue ones are
+    // executed one by one after them.
+    Lease4Collection deleted;
+    Lease4Collection failed;
+    Lease4Collection queued;
+    Lease4Collection others;
+    PgSqlTransaction transaction(ctx->conn_);
+    PgSqlPipeline pipeline(ctx->conn_);
+    for (auto const& lease : leases) {
+        if (useSharedFlqStatement(lease)) {
+            others.push_back(lease);
+            continue;
+        }
+        static_cast<void>(deleteLeaseInternal(ctx, lease, &pipeline));
+        queued.push_back(lease);
+    }
+    std::vector<PgSqlResultPtr> results = pipeline.execute();
+    for (size_t i = 0; i < queued.size(); ++i) {
+        if (checkAffectedRows(*results[i], queued[i], "deleted")) {
+            deleted.push_back(queued[i]);
+        } else {
+            failed.push_back(queued[i]);
+        }
+    }
+    for (auto const& lease : others) {
+        if (deleteLeaseInternal(ctx, lease)) {
+            deleted.push_back(lease);
+        } else {
+            failed.push_back(lease);
+        }
+    }
+    transaction.commit();
+
+    // Run installed callbacks.
+    if (hasCallbacks()) {
+        for (auto const& lease : deleted) {
+            trackDeleteLease(lease);
+        }
+    }
+
+    return (failed);
+}
+
+Lease6Collection
+PgSqlLeaseMgr::deleteLeases(const Lease6Collection& leases) {
+    // In multi-threaded mode the callbacks require to lock each lease:
+    // delete them one by one.
+    if (leases.empty() ||
+        (hasCallbacks() && MultiThreadingMgr::instance().getMode())) {
+        return (LeaseMgr::deleteLeases(leases));
+    }
+
+    LOG_DEBUG(pgsql_lb_logger, PGSQL_LB_DBG_TRACE_DETAIL, PGSQL_LB_DELETE_LEASES6)
+        .arg(leases.size());
+
+    // Get a context
+    PgSqlLeaseContextAlloc get_context(*this);
+    PgSqlLeaseContextPtr ctx = get_context.ctx_;
+
+    // Delete all leases in one transaction so they are committed at once.
+    // Plain deletes are pipelined, the shared free lease queue ones are
+    // executed one by one after them.
+    Lease6Collection deleted;
+    Lease6Collection failed;
+    Lease6Collection queued;
+    Lease6Collection others;
+    PgSqlTransaction transaction(ctx->conn_);
+    PgSqlPipeline pipeline(ctx->conn_);
+    for (auto const& lease : leases) {
+        lease->extended_info_action_ = Lease6::ACTION_IGNORE;
+        if (useSharedFlqStatement(lease)) {
+            others.push_back(lease);
+            continue;
+        }
+        static_cast<void>(deleteLeaseInternal(ctx, lease, &pipeline));
+        queued.push_back(lease);
+    }
+    std::vector<PgSqlResultPtr> results = pipeline.execute();
+    for (size_t i = 0; i < queued.size(); ++i) {
+        if (checkAffectedRows(*results[i], queued[i], "deleted")) {
+            deleted.push_back(queued[i]);
+        } else {
+            failed.push_back(queued[i]);
+        }
+    }
+    for (auto const& lease : others) {
+        if (deleteLeaseInternal(ctx, lease)) {
+            deleted.push_back(lease);
+        } else {
+            failed.push_back(lease);
+        }
+    }
+    transaction.commit();
+
+    // Run installed callbacks.
+    if (hasCallbacks()) {
+        for (auto const& lease : deleted) {
+            trackDeleteLease(lease);
+        }
+    }
+
+    return (failed);
+}
+
 uint64_t
 PgSqlLeaseMgr::deleteExpiredReclaimedLeases4(const uint32_t secs) {
     LOG_DEBUG(pgsql_lb_logger, PGSQL_LB_DBG_TRACE_DETAIL, PGSQL_LB_DELETE_EXPIRED_RECLAIMED4)
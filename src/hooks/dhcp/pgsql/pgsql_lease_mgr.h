@@ -301,6 +301,19 @@ public:
     getLeases4(const asiolink::IOAddress& lower_bound_address,
                const LeasePageSize& page_size) const override;
 
+    /// @brief Returns a page of IPv4 leases for a subnet identifier.
+    ///
+    /// @param subnet_id subnet identifier.
+    /// @param lower_bound_address IPv4 address used as lower bound for the
+    /// returned range.
+    /// @param page_size maximum size of the page returned.
+    ///
+    /// @return collection of IPv4 leases
+    virtual Lease4Collection
+    getLeases4(SubnetID subnet_id,
+               const asiolink::IOAddress& lower_bound_address,
+               const LeasePageSize& page_size) const override;
+
     /// @brief Returns all IPv4 leases for the particular state and subnet.
     ///
     /// @param state the state e.g. 1 (declined).
@@ -571,6 +584,82 @@ public:
     /// different expiration time.
     virtual bool deleteLease(const Lease6Ptr& lease) override;
 
+    /// @brief Adds a batch of IPv4 leases.
+    ///
+    /// The leases are inserted using one context and one transaction.
+    /// In multi-threaded mode with lease tracking callbacks installed the
+    /// leases are added one by one.
+    ///
+    /// @param leases The leases to be added.
+    ///
+    /// @return The leases which were not added because a lease with the
+    ///         same address was already there.
+    ///
+    /// @throw isc::db::DbOperationError An operation on the open database has
+    ///        failed. No lease of the batch is added.
+    virtual Lease4Collection addLeases(const Lease4Collection& leases) override;
+
+    /// @brief Adds a batch of IPv6 leases.
+    ///
+    /// See the IPv4 version for details.
+    ///
+    /// @param leases The leases to be added.
+    ///
+    /// @return The leases which were not added.
+    ///
+    /// @throw isc::db::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual Lease6Collection addLeases(const Lease6Collection& leases) override;
+
+    /// @brief Updates a batch of IPv4 leases.
+    ///
+    /// The leases are updated using one context and one transaction.
+    ///
+    /// @param leases The leases to be updated.
+    ///
+    /// @return The leases which were not updated because they do not exist
+    ///         or changed in the database.
+    ///
+    /// @throw isc::db::DbOperationError An operation on the open database has
+    ///        failed. No lease of the batch is updated.
+    virtual Lease4Collection updateLeases4(const Lease4Collection& leases) override;
+
+    /// @brief Updates a batch of IPv6 leases.
+    ///
+    /// See the IPv4 version for details.
+    ///
+    /// @param leases The leases to be updated.
+    ///
+    /// @return The leases which were not updated.
+    ///
+    /// @throw isc::db::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual Lease6Collection updateLeases6(const Lease6Collection& leases) override;
+
+    /// @brief Deletes a batch of IPv4 leases.
+    ///
+    /// The leases are deleted using one context and one transaction.
+    ///
+    /// @param leases The leases to be deleted.
+    ///
+    /// @return The leases which were not deleted because they do not exist.
+    ///
+    /// @throw isc::db::DbOperationError An operation on the open database has
+    ///        failed. No lease of the batch is deleted.
+    virtual Lease4Collection deleteLeases(const Lease4Collection& leases) override;
+
+    /// @brief Deletes a batch of IPv6 leases.
+    ///
+    /// See the IPv4 version for details.
+    ///
+    /// @param leases The leases to be deleted.
+    ///
+    /// @return The leases which were not deleted.
+    ///
+    /// @throw isc::db::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual Lease6Collection deleteLeases(const Lease6Collection& leases) override;
+
     /// @brief Deletes all expired-reclaimed DHCPv4 leases.
     ///
     /// @param secs Number of seconds since expiration of leases before
@@ -766,6 +855,7 @@ public:
         GET_LEASE4_PAGE,             // Get page of leases beginning with an address
         GET_LEASE4_UCTX_PAGE,        // Get page of leases with user context
         GET_LEASE4_SUBID,            // Get IPv4 leases by subnet ID
+        GET_LEASE4_SUBID_PAGE,       // Get page of IPv4 leases by subnet ID
         GET_LEASE4_STATE,            // Get IPv4 leases by state
         GET_LEASE4_STATE_SUBID,      // Get IPv4 leases by state & subnet ID
         GET_LEASE4_HOSTNAME,         // Get IPv4 leases by hostname
@@ -794,6 +884,8 @@ public:
         GET_LEASE6_EXPIRE,           // Get lease6 by expiration.
         INSERT_LEASE4,               // Add entry to lease4 table
         INSERT_LEASE6,               // Add entry to lease6 table
+        INSERT_LEASE4_BATCH,         // Add entry to lease4 table, skip duplicates
+        INSERT_LEASE6_BATCH,         // Add entry to lease6 table, skip duplicates
         UPDATE_LEASE4,               // Update a Lease4 entry
         UPDATE_LEASE6,               // Update a Lease6 entry
         ALL_LEASE4_STATS,            // Fetches IPv4 lease statistics
@@ -871,6 +963,33 @@ private:
                         db::PsqlBindArray& bind_array,
                         bool outputs_row_count = false);
 
+    /// @brief Inserts an IPv4 lease using the given context.
+    ///
+    /// Shared by @c addLease and @c addLeases: callers handle the current
+    /// expiration time and the callbacks.
+    ///
+    /// @param ctx Context
+    /// @param lease The lease to be added.
+    /// @param batch true when the insert is part of a batch transaction
+    /// which must not be aborted by a duplicate.
+    ///
+    /// @return true if the lease was added, false if a lease with the same
+    ///         address already exists.
+    bool addLeaseInternal(PgSqlLeaseContextPtr& ctx, const Lease4Ptr& lease,
+                          bool batch = false);
+
+    /// @brief Inserts an IPv6 lease using the given context.
+    ///
+    /// @param ctx Context
+    /// @param lease The lease to be added.
+    /// @param batch true when the insert is part of a batch transaction
+    /// which must not be aborted by a duplicate.
+    ///
+    /// @return true if the lease was added, false if a lease with the same
+    ///         address already exists.
+    bool addLeaseInternal(PgSqlLeaseContextPtr& ctx, const Lease6Ptr& lease,
+                          bool batch = false);
+
     /// @brief Get Lease Collection Common Code
     ///
     /// This method performs the common actions for obtaining multiple leases
@@ -1020,6 +1139,43 @@ private:
                            const LeasePtr& lease,
                            bool outputs_row_count = false);
 
+    /// @brief Updates an IPv4 lease using the given context.
+    ///
+    /// Shared by @c updateLease4 and @c updateLeases4.
+    ///
+    /// @param ctx Context
+    /// @param lease The lease to be updated.
+    /// @param pipeline When not null the update of a lease which does not
+    /// use the shared free lease queue statements is queued in the pipeline
+    /// and its result is checked by the caller.
+    ///
+    /// @throw NoSuchLease Could not update a lease because no lease matches
+    ///        the address and the expiration time given.
+    void updateLeaseInternal(PgSqlLeaseContextPtr& ctx, const Lease4Ptr& lease,
+                             db::PgSqlPipeline* pipeline = 0);
+
+    /// @brief Updates an IPv6 lease using the given context.
+    ///
+    /// Shared by @c updateLease6 and @c updateLeases6.
+    ///
+    /// @param ctx Context
+    /// @param lease The lease to be updated.
+    /// @param pipeline When not null the update of a lease which does not
+    /// use the shared free lease queue statements is queued in the pipeline
+    /// and its result is checked by the caller.
+    ///
+    /// @throw NoSuchLease Could not update a lease because no lease matches
+    ///        the address and the expiration time given.
+    void updateLeaseInternal(PgSqlLeaseContextPtr& ctx, const Lease6Ptr& lease,
+                             db::PgSqlPipeline* pipeline = 0);
+
+    /// @brief Applies the recorded extended info action of an updated lease.
+    ///
+    /// @param lease The updated lease.
+    /// @param action The action recorded before the update.
+    void updateExtendedInfo6(const Lease6Ptr& lease,
+                             Lease6::ExtendedInfoAction action);
+
     /// @brief Delete lease common code
     ///
     /// Holds the common code for deleting a lease.  It binds the parameters
@@ -1042,6 +1198,34 @@ private:
                                db::PsqlBindArray& bind_array,
                                bool outputs_row_count = false);
 
+    /// @brief Deletes an IPv4 lease using the given context.
+    ///
+    /// Shared by @c deleteLease and @c deleteLeases.
+    ///
+    /// @param ctx Context
+    /// @param lease The lease to be deleted.
+    /// @param pipeline When not null the delete of a lease which does not
+    /// use the shared free lease queue statements is queued in the pipeline
+    /// and its result is checked by the caller.
+    ///
+    /// @return true if the lease was deleted, false if no such lease exists
+    /// or the delete was queued.
+    bool deleteLeaseInternal(PgSqlLeaseContextPtr& ctx, const Lease4Ptr& lease,
+                             db::PgSqlPipeline* pipeline = 0);
+
+    /// @brief Deletes an IPv6 lease using the given context.
+    ///
+    /// @param ctx Context
+    /// @param lease The lease to be deleted.
+    /// @param pipeline When not null the delete of a lease which does not
+    /// use the shared free lease queue statements is queued in the pipeline
+    /// and its result is checked by the caller.
+    ///
+    /// @return true if the lease was deleted, false if no such lease exists
+    /// or the delete was queued.
+    bool deleteLeaseInternal(PgSqlLeaseContextPtr& ctx, const Lease6Ptr& lease,
+                             db::PgSqlPipeline* pipeline = 0);
+
     /// @brief Removes all leases matching subnet ID.
     ///
     /// This rather dangerous method is able to remove all leases from specified
@@ -14,6 +14,9 @@
 #include <dhcpsrv/timer_mgr.h>
 #include <util/multi_threading_mgr.h>
 
+#include <boost/lexical_cast.hpp>
+
+#include <functional>
 #include <iomanip>
 #include <limits>
 #include <sstream>
@@ -41,6 +44,12 @@ PgSqlTaggedStatement tagged_statements[] = {
     { 0,  { 0 }, NULL, NULL}
 };
 
+/// @brief Maximum number of queued records inserted by one statement.
+///
+/// Each record uses 3 parameters and PostgreSQL accepts at most 65535
+/// parameters per statement.
+const size_t MAX_INSERT_ROWS = 1000;
+
 };
 
 namespace isc {
@@ -163,11 +172,29 @@ PgSqlStore::PgSqlStoreContextAlloc::~PgSqlStoreContextAlloc() {
 // PgSqlStore
 
 PgSqlStore::PgSqlStore(const DatabaseConnection::ParameterMap& parameters)
-    : LegalLogMgr(parameters), timer_name_(""), unusable_(false) {
+    : LegalLogMgr(parameters), timer_name_(""), unusable_(false),
+      queue_size_(0), running_(false) {
 
     // Store connection parameters.
     LegalLogMgr::setParameters(parameters);
 
+    if (parameters.count("queue-size")) {
+        int64_t queue_size(0);
+        try {
+            queue_size = boost::lexical_cast<int64_t>(parameters.at("queue-size"));
+        } catch (...) {
+            isc_throw(BadValue, "bad value: " << parameters.at("queue-size")
+                      << " for queue-size parameter");
+        }
+        if ((queue_size < 0) ||
+            (queue_size > numeric_limits<uint32_t>::max())) {
+            isc_throw(OutOfRange, "queue-size value: " << queue_size
+                      << " is out of range, expected value: 0.."
+                      << numeric_limits<uint32_t>::max());
+        }
+        queue_size_ = static_cast<size_t>(queue_size);
+    }
+
     // Create unique timer name per instance.
     timer_name_ = "PgSqlLegalStore[";
     timer_name_ += boost::lexical_cast<std::string>(reinterpret_cast<uint64_t>(this));
@@ -204,6 +231,11 @@ void PgSqlStore::open() {
     // Create an initial context.
     pool_.reset(new PgSqlStoreContextPool());
     pool_->pool_.push_back(createContext());
+
+    if (queue_size_ && !writer_ &&
+        !MultiThreadingMgr::instance().isTestMode()) {
+        startWriter();
+    }
 }
 
 // Create context.
@@ -239,9 +271,11 @@ PgSqlStore::createContext() const {
 }
 
 PgSqlStore::~PgSqlStore() {
+    stopWriter();
 }
 
 void PgSqlStore::close() {
+    stopWriter();
 }
 
 void
@@ -253,6 +287,21 @@ PgSqlStore::writeln(const string& text, const std::string& addr) {
     LOG_DEBUG(pgsql_fb_logger, DB_DBG_TRACE_DETAIL,
               LEGAL_LOG_PGSQL_INSERT_LOG).arg(text);
 
+    if (writer_) {
+        Record record = { now(), addr, text };
+
+        unique_lock<mutex> lock(queue_mutex_);
+        space_cv_.wait(lock, [this]() {
+            return (!running_ || (queue_.size() < queue_size_));
+        });
+        if (running_) {
+            queue_.push_back(std::move(record));
+            queue_cv_.notify_one();
+            return;
+        }
+        // The writer is being stopped: insert the record directly.
+    }
+
     LegalLogDbLogger pushed(pgsql_legal_log_db_logger);
 
     // Get a context
@@ -276,6 +325,114 @@ PgSqlStore::writeln(const string& text, const std::string& addr) {
     }
 }
 
+void
+PgSqlStore::insertRecords(PgSqlStoreContextPtr& ctx,
+                          const vector<Record>& records) {
+    LOG_DEBUG(pgsql_fb_logger, DB_DBG_TRACE_DETAIL,
+              LEGAL_LOG_PGSQL_INSERT_LOGS).arg(records.size());
+
+    LegalLogDbLogger pushed(pgsql_legal_log_db_logger);
+
+    for (size_t first = 0; first < records.size(); first += MAX_INSERT_ROWS) {
+        size_t last = min(first + MAX_INSERT_ROWS, records.size());
+        string sql("INSERT INTO logs(timestamp, address, log) VALUES ");
+        PsqlBindArray bind_array;
+        for (size_t i = first; i < last; ++i) {
+            auto const& record = records[i];
+            size_t param = 3 * (i - first);
+            if (i > first) {
+                sql += ", ";
+            }
+            sql += "(to_timestamp($" + boost::lexical_cast<string>(param + 1);
+            sql += "::double precision), $" + boost::lexical_cast<string>(param + 2);
+            sql += ", $" + boost::lexical_cast<string>(param + 3) + ")";
+
+            ostringstream timestamp;
+            timestamp << record.timestamp_.tv_sec << "."
+                      << setfill('0') << setw(6)
+                      << (record.timestamp_.tv_nsec / 1000);
+            bind_array.addTempString(timestamp.str());
+            bind_array.add(record.addr_);
+            bind_array.add(record.text_);
+        }
+
+        PgSqlTaggedStatement statement = {
+            static_cast<int>(bind_array.size()), { OID_NONE },
+            "insert_logs", sql.c_str()
+        };
+        PgSqlResult r(PQexecParams(ctx->conn_, sql.c_str(),
+                                   statement.nbparams, 0,
+                                   &bind_array.values_[0],
+                                   &bind_array.lengths_[0],
+                                   &bind_array.formats_[0], 0));
+
+        int s = PQresultStatus(r);
+
+        if (s != PGRES_COMMAND_OK) {
+            ctx->conn_.checkStatementError(r, statement);
+        }
+    }
+}
+
+void
+PgSqlStore::startWriter() {
+    writer_ctx_ = createContext();
+    {
+        lock_guard<mutex> lock(queue_mutex_);
+        running_ = true;
+    }
+    queue_.reserve(queue_size_);
+    writer_.reset(new thread(std::bind(&PgSqlStore::run, this)));
+}
+
+void
+PgSqlStore::stopWriter() {
+    if (!writer_) {
+        return;
+    }
+    {
+        lock_guard<mutex> lock(queue_mutex_);
+        running_ = false;
+    }
+    queue_cv_.notify_all();
+    space_cv_.notify_all();
+    writer_->join();
+    writer_.reset();
+    writer_ctx_.reset();
+}
+
+void
+PgSqlStore::run() {
+    vector<Record> records;
+    records.reserve(queue_size_);
+    for (;;) {
+        {
+            unique_lock<mutex> lock(queue_mutex_);
+            queue_cv_.wait(lock, [this]() {
+                return (!running_ || !queue_.empty());
+            });
+            if (queue_.empty()) {
+                // Stopped and all records inserted.
+                return;
+            }
+            records.swap(queue_);
+        }
+        space_cv_.notify_all();
+
+        try {
+            insertRecords(writer_ctx_, records);
+        } catch (const exception& ex) {
+            LOG_ERROR(pgsql_fb_logger, LEGAL_LOG_PGSQL_WRITE_ERROR)
+                .arg(records.size()).arg(ex.what());
+        }
+        if (writer_ctx_->conn_.isUnusable()) {
+            lock_guard<mutex> lock(pool_->mutex_);
+            unusable_ = true;
+        }
+        records.clear();
+    }
+}
+
 pair<uint32_t, uint32_t>
 PgSqlStore::getVersion(const std::string& timer_name) const {
     LOG_DEBUG(pgsql_fb_logger, DB_DBG_TRACE_DETAIL,
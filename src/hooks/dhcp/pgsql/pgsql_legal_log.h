@@ -13,10 +13,15 @@
 #include <util/reconnect_ctl.h>
 
 #include <boost/scoped_ptr.hpp>
+#include <boost/shared_ptr.hpp>
 
+#include <condition_variable>
 #include <mutex>
+#include <thread>
 #include <vector>
 
+#include <time.h>
+
 namespace isc {
 namespace dhcp {
 
@@ -81,6 +86,19 @@ typedef boost::shared_ptr<PgSqlStoreContextPool> PgSqlStoreContextPoolPtr;
 /// interface to the PostgreSQL database. Use of this backend presupposes
 /// that a PostgreSQL database is available and that the Kea legal log
 /// schema has been created within it.
+///
+/// When the queue size is not zero, writeln() only appends the record,
+/// with the time of the call, to a bounded queue. A background thread
+/// started by open() takes all queued records at once and inserts them
+/// with a single multi-row INSERT statement using its own connection.
+/// When the queue is full the callers wait for the writer: records are
+/// never dropped. close() inserts all queued records before returning.
+///
+/// @note The queue is protected by a mutex with two condition variables
+/// rather than being lock-free: callers hold the mutex only to append a
+/// record and the writer only to swap the whole queue, so the contention
+/// is negligible compared to a database round trip, and the callers need
+/// to block when the queue is full anyway.
 class PgSqlStore : public LegalLogMgr {
 public:
 
@@ -104,11 +122,14 @@ public:
     ///       - retry-on-startup
     ///       - connect-timeout
     ///       - tcp-user-timeout (PostgreSQL only)
+    /// - queue-size: the maximum number of records waiting to be inserted
+    ///   by the background writer (0, the default, disables it).
     ///
     /// @param parameters A data structure relating keywords and values
     ///        concerned with the database.
     ///
     /// @throw isc::db::NoDatabaseName Mandatory database name not given
+    /// @throw BadValue or OutOfRange if the queue size is invalid.
     PgSqlStore(const isc::db::DatabaseConnection::ParameterMap& parameters);
 
     /// @brief Destructor (calls close())
@@ -140,7 +161,8 @@ public:
     /// legal_logschema_version table will be checked against hard-coded
     /// value in the implementation file.
     ///
-    /// Finally, all the SQL commands are pre-compiled.
+    /// Finally, all the SQL commands are pre-compiled and the background
+    /// writer is started when it is enabled.
     ///
     /// @throw isc::db::DbOpenError Error opening the database
     /// @throw isc::db::DbOperationError An operation on the open
@@ -148,10 +170,16 @@ public:
     virtual void open();
 
     /// @brief Closes the store.
+    ///
+    /// Stops the background writer after it has inserted all queued
+    /// records.
     virtual void close();
 
     /// @brief Stores the string with a timestamp.
     ///
+    /// When the background writer is running the record is queued and
+    /// insert errors are logged by the writer instead of being thrown.
+    ///
     /// @param addr Address or prefix (ignored)
     /// @param text String to store
     /// @throw LegalLogMgrError if the write fails
@@ -179,6 +207,13 @@ public:
     /// @brief Local version of getDBVersion() class method
     static std::string getDBVersion();
 
+    /// @brief Returns the maximum number of queued records.
+    ///
+    /// @return The queue size (0 when the background writer is disabled).
+    size_t getQueueSize() const {
+        return (queue_size_);
+    }
+
     /// @brief Statement Tags
     ///
     /// The contents of the enum are indexes into the list of compiled SQL
@@ -222,6 +257,41 @@ public:
 
 private:
 
+    /// @brief A queued log record.
+    struct Record {
+        /// @brief The time of the call to writeln.
+        struct timespec timestamp_;
+
+        /// @brief Address or prefix.
+        std::string addr_;
+
+        /// @brief The log text.
+        std::string text_;
+    };
+
+    /// @brief Inserts records with a single multi-row INSERT statement.
+    ///
+    /// The timestamps are given explicitly so the records keep the
+    /// time of the logged events.
+    ///
+    /// @param ctx The context of the background writer.
+    /// @param records The records to insert.
+    ///
+    /// @throw isc::db::DbOperationError if the insert fails.
+    void insertRecords(PgSqlStoreContextPtr& ctx,
+                       const std::vector<Record>& records);
+
+    /// @brief Starts the background writer.
+    void startWriter();
+
+    /// @brief Stops the background writer.
+    ///
+    /// Waits for the writer to insert all queued records.
+    void stopWriter();
+
+    /// @brief Background writer thread function.
+    void run();
+
     /// @brief Timer name used to register database reconnect timer.
     std::string timer_name_;
 
@@ -232,6 +302,32 @@ private:
     /// be used for normal operations.
     bool unusable_;
 
+    /// @brief The maximum number of queued records.
+    ///
+    /// @note 0 means the background writer is disabled.
+    size_t queue_size_;
+
+    /// @brief Records waiting to be inserted.
+    std::vector<Record> queue_;
+
+    /// @brief Mutex to protect the queue and the running flag.
+    std::mutex queue_mutex_;
+
+    /// @brief Condition variable signaled when records are queued.
+    std::condition_variable queue_cv_;
+
+    /// @brief Condition variable signaled when the queue is emptied.
+    std::condition_variable space_cv_;
+
+    /// @brief The background writer running flag.
+    bool running_;
+
+    /// @brief The context used by the background writer.
+    PgSqlStoreContextPtr writer_ctx_;
+
+    /// @brief The background writer thread.
+    boost::shared_ptr<std::thread> writer_;
+
 public:
     /// @brief Factory class method.
     ///
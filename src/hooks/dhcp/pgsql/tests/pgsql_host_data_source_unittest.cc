@@ -756,6 +756,19 @@ TEST_F(PgSqlHostDataSourceTest, get4ByCircuitIdMultiThreading) {
     testGet4ByIdentifier(Host::IDENT_CIRCUIT_ID);
 }
 
+/// @brief Test verifies if host reservations can be retrieved by several
+/// identifiers at once.
+TEST_F(PgSqlHostDataSourceTest, getByIdentifiers) {
+    testGetByIdentifiers();
+}
+
+/// @brief Test verifies if host reservations can be retrieved by several
+/// identifiers at once.
+TEST_F(PgSqlHostDataSourceTest, getByIdentifiersMultiThreading) {
+    MultiThreadingTest mt(true);
+    testGetByIdentifiers();
+}
+
 /// @brief Test verifies if a host reservation can be added and later retrieved by
 /// client-id.
 TEST_F(PgSqlHostDataSourceTest, get4ByClientId) {
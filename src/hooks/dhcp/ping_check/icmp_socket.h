@@ -1,4 +1,4 @@
-// Copyright (C) 2023-2025 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2023-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -112,6 +112,16 @@ public:
     virtual void asyncSend(const void* data, size_t length,
                            const asiolink::IOEndpoint* endpoint, C& callback);
 
+    /// @brief Wait Asynchronously For Send
+    ///
+    /// Calls the underlying socket's async_wait() method to wait until
+    /// the socket can send data.  The callback will be called on
+    /// completion with a zero length.  It is used by callers writing
+    /// directly to the native socket.
+    ///
+    /// @param callback Callback object.
+    virtual void asyncWaitSend(C& callback);
+
     /// @brief Receive Asynchronously
     ///
     /// Calls the underlying socket's async_receive_from() method to read a
@@ -264,6 +274,19 @@ ICMPSocket<C>::asyncSend(const void* data, size_t length,
     }
 }
 
+// Wait until the socket can send.  Should never do this if the socket is not
+// open, so throw an exception if this is the case.
+
+template <typename C> void
+ICMPSocket<C>::asyncWaitSend(C& callback) {
+    if (isopen_) {
+        socket_.async_wait(boost::asio::socket_base::wait_write, callback);
+    } else {
+        isc_throw(asiolink::SocketNotOpen,
+            "attempt to wait for send on a ICMP socket that is not open");
+    }
+}
+
 // Receive a message.   Should never do this if the socket is not open, so throw
 // an exception if this is the case.
 
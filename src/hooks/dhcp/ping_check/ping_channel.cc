@@ -1,4 +1,4 @@
-// Copyright (C) 2023-2025 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2023-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -10,6 +10,15 @@
 #include <dhcp/iface_mgr.h>
 #include <exceptions/exceptions.h>
 #include <util/multi_threading_mgr.h>
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+#if defined(OS_LINUX)
+#include <linux/filter.h>
+#endif
+
+#include <cerrno>
+#include <cstring>
 #include <iostream>
 
 using namespace isc;
@@ -47,7 +56,8 @@ PingChannel::PingChannel(IOServicePtr& io_service,
       reply_received_cb_(reply_received_cb),
       shutdown_cb_(shutdown_cb),
       socket_(0), input_buf_(256),
-      reading_(false), sending_(false), stopping_(false), mutex_(new std::mutex),
+      reading_(false), sending_(false), stopping_(false), batch_size_(1),
+      send_only_(false), mutex_(new std::mutex),
       send_mutex_(new std::mutex), single_threaded_(!MultiThreadingMgr::instance().getMode()),
       watch_socket_(0), registered_write_fd_(-1), registered_read_fd_(-1) {
     if (!io_service_) {
@@ -60,6 +70,20 @@ PingChannel::~PingChannel() {
     close();
 }
 
+void
+PingChannel::setBatchSize(size_t batch_size) {
+    if (batch_size == 0) {
+        isc_throw(BadValue, "PingChannel::setBatchSize - batch size cannot be 0");
+    }
+
+#ifdef HAVE_SENDMMSG
+    batch_size_ = batch_size;
+#else
+    // Batches are sent with sendmmsg().
+    batch_size_ = 1;
+#endif
+}
+
 void
 PingChannel::open() {
     try {
@@ -84,6 +108,20 @@ PingChannel::open() {
         sending_ = false;
         stopping_ = false;
 
+#if defined(OS_LINUX)
+        if (send_only_) {
+            // Replies are read by another channel: have the kernel drop the
+            // ICMP messages queued to this socket.
+            struct sock_filter drop_all = BPF_STMT(BPF_RET | BPF_K, 0);
+            struct sock_fprog program = { 1, &drop_all };
+            if (setsockopt(socket_->getNative(), SOL_SOCKET, SO_ATTACH_FILTER,
+                           &program, sizeof(program)) < 0) {
+                isc_throw(Unexpected, "failed to attach the drop filter: "
+                          << strerror(errno));
+            }
+        }
+#endif
+
         if (single_threaded_) {
             // Open new watch socket.
             watch_socket_.reset(new util::WatchSocket());
@@ -93,8 +131,10 @@ PingChannel::open() {
             IfaceMgr::instance().addExternalSocket(registered_write_fd_, IfaceMgr::SocketCallback());
 
             // Register ICMPSocket with IfaceMgr to signal data ready to read.
-            registered_read_fd_ = socket_->getNative();
-            IfaceMgr::instance().addExternalSocket(registered_read_fd_, IfaceMgr::SocketCallback());
+            if (!send_only_) {
+                registered_read_fd_ = socket_->getNative();
+                IfaceMgr::instance().addExternalSocket(registered_read_fd_, IfaceMgr::SocketCallback());
+            }
         }
 
     } catch (const std::exception& ex) {
@@ -193,6 +233,48 @@ PingChannel::asyncSend(void* data, size_t length, asiolink::IOEndpoint* endpoint
     }
 }
 
+void
+PingChannel::asyncWaitSend(SocketCallback& callback) {
+    socket_->asyncWaitSend(callback);
+
+    if (single_threaded_) {
+        // Set IO ready marker so sender activity is visible to select() or poll().
+        watch_socket_->markReady();
+    }
+}
+
+int
+PingChannel::sendBatch(const ICMPMsgBatch& batch, size_t offset) {
+#ifdef HAVE_SENDMMSG
+    size_t const count = batch.size() - offset;
+    std::vector<ICMPPtr> packed(count);
+    std::vector<struct sockaddr_in> addrs(count);
+    std::vector<struct iovec> iovs(count);
+    std::vector<struct mmsghdr> msgs(count);
+    for (size_t i = 0; i < count; ++i) {
+        const ICMPMsgPtr& echo = batch[offset + i];
+        packed[i] = echo->pack();
+        memset(&addrs[i], 0, sizeof(addrs[i]));
+        addrs[i].sin_family = AF_INET;
+        addrs[i].sin_addr.s_addr = htonl(echo->getDestination().toUint32());
+        iovs[i].iov_base = packed[i].get();
+        iovs[i].iov_len = sizeof(struct icmp);
+        memset(&msgs[i], 0, sizeof(msgs[i]));
+        msgs[i].msg_hdr.msg_name = &addrs[i];
+        msgs[i].msg_hdr.msg_namelen = sizeof(addrs[i]);
+        msgs[i].msg_hdr.msg_iov = &iovs[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    return (sendmmsg(socket_->getNative(), msgs.data(), count, MSG_DONTWAIT));
+#else
+    static_cast<void>(batch);
+    static_cast<void>(offset);
+    errno = ENOTSUP;
+    return (-1);
+#endif
+}
+
 void
 PingChannel::doRead() {
     try {
@@ -323,34 +405,49 @@ PingChannel::sendNext() {
         // with this mutex locked.
         MultiThreadingLock send_lock(*send_mutex_);
 
-        // Fetch the next one to send (outside the mutex) to avoid a possible
-        // deadlock with the mutex in the @ref PingCheckMgr::nextToSend callback.
-        PingContextPtr context = ((next_to_send_cb_)());
-        if (!context) {
-            // Nothing to send.
-            return;
+        ICMPMsgBatchPtr batch(new ICMPMsgBatch());
+        while (batch->size() < batch_size_) {
+            // Fetch the next one to send (outside the mutex) to avoid a possible
+            // deadlock with the mutex in the @ref PingCheckMgr::nextToSend callback.
+            PingContextPtr context = ((next_to_send_cb_)());
+            if (!context) {
+                // Nothing (more) to send.
+                break;
+            }
+
+            MultiThreadingLock lock(*mutex_);
+            if (batch->empty() ? !canSend() : stopping_) {
+                // Can't send right now, get out.
+                break;
+            }
+
+            // Update context to SENDING (inside the mutex).
+            if (update_to_send_cb_) {
+                (update_to_send_cb_)(context);
+            }
+
+            // Have an target IP, build an ECHO REQUEST for it.
+            sending_ = true;
+            batch->push_back(createEcho(context->getTarget()));
         }
 
-        MultiThreadingLock lock(*mutex_);
-        if (!canSend()) {
-            // Can't send right now, get out.
+        if (batch->empty()) {
             return;
         }
 
-        // Update context to SENDING (inside the mutex).
-        if (update_to_send_cb_) {
-            (update_to_send_cb_)(context);
+        MultiThreadingLock lock(*mutex_);
+        if (batch->size() > 1) {
+            // Send the batch at once when the socket is writable.
+            SocketCallback cb(std::bind(&PingChannel::socketBatchWriteCallback,
+                                        shared_from_this(),
+                                        batch,
+                                        0,
+                                        ph::_1)); // error
+            asyncWaitSend(cb);
+            return;
         }
 
-        // Have an target IP, build an ECHO REQUEST for it.
-        sending_ = true;
-        ICMPMsgPtr next_echo(new ICMPMsg());
-        next_echo->setType(ICMPMsg::ECHO_REQUEST);
-        next_echo->setDestination(context->getTarget());
-
-        uint32_t instance_num = nextEchoInstanceNum();
-        next_echo->setId(static_cast<uint16_t>(instance_num >> 16));
-        next_echo->setSequence(static_cast<uint16_t>(instance_num & 0x0000FFFF));
+        ICMPMsgPtr next_echo = batch->front();
 
         // Get packed wire-form.
         ICMPPtr echo_icmp = next_echo->pack();
@@ -364,7 +461,7 @@ PingChannel::sendNext() {
                                     ph::_1,   // error
                                     ph::_2)); // bytes_transferred
 
-        ICMPEndpoint target_endpoint(context->getTarget());
+        ICMPEndpoint target_endpoint(next_echo->getDestination());
         asyncSend(echo_icmp.get(), sizeof(struct icmp), &target_endpoint, cb);
     } catch (const std::exception& ex) {
         // Normal IO failures should be passed to the callback.  A failure here
@@ -376,6 +473,18 @@ PingChannel::sendNext() {
     }
 }
 
+ICMPMsgPtr
+PingChannel::createEcho(const IOAddress& target) {
+    ICMPMsgPtr next_echo(new ICMPMsg());
+    next_echo->setType(ICMPMsg::ECHO_REQUEST);
+    next_echo->setDestination(target);
+
+    uint32_t instance_num = nextEchoInstanceNum();
+    next_echo->setId(static_cast<uint16_t>(instance_num >> 16));
+    next_echo->setSequence(static_cast<uint16_t>(instance_num & 0x0000FFFF));
+    return (next_echo);
+}
+
 void
 PingChannel::socketWriteCallback(ICMPMsgPtr echo, boost::system::error_code ec,
                                  size_t length) {
@@ -386,31 +495,124 @@ PingChannel::socketWriteCallback(ICMPMsgPtr echo, boost::system::error_code ec,
         }
     }
 
-    if (single_threaded_) {
-        try {
-            // Clear the IO ready marker.
-            watch_socket_->clearReady();
-        } catch (const std::exception& ex) {
-            // This can only happen if the WatchSocket's select_fd has been
-            // compromised which is a programmatic error. We'll log the error
-            // here, then continue on and process the IO result we were given.
-            // WatchSocket issue will resurface on the next send as a closed
-            // fd in markReady() rather than fail out of this callback.
-            LOG_ERROR(ping_check_logger, PING_CHECK_CHANNEL_WATCH_SOCKET_CLEAR_ERROR)
-                     .arg(ex.what());
+    clearWatchSocket();
+
+    bool send_failed = false;
+    if (!checkWriteError(ec, length, send_failed)) {
+        return;
+    }
+
+    {
+        MultiThreadingLock lock(*mutex_);
+        sending_ = false;
+    }
+
+    echoWritten(echo, ec, length, send_failed);
+
+    // Schedule the next send.
+    sendNext();
+}
+
+void
+PingChannel::socketBatchWriteCallback(ICMPMsgBatchPtr batch, size_t offset,
+                                      boost::system::error_code ec) {
+    {
+        MultiThreadingLock lock(*mutex_);
+        if (stopping_) {
+            return;
         }
     }
 
+    clearWatchSocket();
+
+    if (ec) {
+        if (ec.value() == boost::asio::error::operation_aborted) {
+            // IO service has been stopped and the connection is probably
+            // going to be shutting down.
+            return;
+        }
+
+        // Anything else is fatal for the socket.
+        LOG_ERROR(ping_check_logger, PING_CHECK_CHANNEL_SOCKET_WRITE_FAILED)
+            .arg(ec.message());
+        stopChannel();
+        return;
+    }
+
+    while (offset < batch->size()) {
+        int sent = sendBatch(*batch, offset);
+        if (sent > 0) {
+            for (int i = 0; i < sent; ++i) {
+                echoWritten((*batch)[offset + i], ec, sizeof(struct icmp), false);
+            }
+
+            offset += sent;
+            continue;
+        }
+
+        int const error = errno;
+        if (error == EINTR) {
+            continue;
+        }
+
+        if ((error == EAGAIN) || (error == EWOULDBLOCK)) {
+            // The socket buffer is full: wait for the socket to be
+            // writable again to send the rest of the batch.
+            try {
+                MultiThreadingLock lock(*mutex_);
+                if (stopping_) {
+                    return;
+                }
+
+                SocketCallback cb(std::bind(&PingChannel::socketBatchWriteCallback,
+                                            shared_from_this(),
+                                            batch,
+                                            offset,
+                                            ph::_1)); // error
+                asyncWaitSend(cb);
+            } catch (const std::exception& ex) {
+                LOG_ERROR(ping_check_logger, PING_CHECK_UNEXPECTED_WRITE_ERROR)
+                    .arg(ex.what());
+                stopChannel();
+            }
+
+            return;
+        }
+
+        // The first ECHO REQUEST not yet sent failed.
+        boost::system::error_code send_ec(error, boost::system::system_category());
+        size_t length = 0;
+        bool send_failed = false;
+        if (!checkWriteError(send_ec, length, send_failed)) {
+            return;
+        }
+
+        echoWritten((*batch)[offset], send_ec, length, send_failed);
+        ++offset;
+    }
+
+    {
+        MultiThreadingLock lock(*mutex_);
+        sending_ = false;
+    }
+
+    // Schedule the next send.
+    sendNext();
+}
+
+bool
+PingChannel::checkWriteError(const boost::system::error_code& ec, size_t& length,
+                             bool& send_failed) {
     // Handle an error. Note we can't use a case statement as some values
     // on some OSes are the same (e.g. try_again and would_block) which causes
     // duplicate case compilation errors.
-    bool send_failed = false;
+    send_failed = false;
     if (ec) {
         auto error_value = ec.value();
         if (error_value == boost::asio::error::operation_aborted) {
             // IO service has been stopped and the connection is probably
             // going to be shutting down.
-            return;
+            return (false);
         } else if ((error_value == boost::asio::error::try_again) ||
                     (error_value == boost::asio::error::would_block)) {
             // We got EWOULDBLOCK or EAGAIN which indicates that we may be able to
@@ -435,15 +637,16 @@ PingChannel::socketWriteCallback(ICMPMsgPtr echo, boost::system::error_code ec,
             LOG_ERROR(ping_check_logger, PING_CHECK_CHANNEL_SOCKET_WRITE_FAILED)
                 .arg(ec.message());
             stopChannel();
-            return;
+            return (false);
         }
     }
 
-    {
-        MultiThreadingLock lock(*mutex_);
-        sending_ = false;
-    }
+    return (true);
+}
 
+void
+PingChannel::echoWritten(ICMPMsgPtr& echo, const boost::system::error_code& ec,
+                         size_t length, bool send_failed) {
     if (send_failed) {
         // Invoke the callback with send failed.  This instructs the manager
         // to treat the address as free to use.
@@ -461,9 +664,24 @@ PingChannel::socketWriteCallback(ICMPMsgPtr echo, boost::system::error_code ec,
         // Invoke the send completed callback.
         (echo_sent_cb_)(echo, false);
     }
+}
 
-    // Schedule the next send.
-    sendNext();
+void
+PingChannel::clearWatchSocket() {
+    if (single_threaded_) {
+        try {
+            // Clear the IO ready marker.
+            watch_socket_->clearReady();
+        } catch (const std::exception& ex) {
+            // This can only happen if the WatchSocket's select_fd has been
+            // compromised which is a programmatic error. We'll log the error
+            // here, then continue on and process the IO result we were given.
+            // WatchSocket issue will resurface on the next send as a closed
+            // fd in markReady() rather than fail out of this callback.
+            LOG_ERROR(ping_check_logger, PING_CHECK_CHANNEL_WATCH_SOCKET_CLEAR_ERROR)
+                     .arg(ex.what());
+        }
+    }
 }
 
 size_t
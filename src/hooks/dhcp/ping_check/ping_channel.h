@@ -1,4 +1,4 @@
-// Copyright (C) 2023-2025 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2023-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -20,6 +20,7 @@
 
 #include <iostream>
 #include <mutex>
+#include <vector>
 
 namespace isc {
 namespace ping_check {
@@ -67,6 +68,12 @@ typedef ICMPSocket<SocketCallback> PingSocket;
 /// @brief Defines a pointer to PingSocket.
 typedef boost::shared_ptr<PingSocket> PingSocketPtr;
 
+/// @brief Type for a batch of ECHO REQUESTs.
+typedef std::vector<ICMPMsgPtr> ICMPMsgBatch;
+
+/// @brief Type for a pointer to a batch of ECHO REQUESTs.
+typedef boost::shared_ptr<ICMPMsgBatch> ICMPMsgBatchPtr;
+
 /// @brief Function type for callback to fetch a context with next target to ping.
 typedef std::function<PingContextPtr()> NextToSendCallback;
 
@@ -101,6 +108,13 @@ typedef std::function<void()> ShutdownCallback;
 /// to control the channel (e.g. open the channel, initiate reading, initiate
 /// writing, and close the channel).
 ///
+/// When the batch size is greater than one and there are several targets
+/// waiting, the channel fetches up to batch size targets and sends their
+/// ECHO REQUESTs with a single sendmmsg() call once the socket is writable.
+///
+/// A send-only channel does not read: another channel reads the replies
+/// which are delivered to all ICMP sockets.
+///
 /// @note Callbacks handlers must be thread-safe if the channel is
 /// driven by an IOServiceThreadPool.
 ///
@@ -170,6 +184,38 @@ public:
         return (io_service_);
     }
 
+    /// @brief Sets the maximum number of ECHO REQUESTs sent at once.
+    ///
+    /// Must be called before the channel is opened. Without sendmmsg()
+    /// support the batch size is always 1.
+    ///
+    /// @param batch_size new batch size.
+    /// @throw BadValue if the batch size is 0.
+    void setBatchSize(size_t batch_size);
+
+    /// @brief Fetches the maximum number of ECHO REQUESTs sent at once.
+    ///
+    /// @return the batch size.
+    size_t getBatchSize() const {
+        return (batch_size_);
+    }
+
+    /// @brief Sets the send-only flag.
+    ///
+    /// Must be called before the channel is opened.
+    ///
+    /// @param send_only true if the channel must not read replies.
+    void setSendOnly(bool send_only) {
+        send_only_ = send_only;
+    }
+
+    /// @brief Indicates whether or not the channel is send-only.
+    ///
+    /// @return true if the channel does not read replies.
+    bool isSendOnly() const {
+        return (send_only_);
+    }
+
 protected:
     /// @brief Receive data on the socket asynchronously
     ///
@@ -204,6 +250,30 @@ protected:
     virtual void asyncSend(void* data, size_t length, asiolink::IOEndpoint* endpoint,
                           SocketCallback& callback);
 
+    /// @brief Wait asynchronously until the socket can send
+    ///
+    /// Calls the underlying socket's asyncWaitSend() method.  The socket
+    /// being writable is signaled via a call to the callback function.
+    ///
+    /// This virtual function is provided as means to inject errors during
+    /// batch write operations to facilitate testing.
+    ///
+    /// @param callback callback object
+    virtual void asyncWaitSend(SocketCallback& callback);
+
+    /// @brief Send ECHO REQUESTs of a batch with a single system call
+    ///
+    /// Calls sendmmsg() without blocking on the socket.
+    ///
+    /// This virtual function is provided as means to inject errors during
+    /// batch write operations to facilitate testing.
+    ///
+    /// @param batch batch of ECHO REQUESTs
+    /// @param offset index of the first ECHO REQUEST to send
+    ///
+    /// @return number of ECHO REQUESTs sent or -1 with errno set on error.
+    virtual int sendBatch(const ICMPMsgBatch& batch, size_t offset);
+
 protected:
     /// @brief Initiates an asynchronous socket read.
     ///
@@ -233,18 +303,32 @@ protected:
     /// @param length number of bytes read
     void socketReadCallback(boost::system::error_code ec, size_t length);
 
-    /// @brief Initiates sending the next ECHO REQUEST
+    /// @brief Initiates sending the next ECHO REQUESTs
     ///
     /// If the channel is able to send (i.e is open, not stopping and not
     /// currently writing):
-    /// -# Invoke next to send callback to fetch the next target IP address
+    /// -# Invoke next to send callback to fetch the next target IP address,
+    /// up to batch size times
     /// -# If there is no next target, return
-    /// -# Construct the ECHO REQUEST for the target and pack it into wire form
-    /// -# Begin sending the request by passing to @c PingSocket::asyncSend()
-    /// -# If the asyncSend() call fails shutdown the channel, otherwise when
+    /// -# Construct the ECHO REQUESTs for the targets
+    /// -# For a single ECHO REQUEST, pack it into wire form and begin
+    /// sending the request by passing to @c PingSocket::asyncSend(), when
     /// it completes it invokes @c socketWriteCallback().
+    /// -# For several ECHO REQUESTs, wait for the socket to be writable by
+    /// calling @c PingSocket::asyncWaitSend(), when it completes it invokes
+    /// @c socketBatchWriteCallback().
+    /// -# If the call fails shutdown the channel.
     virtual void sendNext();
 
+    /// @brief Creates the next ECHO REQUEST for a target
+    ///
+    /// Must be called in a thread-safe context
+    ///
+    /// @param target target address
+    ///
+    /// @return the ECHO REQUEST.
+    ICMPMsgPtr createEcho(const asiolink::IOAddress& target);
+
     /// @brief Socket write completion callback
     ///
     /// Invoked when PingSocket::asyncWrite() completes.
@@ -266,6 +350,55 @@ protected:
     void socketWriteCallback(ICMPMsgPtr echo_sent, boost::system::error_code ec,
                              size_t length);
 
+    /// @brief Socket writable callback for batches
+    ///
+    /// Invoked when PingSocket::asyncWaitSend() completes.
+    /// Upon success, sends the ECHO REQUESTs not yet sent of the batch
+    /// with @c sendBatch():
+    ///
+    /// -# Pass each ECHO REQUEST to echo sent callback
+    /// -# If the socket buffer is full, wait again for the socket to be
+    /// writable
+    /// -# Otherwise start next write
+    ///
+    /// Errors on an ECHO REQUEST are handled as in @c socketWriteCallback().
+    ///
+    /// @param batch batch of ECHO REQUESTs
+    /// @param offset index of the first ECHO REQUEST not yet sent
+    /// @param ec error code indicating either success or the error encountered
+    void socketBatchWriteCallback(ICMPMsgBatchPtr batch, size_t offset,
+                                  boost::system::error_code ec);
+
+    /// @brief Checks the error of an ECHO REQUEST write
+    ///
+    /// -# Operation aborted: socket is shutting down, return false
+    /// -# Operation would block/try again: set length to zero
+    /// -# Network errors: set send failed
+    /// -# Any other error, shut down the channel and return false
+    ///
+    /// @param ec error code of the write
+    /// @param[out] length number of bytes written
+    /// @param[out] send_failed set to true when the write failed with a
+    /// non-fatal error
+    ///
+    /// @return false if the channel must stop writing.
+    bool checkWriteError(const boost::system::error_code& ec, size_t& length,
+                         bool& send_failed);
+
+    /// @brief Invokes the echo sent callback after an ECHO REQUEST write
+    ///
+    /// @param echo_sent ECHO REQUEST that was written (or attempted to be
+    /// written)
+    /// @param ec error code of the write
+    /// @param length number of bytes written
+    /// @param send_failed true when the write failed with a non-fatal error
+    void echoWritten(ICMPMsgPtr& echo_sent, const boost::system::error_code& ec,
+                     size_t length, bool send_failed);
+
+    /// @brief Clears the IO ready marker of the watch socket
+    ///
+    /// Does nothing when the channel is not single-threaded.
+    void clearWatchSocket();
     /// @brief Closes the socket channel and invokes the shutdown callback.
     ///
     /// This function is invoked to notify the calling layer that the socket
@@ -298,10 +431,11 @@ protected:
     ///
     /// Must be called in a thread-safe context
     ///
-    /// @return True if the socket is open, is not attempting to stop, and is
-    /// not currently reading.
+    /// @return True if the socket is open, is not attempting to stop, is
+    /// not currently reading and the channel is not send-only.
     bool canRead() {
-        return (socket_ && socket_->isOpen() && !stopping_ && !reading_);
+        return (socket_ && socket_->isOpen() && !stopping_ && !reading_ &&
+                !send_only_);
     }
 
     /// @brief Returns input buffer size.
@@ -355,6 +489,12 @@ protected:
     /// @brief Indicates whether or not the channel has been told to stop.
     bool stopping_;
 
+    /// @brief Maximum number of ECHO REQUESTs sent at once.
+    size_t batch_size_;
+
+    /// @brief Indicates whether or not the channel does not read replies.
+    bool send_only_;
+
     /// @brief The mutex used to protect internal state.
     const boost::scoped_ptr<std::mutex> mutex_;
 
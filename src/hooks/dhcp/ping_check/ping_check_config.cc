@@ -1,4 +1,4 @@
-// Copyright (C) 2023-2025 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2023-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -22,7 +22,10 @@ PingCheckConfig::CONFIG_KEYWORDS =
     { "min-ping-requests",      Element::integer },
     { "reply-timeout",          Element::integer },
     { "ping-cltt-secs",         Element::integer},
-    { "ping-channel-threads",   Element::integer}
+    { "ping-channel-threads",   Element::integer},
+    { "ping-channels",          Element::integer},
+    { "ping-batch-size",        Element::integer},
+    { "ping-free-cache-secs",   Element::integer}
 };
 
 PingCheckConfig::PingCheckConfig() :
@@ -30,7 +33,10 @@ PingCheckConfig::PingCheckConfig() :
     min_ping_requests_(1),
     reply_timeout_(100),
     ping_cltt_secs_(60),
-    ping_channel_threads_(0) {
+    ping_channel_threads_(0),
+    ping_channels_(1),
+    ping_batch_size_(1),
+    ping_free_cache_secs_(0) {
 }
 
 void
@@ -90,6 +96,39 @@ PingCheckConfig::parse(data::ConstElementPtr config) {
         local.setPingChannelThreads(static_cast<size_t>(val));
     }
 
+    value = config->get("ping-channels");
+    if (value) {
+        int64_t val = value->intValue();
+        if (val <= 0) {
+            isc_throw(DhcpConfigError, "invalid ping-channels: '"
+                      << val << "', must be greater than 0");
+        }
+
+        local.setPingChannels(static_cast<size_t>(val));
+    }
+
+    value = config->get("ping-batch-size");
+    if (value) {
+        int64_t val = value->intValue();
+        if ((val <= 0) || (val > MAX_BATCH_SIZE)) {
+            isc_throw(DhcpConfigError, "invalid ping-batch-size: '"
+                      << val << "', must be between 1 and " << MAX_BATCH_SIZE);
+        }
+
+        local.setPingBatchSize(static_cast<size_t>(val));
+    }
+
+    value = config->get("ping-free-cache-secs");
+    if (value) {
+        int64_t val = value->intValue();
+        if (val < 0) {
+            isc_throw(DhcpConfigError, "invalid ping-free-cache-secs: '"
+                      << val << "', cannot be less than 0");
+        }
+
+        local.setPingFreeCacheSecs(static_cast<size_t>(val));
+    }
+
     // All values good, copy from local instance.
     *this = local;
 }
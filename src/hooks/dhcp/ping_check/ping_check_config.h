@@ -1,4 +1,4 @@
-// Copyright (C) 2023-2025 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2023-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -20,6 +20,9 @@ public:
     /// @brief List of valid parameters and expected types.
     static const data::SimpleKeywords CONFIG_KEYWORDS;
 
+    /// @brief Maximum value of ping-batch-size.
+    static const int64_t MAX_BATCH_SIZE = 1024;
+
     /// @brief Constructor
     PingCheckConfig();
 
@@ -103,6 +106,48 @@ public:
         ping_channel_threads_ = value;
     }
 
+    /// @brief Fetches the value of ping-channels
+    ///
+    /// @return integer value of ping-channels
+    uint32_t getPingChannels() const {
+        return (ping_channels_);
+    }
+
+    /// @brief Sets the value of ping-channels
+    ///
+    /// @param value new value for ping-channels
+    void setPingChannels(uint32_t value) {
+        ping_channels_ = value;
+    }
+
+    /// @brief Fetches the value of ping-batch-size
+    ///
+    /// @return integer value of ping-batch-size
+    uint32_t getPingBatchSize() const {
+        return (ping_batch_size_);
+    }
+
+    /// @brief Sets the value of ping-batch-size
+    ///
+    /// @param value new value for ping-batch-size
+    void setPingBatchSize(uint32_t value) {
+        ping_batch_size_ = value;
+    }
+
+    /// @brief Fetches the value of ping-free-cache-secs
+    ///
+    /// @return integer value of ping-free-cache-secs
+    uint32_t getPingFreeCacheSecs() const {
+        return (ping_free_cache_secs_);
+    }
+
+    /// @brief Sets the value of ping-free-cache-secs
+    ///
+    /// @param value new value for ping-free-cache-secs
+    void setPingFreeCacheSecs(uint32_t value) {
+        ping_free_cache_secs_ = value;
+    }
+
 private:
     // @brief True if checking is enabled.
     bool enable_ping_check_;
@@ -123,6 +168,18 @@ private:
     /// @brief Number of threads to use if Kea core is multi-threaded.
     /// Defaults to 0 (for now) which means follow core number of threads.
     size_t ping_channel_threads_;
+
+    /// @brief Number of channels to use if Kea core is multi-threaded.
+    /// Subnets are spread over the channels. Defaults to 1.
+    uint32_t ping_channels_;
+
+    /// @brief Maximum number of ECHO REQUESTs a channel sends with a
+    /// single system call. Defaults to 1.
+    uint32_t ping_batch_size_;
+
+    /// @brief Number of seconds during which an address found free is
+    /// offered again without a ping check. Defaults to 0 (disabled).
+    uint32_t ping_free_cache_secs_;
 };
 
 /// @brief Defines a shared pointer to a PingCheckConfig.
@@ -32,7 +32,7 @@ namespace ping_check {
 PingCheckMgr::PingCheckMgr()
     : io_service_(new IOService()), thread_pool_(),
       store_(new PingContextStore()),
-      channel_(),
+      channel_(), channels_(),
       config_cache_(new ConfigCache()),
       mutex_(new mutex()),
       suspended_(false) {
@@ -43,7 +43,7 @@ PingCheckMgr::PingCheckMgr(uint32_t num_threads,
                            uint32_t reply_timeout)
     : io_service_(new IOService()), thread_pool_(),
       store_(new PingContextStore()),
-      channel_(),
+      channel_(), channels_(),
       config_cache_(new ConfigCache()),
       mutex_(new mutex()),
       suspended_(false) {
@@ -163,14 +163,28 @@ PingCheckMgr::startPing(dhcp::Lease4Ptr& lease, dhcp::Pkt4Ptr& query, hooks::Par
               .arg(lease->addr_)
               .arg(query->getLabel());
 
-    // Adds a context to the store
+    // Adds a context to the store. The checks of a subnet are always sent
+    // by the same channel.
+    size_t channel_index = 0;
+    if (channels_.size() > 1) {
+        channel_index = lease->subnet_id_ % channels_.size();
+    }
+
     store_->addContext(lease, query, config->getMinPingRequests(),
-                       config->getReplyTimeout(), parking_lot);
+                       config->getReplyTimeout(), parking_lot, channel_index);
+    StatsMgr::instance().addValue("ping-check-probes-in-flight",
+                                  static_cast<int64_t>(1));
 
-    // Posts a call to channel's startSend() and startRead().  This will kick-start perpetual
-    // write and read cycles if they are not already running.
+    // Posts a call to channel's startSend() and the reading channel's startRead().
+    // This will kick-start perpetual write and read cycles if they are not already
+    // running.
     if (channel_) {
-        channel_->startSend();
+        if (channel_index) {
+            channels_[channel_index]->startSend();
+        } else {
+            channel_->startSend();
+        }
+
         channel_->startRead();
     }
 }
@@ -182,8 +196,13 @@ PingCheckMgr::startPing(dhcp::Lease4Ptr& lease, dhcp::Pkt4Ptr& query, hooks::Par
 
 PingContextPtr
 PingCheckMgr::nextToSend() {
+    return (nextToSendOnChannel(0));
+}
+
+PingContextPtr
+PingCheckMgr::nextToSendOnChannel(size_t channel_index) {
     if (!checkSuspended()) {
-        return (store_->getNextToSend());
+        return (store_->getNextToSend(channel_index));
     }
 
     return (PingContextPtr());
@@ -309,7 +328,7 @@ PingCheckMgr::handleEchoReply(const ICMPMsgPtr& echo_reply) {
     }
 
     // Remove the context from the store.
-    store_->deleteContext(context);
+    retireContext(context);
 }
 
 void
@@ -337,6 +356,7 @@ PingCheckMgr::handleTargetUnreachable(const ICMPMsgPtr& unreachable) {
         .arg(embedded_echo->getSequence());
 
     // Render the address usable.
+    store_->addFreeAddress(context->getTarget());
     finishFree(context);
 }
 
@@ -363,7 +383,20 @@ PingCheckMgr::finishFree(const PingContextPtr& context) {
     }
 
     // Remove the context from the store.
+    retireContext(context);
+}
+
+void
+PingCheckMgr::retireContext(const PingContextPtr& context) {
     store_->deleteContext(context);
+
+    StatsMgr::instance().addValue("ping-check-probes-in-flight",
+                                  static_cast<int64_t>(-1));
+
+    // The query was parked from the creation of the context.
+    auto park_time = PingContext::now() - context->getCreatedTime();
+    StatsMgr::instance().setValue("ping-check-park-time",
+                                  duration_cast<StatsDuration>(park_time));
 }
 
 void
@@ -393,6 +426,7 @@ PingCheckMgr::processExpiredSince(const TimeStamp& since /* = PingContext::now()
             doNextEcho(context);
             ++more_pings;
         } else {
+            store_->addFreeAddress(context->getTarget());
             finishFree(context);
         }
     }
@@ -482,9 +516,12 @@ PingCheckMgr::expirationTimedOut() {
     setNextExpirationInternal();
 
     // In the event there was nothing left to process when timed out,
-    // poke the channel to make sure things are moving.
+    // poke the channels to make sure things are moving.
     if (more_pings && channel_) {
-        channel_->startSend();
+        for (auto const& channel : channels_) {
+            channel->startSend();
+        }
+
         channel_->startRead();
     }
 }
@@ -532,6 +569,19 @@ PingCheckMgr::shouldPing(Lease4Ptr& lease, Pkt4Ptr& query,
         }
     }
 
+    // If the address was found free by a check less than ping-free-cache-secs
+    // ago then no check is needed.
+    if (config->getPingFreeCacheSecs() &&
+        store_->isRecentlyFree(lease->addr_, seconds(config->getPingFreeCacheSecs()))) {
+        LOG_DEBUG(ping_check_logger, isc::log::DBGLVL_TRACE_BASIC,
+                  PING_CHECK_MGR_FREE_CACHE_HIT)
+                  .arg(lease->addr_)
+                  .arg(query->getLabel());
+        StatsMgr::instance().addValue("ping-check-free-cache-hits",
+                                      static_cast<int64_t>(1));
+        return (CalloutHandle::CalloutNextStep::NEXT_STEP_CONTINUE);
+    }
+
     // Leave it parked and do the ping check.
     return (CalloutHandle::CalloutNextStep::NEXT_STEP_PARK);
 }
@@ -610,12 +660,29 @@ PingCheckMgr::start() {
         thread_pool_.reset(new IoServiceThreadPool(IOServicePtr(), use_threads, true));
         IOServicePtr pool_ios = thread_pool_->getIOService();
         channel_ = createChannel(pool_ios);
-        channel_->open();
+        channel_->setBatchSize(config->getPingBatchSize());
+        channels_.push_back(channel_);
+
+        // Additional channels only send: the replies are all read by
+        // the first one.
+        for (size_t index = 1; index < config->getPingChannels(); ++index) {
+            PingChannelPtr channel = createSendChannel(pool_ios, index);
+            channel->setBatchSize(config->getPingBatchSize());
+            channel->setSendOnly(true);
+            channels_.push_back(channel);
+        }
+
+        for (auto const& channel : channels_) {
+            channel->open();
+        }
+
         expiration_timer_.reset(new IntervalTimer(pool_ios));
         thread_pool_->run();
         LOG_INFO(ping_check_logger, PING_CHECK_MGR_STARTED)
-                .arg(use_threads);
+                .arg(use_threads)
+                .arg(channels_.size());
     } catch (const std::exception& ex) {
+        channels_.clear();
         channel_.reset();
         thread_pool_.reset();
         isc_throw(Unexpected, "PingCheckMgr::start failed:" << ex.what());
@@ -627,10 +694,13 @@ PingCheckMgr::startSingleThreaded() {
     try {
         auto config = config_cache_->getGlobalConfig();
         channel_ = createChannel(io_service_);
+        channel_->setBatchSize(config->getPingBatchSize());
+        channels_.push_back(channel_);
         channel_->open();
         expiration_timer_.reset(new IntervalTimer(io_service_));
         LOG_INFO(ping_check_logger, PING_CHECK_MGR_STARTED_SINGLE_THREADED);
     } catch (const std::exception& ex) {
+        channels_.clear();
         channel_.reset();
         isc_throw(Unexpected, "PingCheckMgr::startSingleThreaded() failed:" << ex.what());
     }
@@ -651,6 +721,21 @@ PingCheckMgr::createChannel(IOServicePtr io_service) {
                                                      this))));
 }
 
+PingChannelPtr
+PingCheckMgr::createSendChannel(IOServicePtr io_service, size_t channel_index) {
+    return (PingChannelPtr(new PingChannel(io_service,
+                                           std::bind(&PingCheckMgr::nextToSendOnChannel,
+                                                     this, channel_index),
+                                           std::bind(&PingCheckMgr::updateContextToSend,
+                                                     this, ph::_1),
+                                           std::bind(&PingCheckMgr::sendCompleted,
+                                                     this, ph::_1, ph::_2),
+                                           std::bind(&PingCheckMgr::replyReceived,
+                                                     this, ph::_1),
+                                           std::bind(&PingCheckMgr::channelShutdown,
+                                                     this))));
+}
+
 void
 PingCheckMgr::checkPermissions() {
     // Since this function is used as CS callback all exceptions must be
@@ -725,6 +810,10 @@ PingCheckMgr::stop() {
         thread_pool_->pause();
     }
 
+    for (auto const& channel : channels_) {
+        channel->close();
+    }
+
     if (channel_) {
         channel_->close();
     }
@@ -745,7 +834,8 @@ PingCheckMgr::stop() {
     // MT it holds a reference to the pool's IOService.
     expiration_timer_.reset();
 
-    // Get rid of the channel.
+    // Get rid of the channels.
+    channels_.clear();
     channel_.reset();
 
     if (io_service_) {
@@ -812,6 +902,9 @@ PingCheckMgr::flush(bool finish_free /* = false */) {
     }
 
     store_->clear();
+    store_->clearFreeAddresses();
+    StatsMgr::instance().setValue("ping-check-probes-in-flight",
+                                  static_cast<int64_t>(0));
 }
 
 } // end of namespace ping_check
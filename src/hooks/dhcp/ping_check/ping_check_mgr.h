@@ -1,4 +1,4 @@
-// Copyright (C) 2023-2025 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2023-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -26,6 +26,7 @@
 #include <boost/enable_shared_from_this.hpp>
 
 #include <mutex>
+#include <vector>
 
 namespace isc {
 namespace ping_check {
@@ -40,8 +41,10 @@ typedef boost::shared_ptr<PingContextStore> PingContextStorePtr;
 /// is loaded.  It is responsible for:
 /// 1. Parsing and applying configuration.
 /// 2. Maintaining in-memory store of current ping requests (PingContextStore).
-/// 3. Creating and managing the PingChannel through which individual ICMP ECHO/REPLY
-/// cycles are conducted.
+/// 3. Creating and managing the PingChannels through which individual ICMP ECHO/REPLY
+/// cycles are conducted.  In multi-threaded mode ping-channels channels send the
+/// ECHO REQUESTs, the checks of a subnet being always sent by the same channel.
+/// The replies are all read by the first channel.
 /// 4. When in multi-threaded mode, it creates an IOServiceThread and synchronizes
 /// its state with Kea core MT.
 class PingCheckMgr : public boost::enable_shared_from_this<PingCheckMgr> {
@@ -90,6 +93,15 @@ public:
     /// @return pointer to the newly created channel.
     virtual PingChannelPtr createChannel(asiolink::IOServicePtr io_service);
 
+    /// @brief Creates an additional, send only, ping channel instance.
+    ///
+    /// @param io_service IOService that will drive the channel.
+    /// @param channel_index index of the channel.
+    ///
+    /// @return pointer to the newly created channel.
+    virtual PingChannelPtr createSendChannel(asiolink::IOServicePtr io_service,
+                                             size_t channel_index);
+
     /// @brief Initiates a ping check for a given lease and its associated
     /// DHCPDISCOVER packet.
     ///
@@ -126,6 +138,16 @@ public:
     /// @return The context selected to send, or null if none available.
     virtual PingContextPtr nextToSend();
 
+    /// @brief Callback passed to an additional PingChannel to use to
+    /// retrieve the next context with address to check.
+    ///
+    /// Fetches the context of the channel which has been in the
+    /// WAITING_TO_SEND state the longest and returns it.
+    ///
+    /// @param channel_index index of the channel.
+    /// @return The context selected to send, or null if none available.
+    virtual PingContextPtr nextToSendOnChannel(size_t channel_index);
+
     /// @brief Callback passed to PingChannel to update a context to SENDING
     /// state just before sending.
     ///
@@ -187,6 +209,14 @@ public:
     /// @param context context to process.
     void finishFree(const PingContextPtr& context);
 
+    /// @brief Removes a completed context from the store.
+    ///
+    /// Updates the ping-check-probes-in-flight statistic and records
+    /// the time the query was parked in the ping-check-park-time statistic.
+    ///
+    /// @param context context to remove.
+    void retireContext(const PingContextPtr& context);
+
     /// @brief Position a context to do another ping test.
     ///
     /// -# Moves the context to WAITING_SEND_STATE
@@ -255,6 +285,10 @@ public:
     /// it was touched by the client less than ping-cltt-secs ago,
     /// then send the offer to the client without ping checking.
     ///
+    /// If the address was found free by a check less than
+    /// ping-free-cache-secs ago, then send the offer to the client
+    /// without ping checking.
+    ///
     /// Otherwise a ping-check is called for, leave the query parked.
     ///
     /// @param lease prospective lease to check.
@@ -415,9 +449,12 @@ protected:
     /// @brief In-memory store of PingContexts.
     PingContextStorePtr store_;
 
-    /// @brief Channel that conducts ICMP messaging.
+    /// @brief Channel that conducts ICMP messaging, the first of channels_.
     PingChannelPtr channel_;
 
+    /// @brief Channels sending ECHO REQUESTs, indexed by the context channel.
+    std::vector<PingChannelPtr> channels_;
+
     /// @brief Warehouses parsed global and subnet configuration.
     ConfigCachePtr config_cache_;
 
@@ -1,4 +1,4 @@
-// Copyright (C) 2023-2025 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2023-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -36,7 +36,8 @@ PingContext::PingContext(Lease4Ptr& lease, Pkt4Ptr& query,
       lease_(lease),
       query_(query),
       state_(NEW),
-      parking_lot_(parking_lot) {
+      parking_lot_(parking_lot),
+      channel_(0) {
     if (!lease_) {
         isc_throw(BadValue, "PingContext ctor - lease cannot be empty");
     }
@@ -218,6 +219,16 @@ PingContext::getLease() const {
     return (lease_);
 }
 
+size_t
+PingContext::getChannel() const {
+    return (channel_);
+}
+
+void
+PingContext::setChannel(size_t value) {
+    channel_ = value;
+}
+
 void
 PingContext::beginWaitingToSend(const TimeStamp& begin_time /* = now() */) {
     state_ = WAITING_TO_SEND;
@@ -1,4 +1,4 @@
-// Copyright (C) 2023-2025 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2023-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -234,6 +234,16 @@ public:
         return (parking_lot_);
     };
 
+    /// @brief Fetches the index of the channel sending the ECHO REQUESTs.
+    ///
+    /// @return channel index as a size_t
+    size_t getChannel() const;
+
+    /// @brief Sets the index of the channel sending the ECHO REQUESTs.
+    ///
+    /// @param value new value
+    void setChannel(size_t value);
+
 private:
     /// @brief Minimum number of echos to send without receiving a reply
     /// before giving up
@@ -269,6 +279,9 @@ private:
     /// @brief Parking lot where the associated query is parked.
     /// If empty parking is not being employed.
     isc::hooks::ParkingLotHandlePtr parking_lot_;
+
+    /// @brief Index of the channel sending the ECHO REQUESTs.
+    size_t channel_ = 0;
 };
 
 /// @brief Defines a shared pointer to a PingContext.
@@ -1,4 +1,4 @@
-// Copyright (C) 2023-2025 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2023-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -9,6 +9,8 @@
 #include <ping_context_store.h>
 #include <util/multi_threading_mgr.h>
 
+#include <algorithm>
+
 using namespace std;
 using namespace isc;
 using namespace isc::asiolink;
@@ -23,7 +25,8 @@ namespace ping_check {
 PingContextPtr
 PingContextStore::addContext(Lease4Ptr& lease, Pkt4Ptr& query,
                              uint32_t min_echos, uint32_t reply_timeout,
-                             ParkingLotHandlePtr& parking_lot) {
+                             ParkingLotHandlePtr& parking_lot,
+                             size_t channel) {
 
     MultiThreadingLock lock(*mutex_);
     PingContextPtr context;
@@ -33,6 +36,7 @@ PingContextStore::addContext(Lease4Ptr& lease, Pkt4Ptr& query,
         isc_throw(BadValue, "PingContextStore::addContext failed: " << ex.what());
     }
 
+    context->setChannel(channel);
     context->beginWaitingToSend();
     auto ret = pings_.insert(context);
     if (ret.second == false) {
@@ -90,12 +94,16 @@ PingContextStore::getContextByQuery(Pkt4Ptr& query) {
 }
 
 PingContextPtr
-PingContextStore::getNextToSend() {
+PingContextStore::getNextToSend(size_t channel) {
     MultiThreadingLock lock(*mutex_);
     auto const& index = pings_.get<NextToSendIndexTag>();
-    auto context_iter = index.lower_bound(boost::make_tuple(true, PingContext::MIN_TIME()));
-    return (context_iter == index.end() ? PingContextPtr()
-            : PingContextPtr(new PingContext(**context_iter)));
+    auto context_iter = index.lower_bound(boost::make_tuple(channel, true,
+                                                            PingContext::MIN_TIME()));
+    if ((context_iter == index.end()) || ((*context_iter)->getChannel() != channel)) {
+        return (PingContextPtr());
+    }
+
+    return (PingContextPtr(new PingContext(**context_iter)));
 }
 
 PingContextPtr
@@ -132,13 +140,64 @@ PingContextStore::getAll() {
         collection->push_back(PingContextPtr(new PingContext(*context_iter)));
     }
 
+    // The address index is hashed so sort the contexts by target.
+    std::sort(collection->begin(), collection->end(),
+              [](const PingContextPtr& a, const PingContextPtr& b) {
+                  return (a->getTarget() < b->getTarget());
+              });
     return (collection);
 }
 
+size_t
+PingContextStore::size() {
+    MultiThreadingLock lock(*mutex_);
+    return (pings_.size());
+}
+
 void PingContextStore::clear() {
     MultiThreadingLock lock(*mutex_);
     pings_.clear();
 }
 
+void
+PingContextStore::addFreeAddress(const IOAddress& address, const TimeStamp& found_time) {
+    MultiThreadingLock lock(*mutex_);
+    auto& index = free_addresses_.get<AddressIndexTag>();
+    auto free_iter = index.find(address);
+    if (free_iter != index.end()) {
+        index.erase(free_iter);
+    }
+
+    auto& sequence = free_addresses_.get<SequenceIndexTag>();
+    sequence.push_back(FreeAddress(address, found_time));
+    if (sequence.size() > MAX_FREE_ADDRESSES) {
+        sequence.pop_front();
+    }
+}
+
+bool
+PingContextStore::isRecentlyFree(const IOAddress& address, const milliseconds& max_age) {
+    MultiThreadingLock lock(*mutex_);
+    auto& index = free_addresses_.get<AddressIndexTag>();
+    auto free_iter = index.find(address);
+    if (free_iter == index.end()) {
+        return (false);
+    }
+
+    if (free_iter->found_time_ + max_age <= PingContext::now()) {
+        // Too old, forget it.
+        index.erase(free_iter);
+        return (false);
+    }
+
+    return (true);
+}
+
+void
+PingContextStore::clearFreeAddresses() {
+    MultiThreadingLock lock(*mutex_);
+    free_addresses_.clear();
+}
+
 } // end of namespace ping_check
 } // end of namespace isc
@@ -1,4 +1,4 @@
-// Copyright (C) 2023-2025 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2023-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -13,11 +13,14 @@
 #include <boost/multi_index/indexed_by.hpp>
 #include <boost/multi_index/member.hpp>
 #include <boost/multi_index/mem_fun.hpp>
+#include <boost/multi_index/hashed_index.hpp>
 #include <boost/multi_index/ordered_index.hpp>
+#include <boost/multi_index/sequenced_index.hpp>
 #include <boost/multi_index_container.hpp>
 #include <boost/multi_index/composite_key.hpp>
 #include <boost/scoped_ptr.hpp>
 
+#include <chrono>
 #include <mutex>
 #include <vector>
 
@@ -43,14 +46,19 @@ struct NextToSendIndexTag { };
 /// @brief Tag for index by expiration time.
 struct ExpirationIndexTag { };
 
+/// @brief Tag for index by insertion order.
+struct SequenceIndexTag { };
+
 /// @brief A multi index container holding pointers to PingContexts.
 ///
 /// The contexts in the container may be accessed using different indexes:
 /// - using an IPv4 address,
 /// - using a query packet
-/// - using a send wait start time
+/// - using a channel and a send wait start time
 /// - using an expiration time
-/// - using a context state
+///
+/// The address and query indexes are looked up for every ICMP message
+/// so they are hashed.
 ///
 /// Indexes can be accessed using the index number (from 0 to 2) or a
 /// name tag. It is recommended to use the tags to access indexes as
@@ -60,29 +68,31 @@ typedef boost::multi_index_container<
     PingContextPtr,
     boost::multi_index::indexed_by<
         // Specification of the first index starts here.
-        // This index sorts PingContexts by IPv4 addresses represented as
+        // This index hashes PingContexts by IPv4 addresses represented as
         // IOAddress objects.
-        /// @todo Does it need to be ordered or only unique?
-        boost::multi_index::ordered_unique<
+        boost::multi_index::hashed_unique<
             boost::multi_index::tag<AddressIndexTag>,
             boost::multi_index::const_mem_fun<PingContext, const isc::asiolink::IOAddress&,
                                               &PingContext::getTarget>
         >,
 
         // Specification of the second index starts here.
-        // This index sorts contexts by query.
-        boost::multi_index::ordered_unique<
+        // This index hashes contexts by query.
+        boost::multi_index::hashed_unique<
             boost::multi_index::tag<QueryIndexTag>,
             boost::multi_index::const_mem_fun<PingContext, isc::dhcp::Pkt4Ptr,
                                               &PingContext::getQuery>
         >,
 
         // Specification of the third index starts here.
-        // This index sorts contexts by send_wait_start.
+        // This index sorts contexts by channel and send_wait_start.
         boost::multi_index::ordered_non_unique<
             boost::multi_index::tag<NextToSendIndexTag>,
             boost::multi_index::composite_key<
                 PingContext,
+                // The channel sending the context ECHO REQUESTs
+                boost::multi_index::const_mem_fun<PingContext, size_t,
+                                                  &PingContext::getChannel>,
                 // The boolean value specifying if context is waiting to send
                 boost::multi_index::const_mem_fun<PingContext, bool,
                                                   &PingContext::isWaitingToSend>,
@@ -109,6 +119,42 @@ typedef boost::multi_index_container<
     >
 > PingContextContainer;
 
+/// @brief An address found free.
+struct FreeAddress {
+    /// @brief Constructor
+    ///
+    /// @param address the address
+    /// @param found_time time the address was found free
+    FreeAddress(const isc::asiolink::IOAddress& address,
+                const TimeStamp& found_time)
+        : address_(address), found_time_(found_time) {
+    }
+
+    /// @brief The address.
+    isc::asiolink::IOAddress address_;
+
+    /// @brief Time the address was found free.
+    TimeStamp found_time_;
+};
+
+/// @brief A multi index container holding addresses found free.
+///
+/// The addresses may be accessed using the address or in the order
+/// they were found free.
+typedef boost::multi_index_container<
+    FreeAddress,
+    boost::multi_index::indexed_by<
+        boost::multi_index::hashed_unique<
+            boost::multi_index::tag<AddressIndexTag>,
+            boost::multi_index::member<FreeAddress, isc::asiolink::IOAddress,
+                                       &FreeAddress::address_>
+        >,
+        boost::multi_index::sequenced<
+            boost::multi_index::tag<SequenceIndexTag>
+        >
+    >
+> FreeAddressContainer;
+
 /// @brief Type for a collection of PingContextPtrs.
 typedef std::vector<PingContextPtr> PingContextCollection;
 /// @brief Type for a pointer to a collection of PingContextPtrs.
@@ -122,11 +168,16 @@ typedef boost::shared_ptr<PingContextCollection> PingContextCollectionPtr;
 /// start time, WAITING_FOR_REPLY expiration time, and context state.
 /// All finders return copies of the contexts found, rather than the
 /// stored context itself.
+///
+/// It also remembers the addresses recently found free so they can be
+/// offered again without a new check.
 class PingContextStore {
 public:
+    /// @brief Maximum number of addresses found free remembered.
+    static const size_t MAX_FREE_ADDRESSES = 65536;
 
     /// @brief Constructor
-    PingContextStore() : pings_(), mutex_(new std::mutex) {
+    PingContextStore() : pings_(), free_addresses_(), mutex_(new std::mutex) {
     }
 
     /// @brief Destructor
@@ -143,6 +194,7 @@ public:
     /// ECHO REPLY after an ECHO REQUEST has been sent. Must be greater than 0.
     /// @param parking_lot parking lot in which query is parked.  If empty,
     /// parking is assumed to not be employed.
+    /// @param channel index of the channel sending the ECHO REQUESTs.
     ///
     /// @return pointer to the newly created context
     /// @throw DuplicateContext is a context for the lease address already
@@ -152,7 +204,8 @@ public:
                               uint32_t min_echos,
                               uint32_t reply_timeout,
                               isc::hooks::ParkingLotHandlePtr& parking_lot
-                              = PingContext::EMPTY_LOT());
+                              = PingContext::EMPTY_LOT(),
+                              size_t channel = 0);
 
     /// @brief Updates a context in the store.
     ///
@@ -189,9 +242,11 @@ public:
     /// @brief Fetches the context in WAITING_TO_SEND with the oldest send wait
     /// start time.
     ///
+    /// @param channel index of the channel sending the ECHO REQUESTs.
+    ///
     /// @return pointer to the matching PingContext or an empty pointer if
     /// not found.
-    PingContextPtr getNextToSend();
+    PingContextPtr getNextToSend(size_t channel = 0);
 
     /// @brief Fetches the context in WAITING_FOR_REPLY with the oldest expiration
     /// time that has not already passed (i.e. is still in the future)
@@ -212,13 +267,44 @@ public:
     /// @return a collection of all contexts in the store.
     PingContextCollectionPtr getAll();
 
+    /// @brief Returns the number of contexts in the store.
+    ///
+    /// @return number of contexts.
+    size_t size();
+
     /// @brief Removes all contexts from the store.
     void clear();
 
+    /// @brief Remembers an address found free.
+    ///
+    /// When more than @c MAX_FREE_ADDRESSES are remembered the oldest
+    /// one is forgotten.
+    ///
+    /// @param address address found free.
+    /// @param found_time time the address was found free. Defaults to
+    /// current time.
+    void addFreeAddress(const isc::asiolink::IOAddress& address,
+                        const TimeStamp& found_time = PingContext::now());
+
+    /// @brief Checks if an address was found free recently.
+    ///
+    /// @param address address to check.
+    /// @param max_age maximum time since the address was found free.
+    ///
+    /// @return true if the address was found free less than max_age ago.
+    bool isRecentlyFree(const isc::asiolink::IOAddress& address,
+                        const std::chrono::milliseconds& max_age);
+
+    /// @brief Forgets all the addresses found free.
+    void clearFreeAddresses();
+
 private:
     /// @brief Container instance.
     PingContextContainer pings_;
 
+    /// @brief Addresses found free.
+    FreeAddressContainer free_addresses_;
+
     /// @brief The mutex used to protect internal state.
     const boost::scoped_ptr<std::mutex> mutex_;
 };
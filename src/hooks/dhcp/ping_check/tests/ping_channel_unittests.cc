@@ -589,6 +589,53 @@ TEST_F(RootPingChannelTest, openCloseST) {
     ASSERT_FALSE(channel_->isOpen());
 }
 
+// Verifies batch size and send-only PingChannel operations.
+TEST_F(RootPingChannelTest, sendOnlyST) {
+    SKIP_IF(notRoot());
+
+    // Create the channel instance.
+    ASSERT_NO_THROW_LOG(channel_.reset(new TestablePingChannel(
+        test_io_service_,
+        std::bind(&PingChannelTest::nextToSend, this),
+        std::bind(&PingChannelTest::updateContextToSend, this, ph::_1),
+        std::bind(&PingChannelTest::echoSent, this, ph::_1, ph::_2),
+        std::bind(&PingChannelTest::replyReceived, this, ph::_1)
+    )));
+
+    ASSERT_TRUE(channel_);
+
+    // Check the batch size.
+    EXPECT_EQ(1U, channel_->getBatchSize());
+    ASSERT_THROW_MSG(channel_->setBatchSize(0), BadValue,
+                     "PingChannel::setBatchSize - batch size cannot be 0");
+    ASSERT_NO_THROW_LOG(channel_->setBatchSize(16));
+#ifdef HAVE_SENDMMSG
+    EXPECT_EQ(16U, channel_->getBatchSize());
+#else
+    EXPECT_EQ(1U, channel_->getBatchSize());
+#endif
+
+    // Make it send-only.
+    EXPECT_FALSE(channel_->isSendOnly());
+    channel_->setSendOnly(true);
+    EXPECT_TRUE(channel_->isSendOnly());
+
+    // Attempt to open the channel.
+    ASSERT_NO_THROW_LOG(channel_->open());
+    ASSERT_TRUE(channel_->isOpen());
+
+    // Verify the WatchSocket fd is registered but not the PingSocket one.
+    ASSERT_TRUE(channel_->getWatchSocket());
+    int registered_write_fd = channel_->getRegisteredWriteFd();
+    EXPECT_TRUE(IfaceMgr::instance().isExternalSocket(registered_write_fd));
+    EXPECT_EQ(channel_->getRegisteredReadFd(), -1);
+    EXPECT_FALSE(IfaceMgr::instance().isExternalSocket(channel_->getPingSocket()->getNative()));
+
+    // Closing the socket should work.
+    ASSERT_NO_THROW_LOG(channel_->close());
+    ASSERT_FALSE(channel_->isOpen());
+}
+
 // Verifies PingChannel open and close operations.
 TEST_F(RootPingChannelTest, openCloseMT) {
     SKIP_IF(notRoot());
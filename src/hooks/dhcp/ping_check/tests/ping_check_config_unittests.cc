@@ -30,6 +30,9 @@ TEST(PingCheckConfigTest, basics) {
     EXPECT_EQ(100U, config.getReplyTimeout());
     EXPECT_EQ(60U, config.getPingClttSecs());
     EXPECT_EQ(0U, config.getPingChannelThreads());
+    EXPECT_EQ(1U, config.getPingChannels());
+    EXPECT_EQ(1U, config.getPingBatchSize());
+    EXPECT_EQ(0U, config.getPingFreeCacheSecs());
 
     // Verify accessors.
     EXPECT_NO_THROW_LOG(config.setEnablePingCheck(false));
@@ -47,6 +50,15 @@ TEST(PingCheckConfigTest, basics) {
     EXPECT_NO_THROW_LOG(config.setPingChannelThreads(6));
     EXPECT_EQ(6U, config.getPingChannelThreads());
 
+    EXPECT_NO_THROW_LOG(config.setPingChannels(3));
+    EXPECT_EQ(3U, config.getPingChannels());
+
+    EXPECT_NO_THROW_LOG(config.setPingBatchSize(32));
+    EXPECT_EQ(32U, config.getPingBatchSize());
+
+    EXPECT_NO_THROW_LOG(config.setPingFreeCacheSecs(5));
+    EXPECT_EQ(5U, config.getPingFreeCacheSecs());
+
     // Verify copy construction.
     PingCheckConfig config2(config);
     EXPECT_FALSE(config2.getEnablePingCheck());
@@ -54,6 +66,9 @@ TEST(PingCheckConfigTest, basics) {
     EXPECT_EQ(250U, config2.getReplyTimeout());
     EXPECT_EQ(120U, config2.getPingClttSecs());
     EXPECT_EQ(6U, config2.getPingChannelThreads());
+    EXPECT_EQ(3U, config2.getPingChannels());
+    EXPECT_EQ(32U, config2.getPingBatchSize());
+    EXPECT_EQ(5U, config2.getPingFreeCacheSecs());
 }
 
 // Exercises PingCheckConfig parameter parsing with valid configuration
@@ -68,6 +83,9 @@ TEST(PingCheckConfigTest, parseValidScenarios) {
         uint32_t exp_reply_timeout_;        // Expected value for reply-timeout
         uint32_t exp_ping_cltt_secs_;       // Expected value for ping-cltt-secs
         size_t exp_num_threads_;            // Expected value for ping-channel-threads
+        uint32_t exp_channels_;             // Expected value for ping-channels
+        uint32_t exp_batch_size_;           // Expected value for ping-batch-size
+        uint32_t exp_free_cache_secs_;      // Expected value for ping-free-cache-secs
     };
 
     // List of test scenarios to run.
@@ -76,37 +94,55 @@ TEST(PingCheckConfigTest, parseValidScenarios) {
             // Empty map
             __LINE__,
             R"({ })",
-            true, 1, 100, 60, 0
+            true, 1, 100, 60, 0, 1, 1, 0
         },
         {
             // Only enable-ping-check",
             __LINE__,
             R"({ "enable-ping-check" : false })",
-            false, 1, 100, 60, 0
+            false, 1, 100, 60, 0, 1, 1, 0
         },
         {
             // Only min-ping-requests",
             __LINE__,
             R"({ "min-ping-requests" : 3 })",
-            true, 3, 100, 60, 0
+            true, 3, 100, 60, 0, 1, 1, 0
         },
         {
             // Only reply-timeout",
             __LINE__,
             R"({ "reply-timeout" : 250 })",
-            true, 1, 250, 60, 0
+            true, 1, 250, 60, 0, 1, 1, 0
         },
         {
             // Only ping-cltt-secs",
             __LINE__,
             R"({ "ping-cltt-secs" : 77 })",
-            true, 1, 100, 77, 0
+            true, 1, 100, 77, 0, 1, 1, 0
         },
         {
             // Only ping-channel-threads",
             __LINE__,
             R"({ "ping-channel-threads" : 5 })",
-            true, 1, 100, 60, 5
+            true, 1, 100, 60, 5, 1, 1, 0
+        },
+        {
+            // Only ping-channels",
+            __LINE__,
+            R"({ "ping-channels" : 2 })",
+            true, 1, 100, 60, 0, 2, 1, 0
+        },
+        {
+            // Only ping-batch-size",
+            __LINE__,
+            R"({ "ping-batch-size" : 1024 })",
+            true, 1, 100, 60, 0, 1, 1024, 0
+        },
+        {
+            // Only ping-free-cache-secs",
+            __LINE__,
+            R"({ "ping-free-cache-secs" : 3 })",
+            true, 1, 100, 60, 0, 1, 1, 3
         },
         {
             // All parameters",
@@ -117,9 +153,12 @@ TEST(PingCheckConfigTest, parseValidScenarios) {
                 "min-ping-requests" : 2,
                 "reply-timeout" : 375,
                 "ping-cltt-secs" : 120,
-                "ping-channel-threads" : 6
+                "ping-channel-threads" : 6,
+                "ping-channels" : 4,
+                "ping-batch-size" : 64,
+                "ping-free-cache-secs" : 10
             })",
-            false, 2, 375, 120, 6
+            false, 2, 375, 120, 6, 4, 64, 10
         },
     };
 
@@ -143,6 +182,9 @@ TEST(PingCheckConfigTest, parseValidScenarios) {
         EXPECT_EQ(scenario.exp_reply_timeout_, config.getReplyTimeout());
         EXPECT_EQ(scenario.exp_ping_cltt_secs_, config.getPingClttSecs());
         EXPECT_EQ(scenario.exp_num_threads_, config.getPingChannelThreads());
+        EXPECT_EQ(scenario.exp_channels_, config.getPingChannels());
+        EXPECT_EQ(scenario.exp_batch_size_, config.getPingBatchSize());
+        EXPECT_EQ(scenario.exp_free_cache_secs_, config.getPingFreeCacheSecs());
     }
 }
 
@@ -256,6 +298,54 @@ TEST(PingCheckConfigTest, parseInvalidScenarios) {
                 "ping-channel-threads" : -1
             })",
             "invalid ping-channel-threads: '-1', cannot be less than 0"
+        },
+        {
+            __LINE__,
+            R"(
+            {
+                "enable-ping-check" : false,
+                "min-ping-requests" : 1,
+                "reply-timeout" : 250,
+                "ping-cltt-secs" : 90,
+                "ping-channels" : 0
+            })",
+            "invalid ping-channels: '0', must be greater than 0"
+        },
+        {
+            __LINE__,
+            R"(
+            {
+                "enable-ping-check" : false,
+                "min-ping-requests" : 1,
+                "reply-timeout" : 250,
+                "ping-cltt-secs" : 90,
+                "ping-batch-size" : 0
+            })",
+            "invalid ping-batch-size: '0', must be between 1 and 1024"
+        },
+        {
+            __LINE__,
+            R"(
+            {
+                "enable-ping-check" : false,
+                "min-ping-requests" : 1,
+                "reply-timeout" : 250,
+                "ping-cltt-secs" : 90,
+                "ping-batch-size" : 1025
+            })",
+            "invalid ping-batch-size: '1025', must be between 1 and 1024"
+        },
+        {
+            __LINE__,
+            R"(
+            {
+                "enable-ping-check" : false,
+                "min-ping-requests" : 1,
+                "reply-timeout" : 250,
+                "ping-cltt-secs" : 90,
+                "ping-free-cache-secs" : -1
+            })",
+            "invalid ping-free-cache-secs: '-1', cannot be less than 0"
         }
     };
 
@@ -281,6 +371,9 @@ TEST(PingCheckConfigTest, parseInvalidScenarios) {
         EXPECT_EQ(default_config.getReplyTimeout(), config.getReplyTimeout());
         EXPECT_EQ(default_config.getPingClttSecs(), config.getPingClttSecs());
         EXPECT_EQ(default_config.getPingChannelThreads(), config.getPingChannelThreads());
+        EXPECT_EQ(default_config.getPingChannels(), config.getPingChannels());
+        EXPECT_EQ(default_config.getPingBatchSize(), config.getPingBatchSize());
+        EXPECT_EQ(default_config.getPingFreeCacheSecs(), config.getPingFreeCacheSecs());
     }
 }
 
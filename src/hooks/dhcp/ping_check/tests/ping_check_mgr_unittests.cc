@@ -838,6 +838,53 @@ public:
         EXPECT_EQ(PingContext::WAITING_TO_SEND, context2->getState());
     }
 
+    /// @brief Exercises startPing() with several channels.
+    void testStartPingMultipleChannels() {
+        SKIP_IF(notRoot());
+
+        // Create manager with thread-pool size of 3, min_echos 1, reply_timeout 250 ms
+        // and 3 channels.
+        ASSERT_NO_THROW_LOG(createMgr(3, 1, 250));
+        ASSERT_TRUE(mgr_);
+        mgr_->getGlobalConfig()->setPingChannels(3);
+
+        // Start the manager then pause it so the contexts sit in WAITING_TO_SEND state.
+        ASSERT_NO_THROW_LOG(mgr_->start());
+        ASSERT_TRUE(mgr_->isRunning());
+        ASSERT_NO_THROW_LOG(mgr_->pause());
+        ASSERT_TRUE(mgr_->isPaused());
+
+        // Start pings for leases in subnets 1, 2 and 4.
+        auto lqp1 = makeLeaseQueryPair(IOAddress("127.0.0.101"), 101);
+        lqp1.lease_->subnet_id_ = 1;
+        auto lqp2 = makeLeaseQueryPair(IOAddress("127.0.0.102"), 102);
+        lqp2.lease_->subnet_id_ = 2;
+        auto lqp3 = makeLeaseQueryPair(IOAddress("127.0.0.103"), 103);
+        lqp3.lease_->subnet_id_ = 4;
+        ASSERT_NO_THROW_LOG(mgr_->startPing(lqp1.lease_, lqp1.query_, parking_lot_));
+        ASSERT_NO_THROW_LOG(mgr_->startPing(lqp2.lease_, lqp2.query_, parking_lot_));
+        ASSERT_NO_THROW_LOG(mgr_->startPing(lqp3.lease_, lqp3.query_, parking_lot_));
+
+        // The checks of a subnet are sent by the same channel.
+        auto context1 = getContext(lqp1.lease_->addr_);
+        ASSERT_TRUE(context1);
+        EXPECT_EQ(1U, context1->getChannel());
+        auto context2 = getContext(lqp2.lease_->addr_);
+        ASSERT_TRUE(context2);
+        EXPECT_EQ(2U, context2->getChannel());
+        auto context3 = getContext(lqp3.lease_->addr_);
+        ASSERT_TRUE(context3);
+        EXPECT_EQ(1U, context3->getChannel());
+
+        // Each channel only gets its own contexts.
+        EXPECT_FALSE(mgr_->nextToSendOnChannel(0));
+        EXPECT_EQ(context1, mgr_->nextToSendOnChannel(1));
+        EXPECT_EQ(context2, mgr_->nextToSendOnChannel(2));
+
+        // Stop the mgr.
+        ASSERT_NO_THROW(mgr_->stop());
+    }
+
     /// @brief Exercises PingCheckMgr::nextToSend().
     void testNextToSend() {
         SKIP_IF(notRoot());
@@ -1613,6 +1660,92 @@ public:
         EXPECT_EQ(status, CalloutHandle::NEXT_STEP_CONTINUE);
     }
 
+    /// @brief Exercises shouldPing() with the cache of addresses found free
+    /// and the probes in flight statistic.
+    void testShouldPingFreeCache() {
+        SKIP_IF(notRoot());
+
+        // Mnemonic local.
+        ConstHostPtr empty_host;
+
+        // Create manager with thread-pool size of 3, min_echos 1,
+        // reply_timeout 250 milliseconds.
+        ASSERT_NO_THROW_LOG(createMgr(3, 1, 250));
+        ASSERT_TRUE(mgr_);
+
+        // Make a config remembering the addresses found free for a minute.
+        PingCheckConfigPtr config(new PingCheckConfig());
+        config->setPingFreeCacheSecs(60);
+
+        // Make a lease query pair.
+        auto lqp1 = makeLeaseQueryPair(IOAddress("127.0.0.2"), 111);
+        Lease4Ptr empty_lease;
+        CalloutHandle::CalloutNextStep status;
+
+        // Start the manager, then pause it.
+        ASSERT_NO_THROW_LOG(mgr_->start());
+        ASSERT_NO_THROW_LOG(mgr_->pause());
+
+        // Initialize statistics.
+        using namespace isc::stats;
+        StatsMgr& stats_mgr = StatsMgr::instance();
+        stats_mgr.setValue("ping-check-free-cache-hits", static_cast<int64_t>(0));
+        stats_mgr.setValue("ping-check-probes-in-flight", static_cast<int64_t>(0));
+
+        // Address not found free yet, should return PARK.
+        ASSERT_NO_THROW_LOG(status = mgr_->shouldPing(lqp1.lease_, lqp1.query_,
+                                                      empty_lease, empty_host, config));
+        EXPECT_EQ(status, CalloutHandle::NEXT_STEP_PARK);
+
+        // Address found free by a check, should return CONTINUE.
+        mgr_->getStore()->addFreeAddress(lqp1.lease_->addr_);
+        ASSERT_NO_THROW_LOG(status = mgr_->shouldPing(lqp1.lease_, lqp1.query_,
+                                                      empty_lease, empty_host, config));
+        EXPECT_EQ(status, CalloutHandle::NEXT_STEP_CONTINUE);
+
+        // The ping-check-free-cache-hits stat was bumped by one.
+        ObservationPtr stat_hits = stats_mgr.getObservation("ping-check-free-cache-hits");
+        ASSERT_TRUE(stat_hits);
+        EXPECT_EQ(1, stat_hits->getInteger().first);
+
+        // Address found free too long ago, should return PARK.
+        mgr_->getStore()->addFreeAddress(lqp1.lease_->addr_,
+                                         PingContext::now() - seconds(61));
+        ASSERT_NO_THROW_LOG(status = mgr_->shouldPing(lqp1.lease_, lqp1.query_,
+                                                      empty_lease, empty_host, config));
+        EXPECT_EQ(status, CalloutHandle::NEXT_STEP_PARK);
+
+        // Cache disabled, should return PARK.
+        mgr_->getStore()->addFreeAddress(lqp1.lease_->addr_);
+        config->setPingFreeCacheSecs(0);
+        ASSERT_NO_THROW_LOG(status = mgr_->shouldPing(lqp1.lease_, lqp1.query_,
+                                                      empty_lease, empty_host, config));
+        EXPECT_EQ(status, CalloutHandle::NEXT_STEP_PARK);
+
+        // Starting a ping puts a probe in flight.
+        ASSERT_NO_THROW_LOG(mgr_->startPing(lqp1.lease_, lqp1.query_, parking_lot_));
+        ObservationPtr stat_flight = stats_mgr.getObservation("ping-check-probes-in-flight");
+        ASSERT_TRUE(stat_flight);
+        EXPECT_EQ(1, stat_flight->getInteger().first);
+
+        // Finishing it records the park time and lands the probe.
+        auto context = getContext(lqp1.lease_->addr_);
+        ASSERT_TRUE(context);
+        ASSERT_NO_THROW_LOG(mgr_->finishFree(context));
+        EXPECT_EQ(0, stat_flight->getInteger().first);
+        EXPECT_TRUE(stats_mgr.getObservation("ping-check-park-time"));
+
+        // Flushing forgets the addresses found free.
+        ASSERT_NO_THROW_LOG(mgr_->flush());
+        config->setPingFreeCacheSecs(60);
+        ASSERT_NO_THROW_LOG(status = mgr_->shouldPing(lqp1.lease_, lqp1.query_,
+                                                      empty_lease, empty_host, config));
+        EXPECT_EQ(status, CalloutHandle::NEXT_STEP_PARK);
+
+        // Stop the mgr.
+        ASSERT_NO_THROW(mgr_->stop());
+    }
+
     /// @brief Exercise's getScopedConfig().
     void testGetScopedConfig() {
         CfgMgr::instance().setFamily(AF_INET);
@@ -1821,6 +1954,11 @@ TEST_F(RootPingCheckMgrTest, startPingMT) {
     testStartPing();
 }
 
+TEST_F(RootPingCheckMgrTest, startPingMultipleChannelsMT) {
+    MultiThreadingTest mt;
+    testStartPingMultipleChannels();
+}
+
 TEST_F(RootPingCheckMgrTest, nextToSendST) {
     testNextToSend();
 }
@@ -1911,6 +2049,15 @@ TEST_F(RootPingCheckMgrTest, shouldPingMT) {
     testShouldPingTest();
 }
 
+TEST_F(RootPingCheckMgrTest, shouldPingFreeCacheST) {
+    testShouldPingFreeCache();
+}
+
+TEST_F(RootPingCheckMgrTest, shouldPingFreeCacheMT) {
+    MultiThreadingTest mt;
+    testShouldPingFreeCache();
+}
+
 TEST_F(PingCheckMgrTest, getScopedConfigST) {
     testGetScopedConfig();
 }
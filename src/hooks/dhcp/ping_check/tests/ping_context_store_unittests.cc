@@ -235,6 +235,95 @@ public:
         EXPECT_EQ(start_time + milliseconds(500), context->getSendWaitStart());
     }
 
+    /// @brief Verify that getNextToSend() only returns the contexts of the
+    /// given channel.
+    void getNextToSendByChannelTest() {
+        PingContextStore store;
+        PingContextPtr context;
+
+        // Add the first and the third contexts on channel 1, the second
+        // on channel 0.
+        for (unsigned i = 0; i < leases_.size(); ++i) {
+            ASSERT_NO_THROW_LOG(context = store.addContext(leases_[i], queries_[i], 1, 100,
+                                                           PingContext::EMPTY_LOT(),
+                                                           (i == 1 ? 0 : 1)));
+            ASSERT_TRUE(context);
+            EXPECT_EQ((i == 1 ? 0U : 1U), context->getChannel());
+            usleep(1000);
+        }
+
+        // Channel 0 gets the second context.
+        ASSERT_NO_THROW_LOG(context = store.getNextToSend());
+        ASSERT_TRUE(context);
+        EXPECT_EQ(leases_[1], context->getLease());
+
+        // Channel 1 gets the first context.
+        ASSERT_NO_THROW_LOG(context = store.getNextToSend(1));
+        ASSERT_TRUE(context);
+        EXPECT_EQ(leases_[0], context->getLease());
+
+        // Once the first context is sent channel 1 gets the third one.
+        context->setState(PingContext::SENDING);
+        ASSERT_NO_THROW_LOG(store.updateContext(context));
+        ASSERT_NO_THROW_LOG(context = store.getNextToSend(1));
+        ASSERT_TRUE(context);
+        EXPECT_EQ(leases_[2], context->getLease());
+
+        // Channel 0 has nothing left once the second context is sent.
+        ASSERT_NO_THROW_LOG(context = store.getContextByAddress(leases_[1]->addr_));
+        context->setState(PingContext::SENDING);
+        ASSERT_NO_THROW_LOG(store.updateContext(context));
+        ASSERT_NO_THROW_LOG(context = store.getNextToSend());
+        EXPECT_FALSE(context);
+
+        // Channel 2 has never had anything.
+        ASSERT_NO_THROW_LOG(context = store.getNextToSend(2));
+        EXPECT_FALSE(context);
+        EXPECT_EQ(3U, store.size());
+    }
+
+    /// @brief Verify that the store remembers the addresses found free.
+    void freeAddressesTest() {
+        PingContextStore store;
+        IOAddress address("192.0.2.1");
+        IOAddress other("192.0.2.2");
+
+        // Nothing was found free yet.
+        EXPECT_FALSE(store.isRecentlyFree(address, milliseconds(1000)));
+
+        // An address found free now is recently free.
+        ASSERT_NO_THROW_LOG(store.addFreeAddress(address));
+        EXPECT_TRUE(store.isRecentlyFree(address, milliseconds(1000)));
+        EXPECT_FALSE(store.isRecentlyFree(other, milliseconds(1000)));
+
+        // But not for a shorter age.
+        ASSERT_NO_THROW_LOG(store.addFreeAddress(other, PingContext::now() - milliseconds(500)));
+        EXPECT_TRUE(store.isRecentlyFree(other, milliseconds(1000)));
+        EXPECT_FALSE(store.isRecentlyFree(other, milliseconds(100)));
+
+        // Once too old it is forgotten.
+        EXPECT_FALSE(store.isRecentlyFree(other, milliseconds(1000)));
+
+        // Finding it free again refreshes it.
+        ASSERT_NO_THROW_LOG(store.addFreeAddress(address, PingContext::now() - milliseconds(500)));
+        EXPECT_FALSE(store.isRecentlyFree(address, milliseconds(100)));
+        ASSERT_NO_THROW_LOG(store.addFreeAddress(address));
+        EXPECT_TRUE(store.isRecentlyFree(address, milliseconds(100)));
+
+        // The oldest addresses are forgotten first.
+        IOAddress next("10.0.0.1");
+        for (size_t i = 0; i < PingContextStore::MAX_FREE_ADDRESSES; ++i) {
+            store.addFreeAddress(next);
+            next = IOAddress::increase(next);
+        }
+        EXPECT_FALSE(store.isRecentlyFree(address, milliseconds(1000)));
+        EXPECT_TRUE(store.isRecentlyFree(IOAddress("10.0.0.1"), milliseconds(1000)));
+
+        // Clearing forgets them all.
+        ASSERT_NO_THROW_LOG(store.clearFreeAddresses());
+        EXPECT_FALSE(store.isRecentlyFree(IOAddress("10.0.0.1"), milliseconds(1000)));
+    }
+
     /// @brief Verify that contexts can be fetched based on when they expire using
     /// getExpiresNext() and getExpiredSince().
     void getByExpirationTest() {
@@ -446,6 +535,24 @@ TEST_F(PingContextStoreTest, getNextToSendMultiThreading) {
     getNextToSendTest();
 }
 
+TEST_F(PingContextStoreTest, getNextToSendByChannel) {
+    getNextToSendByChannelTest();
+}
+
+TEST_F(PingContextStoreTest, getNextToSendByChannelMultiThreading) {
+    MultiThreadingTest mt;
+    getNextToSendByChannelTest();
+}
+
+TEST_F(PingContextStoreTest, freeAddresses) {
+    freeAddressesTest();
+}
+
+TEST_F(PingContextStoreTest, freeAddressesMultiThreading) {
+    MultiThreadingTest mt;
+    freeAddressesTest();
+}
+
 TEST_F(PingContextStoreTest, getByExpiration) {
     getByExpirationTest();
 }
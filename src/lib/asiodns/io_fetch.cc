@@ -62,7 +62,7 @@ struct IOFetchData : boost::noncopyable {
     // actually instantiated depends on whether the fetch is over UDP or TCP,
     // which is not known until construction of the IOFetch.  Use of a shared
     // pointer here is merely to ensure deletion when the data object is deleted.
-    boost::scoped_ptr<IOAsioSocket<IOFetch>> socket; // Socket to use for I/O
+    IOFetchSocketPtr              socket;            // Socket to use for I/O
     boost::scoped_ptr<IOEndpoint> remote_snd;        // Where the fetch is sent
     boost::scoped_ptr<IOEndpoint> remote_rcv;        // Where the response came from
     OutputBufferPtr               msgbuf;            // Wire buffer for question
@@ -76,6 +76,7 @@ struct IOFetchData : boost::noncopyable {
     bool                          stopped;           // Have we stopped running?
     int                           timeout;           // Timeout in ms
     bool                          packet;            // true if packet was supplied
+    bool                          reuse;             // true if socket was supplied
 
     // In case we need to log an error, the origin of the last asynchronous
     // I/O is recorded.  To save time and simplify the code, this is recorded
@@ -102,14 +103,16 @@ struct IOFetchData : boost::noncopyable {
     ///        when we terminate.  The caller is responsible for managing this
     ///        object and deleting it if necessary.
     /// @param wait Timeout for the fetch (in ms).
+    /// @param sock Socket to use or null to create a new one.
     ///
     /// TODO: May need to alter constructor (see comment 4 in Trac ticket #554).
     IOFetchData(IOFetch::Protocol proto, const IOServicePtr& service,
                 const IOAddress& address, uint16_t port, OutputBufferPtr& buff,
-                IOFetch::Callback* cb, int wait) :
-        io_service_(service), socket((proto == IOFetch::UDP) ?
-            static_cast<IOAsioSocket<IOFetch>*>(new UDPSocket<IOFetch>(io_service_)) :
-            static_cast<IOAsioSocket<IOFetch>*>(new TCPSocket<IOFetch>(io_service_))),
+                IOFetch::Callback* cb, int wait,
+                const IOFetchSocketPtr& sock = IOFetchSocketPtr()) :
+        io_service_(service), socket(sock ? sock : (proto == IOFetch::UDP) ?
+            IOFetchSocketPtr(new UDPSocket<IOFetch>(io_service_)) :
+            IOFetchSocketPtr(new TCPSocket<IOFetch>(io_service_))),
         remote_snd((proto == IOFetch::UDP) ?
             static_cast<IOEndpoint*>(new UDPEndpoint(address, port)) :
             static_cast<IOEndpoint*>(new TCPEndpoint(address, port))),
@@ -119,7 +122,7 @@ struct IOFetchData : boost::noncopyable {
         msgbuf(new OutputBuffer(512)), received(buff), callback(cb),
         timer(io_service_->getInternalIOService()), protocol(proto), cumulative(0),
         expected(0), offset(0), stopped(false), timeout(wait), packet(false),
-        origin(ASIODNS_UNKNOWN_ORIGIN), staging(), qid(cryptolink::generateQid()) {
+        reuse(static_cast<bool>(sock)), origin(ASIODNS_UNKNOWN_ORIGIN), staging(), qid(cryptolink::generateQid()) {
     }
 
     /// @brief Destructor
@@ -157,6 +160,23 @@ IOFetch::IOFetch(Protocol protocol, const IOServicePtr& service,
     data_->packet = true;
 }
 
+IOFetch::IOFetch(Protocol protocol, const IOServicePtr& service,
+    OutputBufferPtr& outpkt, const IOAddress& address, uint16_t port,
+    OutputBufferPtr& buff, Callback* cb, int wait,
+    const IOFetchSocketPtr& socket) {
+    if (!socket) {
+        isc_throw(isc::BadValue, "IOFetch socket must not be null");
+    }
+    if (socket->getProtocol() !=
+        ((protocol == UDP) ? IPPROTO_UDP : IPPROTO_TCP)) {
+        isc_throw(isc::BadValue, "IOFetch socket protocol does not match");
+    }
+    data_.reset(new IOFetchData(protocol, service, address, port, buff, cb,
+                                wait, socket));
+    data_->msgbuf = outpkt;
+    data_->packet = true;
+}
+
 IOFetch::IOFetch(Protocol protocol, const IOServicePtr& service,
                  ConstMessagePtr query_message, const IOAddress& address,
                  uint16_t port, OutputBufferPtr& buff, Callback* cb, int wait) {
@@ -283,10 +303,13 @@ IOFetch::operator()(boost::system::error_code ec, size_t length) {
                                         data_->expected, data_->received));
         } while (!data_->responseOK());
 
-        // Finished with this socket, so close it.  This will not generate an
-        // I/O error, but reset the origin to unknown in case we change this.
+        // Finished with this socket, so close it unless it belongs to the
+        // caller.  This will not generate an I/O error, but reset the
+        // origin to unknown in case we change this.
         data_->origin = ASIODNS_UNKNOWN_ORIGIN;
-        data_->socket->close();
+        if (!data_->reuse) {
+            data_->socket->close();
+        }
 
         /// We are done
         stop(SUCCESS);
@@ -338,9 +361,12 @@ IOFetch::stop(Result result) {
         }
 
         // Stop requested, cancel and I/O's on the socket and shut it down,
-        // and cancel the timer.
-        data_->socket->cancel();
-        data_->socket->close();
+        // and cancel the timer.  A socket supplied by the caller is kept
+        // open after a successful exchange.
+        if (!data_->reuse || (result != SUCCESS)) {
+            data_->socket->cancel();
+            data_->socket->close();
+        }
 
         data_->timer.cancel();
 
@@ -10,6 +10,7 @@
 #include <config.h>
 
 #include <asiolink/io_address.h>
+#include <asiolink/io_asio_socket.h>
 #include <asiolink/io_service.h>
 #include <dns/message.h>
 #include <dns/question.h>
@@ -27,6 +28,10 @@ namespace asiodns {
 
 // Forward declarations
 struct IOFetchData;
+class IOFetch;
+
+/// @brief Defines a pointer to a socket which can be used by an IOFetch.
+typedef boost::shared_ptr<isc::asiolink::IOAsioSocket<IOFetch>> IOFetchSocketPtr;
 
 /// @brief Upstream Fetch Processing.
 ///
@@ -201,6 +206,43 @@ public:
             Callback* cb,
             int wait = -1);
 
+    /// @brief Constructor.
+    ///
+    /// Same as the previous constructor but the packet is sent over a
+    /// socket provided by the caller instead of a new one.  The socket
+    /// is opened if it is not already open.  It is left open when the
+    /// fetch succeeds so the caller can reuse it for the next exchange
+    /// with the same server, and it is closed on any other result so a
+    /// late response can't be mistaken for the answer to a later query.
+    ///
+    /// @param protocol Fetch protocol, either IOFetch::TCP or IOFetch::UDP
+    /// @param service I/O Service object to handle the asynchronous
+    ///     operations.  The socket must have been created with it.
+    /// @param outpkt Packet to send to upstream server.  Note that the
+    ///     QID (first two bytes of the packet) may be altered in the sending.
+    /// @param address IP address of upstream server.
+    /// @param port Port to which to connect on the upstream server.
+    /// @param buff Output buffer into which the response (in wire format)
+    ///     is written (if a response is received).
+    /// @param cb Callback object containing the callback to be called
+    ///     when we terminate.  The caller is responsible for managing this
+    ///     object and deleting it if necessary.
+    /// @param wait Timeout for the fetch (in ms).  The value of -1
+    ///     indicates no timeout.
+    /// @param socket The socket to use.
+    ///
+    /// @throw isc::BadValue if the socket is null or its protocol does not
+    /// match the fetch protocol.
+    IOFetch(Protocol protocol,
+            const isc::asiolink::IOServicePtr& service,
+            isc::util::OutputBufferPtr& outpkt,
+            const isc::asiolink::IOAddress& address,
+            uint16_t port,
+            isc::util::OutputBufferPtr& buff,
+            Callback* cb,
+            int wait,
+            const IOFetchSocketPtr& socket);
+
     /// @brief Return Current Protocol.
     ///
     /// @return Protocol associated with this IOFetch object.
@@ -30,6 +30,24 @@ using isc::util::int128_t;
 
 namespace {
 const char* const WHITESPACE = " \b\f\n\r\t";
+
+/// @brief Read-only stream buffer over an existing string.
+///
+/// Lets the parser read a (possibly multi-megabyte) JSON text in place
+/// instead of copying it into a std::stringstream first.
+class StringViewBuf : public std::streambuf {
+public:
+    /// @brief Constructor.
+    ///
+    /// @param in The string to read (it must outlive the buffer).
+    explicit StringViewBuf(const std::string& in) {
+        // The get area is never written to: std::streambuf just has no
+        // const interface.
+        char* begin = const_cast<char*>(in.data());
+        setg(begin, begin, begin + in.size());
+    }
+};
+
 } // end anonymous namespace
 
 namespace isc {
@@ -863,8 +881,8 @@ Element::fromJSON(std::istream& in, const std::string& file, int& line,
 
 ElementPtr
 Element::fromJSON(const std::string& in, bool preproc) {
-    std::stringstream ss;
-    ss << in;
+    StringViewBuf buf(in);
+    std::istream ss(&buf);
 
     int line = 1, pos = 1;
     stringstream filtered;
@@ -0,0 +1,745 @@
+// Copyright (C) 2026 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <cc/json_stream.h>
+#include <exceptions/exceptions.h>
+
+#include <boost/lexical_cast.hpp>
+
+#include <iomanip>
+#include <sstream>
+
+using namespace std;
+
+using isc::util::int128_t;
+
+namespace {
+
+/// @brief Input cursor keeping track of the position.
+class Cursor {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param buf The stream buffer to read from.
+    /// @param file The name of the input.
+    Cursor(streambuf* buf, const string& file)
+        : buf_(buf), file_(file), line_(1), pos_(1) {
+    }
+
+    /// @brief Returns the next character without consuming it.
+    int peek() {
+        return (buf_->sgetc());
+    }
+
+    /// @brief Consumes and returns the next character.
+    int get() {
+        int c = buf_->sbumpc();
+        if (c == '\n') {
+            ++line_;
+            pos_ = 1;
+        } else if (c != char_traits<char>::eof()) {
+            ++pos_;
+        }
+        return (c);
+    }
+
+    /// @brief Skips whitespace.
+    void skipWhitespace() {
+        for (;;) {
+            int c = peek();
+            if ((c == ' ') || (c == '\t') || (c == '\n') || (c == '\r') ||
+                (c == '\b') || (c == '\f')) {
+                get();
+            } else {
+                return;
+            }
+        }
+    }
+
+    /// @brief Returns the current position.
+    isc::data::Element::Position position() const {
+        return (isc::data::Element::Position(file_, line_, pos_));
+    }
+
+    /// @brief Throws a JSONError at the current position.
+    ///
+    /// @param error The error message.
+    void error(const string& error) const {
+        stringstream ss;
+        ss << error << " in " << file_ << ":" << line_ << ":" << pos_;
+        isc_throw(isc::data::JSONError, ss.str());
+    }
+
+    /// @brief Reads a string (the current character is the opening quote).
+    ///
+    /// @param[out] value The unescaped string.
+    void readString(string& value) {
+        value.clear();
+        get();
+        for (;;) {
+            int c = get();
+            if (c == char_traits<char>::eof()) {
+                error("Unterminated string");
+            }
+            if (c == '"') {
+                return;
+            }
+            if (c != '\\') {
+                value.push_back(static_cast<char>(c));
+                continue;
+            }
+            c = get();
+            switch (c) {
+            case '"':
+            case '/':
+            case '\\':
+                value.push_back(static_cast<char>(c));
+                break;
+            case 'b':
+                value.push_back('\b');
+                break;
+            case 'f':
+                value.push_back('\f');
+                break;
+            case 'n':
+                value.push_back('\n');
+                break;
+            case 'r':
+                value.push_back('\r');
+                break;
+            case 't':
+                value.push_back('\t');
+                break;
+            case 'u':
+                value.push_back(static_cast<char>(readUnicodeEscape()));
+                break;
+            default:
+                error("Bad escape");
+            }
+        }
+    }
+
+    /// @brief Reads a word made of letters.
+    ///
+    /// @param[out] word The word.
+    void readWord(string& word) {
+        word.clear();
+        while (isalpha(peek())) {
+            word.push_back(static_cast<char>(get()));
+        }
+    }
+
+    /// @brief Reads the characters of a number.
+    ///
+    /// @param[out] number The number text.
+    void readNumber(string& number) {
+        number.clear();
+        for (;;) {
+            int c = peek();
+            if (isdigit(c) || (c == '+') || (c == '-') || (c == '.') ||
+                (c == 'e') || (c == 'E')) {
+                number.push_back(static_cast<char>(get()));
+            } else {
+                return;
+            }
+        }
+    }
+
+private:
+
+    /// @brief Reads the 4 hexadecimal digits of an unicode escape.
+    ///
+    /// As @c Element::fromJSON only \u00XX escapes are supported.
+    ///
+    /// @return The escaped character.
+    int readUnicodeEscape() {
+        if ((get() != '0') || (get() != '0')) {
+            error("Unsupported unicode escape");
+        }
+        int value = 0;
+        for (int i = 0; i < 2; ++i) {
+            int d = get();
+            value <<= 4;
+            if ((d >= '0') && (d <= '9')) {
+                value |= d - '0';
+            } else if ((d >= 'A') && (d <= 'F')) {
+                value |= d - 'A' + 10;
+            } else if ((d >= 'a') && (d <= 'f')) {
+                value |= d - 'a' + 10;
+            } else {
+                error("Not hexadecimal in unicode escape");
+            }
+        }
+        return (value);
+    }
+
+    /// @brief The stream buffer.
+    streambuf* buf_;
+
+    /// @brief The name of the input.
+    string file_;
+
+    /// @brief Current line.
+    uint32_t line_;
+
+    /// @brief Current position within the line.
+    uint32_t pos_;
+};
+
+/// @brief What the reader expects next.
+enum Expect {
+    EXPECT_VALUE,
+    EXPECT_VALUE_OR_END,
+    EXPECT_KEY,
+    EXPECT_KEY_OR_END,
+    EXPECT_COLON,
+    EXPECT_COMMA_OR_END,
+    EXPECT_NOTHING
+};
+
+} // end of anonymous namespace
+
+namespace isc {
+namespace data {
+
+JSONWriter::JSONWriter(ostream& os) : os_(os), stack_(), done_(false) {
+}
+
+void
+JSONWriter::beforeValue() {
+    if (stack_.empty()) {
+        if (done_) {
+            isc_throw(InvalidOperation, "JSON document already written");
+        }
+        done_ = true;
+        return;
+    }
+    Frame& frame = stack_.back();
+    if (frame.map_) {
+        if (!frame.key_) {
+            isc_throw(InvalidOperation, "JSON map value without a key");
+        }
+        frame.key_ = false;
+        return;
+    }
+    if (!frame.first_) {
+        os_ << ", ";
+    }
+    frame.first_ = false;
+}
+
+void
+JSONWriter::startMap() {
+    if (stack_.size() >= Element::MAX_NESTING_LEVEL) {
+        isc_throw(BadValue, "JSON writer: containers nested too deeply");
+    }
+    beforeValue();
+    os_ << "{ ";
+    stack_.push_back(Frame { true, true, false });
+}
+
+void
+JSONWriter::endMap() {
+    endContainer(true);
+}
+
+void
+JSONWriter::startList() {
+    if (stack_.size() >= Element::MAX_NESTING_LEVEL) {
+        isc_throw(BadValue, "JSON writer: containers nested too deeply");
+    }
+    beforeValue();
+    os_ << "[ ";
+    stack_.push_back(Frame { false, true, false });
+}
+
+void
+JSONWriter::endList() {
+    endContainer(false);
+}
+
+void
+JSONWriter::endContainer(bool map) {
+    if (stack_.empty() || (stack_.back().map_ != map)) {
+        isc_throw(InvalidOperation, "JSON writer: no " <<
+                  (map ? "map" : "list") << " to close");
+    }
+    if (stack_.back().key_) {
+        isc_throw(InvalidOperation, "JSON writer: key without a value");
+    }
+    stack_.pop_back();
+    os_ << (map ? " }" : " ]");
+}
+
+void
+JSONWriter::key(const string& name) {
+    if (stack_.empty() || !stack_.back().map_) {
+        isc_throw(InvalidOperation, "JSON writer: key outside a map");
+    }
+    Frame& frame = stack_.back();
+    if (frame.key_) {
+        isc_throw(InvalidOperation, "JSON writer: key without a value");
+    }
+    if (!frame.first_) {
+        os_ << ", ";
+    }
+    frame.first_ = false;
+    frame.key_ = true;
+    // Keys are not escaped by MapElement::toJSON.
+    os_ << "\"" << name << "\": ";
+}
+
+void
+JSONWriter::intValue(int64_t value) {
+    beforeValue();
+    os_ << value;
+}
+
+void
+JSONWriter::bigIntValue(const int128_t& value) {
+    beforeValue();
+    os_ << value;
+}
+
+void
+JSONWriter::doubleValue(double value) {
+    beforeValue();
+    writeDouble(os_, value);
+}
+
+void
+JSONWriter::boolValue(bool value) {
+    beforeValue();
+    os_ << (value ? "true" : "false");
+}
+
+void
+JSONWriter::stringValue(const string& value) {
+    beforeValue();
+    writeString(os_, value);
+}
+
+void
+JSONWriter::nullValue() {
+    beforeValue();
+    os_ << "null";
+}
+
+void
+JSONWriter::element(const ConstElementPtr& element) {
+    if (!element) {
+        nullValue();
+        return;
+    }
+    beforeValue();
+    element->toJSON(os_, Element::MAX_NESTING_LEVEL - stack_.size());
+}
+
+void
+JSONWriter::writeString(ostream& os, const string& value) {
+    os << "\"";
+    // Copy runs of characters which need no escaping at once.
+    size_t start = 0;
+    for (size_t i = 0; i < value.size(); ++i) {
+        const signed char c = value[i];
+        if ((c >= 0x20) && (c != 0x7f) && (c != '"') && (c != '\\')) {
+            continue;
+        }
+        os.write(value.data() + start, i - start);
+        start = i + 1;
+        switch (c) {
+        case '"':
+        case '\\':
+            os << '\\' << c;
+            break;
+        case '\b':
+            os << "\\b";
+            break;
+        case '\f':
+            os << "\\f";
+            break;
+        case '\n':
+            os << "\\n";
+            break;
+        case '\r':
+            os << "\\r";
+            break;
+        case '\t':
+            os << "\\t";
+            break;
+        default:
+            {
+                // Control characters and (as Element::toJSON does) bytes
+                // above 0x7f.
+                ostringstream esc;
+                esc << "\\u" << hex << setw(4) << setfill('0')
+                    << (static_cast<unsigned>(c) & 0xff);
+                os << esc.str();
+            }
+        }
+    }
+    os.write(value.data() + start, value.size() - start);
+    os << "\"";
+}
+
+void
+JSONWriter::writeDouble(ostream& os, double value) {
+    ostringstream val_ss;
+    val_ss << value;
+    os << val_ss.str();
+    if (val_ss.str().find_first_of(".eE") == string::npos) {
+        os << ".0";
+    }
+}
+
+JSONTextListElement::JSONTextListElement(const std::string& text, size_t size,
+                                         const Position& pos)
+    : ListElement(pos), text_(text), size_(size), parsed_(false) {
+}
+
+void
+JSONTextListElement::parse() const {
+    if (parsed_) {
+        return;
+    }
+    // The reader is not recursive so it copes with large texts.
+    ElementBuilder builder;
+    JSONReader(builder).parse(text_);
+    ElementPtr list = builder.getElement();
+    if (!list || (list->getType() != Element::list)) {
+        isc_throw(InvalidOperation, "JSON text of a list element is not "
+                  "a list");
+    }
+    // The items are kept by the base class.
+    const_cast<JSONTextListElement*>(this)->
+        ListElement::setValue(list->listValue());
+    parsed_ = true;
+    std::string().swap(text_);
+}
+
+void
+JSONTextListElement::toJSON(ostream& ss, unsigned level) const {
+    if (parsed_) {
+        ListElement::toJSON(ss, level);
+    } else {
+        ss << text_;
+    }
+}
+
+size_t
+JSONTextListElement::size() const {
+    return (parsed_ ? ListElement::size() : size_);
+}
+
+bool
+JSONTextListElement::empty() const {
+    return (size() == 0);
+}
+
+const vector<ElementPtr>&
+JSONTextListElement::listValue() const {
+    parse();
+    return (ListElement::listValue());
+}
+
+bool
+JSONTextListElement::getValue(vector<ElementPtr>& t) const {
+    parse();
+    return (ListElement::getValue(t));
+}
+
+bool
+JSONTextListElement::setValue(const vector<ElementPtr>& v) {
+    parse();
+    return (ListElement::setValue(v));
+}
+
+ConstElementPtr
+JSONTextListElement::get(const int i) const {
+    parse();
+    return (ListElement::get(i));
+}
+
+ElementPtr
+JSONTextListElement::getNonConst(const int i) const {
+    parse();
+    return (ListElement::getNonConst(i));
+}
+
+void
+JSONTextListElement::set(const size_t i, ElementPtr e) {
+    parse();
+    ListElement::set(i, e);
+}
+
+void
+JSONTextListElement::add(ElementPtr e) {
+    parse();
+    ListElement::add(e);
+}
+
+void
+JSONTextListElement::remove(const int i) {
+    parse();
+    ListElement::remove(i);
+}
+
+bool
+JSONTextListElement::equals(const Element& other, unsigned level) const {
+    parse();
+    return (ListElement::equals(other, level));
+}
+
+JSONReader::JSONReader(JSONHandler& handler, unsigned max_depth)
+    : handler_(handler), max_depth_(max_depth) {
+}
+
+void
+JSONReader::parse(const string& in) {
+    istringstream ss(in);
+    parse(ss, "<string>");
+}
+
+void
+JSONReader::parse(istream& in, const string& file) {
+    Cursor cur(in.rdbuf(), file);
+    // true for a map, false for a list.
+    vector<bool> stack;
+    Expect expect = EXPECT_VALUE;
+    string text;
+    for (;;) {
+        cur.skipWhitespace();
+        const int c = cur.peek();
+        const bool eof = (c == char_traits<char>::eof());
+        switch (expect) {
+        case EXPECT_NOTHING:
+            if (!eof) {
+                cur.error("Extra data");
+            }
+            return;
+
+        case EXPECT_COLON:
+            if (c != ':') {
+                cur.error(eof ? "EOF read, ':' expected" :
+                          string("'") + static_cast<char>(c) +
+                          "' read, ':' expected");
+            }
+            cur.get();
+            expect = EXPECT_VALUE;
+            continue;
+
+        case EXPECT_COMMA_OR_END:
+            if (c == ',') {
+                cur.get();
+                expect = (stack.back() ? EXPECT_KEY : EXPECT_VALUE);
+                continue;
+            }
+            if ((stack.back() && (c == '}')) || (!stack.back() && (c == ']'))) {
+                break;
+            }
+            cur.error(string(eof ? "EOF" : string("'") + static_cast<char>(c) + "'") +
+                      " read, one of \"" + (stack.back() ? ",}" : ",]") +
+                      "\" expected");
+            break;
+
+        case EXPECT_KEY_OR_END:
+            if (c == '}') {
+                break;
+            }
+            // Fall through.
+        case EXPECT_KEY:
+            if (c != '"') {
+                cur.error(eof ? "Unterminated map, <string> or } expected" :
+                          "String expected");
+            }
+            cur.readString(text);
+            handler_.key(text);
+            expect = EXPECT_COLON;
+            continue;
+
+        case EXPECT_VALUE_OR_END:
+            if (c == ']') {
+                break;
+            }
+            // Fall through.
+        case EXPECT_VALUE:
+            {
+                const Element::Position pos = cur.position();
+                if ((c == '{') || (c == '[')) {
+                    if (stack.size() >= max_depth_) {
+                        cur.error("elements nested too deeply");
+                    }
+                    cur.get();
+                    stack.push_back(c == '{');
+                    if (c == '{') {
+                        handler_.startMap(pos);
+                        expect = EXPECT_KEY_OR_END;
+                    } else {
+                        handler_.startList(pos);
+                        expect = EXPECT_VALUE_OR_END;
+                    }
+                    continue;
+                }
+                if (c == '"') {
+                    cur.readString(text);
+                    handler_.stringValue(text, pos);
+                } else if (isdigit(c) || (c == '-') || (c == '.')) {
+                    cur.readNumber(text);
+                    if (((text.size() > 1) && (text[0] == '0') &&
+                         isdigit(text[1])) ||
+                        ((text.size() > 2) && (text[0] == '-') &&
+                         (text[1] == '0') && isdigit(text[2]))) {
+                        cur.error("Illegal leading zeros in '" + text + "'");
+                    }
+                    if (text.find_first_of(".eE") != string::npos) {
+                        try {
+                            handler_.doubleValue(boost::lexical_cast<double>(text), pos);
+                        } catch (const boost::bad_lexical_cast&) {
+                            cur.error("Bad number '" + text + "'");
+                        }
+                    } else {
+                        int64_t value = 0;
+                        bool fits = true;
+                        try {
+                            value = boost::lexical_cast<int64_t>(text);
+                        } catch (const boost::bad_lexical_cast&) {
+                            fits = false;
+                        }
+                        if (fits) {
+                            handler_.intValue(value, pos);
+                        } else {
+                            int128_t big;
+                            try {
+                                big = int128_t(text);
+                            } catch (const exception&) {
+                                cur.error("Number overflow while trying to cast '" +
+                                          text + "'");
+                            }
+                            handler_.bigIntValue(big, pos);
+                        }
+                    }
+                } else if ((c == 't') || (c == 'f')) {
+                    cur.readWord(text);
+                    if (text == "true") {
+                        handler_.boolValue(true, pos);
+                    } else if (text == "false") {
+                        handler_.boolValue(false, pos);
+                    } else {
+                        cur.error("Bad boolean value: " + text);
+                    }
+                } else if (c == 'n') {
+                    cur.readWord(text);
+                    if (text != "null") {
+                        cur.error("Bad null value: " + text);
+                    }
+                    handler_.nullValue(pos);
+                } else if (eof) {
+                    cur.error("EOF read, value expected");
+                } else {
+                    cur.error(string("error: unexpected character ") +
+                              static_cast<char>(c));
+                }
+                expect = (stack.empty() ? EXPECT_NOTHING : EXPECT_COMMA_OR_END);
+                continue;
+            }
+        }
+
+        // Closing the current container.
+        cur.get();
+        if (stack.back()) {
+            handler_.endMap();
+        } else {
+            handler_.endList();
+        }
+        stack.pop_back();
+        expect = (stack.empty() ? EXPECT_NOTHING : EXPECT_COMMA_OR_END);
+    }
+}
+
+ElementBuilder::ElementBuilder() : element_(), stack_(), keys_() {
+}
+
+void
+ElementBuilder::add(const ElementPtr& value) {
+    if (stack_.empty()) {
+        element_ = value;
+    } else if (stack_.back()->getType() == Element::map) {
+        stack_.back()->set(keys_.back(), value);
+    } else {
+        stack_.back()->add(value);
+    }
+}
+
+void
+ElementBuilder::startMap(const Element::Position& pos) {
+    ElementPtr map = Element::createMap(pos);
+    add(map);
+    stack_.push_back(map);
+    keys_.push_back(string());
+}
+
+void
+ElementBuilder::endMap() {
+    stack_.pop_back();
+    keys_.pop_back();
+}
+
+void
+ElementBuilder::startList(const Element::Position& pos) {
+    ElementPtr list = Element::createList(pos);
+    add(list);
+    stack_.push_back(list);
+    keys_.push_back(string());
+}
+
+void
+ElementBuilder::endList() {
+    stack_.pop_back();
+    keys_.pop_back();
+}
+
+void
+ElementBuilder::key(const string& name) {
+    keys_.back() = name;
+}
+
+void
+ElementBuilder::intValue(int64_t value, const Element::Position& pos) {
+    add(Element::create(static_cast<long long int>(value), pos));
+}
+
+void
+ElementBuilder::bigIntValue(const int128_t& value,
+                            const Element::Position& pos) {
+    add(Element::create(value, pos));
+}
+
+void
+ElementBuilder::doubleValue(double value, const Element::Position& pos) {
+    add(Element::create(value, pos));
+}
+
+void
+ElementBuilder::boolValue(bool value, const Element::Position& pos) {
+    add(Element::create(value, pos));
+}
+
+void
+ElementBuilder::stringValue(const string& value,
+                            const Element::Position& pos) {
+    add(Element::create(value, pos));
+}
+
+void
+ElementBuilder::nullValue(const Element::Position& pos) {
+    add(Element::create(pos));
+}
+
+} // end of namespace isc::data
+} // end of namespace isc
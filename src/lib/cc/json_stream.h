@@ -0,0 +1,415 @@
+// Copyright (C) 2026 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef JSON_STREAM_H
+#define JSON_STREAM_H
+
+#include <cc/data.h>
+#include <util/bigints.h>
+
+#include <boost/noncopyable.hpp>
+
+#include <iostream>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace isc {
+namespace data {
+
+/// @brief Streaming JSON writer.
+///
+/// Writes a JSON document to an output stream one token at a time,
+/// without building the @c Element tree first. The output is byte for
+/// byte the same as the one produced by @c Element::toJSON for the
+/// equivalent tree, so it can be used to produce large command responses
+/// (e.g. all leases or all statistics) while keeping only the current
+/// item in memory.
+///
+/// Values inside a map must be preceded by a call to @c key. Misuse
+/// (e.g. a value in a map without a key, or closing a list with
+/// @c endMap) raises an @c InvalidOperation exception.
+class JSONWriter : public boost::noncopyable {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param os The output stream.
+    explicit JSONWriter(std::ostream& os);
+
+    /// @brief Opens a map.
+    void startMap();
+
+    /// @brief Closes the current map.
+    void endMap();
+
+    /// @brief Opens a list.
+    void startList();
+
+    /// @brief Closes the current list.
+    void endList();
+
+    /// @brief Writes the key of the next map entry.
+    ///
+    /// @param name The key.
+    void key(const std::string& name);
+
+    /// @brief Writes an integer.
+    ///
+    /// @param value The value.
+    void intValue(int64_t value);
+
+    /// @brief Writes a big integer.
+    ///
+    /// @param value The value.
+    void bigIntValue(const isc::util::int128_t& value);
+
+    /// @brief Writes a double.
+    ///
+    /// @param value The value.
+    void doubleValue(double value);
+
+    /// @brief Writes a boolean.
+    ///
+    /// @param value The value.
+    void boolValue(bool value);
+
+    /// @brief Writes a string.
+    ///
+    /// @param value The value.
+    void stringValue(const std::string& value);
+
+    /// @brief Writes a null.
+    void nullValue();
+
+    /// @brief Writes an element tree.
+    ///
+    /// Convenience for items which are already available as elements,
+    /// e.g. a lease converted by its @c toElement method.
+    ///
+    /// @param element The element (a null pointer writes null).
+    void element(const ConstElementPtr& element);
+
+    /// @brief Returns the current nesting depth.
+    size_t getDepth() const {
+        return (stack_.size());
+    }
+
+    /// @brief Checks if a complete document was written.
+    ///
+    /// @return true when a value was written and all containers are closed.
+    bool complete() const {
+        return (done_ && stack_.empty());
+    }
+
+    /// @brief Writes a quoted and escaped JSON string.
+    ///
+    /// Uses the same escaping as @c Element::toJSON.
+    ///
+    /// @param os The output stream.
+    /// @param value The string to write.
+    static void writeString(std::ostream& os, const std::string& value);
+
+    /// @brief Writes a double the same way as @c Element::toJSON.
+    ///
+    /// @param os The output stream.
+    /// @param value The value to write.
+    static void writeDouble(std::ostream& os, double value);
+
+private:
+
+    /// @brief Checks a value can be written and emits the separator.
+    void beforeValue();
+
+    /// @brief Closes the current container.
+    ///
+    /// @param map true when closing a map, false when closing a list.
+    void endContainer(bool map);
+
+    /// @brief A currently opened container.
+    struct Frame {
+        /// @brief True for a map, false for a list.
+        bool map_;
+
+        /// @brief True until the first item was written.
+        bool first_;
+
+        /// @brief True when a key is waiting for its value.
+        bool key_;
+    };
+
+    /// @brief The output stream.
+    std::ostream& os_;
+
+    /// @brief Stack of opened containers.
+    std::vector<Frame> stack_;
+
+    /// @brief True when the top level value was started.
+    bool done_;
+};
+
+/// @brief List element holding JSON text written by a @c JSONWriter.
+///
+/// A large list (e.g. all leases) written item by item by a @c JSONWriter
+/// is carried in a command response by this element: @c toJSON copies
+/// the text verbatim so the response is serialized without one element
+/// per item ever being built. The items are parsed from the text only
+/// when they are accessed (e.g. by unit tests or a hook inspecting the
+/// response), after which the element behaves as a regular list.
+class JSONTextListElement : public ListElement {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param text The JSON text of the list (e.g. "[ 1, 2 ]").
+    /// @param size The number of items in the list.
+    /// @param pos The position.
+    JSONTextListElement(const std::string& text, size_t size,
+                        const Position& pos = ZERO_POSITION());
+
+    /// @brief Writes the JSON text.
+    ///
+    /// @param ss The output stream.
+    /// @param level The maximum level of recursion (ignored for the text).
+    void toJSON(std::ostream& ss,
+                unsigned level = MAX_NESTING_LEVEL) const override;
+
+    /// @brief Returns the number of items.
+    size_t size() const override;
+
+    /// @brief Returns true if there are no items.
+    bool empty() const override;
+
+    /// @name Accessors parsing the text at first use.
+    //@{
+    using ListElement::getValue;
+    using ListElement::setValue;
+    using ListElement::get;
+    using ListElement::set;
+    using ListElement::remove;
+    const std::vector<ElementPtr>& listValue() const override;
+    bool getValue(std::vector<ElementPtr>& t) const override;
+    bool setValue(const std::vector<ElementPtr>& v) override;
+    ConstElementPtr get(const int i) const override;
+    ElementPtr getNonConst(const int i) const override;
+    void set(const size_t i, ElementPtr e) override;
+    void add(ElementPtr e) override;
+    void remove(const int i) override;
+    bool equals(const Element& other,
+                unsigned level = MAX_NESTING_LEVEL) const override;
+    //@}
+
+    /// @brief Checks if the items were parsed from the text.
+    bool isParsed() const {
+        return (parsed_);
+    }
+
+private:
+
+    /// @brief Parses the text into the items of the list.
+    void parse() const;
+
+    /// @brief The JSON text (cleared once parsed).
+    mutable std::string text_;
+
+    /// @brief The number of items in the text.
+    size_t size_;
+
+    /// @brief True when the items were parsed.
+    mutable bool parsed_;
+};
+
+/// @brief Receiver of JSON parsing events.
+///
+/// Implementations of this interface are given to the @c JSONReader
+/// which calls them in the document order. A handler can build elements
+/// (see @c ElementBuilder) or process items on the fly, e.g. apply each
+/// entry of a large list without keeping the list in memory.
+class JSONHandler {
+public:
+
+    /// @brief Destructor.
+    virtual ~JSONHandler() {
+    }
+
+    /// @brief A map was opened.
+    ///
+    /// @param pos Position of the map.
+    virtual void startMap(const Element::Position& pos) = 0;
+
+    /// @brief The current map was closed.
+    virtual void endMap() = 0;
+
+    /// @brief A list was opened.
+    ///
+    /// @param pos Position of the list.
+    virtual void startList(const Element::Position& pos) = 0;
+
+    /// @brief The current list was closed.
+    virtual void endList() = 0;
+
+    /// @brief The key of the next map entry was read.
+    ///
+    /// @param name The key.
+    virtual void key(const std::string& name) = 0;
+
+    /// @brief An integer was read.
+    ///
+    /// @param value The value.
+    /// @param pos Position of the value.
+    virtual void intValue(int64_t value, const Element::Position& pos) = 0;
+
+    /// @brief A big integer was read.
+    ///
+    /// @param value The value.
+    /// @param pos Position of the value.
+    virtual void bigIntValue(const isc::util::int128_t& value,
+                             const Element::Position& pos) = 0;
+
+    /// @brief A double was read.
+    ///
+    /// @param value The value.
+    /// @param pos Position of the value.
+    virtual void doubleValue(double value, const Element::Position& pos) = 0;
+
+    /// @brief A boolean was read.
+    ///
+    /// @param value The value.
+    /// @param pos Position of the value.
+    virtual void boolValue(bool value, const Element::Position& pos) = 0;
+
+    /// @brief A string was read.
+    ///
+    /// @param value The value.
+    /// @param pos Position of the value.
+    virtual void stringValue(const std::string& value,
+                             const Element::Position& pos) = 0;
+
+    /// @brief A null was read.
+    ///
+    /// @param pos Position of the value.
+    virtual void nullValue(const Element::Position& pos) = 0;
+};
+
+/// @brief Streaming (event based) JSON reader.
+///
+/// Parses a JSON document and reports its content to a @c JSONHandler
+/// instead of building an @c Element tree. It accepts the same values
+/// as @c Element::fromJSON (including big integers) but it is not
+/// recursive and reads the input through its stream buffer, so it is
+/// suitable for large documents. Comments are not supported: use
+/// @c Element::preprocess first when they can be present.
+///
+/// Errors raise a @c JSONError exception with the position of the
+/// offending character.
+class JSONReader : public boost::noncopyable {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param handler The handler receiving the events.
+    /// @param max_depth Maximum nesting depth of containers.
+    explicit JSONReader(JSONHandler& handler,
+                        unsigned max_depth = Element::MAX_NESTING_LEVEL);
+
+    /// @brief Parses a document from a stream.
+    ///
+    /// The stream must contain one value, optionally surrounded by
+    /// whitespace.
+    ///
+    /// @param in The input stream.
+    /// @param file The name of the input used in positions.
+    /// @throw JSONError on syntax error.
+    void parse(std::istream& in, const std::string& file = "<istream>");
+
+    /// @brief Parses a document from a string.
+    ///
+    /// @param in The input string.
+    /// @throw JSONError on syntax error.
+    void parse(const std::string& in);
+
+private:
+
+    /// @brief The handler.
+    JSONHandler& handler_;
+
+    /// @brief Maximum nesting depth.
+    unsigned max_depth_;
+};
+
+/// @brief JSON handler building an @c Element tree.
+///
+/// Combined with a @c JSONReader this is an alternative to
+/// @c Element::fromJSON for large inputs.
+class ElementBuilder : public JSONHandler {
+public:
+
+    /// @brief Constructor.
+    ElementBuilder();
+
+    /// @brief Returns the built element.
+    ///
+    /// @return The top level element or null if nothing was built.
+    ElementPtr getElement() const {
+        return (element_);
+    }
+
+    /// @brief Handle the start of a map.
+    void startMap(const Element::Position& pos) override;
+
+    /// @brief Handle the end of a map.
+    void endMap() override;
+
+    /// @brief Handle the start of a list.
+    void startList(const Element::Position& pos) override;
+
+    /// @brief Handle the end of a list.
+    void endList() override;
+
+    /// @brief Handle a key.
+    void key(const std::string& name) override;
+
+    /// @brief Handle an integer.
+    void intValue(int64_t value, const Element::Position& pos) override;
+
+    /// @brief Handle a big integer.
+    void bigIntValue(const isc::util::int128_t& value,
+                     const Element::Position& pos) override;
+
+    /// @brief Handle a double.
+    void doubleValue(double value, const Element::Position& pos) override;
+
+    /// @brief Handle a boolean.
+    void boolValue(bool value, const Element::Position& pos) override;
+
+    /// @brief Handle a string.
+    void stringValue(const std::string& value,
+                     const Element::Position& pos) override;
+
+    /// @brief Handle a null.
+    void nullValue(const Element::Position& pos) override;
+
+private:
+
+    /// @brief Adds a value to the current container.
+    ///
+    /// @param value The value.
+    void add(const ElementPtr& value);
+
+    /// @brief The top level element.
+    ElementPtr element_;
+
+    /// @brief Stack of opened containers.
+    std::vector<ElementPtr> stack_;
+
+    /// @brief Stack of keys of the opened maps entries.
+    std::vector<std::string> keys_;
+};
+
+} // end of namespace isc::data
+} // end of namespace isc
+
+#endif // JSON_STREAM_H
@@ -0,0 +1,319 @@
+// Copyright (C) 2026 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <cc/data.h>
+#include <cc/json_stream.h>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+
+using namespace isc;
+using namespace isc::data;
+using namespace std;
+
+using isc::util::int128_t;
+
+namespace {
+
+/// @brief Writes an element using the streaming writer.
+///
+/// Containers are walked item by item so the whole writer API is used.
+void
+writeElement(JSONWriter& writer, const ConstElementPtr& element) {
+    switch (element->getType()) {
+    case Element::integer:
+        writer.intValue(element->intValue());
+        break;
+    case Element::bigint:
+        writer.bigIntValue(element->bigIntValue());
+        break;
+    case Element::real:
+        writer.doubleValue(element->doubleValue());
+        break;
+    case Element::boolean:
+        writer.boolValue(element->boolValue());
+        break;
+    case Element::string:
+        writer.stringValue(element->stringValue());
+        break;
+    case Element::null:
+        writer.nullValue();
+        break;
+    case Element::list:
+        writer.startList();
+        for (auto const& item : element->listValue()) {
+            writeElement(writer, item);
+        }
+        writer.endList();
+        break;
+    case Element::map:
+        writer.startMap();
+        for (auto const& item : element->mapValue()) {
+            writer.key(item.first);
+            writeElement(writer, item.second);
+        }
+        writer.endMap();
+        break;
+    default:
+        FAIL() << "unexpected type";
+    }
+}
+
+/// @brief Documents used by the tests.
+const char* DOCUMENTS[] = {
+    "1",
+    "-12",
+    "1.5",
+    "2.0",
+    "-3e-07",
+    "true",
+    "false",
+    "null",
+    "\"foo\"",
+    "\"esc \\\" \\\\ \\b \\f \\n \\r \\t \\u0001 \\u007f \\u00e9\"",
+    "[  ]",
+    "{  }",
+    "[ 1, 2, [ 3, [  ], { } ] ]",
+    "{ \"a\": 1, \"b\": [ true, null ], \"c\": { \"d\": \"e\" } }",
+    "170141183460469231731687303715884105727",
+    "{ \"big\": -170141183460469231731687303715884105727,"
+    " \"list\": [ 1.25, \"x\", { \"y\": false } ] }",
+};
+
+// Checks the writer produces the same output as toJSON.
+TEST(JSONWriterTest, sameAsToJSON) {
+    for (auto const& doc : DOCUMENTS) {
+        SCOPED_TRACE(doc);
+        ConstElementPtr element = Element::fromJSON(doc);
+        ostringstream os;
+        JSONWriter writer(os);
+        writeElement(writer, element);
+        EXPECT_TRUE(writer.complete());
+        EXPECT_EQ(element->str(), os.str());
+    }
+}
+
+// Checks embedding elements in a streamed document.
+TEST(JSONWriterTest, element) {
+    ostringstream os;
+    JSONWriter writer(os);
+    writer.startMap();
+    writer.key("arguments");
+    writer.startList();
+    writer.element(Element::fromJSON("{ \"a\": [ 1, 2 ] }"));
+    writer.element(ConstElementPtr());
+    writer.endList();
+    writer.key("result");
+    writer.intValue(0);
+    writer.endMap();
+    EXPECT_TRUE(writer.complete());
+    EXPECT_EQ("{ \"arguments\": [ { \"a\": [ 1, 2 ] }, null ], \"result\": 0 }",
+              os.str());
+}
+
+// Checks misuse of the writer is detected.
+TEST(JSONWriterTest, misuse) {
+    ostringstream os;
+    {
+        JSONWriter writer(os);
+        writer.startMap();
+        EXPECT_THROW(writer.intValue(1), InvalidOperation);
+        EXPECT_THROW(writer.endList(), InvalidOperation);
+        writer.key("a");
+        EXPECT_THROW(writer.key("b"), InvalidOperation);
+        EXPECT_THROW(writer.endMap(), InvalidOperation);
+        writer.nullValue();
+        writer.endMap();
+        EXPECT_TRUE(writer.complete());
+        EXPECT_THROW(writer.intValue(1), InvalidOperation);
+    }
+    {
+        JSONWriter writer(os);
+        writer.startList();
+        EXPECT_THROW(writer.key("a"), InvalidOperation);
+        EXPECT_FALSE(writer.complete());
+        EXPECT_EQ(1, writer.getDepth());
+    }
+}
+
+/// @brief Handler counting events without building elements.
+class CountingHandler : public JSONHandler {
+public:
+    CountingHandler() : containers_(0), keys_(0), scalars_(0) {
+    }
+    void startMap(const Element::Position&) override {
+        ++containers_;
+    }
+    void endMap() override {
+    }
+    void startList(const Element::Position&) override {
+        ++containers_;
+    }
+    void endList() override {
+    }
+    void key(const string&) override {
+        ++keys_;
+    }
+    void intValue(int64_t, const Element::Position&) override {
+        ++scalars_;
+    }
+    void bigIntValue(const int128_t&, const Element::Position&) override {
+        ++scalars_;
+    }
+    void doubleValue(double, const Element::Position&) override {
+        ++scalars_;
+    }
+    void boolValue(bool, const Element::Position&) override {
+        ++scalars_;
+    }
+    void stringValue(const string&, const Element::Position&) override {
+        ++scalars_;
+    }
+    void nullValue(const Element::Position&) override {
+        ++scalars_;
+    }
+    size_t containers_;
+    size_t keys_;
+    size_t scalars_;
+};
+
+// Checks the reader with the element builder gives the same as fromJSON.
+TEST(JSONReaderTest, sameAsFromJSON) {
+    for (auto const& doc : DOCUMENTS) {
+        SCOPED_TRACE(doc);
+        ElementBuilder builder;
+        JSONReader reader(builder);
+        ASSERT_NO_THROW(reader.parse(string(doc)));
+        ElementPtr expected = Element::fromJSON(doc);
+        ASSERT_TRUE(builder.getElement());
+        EXPECT_TRUE(expected->equals(*builder.getElement()));
+        EXPECT_EQ(expected->str(), builder.getElement()->str());
+    }
+}
+
+// Checks the reader reports events and positions.
+TEST(JSONReaderTest, events) {
+    CountingHandler handler;
+    JSONReader reader(handler);
+    istringstream in("{\n  \"a\": [ 1, 2.5, \"x\" ],\n  \"b\": { \"c\": null }\n}\n");
+    ASSERT_NO_THROW(reader.parse(in, "test.json"));
+    EXPECT_EQ(3, handler.containers_);
+    EXPECT_EQ(3, handler.keys_);
+    EXPECT_EQ(4, handler.scalars_);
+
+    ElementBuilder builder;
+    JSONReader builder_reader(builder);
+    istringstream in2("{\n  \"a\": [ 1, 2 ]\n}");
+    ASSERT_NO_THROW(builder_reader.parse(in2, "test.json"));
+    ConstElementPtr a = builder.getElement()->get("a");
+    ASSERT_TRUE(a);
+    EXPECT_EQ("test.json:2:8", a->getPosition().str());
+    EXPECT_EQ("test.json:2:13", a->get(1)->getPosition().str());
+}
+
+// Checks the reader detects errors.
+TEST(JSONReaderTest, errors) {
+    const char* bad[] = {
+        "",
+        "   ",
+        "{",
+        "[ 1, 2",
+        "[ 1 2 ]",
+        "{ \"a\" 1 }",
+        "{ 1: 2 }",
+        "{ \"a\": 1, }",
+        "[ 1, ]",
+        "\"abc",
+        "\"\\x\"",
+        "\"\\u0100\"",
+        "\"\\u00zz\"",
+        "tru",
+        "nul",
+        "01",
+        "-01",
+        "1.2.3",
+        "123456789012345678901234567890123456789012345678901234567890",
+        "1 2",
+        "{ } x",
+        "@",
+    };
+    for (auto const& doc : bad) {
+        SCOPED_TRACE(doc);
+        ElementBuilder builder;
+        JSONReader reader(builder);
+        EXPECT_THROW(reader.parse(string(doc)), JSONError);
+    }
+}
+
+// Checks the maximum depth is enforced.
+TEST(JSONReaderTest, depth) {
+    CountingHandler handler;
+    JSONReader reader(handler, 3);
+    EXPECT_NO_THROW(reader.parse(string("[ [ [ 1 ] ] ]")));
+    EXPECT_THROW(reader.parse(string("[ [ [ [ 1 ] ] ] ]")), JSONError);
+
+    // The reader is not recursive so a deep document does not exhaust
+    // the stack with a large limit.
+    string deep(100000, '[');
+    deep += string(100000, ']');
+    JSONReader deep_reader(handler, 100000);
+    EXPECT_NO_THROW(deep_reader.parse(deep));
+}
+
+// Checks a list carried as JSON text.
+TEST(JSONTextListElementTest, basic) {
+    ostringstream os;
+    JSONWriter writer(os);
+    writer.startList();
+    writer.element(Element::fromJSON("{ \"a\": 1 }"));
+    writer.element(Element::fromJSON("{ \"b\": [ true, \"x\" ] }"));
+    writer.endList();
+    ElementPtr list(new JSONTextListElement(os.str(), 2));
+    EXPECT_EQ(Element::list, list->getType());
+    EXPECT_EQ(2U, list->size());
+    EXPECT_FALSE(list->empty());
+
+    // Serializing does not parse the text.
+    ElementPtr map = Element::createMap();
+    map->set("leases", list);
+    EXPECT_EQ("{ \"leases\": [ { \"a\": 1 }, { \"b\": [ true, \"x\" ] } ] }",
+              map->str());
+    JSONTextListElement* text_list =
+        dynamic_cast<JSONTextListElement*>(list.get());
+    ASSERT_TRUE(text_list);
+    EXPECT_FALSE(text_list->isParsed());
+
+    // Accessing the items parses it.
+    ConstElementPtr item = list->get(1);
+    EXPECT_TRUE(text_list->isParsed());
+    ASSERT_TRUE(item);
+    EXPECT_EQ("{ \"b\": [ true, \"x\" ] }", item->str());
+    EXPECT_TRUE(list->equals(*Element::fromJSON(os.str())));
+    EXPECT_TRUE(Element::fromJSON(os.str())->equals(*list));
+
+    // It behaves as a regular list afterwards.
+    list->add(Element::create(3));
+    EXPECT_EQ(3U, list->size());
+    EXPECT_EQ("[ { \"a\": 1 }, { \"b\": [ true, \"x\" ] }, 3 ]",
+              list->str());
+
+    // Modifications parse the text too.
+    ElementPtr other(new JSONTextListElement("[ 1, 2 ]", 2));
+    other->remove(0);
+    EXPECT_EQ("[ 2 ]", other->str());
+
+    // An empty list.
+    ElementPtr empty(new JSONTextListElement("[  ]", 0));
+    EXPECT_TRUE(empty->empty());
+    EXPECT_TRUE(empty->listValue().empty());
+
+    // A text which is not a list is detected when parsed.
+    ElementPtr bad(new JSONTextListElement("{ }", 0));
+    EXPECT_THROW(bad->listValue(), InvalidOperation);
+}
+
+} // end of anonymous namespace
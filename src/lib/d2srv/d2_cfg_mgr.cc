@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2025 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -87,6 +87,13 @@ D2CfgContext::toElement() const {
     const dhcp_ddns::NameChangeFormat& ncr_format = d2_params_->getNcrFormat();
     d2->set("ncr-format",
             Element::create(dhcp_ddns::ncrFormatToString(ncr_format)));
+    // Set multi-threading
+    ElementPtr mt = Element::createMap();
+    mt->set("enable-multi-threading",
+            Element::create(d2_params_->getEnableMultiThreading()));
+    mt->set("thread-pool-size",
+            Element::create(static_cast<int64_t>(d2_params_->getThreadPoolSize())));
+    d2->set("multi-threading", mt);
     // Set forward-ddns
     ElementPtr forward_ddns = Element::createMap();
     forward_ddns->set("ddns-domains", forward_mgr_->toElement());
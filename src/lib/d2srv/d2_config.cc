@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2025 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -32,12 +32,16 @@ D2Params::D2Params(const isc::asiolink::IOAddress& ip_address,
                    const size_t port,
                    const size_t dns_server_timeout,
                    const dhcp_ddns::NameChangeProtocol& ncr_protocol,
-                   const dhcp_ddns::NameChangeFormat& ncr_format)
+                   const dhcp_ddns::NameChangeFormat& ncr_format,
+                   const bool enable_multi_threading,
+                   const size_t thread_pool_size)
     : ip_address_(ip_address),
     port_(port),
     dns_server_timeout_(dns_server_timeout),
     ncr_protocol_(ncr_protocol),
-    ncr_format_(ncr_format) {
+    ncr_format_(ncr_format),
+    enable_multi_threading_(enable_multi_threading),
+    thread_pool_size_(thread_pool_size) {
     validateContents();
 }
 
@@ -45,7 +49,8 @@ D2Params::D2Params()
     : ip_address_(isc::asiolink::IOAddress("127.0.0.1")),
      port_(53001), dns_server_timeout_(500),
      ncr_protocol_(dhcp_ddns::NCR_UDP),
-     ncr_format_(dhcp_ddns::FMT_JSON) {
+     ncr_format_(dhcp_ddns::FMT_JSON),
+     enable_multi_threading_(false), thread_pool_size_(0) {
     validateContents();
 }
 
@@ -80,6 +85,12 @@ D2Params::getConfigSummary() const {
     std::ostringstream s;
     s << "listening on " << getIpAddress() << ", port " << getPort()
       << ", using " << ncrProtocolToString(ncr_protocol_);
+    if (enable_multi_threading_) {
+        s << ", multi-threading enabled";
+        if (thread_pool_size_) {
+            s << " with " << thread_pool_size_ << " threads";
+        }
+    }
     return (s.str());
 }
 
@@ -89,7 +100,9 @@ D2Params::operator == (const D2Params& other) const {
             (port_ == other.port_) &&
             (dns_server_timeout_ == other.dns_server_timeout_) &&
             (ncr_protocol_ == other.ncr_protocol_) &&
-            (ncr_format_ == other.ncr_format_));
+            (ncr_format_ == other.ncr_format_) &&
+            (enable_multi_threading_ == other.enable_multi_threading_) &&
+            (thread_pool_size_ == other.thread_pool_size_));
 }
 
 bool
@@ -107,7 +120,10 @@ D2Params::toText() const {
            << ", ncr-protocol: "
            << dhcp_ddns::ncrProtocolToString(ncr_protocol_)
            << ", ncr-format: " << ncr_format_
-           << dhcp_ddns::ncrFormatToString(ncr_format_);
+           << dhcp_ddns::ncrFormatToString(ncr_format_)
+           << ", enable-multi-threading: "
+           << (enable_multi_threading_ ? "true" : "false")
+           << ", thread-pool-size: " << thread_pool_size_;
 
     return (stream.str());
 }
@@ -206,10 +222,11 @@ DnsServerInfo::DnsServerInfo(const std::string& hostname,
                              uint32_t port,
                              bool enabled,
                              const TSIGKeyInfoPtr& tsig_key_info,
-                             bool inherited_key)
+                             bool inherited_key,
+                             DNSClient::Protocol transport)
     : hostname_(hostname), ip_address_(ip_address), port_(port),
       enabled_(enabled), tsig_key_info_(tsig_key_info),
-      inherited_key_(inherited_key) {
+      inherited_key_(inherited_key), transport_(transport) {
 }
 
 DnsServerInfo::~DnsServerInfo() {
@@ -228,6 +245,9 @@ std::string
 DnsServerInfo::toText() const {
     std::ostringstream stream;
     stream << (getIpAddress().toText()) << " port:" << getPort();
+    if (transport_ == DNSClient::TCP) {
+        stream << " transport:TCP";
+    }
     return (stream.str());
 }
 
@@ -242,6 +262,10 @@ DnsServerInfo::toElement() const {
     result->set("ip-address", Element::create(ip_address_.toText()));
     // Set port
     result->set("port", Element::create(static_cast<int64_t>(port_)));
+    // Set transport
+    result->set("transport",
+                Element::create(std::string(transport_ == DNSClient::TCP ?
+                                            "TCP" : "UDP")));
     // Set key-name
     if (tsig_key_info_ && !inherited_key_) {
         result->set("key-name", Element::create(tsig_key_info_->getName()));
@@ -514,8 +538,20 @@ DnsServerInfoParser::parse(ConstElementPtr server_config,
     std::string ip_address = getString(server_config, "ip-address");
     uint32_t port = getInteger(server_config, "port");
     std::string key_name = getString(server_config, "key-name");
+    std::string transport_str = getString(server_config, "transport");
     ConstElementPtr user_context = server_config->get("user-context");
 
+    DNSClient::Protocol transport;
+    if (boost::iequals(transport_str, "UDP")) {
+        transport = DNSClient::UDP;
+    } else if (boost::iequals(transport_str, "TCP")) {
+        transport = DNSClient::TCP;
+    } else {
+        isc_throw(D2CfgError, "Dns Server : invalid transport: "
+                  << transport_str << ", supported values are UDP and TCP ("
+                  << getPosition("transport", server_config) << ")");
+    }
+
     // Key name is optional. If it is not blank, then find the key in the
     // list of defined keys.
     TSIGKeyInfoPtr tsig_key_info;
@@ -580,7 +616,7 @@ DnsServerInfoParser::parse(ConstElementPtr server_config,
             isc::asiolink::IOAddress io_addr(ip_address);
             server_info.reset(new DnsServerInfo(hostname, io_addr, port,
                                                 true, tsig_key_info,
-                                                inherited_key));
+                                                inherited_key, transport));
         } catch (const isc::asiolink::IOError& ex) {
             isc_throw(D2CfgError, "Dns Server : invalid IP address : "
                       << ip_address
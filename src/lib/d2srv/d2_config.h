@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2025 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -13,6 +13,7 @@
 #include <cc/cfg_to_element.h>
 #include <cc/user_context.h>
 #include <d2srv/d2_tsig_key.h>
+#include <d2srv/dns_client.h>
 #include <dhcpsrv/parsers/dhcp_parsers.h>
 #include <exceptions/exceptions.h>
 #include <process/d_cfg_mgr.h>
@@ -150,6 +151,10 @@ public:
     /// wait for a response to a single DNS update request.
     /// @param ncr_protocol socket protocol D2 should use to receive NCRS
     /// @param ncr_format packet format of the inbound NCRs
+    /// @param enable_multi_threading carry out the DNS updates with
+    /// worker threads
+    /// @param thread_pool_size number of worker threads, 0 to use the
+    /// number of CPUs
     ///
     /// @throw D2CfgError if:
     /// -# ip_address is 0.0.0.0 or ::
@@ -161,7 +166,9 @@ public:
              const size_t port,
              const size_t dns_server_timeout,
              const dhcp_ddns::NameChangeProtocol& ncr_protocol,
-             const dhcp_ddns::NameChangeFormat& ncr_format);
+             const dhcp_ddns::NameChangeFormat& ncr_format,
+             const bool enable_multi_threading = false,
+             const size_t thread_pool_size = 0);
 
     /// @brief Default constructor
     /// The default constructor creates an instance that has updates disabled.
@@ -195,6 +202,19 @@ public:
         return (ncr_format_);
     }
 
+    /// @brief Return whether the DNS updates are carried out by worker
+    /// threads.
+    bool getEnableMultiThreading() const {
+        return (enable_multi_threading_);
+    }
+
+    /// @brief Return the configured number of worker threads.
+    ///
+    /// @return the number of worker threads, 0 to use the number of CPUs.
+    size_t getThreadPoolSize() const {
+        return (thread_pool_size_);
+    }
+
     /// @brief Return summary of the configuration used by D2.
     ///
     /// The returned summary of the configuration is meant to be appended to
@@ -244,6 +264,12 @@ private:
     /// @brief Format of the inbound requests (NCRs).
     /// Currently only JSON format is supported.
     dhcp_ddns::NameChangeFormat ncr_format_;
+
+    /// @brief Carry out the DNS updates with worker threads.
+    bool enable_multi_threading_;
+
+    /// @brief Number of worker threads, 0 to use the number of CPUs.
+    size_t thread_pool_size_;
 };
 
 /// @brief Dumps the contents of a D2Params as text to an output stream
@@ -451,12 +477,15 @@ public:
     /// It defaults to an empty pointer, signifying the server has no key.
     /// @param inherited_key is a flag that indicates whether the key was
     /// inherited from the domain or not. It defaults to true i.e. inherited.
+    /// @param transport is the protocol used to send updates to the server.
+    /// It defaults to UDP.
     DnsServerInfo(const std::string& hostname,
                   isc::asiolink::IOAddress ip_address,
                   uint32_t port = STANDARD_DNS_PORT,
                   bool enabled = true,
                   const TSIGKeyInfoPtr& tsig_key_info = TSIGKeyInfoPtr(),
-                  bool inherited_key = true);
+                  bool inherited_key = true,
+                  DNSClient::Protocol transport = DNSClient::UDP);
 
     /// @brief Destructor
     virtual ~DnsServerInfo();
@@ -482,6 +511,14 @@ public:
         return (ip_address_);
     }
 
+    /// @brief Getter which returns the protocol used to send updates
+    /// to the server.
+    ///
+    /// @return the transport protocol (UDP or TCP).
+    DNSClient::Protocol getTransport() const {
+        return (transport_);
+    }
+
     /// @brief Convenience method which returns whether or not the
     /// server is enabled.
     ///
@@ -545,6 +582,9 @@ private:
     /// @brief Inherited key. When true the key was inherited from the domain,
     /// false otherwise.
     bool inherited_key_;
+
+    /// @brief The protocol used to send updates to the server.
+    DNSClient::Protocol transport_;
 };
 
 std::ostream&
@@ -1,4 +1,4 @@
-// Copyright (C) 2017-2025 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2017-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -14,6 +14,7 @@
 #include <config/unix_command_config.h>
 #include <hooks/hooks_manager.h>
 #include <hooks/hooks_parser.h>
+#include <util/multi_threading_mgr.h>
 
 using namespace isc::asiolink;
 using namespace isc::config;
@@ -91,6 +92,12 @@ const SimpleDefaults D2SimpleParser::D2_GLOBAL_DEFAULTS = {
     { "ncr-format",         Element::string, "JSON" }
 };
 
+/// @brief This table defines default values for multi-threading in D2.
+const SimpleDefaults D2SimpleParser::D2_MULTI_THREADING_DEFAULTS = {
+    { "enable-multi-threading", Element::boolean, "false" },
+    { "thread-pool-size",       Element::integer, "0" }
+};
+
 /// Supplies defaults for ddns-domains list elements (i.e. DdnsDomains)
 const SimpleDefaults D2SimpleParser::TSIG_KEY_DEFAULTS = {
     { "digest-bits", Element::integer, "0" }
@@ -113,8 +120,9 @@ const SimpleDefaults D2SimpleParser::DDNS_DOMAIN_DEFAULTS = {
 /// Supplies defaults for optional values DdnsDomain entries.
 const SimpleDefaults D2SimpleParser::DNS_SERVER_DEFAULTS = {
     { "hostname", Element::string, "" },
-    { "port",     Element::integer, "53" },
-    { "key-name", Element::string, "" }
+    { "port",      Element::integer, "53" },
+    { "key-name",  Element::string, "" },
+    { "transport", Element::string, "UDP" }
 };
 
 /// @}
@@ -129,6 +137,17 @@ D2SimpleParser::setAllDefaults(isc::data::ElementPtr global) {
     // Set global defaults first.
     cnt = setDefaults(global, D2_GLOBAL_DEFAULTS);
 
+    // Set the defaults for multi-threading.  If the element isn't there
+    // we'll add it.
+    ElementPtr mt;
+    if (global->find("multi-threading")) {
+        mt = boost::const_pointer_cast<Element>(global->get("multi-threading"));
+    } else {
+        mt = Element::createMap();
+        global->set("multi-threading", mt);
+    }
+    cnt += setDefaults(mt, D2_MULTI_THREADING_DEFAULTS);
+
     // If the key list is present, set its members' defaults
     if (global->find("tsig-keys")) {
         ConstElementPtr keys = global->get("tsig-keys");
@@ -260,6 +279,15 @@ void D2SimpleParser::parse(const D2CfgContextPtr& ctx,
                   << " (" << config->get("ncr-format")->getPosition() << ")");
     }
 
+    bool enable_multi_threading = false;
+    uint32_t thread_pool_size = 0;
+    ConstElementPtr mt = config->get("multi-threading");
+    if (mt) {
+        enable_multi_threading =
+            SimpleParser::getBoolean(mt, "enable-multi-threading");
+        thread_pool_size = SimpleParser::getUint32(mt, "thread-pool-size");
+    }
+
     ConstElementPtr user = config->get("user-context");
     if (user) {
         ctx->setContext(user);
@@ -332,7 +360,9 @@ void D2SimpleParser::parse(const D2CfgContextPtr& ctx,
     // Attempt to create the new client config. This ought to fly as
     // we already validated everything.
     D2ParamsPtr params(new D2Params(ip_address, port, dns_server_timeout,
-                                    ncr_protocol, ncr_format));
+                                    ncr_protocol, ncr_format,
+                                    enable_multi_threading,
+                                    thread_pool_size));
 
     ctx->getD2Params() = params;
 
@@ -343,7 +373,7 @@ void D2SimpleParser::parse(const D2CfgContextPtr& ctx,
         HooksManager::prepareUnloadLibraries();
         static_cast<void>(HooksManager::unloadLibraries());
         IOServiceMgr::instance().clearIOServices();
-        libraries.loadLibraries(false);
+        libraries.loadLibraries(util::MultiThreadingMgr::instance().getMode());
     }
 }
 
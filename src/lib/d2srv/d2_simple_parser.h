@@ -1,4 +1,4 @@
-// Copyright (C) 2017-2021 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2017-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -33,6 +33,9 @@ public:
     // see d2_simple_parser.cc for comments for those parameters
     static const data::SimpleDefaults D2_GLOBAL_DEFAULTS;
 
+    // Defaults for the multi-threading map
+    static const data::SimpleDefaults D2_MULTI_THREADING_DEFAULTS;
+
     // Defaults for tsig-keys list elements, TSIGKeyInfos
     static const data::SimpleDefaults TSIG_KEY_DEFAULTS;
 
@@ -1,4 +1,4 @@
-// Copyright (C) 2021-2024 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2021-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -43,6 +43,15 @@ D2Stats::key = {
     "update-error"
 };
 
+const list<string>
+D2Stats::server = {
+    "update-sent",
+    "update-success",
+    "update-timeout",
+    "update-error",
+    "update-latency"
+};
+
 void
 D2Stats::init() {
     StatsMgr& stats_mgr = isc::stats::StatsMgr::instance();
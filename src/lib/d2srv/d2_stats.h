@@ -1,4 +1,4 @@
-// Copyright (C) 2021-2024 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2021-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -42,6 +42,15 @@ public:
     /// - update-error
     static const std::list<std::string> key;
 
+    /// @brief Server DNS update statistics names.
+    ///
+    /// - update-sent
+    /// - update-success
+    /// - update-timeout
+    /// - update-error
+    /// - update-latency
+    static const std::list<std::string> server;
+
     /// @brief Initialize D2 statistics.
     ///
     /// @note: Add default samples if needed.
@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2024 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -6,11 +6,18 @@
 
 #include <config.h>
 
+#include <asiolink/asio_wrapper.h>
+#include <asiolink/interval_timer.h>
+#include <asiolink/udp_socket.h>
 #include <d2srv/d2_log.h>
+#include <d2srv/d2_stats.h>
 #include <d2srv/dns_client.h>
 #include <dns/messagerenderer.h>
 #include <stats/stats_mgr.h>
+
+#include <chrono>
 #include <limits>
+#include <sstream>
 
 namespace isc {
 namespace d2 {
@@ -29,13 +36,101 @@ using namespace isc::asiolink;
 using namespace isc::asiodns;
 using namespace isc::dns;
 using namespace isc::stats;
+namespace ph = std::placeholders;
+
+const size_t DNSSocketPool::MAX_IDLE_PER_SERVER_DEFAULT;
+
+DNSSocketPool::DNSSocketPool(const IOServicePtr& io_service,
+                             size_t max_idle_per_server)
+    : io_service_(io_service), max_idle_per_server_(max_idle_per_server),
+      idle_(), connections_(), mutex_() {
+    if (!io_service_) {
+        isc_throw(isc::BadValue, "DNSSocketPool IO service cannot be null");
+    }
+}
+
+DNSSocketPool::~DNSSocketPool() {
+    clear();
+}
+
+IOFetchSocketPtr
+DNSSocketPool::acquire(const IOAddress& address, const uint16_t port) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = idle_.find(ServerKey(address, port));
+        if ((it != idle_.end()) && !it->second.empty()) {
+            IOFetchSocketPtr socket = it->second.back();
+            it->second.pop_back();
+            return (socket);
+        }
+    }
+    return (IOFetchSocketPtr(new UDPSocket<IOFetch>(io_service_)));
+}
+
+void
+DNSSocketPool::release(const IOAddress& address, const uint16_t port,
+                       const IOFetchSocketPtr& socket) {
+    if (!socket) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto& sockets = idle_[ServerKey(address, port)];
+        if (sockets.size() < max_idle_per_server_) {
+            sockets.push_back(socket);
+            return;
+        }
+    }
+    socket->close();
+}
+
+size_t
+DNSSocketPool::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t count = 0;
+    for (auto const& server : idle_) {
+        count += server.second.size();
+    }
+    return (count);
+}
+
+DNSTCPConnectionPtr
+DNSSocketPool::getTCPConnection(const IOAddress& address, const uint16_t port) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    DNSTCPConnectionPtr& connection = connections_[ServerKey(address, port)];
+    if (!connection) {
+        connection.reset(new DNSTCPConnection(io_service_, address, port));
+    }
+    return (connection);
+}
+
+size_t
+DNSSocketPool::getTCPConnectionCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return (connections_.size());
+}
+
+void
+DNSSocketPool::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto const& server : idle_) {
+        for (auto const& socket : server.second) {
+            socket->close();
+        }
+    }
+    idle_.clear();
+    for (auto const& server : connections_) {
+        server.second->close();
+    }
+    connections_.clear();
+}
 
 // This class provides the implementation for the DNSClient. This allows for
 // the separation of the DNSClient interface from the implementation details.
 // Currently, implementation uses IOFetch object to handle asynchronous
-// communication with the DNS. This design may be revisited in the future. If
-// implementation is changed, the DNSClient API will remain unchanged thanks
-// to this separation.
+// communication with the DNS over UDP and a DNSTCPConnection over TCP. This
+// design may be revisited in the future. If implementation is changed, the
+// DNSClient API will remain unchanged thanks to this separation.
 class DNSClientImpl : public asiodns::IOFetch::Callback {
 public:
     /// @brief A buffer holding response from a DNS.
@@ -72,6 +167,41 @@ public:
     /// @brief The list of IOFetch objects.
     std::list<IOFetchPtr> io_fetch_list_;
 
+    /// @brief Pool of sockets to reuse (may be null).
+    DNSSocketPoolPtr socket_pool_;
+
+    /// @brief Socket of the exchange in progress when it comes from the pool.
+    IOFetchSocketPtr socket_;
+
+    /// @brief Address of the server of the exchange in progress.
+    IOAddress ns_addr_;
+
+    /// @brief Port of the server of the exchange in progress.
+    uint16_t ns_port_;
+
+    /// @brief Server name for stats.
+    std::string server_name_;
+
+    /// @brief Time at which the exchange in progress started.
+    std::chrono::steady_clock::time_point start_time_;
+
+    /// @brief TCP connection of the exchange in progress.
+    DNSTCPConnectionPtr tcp_connection_;
+
+    /// @brief TCP connection owned by the client when there is no pool.
+    DNSTCPConnectionPtr own_tcp_connection_;
+
+    /// @brief Message ID of the exchange in progress over TCP.
+    uint16_t tcp_id_;
+
+    /// @brief Timer of the exchange in progress over TCP.
+    std::unique_ptr<asiolink::IntervalTimer> tcp_timer_;
+
+    /// @brief Renderer reused by the successive attempts of the client.
+    ///
+    /// Its compression table keeps its memory between the messages.
+    dns::MessageRenderer renderer_;
+
     /// @brief Constructor.
     ///
     /// @param response_placeholder Message object pointer which will be updated
@@ -81,9 +211,11 @@ public:
     /// if an error occurs. NULL value disables callback invocation.
     /// @param proto caller's preference regarding Transport layer protocol to
     /// be used by DNS Client to communicate with a server.
+    /// @param socket_pool Pool of sockets to reuse (may be null).
     DNSClientImpl(D2UpdateMessagePtr& response_placeholder,
                   DNSClient::Callback* callback,
-                  const DNSClient::Protocol proto);
+                  const DNSClient::Protocol proto,
+                  const DNSSocketPoolPtr& socket_pool);
 
     /// @brief Destructor.
     virtual ~DNSClientImpl();
@@ -113,6 +245,44 @@ public:
                   const unsigned int wait,
                   const D2TsigKeyPtr& tsig_key);
 
+    /// @brief Processes the outcome of an exchange.
+    ///
+    /// It parses the response on success, updates the statistics and calls
+    /// the caller-supplied callback.
+    ///
+    /// @param status The status of the exchange.
+    void complete(DNSClient::Status status);
+
+    /// @brief Starts an exchange over TCP.
+    ///
+    /// @param io_service IO service to be used to run the message exchange.
+    /// @param ns_addr DNS server address.
+    /// @param ns_port DNS server port.
+    /// @param msg_buf The rendered DNS Update message.
+    /// @param wait A timeout (in milliseconds) for the response.
+    ///
+    /// @return false if the message can't be sent on the connection to
+    /// the server because its ID is already in use.
+    bool doTCPUpdate(const asiolink::IOServicePtr& io_service,
+                     const asiolink::IOAddress& ns_addr,
+                     const uint16_t ns_port,
+                     const util::OutputBufferPtr& msg_buf,
+                     const unsigned int wait);
+
+    /// @brief Handles the response to an exchange over TCP.
+    ///
+    /// @param ec The error code.
+    /// @param data The response.
+    /// @param length The length of the response.
+    void tcpResponse(const boost::system::error_code& ec,
+                     const uint8_t* data, size_t length);
+
+    /// @brief Handles the timeout of an exchange over TCP.
+    void tcpTimeout();
+
+    /// @brief Forgets the exchange in progress over TCP.
+    void cancelTCP();
+
     /// @brief This function maps the IO error to the DNSClient error.
     ///
     /// @param result The IOFetch result to be converted to DNSClient status.
@@ -122,20 +292,28 @@ public:
     /// @brief This function updates statistics.
     ///
     /// @param stat The statistic name to be incremented.
-    /// @param update_key The flag indicating if the key statistics should also
-    /// be updated.
+    /// @param update_key The flag indicating if the key and server statistics
+    /// should also be updated.
     void incrStats(const std::string& stat, bool update_key = true);
 
-    /// @brief This function stops the IOFetch objects.
+    /// @brief Records the round trip time of the exchange in progress.
+    void recordLatency();
+
+    /// @brief This function stops the IOFetch objects and the exchange
+    /// over TCP.
     void stop();
 };
 
 DNSClientImpl::DNSClientImpl(D2UpdateMessagePtr& response_placeholder,
                              DNSClient::Callback* callback,
-                             const DNSClient::Protocol proto)
+                             const DNSClient::Protocol proto,
+                             const DNSSocketPoolPtr& socket_pool)
     : in_buf_(new OutputBuffer(DEFAULT_BUFFER_SIZE)),
       response_(response_placeholder), callback_(callback), proto_(proto),
-      stopped_(false) {
+      stopped_(false), socket_pool_(socket_pool), socket_(),
+      ns_addr_(IOAddress::IPV4_ZERO_ADDRESS()), ns_port_(0), server_name_(),
+      start_time_(), tcp_connection_(), own_tcp_connection_(), tcp_id_(0),
+      tcp_timer_(), renderer_() {
 
     // Response should be an empty pointer. It gets populated by the
     // operator() method.
@@ -143,17 +321,6 @@ DNSClientImpl::DNSClientImpl(D2UpdateMessagePtr& response_placeholder,
         isc_throw(isc::BadValue, "Response buffer pointer should be null");
     }
 
-    // @todo Currently we only support UDP. The support for TCP is planned for
-    // the future release.
-    if (proto_ == DNSClient::TCP) {
-        isc_throw(isc::NotImplemented, "TCP is currently not supported as a"
-                  << " Transport protocol for DNS Updates; please use UDP");
-    }
-
-    // Given that we already eliminated the possibility that TCP is used, it
-    // would be sufficient  to check that (proto != DNSClient::UDP). But, once
-    // support TCP is added the check above will disappear and the extra check
-    // will be needed here anyway.
     // Note that cascaded check is used here instead of:
     //   if (proto_ != DNSClient::TCP && proto_ != DNSClient::UDP)..
     // because some versions of GCC compiler complain that check above would
@@ -173,9 +340,19 @@ void DNSClientImpl::stop() {
     for (auto const& io_fetch : io_fetch_list_) {
         io_fetch->stop();
     }
+    // The socket was closed by the stop: it can't go back to the pool.
+    socket_.reset();
+    cancelTCP();
+    if (own_tcp_connection_) {
+        own_tcp_connection_->close();
+    }
 }
 
 DNSClientImpl::~DNSClientImpl() {
+    cancelTCP();
+    if (own_tcp_connection_) {
+        own_tcp_connection_->close();
+    }
 }
 
 void
@@ -186,7 +363,24 @@ DNSClientImpl::operator()(asiodns::IOFetch::Result result) {
     // Get the status from IO. If no success, we just call user's callback
     // and pass the status code.
     DNSClient::Status status = getStatus(result);
+
+    // Give the socket back to the pool before the callback so the next
+    // exchange can reuse it. IOFetch closed it on any failure.
+    if (socket_) {
+        if (status == DNSClient::SUCCESS) {
+            socket_pool_->release(ns_addr_, ns_port_, socket_);
+        }
+        socket_.reset();
+    }
+
+    complete(status);
+}
+
+void
+DNSClientImpl::complete(DNSClient::Status status) {
     if (status == DNSClient::SUCCESS) {
+        recordLatency();
+
         // Allocate a new response message. (Note that Message::fromWire
         // may only be run once per message, so we need to start fresh
         // each time.)
@@ -223,6 +417,88 @@ DNSClientImpl::operator()(asiodns::IOFetch::Result result) {
     }
 }
 
+bool
+DNSClientImpl::doTCPUpdate(const asiolink::IOServicePtr& io_service,
+                           const IOAddress& ns_addr,
+                           const uint16_t ns_port,
+                           const OutputBufferPtr& msg_buf,
+                           const unsigned int wait) {
+    // Only one exchange over TCP at a time.
+    cancelTCP();
+
+    DNSTCPConnectionPtr connection;
+    if (socket_pool_ && (socket_pool_->getIOService() == io_service)) {
+        connection = socket_pool_->getTCPConnection(ns_addr, ns_port);
+    } else {
+        // Keep a connection of our own for the next exchanges.
+        if (!own_tcp_connection_ ||
+            (own_tcp_connection_->getIOService() != io_service) ||
+            (own_tcp_connection_->getAddress() != ns_addr) ||
+            (own_tcp_connection_->getPort() != ns_port)) {
+            if (own_tcp_connection_) {
+                own_tcp_connection_->close();
+            }
+            own_tcp_connection_.reset(new DNSTCPConnection(io_service,
+                                                           ns_addr, ns_port));
+        }
+        connection = own_tcp_connection_;
+    }
+
+    if (!connection->send(msg_buf,
+                          std::bind(&DNSClientImpl::tcpResponse, this,
+                                    ph::_1, ph::_2, ph::_3))) {
+        return (false);
+    }
+    tcp_connection_ = connection;
+    tcp_id_ = (msg_buf->getData()[0] << 8) | msg_buf->getData()[1];
+    tcp_timer_.reset(new IntervalTimer(io_service));
+    tcp_timer_->setup(std::bind(&DNSClientImpl::tcpTimeout, this),
+                      static_cast<long>(wait), IntervalTimer::ONE_SHOT);
+    return (true);
+}
+
+void
+DNSClientImpl::tcpResponse(const boost::system::error_code& ec,
+                           const uint8_t* data, size_t length) {
+    // The connection already forgot the request.
+    tcp_connection_.reset();
+    if (tcp_timer_) {
+        tcp_timer_->cancel();
+    }
+    if (stopped_) {
+        return;
+    }
+    DNSClient::Status status = DNSClient::SUCCESS;
+    if (ec) {
+        status = (ec == boost::asio::error::operation_aborted ?
+                  DNSClient::IO_STOPPED : DNSClient::OTHER);
+    } else {
+        in_buf_->clear();
+        in_buf_->writeData(data, length);
+    }
+    complete(status);
+}
+
+void
+DNSClientImpl::tcpTimeout() {
+    cancelTCP();
+    if (stopped_) {
+        return;
+    }
+    complete(DNSClient::TIMEOUT);
+}
+
+void
+DNSClientImpl::cancelTCP() {
+    if (tcp_connection_) {
+        tcp_connection_->cancel(tcp_id_);
+        tcp_connection_.reset();
+    }
+    if (tcp_timer_) {
+        tcp_timer_->cancel();
+    }
+}
+
 DNSClient::Status
 DNSClientImpl::getStatus(const asiodns::IOFetch::Result result) {
     switch (result) {
@@ -277,13 +553,20 @@ DNSClientImpl::doUpdate(const asiolink::IOServicePtr& io_service,
     // Fortunately, the renderer's API accepts user-supplied buffers. So, let's
     // create our own buffer and pass it to the renderer so as the message is
     // rendered to this buffer. Finally, we pass this buffer to IOFetch.
-    dns::MessageRenderer renderer;
+    // The renderer is given back its own buffer after use, which clears it
+    // for the next attempt.
     OutputBufferPtr msg_buf(new OutputBuffer(DEFAULT_BUFFER_SIZE));
-    renderer.setBuffer(msg_buf.get());
+    renderer_.setBuffer(msg_buf.get());
 
     // Render DNS Update message. This may throw a bunch of exceptions if
     // invalid message object is given.
-    update.toWire(renderer, tsig_context_.get());
+    try {
+        update.toWire(renderer_, tsig_context_.get());
+    } catch (...) {
+        renderer_.setBuffer(0);
+        throw;
+    }
+    renderer_.setBuffer(0);
 
     // IOFetch has all the mechanisms that we need to perform asynchronous
     // communication with the DNS server. The last but one argument points to
@@ -293,8 +576,31 @@ DNSClientImpl::doUpdate(const asiolink::IOServicePtr& io_service,
     // Timeout value is explicitly cast to the int type to avoid warnings about
     // overflows when doing implicit cast. It should have been checked by the
     // caller that the unsigned timeout value will fit into int.
-    IOFetchPtr io_fetch(new IOFetch(IOFetch::UDP, io_service, msg_buf, ns_addr, ns_port,
-                                    in_buf_, this, static_cast<int>(wait)));
+    ns_addr_ = ns_addr;
+    ns_port_ = ns_port;
+    std::ostringstream server_name;
+    server_name << ns_addr.toText() << "#" << ns_port;
+    server_name_ = server_name.str();
+    start_time_ = std::chrono::steady_clock::now();
+    if ((proto_ == DNSClient::TCP) &&
+        doTCPUpdate(io_service, ns_addr, ns_port, msg_buf, wait)) {
+        // Update sent statistics.
+        incrStats("update-sent");
+        incrStats(tsig_key ? "update-signed" : "update-unsigned", false);
+        return;
+    }
+
+    IOFetchPtr io_fetch;
+    if (socket_pool_ && (socket_pool_->getIOService() == io_service)) {
+        socket_ = socket_pool_->acquire(ns_addr, ns_port);
+        io_fetch.reset(new IOFetch(IOFetch::UDP, io_service, msg_buf, ns_addr,
+                                   ns_port, in_buf_, this,
+                                   static_cast<int>(wait), socket_));
+    } else {
+        io_fetch.reset(new IOFetch(IOFetch::UDP, io_service, msg_buf, ns_addr,
+                                   ns_port, in_buf_, this,
+                                   static_cast<int>(wait)));
+    }
     io_fetch_list_.push_back(io_fetch);
 
     // Post the task to the task queue in the IO service. Caller will actually
@@ -314,15 +620,42 @@ void
 DNSClientImpl::incrStats(const std::string& stat, bool update_key) {
     StatsMgr& mgr = StatsMgr::instance();
     mgr.addValue(stat, static_cast<int64_t>(1));
-    if (update_key && !tsig_key_name_.empty()) {
+    if (!update_key) {
+        return;
+    }
+    if (!tsig_key_name_.empty()) {
         mgr.addValue(StatsMgr::generateName("key", tsig_key_name_, stat),
                      static_cast<int64_t>(1));
     }
+    if (!server_name_.empty()) {
+        // Server statistics are created when the server is first used.
+        if (!mgr.getObservation(StatsMgr::generateName("server", server_name_,
+                                                       "update-sent"))) {
+            for (auto const& name : D2Stats::server) {
+                mgr.setValue(StatsMgr::generateName("server", server_name_,
+                                                    name),
+                             static_cast<int64_t>(0));
+            }
+        }
+        mgr.addValue(StatsMgr::generateName("server", server_name_, stat),
+                     static_cast<int64_t>(1));
+    }
+}
+
+void
+DNSClientImpl::recordLatency() {
+    auto const latency = std::chrono::duration_cast<std::chrono::microseconds>
+        (std::chrono::steady_clock::now() - start_time_);
+    StatsMgr::instance().setValue(StatsMgr::generateName("server", server_name_,
+                                                         "update-latency"),
+                                  static_cast<int64_t>(latency.count()));
 }
 
 DNSClient::DNSClient(D2UpdateMessagePtr& response_placeholder,
-                     Callback* callback, const DNSClient::Protocol proto)
-    : impl_(new DNSClientImpl(response_placeholder, callback, proto)) {
+                     Callback* callback, const DNSClient::Protocol proto,
+                     const DNSSocketPoolPtr& socket_pool)
+    : impl_(new DNSClientImpl(response_placeholder, callback, proto,
+                              socket_pool)) {
 }
 
 DNSClient::~DNSClient() {
@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2025 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -11,11 +11,123 @@
 #include <asiodns/io_fetch.h>
 #include <d2srv/d2_tsig_key.h>
 #include <d2srv/d2_update_message.h>
+#include <d2srv/dns_tcp_connection.h>
 #include <util/buffer.h>
 
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
 namespace isc {
 namespace d2 {
 
+/// @brief Pool of open UDP sockets and TCP connections to DNS servers.
+///
+/// Sending each DNS update over a new socket costs a few system calls
+/// and a new ephemeral port per message.  When a pool is given to a
+/// @c DNSClient, the sockets of the successful exchanges are kept open
+/// in the pool and the next exchange with the same server reuses one of
+/// them.  A socket is never shared by two exchanges in progress.
+///
+/// The pool also holds one persistent TCP connection per server which
+/// is shared by all the exchanges over TCP with this server.
+///
+/// The sockets are bound to the IO service of the pool, so an IO service
+/// run by several threads, or each worker thread, must have its own pool.
+class DNSSocketPool : public boost::noncopyable {
+public:
+    /// @brief Default maximum number of idle sockets per server.
+    static const size_t MAX_IDLE_PER_SERVER_DEFAULT = 16;
+
+    /// @brief Constructor.
+    ///
+    /// @param io_service IO service the sockets are created with.
+    /// @param max_idle_per_server Maximum number of idle sockets kept open
+    /// for a server.  Extra sockets are closed when released.
+    ///
+    /// @throw isc::BadValue if the IO service is null.
+    DNSSocketPool(const asiolink::IOServicePtr& io_service,
+                  size_t max_idle_per_server = MAX_IDLE_PER_SERVER_DEFAULT);
+
+    /// @brief Destructor.
+    ///
+    /// Closes the idle sockets.
+    ~DNSSocketPool();
+
+    /// @brief Returns the IO service of the pool.
+    const asiolink::IOServicePtr& getIOService() const {
+        return (io_service_);
+    }
+
+    /// @brief Takes a socket to a server out of the pool.
+    ///
+    /// @param address Address of the server.
+    /// @param port Port of the server.
+    ///
+    /// @return An idle socket previously used with the server if there is
+    /// one, a new (not yet opened) socket otherwise.
+    asiodns::IOFetchSocketPtr acquire(const asiolink::IOAddress& address,
+                                      const uint16_t port);
+
+    /// @brief Gives a socket back to the pool.
+    ///
+    /// It must be called only after a successful exchange: any other
+    /// outcome leaves the socket closed and it should be simply dropped.
+    ///
+    /// @param address Address of the server.
+    /// @param port Port of the server.
+    /// @param socket The socket.
+    void release(const asiolink::IOAddress& address, const uint16_t port,
+                 const asiodns::IOFetchSocketPtr& socket);
+
+    /// @brief Returns the number of idle sockets.
+    size_t size() const;
+
+    /// @brief Returns the TCP connection to a server.
+    ///
+    /// The connection is created on first use and opened by its first
+    /// message.
+    ///
+    /// @param address Address of the server.
+    /// @param port Port of the server.
+    ///
+    /// @return The TCP connection to the server.
+    DNSTCPConnectionPtr getTCPConnection(const asiolink::IOAddress& address,
+                                         const uint16_t port);
+
+    /// @brief Returns the number of TCP connections.
+    size_t getTCPConnectionCount() const;
+
+    /// @brief Closes all idle sockets and TCP connections.
+    void clear();
+
+private:
+    /// @brief Type of the server key: address and port.
+    typedef std::pair<asiolink::IOAddress, uint16_t> ServerKey;
+
+    /// @brief IO service the sockets are created with.
+    asiolink::IOServicePtr io_service_;
+
+    /// @brief Maximum number of idle sockets per server.
+    size_t max_idle_per_server_;
+
+    /// @brief Idle sockets by server.
+    std::map<ServerKey, std::vector<asiodns::IOFetchSocketPtr>> idle_;
+
+    /// @brief TCP connections by server.
+    std::map<ServerKey, DNSTCPConnectionPtr> connections_;
+
+    /// @brief Mutex protecting the idle sockets and the TCP connections.
+    mutable std::mutex mutex_;
+};
+
+/// @brief Defines a pointer to a DNSSocketPool.
+typedef boost::shared_ptr<DNSSocketPool> DNSSocketPoolPtr;
+
 class DNSClient;
 typedef boost::shared_ptr<DNSClient> DNSClientPtr;
 
@@ -37,13 +149,20 @@ class DNSClientImpl;
 /// encapsulate DNS response, through class constructor. An exception will be
 /// thrown if the pointer is not initialized by the caller.
 ///
-/// @todo Ultimately, this class will support both TCP and UDP Transport.
-/// Currently only UDP is supported and can be specified as a preferred
-/// protocol. @c DNSClient constructor will throw an exception if TCP is
-/// specified. Once both protocols are supported, the @c DNSClient logic will
-/// try to obey caller's preference. However, it may use the other protocol if
-/// on its own discretion, when there is a legitimate reason to do so. For
-/// example, if communication with the server using preferred protocol fails.
+/// The outcome of each exchange is counted in the global, per TSIG key and
+/// per server statistics. The latter also record the round trip time of
+/// the last successful exchange.
+///
+/// Both UDP and TCP transports are supported.  Over TCP the messages are
+/// pipelined on a persistent connection to the server (@c DNSTCPConnection)
+/// taken from the socket pool, or owned by the client when there is no
+/// pool.  A message is sent over UDP when its ID is already in use by
+/// another exchange on the connection.  Only one exchange over TCP can be
+/// in progress at a time for a given client.
+///
+/// @todo The @c DNSClient does not fall back to the other protocol when
+/// communication using the preferred protocol fails, e.g. to TCP when a
+/// UDP response is truncated.
 class DNSClient {
 public:
 
@@ -107,8 +226,12 @@ public:
     /// if an error occurs. NULL value disables callback invocation.
     /// @param proto caller's preference regarding Transport layer protocol to
     /// be used by DNS Client to communicate with a server.
+    /// @param socket_pool Pool of sockets to reuse. When null or bound to
+    /// another IO service than the one given to @c doUpdate, each message
+    /// is sent over a new socket.
     DNSClient(D2UpdateMessagePtr& response_placeholder, Callback* callback,
-              const Protocol proto = UDP);
+              const Protocol proto = UDP,
+              const DNSSocketPoolPtr& socket_pool = DNSSocketPoolPtr());
 
     /// @brief Virtual destructor, does nothing.
     ~DNSClient();
@@ -0,0 +1,253 @@
+// Copyright (C) 2026 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <asiolink/asio_wrapper.h>
+#include <d2srv/d2_log.h>
+#include <d2srv/dns_tcp_connection.h>
+#include <exceptions/exceptions.h>
+
+#include <sstream>
+
+using namespace isc::asiolink;
+using namespace isc::util;
+namespace ph = std::placeholders;
+
+namespace isc {
+namespace d2 {
+
+/// @brief Wraps the asio socket so it does not leak into the header.
+class DNSTCPSocket {
+public:
+    /// @brief Constructor.
+    ///
+    /// @param io_service IO service of the socket.
+    explicit DNSTCPSocket(const IOServicePtr& io_service)
+        : socket_(io_service->getInternalIOService()) {
+    }
+
+    /// @brief The asio socket.
+    boost::asio::ip::tcp::socket socket_;
+};
+
+DNSTCPConnection::DNSTCPConnection(const IOServicePtr& io_service,
+                                   const IOAddress& address,
+                                   const uint16_t port)
+    : io_service_(io_service), address_(address), port_(port), socket_(),
+      generation_(0), state_(CLOSED), writing_(false), write_queue_(),
+      pending_(), read_buf_(), connect_count_(0) {
+    if (!io_service_) {
+        isc_throw(isc::BadValue, "DNSTCPConnection IO service cannot be null");
+    }
+}
+
+DNSTCPConnection::~DNSTCPConnection() {
+    closeSocket();
+}
+
+bool
+DNSTCPConnection::send(const OutputBufferPtr& message, const Handler& handler) {
+    size_t const length = message->getLength();
+    if ((length < 2) || (length > 0xffff)) {
+        return (false);
+    }
+    uint16_t const id = (message->getData()[0] << 8) | message->getData()[1];
+    if (pending_.count(id)) {
+        return (false);
+    }
+    pending_[id] = handler;
+
+    OutputBufferPtr framed(new OutputBuffer(length + 2));
+    framed->writeUint16(static_cast<uint16_t>(length));
+    framed->writeData(message->getData(), length);
+    write_queue_.push_back(framed);
+
+    if (state_ == CLOSED) {
+        connect();
+    } else if ((state_ == CONNECTED) && !writing_) {
+        doWrite();
+    }
+    return (true);
+}
+
+void
+DNSTCPConnection::cancel(const uint16_t id) {
+    pending_.erase(id);
+}
+
+void
+DNSTCPConnection::close() {
+    pending_.clear();
+    closeSocket();
+}
+
+void
+DNSTCPConnection::connect() {
+    socket_.reset(new DNSTCPSocket(io_service_));
+    state_ = CONNECTING;
+    boost::asio::ip::tcp::endpoint const
+        endpoint(boost::asio::ip::make_address(address_.toText()), port_);
+    socket_->socket_.async_connect(endpoint,
+        std::bind(&DNSTCPConnection::connectHandler, shared_from_this(),
+                  generation_, ph::_1));
+}
+
+void
+DNSTCPConnection::connectHandler(uint64_t generation,
+                                 const boost::system::error_code& ec) {
+    if (generation != generation_) {
+        return;
+    }
+    if (ec) {
+        fail(ec);
+        return;
+    }
+    state_ = CONNECTED;
+    ++connect_count_;
+
+    // DNS messages are small: do not delay them.
+    boost::system::error_code ignored;
+    socket_->socket_.set_option(boost::asio::ip::tcp::no_delay(true), ignored);
+
+    doReadLength();
+    if (!write_queue_.empty()) {
+        doWrite();
+    }
+}
+
+void
+DNSTCPConnection::doWrite() {
+    writing_ = true;
+    // The handler holds the message so it outlives a cancelled write.
+    OutputBufferPtr const framed = write_queue_.front();
+    boost::asio::async_write(socket_->socket_,
+        boost::asio::buffer(framed->getData(), framed->getLength()),
+        std::bind(&DNSTCPConnection::writeHandler, shared_from_this(),
+                  generation_, framed, ph::_1));
+}
+
+void
+DNSTCPConnection::writeHandler(uint64_t generation, OutputBufferPtr,
+                               const boost::system::error_code& ec) {
+    if (generation != generation_) {
+        return;
+    }
+    writing_ = false;
+    if (ec) {
+        fail(ec);
+        return;
+    }
+    write_queue_.pop_front();
+    if (!write_queue_.empty()) {
+        doWrite();
+    }
+}
+
+void
+DNSTCPConnection::doReadLength() {
+    boost::asio::async_read(socket_->socket_,
+        boost::asio::buffer(length_buf_, sizeof(length_buf_)),
+        std::bind(&DNSTCPConnection::readLengthHandler, shared_from_this(),
+                  generation_, ph::_1));
+}
+
+void
+DNSTCPConnection::readLengthHandler(uint64_t generation,
+                                    const boost::system::error_code& ec) {
+    if (generation != generation_) {
+        return;
+    }
+    if (ec) {
+        if ((ec == boost::asio::error::eof) && pending_.empty() &&
+            write_queue_.empty()) {
+            // The server closed the idle connection: reopen it on demand.
+            closeSocket();
+            return;
+        }
+        fail(ec);
+        return;
+    }
+    read_buf_.resize((length_buf_[0] << 8) | length_buf_[1]);
+    if (read_buf_.empty()) {
+        doReadLength();
+        return;
+    }
+    boost::asio::async_read(socket_->socket_,
+        boost::asio::buffer(&read_buf_[0], read_buf_.size()),
+        std::bind(&DNSTCPConnection::readHandler, shared_from_this(),
+                  generation_, ph::_1));
+}
+
+void
+DNSTCPConnection::readHandler(uint64_t generation,
+                              const boost::system::error_code& ec) {
+    if (generation != generation_) {
+        return;
+    }
+    if (ec) {
+        fail(ec);
+        return;
+    }
+
+    // Keep reading before calling the handler which may send the next
+    // message or close the connection.  The response is moved out of the
+    // read buffer as the next read reuses it.
+    std::vector<uint8_t> response;
+    response.swap(read_buf_);
+    doReadLength();
+
+    if (response.size() < 2) {
+        return;
+    }
+    uint16_t const id = (response[0] << 8) | response[1];
+    auto it = pending_.find(id);
+    if (it == pending_.end()) {
+        // Late response to a request which timed out.
+        return;
+    }
+    Handler const handler = it->second;
+    pending_.erase(it);
+    handler(ec, &response[0], response.size());
+}
+
+void
+DNSTCPConnection::fail(const boost::system::error_code& ec) {
+    LOG_DEBUG(d2_to_dns_logger, isc::log::DBGLVL_TRACE_DETAIL,
+              DHCP_DDNS_TCP_CONNECTION_FAILED)
+        .arg(getServerText())
+        .arg(ec.message());
+    closeSocket();
+    std::map<uint16_t, Handler> failed;
+    failed.swap(pending_);
+    for (auto const& it : failed) {
+        it.second(ec, 0, 0);
+    }
+}
+
+void
+DNSTCPConnection::closeSocket() {
+    // Any completion of the current socket is now stale.
+    ++generation_;
+    if (socket_) {
+        boost::system::error_code ignored;
+        socket_->socket_.close(ignored);
+        socket_.reset();
+    }
+    state_ = CLOSED;
+    writing_ = false;
+    write_queue_.clear();
+}
+
+std::string
+DNSTCPConnection::getServerText() const {
+    std::ostringstream s;
+    s << address_.toText() << "#" << port_;
+    return (s.str());
+}
+
+} // namespace d2
+} // namespace isc
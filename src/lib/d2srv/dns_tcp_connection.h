@@ -0,0 +1,230 @@
+// Copyright (C) 2026 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef DNS_TCP_CONNECTION_H
+#define DNS_TCP_CONNECTION_H
+
+#include <asiolink/io_address.h>
+#include <asiolink/io_service.h>
+#include <util/buffer.h>
+
+#include <boost/enable_shared_from_this.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/system/error_code.hpp>
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace isc {
+namespace d2 {
+
+/// @brief Implementation of the socket of a DNSTCPConnection.
+class DNSTCPSocket;
+
+/// @brief Persistent TCP connection to a DNS server.
+///
+/// DNS messages sent over TCP are prefixed by their two bytes length
+/// (RFC 1035 section 4.2.2) and a server may answer them in any order
+/// (RFC 7766 section 6.2.1.1).  This class keeps one connection open to
+/// a server and pipelines the messages over it: a message is written as
+/// soon as the previous one was, without waiting for its response.  The
+/// responses are matched to the requests by their message ID.
+///
+/// The connection is opened by the first message and closed on any error.
+/// All requests waiting for a response are then failed and the next
+/// message opens a new connection.  When the server closes an idle
+/// connection it is reopened in the same way.
+///
+/// A connection must be used only by the thread running its IO service.
+class DNSTCPConnection :
+    public boost::enable_shared_from_this<DNSTCPConnection>,
+    public boost::noncopyable {
+public:
+    /// @brief Response handler.
+    ///
+    /// It receives an error code and, on success, the response.  The
+    /// response data is valid only for the duration of the call.
+    typedef std::function<void(const boost::system::error_code& ec,
+                               const uint8_t* data,
+                               size_t length)> Handler;
+
+    /// @brief Constructor.
+    ///
+    /// @param io_service IO service used to run the connection.
+    /// @param address Address of the DNS server.
+    /// @param port Port of the DNS server.
+    ///
+    /// @throw isc::BadValue if the IO service is null.
+    DNSTCPConnection(const asiolink::IOServicePtr& io_service,
+                     const asiolink::IOAddress& address,
+                     const uint16_t port);
+
+    /// @brief Destructor.
+    ~DNSTCPConnection();
+
+    /// @brief Returns the IO service of the connection.
+    const asiolink::IOServicePtr& getIOService() const {
+        return (io_service_);
+    }
+
+    /// @brief Returns the address of the DNS server.
+    const asiolink::IOAddress& getAddress() const {
+        return (address_);
+    }
+
+    /// @brief Returns the port of the DNS server.
+    uint16_t getPort() const {
+        return (port_);
+    }
+
+    /// @brief Queues a message.
+    ///
+    /// The handler is called by the IO service when the response is
+    /// received or the connection fails.
+    ///
+    /// @param message The rendered DNS message, without the length prefix.
+    /// @param handler The response handler.
+    ///
+    /// @return false if the message is too short or too large, or if a
+    /// request with the same message ID is already waiting for a response
+    /// on this connection: the message is not sent.
+    bool send(const util::OutputBufferPtr& message, const Handler& handler);
+
+    /// @brief Forgets a request.
+    ///
+    /// Its handler will not be called.  This is used on timeout: the
+    /// message may still be sent and its response is then ignored.
+    ///
+    /// @param id The message ID of the request.
+    void cancel(const uint16_t id);
+
+    /// @brief Closes the connection.
+    ///
+    /// The handlers of the requests waiting for a response are not called.
+    void close();
+
+    /// @brief Checks if the connection is established.
+    bool isConnected() const {
+        return (state_ == CONNECTED);
+    }
+
+    /// @brief Returns the number of requests waiting for a response.
+    size_t getPendingCount() const {
+        return (pending_.size());
+    }
+
+    /// @brief Returns the number of connections established so far.
+    uint64_t getConnectCount() const {
+        return (connect_count_);
+    }
+
+private:
+    /// @brief State of the connection.
+    enum State {
+        CLOSED,
+        CONNECTING,
+        CONNECTED
+    };
+
+    /// @brief Starts connecting.
+    void connect();
+
+    /// @brief Connection completion handler.
+    ///
+    /// @param generation The generation of the socket.
+    /// @param ec The error code.
+    void connectHandler(uint64_t generation,
+                        const boost::system::error_code& ec);
+
+    /// @brief Writes the first queued message.
+    void doWrite();
+
+    /// @brief Write completion handler.
+    ///
+    /// @param generation The generation of the socket.
+    /// @param message The written message.
+    /// @param ec The error code.
+    void writeHandler(uint64_t generation, util::OutputBufferPtr message,
+                      const boost::system::error_code& ec);
+
+    /// @brief Reads the length of the next response.
+    void doReadLength();
+
+    /// @brief Response length read completion handler.
+    ///
+    /// @param generation The generation of the socket.
+    /// @param ec The error code.
+    void readLengthHandler(uint64_t generation,
+                           const boost::system::error_code& ec);
+
+    /// @brief Response read completion handler.
+    ///
+    /// @param generation The generation of the socket.
+    /// @param ec The error code.
+    void readHandler(uint64_t generation,
+                     const boost::system::error_code& ec);
+
+    /// @brief Closes the connection and fails the waiting requests.
+    ///
+    /// @param ec The error to pass to the handlers.
+    void fail(const boost::system::error_code& ec);
+
+    /// @brief Closes the socket.
+    void closeSocket();
+
+    /// @brief Returns the server address and port as text for logging.
+    std::string getServerText() const;
+
+    /// @brief IO service used to run the connection.
+    asiolink::IOServicePtr io_service_;
+
+    /// @brief Address of the DNS server.
+    asiolink::IOAddress address_;
+
+    /// @brief Port of the DNS server.
+    uint16_t port_;
+
+    /// @brief The socket.
+    std::unique_ptr<DNSTCPSocket> socket_;
+
+    /// @brief Socket generation used to ignore stale completions.
+    uint64_t generation_;
+
+    /// @brief State of the connection.
+    State state_;
+
+    /// @brief True while a message is being written.
+    bool writing_;
+
+    /// @brief Messages to write, with their length prefix.
+    std::deque<util::OutputBufferPtr> write_queue_;
+
+    /// @brief Handlers of the requests waiting for a response by ID.
+    std::map<uint16_t, Handler> pending_;
+
+    /// @brief Length of the response being read.
+    uint8_t length_buf_[2];
+
+    /// @brief The response being read.
+    std::vector<uint8_t> read_buf_;
+
+    /// @brief Number of connections established so far.
+    uint64_t connect_count_;
+};
+
+/// @brief Defines a pointer to a DNSTCPConnection.
+typedef boost::shared_ptr<DNSTCPConnection> DNSTCPConnectionPtr;
+
+} // namespace d2
+} // namespace isc
+
+#endif // DNS_TCP_CONNECTION_H
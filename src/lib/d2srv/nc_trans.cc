@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2025 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -76,7 +76,8 @@ NameChangeTransaction(asiolink::IOServicePtr& io_service,
       dns_update_status_(DNSClient::OTHER), dns_update_response_(),
       forward_change_completed_(false), reverse_change_completed_(false),
       current_server_list_(), current_server_(), next_server_pos_(0),
-      update_attempts_(0), cfg_mgr_(cfg_mgr), tsig_key_() {
+      update_attempts_(0), cfg_mgr_(cfg_mgr), tsig_key_(), socket_pool_(),
+      completion_handler_() {
     /// @todo if io_service is NULL we are multi-threading and should
     /// instantiate our own
     if (!io_service_) {
@@ -115,6 +116,9 @@ NameChangeTransaction::startTransaction() {
 
     setNcrStatus(dhcp_ddns::ST_PENDING);
     startModel(READY_ST);
+    if (completion_handler_ && isModelDone()) {
+        completion_handler_();
+    }
 }
 
 void
@@ -131,6 +135,9 @@ NameChangeTransaction::operator()(DNSClient::Status status) {
               .arg(responseString());
 
     runModel(IO_COMPLETED_EVT);
+    if (completion_handler_ && isModelDone()) {
+        completion_handler_();
+    }
 }
 
 std::string
@@ -451,6 +458,16 @@ NameChangeTransaction::getReverseDomain() {
     return (reverse_domain_);
 }
 
+bool
+NameChangeTransaction::isSingleZoneUpdate() {
+    if (!forward_domain_ || !reverse_domain_) {
+        return (false);
+    }
+
+    return (dns::Name(forward_domain_->getName()) ==
+            dns::Name(reverse_domain_->getName()));
+}
+
 void
 NameChangeTransaction::initServerSelection(const DdnsDomainPtr& domain) {
     if (!domain) {
@@ -478,12 +495,9 @@ NameChangeTransaction::selectNextServer() {
                 continue;
             }
 
-            // @todo Protocol is set on DNSClient constructor. We need
-            // to propagate a configuration value downward, probably starting
-            // at global, then domain, finishing by server.
-            // Once that is supported we need to add it here.
             dns_client_.reset(new DNSClient(dns_update_response_, this,
-                                            DNSClient::UDP));
+                                            current_server_->getTransport(),
+                                            socket_pool_));
             ++next_server_pos_;
             return (true);
         }
@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2024 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -18,6 +18,7 @@
 #include <util/state_model.h>
 
 #include <boost/shared_ptr.hpp>
+#include <functional>
 #include <map>
 
 namespace isc {
@@ -153,6 +154,9 @@ public:
     /// @brief Maximum times to attempt a single update on a given server.
     static const unsigned int MAX_UPDATE_TRIES_PER_SERVER = 3;
 
+    /// @brief Type of the callback invoked when the transaction ends.
+    typedef std::function<void()> CompletionHandler;
+
     /// @brief Constructor
     ///
     /// Instantiates a transaction that is ready to be started.
@@ -194,6 +198,35 @@ public:
     /// This method is exception safe.
     virtual void operator()(DNSClient::Status status);
 
+    /// @brief Sets the pool of sockets used to reach the DNS servers.
+    ///
+    /// It applies to the servers selected after the call.
+    ///
+    /// @param socket_pool Pool bound to the IO service of the transaction,
+    /// null to use a new socket for each DNS message.
+    void setSocketPool(const DNSSocketPoolPtr& socket_pool) {
+        socket_pool_ = socket_pool;
+    }
+
+    /// @brief Fetches the IOService the transaction uses for IO processing.
+    ///
+    /// @return returns a const pointer to the IOService.
+    const asiolink::IOServicePtr& getIOService() {
+        return (io_service_);
+    }
+
+    /// @brief Sets the callback invoked when the transaction ends.
+    ///
+    /// The callback is invoked from the thread running the IO service of
+    /// the transaction, as the last action of the handler which ended it.
+    /// It is used by the multi-threaded update manager to wake up the
+    /// main thread.
+    ///
+    /// @param handler The callback.
+    void setCompletionHandler(const CompletionHandler& handler) {
+        completion_handler_ = handler;
+    }
+
 protected:
     /// @brief Send the update request to the current server.
     ///
@@ -358,13 +391,6 @@ protected:
     /// @param value is the new value to assign.
     void setUpdateAttempts(const size_t value);
 
-    /// @brief Fetches the IOService the transaction uses for IO processing.
-    ///
-    /// @return returns a const pointer to the IOService.
-    const asiolink::IOServicePtr& getIOService() {
-        return (io_service_);
-    }
-
     /// @brief Creates a new DNS update request based on the given domain.
     ///
     /// Constructs a new "empty", OUTBOUND, request with the message id set
@@ -474,6 +500,17 @@ public:
     /// the request does not include a reverse change, the pointer will empty.
     DdnsDomainPtr& getReverseDomain();
 
+    /// @brief Checks if the forward and reverse changes belong to one zone.
+    ///
+    /// A DNS update carries the changes of a single zone, so the forward
+    /// and reverse changes can be sent in the same update only when the
+    /// request calls for both and the forward and reverse domains are the
+    /// same zone.
+    ///
+    /// @return true if the request includes both changes and the forward
+    /// and reverse domains have the same name, false otherwise.
+    bool isSingleZoneUpdate();
+
     /// @brief Fetches the currently selected server.
     ///
     /// @return A const pointer reference to the DnsServerInfo of the current
@@ -592,6 +629,12 @@ private:
 
     /// @brief Pointer to the TSIG key which should be used (if any).
     D2TsigKeyPtr tsig_key_;
+
+    /// @brief Pool of sockets to the DNS servers (may be null).
+    DNSSocketPoolPtr socket_pool_;
+
+    /// @brief Callback invoked when the transaction ends (may be empty).
+    CompletionHandler completion_handler_;
 };
 
 /// @brief Defines a pointer to a NameChangeTransaction.
@@ -17,6 +17,9 @@
 #include <boost/scoped_ptr.hpp>
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <iostream>
+
 using namespace std;
 using namespace isc;
 using namespace isc::d2;
@@ -692,5 +695,49 @@ TEST_F(D2UpdateMessageTest, allValidTSIG) {
     }
 }
 
+// This is a performance benchmark that checks how long it takes to render
+// a typical signed DNS update a hundred thousand times, reusing the renderer
+// as the DNS client does.
+TEST_F(D2UpdateMessageTest, DISABLED_performanceToWireTSIG) {
+    D2TsigKey key(Name("test_key"),
+                  TSIGKeyInfo::stringToAlgorithmName(TSIGKeyInfo::HMAC_SHA256_STR),
+                  "random text for secret", 22);
+
+    // An add of a forward mapping (RFC 4703 section 5.3.1).
+    D2UpdateMessage msg;
+    msg.setId(0x1234);
+    msg.setZone(Name("example.com"), RRClass::IN());
+    RRsetPtr prereq(new RRset(Name("myhost.example.com"), RRClass::NONE(),
+                              RRType::ANY(), RRTTL(0)));
+    msg.addRRset(D2UpdateMessage::SECTION_PREREQUISITE, prereq);
+    RRsetPtr update(new RRset(Name("myhost.example.com"), RRClass::IN(),
+                              RRType::A(), RRTTL(3600)));
+    update->addRdata(createRdata(RRType::A(), RRClass::IN(), "192.0.2.1"));
+    msg.addRRset(D2UpdateMessage::SECTION_UPDATE, update);
+    RRsetPtr dhcid(new RRset(Name("myhost.example.com"), RRClass::IN(),
+                             RRType::DHCID(), RRTTL(3600)));
+    dhcid->addRdata(createRdata(RRType::DHCID(), RRClass::IN(),
+                                "AAIBY2/AuCccgoJbsaxcQc9TUapptP69lOjxfNuVAA2kjEA="));
+    msg.addRRset(D2UpdateMessage::SECTION_UPDATE, dhcid);
+
+    const size_t cycles = 100000;
+    MessageRenderer renderer;
+    OutputBuffer buffer(512);
+    auto before = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < cycles; ++i) {
+        TSIGContextPtr context = key.createContext();
+        buffer.clear();
+        renderer.setBuffer(&buffer);
+        msg.toWire(renderer, context.get());
+        renderer.setBuffer(0);
+    }
+    auto after = std::chrono::steady_clock::now();
+
+    auto usecs = std::chrono::duration_cast<std::chrono::microseconds>
+        (after - before).count();
+    std::cout << "Rendering a signed update " << cycles << " times took: "
+              << usecs << " us (" << buffer.getLength() << " bytes)"
+              << std::endl;
+}
 
 } // End of anonymous namespace
@@ -16,6 +16,7 @@
 #include <d2srv/testutils/stats_test_utils.h>
 #include <dns/messagerenderer.h>
 
+#include <boost/asio/ip/tcp.hpp>
 #include <boost/asio/ip/udp.hpp>
 #include <boost/asio/socket_base.hpp>
 #include <boost/scoped_ptr.hpp>
@@ -87,6 +88,9 @@ public:
     /// @brief The flag which specifies if a response is expected.
     bool expect_response_;
 
+    /// @brief The status expected when no response is received.
+    DNSClient::Status no_response_status_;
+
     /// @brief The timeout timer.
     asiolink::IntervalTimer test_timer_;
 
@@ -100,6 +104,21 @@ public:
     /// receiving DNS updates.
     bool go_on_;
 
+    /// @brief The TCP acceptor of the test server.
+    std::unique_ptr<tcp::acceptor> acceptor_;
+
+    /// @brief The TCP connection of the test server.
+    std::unique_ptr<tcp::socket> tcp_socket_;
+
+    /// @brief The number of accepted TCP connections.
+    int accepted_;
+
+    /// @brief The length of the TCP request being read.
+    uint8_t tcp_length_[2];
+
+    /// @brief The TCP requests received and not yet answered.
+    std::vector<std::vector<uint8_t>> tcp_requests_;
+
     /// @brief Constructor
     ///
     /// This constructor overrides the default logging level of asiodns logger to
@@ -110,8 +129,12 @@ public:
     /// become messy if such errors were logged.
     DNSClientTest() : service_(new IOService()), socket_(), endpoint_(),
                       status_(DNSClient::SUCCESS), corrupt_response_(false),
-                      expect_response_(true), test_timer_(service_),
-                      received_(0), expected_(0), go_on_(false) {
+                      expect_response_(true),
+                      no_response_status_(DNSClient::TIMEOUT),
+                      test_timer_(service_),
+                      received_(0), expected_(0), go_on_(false),
+                      acceptor_(), tcp_socket_(), accepted_(0),
+                      tcp_requests_() {
         asiodns::logger.setSeverity(isc::log::INFO);
         response_.reset();
         dns_client_.reset(new DNSClient(response_, this));
@@ -131,6 +154,25 @@ public:
         asiodns::logger.setSeverity(isc::log::DEBUG);
     };
 
+    /// @brief Replaces the DNS client by one using a socket pool.
+    ///
+    /// @param pool The socket pool.
+    /// @param proto The transport protocol.
+    void usePool(const DNSSocketPoolPtr& pool,
+                 DNSClient::Protocol proto = DNSClient::UDP) {
+        dns_client_.reset(new DNSClient(response_, this, proto, pool));
+    }
+
+    /// @brief Creates another DNS client using this fixture as callback.
+    ///
+    /// @param pool The socket pool.
+    /// @param proto The transport protocol.
+    /// @return The new DNS client.
+    DNSClientPtr makeClient(const DNSSocketPoolPtr& pool,
+                            DNSClient::Protocol proto) {
+        return (DNSClientPtr(new DNSClient(response_, this, proto, pool)));
+    }
+
     /// @brief Exchange completion callback
     ///
     /// This callback is called when the exchange with the DNS server is
@@ -163,7 +205,7 @@ public:
             }
         // If we don't expect a response, the status should indicate a timeout.
         } else {
-            EXPECT_EQ(DNSClient::TIMEOUT, status_);
+            EXPECT_EQ(no_response_status_, status_);
 
         }
     }
@@ -225,6 +267,83 @@ public:
         }
     }
 
+    /// @brief Starts a TCP server on the test address and port.
+    ///
+    /// The server accepts connections and answers the requests by
+    /// batches, in the reverse order they were received.  When the batch
+    /// size is zero the requests are never answered.
+    ///
+    /// @param batch The number of requests in a batch.
+    void startTCPServer(size_t batch) {
+        acceptor_.reset(new tcp::acceptor(service_->getInternalIOService()));
+        tcp::endpoint endpoint(make_address(TEST_ADDRESS), TEST_PORT);
+        acceptor_->open(endpoint.protocol());
+        acceptor_->set_option(socket_base::reuse_address(true));
+        acceptor_->bind(endpoint);
+        acceptor_->listen();
+        tcpAccept(batch);
+    }
+
+    /// @brief Accepts the next TCP connection.
+    ///
+    /// @param batch The number of requests in a batch.
+    void tcpAccept(size_t batch) {
+        tcp_socket_.reset(new tcp::socket(service_->getInternalIOService()));
+        acceptor_->async_accept(*tcp_socket_,
+            [this, batch](const boost::system::error_code& ec) {
+                if (!ec) {
+                    ++accepted_;
+                    tcpReadLength(batch);
+                }
+            });
+    }
+
+    /// @brief Reads the length of the next TCP request.
+    ///
+    /// @param batch The number of requests in a batch.
+    void tcpReadLength(size_t batch) {
+        boost::asio::async_read(*tcp_socket_,
+            boost::asio::buffer(tcp_length_, sizeof(tcp_length_)),
+            [this, batch](const boost::system::error_code& ec, size_t) {
+                if (ec) {
+                    return;
+                }
+                tcp_requests_.push_back(std::vector<uint8_t>(
+                    (tcp_length_[0] << 8) | tcp_length_[1]));
+                tcpRead(batch);
+            });
+    }
+
+    /// @brief Reads a TCP request and answers the batch when complete.
+    ///
+    /// @param batch The number of requests in a batch.
+    void tcpRead(size_t batch) {
+        std::vector<uint8_t>& request = tcp_requests_.back();
+        boost::asio::async_read(*tcp_socket_,
+            boost::asio::buffer(&request[0], request.size()),
+            [this, batch](const boost::system::error_code& ec, size_t) {
+                if (ec) {
+                    return;
+                }
+                if (tcp_requests_.size() == batch) {
+                    // Answer in the reverse order: the QR bit is set as
+                    // in udpReceiveHandler.
+                    for (auto it = tcp_requests_.rbegin();
+                         it != tcp_requests_.rend(); ++it) {
+                        OutputBuffer response_buf(it->size() + 2);
+                        response_buf.writeUint16(it->size());
+                        response_buf.writeData(&(*it)[0], it->size());
+                        response_buf.writeUint8At(0xA8, 4);
+                        boost::asio::write(*tcp_socket_,
+                            boost::asio::buffer(response_buf.getData(),
+                                                response_buf.getLength()));
+                    }
+                    tcp_requests_.clear();
+                }
+                tcpReadLength(batch);
+            });
+    }
+
     /// @brief Request handler for testing clients using TSIG
     ///
     /// This callback handler is installed when performing async read on a
@@ -304,11 +423,11 @@ public:
     /// callback object is NULL.
     void runConstructorTest() {
         EXPECT_NO_THROW(DNSClient(response_, NULL, DNSClient::UDP));
+        EXPECT_NO_THROW(DNSClient(response_, NULL, DNSClient::TCP));
 
-        // The TCP Transport is not supported right now. So, we return exception
-        // if caller specified TCP as a preferred protocol. This test will be
-        // removed once TCP is supported.
-        EXPECT_THROW(DNSClient(response_, NULL, DNSClient::TCP),
+        // An invalid protocol is rejected.
+        EXPECT_THROW(DNSClient(response_, NULL,
+                               static_cast<DNSClient::Protocol>(2)),
                      isc::NotImplemented);
     }
 
@@ -675,4 +794,187 @@ TEST_F(DNSClientTest, concurrentSendReceive) {
     checkStats(stats_upd);
 }
 
+// Verify that the socket pool keeps idle sockets per server.
+TEST(DNSSocketPoolTest, acquireRelease) {
+    EXPECT_THROW(DNSSocketPool(IOServicePtr(), 1), BadValue);
+
+    IOServicePtr service(new IOService());
+    DNSSocketPool pool(service, 1);
+    EXPECT_EQ(service, pool.getIOService());
+    EXPECT_EQ(0U, pool.size());
+
+    // A new socket is created when there is no idle socket.
+    IOAddress addr(TEST_ADDRESS);
+    IOFetchSocketPtr socket1 = pool.acquire(addr, TEST_PORT);
+    ASSERT_TRUE(socket1);
+    EXPECT_EQ(IPPROTO_UDP, socket1->getProtocol());
+    IOFetchSocketPtr socket2 = pool.acquire(addr, TEST_PORT);
+    ASSERT_TRUE(socket2);
+    EXPECT_NE(socket1, socket2);
+
+    // Only one idle socket is kept per server.
+    pool.release(addr, TEST_PORT, socket1);
+    pool.release(addr, TEST_PORT, socket2);
+    EXPECT_EQ(1U, pool.size());
+
+    // Idle sockets are per server.
+    IOFetchSocketPtr socket3 = pool.acquire(addr, TEST_PORT + 1);
+    EXPECT_NE(socket1, socket3);
+    pool.release(addr, TEST_PORT + 1, socket3);
+    EXPECT_EQ(2U, pool.size());
+
+    // The idle socket is reused.
+    EXPECT_EQ(socket1, pool.acquire(addr, TEST_PORT));
+    EXPECT_EQ(1U, pool.size());
+
+    pool.clear();
+    EXPECT_EQ(0U, pool.size());
+}
+
+// Verify that a DNSClient using a socket pool reuses its socket and
+// maintains the per server statistics.
+TEST_F(DNSClientTest, sendReceivePooled) {
+    DNSSocketPoolPtr pool(new DNSSocketPool(service_, 1));
+    usePool(pool);
+
+    runSendReceiveTest(false, false);
+    ASSERT_EQ(1U, pool->size());
+    IOFetchSocketPtr socket = pool->acquire(IOAddress(TEST_ADDRESS), TEST_PORT);
+    pool->release(IOAddress(TEST_ADDRESS), TEST_PORT, socket);
+
+    runSendReceiveTest(false, false);
+    EXPECT_EQ(2, received_);
+    EXPECT_EQ(1U, pool->size());
+    EXPECT_EQ(socket, pool->acquire(IOAddress(TEST_ADDRESS), TEST_PORT));
+
+    StatMap stats_server = {
+        { "update-sent", 2},
+        { "update-success", 2},
+        { "update-timeout", 0},
+        { "update-error", 0}
+    };
+    std::string const server("server[127.0.0.1#5381].");
+    for (auto const& it : stats_server) {
+        ObservationPtr obs =
+            StatsMgr::instance().getObservation(server + it.first);
+        ASSERT_TRUE(obs) << server + it.first;
+        EXPECT_EQ(it.second, obs->getInteger().first) << server + it.first;
+    }
+    EXPECT_TRUE(StatsMgr::instance().getObservation(server + "update-latency"));
+}
+
+// Verify that the socket used by a failed exchange is not reused.
+TEST_F(DNSClientTest, timeoutPooled) {
+    DNSSocketPoolPtr pool(new DNSSocketPool(service_, 1));
+    usePool(pool);
+
+    runSendNoReceiveTest();
+    EXPECT_EQ(0U, pool->size());
+    ObservationPtr obs = StatsMgr::instance().
+        getObservation("server[127.0.0.1#5381].update-timeout");
+    ASSERT_TRUE(obs);
+    EXPECT_EQ(1, obs->getInteger().first);
+}
+
+// Verify that DNS updates sent by several clients over TCP are pipelined
+// on a single connection and that the responses are matched by ID.
+TEST_F(DNSClientTest, sendReceiveTCP) {
+    DNSSocketPoolPtr pool(new DNSSocketPool(service_));
+    usePool(pool, DNSClient::TCP);
+    DNSClientPtr other = makeClient(pool, DNSClient::TCP);
+    startTCPServer(2);
+
+    D2UpdateMessage message1(D2UpdateMessage::OUTBOUND);
+    ASSERT_NO_THROW(message1.setRcode(Rcode(Rcode::NOERROR_CODE)));
+    ASSERT_NO_THROW(message1.setZone(Name("example.com"), RRClass::IN()));
+    message1.setId(1);
+    D2UpdateMessage message2(D2UpdateMessage::OUTBOUND);
+    ASSERT_NO_THROW(message2.setRcode(Rcode(Rcode::NOERROR_CODE)));
+    ASSERT_NO_THROW(message2.setZone(Name("example.com"), RRClass::IN()));
+    message2.setId(2);
+
+    // Both updates are written before any response is received. The
+    // server answers them in the reverse order.
+    expected_ = 2;
+    dns_client_->doUpdate(service_, IOAddress(TEST_ADDRESS), TEST_PORT,
+                          message1, 500);
+    other->doUpdate(service_, IOAddress(TEST_ADDRESS), TEST_PORT,
+                    message2, 500);
+    service_->run();
+    service_->stopAndPoll();
+    EXPECT_EQ(2, received_);
+    EXPECT_EQ(1, accepted_);
+
+    // The next updates reuse the connection.
+    expected_ = 4;
+    message1.setId(3);
+    message2.setId(4);
+    dns_client_->doUpdate(service_, IOAddress(TEST_ADDRESS), TEST_PORT,
+                          message1, 500);
+    other->doUpdate(service_, IOAddress(TEST_ADDRESS), TEST_PORT,
+                    message2, 500);
+    service_->run();
+    EXPECT_EQ(4, received_);
+    EXPECT_EQ(1, accepted_);
+
+    ASSERT_EQ(1U, pool->getTCPConnectionCount());
+    DNSTCPConnectionPtr connection =
+        pool->getTCPConnection(IOAddress(TEST_ADDRESS), TEST_PORT);
+    EXPECT_TRUE(connection->isConnected());
+    EXPECT_EQ(1U, connection->getConnectCount());
+    EXPECT_EQ(0U, connection->getPendingCount());
+
+    other->stop();
+    StatMap stats_upd = {
+        { "update-sent", 4},
+        { "update-signed", 0},
+        { "update-unsigned", 4},
+        { "update-success", 4},
+        { "update-timeout", 0},
+        { "update-error", 0}
+    };
+    checkStats(stats_upd);
+}
+
+// Verify that a timeout is reported when no response is received over TCP
+// and that the connection forgets the request.
+TEST_F(DNSClientTest, timeoutTCP) {
+    DNSSocketPoolPtr pool(new DNSSocketPool(service_));
+    usePool(pool, DNSClient::TCP);
+    startTCPServer(0);
+    runSendNoReceiveTest();
+
+    EXPECT_EQ(1, accepted_);
+    DNSTCPConnectionPtr connection =
+        pool->getTCPConnection(IOAddress(TEST_ADDRESS), TEST_PORT);
+    EXPECT_EQ(0U, connection->getPendingCount());
+    StatMap stats_upd = {
+        { "update-sent", 1},
+        { "update-success", 0},
+        { "update-timeout", 1},
+        { "update-error", 0}
+    };
+    checkStats(stats_upd);
+}
+
+// Verify that an error is reported when the TCP connection can't be
+// established.
+TEST_F(DNSClientTest, refusedTCP) {
+    dns_client_.reset();
+    dns_client_ = makeClient(DNSSocketPoolPtr(), DNSClient::TCP);
+    D2UpdateMessage message(D2UpdateMessage::OUTBOUND);
+    ASSERT_NO_THROW(message.setRcode(Rcode(Rcode::NOERROR_CODE)));
+    ASSERT_NO_THROW(message.setZone(Name("example.com"), RRClass::IN()));
+
+    // Nobody listens on the test port.
+    expect_response_ = false;
+    no_response_status_ = DNSClient::OTHER;
+    expected_ = 1;
+    dns_client_->doUpdate(service_, IOAddress(TEST_ADDRESS), TEST_PORT,
+                          message, 500);
+    service_->run();
+    EXPECT_EQ(1, received_);
+    EXPECT_EQ(DNSClient::OTHER, status_);
+}
+
 } // End of anonymous namespace
@@ -0,0 +1,297 @@
+// Copyright (C) 2026 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <asiolink/asio_wrapper.h>
+#include <asiolink/interval_timer.h>
+#include <asiolink/io_service.h>
+#include <d2srv/dns_tcp_connection.h>
+
+#include <boost/asio/ip/tcp.hpp>
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <vector>
+
+using namespace std;
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::d2;
+using namespace isc::util;
+using namespace boost::asio::ip;
+
+namespace {
+
+/// @brief Test timeout (ms).
+const long TEST_TIMEOUT = 5 * 1000;
+
+/// @brief Test fixture for the DNSTCPConnection class.
+///
+/// It provides a TCP server which answers the requests of a batch in the
+/// reverse order, with the request itself.
+class DNSTCPConnectionTest : public ::testing::Test {
+public:
+    /// @brief Constructor.
+    DNSTCPConnectionTest()
+        : service_(new IOService()), test_timer_(service_),
+          acceptor_(service_->getInternalIOService(),
+                    tcp::endpoint(make_address("127.0.0.1"), 0)),
+          socket_(), accepted_(0), requests_() {
+        test_timer_.setup(std::bind(&DNSTCPConnectionTest::timeoutHandler,
+                                    this), TEST_TIMEOUT);
+    }
+
+    /// @brief Destructor.
+    virtual ~DNSTCPConnectionTest() {
+        test_timer_.cancel();
+        service_->stopAndPoll();
+    }
+
+    /// @brief Handler invoked when the test timeout is hit.
+    void timeoutHandler() {
+        service_->stop();
+        FAIL() << "Test timeout hit.";
+    }
+
+    /// @brief Returns the port of the server.
+    uint16_t getPort() const {
+        return (acceptor_.local_endpoint().port());
+    }
+
+    /// @brief Accepts the next connection.
+    ///
+    /// @param batch The number of requests in a batch, 0 to never answer.
+    void accept(size_t batch) {
+        socket_.reset(new tcp::socket(service_->getInternalIOService()));
+        acceptor_.async_accept(*socket_,
+            [this, batch](const boost::system::error_code& ec) {
+                if (!ec) {
+                    ++accepted_;
+                    readLength(batch);
+                }
+            });
+    }
+
+    /// @brief Reads the length of the next request.
+    ///
+    /// @param batch The number of requests in a batch.
+    void readLength(size_t batch) {
+        boost::asio::async_read(*socket_,
+            boost::asio::buffer(length_, sizeof(length_)),
+            [this, batch](const boost::system::error_code& ec, size_t) {
+                if (ec) {
+                    return;
+                }
+                requests_.push_back(vector<uint8_t>((length_[0] << 8) |
+                                                    length_[1]));
+                read(batch);
+            });
+    }
+
+    /// @brief Reads a request and answers the batch when complete.
+    ///
+    /// @param batch The number of requests in a batch.
+    void read(size_t batch) {
+        vector<uint8_t>& request = requests_.back();
+        boost::asio::async_read(*socket_,
+            boost::asio::buffer(&request[0], request.size()),
+            [this, batch](const boost::system::error_code& ec, size_t) {
+                if (ec) {
+                    return;
+                }
+                if (requests_.size() == batch) {
+                    for (auto it = requests_.rbegin(); it != requests_.rend();
+                         ++it) {
+                        OutputBuffer response(it->size() + 2);
+                        response.writeUint16(it->size());
+                        response.writeData(&(*it)[0], it->size());
+                        boost::asio::write(*socket_,
+                            boost::asio::buffer(response.getData(),
+                                                response.getLength()));
+                    }
+                    requests_.clear();
+                }
+                readLength(batch);
+            });
+    }
+
+    /// @brief Makes a message.
+    ///
+    /// @param id The message ID.
+    /// @return A 4 bytes message: the ID followed by 7 and the low byte
+    /// of the ID.
+    OutputBufferPtr makeMessage(uint16_t id) {
+        OutputBufferPtr message(new OutputBuffer(4));
+        message->writeUint16(id);
+        message->writeUint8(7);
+        message->writeUint8(id & 0xff);
+        return (message);
+    }
+
+    /// @brief Runs the IO service until a condition is true.
+    ///
+    /// @param cond The condition.
+    void runUntil(const std::function<bool()>& cond) {
+        while (!cond() && !service_->stopped()) {
+            service_->runOne();
+        }
+    }
+
+    /// @brief The IO service.
+    IOServicePtr service_;
+
+    /// @brief The test timeout timer.
+    IntervalTimer test_timer_;
+
+    /// @brief The server acceptor.
+    tcp::acceptor acceptor_;
+
+    /// @brief The server side of the connection.
+    unique_ptr<tcp::socket> socket_;
+
+    /// @brief The number of accepted connections.
+    int accepted_;
+
+    /// @brief The length of the request being read.
+    uint8_t length_[2];
+
+    /// @brief The requests received and not yet answered.
+    vector<vector<uint8_t>> requests_;
+};
+
+// Verify that the constructor rejects a null IO service.
+TEST_F(DNSTCPConnectionTest, constructor) {
+    EXPECT_THROW(DNSTCPConnection(IOServicePtr(), IOAddress("127.0.0.1"), 53),
+                 BadValue);
+    DNSTCPConnectionPtr connection;
+    ASSERT_NO_THROW(connection.reset(new DNSTCPConnection(service_,
+        IOAddress("127.0.0.1"), 53)));
+    EXPECT_EQ(service_, connection->getIOService());
+    EXPECT_EQ("127.0.0.1", connection->getAddress().toText());
+    EXPECT_EQ(53, connection->getPort());
+    EXPECT_FALSE(connection->isConnected());
+    EXPECT_EQ(0U, connection->getPendingCount());
+}
+
+// Verify that messages are pipelined and that the responses are matched
+// by ID.
+TEST_F(DNSTCPConnectionTest, pipeline) {
+    accept(2);
+    DNSTCPConnectionPtr connection(new DNSTCPConnection(service_,
+        IOAddress("127.0.0.1"), getPort()));
+    vector<uint16_t> received;
+    auto handler = [&received](const boost::system::error_code& ec,
+                               const uint8_t* data, size_t length) {
+        EXPECT_FALSE(ec);
+        ASSERT_EQ(4U, length);
+        EXPECT_EQ(7, data[2]);
+        EXPECT_EQ(data[1], data[3]);
+        received.push_back((data[0] << 8) | data[1]);
+    };
+    EXPECT_TRUE(connection->send(makeMessage(1), handler));
+    EXPECT_TRUE(connection->send(makeMessage(2), handler));
+
+    // A message with an ID in use is refused.
+    EXPECT_FALSE(connection->send(makeMessage(2), handler));
+    EXPECT_EQ(2U, connection->getPendingCount());
+
+    // The server answers once it got both messages, in reverse order.
+    runUntil([&received]() { return (received.size() == 2); });
+    ASSERT_EQ(2U, received.size());
+    EXPECT_EQ(2, received[0]);
+    EXPECT_EQ(1, received[1]);
+    EXPECT_EQ(1, accepted_);
+    EXPECT_TRUE(connection->isConnected());
+    EXPECT_EQ(0U, connection->getPendingCount());
+
+    // The connection is reused.
+    EXPECT_TRUE(connection->send(makeMessage(3), handler));
+    EXPECT_TRUE(connection->send(makeMessage(4), handler));
+    runUntil([&received]() { return (received.size() == 4); });
+    EXPECT_EQ(1, accepted_);
+    EXPECT_EQ(1U, connection->getConnectCount());
+    connection->close();
+}
+
+// Verify that a closed idle connection is reopened and that a failure
+// is reported to the waiting requests.
+TEST_F(DNSTCPConnectionTest, reconnect) {
+    accept(1);
+    DNSTCPConnectionPtr connection(new DNSTCPConnection(service_,
+        IOAddress("127.0.0.1"), getPort()));
+    size_t responses = 0;
+    EXPECT_TRUE(connection->send(makeMessage(1),
+        [&responses](const boost::system::error_code& ec, const uint8_t*,
+                     size_t) {
+            EXPECT_FALSE(ec);
+            ++responses;
+        }));
+    runUntil([&responses]() { return (responses == 1); });
+
+    // The server closes the idle connection.
+    socket_->close();
+    runUntil([&connection]() { return (!connection->isConnected()); });
+
+    // The next message opens a new connection: the server does not answer
+    // and closes it.
+    accept(0);
+    bool failed = false;
+    EXPECT_TRUE(connection->send(makeMessage(2),
+        [&failed](const boost::system::error_code& ec, const uint8_t*,
+                  size_t) {
+            failed = static_cast<bool>(ec);
+        }));
+    runUntil([this]() { return (accepted_ == 2); });
+    runUntil([&connection]() { return (connection->isConnected()); });
+    socket_->close();
+    runUntil([&failed]() { return (failed); });
+    EXPECT_TRUE(failed);
+    EXPECT_EQ(2U, connection->getConnectCount());
+    EXPECT_EQ(0U, connection->getPendingCount());
+}
+
+// Verify that a cancelled request is not answered.
+TEST_F(DNSTCPConnectionTest, cancel) {
+    accept(2);
+    DNSTCPConnectionPtr connection(new DNSTCPConnection(service_,
+        IOAddress("127.0.0.1"), getPort()));
+    vector<uint16_t> received;
+    auto handler = [&received](const boost::system::error_code& ec,
+                               const uint8_t* data, size_t) {
+        EXPECT_FALSE(ec);
+        received.push_back((data[0] << 8) | data[1]);
+    };
+    EXPECT_TRUE(connection->send(makeMessage(1), handler));
+    EXPECT_TRUE(connection->send(makeMessage(2), handler));
+    connection->cancel(2);
+    EXPECT_EQ(1U, connection->getPendingCount());
+    runUntil([&received]() { return (received.size() == 1); });
+    ASSERT_EQ(1U, received.size());
+    EXPECT_EQ(1, received[0]);
+    connection->close();
+}
+
+// Verify that a failure to connect is reported.
+TEST_F(DNSTCPConnectionTest, refused) {
+    uint16_t const port = getPort();
+    acceptor_.close();
+    DNSTCPConnectionPtr connection(new DNSTCPConnection(service_,
+        IOAddress("127.0.0.1"), port));
+    bool failed = false;
+    EXPECT_TRUE(connection->send(makeMessage(1),
+        [&failed](const boost::system::error_code& ec, const uint8_t*,
+                  size_t) {
+            failed = static_cast<bool>(ec);
+        }));
+    runUntil([&failed]() { return (failed); });
+    EXPECT_TRUE(failed);
+    EXPECT_FALSE(connection->isConnected());
+    EXPECT_EQ(0U, connection->getPendingCount());
+}
+
+}
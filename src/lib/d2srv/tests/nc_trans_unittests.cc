@@ -773,6 +773,43 @@ TEST_F(NameChangeTransactionTest, serverSelectionTest) {
     EXPECT_EQ(passes, num_servers);
 }
 
+/// @brief Tests that updates are sent using the transport of the selected
+/// server.
+TEST_F(NameChangeTransactionTest, serverTransport) {
+    ASSERT_NO_THROW(name_change_ = makeCannedTransaction());
+    DNSSocketPoolPtr pool(new DNSSocketPool(io_service_));
+    name_change_->setSocketPool(pool);
+
+    // Build a domain with an UDP server followed by a TCP server.
+    DnsServerInfoStoragePtr servers(new DnsServerInfoStorage());
+    servers->push_back(DnsServerInfoPtr(
+        new DnsServerInfo("", IOAddress("127.0.0.1"), TEST_DNS_SERVER_PORT)));
+    servers->push_back(DnsServerInfoPtr(
+        new DnsServerInfo("", IOAddress("127.0.0.1"), TEST_DNS_SERVER_PORT,
+                          true, TSIGKeyInfoPtr(), true, DNSClient::TCP)));
+    DdnsDomainPtr domain(new DdnsDomain("example.com", servers));
+
+    // Create a valid request for the transaction.
+    D2UpdateMessagePtr req(new D2UpdateMessage(D2UpdateMessage::OUTBOUND));
+    req->setZone(dns::Name("example.com"), dns::RRClass::ANY());
+    req->setRcode(dns::Rcode(dns::Rcode::NOERROR_CODE));
+    ASSERT_NO_THROW(name_change_->setDnsUpdateRequest(req));
+    name_change_->use_stub_callback_ = true;
+    ASSERT_NO_THROW(name_change_->initServerSelection(domain));
+
+    // The update to the UDP server does not use a connection.
+    ASSERT_TRUE(name_change_->selectNextServer());
+    EXPECT_EQ(DNSClient::UDP, name_change_->getCurrentServer()->getTransport());
+    ASSERT_NO_THROW(name_change_->sendUpdate());
+    EXPECT_EQ(0U, pool->getTCPConnectionCount());
+
+    // The update to the TCP server goes over a connection to this server.
+    ASSERT_TRUE(name_change_->selectNextServer());
+    EXPECT_EQ(DNSClient::TCP, name_change_->getCurrentServer()->getTransport());
+    ASSERT_NO_THROW(name_change_->sendUpdate());
+    EXPECT_EQ(1U, pool->getTCPConnectionCount());
+}
+
 /// @brief Tests that the transaction will be "failed" upon model errors.
 TEST_F(NameChangeTransactionTest, modelFailure) {
     ASSERT_NO_THROW(name_change_ = makeCannedTransaction());
@@ -100,6 +100,9 @@ Iface::closeSockets(const uint16_t family) {
     SocketCollection::iterator sock = sockets_.begin();
     while (sock != sockets_.end()) {
         if (sock->family_ == family) {
+            if (socket_close_callback_) {
+                socket_close_callback_(*sock);
+            }
             // Close and delete the socket and move to the
             // next one.
             close(sock->sockfd_);
@@ -165,6 +168,9 @@ bool Iface::delSocket(const uint16_t sockfd) {
     SocketCollection::iterator sock = sockets_.begin();
     while (sock != sockets_.end()) {
         if (sock->sockfd_ == sockfd) {
+            if (socket_close_callback_) {
+                socket_close_callback_(*sock);
+            }
             close(sockfd);
             // Close fallback socket if open.
             if (sock->fallbackfd_ >= 0) {
@@ -182,7 +188,8 @@ IfaceMgr::IfaceMgr()
     : packet_filter_(new PktFilterInet()),
       packet_filter6_(new PktFilterInet6()),
       test_mode_(false), check_thread_id_(true),
-      allow_loopback_(false), family_(AF_INET) {
+      allow_loopback_(false), iface_sockets_family_(0),
+      family_(AF_INET) {
     id_ = std::this_thread::get_id();
 
     // Ensure that PQMs have been created to guarantee we have
@@ -213,6 +220,116 @@ IfaceMgr::IfaceMgr()
 void IfaceMgr::initializeFDEventHandler() {
     fd_event_handler_ = FDEventHandlerFactory::factoryFDEventHandler();
     receiver_fd_event_handler_ = FDEventHandlerFactory::factoryFDEventHandler();
+    iface_sockets_family_ = 0;
+    if (!fd_event_handler_->isPersistent()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(callbacks_mutex_);
+        for (SocketCallbackInfo const& s : callbacks_) {
+            if (!s.unusable_) {
+                fd_event_handler_->add(s.socket_);
+            }
+        }
+    }
+    if (isDHCPReceiverRunning()) {
+        fd_event_handler_->add(dhcp_receiver_->getWatchFd(WatchedThread::READY));
+        fd_event_handler_->add(dhcp_receiver_->getWatchFd(WatchedThread::ERROR));
+    }
+}
+
+void
+IfaceMgr::registerSocket(int socketfd) {
+    fd_event_handler_->remove(socketfd);
+    fd_event_handler_->add(socketfd);
+}
+
+void
+IfaceMgr::registerIfaceSocket(uint16_t family, int socketfd) {
+    if (!fd_event_handler_->isPersistent() || isDHCPReceiverRunning()) {
+        return;
+    }
+    if (iface_sockets_family_ == 0) {
+        iface_sockets_family_ = family;
+    }
+    if (iface_sockets_family_ == family) {
+        registerSocket(socketfd);
+    }
+}
+
+void
+IfaceMgr::registerIfaceSockets(uint16_t family) {
+    for (const IfacePtr& iface : ifaces_) {
+        for (const SocketInfo& s : iface->getSockets()) {
+            if (s.family_ == family) {
+                registerSocket(s.sockfd_);
+            } else {
+                fd_event_handler_->remove(s.sockfd_);
+            }
+        }
+    }
+    iface_sockets_family_ = family;
+}
+
+void
+IfaceMgr::registerReceiverSockets() {
+    if (!fd_event_handler_->isPersistent()) {
+        return;
+    }
+    registerIfaceSockets(0);
+    registerSocket(dhcp_receiver_->getWatchFd(WatchedThread::READY));
+    registerSocket(dhcp_receiver_->getWatchFd(WatchedThread::ERROR));
+}
+
+void
+IfaceMgr::prepareFDEventHandler(uint16_t family) {
+    bool indirect = isDHCPReceiverRunning();
+    if (fd_event_handler_->isPersistent()) {
+        if (!indirect && (iface_sockets_family_ != family)) {
+            registerIfaceSockets(family);
+        }
+        // A closed socket is silently dropped from the epoll set so
+        // it must be checked for like with the other handlers.
+        handleClosedExternalSockets();
+        return;
+    }
+
+    fd_event_handler_->clear();
+
+    if (!indirect) {
+        for (const IfacePtr& iface : ifaces_) {
+            for (const SocketInfo& s : iface->getSockets()) {
+                // Only deal with sockets of the family.
+                if (s.family_ == family) {
+                    // Add this socket to listening set
+                    fd_event_handler_->add(s.sockfd_);
+                }
+            }
+        }
+    }
+
+    // if there are any callbacks for external sockets registered...
+    {
+        std::lock_guard<std::mutex> lock(callbacks_mutex_);
+        if (!callbacks_.empty()) {
+            for (auto it = callbacks_.begin(); it != callbacks_.end(); ++it) {
+                if (it->unusable_) {
+                    continue;
+                }
+                handleClosedExternalSocket(it);
+                // Add this socket to listening set
+                fd_event_handler_->add(it->socket_);
+            }
+        }
+    }
+
+    if (indirect) {
+        // Add Receiver ready watch socket
+        fd_event_handler_->add(dhcp_receiver_->getWatchFd(WatchedThread::READY));
+
+        // Add Receiver error watch socket
+        fd_event_handler_->add(dhcp_receiver_->getWatchFd(WatchedThread::ERROR));
+    }
 }
 
 void Iface::addUnicast(const isc::asiolink::IOAddress& addr) {
@@ -327,6 +444,11 @@ void IfaceMgr::stopDHCPReceiver(bool clear_queue) {
         dhcp_receiver_->stop();
     }
 
+    if (dhcp_receiver_) {
+        fd_event_handler_->remove(dhcp_receiver_->getWatchFd(WatchedThread::READY));
+        fd_event_handler_->remove(dhcp_receiver_->getWatchFd(WatchedThread::ERROR));
+    }
+
     dhcp_receiver_.reset();
 
     if (clear_queue) {
@@ -342,6 +464,10 @@ void IfaceMgr::stopDHCPReceiver(bool clear_queue) {
 
 IfaceMgr::~IfaceMgr() {
     closeSockets();
+    // The interfaces may be shared: don't let them call a deleted manager.
+    for (const IfacePtr& iface : ifaces_) {
+        iface->setSocketCloseCallback(Iface::SocketCloseCallback());
+    }
 }
 
 ElementPtr
@@ -387,11 +513,13 @@ IfaceMgr::addExternalSocket(int socketfd, SocketCallback callback) {
         LOG_WARN(dhcp_logger, DHCP_ADD_EXTERNAL_SOCKET_ALREADY_EXISTS)
             .arg(socketfd);
         idx.replace(it, x);
-        return;
+    } else {
+        // Add a new entry to the callbacks vector
+        callbacks_.push_back(x);
+    }
+    if (fd_event_handler_->isPersistent()) {
+        registerSocket(socketfd);
     }
-
-    // Add a new entry to the callbacks vector
-    callbacks_.push_back(x);
 }
 
 void
@@ -416,6 +544,7 @@ IfaceMgr::deleteExternalSocketInternal(int socketfd) {
         return;
     }
     idx.erase(it);
+    fd_event_handler_->remove(socketfd);
 }
 
 bool
@@ -446,6 +575,9 @@ IfaceMgr::deleteAllExternalSockets() {
             .arg(id_);
     }
     std::lock_guard<std::mutex> lock(callbacks_mutex_);
+    for (SocketCallbackInfo const& s : callbacks_) {
+        fd_event_handler_->remove(s.socket_);
+    }
     callbacks_.clear();
 }
 
@@ -811,6 +943,7 @@ IfaceMgr::startDHCPReceiver(const uint16_t family) {
         }
 
         dhcp_receiver_.reset(new WatchedThread());
+        registerReceiverSockets();
         dhcp_receiver_->start(std::bind(&IfaceMgr::receiveDHCP4Packets, this));
         break;
     case AF_INET6:
@@ -821,6 +954,7 @@ IfaceMgr::startDHCPReceiver(const uint16_t family) {
         }
 
         dhcp_receiver_.reset(new WatchedThread());
+        registerReceiverSockets();
         dhcp_receiver_->start(std::bind(&IfaceMgr::receiveDHCP6Packets, this));
         break;
     default:
@@ -839,6 +973,9 @@ IfaceMgr::addInterface(const IfacePtr& iface) {
                       " already exists.");
         }
     }
+    iface->setSocketCloseCallback([this](const SocketInfo& info) {
+        releaseSocket(info);
+    });
     ifaces_.push_back(iface);
 }
 
@@ -957,9 +1094,22 @@ IfaceMgr::getIface(const PktPtr& pkt) {
 
 void
 IfaceMgr::clearIfaces() {
+    for (const IfacePtr& iface : ifaces_) {
+        iface->setSocketCloseCallback(Iface::SocketCloseCallback());
+    }
     ifaces_.clear();
 }
 
+void
+IfaceMgr::releaseSocket(const SocketInfo& info) {
+    if (info.family_ == AF_INET) {
+        packet_filter_->releaseSocket(info.sockfd_);
+    }
+    if (fd_event_handler_) {
+        fd_event_handler_->remove(info.sockfd_);
+    }
+}
+
 void
 IfaceMgr::clearBoundAddresses() {
     bound_address_.clear();
@@ -972,6 +1122,7 @@ IfaceMgr::handleClosedExternalSocket(SocketCallbackInfoIterator it) {
         SocketCallbackInfo x(*it);
         x.unusable_ = true;
         callbacks_.replace(it, x);
+        fd_event_handler_->remove(x.socket_);
         isc_throw(SocketFDError, "unexpected state (closed) for fd: " << x.socket_);
     }
 }
@@ -1200,6 +1351,7 @@ IfaceMgr::openSocket4(Iface& iface, const IOAddress& addr, const uint16_t port,
     SocketInfo info = packet_filter_->openSocket(iface, addr, port,
                                                  receive_bcast, send_bcast);
     iface.addSocket(info);
+    registerIfaceSocket(AF_INET, info.sockfd_);
 
     return (info.sockfd_);
 }
@@ -1245,28 +1397,7 @@ Pkt4Ptr IfaceMgr::receive4Indirect(uint32_t timeout_sec, uint32_t timeout_usec /
                   " one million microseconds");
     }
 
-    fd_event_handler_->clear();
-
-    // if there are any callbacks for external sockets registered...
-    {
-        std::lock_guard<std::mutex> lock(callbacks_mutex_);
-        if (!callbacks_.empty()) {
-            for (auto it = callbacks_.begin(); it != callbacks_.end(); ++it) {
-                if (it->unusable_) {
-                    continue;
-                }
-                handleClosedExternalSocket(it);
-                // Add this socket to listening set
-                fd_event_handler_->add(it->socket_);
-            }
-        }
-    }
-
-    // Add Receiver ready watch socket
-    fd_event_handler_->add(dhcp_receiver_->getWatchFd(WatchedThread::READY));
-
-    // Add Receiver error watch socket
-    fd_event_handler_->add(dhcp_receiver_->getWatchFd(WatchedThread::ERROR));
+    prepareFDEventHandler(AF_INET);
 
     // Set timeout for our next select() call.  If there are
     // no DHCP packets to read, then we'll wait for a finite
@@ -1373,37 +1504,7 @@ Pkt4Ptr IfaceMgr::receive4Direct(uint32_t timeout_sec, uint32_t timeout_usec /*
                   " one million microseconds");
     }
 
-    fd_event_handler_->clear();
-
-    /// @todo: marginal performance optimization. We could create the set once
-    /// and then use its copy for select(). Please note that select() modifies
-    /// provided set to indicated which sockets have something to read.
-    /// @note: this can be achieved with FDEventHandler (initialize only if
-    /// max_fd_ is 0) and do not clear the state.
-    for (const IfacePtr& iface : ifaces_) {
-        for (const SocketInfo& s : iface->getSockets()) {
-            // Only deal with IPv4 addresses.
-            if (s.addr_.isV4()) {
-                // Add this socket to listening set
-                fd_event_handler_->add(s.sockfd_);
-            }
-        }
-    }
-
-    // if there are any callbacks for external sockets registered...
-    {
-        std::lock_guard<std::mutex> lock(callbacks_mutex_);
-        if (!callbacks_.empty()) {
-            for (auto it = callbacks_.begin(); it != callbacks_.end(); ++it) {
-                if (it->unusable_) {
-                    continue;
-                }
-                handleClosedExternalSocket(it);
-                // Add this socket to listening set
-                fd_event_handler_->add(it->socket_);
-            }
-        }
-    }
+    prepareFDEventHandler(AF_INET);
 
     // zero out the errno to be safe
     errno = 0;
@@ -1514,17 +1615,13 @@ Pkt4Ptr IfaceMgr::receive4Direct(uint32_t timeout_sec, uint32_t timeout_usec /*
         return (Pkt4Ptr());
     }
 
-    // Check that we have something to read.
-    int len;
-    if (ioctl(candidate->sockfd_, FIONREAD, &len) < 0) {
-        isc_throw(SocketReadError, strerror(errno));
-    }
-    if (len == 0) {
+    // Check that we have something to read. Assuming that packet filter
+    // is not null, because its modifier checks it.
+    if (!packet_filter_->hasDataToRead(candidate->sockfd_)) {
         // Nothing to read.
         return (Pkt4Ptr());
     }
 
-    // Assuming that packet filter is not null, because its modifier checks it.
     return (packet_filter_->receive(*recv_if, *candidate));
 }
 
@@ -1545,37 +1642,7 @@ IfaceMgr::receive6Direct(uint32_t timeout_sec, uint32_t timeout_usec /* = 0 */ )
                   " one million microseconds");
     }
 
-    fd_event_handler_->clear();
-
-    /// @todo: marginal performance optimization. We could create the set once
-    /// and then use its copy for select(). Please note that select() modifies
-    /// provided set to indicated which sockets have something to read.
-    /// @note: this can be achieved with FDEventHandler (initialize only if
-    /// max_fd_ is 0) and do not clear the state.
-    for (const IfacePtr& iface : ifaces_) {
-        for (const SocketInfo& s : iface->getSockets()) {
-            // Only deal with IPv6 addresses.
-            if (s.addr_.isV6()) {
-                // Add this socket to listening set
-                fd_event_handler_->add(s.sockfd_);
-            }
-        }
-    }
-
-    // if there are any callbacks for external sockets registered...
-    {
-        std::lock_guard<std::mutex> lock(callbacks_mutex_);
-        if (!callbacks_.empty()) {
-            for (auto it = callbacks_.begin(); it != callbacks_.end(); ++it) {
-                if (it->unusable_) {
-                    continue;
-                }
-                handleClosedExternalSocket(it);
-                // Add this socket to listening set
-                fd_event_handler_->add(it->socket_);
-            }
-        }
-    }
+    prepareFDEventHandler(AF_INET6);
 
     // zero out the errno to be safe
     errno = 0;
@@ -1708,28 +1775,7 @@ IfaceMgr::receive6Indirect(uint32_t timeout_sec, uint32_t timeout_usec /* = 0 */
                   " one million microseconds");
     }
 
-    fd_event_handler_->clear();
-
-    // if there are any callbacks for external sockets registered...
-    {
-        std::lock_guard<std::mutex> lock(callbacks_mutex_);
-        if (!callbacks_.empty()) {
-            for (auto it = callbacks_.begin(); it != callbacks_.end(); ++it) {
-                if (it->unusable_) {
-                    continue;
-                }
-                handleClosedExternalSocket(it);
-                // Add this socket to listening set
-                fd_event_handler_->add(it->socket_);
-            }
-        }
-    }
-
-    // Add Receiver ready watch socket
-    fd_event_handler_->add(dhcp_receiver_->getWatchFd(WatchedThread::READY));
-
-    // Add Receiver error watch socket
-    fd_event_handler_->add(dhcp_receiver_->getWatchFd(WatchedThread::ERROR));
+    prepareFDEventHandler(AF_INET6);
 
     // Set timeout for our next select() call.  If there are
     // no DHCP packets to read, then we'll wait for a finite
@@ -2091,16 +2137,17 @@ IfaceMgr::receiveDHCP6Packets() {
 
 void
 IfaceMgr::receiveDHCP4Packet(Iface& iface, const SocketInfo& socket_info) {
-    int len;
+    bool has_data = false;
 
-    int result = ioctl(socket_info.sockfd_, FIONREAD, &len);
-    if (result < 0) {
+    try {
+        has_data = packet_filter_->hasDataToRead(socket_info.sockfd_);
+    } catch (const std::exception& ex) {
         std::lock_guard<std::mutex> lk(receiver_mutex_);
         // Signal the error to receive4.
-        dhcp_receiver_->setError(strerror(errno));
+        dhcp_receiver_->setError(ex.what());
         return;
     }
-    if (len == 0) {
+    if (!has_data) {
         // Nothing to read.
         return;
     }
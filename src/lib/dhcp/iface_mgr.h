@@ -379,6 +379,20 @@ public:
     /// @return true if there was such socket, false otherwise
     bool delSocket(uint16_t sockfd);
 
+    /// @brief Type of the callback invoked before a socket is closed.
+    typedef std::function<void(const SocketInfo&)> SocketCloseCallback;
+
+    /// @brief Sets the callback invoked before a socket is closed.
+    ///
+    /// The interface manager sets it when the interface is added so
+    /// that the resources associated with the socket descriptor are
+    /// released whichever way the socket is closed.
+    ///
+    /// @param callback the callback, an empty callback disables it.
+    void setSocketCloseCallback(const SocketCloseCallback& callback) {
+        socket_close_callback_ = callback;
+    }
+
     /// @brief Returns collection of all sockets added to interface.
     ///
     /// When new socket is created with @ref IfaceMgr::openSocket
@@ -537,6 +551,9 @@ public:
 
 private:
 
+    /// @brief Callback invoked before a socket is closed.
+    SocketCloseCallback socket_close_callback_;
+
     /// @brief The buffer holding the data read from the socket.
     ///
     /// See @c Iface manager description for details.
@@ -830,6 +847,8 @@ public:
     virtual ~IfaceMgr();
 
     /// @brief Initialize the FD event handler;
+    ///
+    /// The usable external sockets are registered in a persistent handler.
     void initializeFDEventHandler();
 
     /// @brief Sets or clears the test mode for @c IfaceMgr.
@@ -1781,6 +1800,63 @@ private:
     /// @param socketfd socket descriptor
     void deleteExternalSocketInternal(int socketfd);
 
+    /// @brief Releases the resources associated with an interface socket.
+    ///
+    /// Called by the interfaces before they close a socket. It lets the
+    /// packet filter release its per socket resources.
+    ///
+    /// @param info socket information
+    void releaseSocket(const SocketInfo& info);
+
+    /// @brief Registers a socket in the FD event handler.
+    ///
+    /// The socket is removed first because the descriptor may be the
+    /// one of a closed socket which was registered in an event handler
+    /// keeping registrations between two waits (epoll).
+    ///
+    /// @param socketfd socket descriptor
+    void registerSocket(int socketfd);
+
+    /// @brief Registers a new interface socket in a persistent FD event
+    /// handler.
+    ///
+    /// Does nothing when the event handler is not persistent, when the
+    /// receiver thread is running or when the interface sockets of the
+    /// other family are registered.
+    ///
+    /// @param family address family of the socket
+    /// @param socketfd socket descriptor
+    void registerIfaceSocket(uint16_t family, int socketfd);
+
+    /// @brief Registers the interface sockets of a family in a
+    /// persistent FD event handler.
+    ///
+    /// The previously registered interface sockets are removed.
+    ///
+    /// @param family address family of the sockets to register or 0
+    /// to only remove the registered interface sockets.
+    void registerIfaceSockets(uint16_t family);
+
+    /// @brief Registers the watch sockets of the receiver thread in a
+    /// persistent FD event handler.
+    ///
+    /// Must be called before the receiver thread is started: the interface
+    /// sockets are then read by the receiver thread so they are removed.
+    void registerReceiverSockets();
+
+    /// @brief Prepares the FD event handler before a wait in a receive
+    /// function.
+    ///
+    /// With a persistent event handler only the interface sockets of
+    /// another family are replaced as the other sockets are registered
+    /// when they are opened or added. Otherwise the handler is cleared and
+    /// filled with the interface sockets (direct mode), the usable external
+    /// sockets and the watch sockets of the receiver thread (indirect mode).
+    /// In both cases the closed external sockets are marked as unusable.
+    ///
+    /// @param family address family of the interface sockets
+    void prepareFDEventHandler(uint16_t family);
+
     /// @brief Handle closed external socket.
     ///
     /// @note: the caller must take the lock when it generates
@@ -1854,6 +1930,10 @@ private:
     /// @brief The receiver FDEventHandler instance.
     util::FDEventHandlerPtr receiver_fd_event_handler_;
 
+    /// @brief Address family of the interface sockets registered in a
+    /// persistent FD event handler (0 when there is none).
+    uint16_t iface_sockets_family_;
+
     /// @brief Address family.
     uint16_t family_;
 };
@@ -190,6 +190,7 @@ IfaceMgr::openSocket6(Iface& iface, const IOAddress& addr, uint16_t port,
     SocketInfo info = packet_filter6_->openSocket(iface, actual_address, port,
                                                   join_multicast);
     iface.addSocket(info);
+    registerIfaceSocket(AF_INET6, info.sockfd_);
 
     return (info.sockfd_);
 }
@@ -541,7 +541,7 @@ void Iface::setFlags(uint64_t flags) {
 void
 IfaceMgr::setMatchingPacketFilter(const bool direct_response_desired) {
     if (direct_response_desired) {
-        setPacketFilter(PktFilterPtr(new PktFilterLPF()));
+        setPacketFilter(PktFilterPtr(new PktFilterLPF(true)));
 
     } else {
         setPacketFilter(PktFilterPtr(new PktFilterInet()));
@@ -614,6 +614,7 @@ IfaceMgr::openSocket6(Iface& iface, const IOAddress& addr, uint16_t port,
     SocketInfo info = packet_filter6_->openSocket(iface, addr, port,
                                                   join_multicast);
     iface.addSocket(info);
+    registerIfaceSocket(AF_INET6, info.sockfd_);
 
     return (info.sockfd_);
 }
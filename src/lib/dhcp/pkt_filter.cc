@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2024 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -8,6 +8,7 @@
 #include <dhcp/iface_mgr.h>
 #include <dhcp/pkt_filter.h>
 
+#include <sys/ioctl.h>
 #include <sys/socket.h>
 #include <fcntl.h>
 
@@ -67,5 +68,18 @@ PktFilter::openFallbackSocket(const isc::asiolink::IOAddress& addr,
     return (sock);
 }
 
+bool
+PktFilter::hasDataToRead(int sockfd) {
+    int len;
+    if (ioctl(sockfd, FIONREAD, &len) < 0) {
+        isc_throw(SocketReadError, strerror(errno));
+    }
+    return (len != 0);
+}
+
+void
+PktFilter::releaseSocket(int) {
+}
+
 } // end of isc::dhcp namespace
 } // end of isc namespace
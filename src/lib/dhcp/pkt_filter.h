@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2024 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -113,6 +113,28 @@ public:
     virtual int send(const Iface& iface, uint16_t sockfd,
                      const Pkt4Ptr& pkt) = 0;
 
+    /// @brief Check if there is data to read on a socket.
+    ///
+    /// The default implementation checks the receive queue of the socket
+    /// with the FIONREAD ioctl. It should be overridden by the derived
+    /// classes which don't receive the packets through the receive queue.
+    ///
+    /// @param sockfd socket descriptor
+    ///
+    /// @throw isc::dhcp::SocketReadError if the check fails.
+    /// @return true if there is data to read.
+    virtual bool hasDataToRead(int sockfd);
+
+    /// @brief Release the resources associated with a socket.
+    ///
+    /// The interface manager calls it before it closes a socket opened
+    /// with this filter. The default implementation does nothing. It
+    /// should be overridden by the derived classes which keep per socket
+    /// resources.
+    ///
+    /// @param sockfd socket descriptor
+    virtual void releaseSocket(int sockfd);
+
 protected:
 
     /// @brief Default implementation to open a fallback socket.
@@ -6,6 +6,7 @@
 
 #include <config.h>
 #include <dhcp/dhcp4.h>
+#include <dhcp/dhcp_log.h>
 #include <dhcp/iface_mgr.h>
 #include <dhcp/pkt4.h>
 #include <dhcp/pkt_filter_lpf.h>
@@ -16,6 +17,9 @@
 #include <linux/filter.h>
 #include <linux/if_ether.h>
 #include <linux/if_packet.h>
+#include <sys/mman.h>
+
+#include <atomic>
 
 namespace {
 
@@ -131,6 +135,77 @@ struct sock_filter dhcp_sock_filter [] = {
     BPF_STMT(BPF_RET + BPF_K, 0),
 };
 
+/// @brief Discard the data received over the fallback socket.
+///
+/// The data will be discarded but we don't want the socket buffer to
+/// bloat. We get the packets from the socket in loop but most of the
+/// time the loop will end after receiving one packet. The call to recv
+/// returns immediately when there is no data left on the socket because
+/// the socket is non-blocking.
+///
+/// @param fallbackfd fallback socket descriptor.
+void
+drainFallbackSocket(const int fallbackfd) {
+    uint8_t raw_buf[IfaceMgr::RCVBUFSIZE];
+    int datalen;
+    do {
+        datalen = recv(fallbackfd, raw_buf, sizeof(raw_buf), 0);
+    } while (datalen > 0);
+}
+
+/// @brief Decode a received Ethernet frame.
+///
+/// @param iface interface the frame was received on.
+/// @param data the frame.
+/// @param len length of the frame.
+///
+/// @throw isc::dhcp::SocketReadError if the frame holds no DHCPv4 data.
+/// @return the DHCPv4 packet.
+Pkt4Ptr
+decodeFrame(Iface& iface, const uint8_t* data, const size_t len) {
+    isc::util::InputBuffer buf(data, len);
+
+    // @todo: This is awkward way to solve the chicken and egg problem
+    // whereby we don't know the offset where DHCP data start in the
+    // received buffer when we create the packet object. In general case,
+    // the IP header has variable length. The information about its length
+    // is stored in one of its fields. Therefore, we have to decode the
+    // packet to get the offset of the DHCP data. The dummy object is
+    // created so as we can pass it to the functions which decode IP stack
+    // and find actual offset of the DHCP data.
+    // Once we find the offset we can create another Pkt4 object from
+    // the reminder of the input buffer and set the IP addresses and
+    // ports from the dummy packet. We should consider doing it
+    // in some more elegant way.
+    Pkt4Ptr dummy_pkt = Pkt4Ptr(new Pkt4(DHCPDISCOVER, 0));
+
+    // Decode ethernet, ip and udp headers.
+    decodeEthernetHeader(buf, dummy_pkt);
+    decodeIpUdpHeader(buf, dummy_pkt);
+
+    auto v4_len = buf.getLength() - buf.getPosition();
+    if (v4_len <= 0) {
+        isc_throw(SocketReadError, "Pkt4FilterLpf packet has no DHCPv4 data");
+    }
+
+    // Decode DHCP data into the Pkt4 object. The data are copied once,
+    // straight from the received frame.
+    Pkt4Ptr pkt = Pkt4Ptr(new Pkt4(data + buf.getPosition(), v4_len));
+
+    // Set the appropriate packet members using data collected from
+    // the decoded headers.
+    pkt->setIndex(iface.getIndex());
+    pkt->setIface(iface.getName());
+    pkt->setLocalAddr(dummy_pkt->getLocalAddr());
+    pkt->setRemoteAddr(dummy_pkt->getRemoteAddr());
+    pkt->setLocalPort(dummy_pkt->getLocalPort());
+    pkt->setRemotePort(dummy_pkt->getRemotePort());
+    pkt->setLocalHWAddr(dummy_pkt->getLocalHWAddr());
+    pkt->setRemoteHWAddr(dummy_pkt->getRemoteHWAddr());
+
+    return (pkt);
+}
+
 }
 
 using namespace isc::util;
@@ -138,6 +213,221 @@ using namespace isc::util;
 namespace isc {
 namespace dhcp {
 
+#ifdef HAVE_TPACKET_V3
+
+/// @brief TPACKET_V3 receive ring of a raw socket.
+///
+/// The ring is made of @c PktFilterLPF::RING_BLOCK_NR blocks mapped in
+/// the process memory. The kernel fills a block with frames and hands it
+/// over by setting @c TP_STATUS_USER in its status. The frames of the
+/// block are then read in place and the block is given back to the
+/// kernel by setting its status to @c TP_STATUS_KERNEL. Blocks are
+/// handed over and given back in order.
+class PktFilterLPF::RxRing : public boost::noncopyable {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Attaches a receive ring to the socket and maps it.
+    ///
+    /// @param sock socket descriptor.
+    ///
+    /// @throw isc::dhcp::SocketConfigError if the ring can't be set up.
+    explicit RxRing(const int sock)
+        : sock_(sock), map_(0), map_size_(0), block_(0), frame_(0),
+          frames_left_(0) {
+        int version = TPACKET_V3;
+        if (setsockopt(sock, SOL_PACKET, PACKET_VERSION, &version,
+                       sizeof(version)) < 0) {
+            isc_throw(SocketConfigError, "failed to set TPACKET_V3 version: "
+                      << strerror(errno));
+        }
+
+        struct tpacket_req3 req;
+        memset(&req, 0, sizeof(req));
+        req.tp_block_size = RING_BLOCK_SIZE;
+        req.tp_block_nr = RING_BLOCK_NR;
+        req.tp_frame_size = RING_FRAME_SIZE;
+        req.tp_frame_nr = (RING_BLOCK_SIZE / RING_FRAME_SIZE) * RING_BLOCK_NR;
+        req.tp_retire_blk_tov = RING_BLOCK_TIMEOUT;
+        if (setsockopt(sock, SOL_PACKET, PACKET_RX_RING, &req,
+                       sizeof(req)) < 0) {
+            isc_throw(SocketConfigError, "failed to create the receive ring: "
+                      << strerror(errno));
+        }
+
+        map_size_ = static_cast<size_t>(RING_BLOCK_SIZE) * RING_BLOCK_NR;
+        void* map = mmap(0, map_size_, PROT_READ | PROT_WRITE, MAP_SHARED,
+                         sock, 0);
+        if (map == MAP_FAILED) {
+            const char* errmsg = strerror(errno);
+            // Remove the ring from the socket, otherwise the frames
+            // would be stored in a ring nobody reads.
+            memset(&req, 0, sizeof(req));
+            static_cast<void>(setsockopt(sock, SOL_PACKET, PACKET_RX_RING,
+                                         &req, sizeof(req)));
+            isc_throw(SocketConfigError, "failed to map the receive ring: "
+                      << errmsg);
+        }
+        map_ = static_cast<uint8_t*>(map);
+    }
+
+    /// @brief Destructor.
+    ///
+    /// Unmaps the ring. The socket is released by the kernel once it is
+    /// both closed and unmapped.
+    ~RxRing() {
+        munmap(map_, map_size_);
+    }
+
+    /// @brief Returns the socket descriptor.
+    int getSocket() const {
+        return (sock_);
+    }
+
+    /// @brief Check if the frames of a block are being read.
+    bool inBlock() const {
+        return (frame_ != 0);
+    }
+
+    /// @brief Returns the current frame.
+    ///
+    /// When no block is being read, the next block is taken if the
+    /// kernel handed it over.
+    ///
+    /// @return the current frame or null when the ring holds no frame.
+    const struct tpacket3_hdr* current() {
+        while (!frame_) {
+            struct tpacket_block_desc* desc = getBlock();
+            if ((desc->hdr.bh1.block_status & TP_STATUS_USER) == 0) {
+                return (0);
+            }
+            // Read the content of the block after its status.
+            std::atomic_thread_fence(std::memory_order_acquire);
+            frames_left_ = desc->hdr.bh1.num_pkts;
+            if (frames_left_ == 0) {
+                releaseBlock();
+                continue;
+            }
+            frame_ = reinterpret_cast<struct tpacket3_hdr*>
+                (reinterpret_cast<uint8_t*>(desc) +
+                 desc->hdr.bh1.offset_to_first_pkt);
+        }
+        return (frame_);
+    }
+
+    /// @brief Move to the next frame.
+    ///
+    /// The block is given back to the kernel after its last frame.
+    void next() {
+        if (!frame_) {
+            return;
+        }
+        if (--frames_left_ == 0) {
+            releaseBlock();
+            return;
+        }
+        frame_ = reinterpret_cast<struct tpacket3_hdr*>
+            (reinterpret_cast<uint8_t*>(frame_) + frame_->tp_next_offset);
+    }
+
+private:
+
+    /// @brief Returns the descriptor of the current block.
+    struct tpacket_block_desc* getBlock() const {
+        return (reinterpret_cast<struct tpacket_block_desc*>
+                (map_ + static_cast<size_t>(block_) * RING_BLOCK_SIZE));
+    }
+
+    /// @brief Give the current block back to the kernel.
+    void releaseBlock() {
+        // Complete the reads of the block before the kernel reuses it.
+        std::atomic_thread_fence(std::memory_order_release);
+        getBlock()->hdr.bh1.block_status = TP_STATUS_KERNEL;
+        block_ = (block_ + 1) % RING_BLOCK_NR;
+        frame_ = 0;
+        frames_left_ = 0;
+    }
+
+    /// @brief Socket descriptor.
+    int sock_;
+
+    /// @brief Mapped ring.
+    uint8_t* map_;
+
+    /// @brief Size of the mapped ring.
+    size_t map_size_;
+
+    /// @brief Index of the current block.
+    unsigned block_;
+
+    /// @brief Current frame, null when no block is being read.
+    struct tpacket3_hdr* frame_;
+
+    /// @brief Number of frames of the current block not read yet.
+    uint32_t frames_left_;
+};
+
+#else
+
+/// @brief Placeholder for the receive ring when TPACKET_V3 is not
+/// available.
+class PktFilterLPF::RxRing {
+};
+
+#endif
+
+PktFilterLPF::PktFilterLPF(const bool use_ring)
+    : use_ring_(use_ring) {
+}
+
+PktFilterLPF::~PktFilterLPF() {
+}
+
+bool
+PktFilterLPF::hasRing(const int sockfd) const {
+    return (static_cast<bool>(getRing(sockfd)));
+}
+
+PktFilterLPF::RxRingPtr
+PktFilterLPF::getRing(const int sockfd) const {
+    std::lock_guard<std::mutex> lock(rings_mutex_);
+    auto it = rings_.find(sockfd);
+    if (it == rings_.end()) {
+        return (RxRingPtr());
+    }
+    return (it->second);
+}
+
+void
+PktFilterLPF::releaseSocket(int sockfd) {
+    std::lock_guard<std::mutex> lock(rings_mutex_);
+    rings_.erase(sockfd);
+}
+
+void
+PktFilterLPF::openRing(const Iface& iface, const int sock) {
+    std::lock_guard<std::mutex> lock(rings_mutex_);
+    // A ring registered with the same descriptor belongs to a socket
+    // which has been closed without being released.
+    rings_.erase(sock);
+#ifdef HAVE_TPACKET_V3
+    if (!use_ring_) {
+        return;
+    }
+    try {
+        rings_[sock].reset(new RxRing(sock));
+    } catch (const std::exception& ex) {
+        LOG_WARN(dhcp_logger, DHCP_LPF_RX_RING_FAILED)
+            .arg(sock)
+            .arg(iface.getName())
+            .arg(ex.what());
+    }
+#else
+    static_cast<void>(iface);
+#endif
+}
+
 bool
 PktFilterLPF::isSocketReceivedTimeSupported() const {
 #ifdef SO_TIMESTAMP
@@ -234,6 +524,11 @@ PktFilterLPF::openSocket(Iface& iface,
                   << " on the socket " << sock);
     }
 
+    // Set up the receive ring while no packet is accepted: the packets
+    // queued before are still read by recv below and the following ones
+    // are stored in the ring.
+    openRing(iface, sock);
+
     int datalen;
     uint8_t data;
     // Non-DHCP packets may have been received before the filter was attached,
@@ -273,13 +568,48 @@ PktFilterLPF::openSocket(Iface& iface,
 
 Pkt4Ptr
 PktFilterLPF::receive(Iface& iface, const SocketInfo& socket_info) {
-    uint8_t raw_buf[IfaceMgr::RCVBUFSIZE];
-    // First let's get some data from the fallback socket. The data will be
-    // discarded but we don't want the socket buffer to bloat. We get the
-    // packets from the socket in loop but most of the time the loop will
-    // end after receiving one packet. The call to recv returns immediately
-    // when there is no data left on the socket because the socket is
-    // non-blocking.
+#ifdef HAVE_TPACKET_V3
+    RxRingPtr ring = getRing(socket_info.sockfd_);
+    if (ring) {
+        // Drain the fallback socket once per block rather than once
+        // per packet.
+        if (!ring->inBlock()) {
+            drainFallbackSocket(socket_info.fallbackfd_);
+        }
+
+        const struct tpacket3_hdr* frame = ring->current();
+        if (!frame) {
+            return (Pkt4Ptr());
+        }
+
+        // The frame is decoded in place so the block must not be given
+        // back to the kernel before the packet is created.
+        Pkt4Ptr pkt;
+        try {
+            pkt = decodeFrame(iface,
+                              reinterpret_cast<const uint8_t*>(frame) +
+                              frame->tp_mac, frame->tp_snaplen);
+        } catch (...) {
+            ring->next();
+            throw;
+        }
+
+#ifdef SO_TIMESTAMP
+        struct timeval frame_time;
+        frame_time.tv_sec = frame->tp_sec;
+        frame_time.tv_usec = frame->tp_nsec / 1000;
+        pkt->addPktEvent(PktEvent::SOCKET_RECEIVED, frame_time);
+#endif
+        ring->next();
+
+        // Set time packet was read from the buffer.
+        pkt->addPktEvent(PktEvent::BUFFER_READ);
+
+        return (pkt);
+    }
+#endif
+
+    // First let's get some data from the fallback socket.
     // @todo In the normal conditions, both the primary socket and the fallback
     // socket are in sync as they are set to receive packets on the same
     // address and port. The reception of packets on the fallback socket
@@ -288,12 +618,10 @@ PktFilterLPF::receive(Iface& iface, const SocketInfo& socket_info) {
     // bytes received on the fallback socket in a single round. Further
     // optimizations would include an asynchronous read from the fallback socket
     // when the DHCP server is idle.
-    int datalen;
-    do {
-        datalen = recv(socket_info.fallbackfd_, raw_buf, sizeof(raw_buf), 0);
-    } while (datalen > 0);
+    drainFallbackSocket(socket_info.fallbackfd_);
 
 #ifndef SO_TIMESTAMP
+    uint8_t raw_buf[IfaceMgr::RCVBUFSIZE];
     // Now that we finished getting data from the fallback socket, we
     // have to get the data from the raw socket too.
     int data_len = read(socket_info.sockfd_, raw_buf, sizeof(raw_buf));
@@ -306,7 +634,7 @@ PktFilterLPF::receive(Iface& iface, const SocketInfo& socket_info) {
         return Pkt4Ptr();
     }
 
-    InputBuffer buf(raw_buf, data_len);
+    Pkt4Ptr pkt = decodeFrame(iface, raw_buf, data_len);
 #else
     const size_t CONTROL_BUF_LEN = 512;
     uint8_t msg_buf[IfaceMgr::RCVBUFSIZE];
@@ -338,51 +666,8 @@ PktFilterLPF::receive(Iface& iface, const SocketInfo& socket_info) {
         isc_throw(SocketReadError, "Pkt4FilterLpf to receive UDP4 data");
     }
 
-    InputBuffer buf(msg_buf, result);
-#endif
+    Pkt4Ptr pkt = decodeFrame(iface, msg_buf, result);
 
-    // @todo: This is awkward way to solve the chicken and egg problem
-    // whereby we don't know the offset where DHCP data start in the
-    // received buffer when we create the packet object. In general case,
-    // the IP header has variable length. The information about its length
-    // is stored in one of its fields. Therefore, we have to decode the
-    // packet to get the offset of the DHCP data. The dummy object is
-    // created so as we can pass it to the functions which decode IP stack
-    // and find actual offset of the DHCP data.
-    // Once we find the offset we can create another Pkt4 object from
-    // the reminder of the input buffer and set the IP addresses and
-    // ports from the dummy packet. We should consider doing it
-    // in some more elegant way.
-    Pkt4Ptr dummy_pkt = Pkt4Ptr(new Pkt4(DHCPDISCOVER, 0));
-
-    // Decode ethernet, ip and udp headers.
-    decodeEthernetHeader(buf, dummy_pkt);
-    decodeIpUdpHeader(buf, dummy_pkt);
-
-    auto v4_len = buf.getLength() - buf.getPosition();
-    if (v4_len <= 0) {
-        isc_throw(SocketReadError, "Pkt4FilterLpf packet has no DHCPv4 data");
-    }
-
-    // Read the DHCP data.
-    std::vector<uint8_t> dhcp_buf;
-    buf.readVector(dhcp_buf, v4_len);
-
-    // Decode DHCP data into the Pkt4 object.
-    Pkt4Ptr pkt = Pkt4Ptr(new Pkt4(&dhcp_buf[0], dhcp_buf.size()));
-
-    // Set the appropriate packet members using data collected from
-    // the decoded headers.
-    pkt->setIndex(iface.getIndex());
-    pkt->setIface(iface.getName());
-    pkt->setLocalAddr(dummy_pkt->getLocalAddr());
-    pkt->setRemoteAddr(dummy_pkt->getRemoteAddr());
-    pkt->setLocalPort(dummy_pkt->getLocalPort());
-    pkt->setRemotePort(dummy_pkt->getRemotePort());
-    pkt->setLocalHWAddr(dummy_pkt->getLocalHWAddr());
-    pkt->setRemoteHWAddr(dummy_pkt->getRemoteHWAddr());
-
-#ifdef SO_TIMESTAMP
     struct cmsghdr* cmsg = CMSG_FIRSTHDR(&m);
     while (cmsg != NULL) {
         if ((cmsg->cmsg_level == SOL_SOCKET) &&
@@ -404,6 +689,17 @@ PktFilterLPF::receive(Iface& iface, const SocketInfo& socket_info) {
     return (pkt);
 }
 
+bool
+PktFilterLPF::hasDataToRead(int sockfd) {
+#ifdef HAVE_TPACKET_V3
+    RxRingPtr ring = getRing(sockfd);
+    if (ring) {
+        return (ring->current() != 0);
+    }
+#endif
+    return (PktFilter::hasDataToRead(sockfd));
+}
+
 int
 PktFilterLPF::send(const Iface& iface, uint16_t sockfd, const Pkt4Ptr& pkt) {
 
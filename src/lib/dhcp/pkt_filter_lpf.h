@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2024 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -11,6 +11,12 @@
 
 #include <util/buffer.h>
 
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <map>
+#include <mutex>
+
 namespace isc {
 namespace dhcp {
 
@@ -20,9 +26,56 @@ namespace dhcp {
 /// sockets and Linux Packet Filtering. It is used by @c isc::dhcp::IfaceMgr
 /// to send DHCPv4 messages to the hosts which don't have an IPv4 address
 /// assigned yet.
+///
+/// When the ring is enabled and the kernel supports it, the packets are
+/// received through a TPACKET_V3 memory mapped ring attached to the raw
+/// socket: the kernel stores the frames in blocks shared with the process,
+/// so the frames of a block are decoded in place, without a system call
+/// or a copy per packet, and the block is given back to the kernel once
+/// all its frames have been read. If the ring can't be set up the packets
+/// are received with @c recvmsg.
 class PktFilterLPF : public PktFilter {
 public:
 
+    /// @brief Number of blocks of a receive ring.
+    static const unsigned RING_BLOCK_NR = 64;
+
+    /// @brief Size of a block of a receive ring in bytes.
+    static const unsigned RING_BLOCK_SIZE = 1 << 16;
+
+    /// @brief Nominal size of a frame of a receive ring in bytes.
+    ///
+    /// TPACKET_V3 frames have a variable size, this is only used to
+    /// describe the ring to the kernel.
+    static const unsigned RING_FRAME_SIZE = 1 << 11;
+
+    /// @brief Timeout in milliseconds after which the kernel hands over
+    /// a block which is not full.
+    ///
+    /// It bounds the latency added by the ring to the packets received
+    /// at a low rate.
+    static const unsigned RING_BLOCK_TIMEOUT = 1;
+
+    /// @brief Constructor.
+    ///
+    /// @param use_ring Receive the packets through a memory mapped ring
+    /// when the kernel supports it.
+    explicit PktFilterLPF(const bool use_ring = false);
+
+    /// @brief Destructor.
+    ///
+    /// Unmaps the receive rings.
+    virtual ~PktFilterLPF();
+
+    /// @brief Check if a socket receives packets through a memory mapped
+    /// ring.
+    ///
+    /// @param sockfd socket descriptor.
+    ///
+    /// @return true if the socket was opened by this filter and has a
+    /// receive ring.
+    bool hasRing(const int sockfd) const;
+
     /// @brief Check if packet can be sent to the host without address directly.
     ///
     /// This class supports direct responses to the host without address.
@@ -57,10 +110,13 @@ public:
 
     /// @brief Receive packet over specified socket.
     ///
+    /// If the socket has a receive ring, the next frame of the ring is
+    /// returned and an empty pointer when the ring holds no frame.
+    ///
     /// @param iface interface
     /// @param socket_info structure holding socket information
     ///
-    /// @throw isc::NotImplemented always
+    /// @throw isc::dhcp::SocketReadError if the packet can't be read.
     /// @return Received packet
     virtual Pkt4Ptr receive(Iface& iface, const SocketInfo& socket_info);
 
@@ -75,6 +131,61 @@ public:
     virtual int send(const Iface& iface, uint16_t sockfd,
                      const Pkt4Ptr& pkt);
 
+    /// @brief Check if there is data to read on a socket.
+    ///
+    /// The frames stored in the receive ring are not counted by FIONREAD
+    /// so the ring is checked instead when the socket has one.
+    ///
+    /// @param sockfd socket descriptor
+    ///
+    /// @throw isc::dhcp::SocketReadError if the check fails.
+    /// @return true if there is data to read.
+    virtual bool hasDataToRead(int sockfd);
+
+    /// @brief Release the resources associated with a socket.
+    ///
+    /// Unmaps the receive ring of the socket. The ring holds a reference
+    /// to the socket which would otherwise stay open in the kernel after
+    /// the descriptor is closed.
+    ///
+    /// @param sockfd socket descriptor
+    virtual void releaseSocket(int sockfd);
+
+private:
+
+    /// @brief Receive ring of a socket.
+    class RxRing;
+
+    /// @brief Pointer to a receive ring.
+    typedef boost::shared_ptr<RxRing> RxRingPtr;
+
+    /// @brief Set up the receive ring of a socket.
+    ///
+    /// Errors are not fatal: the socket is left without ring and the
+    /// packets are received with @c recvmsg.
+    ///
+    /// @param iface Interface descriptor.
+    /// @param sock socket descriptor.
+    void openRing(const Iface& iface, const int sock);
+
+    /// @brief Returns the receive ring of a socket.
+    ///
+    /// @param sockfd socket descriptor.
+    ///
+    /// @return the ring or an empty pointer.
+    RxRingPtr getRing(const int sockfd) const;
+
+    /// @brief Use receive rings flag.
+    bool use_ring_;
+
+    /// @brief Receive rings indexed by socket descriptor.
+    ///
+    /// A ring is unmapped by @c releaseSocket when the socket is closed
+    /// by the interface manager, or when the filter is destroyed.
+    std::map<int, RxRingPtr> rings_;
+
+    /// @brief Mutex protecting the receive rings.
+    mutable std::mutex rings_mutex_;
 };
 
 } // namespace isc::dhcp
@@ -33,6 +33,7 @@
 #include <sstream>
 #include <thread>
 #include <unordered_map>
+#include <vector>
 
 #include <arpa/inet.h>
 #include <sys/resource.h>
@@ -218,9 +219,19 @@ public:
         return (0);
     }
 
+    /// @brief Records the released socket.
+    ///
+    /// @param sockfd socket descriptor
+    virtual void releaseSocket(int sockfd) {
+        released_sockets_.push_back(sockfd);
+    }
+
     /// Holds the information whether openSocket was called on this
     /// object after its creation.
     bool open_socket_called_;
+
+    /// Holds the descriptors of the released sockets.
+    std::vector<int> released_sockets_;
 };
 
 class NakedIfaceMgr: public IfaceMgr {
@@ -940,6 +951,14 @@ public:
     /// @brief Tests if existing external socket can be deleted (v4).
     void testDeleteExternalSockets4();
 
+    /// @brief Tests if an external socket can be replaced by another one
+    /// with the same descriptor (v4).
+    void testReopenExternalSocket4();
+
+    /// @brief Tests if external sockets are still watched after the
+    /// FD event handler is initialized again (v4).
+    void testReinitializeExternalSocket4();
+
     /// @brief Tests single external socket (v6).
     void testSingleExternalSocket6();
 
@@ -2212,6 +2231,11 @@ TEST_F(IfaceMgrTest, receiveTimeout6Poll) {
     testReceiveTimeout6();
 }
 
+TEST_F(IfaceMgrTest, receiveTimeout6Epoll) {
+    kea_event_handler_type_.setValue("epoll");
+    testReceiveTimeout6();
+}
+
 void IfaceMgrTest::testReceiveTimeout4() {
     using namespace boost::posix_time;
     std::cout << "Testing DHCPv4 packet reception timeouts."
@@ -2280,6 +2304,11 @@ TEST_F(IfaceMgrTest, receiveTimeout4Poll) {
     testReceiveTimeout4();
 }
 
+TEST_F(IfaceMgrTest, receiveTimeout4Epoll) {
+    kea_event_handler_type_.setValue("epoll");
+    testReceiveTimeout4();
+}
+
 TEST_F(IfaceMgrTest, multipleSockets) {
     scoped_ptr<NakedIfaceMgr> ifacemgr(new NakedIfaceMgr());
 
@@ -2640,6 +2669,47 @@ TEST_F(IfaceMgrTest, setPacketFilter) {
     EXPECT_NO_THROW(iface_mgr->setPacketFilter(custom_packet_filter));
 }
 
+// This test checks that the packet filter is told when a socket is closed,
+// whichever way the socket is closed.
+TEST_F(IfaceMgrTest, releaseSocket) {
+    boost::scoped_ptr<NakedIfaceMgr> iface_mgr(new NakedIfaceMgr());
+    ASSERT_TRUE(iface_mgr);
+
+    boost::shared_ptr<TestPktFilter> custom_packet_filter(new TestPktFilter());
+    ASSERT_NO_THROW(iface_mgr->setPacketFilter(custom_packet_filter));
+
+    IOAddress lo_addr("127.0.0.1");
+    int socket1 = 0;
+    ASSERT_NO_THROW(
+        socket1 = iface_mgr->openSocket(LOOPBACK_NAME, lo_addr,
+                                        DHCP4_SERVER_PORT + 10000);
+    );
+    EXPECT_TRUE(custom_packet_filter->released_sockets_.empty());
+
+    // Delete the socket from the interface.
+    IfacePtr iface = iface_mgr->getIface(LOOPBACK_NAME);
+    ASSERT_TRUE(iface);
+    EXPECT_TRUE(iface->delSocket(socket1));
+    ASSERT_EQ(1U, custom_packet_filter->released_sockets_.size());
+    EXPECT_EQ(socket1, custom_packet_filter->released_sockets_[0]);
+
+    // Close all the sockets.
+    ASSERT_NO_THROW(
+        socket1 = iface_mgr->openSocket(LOOPBACK_NAME, lo_addr,
+                                        DHCP4_SERVER_PORT + 10000);
+    );
+    iface_mgr->closeSockets();
+    ASSERT_EQ(2U, custom_packet_filter->released_sockets_.size());
+    EXPECT_EQ(socket1, custom_packet_filter->released_sockets_[1]);
+
+    // Once the interface is removed from the manager it no longer
+    // calls it.
+    iface_mgr->clearIfaces();
+    iface->addSocket(SocketInfo(lo_addr, DHCP4_SERVER_PORT + 10000, 255));
+    EXPECT_TRUE(iface->delSocket(255));
+    EXPECT_EQ(2U, custom_packet_filter->released_sockets_.size());
+}
+
 // This test checks that the default packet filter for DHCPv6 can be replaced
 // with the custom one.
 TEST_F(IfaceMgrTest, setPacketFilter6) {
@@ -4055,6 +4125,11 @@ TEST_F(IfaceMgrTest, SingleExternalSocket4Poll) {
     testSingleExternalSocket4();
 }
 
+TEST_F(IfaceMgrTest, SingleExternalSocket4Epoll) {
+    kea_event_handler_type_.setValue("epoll");
+    testSingleExternalSocket4();
+}
+
 // Tests if multiple external sockets and their callbacks can be passed and
 // it is supported properly by receive4() method.
 void IfaceMgrTest::testMultipleExternalSockets4() {
@@ -4143,6 +4218,11 @@ TEST_F(IfaceMgrTest, MultipleExternalSockets4Poll) {
     testMultipleExternalSockets4();
 }
 
+TEST_F(IfaceMgrTest, MultipleExternalSockets4Epoll) {
+    kea_event_handler_type_.setValue("epoll");
+    testMultipleExternalSockets4();
+}
+
 // Tests if existing external socket can be deleted and that such deletion does
 // not affect any other existing sockets. Tests uses receive4()
 void IfaceMgrTest::testDeleteExternalSockets4() {
@@ -4208,6 +4288,145 @@ TEST_F(IfaceMgrTest, DeleteExternalSockets4Poll) {
     testDeleteExternalSockets4();
 }
 
+TEST_F(IfaceMgrTest, DeleteExternalSockets4Epoll) {
+    kea_event_handler_type_.setValue("epoll");
+    testDeleteExternalSockets4();
+}
+
+// Tests that an external socket replaced by another socket with the same
+// descriptor is watched by receive4().
+void IfaceMgrTest::testReopenExternalSocket4() {
+    callback_ok = false;
+
+    scoped_ptr<NakedIfaceMgr> ifacemgr(new NakedIfaceMgr());
+
+    // Create pipe and register it as extra socket
+    int pipefd[2];
+    EXPECT_TRUE(pipe(pipefd) == 0);
+    EXPECT_NO_THROW(ifacemgr->addExternalSocket(pipefd[0], my_callback));
+
+    // Wait once so the socket is watched.
+    Pkt4Ptr pkt4;
+    ASSERT_NO_THROW(pkt4 = ifacemgr->receive4(RECEIVE_WAIT_MS(10)));
+    EXPECT_FALSE(callback_ok);
+
+    // Replace the pipe by a new one using the same descriptor.
+    EXPECT_NO_THROW(ifacemgr->deleteExternalSocket(pipefd[0]));
+    close(pipefd[1]);
+    int newpipe[2];
+    EXPECT_TRUE(pipe(newpipe) == 0);
+    ASSERT_EQ(pipefd[0], dup2(newpipe[0], pipefd[0]));
+    close(newpipe[0]);
+    pipefd[1] = newpipe[1];
+    EXPECT_NO_THROW(ifacemgr->addExternalSocket(pipefd[0], my_callback));
+
+    // Send some data over the new pipe.
+    EXPECT_EQ(38, write(pipefd[1], "Hi, this is a message sent over a pipe", 38));
+
+    ASSERT_NO_THROW(pkt4 = ifacemgr->receive4(1));
+    EXPECT_FALSE(pkt4);
+
+    // The callback of the new pipe should be called.
+    EXPECT_TRUE(callback_ok);
+
+    // close both pipe ends
+    close(pipefd[1]);
+    close(pipefd[0]);
+}
+
+TEST_F(IfaceMgrTest, ReopenExternalSocket4Select) {
+    kea_event_handler_type_.setValue("select");
+    testReopenExternalSocket4();
+}
+
+TEST_F(IfaceMgrTest, ReopenExternalSocket4Poll) {
+    kea_event_handler_type_.setValue("poll");
+    testReopenExternalSocket4();
+}
+
+TEST_F(IfaceMgrTest, ReopenExternalSocket4Epoll) {
+    kea_event_handler_type_.setValue("epoll");
+    testReopenExternalSocket4();
+}
+
+void IfaceMgrTest::testReinitializeExternalSocket4() {
+    callback_ok = false;
+
+    scoped_ptr<NakedIfaceMgr> ifacemgr(new NakedIfaceMgr());
+
+    // Create pipe and register it as extra socket
+    int pipefd[2];
+    EXPECT_TRUE(pipe(pipefd) == 0);
+    EXPECT_NO_THROW(ifacemgr->addExternalSocket(pipefd[0], my_callback));
+
+    // Replace the FD event handler as done on reconfiguration.
+    ASSERT_NO_THROW(ifacemgr->initializeFDEventHandler());
+
+    // Send some data over the pipe.
+    EXPECT_EQ(38, write(pipefd[1], "Hi, this is a message sent over a pipe", 38));
+
+    Pkt4Ptr pkt4;
+    ASSERT_NO_THROW(pkt4 = ifacemgr->receive4(1));
+    EXPECT_FALSE(pkt4);
+
+    // The callback should be called.
+    EXPECT_TRUE(callback_ok);
+
+    // close both pipe ends
+    close(pipefd[1]);
+    close(pipefd[0]);
+}
+
+TEST_F(IfaceMgrTest, ReinitializeExternalSocket4Select) {
+    kea_event_handler_type_.setValue("select");
+    testReinitializeExternalSocket4();
+}
+
+TEST_F(IfaceMgrTest, ReinitializeExternalSocket4Poll) {
+    kea_event_handler_type_.setValue("poll");
+    testReinitializeExternalSocket4();
+}
+
+TEST_F(IfaceMgrTest, ReinitializeExternalSocket4Epoll) {
+    kea_event_handler_type_.setValue("epoll");
+    testReinitializeExternalSocket4();
+}
+
+// Tests that a registered external socket which is closed is detected
+// with epoll even if the kernel silently removed it from the epoll set.
+TEST_F(IfaceMgrTest, closedExternalSocket4Epoll) {
+    kea_event_handler_type_.setValue("epoll");
+    callback_ok = false;
+
+    scoped_ptr<NakedIfaceMgr> ifacemgr(new NakedIfaceMgr());
+
+    // Create pipe and register it as extra socket
+    int pipefd[2];
+    EXPECT_TRUE(pipe(pipefd) == 0);
+    EXPECT_NO_THROW(ifacemgr->addExternalSocket(pipefd[0], my_callback));
+
+    // Wait once so the socket is watched.
+    Pkt4Ptr pkt4;
+    ASSERT_NO_THROW(pkt4 = ifacemgr->receive4(RECEIVE_WAIT_MS(10)));
+    EXPECT_FALSE(callback_ok);
+
+    // Close the pipe: this removes it from the epoll set.
+    close(pipefd[1]);
+    close(pipefd[0]);
+
+    // The next wait should report the closed socket.
+    std::ostringstream err_msg;
+    err_msg << "unexpected state (closed) for fd: " << pipefd[0];
+    EXPECT_THROW_MSG(ifacemgr->receive4(RECEIVE_WAIT_MS(10)), SocketFDError,
+                     err_msg.str());
+    EXPECT_TRUE(ifacemgr->isExternalSocketUnusable(pipefd[0]));
+
+    // The unusable socket is then skipped.
+    ASSERT_NO_THROW(pkt4 = ifacemgr->receive4(RECEIVE_WAIT_MS(10)));
+    EXPECT_FALSE(pkt4);
+    EXPECT_FALSE(callback_ok);
+}
+
 TEST_F(IfaceMgrTest, unusableExternalSockets4DirectSelect) {
     kea_event_handler_type_.setValue("select");
     unusableExternalSockets4Test();
@@ -4218,6 +4437,11 @@ TEST_F(IfaceMgrTest, unusableExternalSockets4DirectPoll) {
     unusableExternalSockets4Test();
 }
 
+TEST_F(IfaceMgrTest, unusableExternalSockets4DirectEpoll) {
+    kea_event_handler_type_.setValue("epoll");
+    unusableExternalSockets4Test();
+}
+
 TEST_F(IfaceMgrTest, unusableExternalSockets4IndirectSelect) {
     kea_event_handler_type_.setValue("select");
     unusableExternalSockets4Test(true);
@@ -4228,6 +4452,11 @@ TEST_F(IfaceMgrTest, unusableExternalSockets4IndirectPoll) {
     unusableExternalSockets4Test(true);
 }
 
+TEST_F(IfaceMgrTest, unusableExternalSockets4IndirectEpoll) {
+    kea_event_handler_type_.setValue("epoll");
+    unusableExternalSockets4Test(true);
+}
+
 /// @brief Verifies that IfaceMgr DHCPv4 receive calls follow a LRU order.
 TEST_F(IfaceMgrTest, lruExternalSockets4) {
     lruExternalSockets4Test();
@@ -4286,6 +4515,11 @@ TEST_F(IfaceMgrTest, SingleExternalSocket6Poll) {
     testSingleExternalSocket6();
 }
 
+TEST_F(IfaceMgrTest, SingleExternalSocket6Epoll) {
+    kea_event_handler_type_.setValue("epoll");
+    testSingleExternalSocket6();
+}
+
 // Tests if multiple external sockets and their callbacks can be passed and
 // it is supported properly by receive6() method.
 void IfaceMgrTest::testMultipleExternalSockets6() {
@@ -4374,6 +4608,11 @@ TEST_F(IfaceMgrTest, MultipleExternalSockets6Poll) {
     testMultipleExternalSockets6();
 }
 
+TEST_F(IfaceMgrTest, MultipleExternalSockets6Epoll) {
+    kea_event_handler_type_.setValue("epoll");
+    testMultipleExternalSockets6();
+}
+
 // Tests if existing external socket can be deleted and that such deletion does
 // not affect any other existing sockets. Tests uses receive6()
 void IfaceMgrTest::testDeleteExternalSockets6() {
@@ -4439,6 +4678,11 @@ TEST_F(IfaceMgrTest, DeleteExternalSockets6Poll) {
     testDeleteExternalSockets6();
 }
 
+TEST_F(IfaceMgrTest, DeleteExternalSockets6Epoll) {
+    kea_event_handler_type_.setValue("epoll");
+    testDeleteExternalSockets6();
+}
+
 // Tests that an existing external socket that becomes invalid
 // is detected and ignored, without affecting other sockets.
 // Tests uses receive6() without queuing.
@@ -4452,6 +4696,11 @@ TEST_F(IfaceMgrTest, unusableExternalSockets6DirectPoll) {
     unusableExternalSockets6Test();
 }
 
+TEST_F(IfaceMgrTest, unusableExternalSockets6DirectEpoll) {
+    kea_event_handler_type_.setValue("epoll");
+    unusableExternalSockets6Test();
+}
+
 // Tests that an existing external socket that becomes invalid
 // is detected and ignored, without affecting other sockets.
 // Tests uses receive6() with queuing.
@@ -4465,6 +4714,11 @@ TEST_F(IfaceMgrTest, unusableExternalSockets6IndirectPoll) {
     unusableExternalSockets6Test(true);
 }
 
+TEST_F(IfaceMgrTest, unusableExternalSockets6IndirectEpoll) {
+    kea_event_handler_type_.setValue("epoll");
+    unusableExternalSockets6Test(true);
+}
+
 /// @brief Test fixture for logs.
 class IfaceMgrLogTest : public LogContentTest {
 public:
@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2025 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -196,6 +196,81 @@ TEST_F(RootPktFilterLPFTest, receive) {
     testReceivedPktEvents(rcvd_pkt, pkt_filter.isSocketReceivedTimeSupported());
 }
 
+// This test verifies that the packets are received through the memory
+// mapped ring when it is enabled, and with recvmsg otherwise.
+TEST_F(RootPktFilterLPFTest, ring) {
+    SKIP_IF(notRoot());
+
+    Iface iface(ifname_, ifindex_);
+    IOAddress addr("127.0.0.1");
+
+    // The ring is disabled by default.
+    PktFilterLPF pkt_filter;
+    sock_info_ = pkt_filter.openSocket(iface, addr, PORT, false, false);
+    ASSERT_GE(sock_info_.sockfd_, 0);
+    EXPECT_FALSE(pkt_filter.hasRing(sock_info_.sockfd_));
+    close(sock_info_.sockfd_);
+    close(sock_info_.fallbackfd_);
+
+    PktFilterLPF ring_filter(true);
+    sock_info_ = ring_filter.openSocket(iface, addr, PORT, false, false);
+    ASSERT_GE(sock_info_.sockfd_, 0);
+#ifdef HAVE_TPACKET_V3
+    EXPECT_TRUE(ring_filter.hasRing(sock_info_.sockfd_));
+#else
+    EXPECT_FALSE(ring_filter.hasRing(sock_info_.sockfd_));
+#endif
+    // Unknown sockets have no ring.
+    EXPECT_FALSE(ring_filter.hasRing(sock_info_.fallbackfd_));
+
+    // The ring is unmapped when the socket is released.
+    ring_filter.releaseSocket(sock_info_.sockfd_);
+    EXPECT_FALSE(ring_filter.hasRing(sock_info_.sockfd_));
+}
+
+// This test verifies the reception of several DHCP packets through the
+// memory mapped ring.
+TEST_F(RootPktFilterLPFTest, receiveRing) {
+    SKIP_IF(notRoot());
+
+    Iface iface(ifname_, ifindex_);
+    IOAddress addr("127.0.0.1");
+
+    PktFilterLPF pkt_filter(true);
+    sock_info_ = pkt_filter.openSocket(iface, addr, PORT, false, false);
+    ASSERT_GE(sock_info_.sockfd_, 0);
+
+    // Send a few messages: they end up in the same block of the ring.
+    const unsigned MESSAGES = 3;
+    for (unsigned i = 0; i < MESSAGES; ++i) {
+        sendMessage();
+    }
+
+    // The block is handed over after the block timeout at most. The
+    // messages may be seen twice on the loopback interface.
+    unsigned received = 0;
+    while (selectCheck(sock_info_.sockfd_, 1) > 0) {
+        // The frames of the ring are not seen by FIONREAD.
+        EXPECT_TRUE(pkt_filter.hasDataToRead(sock_info_.sockfd_));
+        Pkt4Ptr rcvd_pkt = pkt_filter.receive(iface, sock_info_);
+        if (!rcvd_pkt) {
+            break;
+        }
+        ++received;
+
+        ASSERT_NO_THROW(rcvd_pkt->unpack());
+        testRcvdMessage(rcvd_pkt);
+        testRcvdMessageAddressPort(rcvd_pkt);
+        testReceivedPktEvents(rcvd_pkt,
+                              pkt_filter.isSocketReceivedTimeSupported());
+    }
+    EXPECT_GE(received, MESSAGES);
+
+    // The ring is empty.
+    EXPECT_FALSE(pkt_filter.hasDataToRead(sock_info_.sockfd_));
+    EXPECT_FALSE(pkt_filter.receive(iface, sock_info_));
+}
+
 // This test verifies that if the packet is received over the raw
 // socket and its destination address doesn't match the address
 // to which the socket is "bound", the packet is dropped.
@@ -413,17 +413,13 @@ AllocEngine::findReservation(ClientContext6& ctx) {
                     ctx.hosts_[subnet->getID()] = host_map[subnet->getID()];
                 }
             } else {
-                for (const IdentifierPair& id_pair : ctx.host_identifiers_) {
-                    // Attempt to find a host using a specified identifier.
-                    ConstHostPtr host = HostMgr::instance().get6(subnet->getID(),
-                                                                 id_pair.first,
-                                                                 &id_pair.second[0],
-                                                                 id_pair.second.size());
-                    // If we found matching host for this subnet.
-                    if (host) {
-                        ctx.hosts_[subnet->getID()] = host;
-                        break;
-                    }
+                // Attempt to find a host using the identifiers in the
+                // order of preference.
+                ConstHostPtr host = HostMgr::instance().get6(subnet->getID(),
+                                                             ctx.host_identifiers_);
+                // If we found matching host for this subnet.
+                if (host) {
+                    ctx.hosts_[subnet->getID()] = host;
                 }
             }
         }
@@ -444,19 +440,9 @@ AllocEngine::findReservation(ClientContext6& ctx) {
 
 ConstHostPtr
 AllocEngine::findGlobalReservation(ClientContext6& ctx) {
-    ConstHostPtr host;
-    for (const IdentifierPair& id_pair : ctx.host_identifiers_) {
-        // Attempt to find a host using a specified identifier.
-        host = HostMgr::instance().get6(SUBNET_ID_GLOBAL, id_pair.first,
-                                        &id_pair.second[0], id_pair.second.size());
-
-        // If we found matching global host we're done.
-        if (host) {
-            break;
-        }
-    }
-
-    return (host);
+    // Attempt to find a host using the identifiers in the order of
+    // preference.
+    return (HostMgr::instance().get6(SUBNET_ID_GLOBAL, ctx.host_identifiers_));
 }
 
 Lease6Collection
@@ -4078,17 +4064,13 @@ AllocEngine::findReservation(ClientContext4& ctx) {
                     ctx.hosts_[subnet->getID()] = host_map[subnet->getID()];
                 }
             } else {
-                for (const IdentifierPair& id_pair : ctx.host_identifiers_) {
-                    // Attempt to find a host using a specified identifier.
-                    ConstHostPtr host = HostMgr::instance().get4(subnet->getID(),
-                                                                 id_pair.first,
-                                                                 &id_pair.second[0],
-                                                                 id_pair.second.size());
-                    // If we found matching host for this subnet.
-                    if (host) {
-                        ctx.hosts_[subnet->getID()] = host;
-                        break;
-                    }
+                // Attempt to find a host using the identifiers in the
+                // order of preference.
+                ConstHostPtr host = HostMgr::instance().get4(subnet->getID(),
+                                                             ctx.host_identifiers_);
+                // If we found matching host for this subnet.
+                if (host) {
+                    ctx.hosts_[subnet->getID()] = host;
                 }
             }
         }
@@ -4109,19 +4091,9 @@ AllocEngine::findReservation(ClientContext4& ctx) {
 
 ConstHostPtr
 AllocEngine::findGlobalReservation(ClientContext4& ctx) {
-    ConstHostPtr host;
-    for (const IdentifierPair& id_pair : ctx.host_identifiers_) {
-        // Attempt to find a host using a specified identifier.
-        host = HostMgr::instance().get4(SUBNET_ID_GLOBAL, id_pair.first,
-                                        &id_pair.second[0], id_pair.second.size());
-
-        // If we found matching global host we're done.
-        if (host) {
-            break;
-        }
-    }
-
-    return (host);
+    // Attempt to find a host using the identifiers in the order of
+    // preference.
+    return (HostMgr::instance().get4(SUBNET_ID_GLOBAL, ctx.host_identifiers_));
 }
 
 Lease4Ptr
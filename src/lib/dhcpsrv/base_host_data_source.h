@@ -14,11 +14,19 @@
 #include <boost/shared_ptr.hpp>
 
 #include <limits>
+#include <list>
+#include <utility>
 #include <vector>
 
 namespace isc {
 namespace dhcp {
 
+/// @brief Host identifier type and value.
+typedef std::pair<Host::IdentifierType, std::vector<uint8_t> > HostIdentifierPair;
+
+/// @brief Host identifiers in the order of preference.
+typedef std::list<HostIdentifierPair> HostIdentifierList;
+
 /// @brief Exception thrown when the duplicate @c Host object is detected.
 class DuplicateHost : public Exception {
 public:
@@ -299,6 +307,29 @@ public:
          const uint8_t* identifier_begin,
          const size_t identifier_len) const = 0;
 
+    /// @brief Returns the hosts connected to the IPv4 subnet for
+    /// several identifiers.
+    ///
+    /// The default implementation calls @c get4 for each identifier.
+    /// Database backends can override it to send the lookups at once.
+    ///
+    /// @param subnet_id Subnet identifier.
+    /// @param identifiers Identifiers to look up.
+    ///
+    /// @return Const @c Host objects in the order of the identifiers,
+    /// null when there is no reservation for an identifier.
+    virtual ConstHostCollection
+    getByIdentifiers4(const SubnetID& subnet_id,
+                      const HostIdentifierList& identifiers) const {
+        ConstHostCollection hosts;
+        for (auto const& id_pair : identifiers) {
+            hosts.push_back(get4(subnet_id, id_pair.first,
+                                 id_pair.second.data(),
+                                 id_pair.second.size()));
+        }
+        return (hosts);
+    }
+
     /// @brief Returns a host connected to the IPv4 subnet and having
     /// a reservation for a specified IPv4 address.
     ///
@@ -362,6 +393,29 @@ public:
          const uint8_t* identifier_begin,
          const size_t identifier_len) const = 0;
 
+    /// @brief Returns the hosts connected to the IPv6 subnet for
+    /// several identifiers.
+    ///
+    /// The default implementation calls @c get6 for each identifier.
+    /// Database backends can override it to send the lookups at once.
+    ///
+    /// @param subnet_id Subnet identifier.
+    /// @param identifiers Identifiers to look up.
+    ///
+    /// @return Const @c Host objects in the order of the identifiers,
+    /// null when there is no reservation for an identifier.
+    virtual ConstHostCollection
+    getByIdentifiers6(const SubnetID& subnet_id,
+                      const HostIdentifierList& identifiers) const {
+        ConstHostCollection hosts;
+        for (auto const& id_pair : identifiers) {
+            hosts.push_back(get6(subnet_id, id_pair.first,
+                                 id_pair.second.data(),
+                                 id_pair.second.size()));
+        }
+        return (hosts);
+    }
+
     /// @brief Returns a host using the specified IPv6 prefix.
     ///
     /// @param prefix IPv6 prefix for which the @c Host object is searched.
@@ -141,7 +141,9 @@ CBControlDHCPv4::databaseConfigApply(const BackendSelector& backend_selector,
                         // Detach the subnet from the shared network.
                         network->del(subnet->getID());
                     }
-                    // Actually delete the subnet from the configuration.
+                    // Remove the statistics of the subnet and actually
+                    // delete the subnet from the configuration.
+                    current_cfg->getCfgSubnets4()->removeStatistics(SubnetIDSet{ subnet->getID() });
                     current_cfg->getCfgSubnets4()->del(entry->getObjectId());
                 }
             }
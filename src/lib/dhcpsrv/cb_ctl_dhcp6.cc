@@ -140,7 +140,9 @@ CBControlDHCPv6::databaseConfigApply(const db::BackendSelector& backend_selector
                         // Detach the subnet from the shared network.
                         network->del(subnet->getID());
                     }
-                    // Actually delete the subnet from the configuration.
+                    // Remove the statistics of the subnet and actually
+                    // delete the subnet from the configuration.
+                    current_cfg->getCfgSubnets6()->removeStatistics(SubnetIDSet{ subnet->getID() });
                     current_cfg->getCfgSubnets6()->del(entry->getObjectId());
                 }
             }
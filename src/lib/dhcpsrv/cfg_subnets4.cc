@@ -508,111 +508,170 @@ CfgSubnets4::getLinks(const IOAddress& link_addr) const {
     return (links);
 }
 
+SubnetIDSet
+CfgSubnets4::getReplacedSubnetIds(const CfgSubnets4& other) const {
+    SubnetIDSet replaced;
+    auto const& index_id = subnets_.get<SubnetSubnetIdIndexTag>();
+    auto const& index_prefix = subnets_.get<SubnetPrefixIndexTag>();
+    for (auto const& other_subnet : other.subnets_) {
+        auto subnet_id_it = index_id.find(other_subnet->getID());
+        if ((subnet_id_it != index_id.end()) && (*subnet_id_it != other_subnet)) {
+            replaced.insert((*subnet_id_it)->getID());
+        }
+        auto subnet_prefix_it = index_prefix.find(other_subnet->toText());
+        if ((subnet_prefix_it != index_prefix.end()) &&
+            (*subnet_prefix_it != other_subnet)) {
+            replaced.insert((*subnet_prefix_it)->getID());
+        }
+    }
+    return (replaced);
+}
+
 void
 CfgSubnets4::removeStatistics() {
+    // For each v4 subnet currently configured, remove the statistics.
+    for (auto const& subnet4 : subnets_) {
+        removeSubnetStatistics(subnet4);
+    }
+}
+
+void
+CfgSubnets4::removeStatistics(const SubnetIDSet& subnet_ids) {
+    auto const& index = subnets_.get<SubnetSubnetIdIndexTag>();
+    for (auto const& subnet_id : subnet_ids) {
+        auto subnet_it = index.find(subnet_id);
+        if (subnet_it != index.end()) {
+            removeSubnetStatistics(*subnet_it);
+        }
+    }
+}
+
+void
+CfgSubnets4::removeSubnetStatistics(const ConstSubnet4Ptr& subnet4) {
     using namespace isc::stats;
 
-    // For each v4 subnet currently configured, remove the statistic.
     StatsMgr& stats_mgr = StatsMgr::instance();
-    for (auto const& subnet4 : subnets_) {
-        SubnetID subnet_id = subnet4->getID();
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "total-addresses"));
+    SubnetID subnet_id = subnet4->getID();
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "total-addresses"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "assigned-addresses"));
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "assigned-addresses"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "cumulative-assigned-addresses"));
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "cumulative-assigned-addresses"));
+
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "declined-addresses"));
 
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "reclaimed-declined-addresses"));
+
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "reclaimed-leases"));
+
+    for (auto const& pool : subnet4->getPools(Lease::TYPE_V4)) {
         stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "declined-addresses"));
+                                             StatsMgr::generateName("pool", pool->getID(),
+                                                                    "total-addresses")));
 
         stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "reclaimed-declined-addresses"));
+                                             StatsMgr::generateName("pool", pool->getID(),
+                                                                    "assigned-addresses")));
 
         stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "reclaimed-leases"));
+                                             StatsMgr::generateName("pool", pool->getID(),
+                                                                    "cumulative-assigned-addresses")));
 
-        for (auto const& pool : subnet4->getPools(Lease::TYPE_V4)) {
-            stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                                 StatsMgr::generateName("pool", pool->getID(),
-                                                                        "total-addresses")));
+        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                             StatsMgr::generateName("pool", pool->getID(),
+                                                                    "declined-addresses")));
 
-            stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                                 StatsMgr::generateName("pool", pool->getID(),
-                                                                        "assigned-addresses")));
+        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                             StatsMgr::generateName("pool", pool->getID(),
+                                                                    "reclaimed-declined-addresses")));
 
-            stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                                 StatsMgr::generateName("pool", pool->getID(),
-                                                                        "cumulative-assigned-addresses")));
+        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                             StatsMgr::generateName("pool", pool->getID(),
+                                                                    "reclaimed-leases")));
+    }
+}
 
-            stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                                 StatsMgr::generateName("pool", pool->getID(),
-                                                                        "declined-addresses")));
+void
+CfgSubnets4::updateStatistics() {
+    // For each v4 subnet currently configured, calculate totals.
+    for (auto const& subnet4 : subnets_) {
+        updateSubnetStatistics(subnet4);
+    }
 
-            stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                                 StatsMgr::generateName("pool", pool->getID(),
-                                                                        "reclaimed-declined-addresses")));
+    // Only recount the stats if we have subnets.
+    if (subnets_.begin() != subnets_.end()) {
+        LeaseMgrFactory::instance().recountLeaseStats4();
+    }
+}
 
-            stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                                 StatsMgr::generateName("pool", pool->getID(),
-                                                                        "reclaimed-leases")));
+void
+CfgSubnets4::updateStatistics(const SubnetIDSet& subnet_ids) {
+    auto const& index = subnets_.get<SubnetSubnetIdIndexTag>();
+    SubnetIDSet updated;
+    for (auto const& subnet_id : subnet_ids) {
+        auto subnet_it = index.find(subnet_id);
+        if (subnet_it != index.end()) {
+            updateSubnetStatistics(*subnet_it);
+            updated.insert(subnet_id);
         }
     }
+
+    // Only recount the stats of the updated subnets.
+    if (!updated.empty()) {
+        LeaseMgrFactory::instance().recountLeaseStats4(updated);
+    }
 }
 
 void
-CfgSubnets4::updateStatistics() {
+CfgSubnets4::updateSubnetStatistics(const ConstSubnet4Ptr& subnet4) {
     using namespace isc::stats;
 
     StatsMgr& stats_mgr = StatsMgr::instance();
-    for (auto const& subnet4 : subnets_) {
-        SubnetID subnet_id = subnet4->getID();
-
-        stats_mgr.setValue(StatsMgr::
-                           generateName("subnet", subnet_id, "total-addresses"),
-                                        int64_t(subnet4->getPoolCapacity(Lease::TYPE_V4)));
-        const std::string& name(StatsMgr::generateName("subnet", subnet_id,
-                                                       "cumulative-assigned-addresses"));
-        if (!stats_mgr.getObservation(name)) {
-            stats_mgr.setValue(name, static_cast<int64_t>(0));
-        }
-
-        const std::string& name_reuses(StatsMgr::generateName("subnet", subnet_id,
-                                                              "v4-lease-reuses"));
-        if (!stats_mgr.getObservation(name_reuses)) {
-            stats_mgr.setValue(name_reuses, int64_t(0));
-        }
+    SubnetID subnet_id = subnet4->getID();
+
+    stats_mgr.setValue(StatsMgr::
+                       generateName("subnet", subnet_id, "total-addresses"),
+                                    int64_t(subnet4->getPoolCapacity(Lease::TYPE_V4)));
+    const std::string& name(StatsMgr::generateName("subnet", subnet_id,
+                                                   "cumulative-assigned-addresses"));
+    if (!stats_mgr.getObservation(name)) {
+        stats_mgr.setValue(name, static_cast<int64_t>(0));
+    }
 
-        const std::string& name_conflicts(StatsMgr::generateName("subnet", subnet_id,
-                                                                 "v4-reservation-conflicts"));
-        if (!stats_mgr.getObservation(name_conflicts)) {
-            stats_mgr.setValue(name_conflicts, static_cast<int64_t>(0));
-        }
+    const std::string& name_reuses(StatsMgr::generateName("subnet", subnet_id,
+                                                          "v4-lease-reuses"));
+    if (!stats_mgr.getObservation(name_reuses)) {
+        stats_mgr.setValue(name_reuses, int64_t(0));
+    }
 
-        for (auto const& pool : subnet4->getPools(Lease::TYPE_V4)) {
-            const std::string& name_total(StatsMgr::generateName("subnet", subnet_id,
-                                                                 StatsMgr::generateName("pool", pool->getID(),
-                                                                                        "total-addresses")));
-            if (!stats_mgr.getObservation(name_total)) {
-                stats_mgr.setValue(name_total, static_cast<int64_t>(pool->getCapacity()));
-            } else {
-                stats_mgr.addValue(name_total, static_cast<int64_t>(pool->getCapacity()));
-            }
+    const std::string& name_conflicts(StatsMgr::generateName("subnet", subnet_id,
+                                                             "v4-reservation-conflicts"));
+    if (!stats_mgr.getObservation(name_conflicts)) {
+        stats_mgr.setValue(name_conflicts, static_cast<int64_t>(0));
+    }
 
-            const std::string& name_ca(StatsMgr::generateName("subnet", subnet_id,
-                                                              StatsMgr::generateName("pool", pool->getID(),
-                                                                                     "cumulative-assigned-addresses")));
-            if (!stats_mgr.getObservation(name_ca)) {
-                stats_mgr.setValue(name_ca, static_cast<int64_t>(0));
-            }
+    for (auto const& pool : subnet4->getPools(Lease::TYPE_V4)) {
+        const std::string& name_total(StatsMgr::generateName("subnet", subnet_id,
+                                                             StatsMgr::generateName("pool", pool->getID(),
+                                                                                    "total-addresses")));
+        if (!stats_mgr.getObservation(name_total)) {
+            stats_mgr.setValue(name_total, static_cast<int64_t>(pool->getCapacity()));
+        } else {
+            stats_mgr.addValue(name_total, static_cast<int64_t>(pool->getCapacity()));
         }
-    }
 
-    // Only recount the stats if we have subnets.
-    if (subnets_.begin() != subnets_.end()) {
-        LeaseMgrFactory::instance().recountLeaseStats4();
+        const std::string& name_ca(StatsMgr::generateName("subnet", subnet_id,
+                                                          StatsMgr::generateName("pool", pool->getID(),
+                                                                                 "cumulative-assigned-addresses")));
+        if (!stats_mgr.getObservation(name_ca)) {
+            stats_mgr.setValue(name_ca, static_cast<int64_t>(0));
+        }
     }
 }
 
@@ -624,9 +683,41 @@ CfgSubnets4::initAllocatorsAfterConfigure() {
     }
 }
 
+size_t
+CfgSubnets4::carryOverAllocationStates(const CfgSubnets4& previous) {
+    size_t count = 0;
+    auto const& index = previous.subnets_.get<SubnetSubnetIdIndexTag>();
+    for (auto const& subnet : subnets_) {
+        auto prev = index.find(subnet->getID());
+        if ((prev != index.end()) &&
+            subnet->carryOverAllocationStates(**prev)) {
+            ++count;
+        }
+    }
+    if (count > 0) {
+        LOG_INFO(dhcpsrv_logger, DHCPSRV_CFGMGR_ALLOCATION_STATES_CARRIED_OVER)
+            .arg(count);
+    }
+    return (count);
+}
+
+size_t
+CfgSubnets4::keepStatistics(const CfgSubnets4& previous) {
+    kept_statistics_.clear();
+    auto const& index = previous.subnets_.get<SubnetSubnetIdIndexTag>();
+    for (auto const& subnet : subnets_) {
+        auto prev = index.find(subnet->getID());
+        if ((prev != index.end()) && subnet->samePools(**prev)) {
+            kept_statistics_.insert(subnet->getID());
+        }
+    }
+    return (kept_statistics_.size());
+}
+
 void
 CfgSubnets4::clear() {
     subnets_.clear();
+    kept_statistics_.clear();
 }
 
 ElementPtr
@@ -395,181 +395,239 @@ CfgSubnets6::getLinks(const IOAddress& link_addr) const {
     return (links);
 }
 
+SubnetIDSet
+CfgSubnets6::getReplacedSubnetIds(const CfgSubnets6& other) const {
+    SubnetIDSet replaced;
+    auto const& index_id = subnets_.get<SubnetSubnetIdIndexTag>();
+    auto const& index_prefix = subnets_.get<SubnetPrefixIndexTag>();
+    for (auto const& other_subnet : other.subnets_) {
+        auto subnet_id_it = index_id.find(other_subnet->getID());
+        if ((subnet_id_it != index_id.end()) && (*subnet_id_it != other_subnet)) {
+            replaced.insert((*subnet_id_it)->getID());
+        }
+        auto subnet_prefix_it = index_prefix.find(other_subnet->toText());
+        if ((subnet_prefix_it != index_prefix.end()) &&
+            (*subnet_prefix_it != other_subnet)) {
+            replaced.insert((*subnet_prefix_it)->getID());
+        }
+    }
+    return (replaced);
+}
+
 void
 CfgSubnets6::removeStatistics() {
+    // For each v6 subnet currently configured, remove the statistics.
+    for (auto const& subnet6 : subnets_) {
+        removeSubnetStatistics(subnet6);
+    }
+}
+
+void
+CfgSubnets6::removeStatistics(const SubnetIDSet& subnet_ids) {
+    auto const& index = subnets_.get<SubnetSubnetIdIndexTag>();
+    for (auto const& subnet_id : subnet_ids) {
+        auto subnet_it = index.find(subnet_id);
+        if (subnet_it != index.end()) {
+            removeSubnetStatistics(*subnet_it);
+        }
+    }
+}
+
+void
+CfgSubnets6::removeSubnetStatistics(const ConstSubnet6Ptr& subnet6) {
     using namespace isc::stats;
 
     StatsMgr& stats_mgr = StatsMgr::instance();
-    // For each v6 subnet currently configured, remove the statistics.
-    for (auto const& subnet6 : subnets_) {
-        SubnetID subnet_id = subnet6->getID();
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "total-nas"));
+    SubnetID subnet_id = subnet6->getID();
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "total-nas"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "assigned-nas"));
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "assigned-nas"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "cumulative-assigned-nas"));
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "cumulative-assigned-nas"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "total-pds"));
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "total-pds"));
+
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "assigned-pds"));
+
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "cumulative-assigned-pds"));
+
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "declined-addresses"));
+
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "reclaimed-declined-addresses"));
 
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "reclaimed-leases"));
+
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "cumulative-registered-nas"));
+
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "registered-nas"));
+
+    for (auto const& pool : subnet6->getPools(Lease::TYPE_NA)) {
         stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "assigned-pds"));
+                                             StatsMgr::generateName("pool", pool->getID(),
+                                                                    "total-nas")));
 
         stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "cumulative-assigned-pds"));
+                                             StatsMgr::generateName("pool", pool->getID(),
+                                                                    "assigned-nas")));
 
         stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "declined-addresses"));
+                                             StatsMgr::generateName("pool", pool->getID(),
+                                                                    "cumulative-assigned-nas")));
 
         stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "reclaimed-declined-addresses"));
+                                             StatsMgr::generateName("pool", pool->getID(),
+                                                                    "declined-addresses")));
 
         stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "reclaimed-leases"));
+                                             StatsMgr::generateName("pool", pool->getID(),
+                                                                    "reclaimed-declined-addresses")));
 
         stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "cumulative-registered-nas"));
+                                             StatsMgr::generateName("pool", pool->getID(),
+                                                                    "reclaimed-leases")));
+    }
 
+    for (auto const& pool : subnet6->getPools(Lease::TYPE_PD)) {
         stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "registered-nas"));
+                                             StatsMgr::generateName("pd-pool", pool->getID(),
+                                                                    "total-pds")));
 
-        for (auto const& pool : subnet6->getPools(Lease::TYPE_NA)) {
-            stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                                 StatsMgr::generateName("pool", pool->getID(),
-                                                                        "total-nas")));
+        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                             StatsMgr::generateName("pd-pool", pool->getID(),
+                                                                    "assigned-pds")));
 
-            stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                                 StatsMgr::generateName("pool", pool->getID(),
-                                                                        "assigned-nas")));
+        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                             StatsMgr::generateName("pd-pool", pool->getID(),
+                                                                    "cumulative-assigned-pds")));
 
-            stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                                 StatsMgr::generateName("pool", pool->getID(),
-                                                                        "cumulative-assigned-nas")));
+        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                             StatsMgr::generateName("pd-pool", pool->getID(),
+                                                                    "reclaimed-leases")));
+    }
+}
 
-            stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                                 StatsMgr::generateName("pool", pool->getID(),
-                                                                        "declined-addresses")));
+void
+CfgSubnets6::updateStatistics() {
+    // For each v6 subnet currently configured, calculate totals.
+    for (auto const& subnet6 : subnets_) {
+        updateSubnetStatistics(subnet6);
+    }
 
-            stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                                 StatsMgr::generateName("pool", pool->getID(),
-                                                                        "reclaimed-declined-addresses")));
+    // Only recount the stats if we have subnets.
+    if (subnets_.begin() != subnets_.end()) {
+        LeaseMgrFactory::instance().recountLeaseStats6();
+    }
+}
 
-            stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                                 StatsMgr::generateName("pool", pool->getID(),
-                                                                        "reclaimed-leases")));
+void
+CfgSubnets6::updateStatistics(const SubnetIDSet& subnet_ids) {
+    auto const& index = subnets_.get<SubnetSubnetIdIndexTag>();
+    SubnetIDSet updated;
+    for (auto const& subnet_id : subnet_ids) {
+        auto subnet_it = index.find(subnet_id);
+        if (subnet_it != index.end()) {
+            updateSubnetStatistics(*subnet_it);
+            updated.insert(subnet_id);
         }
+    }
 
-        for (auto const& pool : subnet6->getPools(Lease::TYPE_PD)) {
-            stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                                 StatsMgr::generateName("pd-pool", pool->getID(),
-                                                                        "total-pds")));
-
-            stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                                 StatsMgr::generateName("pd-pool", pool->getID(),
-                                                                        "assigned-pds")));
-
-            stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                                 StatsMgr::generateName("pd-pool", pool->getID(),
-                                                                        "cumulative-assigned-pds")));
-
-            stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                                 StatsMgr::generateName("pd-pool", pool->getID(),
-                                                                        "reclaimed-leases")));
-        }
+    // Only recount the stats of the updated subnets.
+    if (!updated.empty()) {
+        LeaseMgrFactory::instance().recountLeaseStats6(updated);
     }
 }
 
 void
-CfgSubnets6::updateStatistics() {
+CfgSubnets6::updateSubnetStatistics(const ConstSubnet6Ptr& subnet6) {
     using namespace isc::stats;
 
     StatsMgr& stats_mgr = StatsMgr::instance();
-    // For each v6 subnet currently configured, calculate totals
-    for (auto const& subnet6 : subnets_) {
-        SubnetID subnet_id = subnet6->getID();
-
-        stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
-                                                  "total-nas"),
-                           subnet6->getPoolCapacity(Lease::TYPE_NA));
+    SubnetID subnet_id = subnet6->getID();
 
-        stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
-                                                  "total-pds"),
-                           subnet6->getPoolCapacity(Lease::TYPE_PD));
+    stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                              "total-nas"),
+                       subnet6->getPoolCapacity(Lease::TYPE_NA));
 
-        const std::string& name_nas(StatsMgr::generateName("subnet", subnet_id,
-                                                           "cumulative-assigned-nas"));
-        if (!stats_mgr.getObservation(name_nas)) {
-            stats_mgr.setValue(name_nas, static_cast<int64_t>(0));
-        }
+    stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                              "total-pds"),
+                       subnet6->getPoolCapacity(Lease::TYPE_PD));
 
-        const std::string& name_pds(StatsMgr::generateName("subnet", subnet_id,
-                                                           "cumulative-assigned-pds"));
-        if (!stats_mgr.getObservation(name_pds)) {
-            stats_mgr.setValue(name_pds, static_cast<int64_t>(0));
-        }
+    const std::string& name_nas(StatsMgr::generateName("subnet", subnet_id,
+                                                       "cumulative-assigned-nas"));
+    if (!stats_mgr.getObservation(name_nas)) {
+        stats_mgr.setValue(name_nas, static_cast<int64_t>(0));
+    }
 
-        string const& name_ia_na_reuses(StatsMgr::generateName("subnet", subnet_id,
-                                                               "v6-ia-na-lease-reuses"));
-        if (!stats_mgr.getObservation(name_ia_na_reuses)) {
-            stats_mgr.setValue(name_ia_na_reuses, int64_t(0));
-        }
+    const std::string& name_pds(StatsMgr::generateName("subnet", subnet_id,
+                                                       "cumulative-assigned-pds"));
+    if (!stats_mgr.getObservation(name_pds)) {
+        stats_mgr.setValue(name_pds, static_cast<int64_t>(0));
+    }
 
-        string const& name_ia_pd_reuses(StatsMgr::generateName("subnet", subnet_id,
-                                                               "v6-ia-pd-lease-reuses"));
-        if (!stats_mgr.getObservation(name_ia_pd_reuses)) {
-            stats_mgr.setValue(name_ia_pd_reuses, int64_t(0));
-        }
+    string const& name_ia_na_reuses(StatsMgr::generateName("subnet", subnet_id,
+                                                           "v6-ia-na-lease-reuses"));
+    if (!stats_mgr.getObservation(name_ia_na_reuses)) {
+        stats_mgr.setValue(name_ia_na_reuses, int64_t(0));
+    }
 
-        string const& name_registered(StatsMgr::generateName("subnet", subnet_id,
-                                                             "cumulative-registered-nas"));
+    string const& name_ia_pd_reuses(StatsMgr::generateName("subnet", subnet_id,
+                                                           "v6-ia-pd-lease-reuses"));
+    if (!stats_mgr.getObservation(name_ia_pd_reuses)) {
+        stats_mgr.setValue(name_ia_pd_reuses, int64_t(0));
+    }
 
-        if (!stats_mgr.getObservation(name_registered)) {
-            stats_mgr.setValue(name_registered, static_cast<int64_t>(0));
-        }
+    string const& name_registered(StatsMgr::generateName("subnet", subnet_id,
+                                                         "cumulative-registered-nas"));
 
-        for (auto const& pool : subnet6->getPools(Lease::TYPE_NA)) {
-            const std::string& name_total_nas(StatsMgr::generateName("subnet", subnet_id,
-                                                                     StatsMgr::generateName("pool", pool->getID(),
-                                                                                            "total-nas")));
-            if (!stats_mgr.getObservation(name_total_nas)) {
-                stats_mgr.setValue(name_total_nas, pool->getCapacity());
-            } else {
-                stats_mgr.addValue(name_total_nas, pool->getCapacity());
-            }
+    if (!stats_mgr.getObservation(name_registered)) {
+        stats_mgr.setValue(name_registered, static_cast<int64_t>(0));
+    }
 
-            const std::string& name_ca_nas(StatsMgr::generateName("subnet", subnet_id,
-                                                                  StatsMgr::generateName("pool", pool->getID(),
-                                                                                         "cumulative-assigned-nas")));
-            if (!stats_mgr.getObservation(name_ca_nas)) {
-                stats_mgr.setValue(name_ca_nas, static_cast<int64_t>(0));
-            }
+    for (auto const& pool : subnet6->getPools(Lease::TYPE_NA)) {
+        const std::string& name_total_nas(StatsMgr::generateName("subnet", subnet_id,
+                                                                 StatsMgr::generateName("pool", pool->getID(),
+                                                                                        "total-nas")));
+        if (!stats_mgr.getObservation(name_total_nas)) {
+            stats_mgr.setValue(name_total_nas, pool->getCapacity());
+        } else {
+            stats_mgr.addValue(name_total_nas, pool->getCapacity());
         }
 
-        for (auto const& pool : subnet6->getPools(Lease::TYPE_PD)) {
-            const std::string& name_total_pds(StatsMgr::generateName("subnet", subnet_id,
-                                                                     StatsMgr::generateName("pd-pool", pool->getID(),
-                                                                                            "total-pds")));
-            if (!stats_mgr.getObservation(name_total_pds)) {
-                stats_mgr.setValue(name_total_pds, pool->getCapacity());
-            } else {
-                stats_mgr.addValue(name_total_pds, pool->getCapacity());
-            }
-
-            const std::string& name_ca_pds(StatsMgr::generateName("subnet", subnet_id,
-                                                                  StatsMgr::generateName("pd-pool", pool->getID(),
-                                                                                         "cumulative-assigned-pds")));
-            if (!stats_mgr.getObservation(name_ca_pds)) {
-                stats_mgr.setValue(name_ca_pds, static_cast<int64_t>(0));
-            }
+        const std::string& name_ca_nas(StatsMgr::generateName("subnet", subnet_id,
+                                                              StatsMgr::generateName("pool", pool->getID(),
+                                                                                     "cumulative-assigned-nas")));
+        if (!stats_mgr.getObservation(name_ca_nas)) {
+            stats_mgr.setValue(name_ca_nas, static_cast<int64_t>(0));
         }
     }
 
-    // Only recount the stats if we have subnets.
-    if (subnets_.begin() != subnets_.end()) {
-        LeaseMgrFactory::instance().recountLeaseStats6();
+    for (auto const& pool : subnet6->getPools(Lease::TYPE_PD)) {
+        const std::string& name_total_pds(StatsMgr::generateName("subnet", subnet_id,
+                                                                 StatsMgr::generateName("pd-pool", pool->getID(),
+                                                                                        "total-pds")));
+        if (!stats_mgr.getObservation(name_total_pds)) {
+            stats_mgr.setValue(name_total_pds, pool->getCapacity());
+        } else {
+            stats_mgr.addValue(name_total_pds, pool->getCapacity());
+        }
+
+        const std::string& name_ca_pds(StatsMgr::generateName("subnet", subnet_id,
+                                                              StatsMgr::generateName("pd-pool", pool->getID(),
+                                                                                     "cumulative-assigned-pds")));
+        if (!stats_mgr.getObservation(name_ca_pds)) {
+            stats_mgr.setValue(name_ca_pds, static_cast<int64_t>(0));
+        }
     }
 }
 
@@ -581,9 +639,41 @@ CfgSubnets6::initAllocatorsAfterConfigure() {
     }
 }
 
+size_t
+CfgSubnets6::carryOverAllocationStates(const CfgSubnets6& previous) {
+    size_t count = 0;
+    auto const& index = previous.subnets_.get<SubnetSubnetIdIndexTag>();
+    for (auto const& subnet : subnets_) {
+        auto prev = index.find(subnet->getID());
+        if ((prev != index.end()) &&
+            subnet->carryOverAllocationStates(**prev)) {
+            ++count;
+        }
+    }
+    if (count > 0) {
+        LOG_INFO(dhcpsrv_logger, DHCPSRV_CFGMGR_ALLOCATION_STATES_CARRIED_OVER)
+            .arg(count);
+    }
+    return (count);
+}
+
+size_t
+CfgSubnets6::keepStatistics(const CfgSubnets6& previous) {
+    kept_statistics_.clear();
+    auto const& index = previous.subnets_.get<SubnetSubnetIdIndexTag>();
+    for (auto const& subnet : subnets_) {
+        auto prev = index.find(subnet->getID());
+        if ((prev != index.end()) && subnet->samePools(**prev)) {
+            kept_statistics_.insert(subnet->getID());
+        }
+    }
+    return (kept_statistics_.size());
+}
+
 void
 CfgSubnets6::clear() {
     subnets_.clear();
+    kept_statistics_.clear();
 }
 
 ElementPtr
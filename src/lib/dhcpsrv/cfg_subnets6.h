@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2024 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -276,9 +276,69 @@ public:
     /// configuration and also subnet-ids may change.
     void removeStatistics();
 
+    /// @brief Updates statistics of some subnets.
+    ///
+    /// Same as @c updateStatistics but only for the given subnets, e.g.
+    /// the subnets added or replaced by a configuration backend update.
+    /// The lease statistics of these subnets are recounted: the global
+    /// and other subnets statistics are left unchanged.
+    ///
+    /// @param subnet_ids identifiers of the subnets (unknown identifiers
+    /// are ignored).
+    void updateStatistics(const SubnetIDSet& subnet_ids);
+
+    /// @brief Removes statistics of some subnets.
+    ///
+    /// Same as @c removeStatistics but only for the given subnets.
+    ///
+    /// @param subnet_ids identifiers of the subnets (unknown identifiers
+    /// are ignored).
+    void removeStatistics(const SubnetIDSet& subnet_ids);
+
+    /// @brief Returns the subnets which would be replaced by a merge.
+    ///
+    /// Returns the identifiers of the subnets which @c merge with the
+    /// given subnets would replace, i.e. the subnets with the same
+    /// identifier or the same prefix as one of the other subnets.
+    ///
+    /// @param other the subnets to be merged.
+    /// @return the identifiers of the replaced subnets.
+    SubnetIDSet getReplacedSubnetIds(const CfgSubnets6& other) const;
+
     /// @brief Calls @c initAllocatorsAfterConfigure for each subnet.
     void initAllocatorsAfterConfigure();
 
+    /// @brief Carries over allocation states from the previous configuration.
+    ///
+    /// Calls @c Subnet::carryOverAllocationStates for each subnet which
+    /// exists with the same identifier in the previous configuration, so
+    /// the subnets which pools and allocators did not change keep their
+    /// allocation states (and e.g. do not populate their free lease queues
+    /// again) after a reconfiguration.
+    ///
+    /// @param previous the subnets of the previous configuration.
+    /// @return the number of subnets with carried over allocation states.
+    size_t carryOverAllocationStates(const CfgSubnets6& previous);
+
+    /// @brief Keeps the statistics of the unchanged subnets.
+    ///
+    /// Records the subnets which have the same pools as in the previous
+    /// configuration (see @c Subnet::samePools). When the lease database
+    /// did not change either, the statistics of these subnets remain
+    /// valid so they are neither removed nor recounted when this
+    /// configuration is committed.
+    ///
+    /// @param previous the subnets of the previous configuration.
+    /// @return the number of subnets with kept statistics.
+    size_t keepStatistics(const CfgSubnets6& previous);
+
+    /// @brief Returns the identifiers of the subnets with kept statistics.
+    ///
+    /// @return the identifiers recorded by @c keepStatistics.
+    const SubnetIDSet& getKeptStatistics() const {
+        return (kept_statistics_);
+    }
+
     /// @brief Clears all subnets from the configuration.
     void clear();
 
@@ -289,6 +349,16 @@ public:
 
 private:
 
+    /// @brief Removes statistics of a subnet.
+    ///
+    /// @param subnet the subnet.
+    static void removeSubnetStatistics(const ConstSubnet6Ptr& subnet);
+
+    /// @brief Updates statistics of a subnet which do not depend on leases.
+    ///
+    /// @param subnet the subnet.
+    static void updateSubnetStatistics(const ConstSubnet6Ptr& subnet);
+
     /// @brief Selects a subnet using the interface name.
     ///
     /// This method searches for the subnet using the name of the interface.
@@ -340,6 +410,9 @@ private:
     /// @brief A container for IPv6 subnets.
     Subnet6Collection subnets_;
 
+    /// @brief Identifiers of the subnets with kept statistics.
+    SubnetIDSet kept_statistics_;
+
 };
 
 /// @name Pointer to the @c CfgSubnets6 objects.
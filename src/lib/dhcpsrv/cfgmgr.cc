@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2025 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -93,13 +93,18 @@ void
 CfgMgr::commit() {
     // First we need to remove statistics. The new configuration can have fewer
     // subnets. Also, it may change subnet-ids. So we need to remove them all
-    // and add them back.
-    configuration_->removeStatistics();
+    // and add them back, but the ones of the subnets the new configuration
+    // keeps unchanged.
+    bool promote = (staging_configuration_ &&
+                    !configuration_->sequenceEquals(*staging_configuration_));
+    if (promote) {
+        configuration_->removeUnkeptStatistics(*staging_configuration_);
 
-    if (staging_configuration_ && !configuration_->sequenceEquals(*staging_configuration_)) {
         // Promote the staging configuration to the current configuration.
         configuration_ = staging_configuration_;
         staging_configuration_.reset();
+    } else {
+        configuration_->removeStatistics();
     }
 
     // Set the last commit timestamp.
@@ -107,7 +112,11 @@ CfgMgr::commit() {
     configuration_->setLastCommitTime(now);
 
     // Now we need to set the statistics back.
-    configuration_->updateStatistics();
+    if (promote) {
+        configuration_->updateUnkeptStatistics();
+    } else {
+        configuration_->updateStatistics();
+    }
 
     configuration_->configureLowerLevelLibraries();
 }
@@ -146,9 +155,19 @@ CfgMgr::mergeIntoStagingCfg(const uint32_t seq) {
 
 void
 CfgMgr::mergeIntoCurrentCfg(const uint32_t seq) {
+    // Keep the source configuration as it is discarded by the merge.
+    SrvConfigPtr source_config;
+    auto source = external_configs_.find(seq);
+    if (source != external_configs_.end()) {
+        source_config = source->second;
+    }
     try {
-        // First we need to remove statistics.
-        getCurrentCfg()->removeStatistics();
+        // First we need to remove statistics of the subnets which will
+        // be replaced. The statistics of the other subnets are unchanged
+        // so they are not recounted.
+        if (source_config) {
+            getCurrentCfg()->removeStatistics(*source_config);
+        }
         mergeIntoCfg(getCurrentCfg(), seq);
         LibDHCP::setRuntimeOptionDefs(getCurrentCfg()->getCfgOptionDef()->getContainer());
 
@@ -157,7 +176,7 @@ CfgMgr::mergeIntoCurrentCfg(const uint32_t seq) {
         getCurrentCfg()->updateStatistics();
         throw;
     }
-    getCurrentCfg()->updateStatistics();
+    getCurrentCfg()->updateStatistics(*source_config);
 }
 
 void
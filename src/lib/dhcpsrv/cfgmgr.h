@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2025 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -229,6 +229,10 @@ public:
     /// After the merge, the source configuration is discarded from the
     /// @c CfgMgr as it should not be used anymore.
     ///
+    /// Only the statistics of the subnets added or replaced by the merge
+    /// are updated, so merging a few subnets does not recount the leases
+    /// of all subnets.
+    ///
     /// @param seq Source configuration sequence number.
     ///
     /// @throw BadValue if the external configuration with the given sequence
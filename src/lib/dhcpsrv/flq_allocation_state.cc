@@ -1,4 +1,4 @@
-// Copyright (C) 2023-2025 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2023-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -19,7 +19,8 @@ PoolFreeLeaseQueueAllocationState::create(const PoolPtr& pool) {
 }
 
 PoolFreeLeaseQueueAllocationState::PoolFreeLeaseQueueAllocationState(Lease::Type type)
-    : AllocationState(), free_lease4_queue_(), free_lease6_queue_() {
+    : AllocationState(), free_lease4_queue_(), free_lease6_queue_(),
+      populated_(false) {
     if (type == Lease::TYPE_V4) {
         free_lease4_queue_ = boost::make_shared<FreeLeaseQueue<uint32_t>>();
     } else {
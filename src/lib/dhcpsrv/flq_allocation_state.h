@@ -1,4 +1,4 @@
-// Copyright (C) 2023-2025 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2023-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -71,6 +71,22 @@ public:
     /// @return the number of free leases in the queue.
     size_t getFreeLeaseCount() const;
 
+    /// @brief Checks if the queue was populated from the lease database.
+    ///
+    /// A populated state carried over from the previous configuration
+    /// (see @c Subnet::carryOverAllocationStates) is kept up to date by
+    /// the allocator callbacks so it does not need to be populated again.
+    ///
+    /// @return true if the queue was populated, false otherwise.
+    bool isPopulated() const {
+        return (populated_);
+    }
+
+    /// @brief Marks the queue as populated from the lease database.
+    void setPopulated() {
+        populated_ = true;
+    }
+
 private:
 
     /// @brief A multi-index container holding free leases.
@@ -104,6 +120,9 @@ private:
     /// @brief An instance of the multi-index container holding
     /// free IPv6 leases.
     FreeLease6QueuePtr free_lease6_queue_;
+
+    /// @brief Indicates if the queue was populated.
+    bool populated_;
 };
 
 
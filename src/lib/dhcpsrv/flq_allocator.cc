@@ -252,28 +252,38 @@ FreeLeaseQueueAllocator::getOccupancyRateInternal(const IOAddress& pref,
 void
 FreeLeaseQueueAllocator::initAfterConfigureInternal() {
     auto subnet = subnet_.lock();
-    auto const& pools = subnet->getPools(pool_type_);
-    if (pools.empty()) {
+    auto const& all_pools = subnet->getPools(pool_type_);
+    if (all_pools.empty()) {
         // If there are no pools there is nothing to do.
         return;
     }
-    Lease4Collection leases4;
-    Lease6Collection leases6;
-    switch (pool_type_) {
-    case Lease::TYPE_V4:
-        leases4 = LeaseMgrFactory::instance().getLeases4(subnet->getID());
-        populateFreeAddressLeases(leases4, pools);
-        break;
-    case Lease::TYPE_NA:
-        leases6 = LeaseMgrFactory::instance().getLeases6(subnet->getID());
-        populateFreeAddressLeases(leases6, pools);
-        break;
-    case Lease::TYPE_PD:
-        leases6 = LeaseMgrFactory::instance().getLeases6(subnet->getID());
-        populateFreePrefixDelegationLeases(leases6, pools);
-        break;
-    default:
-        ;
+    // Skip the pools which states were carried over from the previous
+    // configuration: they are already populated and up to date.
+    PoolCollection pools;
+    for (auto const& pool : all_pools) {
+        if (!getPoolState(pool)->isPopulated()) {
+            pools.push_back(pool);
+        }
+    }
+    if (!pools.empty()) {
+        Lease4Collection leases4;
+        Lease6Collection leases6;
+        switch (pool_type_) {
+        case Lease::TYPE_V4:
+            leases4 = LeaseMgrFactory::instance().getLeases4(subnet->getID());
+            populateFreeAddressLeases(leases4, pools);
+            break;
+        case Lease::TYPE_NA:
+            leases6 = LeaseMgrFactory::instance().getLeases6(subnet->getID());
+            populateFreeAddressLeases(leases6, pools);
+            break;
+        case Lease::TYPE_PD:
+            leases6 = LeaseMgrFactory::instance().getLeases6(subnet->getID());
+            populateFreePrefixDelegationLeases(leases6, pools);
+            break;
+        default:
+            ;
+        }
     }
     // Install the callbacks for lease add, update and delete in the interface manager.
     // These callbacks will ensure that we have up-to-date free lease queue.
@@ -326,6 +336,7 @@ FreeLeaseQueueAllocator::populateFreeAddressLeases(const LeaseCollectionType& le
                 pool_state->addFreeLease(address);
             }
         }
+        pool_state->setPopulated();
         free_lease_count += pool_state->getFreeLeaseCount();
     }
 
@@ -379,6 +390,7 @@ FreeLeaseQueueAllocator::populateFreePrefixDelegationLeases(const Lease6Collecti
                 pool_state->addFreeLease(prefix);
             }
         }
+        pool_state->setPopulated();
         free_lease_count += pool_state->getFreeLeaseCount();
     }
 
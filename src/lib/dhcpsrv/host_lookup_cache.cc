@@ -0,0 +1,318 @@
+// Copyright (C) 2026 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcpsrv/host_lookup_cache.h>
+#include <exceptions/exceptions.h>
+#include <stats/stats_mgr.h>
+#include <util/multi_threading_mgr.h>
+
+#include <boost/functional/hash.hpp>
+#include <boost/make_shared.hpp>
+
+using namespace isc::asiolink;
+using namespace isc::stats;
+using namespace isc::util;
+using namespace std;
+
+namespace {
+
+/// @brief Index of the hits statistic.
+const size_t STAT_HITS = 0;
+
+/// @brief Index of the misses statistic.
+const size_t STAT_MISSES = 1;
+
+/// @brief Index of the evictions statistic.
+const size_t STAT_EVICTIONS = 2;
+
+/// @brief Statistic kinds.
+const char* STAT_KINDS[] = { "hits", "misses", "evictions" };
+
+} // end of anonymous namespace
+
+namespace isc {
+namespace dhcp {
+
+HostLookupKey::HostLookupKey(const SubnetID& subnet_id, bool v6,
+                             const Host::IdentifierType& identifier_type,
+                             const uint8_t* identifier_begin,
+                             const size_t identifier_len)
+    : subnet_id_(subnet_id), v6_(v6), identifier_type_(identifier_type),
+      identifier_(identifier_begin, identifier_begin + identifier_len),
+      hash_(0) {
+    boost::hash_combine(hash_, static_cast<uint32_t>(subnet_id_));
+    boost::hash_combine(hash_, v6_);
+    boost::hash_combine(hash_, static_cast<uint16_t>(identifier_type_));
+    boost::hash_range(hash_, identifier_.begin(), identifier_.end());
+}
+
+HostLookupCache::Stripe::Stripe() : generation_(0) {
+    for (size_t kind = 0; kind < STAT_KIND_COUNT; ++kind) {
+        for (auto& counter : counters_[kind]) {
+            counter.store(0);
+        }
+    }
+}
+
+HostLookupCache::HostLookupCache(size_t capacity, uint32_t ttl,
+                                 uint32_t negative_ttl, bool admission,
+                                 size_t stripes)
+    : capacity_(capacity), stripe_capacity_(0), ttl_(ttl),
+      negative_ttl_(negative_ttl), admission_(admission) {
+    if (capacity_ == 0) {
+        isc_throw(BadValue, "host lookup cache capacity must be positive");
+    }
+    // Use a power of two number of stripes, each holding at least
+    // one entry.
+    size_t count = 1;
+    while ((count < stripes) && (count * 2 <= capacity_)) {
+        count *= 2;
+    }
+    stripe_capacity_ = (capacity_ + count - 1) / count;
+    for (size_t i = 0; i < count; ++i) {
+        stripes_.push_back(boost::make_shared<Stripe>());
+    }
+    for (size_t kind = STAT_HITS; kind <= STAT_EVICTIONS; ++kind) {
+        vector<string> names;
+        for (uint16_t type = 0; type <= Host::LAST_IDENTIFIER_TYPE; ++type) {
+            names.push_back(statName(STAT_KINDS[kind],
+                                     static_cast<Host::IdentifierType>(type)));
+        }
+        stat_names_.push_back(names);
+    }
+}
+
+HostLookupCache::~HostLookupCache() {
+}
+
+string
+HostLookupCache::statName(const string& kind,
+                          const Host::IdentifierType& identifier_type) {
+    return ("host-lookup-cache-" + kind + "-" +
+            Host::getIdentifierName(identifier_type));
+}
+
+void
+HostLookupCache::bump(Stripe& stripe, size_t kind,
+                      const Host::IdentifierType& identifier_type) {
+    if (identifier_type > Host::LAST_IDENTIFIER_TYPE) {
+        return;
+    }
+    stripe.counters_[kind][identifier_type].fetch_add(1, memory_order_relaxed);
+}
+
+void
+HostLookupCache::publishStatistics() {
+    for (size_t kind = STAT_HITS; kind <= STAT_EVICTIONS; ++kind) {
+        for (uint16_t type = 0; type <= Host::LAST_IDENTIFIER_TYPE; ++type) {
+            int64_t value = 0;
+            for (auto const& stripe : stripes_) {
+                value += stripe->counters_[kind][type].exchange(0,
+                    memory_order_relaxed);
+            }
+            if (value != 0) {
+                StatsMgr::instance().addValue(stat_names_[kind][type], value);
+            }
+        }
+    }
+}
+
+bool
+HostLookupCache::get(const HostLookupKey& key, ConstHostPtr& host) {
+    uint64_t generation;
+    return (get(key, host, generation));
+}
+
+bool
+HostLookupCache::get(const HostLookupKey& key, ConstHostPtr& host,
+                     uint64_t& generation) {
+    Stripe& stripe = getStripe(key);
+    MultiThreadingLock lock(stripe.mutex_);
+    bool hit = getInternal(stripe, key, host);
+    generation = stripe.generation_;
+    bump(stripe, hit ? STAT_HITS : STAT_MISSES, key.identifier_type_);
+    return (hit);
+}
+
+bool
+HostLookupCache::getInternal(Stripe& stripe, const HostLookupKey& key,
+                             ConstHostPtr& host) {
+    auto& idx = stripe.entries_.get<KeyIndexTag>();
+    auto it = idx.find(key);
+    if (it == idx.end()) {
+        return (false);
+    }
+    if (it->expire_ <= now()) {
+        idx.erase(it);
+        return (false);
+    }
+    // Move to the most recently used end.
+    auto& lru = stripe.entries_.get<LruIndexTag>();
+    lru.relocate(lru.end(), stripe.entries_.project<LruIndexTag>(it));
+    host = it->host_;
+    return (true);
+}
+
+void
+HostLookupCache::insert(const HostLookupKey& key, const ConstHostPtr& host) {
+    Stripe& stripe = getStripe(key);
+    MultiThreadingLock lock(stripe.mutex_);
+    insertInternal(stripe, key, host);
+}
+
+bool
+HostLookupCache::insert(const HostLookupKey& key, const ConstHostPtr& host,
+                        uint64_t generation) {
+    Stripe& stripe = getStripe(key);
+    MultiThreadingLock lock(stripe.mutex_);
+    if (stripe.generation_ != generation) {
+        // The answer may predate a concurrent add, update or delete.
+        return (false);
+    }
+    insertInternal(stripe, key, host);
+    return (true);
+}
+
+void
+HostLookupCache::insertInternal(Stripe& stripe, const HostLookupKey& key,
+                                const ConstHostPtr& host) {
+    auto& idx = stripe.entries_.get<KeyIndexTag>();
+    auto it = idx.find(key);
+    uint32_t ttl = (host ? ttl_ : negative_ttl_);
+    if (!host && (ttl == 0)) {
+        // Negative answers are not cached: only forget a stale one.
+        if (it != idx.end()) {
+            idx.erase(it);
+        }
+        return;
+    }
+    TimePoint expire = TimePoint::max();
+    if (ttl > 0) {
+        expire = now() + chrono::seconds(ttl);
+    }
+    if (it != idx.end()) {
+        idx.replace(it, Entry(key, host, expire));
+        auto& lru = stripe.entries_.get<LruIndexTag>();
+        lru.relocate(lru.end(), stripe.entries_.project<LruIndexTag>(it));
+        return;
+    }
+    if (admission_) {
+        if (stripe.doorkeeper_.insert(key.hash_).second) {
+            // First miss: remember the key but do not admit it yet.
+            if (stripe.doorkeeper_.size() > stripe_capacity_) {
+                stripe.doorkeeper_.clear();
+            }
+            return;
+        }
+        stripe.doorkeeper_.erase(key.hash_);
+    }
+    auto& lru = stripe.entries_.get<LruIndexTag>();
+    lru.push_back(Entry(key, host, expire));
+    while (lru.size() > stripe_capacity_) {
+        Host::IdentifierType evicted = lru.front().key_.identifier_type_;
+        lru.pop_front();
+        bump(stripe, STAT_EVICTIONS, evicted);
+    }
+}
+
+void
+HostLookupCache::invalidate(const HostLookupKey& key) {
+    Stripe& stripe = getStripe(key);
+    MultiThreadingLock lock(stripe.mutex_);
+    invalidateInternal(stripe, key);
+}
+
+void
+HostLookupCache::invalidateInternal(Stripe& stripe, const HostLookupKey& key) {
+    ++stripe.generation_;
+    stripe.entries_.get<KeyIndexTag>().erase(key);
+}
+
+void
+HostLookupCache::invalidate(const ConstHostPtr& host) {
+    if (!host) {
+        return;
+    }
+    const vector<uint8_t>& id = host->getIdentifier();
+    const uint8_t* id_begin = (id.empty() ? 0 : &id[0]);
+    invalidate(HostLookupKey(host->getIPv4SubnetID(), false,
+                             host->getIdentifierType(), id_begin, id.size()));
+    invalidate(HostLookupKey(host->getIPv6SubnetID(), true,
+                             host->getIdentifierType(), id_begin, id.size()));
+}
+
+void
+HostLookupCache::invalidate(const SubnetID& subnet_id,
+                            const IOAddress& address) {
+    vector<ConstHostPtr> hosts;
+    for (auto const& stripe : stripes_) {
+        MultiThreadingLock lock(stripe->mutex_);
+        invalidateInternal(*stripe, subnet_id, address, hosts);
+    }
+    // The host is gone: forget its entries for the other family too.
+    for (auto const& host : hosts) {
+        invalidate(host);
+    }
+}
+
+void
+HostLookupCache::invalidateInternal(Stripe& stripe, const SubnetID& subnet_id,
+                                    const IOAddress& address,
+                                    vector<ConstHostPtr>& hosts) {
+    // An in-flight lookup may return the host being deleted whatever
+    // its key is.
+    ++stripe.generation_;
+    auto& lru = stripe.entries_.get<LruIndexTag>();
+    for (auto it = lru.begin(); it != lru.end(); ) {
+        const ConstHostPtr& host = it->host_;
+        bool match = false;
+        if (host && (it->key_.subnet_id_ == subnet_id) &&
+            (it->key_.v6_ == address.isV6())) {
+            if (address.isV4()) {
+                match = (host->getIPv4Reservation() == address);
+            } else {
+                const IPv6ResrvRange& range = host->getIPv6Reservations();
+                for (auto r = range.first; r != range.second; ++r) {
+                    if (r->second.getPrefix() == address) {
+                        match = true;
+                        break;
+                    }
+                }
+            }
+        }
+        if (match) {
+            hosts.push_back(host);
+            it = lru.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void
+HostLookupCache::clear() {
+    for (auto const& stripe : stripes_) {
+        MultiThreadingLock lock(stripe->mutex_);
+        ++stripe->generation_;
+        stripe->entries_.clear();
+        stripe->doorkeeper_.clear();
+    }
+}
+
+size_t
+HostLookupCache::size() const {
+    size_t total = 0;
+    for (auto const& stripe : stripes_) {
+        MultiThreadingLock lock(stripe->mutex_);
+        total += stripe->entries_.size();
+    }
+    return (total);
+}
+
+} // end of namespace isc::dhcp
+} // end of namespace isc
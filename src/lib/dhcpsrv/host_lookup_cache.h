@@ -0,0 +1,388 @@
+// Copyright (C) 2026 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef HOST_LOOKUP_CACHE_H
+#define HOST_LOOKUP_CACHE_H
+
+#include <asiolink/io_address.h>
+#include <dhcpsrv/host.h>
+#include <dhcpsrv/subnet_id.h>
+
+#include <boost/multi_index_container.hpp>
+#include <boost/multi_index/hashed_index.hpp>
+#include <boost/multi_index/member.hpp>
+#include <boost/multi_index/sequenced_index.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Key of a host lookup cache entry.
+///
+/// A lookup by identifier is fully described by the subnet, the protocol
+/// family (i.e. which subnet identifier of the host is used) and the
+/// identifier itself.
+struct HostLookupKey {
+
+    /// @brief Constructor.
+    ///
+    /// @param subnet_id Subnet identifier.
+    /// @param v6 true for a lookup by IPv6 subnet, false for IPv4.
+    /// @param identifier_type Identifier type.
+    /// @param identifier_begin Pointer to a beginning of the identifier.
+    /// @param identifier_len Identifier length.
+    HostLookupKey(const SubnetID& subnet_id, bool v6,
+                  const Host::IdentifierType& identifier_type,
+                  const uint8_t* identifier_begin,
+                  const size_t identifier_len);
+
+    /// @brief Equality operator.
+    ///
+    /// @param other The other key.
+    /// @return true if both keys designate the same lookup.
+    bool operator==(const HostLookupKey& other) const {
+        return ((subnet_id_ == other.subnet_id_) && (v6_ == other.v6_) &&
+                (identifier_type_ == other.identifier_type_) &&
+                (identifier_ == other.identifier_));
+    }
+
+    /// @brief Subnet identifier.
+    SubnetID subnet_id_;
+
+    /// @brief IPv6 flag.
+    bool v6_;
+
+    /// @brief Identifier type.
+    Host::IdentifierType identifier_type_;
+
+    /// @brief Identifier value.
+    std::vector<uint8_t> identifier_;
+
+    /// @brief Precomputed hash value.
+    size_t hash_;
+};
+
+/// @brief Hash function for host lookup keys.
+///
+/// @param key The key to hash.
+/// @return the precomputed hash value.
+inline size_t hash_value(const HostLookupKey& key) {
+    return (key.hash_);
+}
+
+/// @brief Size-bounded, TTL-based cache of host lookup results.
+///
+/// This cache sits in front of the alternate host data sources (i.e. the
+/// database host backends) in the @c HostMgr and keeps the results of
+/// lookups by (subnet, identifier), including negative results. Contrary
+/// to the host cache hook library (which is a host data source itself)
+/// it does not hold a copy of the reservations: it only remembers what
+/// the backends answered for a given query.
+///
+/// The cache is split in a power of two number of stripes, each with its
+/// own mutex and its own least-recently-used ordering so concurrent lookups
+/// from packet processing threads rarely contend. Entries expire after
+/// a configurable time to live, which can be different for positive and
+/// negative answers. When admission control is enabled a key is admitted
+/// only at its second miss, so a scan of one-off clients does not evict
+/// the working set.
+///
+/// Each stripe also has a generation number which is incremented by every
+/// invalidation, so an answer obtained from the backends while a concurrent
+/// add, update or delete was invalidating the key is not inserted.
+///
+/// Hits, misses and evictions are counted per stripe and identifier type
+/// and published to the statistics manager by @c publishStatistics, e.g.
+/// "host-lookup-cache-hits-hw-address", so lookups never take the
+/// statistics manager mutex.
+class HostLookupCache : public boost::noncopyable {
+public:
+
+    /// @brief Type of clock used for expiration.
+    typedef std::chrono::steady_clock Clock;
+
+    /// @brief Type of time points.
+    typedef Clock::time_point TimePoint;
+
+    /// @brief Default number of stripes.
+    static const size_t DEFAULT_STRIPES = 16;
+
+    /// @brief Constructor.
+    ///
+    /// @param capacity Maximum number of entries (must be positive).
+    /// @param ttl Time to live of positive answers in seconds, 0 means
+    /// positive answers do not expire.
+    /// @param negative_ttl Time to live of negative answers in seconds,
+    /// 0 means negative answers are not cached.
+    /// @param admission When true a key is admitted only at its second miss.
+    /// @param stripes Number of stripes (rounded up to a power of two and
+    /// limited so each stripe holds at least one entry).
+    /// @throw BadValue if the capacity is 0.
+    HostLookupCache(size_t capacity, uint32_t ttl, uint32_t negative_ttl,
+                    bool admission = false, size_t stripes = DEFAULT_STRIPES);
+
+    /// @brief Destructor.
+    virtual ~HostLookupCache();
+
+    /// @brief Looks up a cached answer.
+    ///
+    /// @param key The lookup key.
+    /// @param[out] host The cached host, null for a negative answer.
+    /// @return true on hit (positive or negative), false on miss.
+    bool get(const HostLookupKey& key, ConstHostPtr& host);
+
+    /// @brief Looks up a cached answer and returns the stripe generation.
+    ///
+    /// The generation must be passed to @c insert when the answer of
+    /// the backends is available after a miss.
+    ///
+    /// @param key The lookup key.
+    /// @param[out] host The cached host, null for a negative answer.
+    /// @param[out] generation The generation of the stripe of the key.
+    /// @return true on hit (positive or negative), false on miss.
+    bool get(const HostLookupKey& key, ConstHostPtr& host,
+             uint64_t& generation);
+
+    /// @brief Inserts or replaces an answer.
+    ///
+    /// @param key The lookup key.
+    /// @param host The host returned by the backends, null for no host.
+    void insert(const HostLookupKey& key, const ConstHostPtr& host);
+
+    /// @brief Inserts or replaces an answer unless it may be stale.
+    ///
+    /// @param key The lookup key.
+    /// @param host The host returned by the backends, null for no host.
+    /// @param generation The generation returned by @c get before the
+    /// backends were queried.
+    /// @return false when the stripe was invalidated in the meantime so
+    /// the answer was not inserted, true otherwise.
+    bool insert(const HostLookupKey& key, const ConstHostPtr& host,
+                uint64_t generation);
+
+    /// @brief Removes the entry for a key.
+    ///
+    /// @param key The lookup key.
+    void invalidate(const HostLookupKey& key);
+
+    /// @brief Removes the entries related to a host.
+    ///
+    /// Entries for the IPv4 and IPv6 subnets of the host and its
+    /// identifier are removed whatever their answer is.
+    ///
+    /// @param host The host which was added, updated or deleted.
+    void invalidate(const ConstHostPtr& host);
+
+    /// @brief Removes the positive entries for a reserved address.
+    ///
+    /// @param subnet_id Subnet identifier.
+    /// @param address The reserved address (IPv4 or IPv6).
+    void invalidate(const SubnetID& subnet_id,
+                    const asiolink::IOAddress& address);
+
+    /// @brief Removes all entries.
+    void clear();
+
+    /// @brief Publishes the statistics.
+    ///
+    /// Adds the hits, misses and evictions counted since the previous
+    /// call to the statistics manager. It is expected to be called
+    /// periodically, e.g. by a timer, and before reading the statistics.
+    void publishStatistics();
+
+    /// @brief Returns the number of entries.
+    size_t size() const;
+
+    /// @brief Returns the maximum number of entries.
+    size_t getCapacity() const {
+        return (capacity_);
+    }
+
+    /// @brief Returns the time to live of positive answers.
+    uint32_t getTTL() const {
+        return (ttl_);
+    }
+
+    /// @brief Returns the time to live of negative answers.
+    uint32_t getNegativeTTL() const {
+        return (negative_ttl_);
+    }
+
+    /// @brief Returns the admission control flag.
+    bool getAdmission() const {
+        return (admission_);
+    }
+
+    /// @brief Returns the number of stripes.
+    size_t getStripes() const {
+        return (stripes_.size());
+    }
+
+    /// @brief Returns the name of a statistic.
+    ///
+    /// @param kind Kind of statistic: "hits", "misses" or "evictions".
+    /// @param identifier_type Identifier type.
+    /// @return "host-lookup-cache-<kind>-<identifier name>".
+    static std::string statName(const std::string& kind,
+                                const Host::IdentifierType& identifier_type);
+
+protected:
+
+    /// @brief Returns the current time.
+    ///
+    /// Virtual so unit tests can control expiration.
+    virtual TimePoint now() const {
+        return (Clock::now());
+    }
+
+private:
+
+    /// @brief A cache entry.
+    struct Entry {
+
+        /// @brief Constructor.
+        ///
+        /// @param key The lookup key.
+        /// @param host The answer.
+        /// @param expire Expiration time.
+        Entry(const HostLookupKey& key, const ConstHostPtr& host,
+              const TimePoint& expire)
+            : key_(key), host_(host), expire_(expire) {
+        }
+
+        /// @brief The lookup key.
+        HostLookupKey key_;
+
+        /// @brief The answer (null for negative).
+        ConstHostPtr host_;
+
+        /// @brief Expiration time.
+        TimePoint expire_;
+    };
+
+    /// @brief Tag for the sequenced (least-recently-used) index.
+    struct LruIndexTag { };
+
+    /// @brief Tag for the key index.
+    struct KeyIndexTag { };
+
+    /// @brief Container of entries of a stripe.
+    typedef boost::multi_index_container<
+        Entry,
+        boost::multi_index::indexed_by<
+            // Least recently used first.
+            boost::multi_index::sequenced<
+                boost::multi_index::tag<LruIndexTag>
+            >,
+            // Hashed by lookup key.
+            boost::multi_index::hashed_unique<
+                boost::multi_index::tag<KeyIndexTag>,
+                boost::multi_index::member<Entry, HostLookupKey, &Entry::key_>
+            >
+        >
+    > EntryContainer;
+
+    /// @brief Number of kinds of statistics.
+    static const size_t STAT_KIND_COUNT = 3;
+
+    /// @brief A stripe of the cache.
+    struct Stripe {
+
+        /// @brief Constructor.
+        Stripe();
+
+        /// @brief Protects the stripe.
+        std::mutex mutex_;
+
+        /// @brief Entries.
+        EntryContainer entries_;
+
+        /// @brief Hashes of keys which missed once (admission control).
+        std::unordered_set<size_t> doorkeeper_;
+
+        /// @brief Generation incremented by invalidations.
+        uint64_t generation_;
+
+        /// @brief Statistics not yet published indexed by kind and
+        /// identifier type.
+        std::atomic<int64_t> counters_[STAT_KIND_COUNT]
+                                      [Host::LAST_IDENTIFIER_TYPE + 1];
+    };
+
+    /// @brief Returns the stripe of a key.
+    ///
+    /// @param key The lookup key.
+    /// @return the stripe in charge of the key.
+    Stripe& getStripe(const HostLookupKey& key) {
+        return (*stripes_[key.hash_ & (stripes_.size() - 1)]);
+    }
+
+    /// @brief Looks up a cached answer (stripe locked).
+    bool getInternal(Stripe& stripe, const HostLookupKey& key,
+                     ConstHostPtr& host);
+
+    /// @brief Removes the entry for a key (stripe locked).
+    void invalidateInternal(Stripe& stripe, const HostLookupKey& key);
+
+    /// @brief Inserts or replaces an answer (stripe locked).
+    void insertInternal(Stripe& stripe, const HostLookupKey& key,
+                        const ConstHostPtr& host);
+
+    /// @brief Removes positive entries matching an address (stripe locked).
+    ///
+    /// @param stripe The stripe.
+    /// @param subnet_id Subnet identifier.
+    /// @param address The reserved address (IPv4 or IPv6).
+    /// @param[out] hosts The hosts of the removed entries.
+    void invalidateInternal(Stripe& stripe, const SubnetID& subnet_id,
+                            const asiolink::IOAddress& address,
+                            std::vector<ConstHostPtr>& hosts);
+
+    /// @brief Bumps a statistic.
+    ///
+    /// @param stripe The stripe.
+    /// @param kind Kind of statistic.
+    /// @param identifier_type Identifier type.
+    static void bump(Stripe& stripe, size_t kind,
+                     const Host::IdentifierType& identifier_type);
+
+    /// @brief Maximum number of entries.
+    size_t capacity_;
+
+    /// @brief Maximum number of entries per stripe.
+    size_t stripe_capacity_;
+
+    /// @brief Time to live of positive answers in seconds.
+    uint32_t ttl_;
+
+    /// @brief Time to live of negative answers in seconds.
+    uint32_t negative_ttl_;
+
+    /// @brief Admission control flag.
+    bool admission_;
+
+    /// @brief Stripes.
+    std::vector<boost::shared_ptr<Stripe>> stripes_;
+
+    /// @brief Statistic names indexed by kind and identifier type.
+    std::vector<std::vector<std::string>> stat_names_;
+};
+
+/// @brief Pointer to a host lookup cache.
+typedef boost::shared_ptr<HostLookupCache> HostLookupCachePtr;
+
+} // end of namespace isc::dhcp
+} // end of namespace isc
+
+#endif // HOST_LOOKUP_CACHE_H
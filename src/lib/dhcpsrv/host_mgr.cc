@@ -50,7 +50,15 @@ HostMgr::getHostMgrPtr() {
 
 void
 HostMgr::create() {
+    HostLookupCachePtr lookup_cache;
+    if (getHostMgrPtr()) {
+        lookup_cache = getHostMgrPtr()->lookup_cache_;
+    }
     getHostMgrPtr().reset(new HostMgr());
+    if (lookup_cache) {
+        lookup_cache->clear();
+        getHostMgrPtr()->lookup_cache_ = lookup_cache;
+    }
 }
 
 void
@@ -416,6 +424,14 @@ HostMgr::get4Any(const SubnetID& subnet_id,
         return (host);
     }
 
+    uint64_t generation = 0;
+    if (lookup_cache_ &&
+        lookup_cache_->get(HostLookupKey(subnet_id, false, identifier_type,
+                                         identifier_begin, identifier_len),
+                           host, generation)) {
+        return (host);
+    }
+
     LOG_DEBUG(hosts_logger, HOSTS_DBG_TRACE,
               HOSTS_MGR_ALTERNATE_GET4_SUBNET_ID_IDENTIFIER)
         .arg(subnet_id)
@@ -441,6 +457,8 @@ HostMgr::get4Any(const SubnetID& subnet_id,
             if (source != cache_ptr_) {
                 cache(host);
             }
+            cacheLookup(subnet_id, false, identifier_type, identifier_begin,
+                        identifier_len, host, generation);
             return (host);
         }
     }
@@ -449,6 +467,8 @@ HostMgr::get4Any(const SubnetID& subnet_id,
         .arg(subnet_id)
         .arg(Host::getIdentifierAsText(identifier_type, identifier_begin,
                                        identifier_len));
+    cacheLookup(subnet_id, false, identifier_type, identifier_begin,
+                identifier_len, ConstHostPtr(), generation);
     return (ConstHostPtr());
 }
 
@@ -487,6 +507,12 @@ HostMgr::get4(const SubnetID& subnet_id,
                 HostMgrOperationTarget::ALL_SOURCES);
 }
 
+ConstHostPtr
+HostMgr::get4(const SubnetID& subnet_id,
+              const HostIdentifierList& identifiers) const {
+    return (getFirst(false, subnet_id, identifiers));
+}
+
 ConstHostPtr
 HostMgr::get4(const SubnetID& subnet_id,
               const asiolink::IOAddress& address,
@@ -601,6 +627,14 @@ HostMgr::get6Any(const SubnetID& subnet_id,
         return (host);
     }
 
+    uint64_t generation = 0;
+    if (lookup_cache_ &&
+        lookup_cache_->get(HostLookupKey(subnet_id, true, identifier_type,
+                                         identifier_begin, identifier_len),
+                           host, generation)) {
+        return (host);
+    }
+
     LOG_DEBUG(hosts_logger, HOSTS_DBG_TRACE,
               HOSTS_MGR_ALTERNATE_GET6_SUBNET_ID_IDENTIFIER)
         .arg(subnet_id)
@@ -624,6 +658,9 @@ HostMgr::get6Any(const SubnetID& subnet_id,
                 if (source != cache_ptr_) {
                     cache(host);
                 }
+                cacheLookup(subnet_id, true, identifier_type,
+                            identifier_begin, identifier_len, host,
+                            generation);
                 return (host);
         }
     }
@@ -633,6 +670,8 @@ HostMgr::get6Any(const SubnetID& subnet_id,
         .arg(subnet_id)
         .arg(Host::getIdentifierAsText(identifier_type, identifier_begin,
                                        identifier_len));
+    cacheLookup(subnet_id, true, identifier_type, identifier_begin,
+                identifier_len, ConstHostPtr(), generation);
 
     return (ConstHostPtr());
 }
@@ -672,6 +711,12 @@ HostMgr::get6(const SubnetID& subnet_id,
                 HostMgrOperationTarget::ALL_SOURCES);
 }
 
+ConstHostPtr
+HostMgr::get6(const SubnetID& subnet_id,
+              const HostIdentifierList& identifiers) const {
+    return (getFirst(true, subnet_id, identifiers));
+}
+
 ConstHostPtr
 HostMgr::get6(const SubnetID& subnet_id,
               const asiolink::IOAddress& addr,
@@ -783,6 +828,11 @@ HostMgr::add(const HostPtr& host, const HostMgrOperationTarget target) {
     if (cache_ptr_) {
         cache(host);
     }
+
+    // Forget previous answers, in particular negative ones.
+    if (lookup_cache_) {
+        lookup_cache_->invalidate(host);
+    }
 }
 
 void
@@ -812,6 +862,10 @@ HostMgr::del(const SubnetID& subnet_id, const asiolink::IOAddress& addr,
         }
     }
 
+    if (lookup_cache_) {
+        lookup_cache_->invalidate(subnet_id, addr);
+    }
+
     return (erased);
 }
 
@@ -826,6 +880,14 @@ HostMgr::del4(const SubnetID& subnet_id, const Host::IdentifierType& identifier_
               const HostMgrOperationTarget target) {
     bool success = false;
 
+    // The backends delete the whole host: get it first so the lookup
+    // cache entries of both families can be invalidated.
+    ConstHostCollection deleted;
+    if (lookup_cache_) {
+        deleted = getDeletedHosts(false, subnet_id, identifier_type,
+                                  identifier_begin, identifier_len, target);
+    }
+
     if (target & HostMgrOperationTarget::PRIMARY_SOURCE) {
         if (getCfgHostsForEdit()->del4(subnet_id, identifier_type,
                                        identifier_begin, identifier_len)) {
@@ -847,6 +909,15 @@ HostMgr::del4(const SubnetID& subnet_id, const Host::IdentifierType& identifier_
             }
         }
     }
+
+    if (lookup_cache_) {
+        lookup_cache_->invalidate(HostLookupKey(subnet_id, false, identifier_type,
+                                                identifier_begin,
+                                                identifier_len));
+        for (auto const& host : deleted) {
+            lookup_cache_->invalidate(host);
+        }
+    }
     return (success);
 }
 
@@ -863,6 +934,14 @@ HostMgr::del6(const SubnetID& subnet_id, const Host::IdentifierType& identifier_
               const HostMgrOperationTarget target) {
     bool success = false;
 
+    // The backends delete the whole host: get it first so the lookup
+    // cache entries of both families can be invalidated.
+    ConstHostCollection deleted;
+    if (lookup_cache_) {
+        deleted = getDeletedHosts(true, subnet_id, identifier_type,
+                                  identifier_begin, identifier_len, target);
+    }
+
     if (target & HostMgrOperationTarget::PRIMARY_SOURCE) {
         if (getCfgHostsForEdit()->del6(subnet_id, identifier_type,
                                        identifier_begin, identifier_len)) {
@@ -884,6 +963,15 @@ HostMgr::del6(const SubnetID& subnet_id, const Host::IdentifierType& identifier_
             }
         }
     }
+
+    if (lookup_cache_) {
+        lookup_cache_->invalidate(HostLookupKey(subnet_id, true, identifier_type,
+                                                identifier_begin,
+                                                identifier_len));
+        for (auto const& host : deleted) {
+            lookup_cache_->invalidate(host);
+        }
+    }
     return (success);
 }
 
@@ -916,6 +1004,10 @@ HostMgr::update(HostPtr const& host, const HostMgrOperationTarget target) {
     if (cache_ptr_) {
         cache(host);
     }
+
+    if (lookup_cache_) {
+        lookup_cache_->invalidate(host);
+    }
 }
 
 void
@@ -954,6 +1046,177 @@ HostMgr::cacheNegative(const SubnetID& ipv4_subnet_id,
     }
 }
 
+void
+HostMgr::cacheLookup(const SubnetID& subnet_id, bool v6,
+                     const Host::IdentifierType& identifier_type,
+                     const uint8_t* identifier_begin,
+                     const size_t identifier_len,
+                     const ConstHostPtr& host,
+                     uint64_t generation) const {
+    if (!lookup_cache_) {
+        return;
+    }
+    // A negative cached host from the host cache is a negative answer.
+    ConstHostPtr answer;
+    if (host && !host->getNegative()) {
+        answer = host;
+    }
+    lookup_cache_->insert(HostLookupKey(subnet_id, v6, identifier_type,
+                                        identifier_begin, identifier_len),
+                          answer, generation);
+}
+
+ConstHostCollection
+HostMgr::getDeletedHosts(bool v6, const SubnetID& subnet_id,
+                         const Host::IdentifierType& identifier_type,
+                         const uint8_t* identifier_begin,
+                         const size_t identifier_len,
+                         const HostMgrOperationTarget target) const {
+    ConstHostCollection hosts;
+    ConstHostPtr host;
+    if (target & HostMgrOperationTarget::PRIMARY_SOURCE) {
+        if (v6) {
+            host = getCfgHosts()->get6(subnet_id, identifier_type,
+                                       identifier_begin, identifier_len);
+        } else {
+            host = getCfgHosts()->get4(subnet_id, identifier_type,
+                                       identifier_begin, identifier_len);
+        }
+        if (host) {
+            hosts.push_back(host);
+        }
+    }
+    if (target & HostMgrOperationTarget::ALTERNATE_SOURCES) {
+        for (auto const& source : alternate_sources_) {
+            if (v6) {
+                host = source->get6(subnet_id, identifier_type,
+                                    identifier_begin, identifier_len);
+            } else {
+                host = source->get4(subnet_id, identifier_type,
+                                    identifier_begin, identifier_len);
+            }
+            if (host && !host->getNegative()) {
+                hosts.push_back(host);
+            }
+        }
+    }
+    return (hosts);
+}
+
+ConstHostPtr
+HostMgr::getFirst(bool v6, const SubnetID& subnet_id,
+                  const HostIdentifierList& identifiers) const {
+    // The lookups can be sent at once only to a single backend which is
+    // not the host cache: the host cache and the negative caching expect
+    // the lookups to be made one by one.
+    if ((identifiers.size() < 2) || (alternate_sources_.size() != 1) ||
+        cache_ptr_ || negative_caching_) {
+        for (auto const& id_pair : identifiers) {
+            ConstHostPtr host;
+            if (v6) {
+                host = get6(subnet_id, id_pair.first, id_pair.second.data(),
+                            id_pair.second.size());
+            } else {
+                host = get4(subnet_id, id_pair.first, id_pair.second.data(),
+                            id_pair.second.size());
+            }
+            if (host) {
+                return (host);
+            }
+        }
+        return (ConstHostPtr());
+    }
+
+    // Search the configuration file and the lookup cache in the order
+    // of preference: the backend is queried only for the identifiers
+    // preferred to the first host found there.
+    ConstHostPtr found;
+    HostIdentifierList pending;
+    std::vector<uint64_t> generations;
+    for (auto const& id_pair : identifiers) {
+        const uint8_t* identifier_begin = id_pair.second.data();
+        const size_t identifier_len = id_pair.second.size();
+        ConstHostPtr host;
+        if (v6) {
+            host = getCfgHosts()->get6(subnet_id, id_pair.first,
+                                       identifier_begin, identifier_len);
+        } else {
+            host = getCfgHosts()->get4(subnet_id, id_pair.first,
+                                       identifier_begin, identifier_len);
+        }
+        if (host) {
+            found = host;
+            break;
+        }
+        uint64_t generation = 0;
+        if (lookup_cache_ &&
+            lookup_cache_->get(HostLookupKey(subnet_id, v6, id_pair.first,
+                                             identifier_begin, identifier_len),
+                               host, generation)) {
+            if (host) {
+                found = host;
+                break;
+            }
+            continue;
+        }
+        LOG_DEBUG(hosts_logger, HOSTS_DBG_TRACE,
+                  v6 ? HOSTS_MGR_ALTERNATE_GET6_SUBNET_ID_IDENTIFIER :
+                  HOSTS_MGR_ALTERNATE_GET4_SUBNET_ID_IDENTIFIER)
+            .arg(subnet_id)
+            .arg(Host::getIdentifierAsText(id_pair.first, identifier_begin,
+                                           identifier_len));
+        pending.push_back(id_pair);
+        generations.push_back(generation);
+    }
+    if (pending.empty()) {
+        return (found);
+    }
+
+    auto const& source = alternate_sources_.front();
+    ConstHostCollection hosts;
+    if (v6) {
+        hosts = source->getByIdentifiers6(subnet_id, pending);
+    } else {
+        hosts = source->getByIdentifiers4(subnet_id, pending);
+    }
+
+    // Cache all the answers and return the first host.
+    ConstHostPtr result;
+    size_t i = 0;
+    for (auto const& id_pair : pending) {
+        const uint8_t* identifier_begin = id_pair.second.data();
+        const size_t identifier_len = id_pair.second.size();
+        ConstHostPtr host;
+        if (i < hosts.size()) {
+            host = hosts[i];
+        }
+        if (host) {
+            LOG_DEBUG(hosts_logger, HOSTS_DBG_RESULTS,
+                      v6 ? HOSTS_MGR_ALTERNATE_GET6_SUBNET_ID_IDENTIFIER_HOST :
+                      HOSTS_MGR_ALTERNATE_GET4_SUBNET_ID_IDENTIFIER_HOST)
+                .arg(subnet_id)
+                .arg(Host::getIdentifierAsText(id_pair.first, identifier_begin,
+                                               identifier_len))
+                .arg(source->getType())
+                .arg(host->toText());
+            if (!result) {
+                result = host;
+            }
+        } else {
+            LOG_DEBUG(hosts_logger, HOSTS_DBG_RESULTS,
+                      v6 ? HOSTS_MGR_ALTERNATE_GET6_SUBNET_ID_IDENTIFIER_NULL :
+                      HOSTS_MGR_ALTERNATE_GET4_SUBNET_ID_IDENTIFIER_NULL)
+                .arg(subnet_id)
+                .arg(Host::getIdentifierAsText(id_pair.first, identifier_begin,
+                                               identifier_len));
+        }
+        cacheLookup(subnet_id, v6, id_pair.first, identifier_begin,
+                    identifier_len, host, generations[i]);
+        ++i;
+    }
+    return (result ? result : found);
+}
+
 bool
 HostMgr::setIPReservationsUnique(const bool unique) {
     // Iterate over the alternate sources first, because they may include those
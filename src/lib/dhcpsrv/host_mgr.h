@@ -12,6 +12,7 @@
 #include <dhcpsrv/base_host_data_source.h>
 #include <dhcpsrv/cache_host_data_source.h>
 #include <dhcpsrv/host.h>
+#include <dhcpsrv/host_lookup_cache.h>
 #include <dhcpsrv/subnet_id.h>
 #include <boost/noncopyable.hpp>
 #include <boost/scoped_ptr.hpp>
@@ -72,7 +73,8 @@ public:
     ///
     /// If an instance of the @c HostMgr already exists, it will be replaced
     /// by the new instance. Thus, any instances of alternate host data
-    /// sources will be dropped.
+    /// sources will be dropped. The host lookup cache, if any, is kept
+    /// but flushed as its content depends on the alternate sources.
     ///
     static void create();
 
@@ -459,6 +461,23 @@ public:
     get4(const SubnetID& subnet_id, const Host::IdentifierType& identifier_type,
          const uint8_t* identifier_begin, const size_t identifier_len) const;
 
+    /// @brief Returns a host connected to the IPv4 subnet for the first
+    /// matching identifier.
+    ///
+    /// Same as calling @c get4 for each identifier in the order of
+    /// preference until a host is found, but when the only alternate
+    /// source is a database the identifiers which are neither found in
+    /// the configuration file nor in the lookup cache are looked up at
+    /// once using @c BaseHostDataSource::getByIdentifiers4.
+    ///
+    /// @param subnet_id Subnet identifier.
+    /// @param identifiers Identifiers in the order of preference.
+    ///
+    /// @return Const @c Host object for which reservation has been made
+    /// using the first matching identifier.
+    ConstHostPtr
+    get4(const SubnetID& subnet_id, const HostIdentifierList& identifiers) const;
+
     /// @brief Returns a host connected to the IPv4 subnet and having
     /// a reservation for a specified IPv4 address.
     ///
@@ -571,6 +590,23 @@ public:
     get6(const SubnetID& subnet_id, const Host::IdentifierType& identifier_type,
          const uint8_t* identifier_begin, const size_t identifier_len) const;
 
+    /// @brief Returns a host connected to the IPv6 subnet for the first
+    /// matching identifier.
+    ///
+    /// Same as calling @c get6 for each identifier in the order of
+    /// preference until a host is found, but when the only alternate
+    /// source is a database the identifiers which are neither found in
+    /// the configuration file nor in the lookup cache are looked up at
+    /// once using @c BaseHostDataSource::getByIdentifiers6.
+    ///
+    /// @param subnet_id Subnet identifier.
+    /// @param identifiers Identifiers in the order of preference.
+    ///
+    /// @return Const @c Host object for which reservation has been made
+    /// using the first matching identifier.
+    ConstHostPtr
+    get6(const SubnetID& subnet_id, const HostIdentifierList& identifiers) const;
+
     /// @brief Returns a host using the specified IPv6 prefix.
     ///
     /// This method returns a host using specified IPv6 prefix, as described
@@ -790,6 +826,24 @@ public:
         negative_caching_ = negative_caching;
     }
 
+    /// @brief Returns the host lookup cache.
+    ///
+    /// @return pointer to the host lookup cache (null when disabled).
+    HostLookupCachePtr getLookupCache() const {
+        return (lookup_cache_);
+    }
+
+    /// @brief Sets the host lookup cache.
+    ///
+    /// When set, answers from the alternate host data sources to lookups
+    /// by subnet and identifier are kept in this cache, and entries are
+    /// invalidated by the add, update and delete operations.
+    ///
+    /// @param lookup_cache pointer to the host lookup cache (null disables).
+    void setLookupCache(const HostLookupCachePtr& lookup_cache) {
+        lookup_cache_ = lookup_cache;
+    }
+
     /// @brief Returns the disable single query flag.
     ///
     /// @return the disable single query flag.
@@ -866,6 +920,56 @@ protected:
                                const uint8_t* identifier_begin,
                                const size_t identifier_len) const;
 
+    /// @brief Insert an answer in the host lookup cache.
+    ///
+    /// @param subnet_id Subnet identifier.
+    /// @param v6 true for a lookup by IPv6 subnet, false for IPv4.
+    /// @param identifier_type Identifier type.
+    /// @param identifier_begin Pointer to a beginning of the Identifier.
+    /// @param identifier_len Identifier length.
+    /// @param host Pointer to the found host or null.
+    /// @param generation Generation returned by the cache lookup made
+    /// before querying the alternate sources: the answer is dropped when
+    /// an add, update or delete invalidated the key in the meantime.
+    void cacheLookup(const SubnetID& subnet_id, bool v6,
+                     const Host::IdentifierType& identifier_type,
+                     const uint8_t* identifier_begin,
+                     const size_t identifier_len,
+                     const ConstHostPtr& host,
+                     uint64_t generation) const;
+
+    /// @brief Get the hosts a delete by identifier is going to remove.
+    ///
+    /// The returned hosts are used to invalidate the lookup cache entries
+    /// of both families after the delete.
+    ///
+    /// @param v6 true for a delete by IPv6 subnet, false for IPv4.
+    /// @param subnet_id Subnet identifier.
+    /// @param identifier_type Identifier type.
+    /// @param identifier_begin Pointer to a beginning of the Identifier.
+    /// @param identifier_len Identifier length.
+    /// @param target The host data source being a target of the operation.
+    /// @return Collection of the hosts found in the targeted sources.
+    ConstHostCollection getDeletedHosts(bool v6, const SubnetID& subnet_id,
+                                        const Host::IdentifierType& identifier_type,
+                                        const uint8_t* identifier_begin,
+                                        const size_t identifier_len,
+                                        const HostMgrOperationTarget target) const;
+
+    /// @brief Returns a host for the first matching identifier.
+    ///
+    /// Implements @c get4 and @c get6 for several identifiers.
+    ///
+    /// @param v6 true for a lookup by IPv6 subnet, false for IPv4.
+    /// @param subnet_id Subnet identifier.
+    /// @param identifiers Identifiers in the order of preference.
+    /// @return Const @c Host object or null.
+    ConstHostPtr getFirst(bool v6, const SubnetID& subnet_id,
+                          const HostIdentifierList& identifiers) const;
+
+    /// @brief Pointer to the host lookup cache.
+    HostLookupCachePtr lookup_cache_;
+
 private:
 
     /// @brief Indicates if backends are running in the mode in which IP
@@ -10,6 +10,7 @@
 #include <dhcp/libdhcp++.h>
 #include <dhcp/option_custom.h>
 #include <dhcpsrv/cfgmgr.h>
+#include <dhcpsrv/dhcpsrv_exceptions.h>
 #include <dhcpsrv/dhcpsrv_log.h>
 #include <dhcpsrv/lease_mgr.h>
 #include <dhcpsrv/sflq_allocator.h>
@@ -74,6 +75,174 @@ LeaseMgr::getLease6(Lease::Type type, const DUID& duid,
     return (*col.begin());
 }
 
+Lease4Collection
+LeaseMgr::addLeases(const Lease4Collection& leases) {
+    Lease4Collection failed;
+    for (auto const& lease : leases) {
+        if (!addLease(lease)) {
+            failed.push_back(lease);
+        }
+    }
+    return (failed);
+}
+
+Lease6Collection
+LeaseMgr::addLeases(const Lease6Collection& leases) {
+    Lease6Collection failed;
+    for (auto const& lease : leases) {
+        if (!addLease(lease)) {
+            failed.push_back(lease);
+        }
+    }
+    return (failed);
+}
+
+Lease4Collection
+LeaseMgr::updateLeases4(const Lease4Collection& leases) {
+    Lease4Collection failed;
+    for (auto const& lease : leases) {
+        try {
+            updateLease4(lease);
+        } catch (const NoSuchLease&) {
+            failed.push_back(lease);
+        }
+    }
+    return (failed);
+}
+
+Lease6Collection
+LeaseMgr::updateLeases6(const Lease6Collection& leases) {
+    Lease6Collection failed;
+    for (auto const& lease : leases) {
+        try {
+            updateLease6(lease);
+        } catch (const NoSuchLease&) {
+            failed.push_back(lease);
+        }
+    }
+    return (failed);
+}
+
+Lease4Collection
+LeaseMgr::deleteLeases(const Lease4Collection& leases) {
+    Lease4Collection failed;
+    for (auto const& lease : leases) {
+        if (!deleteLease(lease)) {
+            failed.push_back(lease);
+        }
+    }
+    return (failed);
+}
+
+Lease6Collection
+LeaseMgr::deleteLeases(const Lease6Collection& leases) {
+    Lease6Collection failed;
+    for (auto const& lease : leases) {
+        if (!deleteLease(lease)) {
+            failed.push_back(lease);
+        }
+    }
+    return (failed);
+}
+
+size_t
+LeaseMgr::visitLeases4(const Lease4Visitor& visitor, size_t page_size) const {
+    LeasePageSize page(page_size);
+    IOAddress lower_bound = IOAddress::IPV4_ZERO_ADDRESS();
+    size_t count = 0;
+    for (;;) {
+        Lease4Collection leases = getLeases4(lower_bound, page);
+        for (auto const& lease : leases) {
+            ++count;
+            if (!visitor(lease)) {
+                return (count);
+            }
+        }
+        if (leases.size() < page_size) {
+            return (count);
+        }
+        lower_bound = leases.back()->addr_;
+    }
+}
+
+size_t
+LeaseMgr::visitLeases4(SubnetID subnet_id, const Lease4Visitor& visitor,
+                       size_t page_size) const {
+    return (visitLeases4(subnet_id, IOAddress::IPV4_ZERO_ADDRESS(), visitor,
+                         page_size));
+}
+
+size_t
+LeaseMgr::visitLeases4(SubnetID subnet_id, const IOAddress& start_addr,
+                       const Lease4Visitor& visitor,
+                       size_t page_size) const {
+    LeasePageSize page(page_size);
+    IOAddress lower_bound = start_addr;
+    size_t count = 0;
+    for (;;) {
+        Lease4Collection leases = getLeases4(subnet_id, lower_bound, page);
+        for (auto const& lease : leases) {
+            ++count;
+            if (!visitor(lease)) {
+                return (count);
+            }
+        }
+        if (leases.size() < page_size) {
+            return (count);
+        }
+        lower_bound = leases.back()->addr_;
+    }
+}
+
+size_t
+LeaseMgr::visitLeases6(const Lease6Visitor& visitor, size_t page_size) const {
+    LeasePageSize page(page_size);
+    IOAddress lower_bound = IOAddress::IPV6_ZERO_ADDRESS();
+    size_t count = 0;
+    for (;;) {
+        Lease6Collection leases = getLeases6(lower_bound, page);
+        for (auto const& lease : leases) {
+            ++count;
+            if (!visitor(lease)) {
+                return (count);
+            }
+        }
+        if (leases.size() < page_size) {
+            return (count);
+        }
+        lower_bound = leases.back()->addr_;
+    }
+}
+
+size_t
+LeaseMgr::visitLeases6(SubnetID subnet_id, const Lease6Visitor& visitor,
+                       size_t page_size) const {
+    return (visitLeases6(subnet_id, IOAddress::IPV6_ZERO_ADDRESS(), visitor,
+                         page_size));
+}
+
+size_t
+LeaseMgr::visitLeases6(SubnetID subnet_id, const IOAddress& start_addr,
+                       const Lease6Visitor& visitor,
+                       size_t page_size) const {
+    LeasePageSize page(page_size);
+    IOAddress lower_bound = start_addr;
+    size_t count = 0;
+    for (;;) {
+        Lease6Collection leases = getLeases6(subnet_id, lower_bound, page);
+        for (auto const& lease : leases) {
+            ++count;
+            if (!visitor(lease)) {
+                return (count);
+            }
+        }
+        if (leases.size() < page_size) {
+            return (count);
+        }
+        lower_bound = leases.back()->addr_;
+    }
+}
+
 void
 LeaseMgr::recountLeaseStats4() {
     using namespace stats;
@@ -232,6 +401,118 @@ LeaseMgr::recountLeaseStats4() {
     }
 }
 
+void
+LeaseMgr::recountLeaseStats4(const SubnetIDSet& subnet_ids) {
+    using namespace stats;
+
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    int64_t zero = 0;
+
+    CfgSubnets4Ptr cfg = CfgMgr::instance().getCurrentCfg()->getCfgSubnets4();
+    for (auto const& subnet_id : subnet_ids) {
+        ConstSubnet4Ptr subnet = cfg->getBySubnetId(subnet_id);
+        if (!subnet) {
+            continue;
+        }
+
+        LeaseStatsQueryPtr query = startSubnetLeaseStatsQuery4(subnet_id);
+        if (!query) {
+            /// NULL means not backend does not support recounting.
+            return;
+        }
+
+        // Clear subnet level stats.
+        stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                                  "assigned-addresses"),
+                           zero);
+
+        stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                                  "declined-addresses"),
+                           zero);
+
+        const std::string name_rec_dec(StatsMgr::generateName("subnet", subnet_id,
+                                                              "reclaimed-declined-addresses"));
+        if (!stats_mgr.getObservation(name_rec_dec)) {
+            stats_mgr.setValue(name_rec_dec, zero);
+        }
+
+        const std::string name_rec(StatsMgr::generateName("subnet", subnet_id,
+                                                          "reclaimed-leases"));
+        if (!stats_mgr.getObservation(name_rec)) {
+            stats_mgr.setValue(name_rec, zero);
+        }
+
+        for (auto const& pool : subnet->getPools(Lease::TYPE_V4)) {
+            stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                                      StatsMgr::generateName("pool", pool->getID(),
+                                                                             "assigned-addresses")),
+                               zero);
+
+            stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                                      StatsMgr::generateName("pool", pool->getID(),
+                                                                             "declined-addresses")),
+                               zero);
+
+            const std::string& pname_rec_dec(StatsMgr::generateName("subnet", subnet_id,
+                                                                    StatsMgr::generateName("pool", pool->getID(),
+                                                                                          "reclaimed-declined-addresses")));
+            if (!stats_mgr.getObservation(pname_rec_dec)) {
+                stats_mgr.setValue(pname_rec_dec, zero);
+            }
+
+            const std::string& pname_rec(StatsMgr::generateName("subnet", subnet_id,
+                                                                StatsMgr::generateName("pool", pool->getID(),
+                                                                                      "reclaimed-leases")));
+            if (!stats_mgr.getObservation(pname_rec)) {
+                stats_mgr.setValue(pname_rec, zero);
+            }
+        }
+
+        // Get counts per state. The global values are not changed as
+        // they include the leases of all subnets.
+        LeaseStatsRow row;
+        while (query->getNextRow(row)) {
+            if ((row.lease_state_ != Lease::STATE_DEFAULT) &&
+                (row.lease_state_ != Lease::STATE_DECLINED)) {
+                continue;
+            }
+
+            // Declined leases also count as assigned.
+            stats_mgr.addValue(StatsMgr::generateName("subnet", subnet_id,
+                                                      "assigned-addresses"),
+                               row.state_count_);
+
+            if (row.lease_state_ == Lease::STATE_DECLINED) {
+                stats_mgr.addValue(StatsMgr::generateName("subnet", subnet_id,
+                                                          "declined-addresses"),
+                                   row.state_count_);
+            }
+        }
+
+        // There is no pool lease stats query for a single subnet so
+        // count the leases of the subnet.
+        for (auto const& lease : getLeases4(subnet_id)) {
+            if ((lease->state_ != Lease::STATE_DEFAULT) &&
+                (lease->state_ != Lease::STATE_DECLINED)) {
+                continue;
+            }
+
+            // Declined leases also count as assigned.
+            stats_mgr.addValue(StatsMgr::generateName("subnet", subnet_id,
+                                                      StatsMgr::generateName("pool", lease->pool_id_,
+                                                                             "assigned-addresses")),
+                               int64_t(1));
+
+            if (lease->state_ == Lease::STATE_DECLINED) {
+                stats_mgr.addValue(StatsMgr::generateName("subnet", subnet_id,
+                                                          StatsMgr::generateName("pool", lease->pool_id_,
+                                                                                 "declined-addresses")),
+                                   int64_t(1));
+            }
+        }
+    }
+}
+
 LeaseStatsQuery::LeaseStatsQuery(const SelectMode& select_mode)
     : first_subnet_id_(0), last_subnet_id_(0), select_mode_(select_mode) {
     if (select_mode != ALL_SUBNETS && select_mode != ALL_SUBNET_POOLS) {
@@ -538,6 +819,162 @@ LeaseMgr::recountLeaseStats6() {
     }
 }
 
+void
+LeaseMgr::recountLeaseStats6(const SubnetIDSet& subnet_ids) {
+    using namespace stats;
+
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    int64_t zero = 0;
+
+    CfgSubnets6Ptr cfg = CfgMgr::instance().getCurrentCfg()->getCfgSubnets6();
+    for (auto const& subnet_id : subnet_ids) {
+        ConstSubnet6Ptr subnet = cfg->getBySubnetId(subnet_id);
+        if (!subnet) {
+            continue;
+        }
+
+        LeaseStatsQueryPtr query = startSubnetLeaseStatsQuery6(subnet_id);
+        if (!query) {
+            /// NULL means not backend does not support recounting.
+            return;
+        }
+
+        // Clear subnet level stats.
+        stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                                  "assigned-nas"),
+                           zero);
+
+        stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                                  "assigned-pds"),
+                           zero);
+
+        stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                                  "declined-addresses"),
+                           zero);
+
+        stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                                  "registered-nas"),
+                           zero);
+
+        const std::string name_rec_dec(StatsMgr::generateName("subnet", subnet_id,
+                                                              "reclaimed-declined-addresses"));
+        if (!stats_mgr.getObservation(name_rec_dec)) {
+            stats_mgr.setValue(name_rec_dec, zero);
+        }
+
+        const std::string name_rec(StatsMgr::generateName("subnet", subnet_id,
+                                                          "reclaimed-leases"));
+        if (!stats_mgr.getObservation(name_rec)) {
+            stats_mgr.setValue(name_rec, zero);
+        }
+
+        for (auto const& pool : subnet->getPools(Lease::TYPE_NA)) {
+            stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                                      StatsMgr::generateName("pool", pool->getID(),
+                                                                             "assigned-nas")),
+                               zero);
+
+            stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                                      StatsMgr::generateName("pool", pool->getID(),
+                                                                             "declined-addresses")),
+                               zero);
+
+            const std::string name_pool_rec_dec(StatsMgr::generateName("subnet", subnet_id,
+                                                                       StatsMgr::generateName("pool", pool->getID(),
+                                                                                              "reclaimed-declined-addresses")));
+            if (!stats_mgr.getObservation(name_pool_rec_dec)) {
+                stats_mgr.setValue(name_pool_rec_dec, zero);
+            }
+
+            const std::string& name_pool_rec(StatsMgr::generateName("subnet", subnet_id,
+                                                                    StatsMgr::generateName("pool", pool->getID(),
+                                                                                           "reclaimed-leases")));
+            if (!stats_mgr.getObservation(name_pool_rec)) {
+                stats_mgr.setValue(name_pool_rec, zero);
+            }
+        }
+
+        for (auto const& pool : subnet->getPools(Lease::TYPE_PD)) {
+            stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                                      StatsMgr::generateName("pd-pool", pool->getID(),
+                                                                             "assigned-pds")),
+                               zero);
+
+            const std::string& name_pool_rec(StatsMgr::generateName("subnet", subnet_id,
+                                                                    StatsMgr::generateName("pd-pool", pool->getID(),
+                                                                                           "reclaimed-leases")));
+            if (!stats_mgr.getObservation(name_pool_rec)) {
+                stats_mgr.setValue(name_pool_rec, zero);
+            }
+        }
+
+        // Get counts per type and state. The global values are not
+        // changed as they include the leases of all subnets.
+        LeaseStatsRow row;
+        while (query->getNextRow(row)) {
+            switch(row.lease_type_) {
+                case Lease::TYPE_NA:
+                    if ((row.lease_state_ == Lease::STATE_DEFAULT) ||
+                        (row.lease_state_ == Lease::STATE_DECLINED)) {
+                        // Declined leases also count as assigned.
+                        stats_mgr.addValue(StatsMgr::generateName("subnet", subnet_id,
+                                                                  "assigned-nas"),
+                                           row.state_count_);
+                    }
+                    if (row.lease_state_ == Lease::STATE_DECLINED) {
+                        stats_mgr.addValue(StatsMgr::generateName("subnet", subnet_id,
+                                                                  "declined-addresses"),
+                                           row.state_count_);
+                    } else if (row.lease_state_ == Lease::STATE_REGISTERED) {
+                        stats_mgr.addValue(StatsMgr::generateName("subnet", subnet_id,
+                                                                  "registered-nas"),
+                                           row.state_count_);
+                    }
+                    break;
+
+                case Lease::TYPE_PD:
+                    if (row.lease_state_ == Lease::STATE_DEFAULT) {
+                        stats_mgr.addValue(StatsMgr::generateName("subnet", subnet_id,
+                                                                  "assigned-pds"),
+                                           row.state_count_);
+                    }
+                    break;
+
+                default:
+                    break;
+            }
+        }
+
+        // There is no pool lease stats query for a single subnet so
+        // count the leases of the subnet.
+        visitLeases6(subnet_id, [&stats_mgr, subnet_id](const Lease6Ptr& lease) {
+            if ((lease->type_ == Lease::TYPE_NA) &&
+                ((lease->state_ == Lease::STATE_DEFAULT) ||
+                 (lease->state_ == Lease::STATE_DECLINED))) {
+                // Declined leases also count as assigned.
+                stats_mgr.addValue(StatsMgr::generateName("subnet", subnet_id,
+                                                          StatsMgr::generateName("pool", lease->pool_id_,
+                                                                                 "assigned-nas")),
+                                   int64_t(1));
+
+                if (lease->state_ == Lease::STATE_DECLINED) {
+                    stats_mgr.addValue(StatsMgr::generateName("subnet", subnet_id,
+                                                              StatsMgr::generateName("pool", lease->pool_id_,
+                                                                                     "declined-addresses")),
+                                       int64_t(1));
+                }
+            } else if ((lease->type_ == Lease::TYPE_PD) &&
+                       (lease->state_ == Lease::STATE_DEFAULT)) {
+                stats_mgr.addValue(StatsMgr::generateName("subnet", subnet_id,
+                                                          StatsMgr::generateName("pd-pool", lease->pool_id_,
+                                                                                 "assigned-pds")),
+                                   int64_t(1));
+            }
+            return (true);
+        });
+    }
+}
+
 LeaseStatsQueryPtr
 LeaseMgr::startLeaseStatsQuery6() {
     return(LeaseStatsQueryPtr());
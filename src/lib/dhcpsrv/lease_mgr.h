@@ -23,6 +23,7 @@
 #include <boost/shared_ptr.hpp>
 
 #include <fstream>
+#include <functional>
 #include <iostream>
 #include <map>
 #include <string>
@@ -261,6 +262,15 @@ typedef boost::shared_ptr<SflqPoolInfo> SflqPoolInfoPtr;
 typedef std::vector<SflqPoolInfoPtr> SflqPoolInfoCollection;
 typedef boost::shared_ptr<SflqPoolInfoCollection> SflqPoolInfoCollectionPtr;
 
+/// @brief Visitor of IPv4 leases.
+///
+/// Called for each visited lease, returns false to stop the visit.
+typedef std::function<bool(const Lease4Ptr&)> Lease4Visitor;
+
+/// @brief Visitor of IPv6 leases.
+///
+/// Called for each visited lease, returns false to stop the visit.
+typedef std::function<bool(const Lease6Ptr&)> Lease6Visitor;
 
 /// @brief Abstract Lease Manager
 ///
@@ -423,6 +433,19 @@ public:
     getLeases4(const asiolink::IOAddress& lower_bound_address,
                const LeasePageSize& page_size) const = 0;
 
+    /// @brief Returns a page of IPv4 leases for a subnet identifier.
+    ///
+    /// @param subnet_id subnet identifier.
+    /// @param lower_bound_address IPv4 address used as lower bound for the
+    /// returned range.
+    /// @param page_size maximum size of the page returned.
+    ///
+    /// @return collection of IPv4 leases
+    virtual Lease4Collection
+    getLeases4(SubnetID subnet_id,
+               const asiolink::IOAddress& lower_bound_address,
+               const LeasePageSize& page_size) const = 0;
+
     /// @brief Returns all IPv4 leases for the particular state and subnet.
     ///
     /// @param state the state e.g. 1 (declined).
@@ -578,6 +601,89 @@ public:
                const asiolink::IOAddress& lower_bound_address,
                const LeasePageSize& page_size) const = 0;
 
+    /// @brief Default number of leases fetched at once by visits.
+    static const size_t VISIT_PAGE_SIZE = 1000;
+
+    /// @brief Visits all IPv4 leases.
+    ///
+    /// The leases are fetched page by page using the paged version of
+    /// @c getLeases4 so the whole lease database is never materialized
+    /// in memory and no lock is held while the visitor is called.
+    ///
+    /// @param visitor function called for each lease, returning false
+    /// stops the visit.
+    /// @param page_size number of leases fetched at once.
+    /// @return the number of visited leases.
+    size_t visitLeases4(const Lease4Visitor& visitor,
+                        size_t page_size = VISIT_PAGE_SIZE) const;
+
+    /// @brief Visits all IPv6 leases.
+    ///
+    /// Same as @c visitLeases4 for IPv6 leases.
+    ///
+    /// @param visitor function called for each lease, returning false
+    /// stops the visit.
+    /// @param page_size number of leases fetched at once.
+    /// @return the number of visited leases.
+    size_t visitLeases6(const Lease6Visitor& visitor,
+                        size_t page_size = VISIT_PAGE_SIZE) const;
+
+    /// @brief Visits all IPv4 leases of a subnet.
+    ///
+    /// Same as @c visitLeases4 for the leases of a subnet.
+    ///
+    /// @param subnet_id subnet identifier.
+    /// @param visitor function called for each lease, returning false
+    /// stops the visit.
+    /// @param page_size number of leases fetched at once.
+    /// @return the number of visited leases.
+    size_t visitLeases4(SubnetID subnet_id, const Lease4Visitor& visitor,
+                        size_t page_size = VISIT_PAGE_SIZE) const;
+
+    /// @brief Visits the IPv4 leases of a subnet from an address.
+    ///
+    /// Same as the previous method but the visit starts after the given
+    /// address so an interrupted visit can be resumed.
+    ///
+    /// @param subnet_id subnet identifier.
+    /// @param start_addr only leases with a greater address are visited.
+    /// @param visitor function called for each lease, returning false
+    /// stops the visit.
+    /// @param page_size number of leases fetched at once.
+    /// @return the number of visited leases.
+    size_t visitLeases4(SubnetID subnet_id,
+                        const asiolink::IOAddress& start_addr,
+                        const Lease4Visitor& visitor,
+                        size_t page_size = VISIT_PAGE_SIZE) const;
+
+    /// @brief Visits all IPv6 leases of a subnet.
+    ///
+    /// Same as @c visitLeases6 for the leases of a subnet.
+    ///
+    /// @param subnet_id subnet identifier.
+    /// @param visitor function called for each lease, returning false
+    /// stops the visit.
+    /// @param page_size number of leases fetched at once.
+    /// @return the number of visited leases.
+    size_t visitLeases6(SubnetID subnet_id, const Lease6Visitor& visitor,
+                        size_t page_size = VISIT_PAGE_SIZE) const;
+
+    /// @brief Visits the IPv6 leases of a subnet from an address.
+    ///
+    /// Same as the previous method but the visit starts after the given
+    /// address so an interrupted visit can be resumed.
+    ///
+    /// @param subnet_id subnet identifier.
+    /// @param start_addr only leases with a greater address are visited.
+    /// @param visitor function called for each lease, returning false
+    /// stops the visit.
+    /// @param page_size number of leases fetched at once.
+    /// @return the number of visited leases.
+    size_t visitLeases6(SubnetID subnet_id,
+                        const asiolink::IOAddress& start_addr,
+                        const Lease6Visitor& visitor,
+                        size_t page_size = VISIT_PAGE_SIZE) const;
+
     /// @brief Returns all IPv6 leases for the particular state and subnet.
     ///
     /// @param state the state e.g. 1 (declined).
@@ -645,6 +751,78 @@ public:
     ///        failed.
     virtual bool deleteLease(const Lease6Ptr& lease) = 0;
 
+    /// @brief Adds a batch of IPv4 leases.
+    ///
+    /// The default implementation calls @c addLease for each lease.
+    /// Database backends override it to write the whole batch using
+    /// one connection and one transaction, i.e. one commit instead of
+    /// one per lease.
+    ///
+    /// @param leases The leases to be added.
+    ///
+    /// @return The leases which were not added (because a lease with the
+    ///         same address was already there or failed sanity checks).
+    /// @throw isc::db::DbOperationError An operation on the open database has
+    ///        failed. Database backends roll back the whole batch.
+    virtual Lease4Collection addLeases(const Lease4Collection& leases);
+
+    /// @brief Adds a batch of IPv6 leases.
+    ///
+    /// See the IPv4 version for details.
+    ///
+    /// @param leases The leases to be added.
+    ///
+    /// @return The leases which were not added.
+    /// @throw isc::db::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual Lease6Collection addLeases(const Lease6Collection& leases);
+
+    /// @brief Updates a batch of IPv4 leases.
+    ///
+    /// The default implementation calls @c updateLease4 for each lease.
+    /// A lease which does not exist (or has changed in the database)
+    /// does not stop the batch: it is returned instead.
+    ///
+    /// @param leases The leases to be updated.
+    ///
+    /// @return The leases which were not updated.
+    /// @throw isc::db::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual Lease4Collection updateLeases4(const Lease4Collection& leases);
+
+    /// @brief Updates a batch of IPv6 leases.
+    ///
+    /// See the IPv4 version for details.
+    ///
+    /// @param leases The leases to be updated.
+    ///
+    /// @return The leases which were not updated.
+    /// @throw isc::db::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual Lease6Collection updateLeases6(const Lease6Collection& leases);
+
+    /// @brief Deletes a batch of IPv4 leases.
+    ///
+    /// The default implementation calls @c deleteLease for each lease.
+    ///
+    /// @param leases The leases to be deleted.
+    ///
+    /// @return The leases which were not deleted because they do not exist.
+    /// @throw isc::db::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual Lease4Collection deleteLeases(const Lease4Collection& leases);
+
+    /// @brief Deletes a batch of IPv6 leases.
+    ///
+    /// The default implementation calls @c deleteLease for each lease.
+    ///
+    /// @param leases The leases to be deleted.
+    ///
+    /// @return The leases which were not deleted because they do not exist.
+    /// @throw isc::db::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual Lease6Collection deleteLeases(const Lease6Collection& leases);
+
     /// @brief Deletes all expired and reclaimed DHCPv4 leases.
     ///
     /// @param secs Number of seconds since expiration of leases before
@@ -683,6 +861,19 @@ public:
     /// adding to the appropriate global statistic.
     void recountLeaseStats4();
 
+    /// @brief Recalculates per-subnet stats for IPv4 leases of some subnets
+    ///
+    /// Same as @c recountLeaseStats4 restricted to the given subnets,
+    /// e.g. the subnets added or replaced by a configuration backend
+    /// update. The global stats are not changed: they include the leases
+    /// of all subnets so they do not depend on the configuration. The
+    /// subnet level counts come from @c startSubnetLeaseStatsQuery4 and
+    /// the pool level counts from the leases of the subnet.
+    ///
+    /// @param subnet_ids identifiers of the subnets (subnets which are
+    /// not configured are ignored).
+    void recountLeaseStats4(const SubnetIDSet& subnet_ids);
+
     /// @brief Creates and runs the IPv4 lease stats query for all subnets
     ///
     /// LeaseMgr derivations implement this method such that it creates and
@@ -755,6 +946,14 @@ public:
     /// per subnet and adding to the appropriate global statistic.
     void recountLeaseStats6();
 
+    /// @brief Recalculates per-subnet stats for IPv6 leases of some subnets
+    ///
+    /// Same as @c recountLeaseStats4 with a set of subnets for IPv6 leases.
+    ///
+    /// @param subnet_ids identifiers of the subnets (subnets which are
+    /// not configured are ignored).
+    void recountLeaseStats6(const SubnetIDSet& subnet_ids);
+
     /// @brief Creates and runs the IPv6 lease stats query for all subnets
     ///
     /// LeaseMgr derivations implement this method such that it creates and
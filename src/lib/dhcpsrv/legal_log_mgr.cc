@@ -83,7 +83,7 @@ LegalLogMgr::parseDatabase(const ConstElementPtr& parameters, DatabaseConnection
     // uint32_t
     for (char const* const& key : {
          "connect-timeout", "reconnect-wait-time", "max-reconnect-tries",
-         "read-timeout", "write-timeout", "tcp-user-timeout"}) {
+         "read-timeout", "write-timeout", "tcp-user-timeout", "queue-size"}) {
         ConstElementPtr const value(parameters->get(key));
         if (value) {
             int64_t integer_value(value->intValue());
@@ -170,7 +170,7 @@ LegalLogMgr::parseFile(const ConstElementPtr& parameters, DatabaseConnection::Pa
     }
 
     // Strings
-    for (char const* const& key : { "path", "base-name", "time-unit", "prerotate", "postrotate" }) {
+    for (char const* const& key : { "path", "base-name", "time-unit", "prerotate", "postrotate", "output-format" }) {
         ConstElementPtr const value(parameters->get(key));
         if (value) {
             if (key == std::string("path")) {
@@ -189,7 +189,7 @@ LegalLogMgr::parseFile(const ConstElementPtr& parameters, DatabaseConnection::Pa
     }
 
     // uint32_t
-    for (char const* const& key : { "count" }) {
+    for (char const* const& key : { "count", "queue-size" }) {
         ConstElementPtr const value(parameters->get(key));
         if (value) {
             int64_t integer_value(value->intValue());
@@ -94,6 +94,8 @@ public:
     ///       - postrotate
     ///       - count
     ///       - mark-continuation-lines
+    ///       - queue-size
+    ///       - output-format - one of: text, csv
     /// - syslog parameters:
     ///       - pattern
     ///       - facility
@@ -117,6 +119,7 @@ public:
     ///       - read-timeout (MySQL only)
     ///       - write-timeout (MySQL only)
     ///       - tcp-user-timeout (PostgreSQL only)
+    ///       - queue-size
     ///
     /// @param parameters The library parameters.
     /// @param map The parameter map used by LegalLogMgr objects.
@@ -150,6 +153,7 @@ public:
     ///       - read-timeout (MySQL only)
     ///       - write-timeout (MySQL only)
     ///       - tcp-user-timeout (PostgreSQL only)
+    ///       - queue-size
     ///
     /// @param parameters The library parameters.
     /// @param map The parameter map used by LegalLogMgr objects.
@@ -169,6 +173,8 @@ public:
     ///       - postrotate
     ///       - count
     ///       - mark-continuation-lines
+    ///       - queue-size
+    ///       - output-format - one of: text, csv
     ///
     /// @param parameters The library parameters.
     /// @param [out] map The parameter map.
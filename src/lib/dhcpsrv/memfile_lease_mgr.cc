@@ -1502,11 +1502,12 @@ Memfile_LeaseMgr::getLeases4Internal(const asiolink::IOAddress& lower_bound_addr
         ++lb;
     }
 
-    // Return all other leases being within the page size.
+    // Return all other leases being within the page size. Count them
+    // as std::distance is linear on ordered indexes.
+    size_t count = 0;
     for (auto lease = lb;
-         (lease != idx.end()) &&
-         (static_cast<size_t>(std::distance(lb, lease)) < page_size.page_size_);
-         ++lease) {
+         (lease != idx.end()) && (count < page_size.page_size_);
+         ++lease, ++count) {
         collection.push_back(Lease4Ptr(new Lease4(**lease)));
     }
 }
@@ -1536,6 +1537,64 @@ Memfile_LeaseMgr::getLeases4(const asiolink::IOAddress& lower_bound_address,
     return (collection);
 }
 
+void
+Memfile_LeaseMgr::getLeases4Internal(SubnetID subnet_id,
+                                     const asiolink::IOAddress& lower_bound_address,
+                                     const LeasePageSize& page_size,
+                                     Lease4Collection& collection) const {
+    const Lease4StorageSubnetIdIndex& idx = storage4_.get<SubnetIdIndexTag>();
+    Lease4StorageSubnetIdIndex::const_iterator lb =
+        idx.lower_bound(boost::make_tuple(subnet_id, lower_bound_address));
+
+    // Exclude the lower bound address specified by the caller.
+    if ((lb != idx.end()) && ((*lb)->subnet_id_ == subnet_id) &&
+        ((*lb)->addr_ == lower_bound_address)) {
+        ++lb;
+    }
+
+    // Return all leases of the subnet being within the page size.
+    for (auto lease = lb; lease != idx.end(); ++lease) {
+        if ((*lease)->subnet_id_ != subnet_id) {
+            // Gone after the subnet id index.
+            break;
+        }
+        collection.push_back(Lease4Ptr(new Lease4(**lease)));
+        if (collection.size() >= page_size.page_size_) {
+            break;
+        }
+    }
+}
+
+Lease4Collection
+Memfile_LeaseMgr::getLeases4(SubnetID subnet_id,
+                             const asiolink::IOAddress& lower_bound_address,
+                             const LeasePageSize& page_size) const {
+    // Expecting IPv4 address.
+    if (!lower_bound_address.isV4()) {
+        isc_throw(InvalidAddressFamily, "expected IPv4 address while "
+                  "retrieving leases from the lease database, got "
+                  << lower_bound_address);
+    }
+
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_MEMFILE_GET_SUBID_PAGE4)
+        .arg(page_size.page_size_)
+        .arg(lower_bound_address.toText())
+        .arg(subnet_id);
+
+    Lease4Collection collection;
+    if (MultiThreadingMgr::instance().getMode()) {
+        std::lock_guard<std::mutex> lock(*mutex_);
+        getLeases4Internal(subnet_id, lower_bound_address, page_size,
+                           collection);
+    } else {
+        getLeases4Internal(subnet_id, lower_bound_address, page_size,
+                           collection);
+    }
+
+    return (collection);
+}
+
 Lease4Collection
 Memfile_LeaseMgr::getLeases4(uint32_t state, SubnetID subnet_id) const {
     Lease4Collection collection;
@@ -1851,11 +1910,12 @@ Memfile_LeaseMgr::getLeases6Internal(const asiolink::IOAddress& lower_bound_addr
         ++lb;
     }
 
-    // Return all other leases being within the page size.
+    // Return all other leases being within the page size. Count them
+    // as std::distance is linear on ordered indexes.
+    size_t count = 0;
     for (auto lease = lb;
-         (lease != idx.end()) &&
-         (static_cast<size_t>(std::distance(lb, lease)) < page_size.page_size_);
-         ++lease) {
+         (lease != idx.end()) && (count < page_size.page_size_);
+         ++lease, ++count) {
         collection.push_back(Lease6Ptr(new Lease6(**lease)));
     }
 }
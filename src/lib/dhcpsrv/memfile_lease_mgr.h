@@ -283,6 +283,19 @@ public:
     getLeases4(const asiolink::IOAddress& lower_bound_address,
                const LeasePageSize& page_size) const override;
 
+    /// @brief Returns a page of IPv4 leases for a subnet identifier.
+    ///
+    /// @param subnet_id subnet identifier.
+    /// @param lower_bound_address IPv4 address used as lower bound for the
+    /// returned range.
+    /// @param page_size maximum size of the page returned.
+    ///
+    /// @return collection of IPv4 leases
+    virtual Lease4Collection
+    getLeases4(SubnetID subnet_id,
+               const asiolink::IOAddress& lower_bound_address,
+               const LeasePageSize& page_size) const override;
+
     /// @brief Returns all IPv4 leases for the particular state and subnet.
     ///
     /// @param state the state e.g. 1 (declined).
@@ -681,6 +694,18 @@ private:
                             const LeasePageSize& page_size,
                             Lease4Collection& collection) const;
 
+    /// @brief Returns a page of IPv4 leases for a subnet identifier.
+    ///
+    /// @param subnet_id subnet identifier.
+    /// @param lower_bound_address IPv4 address used as lower bound for the
+    /// returned range.
+    /// @param page_size maximum size of the page returned.
+    /// @param collection lease collection
+    void getLeases4Internal(SubnetID subnet_id,
+                            const asiolink::IOAddress& lower_bound_address,
+                            const LeasePageSize& page_size,
+                            Lease4Collection& collection) const;
+
     /// @brief Returns all IPv4 leases for the particular state and subnet.
     ///
     /// @param state the state e.g. 1 (declined).
@@ -302,10 +302,20 @@ typedef boost::multi_index_container<
         >,
 
         // Specification of the fifth index starts here.
-        // This index sorts leases by SubnetID.
-        boost::multi_index::ordered_non_unique<
+        // This index sorts leases by SubnetID and address.
+        boost::multi_index::ordered_unique<
             boost::multi_index::tag<SubnetIdIndexTag>,
-            boost::multi_index::member<Lease, isc::dhcp::SubnetID, &Lease::subnet_id_>
+            boost::multi_index::composite_key<
+                Lease4,
+                // Subnet id.
+                boost::multi_index::member<Lease,
+                                           isc::dhcp::SubnetID,
+                                           &Lease::subnet_id_>,
+                // Address.
+                boost::multi_index::member<Lease,
+                                           isc::asiolink::IOAddress,
+                                           &Lease::addr_>
+            >
         >,
 
         // Specification of the sixth index starts here.
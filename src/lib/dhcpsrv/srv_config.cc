@@ -401,8 +401,40 @@ SrvConfig::removeStatistics() {
 }
 
 void
-SrvConfig::updateStatistics() {
-    // Update default sample limits.
+SrvConfig::removeStatistics(const SrvConfig& other) {
+    // Removes statistics for the v4 and v6 subnets which the merge of
+    // the other configuration will replace.
+    getCfgSubnets4()->removeStatistics(getCfgSubnets4()->
+                                       getReplacedSubnetIds(*other.getCfgSubnets4()));
+    getCfgSubnets6()->removeStatistics(getCfgSubnets6()->
+                                       getReplacedSubnetIds(*other.getCfgSubnets6()));
+}
+
+void
+SrvConfig::removeUnkeptStatistics(const SrvConfig& next) {
+    // Removes statistics for the v4 and v6 subnets which the next
+    // configuration does not keep.
+    const SubnetIDSet& kept4 = next.getCfgSubnets4()->getKeptStatistics();
+    SubnetIDSet subnet_ids;
+    for (auto const& subnet : *getCfgSubnets4()->getAll()) {
+        if (!kept4.count(subnet->getID())) {
+            subnet_ids.insert(subnet->getID());
+        }
+    }
+    getCfgSubnets4()->removeStatistics(subnet_ids);
+
+    const SubnetIDSet& kept6 = next.getCfgSubnets6()->getKeptStatistics();
+    subnet_ids.clear();
+    for (auto const& subnet : *getCfgSubnets6()->getAll()) {
+        if (!kept6.count(subnet->getID())) {
+            subnet_ids.insert(subnet->getID());
+        }
+    }
+    getCfgSubnets6()->removeStatistics(subnet_ids);
+}
+
+void
+SrvConfig::updateSampleLimits() {
     stats::StatsMgr& stats_mgr = stats::StatsMgr::instance();
     ConstElementPtr samples =
         getConfiguredGlobal("statistic-default-sample-count");
@@ -424,6 +456,12 @@ SrvConfig::updateStatistics() {
             stats_mgr.setMaxSampleAgeAll(max_age);
         }
     }
+}
+
+void
+SrvConfig::updateStatistics() {
+    // Update default sample limits.
+    updateSampleLimits();
 
     // Updating subnet statistics involves updating lease statistics, which
     // is done by the LeaseMgr.  Since servers with subnets, must have a
@@ -437,6 +475,66 @@ SrvConfig::updateStatistics() {
     }
 }
 
+void
+SrvConfig::updateStatistics(const SrvConfig& other) {
+    // Update default sample limits.
+    updateSampleLimits();
+
+    // Only the statistics of the subnets merged from the other
+    // configuration are updated: the configuration and the leases of
+    // the other subnets did not change.
+    if (LeaseMgrFactory::haveInstance()) {
+        SubnetIDSet subnet_ids;
+        for (auto const& subnet : *other.getCfgSubnets4()->getAll()) {
+            subnet_ids.insert(subnet->getID());
+        }
+        getCfgSubnets4()->updateStatistics(subnet_ids);
+
+        subnet_ids.clear();
+        for (auto const& subnet : *other.getCfgSubnets6()->getAll()) {
+            subnet_ids.insert(subnet->getID());
+        }
+        getCfgSubnets6()->updateStatistics(subnet_ids);
+    }
+}
+
+void
+SrvConfig::updateUnkeptStatistics() {
+    // Update default sample limits.
+    updateSampleLimits();
+
+    if (!LeaseMgrFactory::haveInstance()) {
+        return;
+    }
+
+    // Without kept statistics all the leases are recounted.
+    const SubnetIDSet& kept4 = getCfgSubnets4()->getKeptStatistics();
+    if (kept4.empty()) {
+        getCfgSubnets4()->updateStatistics();
+    } else {
+        SubnetIDSet subnet_ids;
+        for (auto const& subnet : *getCfgSubnets4()->getAll()) {
+            if (!kept4.count(subnet->getID())) {
+                subnet_ids.insert(subnet->getID());
+            }
+        }
+        getCfgSubnets4()->updateStatistics(subnet_ids);
+    }
+
+    const SubnetIDSet& kept6 = getCfgSubnets6()->getKeptStatistics();
+    if (kept6.empty()) {
+        getCfgSubnets6()->updateStatistics();
+    } else {
+        SubnetIDSet subnet_ids;
+        for (auto const& subnet : *getCfgSubnets6()->getAll()) {
+            if (!kept6.count(subnet->getID())) {
+                subnet_ids.insert(subnet->getID());
+            }
+        }
+        getCfgSubnets6()->updateStatistics(subnet_ids);
+    }
+}
+
 void
 SrvConfig::applyDefaultsConfiguredGlobals(const SimpleDefaults& defaults) {
     // Code from SimpleParser::setDefaults
@@ -651,6 +651,41 @@ public:
     /// @ref CfgSubnets6::removeStatistics for details.
     void removeStatistics();
 
+    /// @brief Updates statistics after a merge.
+    ///
+    /// Same as @c updateStatistics but only for the subnets of the
+    /// configuration which was merged into this configuration, so a
+    /// configuration backend update does not recount the leases of all
+    /// subnets.
+    ///
+    /// @param other the merged configuration.
+    void updateStatistics(const SrvConfig& other);
+
+    /// @brief Removes statistics before a merge.
+    ///
+    /// Same as @c removeStatistics but only for the subnets the merge
+    /// of the other configuration will replace.
+    ///
+    /// @param other the configuration to be merged.
+    void removeStatistics(const SrvConfig& other);
+
+    /// @brief Removes statistics before a commit.
+    ///
+    /// Same as @c removeStatistics but the statistics of the subnets the
+    /// next configuration keeps (see @c CfgSubnets4::keepStatistics and
+    /// @c CfgSubnets6::keepStatistics) are not removed.
+    ///
+    /// @param next the configuration to be committed.
+    void removeUnkeptStatistics(const SrvConfig& next);
+
+    /// @brief Updates statistics after a commit.
+    ///
+    /// Same as @c updateStatistics but the leases of the subnets with
+    /// kept statistics are not recounted. The global statistics are not
+    /// recounted either when some subnets kept their statistics as the
+    /// lease database did not change.
+    void updateUnkeptStatistics();
+
     /// @brief Sets decline probation-period
     ///
     /// Probation-period is the timer, expressed, in seconds, that specifies how
@@ -937,6 +972,12 @@ public:
 
 private:
 
+    /// @brief Updates the default sample limits of the statistics.
+    ///
+    /// Applies the statistic-default-sample-count and
+    /// statistic-default-sample-age global parameters.
+    void updateSampleLimits();
+
     /// @brief Merges the DHCPv4 configuration specified as a parameter into
     /// this configuration.
     ///
@@ -432,6 +432,89 @@ Subnet::initAllocatorsAfterConfigure() {
     }
 }
 
+bool
+Subnet::carryOverAllocationStates(const Subnet& previous) {
+    if ((getID() != previous.getID()) || (prefix_ != previous.prefix_) ||
+        (prefix_len_ != previous.prefix_len_)) {
+        return (false);
+    }
+    bool carried = false;
+    for (auto const& allocator : allocators_) {
+        Lease::Type type = allocator.first;
+        auto prev_allocator = previous.allocators_.find(type);
+        if ((prev_allocator == previous.allocators_.end()) ||
+            (allocator.second->getType() != prev_allocator->second->getType()) ||
+            (allocator.second->getType() == "shared-flq")) {
+            continue;
+        }
+        auto const& pools = getPools(type);
+        auto const& prev_pools = previous.getPools(type);
+        if (pools.size() != prev_pools.size()) {
+            continue;
+        }
+        bool same_pools = true;
+        for (size_t i = 0; i < pools.size(); ++i) {
+            if ((pools[i]->getFirstAddress() != prev_pools[i]->getFirstAddress()) ||
+                (pools[i]->getLastAddress() != prev_pools[i]->getLastAddress())) {
+                same_pools = false;
+                break;
+            }
+            auto pool6 = boost::dynamic_pointer_cast<Pool6>(pools[i]);
+            auto prev_pool6 = boost::dynamic_pointer_cast<Pool6>(prev_pools[i]);
+            if (pool6 && prev_pool6 &&
+                (pool6->getLength() != prev_pool6->getLength())) {
+                same_pools = false;
+                break;
+            }
+        }
+        if (!same_pools) {
+            continue;
+        }
+        for (size_t i = 0; i < pools.size(); ++i) {
+            if (prev_pools[i]->getAllocationState()) {
+                pools[i]->setAllocationState(prev_pools[i]->getAllocationState());
+            }
+        }
+        auto prev_state = previous.allocation_states_.find(type);
+        if ((prev_state != previous.allocation_states_.end()) &&
+            prev_state->second) {
+            setAllocationState(type, prev_state->second);
+        }
+        carried = true;
+    }
+    return (carried);
+}
+
+bool
+Subnet::samePools(const Subnet& other) const {
+    if ((getID() != other.getID()) || (prefix_ != other.prefix_) ||
+        (prefix_len_ != other.prefix_len_)) {
+        return (false);
+    }
+    auto same = [](const PoolCollection& pools,
+                   const PoolCollection& other_pools) {
+        if (pools.size() != other_pools.size()) {
+            return (false);
+        }
+        for (size_t i = 0; i < pools.size(); ++i) {
+            if ((pools[i]->getType() != other_pools[i]->getType()) ||
+                (pools[i]->getFirstAddress() != other_pools[i]->getFirstAddress()) ||
+                (pools[i]->getLastAddress() != other_pools[i]->getLastAddress()) ||
+                (pools[i]->getID() != other_pools[i]->getID())) {
+                return (false);
+            }
+            auto pool6 = boost::dynamic_pointer_cast<Pool6>(pools[i]);
+            auto other_pool6 = boost::dynamic_pointer_cast<Pool6>(other_pools[i]);
+            if (pool6 && other_pool6 &&
+                (pool6->getLength() != other_pool6->getLength())) {
+                return (false);
+            }
+        }
+        return (true);
+    };
+    return (same(pools_, other.pools_) && same(pools_pd_, other.pools_pd_));
+}
+
 const PoolPtr Subnet::getPool(Lease::Type type,
                               const ClientClasses& client_classes,
                               const isc::asiolink::IOAddress& hint) const {
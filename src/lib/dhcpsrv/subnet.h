@@ -322,6 +322,32 @@ public:
     /// @brief Calls @c initAfterConfigure for each allocator.
     void initAllocatorsAfterConfigure();
 
+    /// @brief Carries over allocation states from a previous instance.
+    ///
+    /// When a subnet is reconfigured without changing its identifier,
+    /// its prefix, its allocator type and its pools, the allocation states
+    /// (e.g. the last allocated addresses or the free lease queues) of the
+    /// previous instance remain valid and are reused instead of being
+    /// rebuilt. States of the shared FLQ allocator are never carried over
+    /// as they depend on the shared network.
+    ///
+    /// This function must be called after @c createAllocators and before
+    /// @c initAllocatorsAfterConfigure.
+    ///
+    /// @param previous the subnet instance from the previous configuration.
+    /// @return true if at least one allocation state was carried over.
+    bool carryOverAllocationStates(const Subnet& previous);
+
+    /// @brief Checks if the subnet has the same pools as another subnet.
+    ///
+    /// The identifiers, the prefixes and the pools (ranges, identifiers
+    /// and delegated lengths) must be the same, so the statistics of
+    /// a subnet are valid for the other one.
+    ///
+    /// @param other the other subnet.
+    /// @return true if the subnets have the same pools.
+    bool samePools(const Subnet& other) const;
+
 protected:
 
     /// @brief Protected constructor.
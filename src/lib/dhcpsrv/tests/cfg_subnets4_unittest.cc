@@ -2459,6 +2459,131 @@ TEST(CfgSubnets4Test, removeStatistics) {
     ASSERT_FALSE(observation);
 }
 
+// This test verifies that the statistics of some subnets can be updated
+// and removed.
+TEST(CfgSubnets4Test, subnetIdsStatistics) {
+    CfgMgr::instance().clear();
+
+    CfgSubnets4Ptr cfg = CfgMgr::instance().getCurrentCfg()->getCfgSubnets4();
+    ObservationPtr observation;
+
+    LeaseMgrFactory::create("type=memfile universe=4 persist=false");
+
+    // remove all statistics
+    StatsMgr::instance().removeAll();
+
+    // Create subnets.
+    Subnet4Ptr subnet1(new Subnet4(IOAddress("192.0.2.0"), 26, 1, 2, 3, 100));
+    Pool4Ptr pool1(new Pool4(IOAddress("192.0.2.0"), 26));
+    subnet1->addPool(pool1);
+    cfg->add(subnet1);
+
+    Subnet4Ptr subnet2(new Subnet4(IOAddress("192.0.3.0"), 26, 1, 2, 3, 200));
+    Pool4Ptr pool2(new Pool4(IOAddress("192.0.3.0"), 26));
+    subnet2->addPool(pool2);
+    cfg->add(subnet2);
+
+    // Add a lease in each subnet, the second one being declined.
+    HWAddrPtr hwaddr(new HWAddr(HWAddr::fromText("01:02:03:04:05:06")));
+    Lease4Ptr lease(new Lease4(IOAddress("192.0.2.1"), hwaddr, ClientIdPtr(),
+                               60, time(0), 100));
+    ASSERT_TRUE(LeaseMgrFactory::instance().addLease(lease));
+    lease.reset(new Lease4(IOAddress("192.0.3.1"), hwaddr, ClientIdPtr(),
+                           60, time(0), 200));
+    lease->state_ = Lease::STATE_DECLINED;
+    ASSERT_TRUE(LeaseMgrFactory::instance().addLease(lease));
+
+    // Update the statistics of the first subnet.
+    cfg->updateStatistics(SubnetIDSet{ 100, 300 });
+
+    observation = StatsMgr::instance().getObservation(
+        StatsMgr::generateName("subnet", 100, "total-addresses"));
+    ASSERT_TRUE(observation);
+    EXPECT_EQ(64, observation->getInteger().first);
+
+    observation = StatsMgr::instance().getObservation(
+        StatsMgr::generateName("subnet", 100, "assigned-addresses"));
+    ASSERT_TRUE(observation);
+    EXPECT_EQ(1, observation->getInteger().first);
+
+    observation = StatsMgr::instance().getObservation(
+        StatsMgr::generateName("subnet", 100,
+                               StatsMgr::generateName("pool", 0, "assigned-addresses")));
+    ASSERT_TRUE(observation);
+    EXPECT_EQ(1, observation->getInteger().first);
+
+    // The other subnet and the global statistics are not updated.
+    EXPECT_FALSE(StatsMgr::instance().getObservation(
+        StatsMgr::generateName("subnet", 200, "total-addresses")));
+    EXPECT_FALSE(StatsMgr::instance().getObservation("assigned-addresses"));
+
+    // Update the statistics of the second subnet.
+    cfg->updateStatistics(SubnetIDSet{ 200 });
+
+    observation = StatsMgr::instance().getObservation(
+        StatsMgr::generateName("subnet", 200, "assigned-addresses"));
+    ASSERT_TRUE(observation);
+    EXPECT_EQ(1, observation->getInteger().first);
+
+    observation = StatsMgr::instance().getObservation(
+        StatsMgr::generateName("subnet", 200, "declined-addresses"));
+    ASSERT_TRUE(observation);
+    EXPECT_EQ(1, observation->getInteger().first);
+
+    observation = StatsMgr::instance().getObservation(
+        StatsMgr::generateName("subnet", 200,
+                               StatsMgr::generateName("pool", 0, "declined-addresses")));
+    ASSERT_TRUE(observation);
+    EXPECT_EQ(1, observation->getInteger().first);
+
+    // Updating again gives the same values.
+    cfg->updateStatistics(SubnetIDSet{ 200 });
+
+    observation = StatsMgr::instance().getObservation(
+        StatsMgr::generateName("subnet", 200,
+                               StatsMgr::generateName("pool", 0, "assigned-addresses")));
+    ASSERT_TRUE(observation);
+    EXPECT_EQ(1, observation->getInteger().first);
+
+    // Remove the statistics of the first subnet.
+    cfg->removeStatistics(SubnetIDSet{ 100 });
+
+    EXPECT_FALSE(StatsMgr::instance().getObservation(
+        StatsMgr::generateName("subnet", 100, "total-addresses")));
+    EXPECT_FALSE(StatsMgr::instance().getObservation(
+        StatsMgr::generateName("subnet", 100,
+                               StatsMgr::generateName("pool", 0, "assigned-addresses"))));
+    EXPECT_TRUE(StatsMgr::instance().getObservation(
+        StatsMgr::generateName("subnet", 200, "total-addresses")));
+
+    StatsMgr::instance().removeAll();
+    LeaseMgrFactory::destroy();
+}
+
+// This test verifies that the subnets replaced by a merge are returned.
+TEST(CfgSubnets4Test, getReplacedSubnetIds) {
+    CfgSubnets4 cfg;
+    Subnet4Ptr subnet1(new Subnet4(IOAddress("192.0.2.0"), 26, 1, 2, 3, 100));
+    Subnet4Ptr subnet2(new Subnet4(IOAddress("192.0.3.0"), 26, 1, 2, 3, 200));
+    Subnet4Ptr subnet3(new Subnet4(IOAddress("192.0.4.0"), 26, 1, 2, 3, 300));
+    cfg.add(subnet1);
+    cfg.add(subnet2);
+    cfg.add(subnet3);
+
+    // The same subnet instance is not replaced.
+    CfgSubnets4 other;
+    other.add(subnet1);
+    EXPECT_TRUE(cfg.getReplacedSubnetIds(other).empty());
+
+    // A subnet with the same id and a subnet with the same prefix.
+    Subnet4Ptr subnet4(new Subnet4(IOAddress("192.0.5.0"), 26, 1, 2, 3, 100));
+    Subnet4Ptr subnet5(new Subnet4(IOAddress("192.0.3.0"), 26, 1, 2, 3, 500));
+    other.clear();
+    other.add(subnet4);
+    other.add(subnet5);
+    EXPECT_EQ((SubnetIDSet{ 100, 200 }), cfg.getReplacedSubnetIds(other));
+}
+
 // This test verifies that in range host reservation works as expected.
 TEST(CfgSubnets4Test, host) {
     // Create a configuration.
@@ -2625,6 +2750,84 @@ TEST(CfgSubnets4Test, initAllocatorsAfterConfigure) {
     EXPECT_EQ(1, allocator2->callcount_);
 }
 
+// This test verifies that the allocation states of the subnets which
+// pools and allocators did not change are carried over.
+TEST(CfgSubnets4Test, carryOverAllocationStates) {
+    CfgSubnets4 previous;
+    CfgSubnets4 cfg;
+
+    // Create a subnet with a pool.
+    auto create = [](uint8_t id, const std::string& last,
+                     const std::string& allocator) {
+        std::string prefix = "192.0." + std::to_string(id) + ".";
+        Subnet4Ptr subnet = Subnet4::create(IOAddress(prefix + "0"), 24,
+                                            1, 2, 3, SubnetID(id));
+        subnet->addPool(Pool4Ptr(new Pool4(IOAddress(prefix + "10"),
+                                           IOAddress(prefix + last))));
+        subnet->setAllocatorType(allocator);
+        subnet->createAllocators();
+        return (subnet);
+    };
+
+    // Subnet 1 does not change, the pool of subnet 2 changes, subnet 3 is
+    // new and subnet 4 uses a different allocator.
+    previous.add(create(1, "20", "iterative"));
+    previous.add(create(2, "20", "iterative"));
+    previous.add(create(4, "20", "iterative"));
+    cfg.add(create(1, "20", "iterative"));
+    cfg.add(create(2, "30", "iterative"));
+    cfg.add(create(3, "20", "iterative"));
+    cfg.add(create(4, "20", "random"));
+
+    EXPECT_EQ(1U, cfg.carryOverAllocationStates(previous));
+
+    // Return the allocation state of the pool of a subnet.
+    auto state = [](const CfgSubnets4& subnets, SubnetID id) {
+        auto subnet = subnets.getBySubnetId(id);
+        return (subnet->getPools(Lease::TYPE_V4)[0]->getAllocationState());
+    };
+    EXPECT_EQ(state(previous, 1), state(cfg, 1));
+    EXPECT_EQ(previous.getBySubnetId(1)->getAllocationState(Lease::TYPE_V4),
+              cfg.getBySubnetId(1)->getAllocationState(Lease::TYPE_V4));
+    EXPECT_NE(state(previous, 2), state(cfg, 2));
+    EXPECT_NE(state(previous, 4), state(cfg, 4));
+}
+
+// This test verifies that the statistics of the subnets which pools did
+// not change are kept.
+TEST(CfgSubnets4Test, keepStatistics) {
+    CfgSubnets4 previous;
+    CfgSubnets4 cfg;
+
+    // Create a subnet with a pool.
+    auto create = [](uint8_t id, const std::string& last, uint64_t pool_id) {
+        std::string prefix = "192.0." + std::to_string(id) + ".";
+        Subnet4Ptr subnet = Subnet4::create(IOAddress(prefix + "0"), 24,
+                                            1, 2, 3, SubnetID(id));
+        Pool4Ptr pool(new Pool4(IOAddress(prefix + "10"),
+                                IOAddress(prefix + last)));
+        pool->setID(pool_id);
+        subnet->addPool(pool);
+        return (subnet);
+    };
+
+    // Subnet 1 does not change, the pool of subnet 2 changes, subnet 3 is
+    // new and the pool of subnet 4 gets another identifier.
+    previous.add(create(1, "20", 0));
+    previous.add(create(2, "20", 0));
+    previous.add(create(4, "20", 0));
+    cfg.add(create(1, "20", 0));
+    cfg.add(create(2, "30", 0));
+    cfg.add(create(3, "20", 0));
+    cfg.add(create(4, "20", 1));
+
+    EXPECT_EQ(1U, cfg.keepStatistics(previous));
+    EXPECT_EQ(SubnetIDSet({ 1 }), cfg.getKeptStatistics());
+
+    cfg.clear();
+    EXPECT_TRUE(cfg.getKeptStatistics().empty());
+}
+
 /// @brief Test fixture for parsing v4 Subnets that can verify log output.
 class Subnet4ParserTest : public LogContentTest {
 public:
@@ -2549,6 +2549,32 @@ TEST(CfgSubnets6Test, removeStatistics) {
     ASSERT_FALSE(observation);
 }
 
+// This test verifies that the subnets replaced by a merge are returned.
+TEST(CfgSubnets6Test, getReplacedSubnetIds) {
+    CfgSubnets6 cfg;
+    Subnet6Ptr subnet1(new Subnet6(IOAddress("2001:db8:1::"), 48, 1, 2, 3, 4,
+                                   100));
+    Subnet6Ptr subnet2(new Subnet6(IOAddress("2001:db8:2::"), 48, 1, 2, 3, 4,
+                                   200));
+    cfg.add(subnet1);
+    cfg.add(subnet2);
+
+    // The same subnet instance is not replaced.
+    CfgSubnets6 other;
+    other.add(subnet1);
+    EXPECT_TRUE(cfg.getReplacedSubnetIds(other).empty());
+
+    // A subnet with the same id and a subnet with the same prefix.
+    Subnet6Ptr subnet3(new Subnet6(IOAddress("2001:db8:3::"), 48, 1, 2, 3, 4,
+                                   100));
+    Subnet6Ptr subnet4(new Subnet6(IOAddress("2001:db8:2::"), 48, 1, 2, 3, 4,
+                                   400));
+    other.clear();
+    other.add(subnet3);
+    other.add(subnet4);
+    EXPECT_EQ((SubnetIDSet{ 100, 200 }), cfg.getReplacedSubnetIds(other));
+}
+
 // This test verifies that in range host reservation works as expected.
 TEST(CfgSubnets6Test, hostNA) {
     // Create a configuration.
@@ -563,6 +563,55 @@ TEST_F(CfgMgrTest, commitStats4) {
     EXPECT_EQ(0, total_addrs->getInteger().first);
 }
 
+// This test verifies that the statistics of the subnets the committed
+// configuration keeps are neither removed nor recounted.
+TEST_F(CfgMgrTest, commitKeptStats4) {
+    CfgMgr& cfg_mgr = CfgMgr::instance();
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    startBackend(AF_INET);
+
+    // Let's prepare the "old" configuration: subnets with id 123 and 124
+    // and pretend there were addresses assigned, so statistics are non-zero.
+    Subnet4Ptr subnet1(new Subnet4(IOAddress("192.1.2.0"), 24, 1, 2, 3, 123));
+    subnet1->addPool(PoolPtr(new Pool4(IOAddress("192.1.2.0"), 26)));
+    Subnet4Ptr subnet2(new Subnet4(IOAddress("192.1.3.0"), 24, 1, 2, 3, 124));
+    subnet2->addPool(PoolPtr(new Pool4(IOAddress("192.1.3.0"), 26)));
+    CfgSubnets4Ptr subnets = cfg_mgr.getStagingCfg()->getCfgSubnets4();
+    subnets->add(subnet1);
+    subnets->add(subnet2);
+    cfg_mgr.commit();
+    stats_mgr.setValue("subnet[123].assigned-addresses", static_cast<int64_t>(50));
+    stats_mgr.setValue("subnet[124].assigned-addresses", static_cast<int64_t>(50));
+
+    // The new configuration keeps subnet 123 and changes the pool of
+    // subnet 124.
+    Subnet4Ptr subnet3(new Subnet4(IOAddress("192.1.2.0"), 24, 1, 2, 3, 123));
+    subnet3->addPool(PoolPtr(new Pool4(IOAddress("192.1.2.0"), 26)));
+    Subnet4Ptr subnet4(new Subnet4(IOAddress("192.1.3.0"), 24, 1, 2, 3, 124));
+    subnet4->addPool(PoolPtr(new Pool4(IOAddress("192.1.3.0"), 25)));
+    subnets = cfg_mgr.getStagingCfg()->getCfgSubnets4();
+    subnets->add(subnet3);
+    subnets->add(subnet4);
+    EXPECT_EQ(1U, subnets->keepStatistics(*cfg_mgr.getCurrentCfg()->getCfgSubnets4()));
+    cfg_mgr.commit();
+
+    // The statistics of subnet 123 were kept.
+    ObservationPtr stat = stats_mgr.getObservation("subnet[123].assigned-addresses");
+    ASSERT_TRUE(stat);
+    EXPECT_EQ(50, stat->getInteger().first);
+    stat = stats_mgr.getObservation("subnet[123].pool[0].total-addresses");
+    ASSERT_TRUE(stat);
+    EXPECT_EQ(64, stat->getInteger().first);
+
+    // The statistics of subnet 124 were recounted.
+    stat = stats_mgr.getObservation("subnet[124].assigned-addresses");
+    ASSERT_TRUE(stat);
+    EXPECT_EQ(0, stat->getInteger().first);
+    stat = stats_mgr.getObservation("subnet[124].total-addresses");
+    ASSERT_TRUE(stat);
+    EXPECT_EQ(128, stat->getInteger().first);
+}
+
 // This test verifies that once the configuration is merged into the current
 // configuration, statistics are updated appropriately.
 TEST_F(CfgMgrTest, mergeIntoCurrentStats4) {
@@ -68,6 +68,9 @@ public:
 
     /// @brief test client class guards.
     void testClientClassGuards();
+
+    /// @brief test carried over pool state.
+    void testCarriedOverState();
 };
 
 // Test that the allocator returns the correct type.
@@ -104,6 +107,7 @@ FreeLeaseQueueAllocatorTest4::testPopulateFreeAddressLeases() {
     auto pool_state = boost::dynamic_pointer_cast<PoolFreeLeaseQueueAllocationState>(pool_->getAllocationState());
     ASSERT_TRUE(pool_state);
     EXPECT_FALSE(pool_state->exhausted());
+    EXPECT_TRUE(pool_state->isPopulated());
 
     double r = alloc.getOccupancyRate(IOAddress("192.0.2.101"), cc_);
     EXPECT_EQ(.6, r);
@@ -528,6 +532,37 @@ TEST_F(FreeLeaseQueueAllocatorTest4, clientClassGuardsMultiThreading) {
     testClientClassGuards();
 }
 
+// Test that a populated pool state, e.g. carried over from the previous
+// configuration, is not populated again but is still kept up to date.
+void
+FreeLeaseQueueAllocatorTest4::testCarriedOverState() {
+    auto& lease_mgr = LeaseMgrFactory::instance();
+    EXPECT_TRUE(lease_mgr.addLease(createLease4(IOAddress("192.0.2.100"), 0)));
+
+    // Simulate a carried over state with only one free lease.
+    auto pool_state = PoolFreeLeaseQueueAllocationState::create(pool_);
+    pool_state->addFreeLease(IOAddress("192.0.2.105"));
+    pool_state->setPopulated();
+    pool_->setAllocationState(pool_state);
+
+    FreeLeaseQueueAllocator alloc(Lease::TYPE_V4, subnet_);
+    ASSERT_NO_THROW(alloc.initAfterConfigure());
+    EXPECT_EQ(1U, pool_state->getFreeLeaseCount());
+
+    // The callbacks must be installed.
+    EXPECT_TRUE(lease_mgr.addLease(createLease4(IOAddress("192.0.2.105"), 1)));
+    EXPECT_TRUE(pool_state->exhausted());
+}
+
+TEST_F(FreeLeaseQueueAllocatorTest4, carriedOverState) {
+    testCarriedOverState();
+}
+
+TEST_F(FreeLeaseQueueAllocatorTest4, carriedOverStateMultiThreading) {
+    MultiThreadingTest mt(true);
+    testCarriedOverState();
+}
+
 /// @brief Test fixture class for the DHCPv6 Free Lease Queue allocator.
 class FreeLeaseQueueAllocatorTest6 : public AllocEngine6Test {
 public:
@@ -0,0 +1,427 @@
+// Copyright (C) 2026 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcpsrv/host_data_source_factory.h>
+#include <dhcpsrv/host_lookup_cache.h>
+#include <dhcpsrv/host_mgr.h>
+#include <dhcpsrv/testutils/host_data_source_utils.h>
+#include <dhcpsrv/testutils/memory_host_data_source.h>
+#include <exceptions/exceptions.h>
+#include <stats/stats_mgr.h>
+
+#include <gtest/gtest.h>
+
+using namespace std;
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::db;
+using namespace isc::dhcp;
+using namespace isc::dhcp::test;
+using namespace isc::stats;
+
+namespace {
+
+/// @brief Host lookup cache with a controllable clock.
+class NakedHostLookupCache : public HostLookupCache {
+public:
+
+    /// @brief Constructor.
+    NakedHostLookupCache(size_t capacity, uint32_t ttl, uint32_t negative_ttl,
+                         bool admission = false, size_t stripes = 1)
+        : HostLookupCache(capacity, ttl, negative_ttl, admission, stripes),
+          now_(Clock::now()) {
+    }
+
+    /// @brief Returns the fake current time.
+    virtual TimePoint now() const {
+        return (now_);
+    }
+
+    /// @brief Fake current time.
+    TimePoint now_;
+};
+
+/// @brief Test data source class.
+class TestHostDataSource : public MemHostDataSource {
+public:
+
+    /// Constructor
+    TestHostDataSource() : lookups_(0) { }
+
+    /// Destructor
+    virtual ~TestHostDataSource() { }
+
+    /// Counted lookup
+    ConstHostPtr get4(const SubnetID& subnet_id,
+                      const Host::IdentifierType& identifier_type,
+                      const uint8_t* identifier_begin,
+                      const size_t identifier_len) const {
+        ++lookups_;
+        return (MemHostDataSource::get4(subnet_id, identifier_type,
+                                        identifier_begin, identifier_len));
+    }
+
+    /// Avoid hiding the other get4.
+    using MemHostDataSource::get4;
+
+    /// Type
+    string getType() const {
+        return ("test");
+    }
+
+    /// Lookup counter
+    mutable size_t lookups_;
+};
+
+/// @brief TestHostDataSource pointer type
+typedef boost::shared_ptr<TestHostDataSource> TestHostDataSourcePtr;
+
+/// @brief Test fixture for the host lookup cache.
+class HostLookupCacheTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    HostLookupCacheTest() {
+        StatsMgr::instance().removeAll();
+        HostMgr::instance().setLookupCache(HostLookupCachePtr());
+        HostMgr::create();
+        host_ = HostDataSourceUtils::initializeHost4("192.0.2.1",
+                                                     Host::IDENT_HWADDR);
+    }
+
+    /// @brief Destructor.
+    virtual ~HostLookupCacheTest() {
+        HostMgr::instance().setLookupCache(HostLookupCachePtr());
+        HostMgr::create();
+        HostDataSourceFactory::deregisterFactory("test");
+        StatsMgr::instance().removeAll();
+    }
+
+    /// @brief Returns the IPv4 lookup key of a host.
+    ///
+    /// @param host The host.
+    /// @return the key of the IPv4 lookup of the host.
+    static HostLookupKey key4(const ConstHostPtr& host) {
+        return (HostLookupKey(host->getIPv4SubnetID(), false,
+                              host->getIdentifierType(),
+                              &host->getIdentifier()[0],
+                              host->getIdentifier().size()));
+    }
+
+    /// @brief Returns the value of a statistic.
+    ///
+    /// @param kind Kind of statistic.
+    /// @param identifier_type Identifier type.
+    /// @return the value or 0 when the statistic does not exist.
+    static int64_t getStat(const string& kind,
+                           const Host::IdentifierType& identifier_type) {
+        ObservationPtr stat = StatsMgr::instance().getObservation(
+            HostLookupCache::statName(kind, identifier_type));
+        return (stat ? stat->getInteger().first : 0);
+    }
+
+    /// @brief Host used by tests.
+    HostPtr host_;
+};
+
+// Check the constructor.
+TEST_F(HostLookupCacheTest, constructor) {
+    EXPECT_THROW(HostLookupCache(0, 0, 0), BadValue);
+
+    HostLookupCache cache(100, 60, 10, true);
+    EXPECT_EQ(100U, cache.getCapacity());
+    EXPECT_EQ(60U, cache.getTTL());
+    EXPECT_EQ(10U, cache.getNegativeTTL());
+    EXPECT_TRUE(cache.getAdmission());
+    EXPECT_EQ(HostLookupCache::DEFAULT_STRIPES, cache.getStripes());
+    EXPECT_EQ(0U, cache.size());
+
+    // The number of stripes is a power of two not larger than the capacity.
+    EXPECT_EQ(2U, HostLookupCache(3, 0, 0, false, 16).getStripes());
+    EXPECT_EQ(4U, HostLookupCache(100, 0, 0, false, 3).getStripes());
+
+    EXPECT_EQ("host-lookup-cache-hits-hw-address",
+              HostLookupCache::statName("hits", Host::IDENT_HWADDR));
+}
+
+// Check positive and negative answers and statistics.
+TEST_F(HostLookupCacheTest, getInsert) {
+    HostLookupCache cache(10, 0, 60);
+    ConstHostPtr got;
+    EXPECT_FALSE(cache.get(key4(host_), got));
+
+    // Statistics are published on demand.
+    EXPECT_EQ(0, getStat("misses", Host::IDENT_HWADDR));
+    cache.publishStatistics();
+    EXPECT_EQ(1, getStat("misses", Host::IDENT_HWADDR));
+
+    cache.insert(key4(host_), host_);
+    EXPECT_EQ(1U, cache.size());
+    ASSERT_TRUE(cache.get(key4(host_), got));
+    EXPECT_EQ(host_, got);
+    cache.publishStatistics();
+    EXPECT_EQ(1, getStat("hits", Host::IDENT_HWADDR));
+    EXPECT_EQ(1, getStat("misses", Host::IDENT_HWADDR));
+
+    // Replace by a negative answer.
+    cache.insert(key4(host_), ConstHostPtr());
+    EXPECT_EQ(1U, cache.size());
+    ASSERT_TRUE(cache.get(key4(host_), got));
+    EXPECT_FALSE(got);
+    cache.publishStatistics();
+    EXPECT_EQ(2, getStat("hits", Host::IDENT_HWADDR));
+
+    // Other subnet or family are other keys.
+    HostLookupKey other(SubnetID(1000), false, Host::IDENT_HWADDR,
+                        &host_->getIdentifier()[0],
+                        host_->getIdentifier().size());
+    EXPECT_FALSE(cache.get(other, got));
+    HostLookupKey v6(host_->getIPv4SubnetID(), true, Host::IDENT_HWADDR,
+                     &host_->getIdentifier()[0],
+                     host_->getIdentifier().size());
+    EXPECT_FALSE(cache.get(v6, got));
+
+    cache.clear();
+    EXPECT_EQ(0U, cache.size());
+}
+
+// Check negative answers are not cached with a 0 negative TTL.
+TEST_F(HostLookupCacheTest, noNegative) {
+    HostLookupCache cache(10, 0, 0);
+    cache.insert(key4(host_), ConstHostPtr());
+    EXPECT_EQ(0U, cache.size());
+
+    // A negative answer removes a stale positive one.
+    cache.insert(key4(host_), host_);
+    EXPECT_EQ(1U, cache.size());
+    cache.insert(key4(host_), ConstHostPtr());
+    EXPECT_EQ(0U, cache.size());
+}
+
+// Check expiration.
+TEST_F(HostLookupCacheTest, ttl) {
+    NakedHostLookupCache cache(10, 60, 5);
+    HostPtr other = HostDataSourceUtils::initializeHost4("192.0.2.2",
+                                                         Host::IDENT_DUID);
+    cache.insert(key4(host_), host_);
+    cache.insert(key4(other), ConstHostPtr());
+    ConstHostPtr got;
+    EXPECT_TRUE(cache.get(key4(host_), got));
+    EXPECT_TRUE(cache.get(key4(other), got));
+
+    // Negative answer expires first.
+    cache.now_ += chrono::seconds(5);
+    EXPECT_TRUE(cache.get(key4(host_), got));
+    EXPECT_FALSE(cache.get(key4(other), got));
+    EXPECT_EQ(1U, cache.size());
+    cache.publishStatistics();
+    EXPECT_EQ(1, getStat("misses", Host::IDENT_DUID));
+
+    cache.now_ += chrono::seconds(55);
+    EXPECT_FALSE(cache.get(key4(host_), got));
+    EXPECT_EQ(0U, cache.size());
+}
+
+// Check least-recently-used eviction.
+TEST_F(HostLookupCacheTest, lru) {
+    HostLookupCache cache(2, 0, 60, false, 1);
+    HostPtr host2 = HostDataSourceUtils::initializeHost4("192.0.2.2",
+                                                         Host::IDENT_HWADDR);
+    HostPtr host3 = HostDataSourceUtils::initializeHost4("192.0.2.3",
+                                                         Host::IDENT_HWADDR);
+    cache.insert(key4(host_), host_);
+    cache.insert(key4(host2), host2);
+
+    // Use the first one so the second is the least recently used.
+    ConstHostPtr got;
+    EXPECT_TRUE(cache.get(key4(host_), got));
+    cache.insert(key4(host3), host3);
+    EXPECT_EQ(2U, cache.size());
+    cache.publishStatistics();
+    EXPECT_EQ(1, getStat("evictions", Host::IDENT_HWADDR));
+    EXPECT_TRUE(cache.get(key4(host_), got));
+    EXPECT_FALSE(cache.get(key4(host2), got));
+    EXPECT_TRUE(cache.get(key4(host3), got));
+}
+
+// Check admission control.
+TEST_F(HostLookupCacheTest, admission) {
+    HostLookupCache cache(10, 0, 60, true);
+    cache.insert(key4(host_), host_);
+    EXPECT_EQ(0U, cache.size());
+    cache.insert(key4(host_), host_);
+    EXPECT_EQ(1U, cache.size());
+    ConstHostPtr got;
+    EXPECT_TRUE(cache.get(key4(host_), got));
+}
+
+// Check invalidation.
+TEST_F(HostLookupCacheTest, invalidate) {
+    HostLookupCache cache(10, 0, 60);
+    cache.insert(key4(host_), host_);
+    cache.invalidate(key4(host_));
+    EXPECT_EQ(0U, cache.size());
+
+    cache.insert(key4(host_), ConstHostPtr());
+    cache.invalidate(host_);
+    EXPECT_EQ(0U, cache.size());
+
+    // By address only positive entries match.
+    cache.insert(key4(host_), host_);
+    cache.invalidate(host_->getIPv4SubnetID(), IOAddress("192.0.2.2"));
+    EXPECT_EQ(1U, cache.size());
+    cache.invalidate(host_->getIPv4SubnetID(), IOAddress("192.0.2.1"));
+    EXPECT_EQ(0U, cache.size());
+
+    // IPv6 reservations.
+    HostPtr host6 = HostDataSourceUtils::initializeHost6("2001:db8::1",
+                                                         Host::IDENT_DUID,
+                                                         false);
+    HostLookupKey key6(host6->getIPv6SubnetID(), true,
+                       host6->getIdentifierType(),
+                       &host6->getIdentifier()[0],
+                       host6->getIdentifier().size());
+    cache.insert(key6, host6);
+    cache.invalidate(host6->getIPv6SubnetID(), IOAddress("2001:db8::1"));
+    EXPECT_EQ(0U, cache.size());
+
+    // An address only matches entries of its family.
+    HostLookupKey v6(host_->getIPv4SubnetID(), true,
+                     host_->getIdentifierType(),
+                     &host_->getIdentifier()[0],
+                     host_->getIdentifier().size());
+    cache.insert(v6, host_);
+    cache.invalidate(host_->getIPv4SubnetID(), IOAddress("192.0.2.1"));
+    EXPECT_EQ(1U, cache.size());
+
+    // A matching entry also removes the entries of the other family.
+    cache.insert(key4(host_), host_);
+    EXPECT_EQ(2U, cache.size());
+    HostLookupKey other6(host_->getIPv6SubnetID(), true,
+                         host_->getIdentifierType(),
+                         &host_->getIdentifier()[0],
+                         host_->getIdentifier().size());
+    cache.insert(other6, host_);
+    EXPECT_EQ(3U, cache.size());
+    cache.invalidate(host_->getIPv4SubnetID(), IOAddress("192.0.2.1"));
+    EXPECT_EQ(1U, cache.size());
+    ConstHostPtr got;
+    EXPECT_TRUE(cache.get(v6, got));
+}
+
+// Check answers which may predate an invalidation are not inserted.
+TEST_F(HostLookupCacheTest, generation) {
+    HostLookupCache cache(10, 0, 60, false, 1);
+    ConstHostPtr got;
+    uint64_t generation = 0;
+    EXPECT_FALSE(cache.get(key4(host_), got, generation));
+    EXPECT_TRUE(cache.insert(key4(host_), ConstHostPtr(), generation));
+    EXPECT_EQ(1U, cache.size());
+
+    // A concurrent add invalidates the key while the backends are queried:
+    // the negative answer they returned must not be inserted.
+    cache.invalidate(key4(host_));
+    EXPECT_FALSE(cache.get(key4(host_), got, generation));
+    cache.invalidate(host_);
+    EXPECT_FALSE(cache.insert(key4(host_), ConstHostPtr(), generation));
+    EXPECT_EQ(0U, cache.size());
+    EXPECT_FALSE(cache.get(key4(host_), got, generation));
+    EXPECT_TRUE(cache.insert(key4(host_), host_, generation));
+    EXPECT_EQ(1U, cache.size());
+
+    // Same for an address based delete and a clear.
+    cache.invalidate(SubnetID(1000), IOAddress("192.0.2.100"));
+    EXPECT_FALSE(cache.insert(key4(host_), host_, generation));
+    EXPECT_TRUE(cache.get(key4(host_), got, generation));
+    cache.clear();
+    EXPECT_FALSE(cache.insert(key4(host_), host_, generation));
+    EXPECT_EQ(0U, cache.size());
+}
+
+// Check the host manager uses the lookup cache.
+TEST_F(HostLookupCacheTest, hostMgr) {
+    TestHostDataSourcePtr memptr(new TestHostDataSource());
+    auto testFactory = [memptr](const DatabaseConnection::ParameterMap&) {
+        return (memptr);
+    };
+    HostDataSourceFactory::registerFactory("test", testFactory);
+    HostMgr::addBackend("type=test");
+    HostLookupCachePtr cache(new HostLookupCache(10, 0, 60));
+    HostMgr::instance().setLookupCache(cache);
+    HostMgr& mgr = HostMgr::instance();
+
+    const SubnetID& subnet_id = host_->getIPv4SubnetID();
+    const vector<uint8_t>& id = host_->getIdentifier();
+
+    // Not found: the negative answer is cached.
+    EXPECT_FALSE(mgr.get4(subnet_id, Host::IDENT_HWADDR, &id[0], id.size()));
+    EXPECT_EQ(1U, memptr->lookups_);
+    EXPECT_FALSE(mgr.get4(subnet_id, Host::IDENT_HWADDR, &id[0], id.size()));
+    EXPECT_EQ(1U, memptr->lookups_);
+
+    // Adding the host through the host manager invalidates it.
+    mgr.add(host_);
+    ConstHostPtr got = mgr.get4(subnet_id, Host::IDENT_HWADDR, &id[0],
+                                id.size());
+    ASSERT_TRUE(got);
+    EXPECT_EQ(2U, memptr->lookups_);
+    got = mgr.get4(subnet_id, Host::IDENT_HWADDR, &id[0], id.size());
+    ASSERT_TRUE(got);
+    EXPECT_EQ(2U, memptr->lookups_);
+
+    // Deleting the host through the host manager invalidates it too.
+    EXPECT_TRUE(mgr.del4(subnet_id, Host::IDENT_HWADDR, &id[0], id.size()));
+    EXPECT_FALSE(mgr.get4(subnet_id, Host::IDENT_HWADDR, &id[0], id.size()));
+    EXPECT_EQ(3U, memptr->lookups_);
+
+    // The cache survives to the host manager recreation but is flushed.
+    EXPECT_EQ(1U, cache->size());
+    HostMgr::create();
+    EXPECT_EQ(cache, HostMgr::instance().getLookupCache());
+    EXPECT_EQ(0U, cache->size());
+}
+
+// Check deleting a host by identifier invalidates the lookups of both
+// families.
+TEST_F(HostLookupCacheTest, hostMgrDelBothFamilies) {
+    TestHostDataSourcePtr memptr(new TestHostDataSource());
+    auto testFactory = [memptr](const DatabaseConnection::ParameterMap&) {
+        return (memptr);
+    };
+    HostDataSourceFactory::registerFactory("test", testFactory);
+    HostMgr::addBackend("type=test");
+    HostLookupCachePtr cache(new HostLookupCache(10, 0, 60));
+    HostMgr::instance().setLookupCache(cache);
+    HostMgr& mgr = HostMgr::instance();
+    mgr.add(host_);
+
+    const SubnetID& subnet4_id = host_->getIPv4SubnetID();
+    const SubnetID& subnet6_id = host_->getIPv6SubnetID();
+    const vector<uint8_t>& id = host_->getIdentifier();
+
+    // Cache the IPv4 and IPv6 lookups.
+    EXPECT_TRUE(mgr.get4(subnet4_id, Host::IDENT_HWADDR, &id[0], id.size()));
+    EXPECT_TRUE(mgr.get6(subnet6_id, Host::IDENT_HWADDR, &id[0], id.size()));
+    EXPECT_EQ(2U, cache->size());
+
+    // The IPv4 delete removes the whole host so both entries must go.
+    EXPECT_TRUE(mgr.del4(subnet4_id, Host::IDENT_HWADDR, &id[0], id.size()));
+    EXPECT_EQ(0U, cache->size());
+    EXPECT_FALSE(mgr.get6(subnet6_id, Host::IDENT_HWADDR, &id[0], id.size()));
+
+    // Same with the IPv6 delete.
+    mgr.add(host_);
+    EXPECT_TRUE(mgr.get4(subnet4_id, Host::IDENT_HWADDR, &id[0], id.size()));
+    EXPECT_TRUE(mgr.get6(subnet6_id, Host::IDENT_HWADDR, &id[0], id.size()));
+    EXPECT_EQ(2U, cache->size());
+    EXPECT_TRUE(mgr.del6(subnet6_id, Host::IDENT_HWADDR, &id[0], id.size()));
+    EXPECT_EQ(0U, cache->size());
+    EXPECT_FALSE(mgr.get4(subnet4_id, Host::IDENT_HWADDR, &id[0], id.size()));
+}
+
+} // end of anonymous namespace
@@ -13,6 +13,7 @@
 #include <dhcpsrv/host_data_source_factory.h>
 #include <dhcpsrv/host_mgr.h>
 #include <dhcpsrv/testutils/generic_host_data_source_unittest.h>
+#include <dhcpsrv/testutils/memory_host_data_source.h>
 #include <testutils/gtest_utils.h>
 
 #include <gtest/gtest.h>
@@ -206,4 +207,101 @@ TEST_F(HostMgrTest, noDataSource) {
                      "configured.");
 }
 
+/// @brief Test data source counting the lookups by identifier.
+class CountingHostDataSource : public MemHostDataSource {
+public:
+
+    /// @brief Constructor.
+    CountingHostDataSource() : lookups_(0), batches_(0) { }
+
+    /// @brief Counted lookup.
+    virtual ConstHostPtr get4(const SubnetID& subnet_id,
+                              const Host::IdentifierType& identifier_type,
+                              const uint8_t* identifier_begin,
+                              const size_t identifier_len) const {
+        ++lookups_;
+        return (MemHostDataSource::get4(subnet_id, identifier_type,
+                                        identifier_begin, identifier_len));
+    }
+
+    /// Avoid hiding the other get4.
+    using MemHostDataSource::get4;
+
+    /// @brief Counted batch of lookups.
+    virtual ConstHostCollection
+    getByIdentifiers4(const SubnetID& subnet_id,
+                      const HostIdentifierList& identifiers) const {
+        ++batches_;
+        return (MemHostDataSource::getByIdentifiers4(subnet_id, identifiers));
+    }
+
+    /// @brief Type.
+    virtual std::string getType() const {
+        return ("test");
+    }
+
+    /// @brief Number of lookups.
+    mutable size_t lookups_;
+
+    /// @brief Number of batches.
+    mutable size_t batches_;
+};
+
+// This test verifies that HostMgr looks up several identifiers in one
+// batch and keeps the order of preference.
+TEST_F(HostMgrTest, get4Identifiers) {
+    boost::shared_ptr<CountingHostDataSource> source(new CountingHostDataSource());
+    HostDataSourceFactory::registerFactory("test",
+        [source](const DatabaseConnection::ParameterMap&) {
+            return (source);
+        });
+    HostMgr::addBackend("type=test");
+    HostMgr& mgr = HostMgr::instance();
+
+    std::vector<uint8_t> hwaddr = hwaddrs_[0]->hwaddr_;
+    std::vector<uint8_t> duid = duids_[0]->getDuid();
+    HostIdentifierList identifiers;
+    identifiers.push_back(HostIdentifierPair(Host::IDENT_HWADDR, hwaddr));
+    identifiers.push_back(HostIdentifierPair(Host::IDENT_DUID, duid));
+
+    // No host at all: the backend gets one batch.
+    EXPECT_FALSE(mgr.get4(SubnetID(1), identifiers));
+    EXPECT_EQ(1U, source->batches_);
+    EXPECT_EQ(2U, source->lookups_);
+
+    // The host reserved for the less preferred identifier is found.
+    HostPtr host_duid(new Host(&duid[0], duid.size(), Host::IDENT_DUID,
+                               SubnetID(1), SUBNET_ID_UNUSED,
+                               IOAddress("192.0.2.6")));
+    mgr.add(host_duid, HostMgrOperationTarget::ALTERNATE_SOURCES);
+    ConstHostPtr host = mgr.get4(SubnetID(1), identifiers);
+    ASSERT_TRUE(host);
+    EXPECT_EQ(Host::IDENT_DUID, host->getIdentifierType());
+    EXPECT_EQ(2U, source->batches_);
+
+    // A host in the configuration file for the less preferred identifier
+    // does not hide the backend host of the preferred one.
+    HostPtr host_hwaddr(new Host(&hwaddr[0], hwaddr.size(), Host::IDENT_HWADDR,
+                                 SubnetID(1), SUBNET_ID_UNUSED,
+                                 IOAddress("192.0.2.5")));
+    mgr.add(host_hwaddr, HostMgrOperationTarget::ALTERNATE_SOURCES);
+    mgr.del4(SubnetID(1), Host::IDENT_DUID, &duid[0], duid.size(),
+             HostMgrOperationTarget::ALTERNATE_SOURCES);
+    mgr.add(host_duid, HostMgrOperationTarget::PRIMARY_SOURCE);
+    host = mgr.get4(SubnetID(1), identifiers);
+    ASSERT_TRUE(host);
+    EXPECT_EQ(Host::IDENT_HWADDR, host->getIdentifierType());
+    EXPECT_EQ(3U, source->batches_);
+
+    // A host in the configuration file for the preferred identifier
+    // is returned without querying the backend.
+    identifiers.reverse();
+    host = mgr.get4(SubnetID(1), identifiers);
+    ASSERT_TRUE(host);
+    EXPECT_EQ(Host::IDENT_DUID, host->getIdentifierType());
+    EXPECT_EQ(3U, source->batches_);
+
+    HostDataSourceFactory::deregisterFactory("test");
+}
+
 }  // namespace
@@ -1118,6 +1118,19 @@ TEST_F(MemfileLeaseMgrTest, basicLease4MultiThread) {
     testBasicLease4();
 }
 
+/// @brief Checks the batch operations on IPv4 leases.
+TEST_F(MemfileLeaseMgrTest, batchLease4) {
+    startBackend(V4);
+    testBatchLease4();
+}
+
+/// @brief Checks the batch operations on IPv4 leases.
+TEST_F(MemfileLeaseMgrTest, batchLease4MultiThread) {
+    startBackend(V4);
+    MultiThreadingMgr::instance().setMode(true);
+    testBatchLease4();
+}
+
 /// @todo Write more memfile tests
 
 /// @brief Simple test about lease4 retrieval through client id method
@@ -1309,6 +1322,19 @@ TEST_F(MemfileLeaseMgrTest, getLeases4PagedMultiThread) {
     testGetLeases4Paged();
 }
 
+/// @brief Test that all IPv4 leases can be visited.
+TEST_F(MemfileLeaseMgrTest, visitLeases4) {
+    startBackend(V4);
+    testVisitLeases4();
+}
+
+/// @brief Test that all IPv4 leases can be visited.
+TEST_F(MemfileLeaseMgrTest, visitLeases4MultiThread) {
+    startBackend(V4);
+    MultiThreadingMgr::instance().setMode(true);
+    testVisitLeases4();
+}
+
 /// @brief This test checks that all IPv4 leases with a state are returned.
 TEST_F(MemfileLeaseMgrTest, getLeases4State) {
     startBackend(V4);
@@ -1416,6 +1442,19 @@ TEST_F(MemfileLeaseMgrTest, getLeases6PagedMultiThread) {
     testGetLeases6Paged();
 }
 
+/// @brief Test that all IPv6 leases can be visited.
+TEST_F(MemfileLeaseMgrTest, visitLeases6) {
+    startBackend(V6);
+    testVisitLeases6();
+}
+
+/// @brief Test that all IPv6 leases can be visited.
+TEST_F(MemfileLeaseMgrTest, visitLeases6MultiThread) {
+    startBackend(V6);
+    MultiThreadingMgr::instance().setMode(true);
+    testVisitLeases6();
+}
+
 /// @brief Basic Lease6 Checks
 ///
 /// Checks that the addLease, getLease6 (by address) and deleteLease (with an
@@ -1432,6 +1471,19 @@ TEST_F(MemfileLeaseMgrTest, basicLease6MultiThread) {
     testBasicLease6();
 }
 
+/// @brief Checks the batch operations on IPv6 leases.
+TEST_F(MemfileLeaseMgrTest, batchLease6) {
+    startBackend(V6);
+    testBatchLease6();
+}
+
+/// @brief Checks the batch operations on IPv6 leases.
+TEST_F(MemfileLeaseMgrTest, batchLease6MultiThread) {
+    startBackend(V6);
+    MultiThreadingMgr::instance().setMode(true);
+    testBatchLease6();
+}
+
 /// @brief Check GetLease6 methods - access by DUID/IAID
 ///
 /// Adds leases to the database and checks that they can be accessed via
@@ -81,6 +81,13 @@ ConcreteLeaseMgr::getLeases4(const IOAddress& /* lower_bound_address */,
     return (Lease4Collection());
 }
 
+Lease4Collection
+ConcreteLeaseMgr::getLeases4(SubnetID /* subnet_id */,
+                             const IOAddress& /* lower_bound_address */,
+                             const LeasePageSize& /* page_size */) const {
+    return (Lease4Collection());
+}
+
 Lease4Collection
 ConcreteLeaseMgr::getLeases4(uint32_t /* state */,
                              SubnetID /* subnet_id */) const {
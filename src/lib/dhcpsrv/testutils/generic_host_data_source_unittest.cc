@@ -1357,6 +1357,53 @@ GenericHostDataSourceTest::testGet4ByIdentifier(
     HostDataSourceUtils::compareHosts(host2, from_hds2);
 }
 
+void
+GenericHostDataSourceTest::testGetByIdentifiers() {
+    // Make sure we have a pointer to the host data source.
+    ASSERT_TRUE(hdsptr_);
+
+    // Create two hosts in the same subnet with different identifier types.
+    HostPtr host1 = HostDataSourceUtils::initializeHost4("192.0.2.1", Host::IDENT_HWADDR);
+    HostPtr host2 = HostDataSourceUtils::initializeHost4("192.0.2.2", Host::IDENT_DUID);
+    host2->setIPv4SubnetID(host1->getIPv4SubnetID());
+    ASSERT_NO_THROW(hdsptr_->add(host1));
+    ASSERT_NO_THROW(hdsptr_->add(host2));
+
+    // The answers are in the order of the identifiers.
+    HostIdentifierList identifiers;
+    identifiers.push_back(HostIdentifierPair(Host::IDENT_CIRCUIT_ID,
+                                             std::vector<uint8_t>(4, 1)));
+    identifiers.push_back(HostIdentifierPair(Host::IDENT_DUID,
+                                             host2->getIdentifier()));
+    identifiers.push_back(HostIdentifierPair(Host::IDENT_HWADDR,
+                                             host1->getIdentifier()));
+    ConstHostCollection from_hds;
+    ASSERT_NO_THROW(from_hds = hdsptr_->getByIdentifiers4(host1->getIPv4SubnetID(),
+                                                          identifiers));
+    ASSERT_EQ(3U, from_hds.size());
+    EXPECT_FALSE(from_hds[0]);
+    ASSERT_TRUE(from_hds[1]);
+    HostDataSourceUtils::compareHosts(host2, from_hds[1]);
+    ASSERT_TRUE(from_hds[2]);
+    HostDataSourceUtils::compareHosts(host1, from_hds[2]);
+
+    // Same for IPv6.
+    HostPtr host3 = HostDataSourceUtils::initializeHost6("2001:db8::1",
+                                                         Host::IDENT_DUID, false);
+    ASSERT_NO_THROW(hdsptr_->add(host3));
+    identifiers.clear();
+    identifiers.push_back(HostIdentifierPair(Host::IDENT_HWADDR,
+                                             std::vector<uint8_t>(6, 1)));
+    identifiers.push_back(HostIdentifierPair(Host::IDENT_DUID,
+                                             host3->getIdentifier()));
+    ASSERT_NO_THROW(from_hds = hdsptr_->getByIdentifiers6(host3->getIPv6SubnetID(),
+                                                          identifiers));
+    ASSERT_EQ(2U, from_hds.size());
+    EXPECT_FALSE(from_hds[0]);
+    ASSERT_TRUE(from_hds[1]);
+    HostDataSourceUtils::compareHosts(host3, from_hds[1]);
+}
+
 void
 GenericHostDataSourceTest::testHWAddrNotClientId() {
     // Make sure we have a pointer to the host data source.
@@ -293,6 +293,11 @@ public:
     /// Uses gtest macros to report failures.
     void testGet4ByIdentifier(const Host::IdentifierType& identifier_type);
 
+    /// @brief Test that hosts can be retrieved by several host identifiers.
+    ///
+    /// Uses gtest macros to report failures.
+    void testGetByIdentifiers();
+
     /// @brief Test that clients with stored HW address can't be retrieved
     ///        by DUID with the same value.
     ///
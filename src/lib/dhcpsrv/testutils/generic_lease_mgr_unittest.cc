@@ -29,6 +29,7 @@
 
 #include <functional>
 #include <limits>
+#include <set>
 #include <sstream>
 
 using namespace std;
@@ -844,6 +845,128 @@ GenericLeaseMgrTest::testBasicLease4() {
     detailCompareLease(leases[3], l_returned);
 }
 
+void
+GenericLeaseMgrTest::testBatchLease4() {
+    // Get the leases to be used for the test.
+    vector<Lease4Ptr> leases = createLeases4();
+
+    // Add a batch of three leases.
+    Lease4Collection batch = { leases[1], leases[2], leases[3] };
+    Lease4Collection failed;
+    ASSERT_NO_THROW(failed = lmptr_->addLeases(batch));
+    EXPECT_TRUE(failed.empty());
+
+    // Only the lease which already exists is not added.
+    batch = { leases[1], leases[4] };
+    ASSERT_NO_THROW(failed = lmptr_->addLeases(batch));
+    ASSERT_EQ(1, failed.size());
+    EXPECT_EQ(leases[1], failed[0]);
+
+    // Reopen the database to ensure that they actually got stored.
+    reopen(V4);
+
+    for (auto const& i : { 1, 2, 3, 4 }) {
+        Lease4Ptr l_returned = lmptr_->getLease4(ioaddress4_[i]);
+        ASSERT_TRUE(l_returned);
+        detailCompareLease(leases[i], l_returned);
+    }
+
+    // Update a batch including a lease which does not exist.
+    leases[2]->hostname_ = "batch2.example.com.";
+    leases[3]->hostname_ = "batch3.example.com.";
+    batch = { leases[2], leases[3], leases[5] };
+    ASSERT_NO_THROW(failed = lmptr_->updateLeases4(batch));
+    ASSERT_EQ(1, failed.size());
+    EXPECT_EQ(leases[5], failed[0]);
+
+    reopen(V4);
+
+    for (auto const& i : { 2, 3 }) {
+        Lease4Ptr l_returned = lmptr_->getLease4(ioaddress4_[i]);
+        ASSERT_TRUE(l_returned);
+        detailCompareLease(leases[i], l_returned);
+    }
+    EXPECT_FALSE(lmptr_->getLease4(ioaddress4_[5]));
+
+    // Delete a batch including a lease which does not exist.
+    batch = { leases[1], leases[2], leases[5] };
+    ASSERT_NO_THROW(failed = lmptr_->deleteLeases(batch));
+    ASSERT_EQ(1, failed.size());
+    EXPECT_EQ(leases[5], failed[0]);
+
+    reopen(V4);
+
+    EXPECT_FALSE(lmptr_->getLease4(ioaddress4_[1]));
+    EXPECT_FALSE(lmptr_->getLease4(ioaddress4_[2]));
+    EXPECT_TRUE(lmptr_->getLease4(ioaddress4_[3]));
+    EXPECT_TRUE(lmptr_->getLease4(ioaddress4_[4]));
+
+    // An empty batch is a no-op.
+    ASSERT_NO_THROW(failed = lmptr_->addLeases(Lease4Collection()));
+    EXPECT_TRUE(failed.empty());
+}
+
+void
+GenericLeaseMgrTest::testBatchLease6() {
+    // Get the leases to be used for the test.
+    vector<Lease6Ptr> leases = createLeases6();
+
+    // Add a batch of three leases.
+    Lease6Collection batch = { leases[1], leases[2], leases[3] };
+    Lease6Collection failed;
+    ASSERT_NO_THROW(failed = lmptr_->addLeases(batch));
+    EXPECT_TRUE(failed.empty());
+
+    // Only the lease which already exists is not added.
+    batch = { leases[1], leases[4] };
+    ASSERT_NO_THROW(failed = lmptr_->addLeases(batch));
+    ASSERT_EQ(1, failed.size());
+    EXPECT_EQ(leases[1], failed[0]);
+
+    // Reopen the database to ensure that they actually got stored.
+    reopen(V6);
+
+    for (auto const& i : { 1, 2, 3, 4 }) {
+        Lease6Ptr l_returned = lmptr_->getLease6(leasetype6_[i], ioaddress6_[i]);
+        ASSERT_TRUE(l_returned);
+        detailCompareLease(leases[i], l_returned);
+    }
+
+    // Update a batch including a lease which does not exist.
+    leases[2]->hostname_ = "batch2.example.com.";
+    leases[3]->hostname_ = "batch3.example.com.";
+    batch = { leases[2], leases[3], leases[5] };
+    ASSERT_NO_THROW(failed = lmptr_->updateLeases6(batch));
+    ASSERT_EQ(1, failed.size());
+    EXPECT_EQ(leases[5], failed[0]);
+
+    reopen(V6);
+
+    for (auto const& i : { 2, 3 }) {
+        Lease6Ptr l_returned = lmptr_->getLease6(leasetype6_[i], ioaddress6_[i]);
+        ASSERT_TRUE(l_returned);
+        detailCompareLease(leases[i], l_returned);
+    }
+    EXPECT_FALSE(lmptr_->getLease6(leasetype6_[5], ioaddress6_[5]));
+
+    // Delete a batch including a lease which does not exist.
+    batch = { leases[1], leases[2], leases[5] };
+    ASSERT_NO_THROW(failed = lmptr_->deleteLeases(batch));
+    ASSERT_EQ(1, failed.size());
+    EXPECT_EQ(leases[5], failed[0]);
+
+    reopen(V6);
+
+    EXPECT_FALSE(lmptr_->getLease6(leasetype6_[1], ioaddress6_[1]));
+    EXPECT_FALSE(lmptr_->getLease6(leasetype6_[2], ioaddress6_[2]));
+    EXPECT_TRUE(lmptr_->getLease6(leasetype6_[3], ioaddress6_[3]));
+    EXPECT_TRUE(lmptr_->getLease6(leasetype6_[4], ioaddress6_[4]));
+
+    // An empty batch is a no-op.
+    ASSERT_NO_THROW(failed = lmptr_->addLeases(Lease6Collection()));
+    EXPECT_TRUE(failed.empty());
+}
+
 void
 GenericLeaseMgrTest::testBasicLease6() {
     // Get the leases to be used for the test.
@@ -1508,6 +1631,60 @@ GenericLeaseMgrTest::testGetLeases4Paged() {
                  InvalidAddressFamily);
 }
 
+void
+GenericLeaseMgrTest::testVisitLeases4() {
+    // Get the leases to be used for the test and add to the database.
+    vector<Lease4Ptr> leases = createLeases4();
+    for (size_t i = 0; i < leases.size(); ++i) {
+        EXPECT_TRUE(lmptr_->addLease(leases[i]));
+    }
+
+    // Visit all leases using small pages.
+    set<IOAddress> visited;
+    size_t count = lmptr_->visitLeases4([&visited](const Lease4Ptr& lease) {
+        visited.insert(lease->addr_);
+        return (true);
+    }, 3);
+    EXPECT_EQ(leases.size(), count);
+    for (auto const& lease : leases) {
+        EXPECT_EQ(1U, visited.count(lease->addr_))
+            << "lease for address " << lease->addr_.toText()
+            << " was not visited";
+    }
+
+    // The visit stops when the visitor returns false.
+    visited.clear();
+    count = lmptr_->visitLeases4([&visited](const Lease4Ptr& lease) {
+        visited.insert(lease->addr_);
+        return (visited.size() < 4);
+    }, 3);
+    EXPECT_EQ(4U, count);
+    EXPECT_EQ(4U, visited.size());
+
+    // Visit the leases of a subnet.
+    size_t expected = 0;
+    for (auto const& lease : leases) {
+        if (lease->subnet_id_ == leases[1]->subnet_id_) {
+            ++expected;
+        }
+    }
+    ASSERT_LT(1U, expected);
+    visited.clear();
+    count = lmptr_->visitLeases4(leases[1]->subnet_id_,
+                                 [&leases, &visited](const Lease4Ptr& lease) {
+        EXPECT_EQ(leases[1]->subnet_id_, lease->subnet_id_);
+        visited.insert(lease->addr_);
+        return (true);
+    }, 1);
+    EXPECT_EQ(expected, count);
+    EXPECT_EQ(expected, visited.size());
+
+    // Zero page size is illegal.
+    EXPECT_THROW(lmptr_->visitLeases4([](const Lease4Ptr&) {
+        return (true);
+    }, 0), OutOfRange);
+}
+
 void
 GenericLeaseMgrTest::testGetLeases4State() {
     // Get the leases to be used for the test and add to the database.
@@ -1707,6 +1884,67 @@ GenericLeaseMgrTest::testGetLeases6Paged() {
                  InvalidAddressFamily);
 }
 
+void
+GenericLeaseMgrTest::testVisitLeases6() {
+    // Get the leases to be used for the test and add to the database.
+    vector<Lease6Ptr> leases = createLeases6();
+    for (size_t i = 0; i < leases.size(); ++i) {
+        EXPECT_TRUE(lmptr_->addLease(leases[i]));
+    }
+
+    // Visit all leases using small pages.
+    set<IOAddress> visited;
+    size_t count = lmptr_->visitLeases6([&visited](const Lease6Ptr& lease) {
+        visited.insert(lease->addr_);
+        return (true);
+    }, 3);
+    EXPECT_EQ(leases.size(), count);
+    for (auto const& lease : leases) {
+        EXPECT_EQ(1U, visited.count(lease->addr_))
+            << "lease for address " << lease->addr_.toText()
+            << " was not visited";
+    }
+
+    // The visit stops when the visitor returns false.
+    count = lmptr_->visitLeases6([](const Lease6Ptr&) {
+        return (false);
+    }, 3);
+    EXPECT_EQ(1U, count);
+
+    // Visit the leases of a subnet.
+    size_t expected = 0;
+    for (auto const& lease : leases) {
+        if (lease->subnet_id_ == leases[1]->subnet_id_) {
+            ++expected;
+        }
+    }
+    count = lmptr_->visitLeases6(leases[1]->subnet_id_,
+                                 [&leases](const Lease6Ptr& lease) {
+        EXPECT_EQ(leases[1]->subnet_id_, lease->subnet_id_);
+        return (true);
+    }, 1);
+    EXPECT_EQ(expected, count);
+
+    // Resume the visit of the subnet after its first lease.
+    IOAddress first = IOAddress::IPV6_ZERO_ADDRESS();
+    lmptr_->visitLeases6(leases[1]->subnet_id_,
+                         [&first](const Lease6Ptr& lease) {
+        first = lease->addr_;
+        return (false);
+    });
+    count = lmptr_->visitLeases6(leases[1]->subnet_id_, first,
+                                 [&first](const Lease6Ptr& lease) {
+        EXPECT_LT(first, lease->addr_);
+        return (true);
+    }, 1);
+    EXPECT_EQ(expected - 1, count);
+
+    // Zero page size is illegal.
+    EXPECT_THROW(lmptr_->visitLeases6([](const Lease6Ptr&) {
+        return (true);
+    }, 0), OutOfRange);
+}
+
 void
 GenericLeaseMgrTest::testGetLeases6State() {
     // Get the leases to be used for the test and add to the database.
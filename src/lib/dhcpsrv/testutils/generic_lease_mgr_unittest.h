@@ -272,6 +272,9 @@ public:
     /// @brief Test method which returns range of IPv4 leases with paging.
     void testGetLeases4Paged();
 
+    /// @brief Test method which visits all IPv4 leases.
+    void testVisitLeases4();
+
     /// @brief Test method which returns all IPv4 leases with state.
     void testGetLeases4State();
 
@@ -294,6 +297,9 @@ public:
     /// @brief Test method which returns range of IPv6 leases with paging.
     void testGetLeases6Paged();
 
+    /// @brief Test method which visits all IPv6 leases.
+    void testVisitLeases6();
+
     /// @brief Test method which returns all IPv6 leases with state.
     void testGetLeases6State();
 
@@ -322,6 +328,12 @@ public:
     /// @brief Checks that invalid dates are safely handled.
     void testMaxDate6();
 
+    /// @brief Checks that addLeases, updateLeases4 and deleteLeases work.
+    void testBatchLease4();
+
+    /// @brief Checks that addLeases, updateLeases6 and deleteLeases work.
+    void testBatchLease6();
+
     /// @brief checks that infinite lifetimes do not overflow.
     void testInfiniteLifeTime6();
 
@@ -231,16 +231,11 @@ MessageRenderer::clear() {
     impl_->truncated_ = false;
     impl_->compress_mode_ = CASE_INSENSITIVE;
 
-    // Clear the hash table.  We reserve the minimum space for possible
-    // subsequent use of the renderer.
+    // Clear the hash table.  The buckets keep their capacity so a renderer
+    // reused for a series of similar messages stops allocating after the
+    // first one.  The capacity is bounded by the number of names which fit
+    // in a message below the maximum compression pointer.
     for (size_t i = 0; i < MessageRendererImpl::BUCKETS; ++i) {
-        if (impl_->table_[i].size() > MessageRendererImpl::RESERVED_ITEMS) {
-            // Trim excessive capacity: swap ensures the new capacity is only
-            // reasonably large for the reserved space.
-            vector<OffsetItem> new_table;
-            new_table.reserve(MessageRendererImpl::RESERVED_ITEMS);
-            new_table.swap(impl_->table_[i]);
-        }
         impl_->table_[i].clear();
     }
 }
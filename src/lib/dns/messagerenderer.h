@@ -1,4 +1,4 @@
-// Copyright (C) 2009-2024 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2009-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -378,6 +378,11 @@ public:
     /// message.
     virtual void setCompressMode(CompressMode mode);
 
+    /// \brief Clear the renderer for reuse.
+    ///
+    /// The compression table is emptied but keeps its memory, so rendering
+    /// a series of messages with the same renderer does not allocate it
+    /// again.
     virtual void clear();
     virtual void writeName(const Name& name, bool compress = true);
     virtual void writeName(const LabelSequence& ls, bool compress = true);
@@ -1,4 +1,4 @@
-// Copyright (C) 2009-2024 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2009-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -293,19 +293,13 @@ Name::Name(const std::string &namestring, bool downcase) {
     const std::string::const_iterator s = namestring.begin();
     const std::string::const_iterator send = namestring.end();
 
-    // Prepare outputs
-    NameOffsets offsets;
-    NameString ndata;
-
-    // To the parsing
-    stringParse(s, send, downcase, offsets, ndata);
+    // To the parsing, directly into the storage of the name
+    stringParse(s, send, downcase, offsets_, ndata_);
 
     // And get the output
-    labelcount_ = offsets.size();
+    labelcount_ = offsets_.size();
     isc_throw_assert(labelcount_ > 0 && labelcount_ <= Name::MAX_LABELS);
-    ndata_.assign(ndata.data(), ndata.data() + ndata.size());
     length_ = ndata_.size();
-    offsets_.assign(offsets.begin(), offsets.end());
 }
 
 Name::Name(const char* namedata, size_t data_len, const Name* origin,
@@ -326,21 +320,22 @@ Name::Name(const char* namedata, size_t data_len, const Name* origin,
     // Prepare inputs for the parser
     const char* end = namedata + data_len;
 
-    // Prepare outputs
-    NameOffsets offsets;
-    NameString ndata;
-
     // Do the actual parsing
-    stringParse(namedata, end, downcase, offsets, ndata);
+    stringParse(namedata, end, downcase, offsets_, ndata_);
 
     // Get the output
-    labelcount_ = offsets.size();
+    labelcount_ = offsets_.size();
     isc_throw_assert(labelcount_ > 0 && labelcount_ <= Name::MAX_LABELS);
-    ndata_.assign(ndata.data(), ndata.data() + ndata.size());
     length_ = ndata_.size();
-    offsets_.assign(offsets.begin(), offsets.end());
 
     if (!absolute) {
+        // Check the sizes are OK before appending to the storage which
+        // can't grow beyond them.
+        if (labelcount_ - 1 + origin->labelcount_ > Name::MAX_LABELS ||
+            length_ - 1 + origin->length_ > Name::MAX_WIRE) {
+            isc_throw(TooLongName, "Combined name is too long");
+        }
+
         // Now, extend the data with the ones from origin. But eat the
         // last label (the empty one).
 
@@ -363,11 +358,6 @@ Name::Name(const char* namedata, size_t data_len, const Name* origin,
         // Adjust sizes.
         length_ = ndata_.size();
         labelcount_ = offsets_.size();
-
-        // And check the sizes are OK.
-        if (labelcount_ > Name::MAX_LABELS || length_ > Name::MAX_WIRE) {
-            isc_throw(TooLongName, "Combined name is too long");
-        }
     }
 }
 
@@ -383,8 +373,7 @@ typedef enum {
 }
 
 Name::Name(InputBuffer& buffer, bool downcase) {
-    NameOffsets offsets;
-    offsets.reserve(Name::MAX_LABELS);
+    NameOffsets& offsets = offsets_;
 
     /*
      * Initialize things to make the compiler happy; they're not required.
@@ -490,7 +479,6 @@ Name::Name(InputBuffer& buffer, bool downcase) {
 
     labelcount_ = offsets.size();
     length_ = nused;
-    offsets_.assign(offsets.begin(), offsets.end());
     buffer.setPosition(pos_begin + cused);
 }
 
@@ -1,4 +1,4 @@
-// Copyright (C) 2009-2024 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2009-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -9,9 +9,12 @@
 
 #include <util/buffer.h>
 #include <dns/messagerenderer.h>
+#include <exceptions/isc_assert.h>
 
 #include <stdint.h>
 
+#include <cstring>
+#include <iterator>
 #include <string>
 #include <vector>
 
@@ -95,6 +98,143 @@ public:
         NameParserException(file, line, what) {}
 };
 
+namespace name {
+namespace internal {
+/// \brief Fixed capacity byte vector used for the storage of a \c Name.
+///
+/// The wire-format data of a name is at most \c Name::MAX_WIRE bytes long,
+/// so it fits into an array embedded in the \c Name object: constructing,
+/// copying and destroying a name does not touch the heap.  This class
+/// provides the subset of the \c std::vector interface used by the \c Name
+/// implementation.  Only the used part of the array is copied.
+///
+/// \tparam CAPACITY The maximum number of bytes.
+template <size_t CAPACITY>
+class InlineBuffer {
+public:
+    typedef uint8_t value_type;
+    typedef uint8_t& reference;
+    typedef const uint8_t& const_reference;
+    typedef uint8_t* iterator;
+    typedef const uint8_t* const_iterator;
+    typedef std::reverse_iterator<const uint8_t*> const_reverse_iterator;
+
+    /// \brief Constructor of an empty buffer.
+    InlineBuffer() : size_(0) {}
+
+    /// \brief Copy constructor.
+    InlineBuffer(const InlineBuffer& other) : size_(other.size_) {
+        std::memcpy(data_, other.data_, size_);
+    }
+
+    /// \brief Assignment operator.
+    InlineBuffer& operator=(const InlineBuffer& other) {
+        if (this != &other) {
+            size_ = other.size_;
+            std::memcpy(data_, other.data_, size_);
+        }
+        return (*this);
+    }
+
+    /// \name Size
+    //@{
+    size_t size() const { return (size_); }
+    bool empty() const { return (size_ == 0); }
+    static size_t capacity() { return (CAPACITY); }
+
+    /// \brief Only checks the requested size as the storage is fixed.
+    ///
+    /// \throw isc::OutOfRange if the size exceeds the capacity.
+    void reserve(size_t size) const {
+        if (size > CAPACITY) {
+            isc_throw(isc::OutOfRange, "name buffer of " << CAPACITY
+                      << " bytes cannot hold " << size << " bytes");
+        }
+    }
+
+    void clear() { size_ = 0; }
+    //@}
+
+    /// \name Element access
+    //@{
+    uint8_t* data() { return (data_); }
+    const uint8_t* data() const { return (data_); }
+    uint8_t& operator[](size_t pos) { return (data_[pos]); }
+    const uint8_t& operator[](size_t pos) const { return (data_[pos]); }
+    uint8_t& back() { return (data_[size_ - 1]); }
+    const uint8_t& back() const { return (data_[size_ - 1]); }
+
+    /// \throw isc::OutOfRange if the position is not below the size.
+    uint8_t& at(size_t pos) {
+        if (pos >= size_) {
+            isc_throw(isc::OutOfRange, "name buffer position " << pos
+                      << " out of range");
+        }
+        return (data_[pos]);
+    }
+    //@}
+
+    /// \name Iterators
+    //@{
+    iterator begin() { return (data_); }
+    iterator end() { return (data_ + size_); }
+    const_iterator begin() const { return (data_); }
+    const_iterator end() const { return (data_ + size_); }
+    const_reverse_iterator rbegin() const {
+        return (const_reverse_iterator(end()));
+    }
+    const_reverse_iterator rend() const {
+        return (const_reverse_iterator(begin()));
+    }
+    //@}
+
+    /// \name Modifiers
+    ///
+    /// They throw \c isc::OutOfRange when the capacity would be exceeded.
+    //@{
+    void push_back(uint8_t value) {
+        reserve(size_ + 1);
+        data_[size_++] = value;
+    }
+
+    void pop_back() { --size_; }
+
+    /// \brief Appends a range at the end.
+    ///
+    /// \param pos Must be \c end(), inserting elsewhere is not supported.
+    /// \param first The beginning of the range.
+    /// \param last The end of the range.
+    template <typename Iterator>
+    void insert(iterator pos, Iterator first, Iterator last) {
+        isc_throw_assert(pos == end());
+        reserve(size_ + std::distance(first, last));
+        for (; first != last; ++first) {
+            data_[size_++] = *first;
+        }
+    }
+
+    template <typename Iterator>
+    void assign(Iterator first, Iterator last) {
+        clear();
+        insert(end(), first, last);
+    }
+
+    /// \brief Removes the last element.
+    ///
+    /// \param pos Must be <code>end() - 1</code>.
+    void erase(iterator pos) {
+        isc_throw_assert(pos + 1 == end());
+        --size_;
+    }
+    //@}
+
+private:
+    uint8_t data_[CAPACITY];
+    size_t size_;
+};
+} // end of internal
+} // end of name
+
 ///
 /// This is a supplemental class used only as a return value of
 /// Name::compare() and LabelSequence::compare().
@@ -181,11 +321,12 @@ private:
 /// access to various properties of a name, etc.
 ///
 /// Notes to developers: Internally, a name object maintains the name %data
-/// in wire format as an instance of \c std::string.  Since many string
-/// implementations adopt copy-on-write %data sharing, we expect this approach
-/// will make copying a name less expensive in typical cases.  If this is
-/// found to be a significant performance bottleneck later, we may reconsider
-/// the internal representation or perhaps the API.
+/// in wire format in a fixed size array embedded in the object (see
+/// \c name::internal::InlineBuffer).  As a name is at most \c MAX_WIRE
+/// bytes long, building, copying and destroying names never allocates
+/// memory, which matters on paths creating many short lived names such as
+/// the rendering of DNS messages.  The price is a larger object (about 400
+/// bytes whatever the length of the name).
 ///
 /// A name object also maintains a vector of offsets (\c offsets_ member),
 /// each of which is the offset to a label of the name: The n-th element of
@@ -227,11 +368,6 @@ class Name {
     ///
     //@{
 private:
-    /// \brief Name data string
-    typedef std::vector<uint8_t> NameString;
-    /// \brief Name offsets type
-    typedef std::vector<uint8_t> NameOffsets;
-
     /// The default constructor
     ///
     /// This is used internally in the class implementation, but at least at
@@ -724,6 +860,11 @@ public:
     //@}
 
 private:
+    /// \brief Name data string
+    typedef name::internal::InlineBuffer<MAX_WIRE> NameString;
+    /// \brief Name offsets type
+    typedef name::internal::InlineBuffer<MAX_LABELS> NameOffsets;
+
     NameString ndata_;
     NameOffsets offsets_;
     unsigned int length_;
@@ -285,8 +285,29 @@ TEST_F(MessageRendererTest, manyRRs) {
     for (size_t i = 0; i < 1000; ++i) {
         EXPECT_EQ(Name(lexical_cast<std::string>(i) + ".example"), Name(b));
     }
-    // This will trigger trimming excessive hash items.  It shouldn't cause
+    // The hash items are kept for the next message.  It shouldn't cause
     // any disruption.
     EXPECT_NO_THROW(renderer.clear());
+    renderer.writeName(Name("0.example"));
+    EXPECT_EQ(Name("0.example").getLength(), renderer.getLength());
+}
+
+// A cleared renderer compresses names exactly as a new one.
+TEST_F(MessageRendererTest, reuse) {
+    renderer.writeName(Name("a.example.com"));
+    renderer.writeName(Name("b.example.com"));
+    const uint8_t* data = static_cast<const uint8_t*>(renderer.getData());
+    const std::vector<uint8_t> first(data, data + renderer.getLength());
+
+    renderer.clear();
+    renderer.writeName(Name("a.example.com"));
+    renderer.writeName(Name("b.example.com"));
+    matchWireData(&first[0], first.size(),
+                  renderer.getData(), renderer.getLength());
+
+    // No pointer to the names of the previous message.
+    renderer.clear();
+    renderer.writeName(Name("b.example.com"));
+    EXPECT_EQ(Name("b.example.com").getLength(), renderer.getLength());
 }
 }
@@ -526,6 +526,31 @@ TEST_F(NameTest, assignment) {
     EXPECT_EQ(example_name, copy);
 }
 
+// Names are stored inline in the object: check the longest names survive
+// the operations which build a new name and the copies.
+TEST_F(NameTest, maxLengthStorage) {
+    const Name max_len(max_len_str);
+    EXPECT_EQ(Name::MAX_WIRE, max_len.getLength());
+    Name* copy = new Name(max_len);
+    Name copy2(*copy);
+    delete copy;
+    EXPECT_EQ(max_len, copy2);
+    EXPECT_EQ(max_len, max_len.reverse().reverse());
+    EXPECT_EQ(max_len, max_len.split(0, 2).concatenate(max_len.split(2)));
+
+    const Name max_labels(max_labels_str);
+    EXPECT_EQ(Name::MAX_LABELS, max_labels.getLabelCount());
+    Name copy3(".");
+    copy3 = max_labels;
+    EXPECT_EQ(max_labels, copy3);
+    EXPECT_EQ(max_labels, max_labels.reverse().reverse());
+
+    // A relative name completed by an origin up to the limit.
+    const std::string prefix(string(max_len_str).substr(0, 241));
+    EXPECT_EQ(Name::MAX_WIRE,
+              Name(prefix.c_str(), prefix.size(), &origin_name).getLength());
+}
+
 TEST_F(NameTest, toText) {
     // tests derived from BIND9
     EXPECT_EQ("a.b.c.d", Name("a.b.c.d").toText(true));
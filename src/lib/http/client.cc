@@ -1,4 +1,4 @@
-// Copyright (C) 2018-2024 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2018-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -22,8 +22,10 @@
 #include <boost/enable_shared_from_this.hpp>
 #include <boost/weak_ptr.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <array>
+#include <deque>
 #include <functional>
 #include <iostream>
 #include <map>
@@ -105,6 +107,15 @@ typedef boost::shared_ptr<ConnectionPool> ConnectionPoolPtr;
 /// the new request is stored in the FIFO queue. The queued requests to the
 /// particular URL are sent to the server when the current transaction ends.
 ///
+/// When the maximum pipeline depth is greater than 1, persistent requests
+/// can also be pipelined over a busy plain TCP connection: they are sent
+/// without waiting for the responses to the previous requests. HTTP/1.1
+/// requires the responses to be returned in the order of the requests, so
+/// the pipelined transactions complete in order: when the response to the
+/// current transaction has been received, the first pipelined transaction
+/// becomes the current one. An error terminates all the transactions of
+/// the connection. Pipelining is not used over TLS.
+///
 /// The communication over the transport socket is asynchronous. The caller is
 /// notified about the completion of the transaction via a callback that the
 /// caller supplies when initiating the transaction.
@@ -118,10 +129,13 @@ public:
     /// @param conn_pool Back pointer to the connection pool to which this
     /// connection belongs.
     /// @param url URL associated with this connection.
+    /// @param max_pipeline_depth maximum number of requests sent and not
+    /// yet answered over this connection (1 disables pipelining).
     explicit Connection(const IOServicePtr& io_service,
                         const TlsContextPtr& tls_context,
                         const ConnectionPoolPtr& conn_pool,
-                        const Url& url);
+                        const Url& url,
+                        const size_t max_pipeline_depth = 1);
 
     /// @brief Destructor.
     ~Connection();
@@ -152,6 +166,27 @@ public:
                        const HttpClient::HandshakeHandler& handshake_callback,
                        const HttpClient::CloseHandler& close_callback);
 
+    /// @brief Pipelines a request after the ongoing transaction(s).
+    ///
+    /// The request is sent over the connection without waiting for the
+    /// responses to the previous requests. It is accepted only when the
+    /// connection is a plain TCP connection with an ongoing persistent
+    /// transaction, both requests are persistent and the maximum pipeline
+    /// depth is not reached.
+    ///
+    /// @param request Pointer to the request to be sent to the server.
+    /// @param response Pointer to the object into which the response is stored.
+    /// @param request_timeout Request timeout in milliseconds.
+    /// @param callback Pointer to the callback function to be invoked when the
+    /// transaction completes.
+    ///
+    /// @return true if the request was pipelined, false if the caller must
+    /// use another connection or queue the request.
+    bool pipelineRequest(const HttpRequestPtr& request,
+                         const HttpResponsePtr& response,
+                         const long request_timeout,
+                         const HttpClient::RequestHandler& callback);
+
     /// @brief Closes the socket and cancels the request timer.
     void close();
 
@@ -229,6 +264,22 @@ private:
                                const HttpClient::HandshakeHandler& handshake_callback,
                                const HttpClient::CloseHandler& close_callback);
 
+    /// @brief Pipelines a request after the ongoing transaction(s).
+    ///
+    /// Should be called in a thread safe context.
+    ///
+    /// @param request Pointer to the request to be sent to the server.
+    /// @param response Pointer to the object into which the response is stored.
+    /// @param request_timeout Request timeout in milliseconds.
+    /// @param callback Pointer to the callback function to be invoked when the
+    /// transaction completes.
+    ///
+    /// @return true if the request was pipelined, false otherwise.
+    bool pipelineRequestInternal(const HttpRequestPtr& request,
+                                 const HttpResponsePtr& response,
+                                 const long request_timeout,
+                                 const HttpClient::RequestHandler& callback);
+
     /// @brief Closes the socket and cancels the request timer.
     ///
     /// Should be called in a thread safe context.
@@ -290,11 +341,27 @@ private:
     /// and initiates next transaction if there is any transaction queued for the
     /// URL associated with this connection.
     ///
+    /// When the transaction succeeded and there are pipelined requests, the
+    /// first pipelined request becomes the current transaction instead. On
+    /// error the pipelined requests are terminated with the same error (or
+    /// with @c connection_aborted for a parsing error) and the connection
+    /// is closed.
+    ///
     /// @param ec Error code received as a result of the IO operation.
     /// @param parsing_error Message parsing error.
     void terminateInternal(const boost::system::error_code& ec,
                            const std::string& parsing_error = "");
 
+    /// @brief Makes the first pipelined request the current transaction.
+    ///
+    /// Should be called in a thread safe context.
+    ///
+    /// The data received after the end of the previous response are
+    /// fed to the new parser: they belong to the next response.
+    ///
+    /// @param remainder Data received after the previous response.
+    void promotePipelinedInternal(const std::string& remainder);
+
     /// @brief Run parser and check if more data is needed.
     ///
     /// @param ec Error code received as a result of the IO operation.
@@ -332,6 +399,25 @@ private:
     /// @param transid Current transaction id.
     void doSend(const uint64_t transid);
 
+    /// @brief Starts sending the content of the @c buf_.
+    ///
+    /// Should be called in a thread safe context.
+    ///
+    /// @param transid Current transaction id.
+    /// @param socket_cb Callback invoked when the data have been sent.
+    void asyncSendInternal(const uint64_t transid, SocketCallback& socket_cb);
+
+    /// @brief Removes sent data from the @c buf_.
+    ///
+    /// Should be called in a thread safe context.
+    ///
+    /// @param length Number of bytes sent.
+    /// @param[out] send_more Set to true when there are more data to send.
+    /// @param[out] start_receive Set to true when the caller must start
+    /// receiving the responses.
+    void consumeSentInternal(size_t length, bool& send_more,
+                             bool& start_receive);
+
     /// @brief Asynchronously receives data over the socket.
     ///
     /// The data received over the socket are store into the @c input_buf_.
@@ -462,6 +548,34 @@ private:
     /// @brief Flag to indicate that the socket was closed.
     std::atomic<bool> closed_;
 
+    /// @brief Request pipelined after the current transaction.
+    struct PipelinedRequest {
+        /// @brief Holds pointer to the request.
+        HttpRequestPtr request_;
+
+        /// @brief Holds pointer to the response.
+        HttpResponsePtr response_;
+
+        /// @brief Holds requested timeout value.
+        long request_timeout_;
+
+        /// @brief Holds pointer to the user callback.
+        HttpClient::RequestHandler callback_;
+    };
+
+    /// @brief Requests sent (or being sent) after the current one, in the
+    /// order of the expected responses.
+    std::deque<PipelinedRequest> pipeline_;
+
+    /// @brief Maximum number of requests sent and not yet answered.
+    size_t max_pipeline_depth_;
+
+    /// @brief Flag to indicate that the @c buf_ is being sent.
+    bool sending_;
+
+    /// @brief Flag to indicate that responses are being received.
+    bool receiving_;
+
     /// @brief Mutex to protect the internal state.
     std::mutex mutex_;
 };
@@ -474,8 +588,9 @@ typedef boost::shared_ptr<Connection> ConnectionPtr;
 /// Connection pool creates and destroys URL destinations. It manages
 /// connections to and requests for URLs.  Each time a request is
 /// submitted for a URL, it assigns it to an available idle connection,
-/// or if no idle connections are available, pushes the request on the queue
-/// for that URL.
+/// or if no idle connections are available, pipelines it over a busy
+/// connection (when enabled) or pushes the request on the queue for
+/// that URL.
 class ConnectionPool : public boost::enable_shared_from_this<ConnectionPool> {
 public:
 
@@ -485,9 +600,13 @@ public:
     /// connections.
     /// @param max_url_connections maximum number of concurrent
     /// connections allowed per URL.
-    explicit ConnectionPool(const IOServicePtr& io_service, size_t max_url_connections)
+    /// @param max_pipeline_depth maximum number of requests sent and not
+    /// yet answered per connection (1 disables pipelining).
+    explicit ConnectionPool(const IOServicePtr& io_service, size_t max_url_connections,
+                            size_t max_pipeline_depth = 1)
         : io_service_(io_service), destinations_(), pool_mutex_(),
-          max_url_connections_(max_url_connections) {
+          max_url_connections_(max_url_connections),
+          max_pipeline_depth_(max_pipeline_depth) {
     }
 
     /// @brief Destructor.
@@ -621,12 +740,20 @@ private:
                 if (!connection) {
                     // No idle connections.
                     if (destination->connectionsFull()) {
+                        // Pipeline as many queued requests as the busy
+                        // connections accept.
+                        if (max_pipeline_depth_ > 1) {
+                            while (!destination->queueEmpty() &&
+                                   destination->pipelineNextRequest()) {
+                            }
+                        }
                         return;
                     }
                     // Room to make another connection with this destination,
                     // so make one.
                     connection.reset(new Connection(io_service_, tls_context,
-                                                    shared_from_this(), url));
+                                                    shared_from_this(), url,
+                                                    max_pipeline_depth_));
                     destination->addConnection(connection);
                 }
 
@@ -688,7 +815,16 @@ private:
 
         if (!connection) {
             if (destination->connectionsFull()) {
-                // All connections busy, queue it.
+                // All connections busy, pipeline it if possible. Queued
+                // requests go first so the order is preserved.
+                if ((max_pipeline_depth_ > 1) && destination->queueEmpty() &&
+                    destination->pipelineRequest(request, response,
+                                                 request_timeout,
+                                                 request_callback)) {
+                    return;
+                }
+
+                // Otherwise queue it.
                 destination->pushRequest(RequestDescriptor(request, response,
                                                            request_timeout,
                                                            request_callback,
@@ -700,7 +836,8 @@ private:
 
             // Room to make another connection with this destination, so make one.
             connection.reset(new Connection(io_service_, tls_context,
-                                            shared_from_this(), url));
+                                            shared_from_this(), url,
+                                            max_pipeline_depth_));
             destination->addConnection(connection);
         }
 
@@ -936,6 +1073,52 @@ private:
             return (ConnectionPtr());
         }
 
+        /// @brief Pipelines a request over the first connection accepting it.
+        ///
+        /// @param request Pointer to the request to be sent.
+        /// @param response Pointer to the object into which the response
+        /// will be stored.
+        /// @param request_timeout Requested timeout for the transaction.
+        /// @param callback Pointer to the user callback.
+        ///
+        /// @return true if the request was pipelined, false otherwise.
+        /// @note This should be called in a thread safe context.
+        bool pipelineRequest(const HttpRequestPtr& request,
+                             const HttpResponsePtr& response,
+                             const long request_timeout,
+                             const HttpClient::RequestHandler& callback) {
+            for (auto const& connection : connections_) {
+                if (connection->pipelineRequest(request, response,
+                                                request_timeout, callback)) {
+                    return (true);
+                }
+            }
+
+            return (false);
+        }
+
+        /// @brief Pipelines the request at the front of the request queue.
+        ///
+        /// The request is removed from the queue only when it has been
+        /// pipelined.
+        ///
+        /// @return true if the request was pipelined, false otherwise.
+        /// @note This should be called in a thread safe context.
+        bool pipelineNextRequest() {
+            if (queue_.empty()) {
+                return (false);
+            }
+
+            RequestDescriptor const& desc = queue_.front();
+            if (!pipelineRequest(desc.request_, desc.response_,
+                                 desc.request_timeout_, desc.callback_)) {
+                return (false);
+            }
+
+            queue_.pop();
+            return (true);
+        }
+
         /// @brief Find a connection by its socket descriptor.
         ///
         /// @param socket_fd socket descriptor to find
@@ -1119,18 +1302,25 @@ private:
 
     /// @brief Maximum number of connections per URL and TLS context.
     size_t max_url_connections_;
+
+    /// @brief Maximum number of requests sent and not yet answered per
+    /// connection.
+    size_t max_pipeline_depth_;
 };
 
 Connection::Connection(const IOServicePtr& io_service,
                        const TlsContextPtr& tls_context,
                        const ConnectionPoolPtr& conn_pool,
-                       const Url& url)
+                       const Url& url,
+                       const size_t max_pipeline_depth)
     : io_service_(io_service), conn_pool_(conn_pool), url_(url),
       tls_context_(tls_context), tcp_socket_(), tls_socket_(),
       timer_(new IntervalTimer(io_service)), current_request_(),
       current_response_(), parser_(), current_callback_(), buf_(), input_buf_(),
       current_transid_(0), close_callback_(), started_(false),
-      need_handshake_(false), closed_(false) {
+      need_handshake_(false), closed_(false), pipeline_(),
+      max_pipeline_depth_(max_pipeline_depth), sending_(false),
+      receiving_(false) {
     if (!tls_context) {
         tcp_socket_.reset(new asiolink::TCPSocket<SocketCallback>(io_service));
     } else {
@@ -1151,6 +1341,10 @@ Connection::resetState() {
     current_response_.reset();
     parser_.reset();
     current_callback_ = HttpClient::RequestHandler();
+    pipeline_.clear();
+    buf_.clear();
+    sending_ = false;
+    receiving_ = false;
 }
 
 void
@@ -1260,6 +1454,8 @@ Connection::doTransactionInternal(const HttpRequestPtr& request,
         ++current_transid_;
 
         buf_ = request->toString();
+        sending_ = true;
+        receiving_ = false;
 
         LOG_DEBUG(http_logger, isc::log::DBGLVL_TRACE_DETAIL,
                   HTTP_CLIENT_REQUEST_SEND)
@@ -1303,6 +1499,68 @@ Connection::doTransactionInternal(const HttpRequestPtr& request,
     }
 }
 
+bool
+Connection::pipelineRequest(const HttpRequestPtr& request,
+                            const HttpResponsePtr& response,
+                            const long request_timeout,
+                            const HttpClient::RequestHandler& callback) {
+    if (MultiThreadingMgr::instance().getMode()) {
+        std::lock_guard<std::mutex> lk(mutex_);
+        return (pipelineRequestInternal(request, response, request_timeout,
+                                        callback));
+    } else {
+        return (pipelineRequestInternal(request, response, request_timeout,
+                                        callback));
+    }
+}
+
+bool
+Connection::pipelineRequestInternal(const HttpRequestPtr& request,
+                                    const HttpResponsePtr& response,
+                                    const long request_timeout,
+                                    const HttpClient::RequestHandler& callback) {
+    // Concurrent reads and writes are not supported over TLS and a not
+    // persistent request closes the connection after its response.
+    if ((max_pipeline_depth_ <= 1) || !tcp_socket_ || !started_ || closed_ ||
+        !current_request_ || !current_request_->isPersistent() ||
+        !request->isPersistent() ||
+        (pipeline_.size() + 1 >= max_pipeline_depth_)) {
+        return (false);
+    }
+
+    try {
+        std::string const data = request->toString();
+        pipeline_.push_back(PipelinedRequest{request, response, request_timeout,
+                                             callback});
+        buf_ += data;
+
+        LOG_DEBUG(http_logger, isc::log::DBGLVL_TRACE_DETAIL,
+                  HTTP_CLIENT_REQUEST_SEND)
+            .arg(request->toBriefString())
+            .arg(url_.toText());
+
+        LOG_DEBUG(http_logger, isc::log::DBGLVL_TRACE_DETAIL_DATA,
+                  HTTP_CLIENT_REQUEST_SEND_DETAILS)
+            .arg(url_.toText())
+            .arg(HttpMessageParserBase::logFormatHttpMessage(data,
+                                                             MAX_LOGGED_MESSAGE_SIZE));
+
+    } catch (const std::exception& ex) {
+        // Re-throw with the expected exception type.
+        isc_throw(HttpClientError, ex.what());
+    }
+
+    // If the previous data have already been sent, start sending. Otherwise
+    // the send callback will continue with the new data.
+    if (!sending_) {
+        sending_ = true;
+        io_service_->post(std::bind(&Connection::doSend, shared_from_this(),
+                                    current_transid_));
+    }
+
+    return (true);
+}
+
 void
 Connection::close() {
     if (MultiThreadingMgr::instance().getMode()) {
@@ -1388,12 +1646,6 @@ Connection::terminateInternal(const boost::system::error_code& ec,
     if (isTransactionOngoing()) {
 
         timer_->cancel();
-        if (tcp_socket_) {
-            tcp_socket_->cancel();
-        }
-        if (tls_socket_) {
-            tls_socket_->cancel();
-        }
 
         if (!ec && current_response_->isFinalized()) {
             response = current_response_;
@@ -1428,6 +1680,22 @@ Connection::terminateInternal(const boost::system::error_code& ec,
                          parser_->getBufferAsString(MAX_LOGGED_MESSAGE_SIZE) :
                          "[HttpResponseParser is null]");
             }
+
+            // Pipelined requests may still be being sent on success so
+            // only cancel on error.
+            if (tcp_socket_) {
+                tcp_socket_->cancel();
+            }
+            if (tls_socket_) {
+                tls_socket_->cancel();
+            }
+        }
+
+        // The data received after the response belong to the next
+        // pipelined response.
+        std::string remainder;
+        if (response && !pipeline_.empty() && parser_) {
+            remainder = parser_->getBufferRemainder();
         }
 
         try {
@@ -1442,15 +1710,41 @@ Connection::terminateInternal(const boost::system::error_code& ec,
         } catch (...) {
         }
 
-        // If we're not requesting connection persistence or the
-        // connection has timed out, we should close the socket.
-        if (!closed_ &&
-            (!current_request_->isPersistent() ||
-             (ec == boost::asio::error::timed_out))) {
-            closeInternal();
-        }
+        if (!closed_ && response && !pipeline_.empty()) {
+            // Continue with the next pipelined request.
+            promotePipelinedInternal(remainder);
+
+        } else {
+            std::deque<PipelinedRequest> pipelined;
+            pipelined.swap(pipeline_);
+
+            // If we're not requesting connection persistence or the
+            // connection has timed out, we should close the socket.
+            // After an error the responses to the pipelined requests
+            // can't be received either.
+            if (!closed_ &&
+                (!current_request_->isPersistent() ||
+                 (ec == boost::asio::error::timed_out) ||
+                 !pipelined.empty())) {
+                closeInternal();
+            }
 
-        resetState();
+            resetState();
+
+            boost::system::error_code const pipelined_ec =
+                (ec ? ec : boost::asio::error::connection_aborted);
+            for (auto const& p : pipelined) {
+                try {
+                    if (MultiThreadingMgr::instance().getMode()) {
+                        UnlockGuard<std::mutex> lock(mutex_);
+                        p.callback_(pipelined_ec, HttpResponsePtr(), parsing_error);
+                    } else {
+                        p.callback_(pipelined_ec, HttpResponsePtr(), parsing_error);
+                    }
+                } catch (...) {
+                }
+            }
+        }
     }
 
     // Check if there are any requests queued for this destination and start
@@ -1461,6 +1755,27 @@ Connection::terminateInternal(const boost::system::error_code& ec,
     }
 }
 
+void
+Connection::promotePipelinedInternal(const std::string& remainder) {
+    PipelinedRequest next = pipeline_.front();
+    pipeline_.pop_front();
+
+    // The transaction id is not changed: the send and receive handlers
+    // in progress keep working for the pipelined transactions.
+    current_request_ = next.request_;
+    current_response_ = next.response_;
+    current_callback_ = next.callback_;
+    parser_.reset(new HttpResponseParser(*current_response_));
+    parser_->initModel();
+
+    scheduleTimer(next.request_timeout_);
+
+    if (!remainder.empty()) {
+        parser_->postBuffer(remainder.data(), remainder.size());
+        parser_->poll();
+    }
+}
+
 void
 Connection::scheduleTimer(const long request_timeout) {
     if (request_timeout > 0) {
@@ -1498,25 +1813,65 @@ Connection::doSend(const uint64_t transid) {
                                        ph::_1,
                                        ph::_2));
     try {
-        if (tcp_socket_) {
-            tcp_socket_->asyncSend(&buf_[0], buf_.size(), socket_cb);
-            return;
-        }
-
-        if (tls_socket_) {
-            tls_socket_->asyncSend(&buf_[0], buf_.size(), socket_cb);
-            return;
+        // Pipelined requests may be appended to the buffer by other
+        // threads.
+        if (MultiThreadingMgr::instance().getMode()) {
+            std::lock_guard<std::mutex> lk(mutex_);
+            asyncSendInternal(transid, socket_cb);
+        } else {
+            asyncSendInternal(transid, socket_cb);
         }
-
-        // Should never reach this point.
-        std::cerr << "internal error: can't find a socket to send to\n";
-        isc_throw(Unexpected,
-                  "internal error: can't find a socket to send to");
     } catch (...) {
         terminate(boost::asio::error::not_connected);
     }
 }
 
+void
+Connection::asyncSendInternal(const uint64_t transid,
+                              SocketCallback& socket_cb) {
+    // A send posted for pipelined requests may be late: do nothing if
+    // the transactions have been terminated meanwhile.
+    if (!started_ || (transid != current_transid_) || buf_.empty()) {
+        return;
+    }
+
+    if (tcp_socket_) {
+        tcp_socket_->asyncSend(&buf_[0], buf_.size(), socket_cb);
+        return;
+    }
+
+    if (tls_socket_) {
+        tls_socket_->asyncSend(&buf_[0], buf_.size(), socket_cb);
+        return;
+    }
+
+    // Should never reach this point.
+    std::cerr << "internal error: can't find a socket to send to\n";
+    isc_throw(Unexpected,
+              "internal error: can't find a socket to send to");
+}
+
+void
+Connection::consumeSentInternal(size_t length, bool& send_more,
+                                bool& start_receive) {
+    // If any data have been sent, remove it from the buffer and only leave
+    // the portion that still has to be sent.
+    if (length > 0) {
+        buf_.erase(0, std::min(length, buf_.size()));
+    }
+
+    send_more = !buf_.empty();
+    sending_ = send_more;
+
+    // Start receiving when the request has been sent. With pipelined
+    // requests the responses are received while the next requests are
+    // being sent.
+    start_receive = !receiving_ && (!send_more || !pipeline_.empty());
+    if (start_receive) {
+        receiving_ = true;
+    }
+}
+
 void
 Connection::doReceive(const uint64_t transid) {
     TCPEndpoint endpoint;
@@ -1527,9 +1882,17 @@ Connection::doReceive(const uint64_t transid) {
                                        ph::_2));
     try {
         if (tcp_socket_) {
-            tcp_socket_->asyncReceive(static_cast<void*>(input_buf_.data()),
-                                      input_buf_.size(), 0,
-                                      &endpoint, socket_cb);
+            // A send for pipelined requests may be started concurrently.
+            if (MultiThreadingMgr::instance().getMode()) {
+                std::lock_guard<std::mutex> lk(mutex_);
+                tcp_socket_->asyncReceive(static_cast<void*>(input_buf_.data()),
+                                          input_buf_.size(), 0,
+                                          &endpoint, socket_cb);
+            } else {
+                tcp_socket_->asyncReceive(static_cast<void*>(input_buf_.data()),
+                                          input_buf_.size(), 0,
+                                          &endpoint, socket_cb);
+            }
             return;
         }
         if (tls_socket_) {
@@ -1654,18 +2017,22 @@ Connection::sendCallback(const uint64_t transid,
     // Sending is in progress, so push back the timeout.
     scheduleTimer(timer_->getInterval());
 
-    // If any data have been sent, remove it from the buffer and only leave the
-    // portion that still has to be sent.
-    if (length > 0) {
-        buf_.erase(0, length);
+    // Pipelined requests may be appended to the buffer by other threads.
+    bool send_more = false;
+    bool start_receive = false;
+    if (MultiThreadingMgr::instance().getMode()) {
+        std::lock_guard<std::mutex> lk(mutex_);
+        consumeSentInternal(length, send_more, start_receive);
+    } else {
+        consumeSentInternal(length, send_more, start_receive);
     }
 
     // If there is no more data to be sent, start receiving a response. Otherwise,
-    // continue sending.
-    if (buf_.empty()) {
+    // continue sending (and receiving the responses to pipelined requests).
+    if (start_receive) {
         doReceive(transid);
-
-    } else {
+    }
+    if (send_more) {
         doSend(transid);
     }
 }
@@ -1723,26 +2090,30 @@ Connection::runParserInternal(const boost::system::error_code& ec,
         parser_->poll();
     }
 
-    // If the parser still needs data, let's schedule another receive.
-    if (parser_->needData()) {
-        return (true);
+    // The data can hold several pipelined responses: loop as long as
+    // a pipelined transaction takes over.
+    while (started_) {
+        // If the parser still needs data, let's schedule another receive.
+        if (parser_->needData()) {
+            return (true);
 
-    } else if (parser_->httpParseOk()) {
-        // No more data needed and parsing has been successful so far. Let's
-        // try to finalize the response parsing.
-        try {
-            current_response_->finalize();
-            terminateInternal(ec);
+        } else if (parser_->httpParseOk()) {
+            // No more data needed and parsing has been successful so far. Let's
+            // try to finalize the response parsing.
+            try {
+                current_response_->finalize();
+                terminateInternal(ec);
 
-        } catch (const std::exception& ex) {
-            // If there is an error here, we need to return the error message.
-            terminateInternal(ec, ex.what());
-        }
+            } catch (const std::exception& ex) {
+                // If there is an error here, we need to return the error message.
+                terminateInternal(ec, ex.what());
+            }
 
-    } else {
-        // Parsing was unsuccessful. Let's pass the error message held in the
-        // parser.
-        terminateInternal(ec, parser_->getErrorMessage());
+        } else {
+            // Parsing was unsuccessful. Let's pass the error message held in the
+            // parser.
+            terminateInternal(ec, parser_->getErrorMessage());
+        }
     }
 
     return (false);
@@ -1785,16 +2156,22 @@ public:
     /// the thread pool threads will be created and started, with the
     /// operational state being RUNNING.  Applicable only when thread-pool size
     /// is greater than zero.
+    /// @param max_pipeline_depth maximum number of requests sent over a
+    /// connection and not yet answered (1 disables pipelining).
     HttpClientImpl(const IOServicePtr& io_service, size_t thread_pool_size = 0,
-                   bool defer_thread_start = false)
-        : thread_pool_size_(thread_pool_size), thread_pool_() {
+                   bool defer_thread_start = false,
+                   size_t max_pipeline_depth = 1)
+        : thread_pool_size_(thread_pool_size),
+          max_pipeline_depth_(std::max(max_pipeline_depth, size_t(1))),
+          thread_pool_() {
         if (thread_pool_size_ > 0) {
             // Create our own private IOService.
             thread_io_service_.reset(new IOService());
 
             // Create the connection pool. Note that we use the thread_pool_size
             // as the maximum connections per URL value.
-            conn_pool_.reset(new ConnectionPool(thread_io_service_, thread_pool_size_));
+            conn_pool_.reset(new ConnectionPool(thread_io_service_, thread_pool_size_,
+                                                max_pipeline_depth_));
 
             // Create the thread pool.
             thread_pool_.reset(new IoServiceThreadPool(thread_io_service_, thread_pool_size_,
@@ -1805,7 +2182,7 @@ public:
         } else {
             // Single-threaded mode: use the caller's IOService,
             // one connection per URL.
-            conn_pool_.reset(new ConnectionPool(io_service, 1));
+            conn_pool_.reset(new ConnectionPool(io_service, 1, max_pipeline_depth_));
         }
     }
 
@@ -1938,6 +2315,14 @@ public:
         return (thread_pool_->getThreadCount());
     }
 
+    /// @brief Fetches the maximum pipeline depth.
+    ///
+    /// @return the maximum number of requests sent over a connection and
+    /// not yet answered.
+    size_t getMaxPipelineDepth() const {
+        return (max_pipeline_depth_);
+    }
+
     /// @brief Holds a pointer to the connection pool.
     ConnectionPoolPtr conn_pool_;
 
@@ -1946,6 +2331,10 @@ private:
     /// @brief Maxim number of threads in the thread pool.
     size_t thread_pool_size_;
 
+    /// @brief Maximum number of requests sent over a connection and not
+    /// yet answered.
+    size_t max_pipeline_depth_;
+
     /// @brief Pointer to private IOService used in multi-threaded mode.
     asiolink::IOServicePtr thread_io_service_;
 
@@ -1955,7 +2344,8 @@ private:
 };
 
 HttpClient::HttpClient(const IOServicePtr& io_service, bool multi_threading_enabled,
-                       size_t thread_pool_size, bool defer_thread_start) {
+                       size_t thread_pool_size, bool defer_thread_start,
+                       size_t max_pipeline_depth) {
     if (!multi_threading_enabled && thread_pool_size) {
         isc_throw(InvalidOperation,
                   "HttpClient thread_pool_size must be zero "
@@ -1963,7 +2353,7 @@ HttpClient::HttpClient(const IOServicePtr& io_service, bool multi_threading_enab
     }
 
     impl_.reset(new HttpClientImpl(io_service, thread_pool_size,
-                                   defer_thread_start));
+                                   defer_thread_start, max_pipeline_depth));
 }
 
 HttpClient::~HttpClient() {
@@ -2051,6 +2441,11 @@ HttpClient::getThreadCount() const {
     return (impl_->getThreadCount());
 }
 
+size_t
+HttpClient::getMaxPipelineDepth() const {
+    return (impl_->getMaxPipelineDepth());
+}
+
 bool
 HttpClient::isRunning() {
     return (impl_->isRunning());
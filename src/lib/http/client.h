@@ -1,4 +1,4 @@
-// Copyright (C) 2018-2025 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2018-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -68,6 +68,12 @@ class HttpClientImpl;
 /// per URL. Currently, the number of connections per URL is set to the
 /// number of threads in the thread pool.
 ///
+/// When the maximum pipeline depth is greater than 1, persistent requests
+/// are pipelined over busy plain TCP connections instead of being queued:
+/// up to this number of requests can be sent over a connection before the
+/// first response is received. HTTP/1.1 responses are returned in order so
+/// the transactions of a connection complete in the order of the requests.
+///
 /// The client tests the persistent connection for usability before sending
 /// a request by trying to read from the socket (with message peeking). If
 /// the socket is usable the client uses it to transmit the request.
@@ -145,10 +151,14 @@ public:
     /// the thread pool threads will be created and started, with the
     /// operational state being RUNNING.  Applicable only when thread-pool size
     /// is greater than zero.
+    /// @param max_pipeline_depth maximum number of requests sent over a
+    /// connection and not yet answered. A value of 1 (default) disables
+    /// pipelining.
     explicit HttpClient(const asiolink::IOServicePtr& io_service,
                         bool multi_threading_enabled,
                         size_t thread_pool_size = 0,
-                        bool defer_thread_start = false);
+                        bool defer_thread_start = false,
+                        size_t max_pipeline_depth = 1);
 
     /// @brief Destructor.
     ~HttpClient();
@@ -170,6 +180,10 @@ public:
     /// If however, there is an idle connection available than a new transaction
     /// for the request will be initiated immediately upon that connection.
     ///
+    /// When pipelining is enabled and all connections are busy, a persistent
+    /// request is sent over a busy plain TCP connection which has not reached
+    /// the maximum pipeline depth, before resorting to the queue.
+    ///
     /// Note that when a connection completes a transaction, and its URL
     /// queue is not empty, it will pop a pending request from the front of
     /// the queue and begin a new transaction for that request. The net effect
@@ -311,6 +325,12 @@ public:
     /// @return the number of running threads.
     uint16_t getThreadCount() const;
 
+    /// @brief Fetches the maximum pipeline depth.
+    ///
+    /// @return the maximum number of requests sent over a connection and
+    /// not yet answered.
+    size_t getMaxPipelineDepth() const;
+
     /// @brief Indicates if the thread pool is running.
     ///
     /// @return True if the thread pool exists and it is in the RUNNING state,
@@ -79,7 +79,7 @@ HttpConnection::HttpConnection(const asiolink::IOServicePtr& io_service,
       acceptor_(acceptor), connection_pool_(connection_pool),
       response_creator_(response_creator), acceptor_callback_(callback),
       use_external_(false), watch_socket_(), defer_shutdown_(false),
-      closed_(false), registered_(false) {
+      closed_(false), pending_input_(), registered_(false) {
     if (!tls_context) {
         tcp_socket_.reset(new asiolink::TCPSocket<SocketCallback>(io_service));
     } else {
@@ -149,6 +149,7 @@ HttpConnection::shutdown() {
         return;
     }
     request_timer_.cancel();
+    pending_input_.clear();
     if (tcp_socket_) {
         if (registered_) {
             IfaceMgr::instance().deleteExternalSocket(tcp_socket_->getNative());
@@ -224,6 +225,7 @@ HttpConnection::close() {
         return;
     }
     request_timer_.cancel();
+    pending_input_.clear();
     if (tcp_socket_) {
         if (registered_) {
             IfaceMgr::instance().deleteExternalSocket(tcp_socket_->getNative());
@@ -348,6 +350,17 @@ HttpConnection::doRead(TransactionPtr transaction) {
         if (!transaction) {
             transaction = Transaction::create(response_creator_);
             recordParameters(transaction->getRequest());
+
+            // The client may have pipelined the next request: process
+            // what was already received before reading from the socket.
+            if (!pending_input_.empty()) {
+                std::string input;
+                input.swap(pending_input_);
+                transaction->getParser()->postBuffer(input.data(), input.size());
+                transaction->getParser()->poll();
+                socketReadCallback(transaction, boost::system::error_code(), 0);
+                return;
+            }
         }
 
         // Create instance of the callback. It is safe to pass the local instance
@@ -554,6 +567,9 @@ HttpConnection::socketReadCallback(HttpConnection::TransactionPtr transaction,
                 .arg(getRemoteEndpointAddressAsText())
                 .arg(transaction->getParser()->getBufferAsString(MAX_LOGGED_MESSAGE_SIZE));
 
+            // Keep what follows the request for the next transaction.
+            pending_input_ = transaction->getParser()->getBufferRemainder();
+
         } catch (const std::exception& ex) {
             LOG_DEBUG(http_logger, isc::log::DBGLVL_TRACE_BASIC,
                       HTTP_BAD_CLIENT_REQUEST_RECEIVED)
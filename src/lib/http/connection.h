@@ -468,6 +468,15 @@ protected:
     /// to avoid multiple close calls.
     bool closed_;
 
+    /// @brief Data received after the end of the last request.
+    ///
+    /// A client pipelining its requests may send the next request before
+    /// it gets the response to the previous one, so a single read can
+    /// return the end of a request and the beginning (or the whole) of
+    /// the next one. These data are fed to the parser of the next
+    /// transaction.
+    std::string pending_input_;
+
     /// @brief Flag which indicates if the connection file descriptor
     /// was registered as an external socket.
     bool registered_;
@@ -1,4 +1,4 @@
-// Copyright (C) 2017-2024 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2017-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -7,6 +7,8 @@
 #include <config.h>
 
 #include <http/http_message_parser_base.h>
+#include <algorithm>
+#include <cstring>
 #include <functional>
 #include <sstream>
 
@@ -78,6 +80,14 @@ HttpMessageParserBase::getBufferAsString(const size_t limit) const {
     return (logFormatHttpMessage(message, limit));
 }
 
+std::string
+HttpMessageParserBase::getBufferRemainder() const {
+    if (buffer_pos_ >= buffer_.size()) {
+        return (std::string());
+    }
+    return (buffer_.substr(buffer_pos_));
+}
+
 std::string
 HttpMessageParserBase::logFormatHttpMessage(const std::string& message,
                                             const size_t limit) {
@@ -153,16 +163,17 @@ HttpMessageParserBase::stateWithReadHandler(const std::string& handler_name,
 
 void
 HttpMessageParserBase::stateWithMultiReadHandler(const std::string& handler_name,
-                                                 std::function<void(const std::string&)>
-                                                 after_read_logic) {
+                                                 std::function<void(std::string)>
+                                                 after_read_logic,
+                                                 const size_t limit) {
     std::string bytes;
-    getNextFromBuffer(bytes, 0);
+    getNextFromBuffer(bytes, limit);
     // Do nothing if we reached the end of buffer.
     if (getNextEvent() != NEED_MORE_DATA_EVT) {
         switch(getNextEvent()) {
         case DATA_READ_OK_EVT:
         case MORE_DATA_PROVIDED_EVT:
-            after_read_logic(bytes);
+            after_read_logic(std::move(bytes));
             break;
         default:
             invalidEventError(handler_name, getNextEvent());
@@ -170,6 +181,26 @@ HttpMessageParserBase::stateWithMultiReadHandler(const std::string& handler_name
     }
 }
 
+void
+HttpMessageParserBase::appendRunFromBuffer(std::string& dest, const char delim) {
+    if (buffer_pos_ >= buffer_.size()) {
+        return;
+    }
+    const char* begin = buffer_.data() + buffer_pos_;
+    const char* end = buffer_.data() + buffer_.size();
+    // Find the delimiter with memchr, then check for control characters
+    // only up to it.
+    const void* found = std::memchr(begin, delim, end - begin);
+    if (found) {
+        end = static_cast<const char*>(found);
+    }
+    const char* stop = std::find_if(begin, end, [this](const char c) {
+        return (isCtl(c));
+    });
+    dest.append(begin, stop);
+    buffer_pos_ += (stop - begin);
+}
+
 void
 HttpMessageParserBase::parseFailure(const std::string& error_msg) {
     error_message_ = error_msg + " : " + getContextStr();
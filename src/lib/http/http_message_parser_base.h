@@ -1,4 +1,4 @@
-// Copyright (C) 2017-2024 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2017-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -149,6 +149,15 @@ public:
     /// @return Textual representation of the input buffer.
     std::string getBufferAsString(const size_t limit = 0) const;
 
+    /// @brief Returns the input data which have not been parsed.
+    ///
+    /// When messages are pipelined the data received after the end of
+    /// the message belong to the next message. They are returned by this
+    /// method so they can be passed to the parser of the next message.
+    ///
+    /// @return Data following the parsed message in the input buffer.
+    std::string getBufferRemainder() const;
+
     /// @brief Formats provided HTTP message for logging.
     ///
     /// This method is useful in cases when there is a need to log a HTTP message
@@ -209,15 +218,36 @@ protected:
     /// MORE_DATA_PROVIDED_EVT, it calls the provided callback function to
     /// parse the new byte of data.
     ///
+    /// The data are passed by value so the callback can take them over
+    /// (e.g. a body received at once) without copying them again.
+    ///
     /// @param handler_name Name of the handler function which called this
     /// method.
     /// @param after_read_logic Callback function to parse multiple bytes of
     /// data. This callback function implements state specific logic.
+    /// @param limit Maximum number of bytes to read, 0 means all available.
     ///
     /// @throw HttpRequestParserError when invalid event occurred.
     void stateWithMultiReadHandler(const std::string& handler_name,
-                                   std::function<void(const std::string&)>
-                                   after_read_logic);
+                                   std::function<void(std::string)>
+                                   after_read_logic,
+                                   const size_t limit = 0);
+
+    /// @brief Appends a run of characters from the buffer.
+    ///
+    /// Consumes the characters up to (not including) the first occurrence
+    /// of the delimiter or of a control character and appends them to
+    /// @c dest. The handlers of the long message elements (URI, header
+    /// values) use it after they have accepted a character so the
+    /// following ones don't go through the state model one by one. The
+    /// delimiter is found with memchr which is vectorized in the common C
+    /// libraries, then only the characters before it are checked for
+    /// control characters. The stopping character is left in the buffer
+    /// for the state handler.
+    ///
+    /// @param [out] dest String the characters are appended to.
+    /// @param delim Delimiter terminating the run.
+    void appendRunFromBuffer(std::string& dest, const char delim);
 
     /// @brief Transition parser to failure state.
     ///
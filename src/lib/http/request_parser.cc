@@ -1,4 +1,4 @@
-// Copyright (C) 2016-2020 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2016-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -200,6 +200,7 @@ HttpRequestParser::uriHandler() {
             // Still parsing the URI. Append the next character to the
             // method name.
             context_->uri_.push_back(c);
+            appendRunFromBuffer(context_->uri_, ' ');
             transition(HTTP_URI_ST, DATA_READ_OK_EVT);
         }
     });
@@ -366,6 +367,7 @@ HttpRequestParser::headerLwsHandler() {
         } else {
             // We're parsing header value, so let's update it.
             context_->headers_.back().value_.push_back(c);
+            appendRunFromBuffer(context_->headers_.back().value_, '\r');
             transition(HEADER_VALUE_ST, DATA_READ_OK_EVT);
         }
     });
@@ -409,6 +411,7 @@ HttpRequestParser::spaceBeforeHeaderValueHandler() {
         } else {
             // Still parsing the value, so let's update it.
             context_->headers_.back().value_.push_back(c);
+            appendRunFromBuffer(context_->headers_.back().value_, '\r');
             transition(HEADER_VALUE_ST, DATA_READ_OK_EVT);
         }
     });
@@ -429,6 +432,7 @@ HttpRequestParser::headerValueHandler() {
         } else {
             // Still parsing the value, so let's update it.
             context_->headers_.back().value_.push_back(c);
+            appendRunFromBuffer(context_->headers_.back().value_, '\r');
             transition(HEADER_VALUE_ST, DATA_READ_OK_EVT);
         }
     });
@@ -436,11 +440,22 @@ HttpRequestParser::headerValueHandler() {
 
 void
 HttpRequestParser::bodyHandler() {
-    stateWithMultiReadHandler("bodyHandler", [this](const std::string& body) {
+    // Do not read past the body: with pipelining the data which follow
+    // belong to the next message.
+    size_t content_length = request_.getHeaderValueAsUint64("Content-Length");
+    size_t remaining = (context_->body_.length() < content_length ?
+                        content_length - context_->body_.length() : 0);
+    stateWithMultiReadHandler("bodyHandler", [this, content_length](std::string body) {
         // We don't validate the body at this stage. Simply record the
         // number of characters specified within "Content-Length".
-        context_->body_ += body;
-        size_t content_length = request_.getHeaderValueAsUint64("Content-Length");
+        // The first chunk is taken over: a body received at once (the
+        // common case for large commands) is copied from the read buffer
+        // only once.
+        if (context_->body_.empty()) {
+            context_->body_.swap(body);
+        } else {
+            context_->body_ += body;
+        }
         if (context_->body_.length() < content_length) {
             transition(HTTP_BODY_ST, DATA_READ_OK_EVT);
 
@@ -451,7 +466,7 @@ HttpRequestParser::bodyHandler() {
             }
             transition(HTTP_PARSE_OK_ST, HTTP_PARSE_OK_EVT);
         }
-    });
+    }, remaining);
 }
 
 } // namespace http
@@ -1,4 +1,4 @@
-// Copyright (C) 2017-2020 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2017-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -368,6 +368,7 @@ HttpResponseParser::headerLwsHandler() {
         } else {
             // We're parsing header value, so let's update it.
             context_->headers_.back().value_.push_back(c);
+            appendRunFromBuffer(context_->headers_.back().value_, '\r');
             transition(HEADER_VALUE_ST, DATA_READ_OK_EVT);
         }
     });
@@ -411,6 +412,7 @@ HttpResponseParser::spaceBeforeHeaderValueHandler() {
         } else {
             // Still parsing the value, so let's update it.
             context_->headers_.back().value_.push_back(c);
+            appendRunFromBuffer(context_->headers_.back().value_, '\r');
             transition(HEADER_VALUE_ST, DATA_READ_OK_EVT);
         }
     });
@@ -431,6 +433,7 @@ HttpResponseParser::headerValueHandler() {
         } else {
             // Still parsing the value, so let's update it.
             context_->headers_.back().value_.push_back(c);
+            appendRunFromBuffer(context_->headers_.back().value_, '\r');
             transition(HEADER_VALUE_ST, DATA_READ_OK_EVT);
         }
     });
@@ -438,11 +441,22 @@ HttpResponseParser::headerValueHandler() {
 
 void
 HttpResponseParser::bodyHandler() {
-    stateWithMultiReadHandler("bodyHandler", [this](const std::string& body) {
+    // Do not read past the body: with pipelining the data which follow
+    // belong to the next message.
+    size_t content_length = response_.getHeaderValueAsUint64("Content-Length");
+    size_t remaining = (context_->body_.length() < content_length ?
+                        content_length - context_->body_.length() : 0);
+    stateWithMultiReadHandler("bodyHandler", [this, content_length](std::string body) {
         // We don't validate the body at this stage. Simply record the
         // number of characters specified within "Content-Length".
-        context_->body_ += body;
-        size_t content_length = response_.getHeaderValueAsUint64("Content-Length");
+        // The first chunk is taken over: a body received at once (the
+        // common case for large commands) is copied from the read buffer
+        // only once.
+        if (context_->body_.empty()) {
+            context_->body_.swap(body);
+        } else {
+            context_->body_ += body;
+        }
         if (context_->body_.length() < content_length) {
             transition(HTTP_BODY_ST, DATA_READ_OK_EVT);
 
@@ -453,7 +467,7 @@ HttpResponseParser::bodyHandler() {
             }
             transition(HTTP_PARSE_OK_ST, HTTP_PARSE_OK_EVT);
         }
-    });
+    }, remaining);
 }
 
 
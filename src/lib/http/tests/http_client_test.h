@@ -1,4 +1,4 @@
-// Copyright (C) 2017-2025 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2017-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -76,6 +76,173 @@ public:
     IntervalTimer run_io_service_timer_;
 };
 
+/// @brief Plain TCP server answering pipelined requests.
+///
+/// It accepts one connection and sends no response before it has received
+/// a given number of complete requests, so the client has to write them
+/// without waiting for the first response. Each request is answered with
+/// a JSON response echoing its "sequence" parameter, in request order.
+/// The server can also close the connection after a given number of
+/// responses.
+class PipelineTestServer :
+    public boost::enable_shared_from_this<PipelineTestServer> {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param io_service IO service used by the server.
+    /// @param hold number of requests to receive before the first response.
+    /// @param close_after number of responses after which the connection
+    /// is closed (0 means never).
+    PipelineTestServer(const IOServicePtr& io_service, size_t hold,
+                       size_t close_after = 0)
+        : acceptor_(io_service->getInternalIOService()),
+          socket_(io_service->getInternalIOService()), hold_(hold),
+          close_after_(close_after), received_(0), answered_(0),
+          received_before_response_(0), input_(), pending_(),
+          buf_(4096) {
+    }
+
+    /// @brief Starts accepting a connection.
+    void start() {
+        tcp::endpoint endpoint(make_address(SERVER_ADDRESS), SERVER_PORT);
+        acceptor_.open(endpoint.protocol());
+        acceptor_.set_option(tcp::acceptor::reuse_address(true));
+        acceptor_.bind(endpoint);
+        acceptor_.listen();
+        auto self(shared_from_this());
+        acceptor_.async_accept(socket_,
+            [self](const boost::system::error_code& ec) {
+                if (!ec) {
+                    self->doRead();
+                }
+            });
+    }
+
+    /// @brief Closes the acceptor and the connection.
+    void stop() {
+        boost::system::error_code ec;
+        acceptor_.close(ec);
+        socket_.close(ec);
+    }
+
+    /// @brief Returns the number of requests received before the first
+    /// response was sent.
+    size_t getReceivedBeforeResponse() const {
+        return (received_before_response_);
+    }
+
+private:
+
+    /// @brief Reads from the connection.
+    void doRead() {
+        auto self(shared_from_this());
+        socket_.async_read_some(boost::asio::buffer(buf_),
+            [self](const boost::system::error_code& ec, size_t length) {
+                if (ec) {
+                    return;
+                }
+                self->input_.append(&self->buf_[0], length);
+                self->parseRequests();
+                if ((self->answered_ == 0) && (self->received_ < self->hold_)) {
+                    self->doRead();
+                    return;
+                }
+                self->doWrite();
+            });
+    }
+
+    /// @brief Extracts the sequence numbers of the complete requests.
+    void parseRequests() {
+        for (;;) {
+            size_t end = input_.find("\r\n\r\n");
+            if (end == std::string::npos) {
+                return;
+            }
+            size_t length = 0;
+            size_t pos = input_.find("Content-Length: ");
+            if ((pos != std::string::npos) && (pos < end)) {
+                length = std::stoul(input_.substr(pos + 16));
+            }
+            end += 4;
+            if (input_.size() < end + length) {
+                return;
+            }
+            ConstElementPtr body = Element::fromJSON(input_.substr(end, length));
+            pending_.push_back(body->get("sequence")->intValue());
+            input_.erase(0, end + length);
+            ++received_;
+        }
+    }
+
+    /// @brief Answers the pending requests.
+    void doWrite() {
+        if (answered_ == 0) {
+            received_before_response_ = received_;
+        }
+        bool close = false;
+        auto output(boost::make_shared<std::string>());
+        for (auto sequence : pending_) {
+            if ((close_after_ > 0) && (answered_ == close_after_)) {
+                close = true;
+                break;
+            }
+            std::string body = "{ \"sequence\": " + std::to_string(sequence) + " }";
+            *output += "HTTP/1.1 200 OK\r\n"
+                "Content-Length: " + std::to_string(body.size()) + "\r\n"
+                "Content-Type: application/json\r\n\r\n" + body;
+            ++answered_;
+        }
+        pending_.clear();
+        auto self(shared_from_this());
+        boost::asio::async_write(socket_, boost::asio::buffer(*output),
+            [self, output, close](const boost::system::error_code& ec, size_t) {
+                if (ec) {
+                    return;
+                }
+                if (close) {
+                    boost::system::error_code ignored;
+                    self->socket_.close(ignored);
+                    return;
+                }
+                self->doRead();
+            });
+    }
+
+    /// @brief Acceptor.
+    tcp::acceptor acceptor_;
+
+    /// @brief Accepted connection.
+    tcp::socket socket_;
+
+    /// @brief Number of requests to receive before the first response.
+    size_t hold_;
+
+    /// @brief Number of responses after which the connection is closed.
+    size_t close_after_;
+
+    /// @brief Number of received requests.
+    size_t received_;
+
+    /// @brief Number of sent responses.
+    size_t answered_;
+
+    /// @brief Number of requests received before the first response.
+    size_t received_before_response_;
+
+    /// @brief Received data not yet parsed.
+    std::string input_;
+
+    /// @brief Sequence numbers of the requests to answer.
+    std::vector<int> pending_;
+
+    /// @brief Read buffer.
+    std::vector<char> buf_;
+};
+
+/// @brief Pointer to the @ref PipelineTestServer.
+typedef boost::shared_ptr<PipelineTestServer> PipelineTestServerPtr;
+
 /// @brief Test fixture class for testing HTTP client.
 class BaseHttpClientTest : public HttpListenerTest {
 public:
@@ -189,6 +356,164 @@ public:
         EXPECT_NE(sequence1->intValue(), sequence2->intValue());
     }
 
+    /// @brief Test that requests can be pipelined over a persistent
+    /// connection and that they complete in order.
+    ///
+    /// The server does not answer before it has received as many requests
+    /// as the pipeline depth, so the test also checks that the client wrote
+    /// them before reading the first response.
+    ///
+    /// @param max_pipeline_depth maximum pipeline depth of the client.
+    void testPipelinedRequests(size_t max_pipeline_depth) {
+        // Start the server.
+        PipelineTestServerPtr server(new PipelineTestServer(io_service_,
+                                                            max_pipeline_depth));
+        ASSERT_NO_THROW(server->start());
+
+        // Create a client and specify the URL on which the server can be reached.
+        HttpClient client(io_service_, false, 0, false, max_pipeline_depth);
+        EXPECT_EQ(max_pipeline_depth, client.getMaxPipelineDepth());
+        Url url("http://127.0.0.1:18123");
+
+        // Send the requests without waiting for the responses.
+        const int count = 8;
+        std::vector<HttpResponseJsonPtr> responses;
+        std::vector<int> completed;
+        for (int i = 0; i < count; ++i) {
+            PostHttpRequestJsonPtr request = createRequest("sequence", i);
+            HttpResponseJsonPtr response(new HttpResponseJson());
+            responses.push_back(response);
+            ASSERT_NO_THROW(client.asyncSendRequest(url, client_context_,
+                                                    request, response,
+                [this, i, &completed](const boost::system::error_code& ec,
+                                      const HttpResponsePtr&,
+                                      const std::string&) {
+                    completed.push_back(i);
+                    if (completed.size() == count) {
+                        io_service_->stop();
+                    }
+                    if (ec) {
+                        ADD_FAILURE() << "asyncSendRequest failed: " << ec.message();
+                    }
+                }));
+        }
+
+        ASSERT_NO_THROW(runIOService());
+        server->stop();
+
+        // The requests filling the pipeline were all written before the
+        // first response was read.
+        EXPECT_EQ(max_pipeline_depth, server->getReceivedBeforeResponse());
+
+        // The transactions complete in order and each response matches
+        // its request.
+        ASSERT_EQ(count, completed.size());
+        for (int i = 0; i < count; ++i) {
+            EXPECT_EQ(i, completed[i]);
+            ConstElementPtr sequence = responses[i]->getJsonElement("sequence");
+            ASSERT_TRUE(sequence);
+            EXPECT_EQ(i, sequence->intValue());
+        }
+    }
+
+    /// @brief Test that pipelined requests are answered by the listener.
+    ///
+    /// @param max_pipeline_depth maximum pipeline depth of the client.
+    void testPipelinedRequestsToListener(size_t max_pipeline_depth) {
+        // Start the server.
+        ASSERT_NO_THROW(listener_->start());
+
+        // Create a client and specify the URL on which the server can be reached.
+        HttpClient client(io_service_, false, 0, false, max_pipeline_depth);
+        Url url("http://127.0.0.1:18123");
+
+        // Send the requests without waiting for the responses.
+        const int count = 8;
+        std::vector<HttpResponseJsonPtr> responses;
+        std::vector<int> completed;
+        for (int i = 0; i < count; ++i) {
+            PostHttpRequestJsonPtr request = createRequest("sequence", i);
+            HttpResponseJsonPtr response(new HttpResponseJson());
+            responses.push_back(response);
+            ASSERT_NO_THROW(client.asyncSendRequest(url, client_context_,
+                                                    request, response,
+                [this, i, &completed](const boost::system::error_code& ec,
+                                      const HttpResponsePtr&,
+                                      const std::string&) {
+                    completed.push_back(i);
+                    if (completed.size() == count) {
+                        io_service_->stop();
+                    }
+                    if (ec) {
+                        ADD_FAILURE() << "asyncSendRequest failed: " << ec.message();
+                    }
+                }));
+        }
+
+        ASSERT_NO_THROW(runIOService());
+
+        // Each response matches its request.
+        ASSERT_EQ(count, completed.size());
+        for (int i = 0; i < count; ++i) {
+            EXPECT_EQ(i, completed[i]);
+            ConstElementPtr sequence = responses[i]->getJsonElement("sequence");
+            ASSERT_TRUE(sequence);
+            EXPECT_EQ(i, sequence->intValue());
+        }
+    }
+
+    /// @brief Test that all the pipelined transactions fail when the
+    /// server closes the connection in the middle of the pipeline.
+    ///
+    /// @param max_pipeline_depth maximum pipeline depth of the client.
+    void testPipelinedRequestsClosed(size_t max_pipeline_depth) {
+        // Start a server closing the connection after the first response.
+        PipelineTestServerPtr server(new PipelineTestServer(io_service_,
+                                                            max_pipeline_depth,
+                                                            1));
+        ASSERT_NO_THROW(server->start());
+
+        HttpClient client(io_service_, false, 0, false, max_pipeline_depth);
+        Url url("http://127.0.0.1:18123");
+
+        // Fill the pipeline.
+        const int count = static_cast<int>(max_pipeline_depth);
+        std::vector<int> completed;
+        std::vector<boost::system::error_code> errors;
+        for (int i = 0; i < count; ++i) {
+            PostHttpRequestJsonPtr request = createRequest("sequence", i);
+            HttpResponseJsonPtr response(new HttpResponseJson());
+            ASSERT_NO_THROW(client.asyncSendRequest(url, client_context_,
+                                                    request, response,
+                [this, i, count, &completed, &errors]
+                (const boost::system::error_code& ec,
+                 const HttpResponsePtr&,
+                 const std::string&) {
+                    completed.push_back(i);
+                    errors.push_back(ec);
+                    if (completed.size() == static_cast<size_t>(count)) {
+                        io_service_->stop();
+                    }
+                }));
+        }
+
+        ASSERT_NO_THROW(runIOService());
+        server->stop();
+
+        // The first transaction succeeded and every other one got the
+        // error.
+        ASSERT_EQ(count, completed.size());
+        EXPECT_EQ(max_pipeline_depth, server->getReceivedBeforeResponse());
+        for (int i = 0; i < count; ++i) {
+            EXPECT_EQ(i, completed[i]);
+            if (i == 0) {
+                EXPECT_FALSE(errors[i]) << errors[i].message();
+            } else {
+                EXPECT_TRUE(errors[i]) << "transaction " << i;
+            }
+        }
+    }
+
     /// @brief Test that the client can communicate with two different
     /// destinations simultaneously.
     void testMultipleDestinations() {
@@ -1,4 +1,4 @@
-// Copyright (C) 2017-2024 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2017-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -31,6 +31,7 @@
 #include <list>
 #include <sstream>
 #include <string>
+#include <vector>
 
 // Keep order of these headers.
 #include <http/tests/http_tests.h>
@@ -95,6 +96,40 @@ TEST_F(HttpClientTest, consecutiveRequestsMultiThreading) {
     ASSERT_NO_FATAL_FAILURE(testConsecutiveRequests(HttpVersion(1, 1)));
 }
 
+// Test that requests can be pipelined over the same (persistent) connection.
+TEST_F(HttpClientTest, pipelinedRequests) {
+    ASSERT_NO_FATAL_FAILURE(testPipelinedRequests(4));
+}
+
+// Test that requests can be pipelined over the same (persistent) connection.
+TEST_F(HttpClientTest, pipelinedRequestsMultiThreading) {
+    MultiThreadingMgr::instance().setMode(true);
+    ASSERT_NO_FATAL_FAILURE(testPipelinedRequests(4));
+}
+
+// Test that requests are queued in order when the pipeline depth is 1.
+TEST_F(HttpClientTest, pipelinedRequestsDisabled) {
+    ASSERT_NO_FATAL_FAILURE(testPipelinedRequests(1));
+}
+
+// Test that the listener answers pipelined requests.
+TEST_F(HttpClientTest, pipelinedRequestsToListener) {
+    ASSERT_NO_FATAL_FAILURE(testPipelinedRequestsToListener(4));
+}
+
+// Test that the pipelined transactions fail when the server closes the
+// connection in the middle of the pipeline.
+TEST_F(HttpClientTest, pipelinedRequestsClosed) {
+    ASSERT_NO_FATAL_FAILURE(testPipelinedRequestsClosed(4));
+}
+
+// Test that the pipelined transactions fail when the server closes the
+// connection in the middle of the pipeline.
+TEST_F(HttpClientTest, pipelinedRequestsClosedMultiThreading) {
+    MultiThreadingMgr::instance().setMode(true);
+    ASSERT_NO_FATAL_FAILURE(testPipelinedRequestsClosed(4));
+}
+
 // Test that two consecutive requests can be sent over non-persistent connection.
 // This is achieved by sending HTTP/1.0 requests, which are non-persistent by
 // default. The client should close the connection right after receiving a response
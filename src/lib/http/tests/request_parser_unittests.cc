@@ -10,7 +10,11 @@
 #include <http/http_types.h>
 #include <http/request_parser.h>
 #include <http/post_request_json.h>
+#include <util/chrono_time_utils.h>
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
 #include <sstream>
 
 using namespace isc::data;
@@ -131,6 +135,56 @@ TEST_F(HttpRequestParserTest, postHttpRequestWithJson) {
     EXPECT_EQ("shutdown", json_element->stringValue());
 }
 
+// This test verifies that a large request received in chunks which split
+// the URI, the header values and the body is parsed correctly.
+TEST_F(HttpRequestParserTest, largeRequestInChunks) {
+    std::string uri = "/" + std::string(1000, 'u');
+    std::string value(1000, 'v');
+    std::string http_req = "POST " + uri + " HTTP/1.1\r\n"
+        "Content-Type: application/json\r\n"
+        "X-Long: " + value + "\r\n";
+    std::ostringstream json;
+    json << "{ \"command\": \"config-set\", \"arguments\": [ 0";
+    for (int i = 1; i < 100000; ++i) {
+        json << ", " << i;
+    }
+    json << " ] }";
+
+    http_req = createRequestString(http_req, json.str());
+
+    PostHttpRequestJson request;
+    HttpRequestParser parser(request);
+    ASSERT_NO_THROW(parser.initModel());
+
+    // Use a chunk size which is not a divisor of the element lengths.
+    const size_t chunk = 777;
+    for (size_t i = 0; i < http_req.size(); i += chunk) {
+        parser.postBuffer(&http_req[i], std::min(chunk, http_req.size() - i));
+        ASSERT_NO_THROW(parser.poll());
+    }
+
+    ASSERT_FALSE(parser.needData());
+    ASSERT_TRUE(parser.httpParseOk());
+    EXPECT_TRUE(parser.getErrorMessage().empty());
+
+    EXPECT_EQ(uri, request.getUri());
+    EXPECT_EQ(value, request.getHeaderValue("X-Long"));
+    EXPECT_EQ(json.str(), request.getBody());
+
+    ConstElementPtr arguments;
+    ASSERT_NO_THROW(arguments = request.getJsonElement("arguments"));
+    ASSERT_TRUE(arguments);
+    EXPECT_EQ(100000U, arguments->size());
+}
+
+// This test verifies that a control character in the middle of a header
+// value is still detected.
+TEST_F(HttpRequestParserTest, controlCharacterInHeaderValue) {
+    std::string http_req = "POST /foo/ HTTP/1.1\r\n"
+        "Content-Type: text/\x01html\r\n\r\n";
+    testInvalidHttpRequest(http_req);
+}
+
 // This test verifies that extraneous data in the request will not cause
 // an error if "Content-Length" value refers to the length of the valid
 // part of the request.
@@ -384,4 +438,42 @@ TEST_F(HttpRequestParserTest, parseEmptyRequest) {
     EXPECT_EQ(1U, request_.getHttpVersion().minor_);
 }
 
+// This is a performance benchmark that checks how long does it take to
+// parse a large request: a command carrying about 1MB of JSON received
+// in 32KB chunks, as read from a socket, with long URI and header values.
+TEST_F(HttpRequestParserTest, DISABLED_performanceLargeRequest) {
+    std::string http_req = "POST /" + std::string(1000, 'u') + " HTTP/1.1\r\n"
+        "Content-Type: application/json\r\n"
+        "X-Long: " + std::string(4000, 'v') + "\r\n";
+    std::ostringstream json;
+    json << "{ \"command\": \"lease4-bulk-apply\", \"arguments\": { \"leases\": [ ";
+    for (int i = 0; i < 10000; ++i) {
+        json << (i ? ", " : "")
+             << "{ \"ip-address\": \"10.0." << (i / 256) << "." << (i % 256)
+             << "\", \"hw-address\": \"00:01:02:03:04:05\", \"subnet-id\": 1 }";
+    }
+    json << " ] } }";
+    http_req = createRequestString(http_req, json.str());
+
+    const size_t chunk = 32768;
+    const size_t cycles = 100;
+
+    auto before = std::chrono::steady_clock::now();
+    for (size_t c = 0; c < cycles; ++c) {
+        PostHttpRequestJson request;
+        HttpRequestParser parser(request);
+        parser.initModel();
+        for (size_t i = 0; i < http_req.size(); i += chunk) {
+            parser.postBuffer(&http_req[i], std::min(chunk, http_req.size() - i));
+            parser.poll();
+        }
+        ASSERT_TRUE(parser.httpParseOk()) << parser.getErrorMessage();
+    }
+    auto after = std::chrono::steady_clock::now();
+
+    std::cout << "Parsing a request of " << http_req.size() << " bytes "
+              << cycles << " times took: "
+              << isc::util::durationToText(after - before) << std::endl;
+}
+
 }
@@ -9,7 +9,11 @@
 #include <cc/data.h>
 #include <http/response_json.h>
 #include <http/response_parser.h>
+#include <util/chrono_time_utils.h>
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
 #include <string>
 
 using namespace isc;
@@ -188,6 +192,43 @@ TEST_F(HttpResponseParserTest, extraneousDataInResponse) {
     EXPECT_TRUE(parser.getErrorMessage().empty());
 }
 
+// This test verifies that the data following a response (e.g. the next
+// pipelined response) are left in the buffer and can be parsed by the
+// next parser.
+TEST_F(HttpResponseParserTest, pipelinedResponses) {
+    std::string preamble = "HTTP/1.1 200 OK\r\n"
+        "Content-Type: application/json\r\n";
+    std::string json1 = "{ \"sequence\": 1 }";
+    std::string json2 = "{ \"sequence\": 2 }";
+    std::string http_resp2 = createResponseString(preamble, json2);
+    std::string http_resp = createResponseString(preamble, json1) + http_resp2;
+
+    HttpResponseJson response1;
+    HttpResponseParser parser1(response1);
+    ASSERT_NO_THROW(parser1.initModel());
+    parser1.postBuffer(&http_resp[0], http_resp.size());
+    ASSERT_NO_THROW(parser1.poll());
+    ASSERT_FALSE(parser1.needData());
+    ASSERT_TRUE(parser1.httpParseOk());
+    ASSERT_NO_THROW(response1.finalize());
+    EXPECT_EQ(1, response1.getJsonElement("sequence")->intValue());
+
+    // The second response has not been consumed.
+    std::string remainder = parser1.getBufferRemainder();
+    EXPECT_EQ(http_resp2, remainder);
+
+    HttpResponseJson response2;
+    HttpResponseParser parser2(response2);
+    ASSERT_NO_THROW(parser2.initModel());
+    parser2.postBuffer(&remainder[0], remainder.size());
+    ASSERT_NO_THROW(parser2.poll());
+    ASSERT_FALSE(parser2.needData());
+    ASSERT_TRUE(parser2.httpParseOk());
+    ASSERT_NO_THROW(response2.finalize());
+    EXPECT_EQ(2, response2.getJsonElement("sequence")->intValue());
+    EXPECT_TRUE(parser2.getBufferRemainder().empty());
+}
+
 // This test verifies that LWS is parsed correctly. The LWS (linear white
 // space) marks line breaks in the HTTP header values.
 TEST_F(HttpResponseParserTest, getLWS) {
@@ -348,4 +389,42 @@ TEST_F(HttpResponseParserTest, parseEmptyResponse) {
     EXPECT_EQ("OK", response_.getStatusPhrase());
 }
 
+// This is a performance benchmark that checks how long does it take to
+// parse a large response: about 1MB of JSON received in 32KB chunks, as
+// read from a socket.
+TEST_F(HttpResponseParserTest, DISABLED_performanceLargeResponse) {
+    std::string http_resp = "HTTP/1.1 200 OK\r\n"
+        "Content-Type: application/json\r\n"
+        "X-Long: " + std::string(4000, 'v') + "\r\n";
+    std::ostringstream json;
+    json << "[ { \"result\": 0, \"text\": \"Leases found\", \"arguments\": { \"leases\": [ ";
+    for (int i = 0; i < 10000; ++i) {
+        json << (i ? ", " : "")
+             << "{ \"ip-address\": \"10.0." << (i / 256) << "." << (i % 256)
+             << "\", \"hw-address\": \"00:01:02:03:04:05\", \"subnet-id\": 1 }";
+    }
+    json << " ] } } ]";
+    http_resp = createResponseString(http_resp, json.str());
+
+    const size_t chunk = 32768;
+    const size_t cycles = 100;
+
+    auto before = std::chrono::steady_clock::now();
+    for (size_t c = 0; c < cycles; ++c) {
+        HttpResponseJson response;
+        HttpResponseParser parser(response);
+        parser.initModel();
+        for (size_t i = 0; i < http_resp.size(); i += chunk) {
+            parser.postBuffer(&http_resp[i], std::min(chunk, http_resp.size() - i));
+            parser.poll();
+        }
+        ASSERT_TRUE(parser.httpParseOk()) << parser.getErrorMessage();
+    }
+    auto after = std::chrono::steady_clock::now();
+
+    std::cout << "Parsing a response of " << http_resp.size() << " bytes "
+              << cycles << " times took: "
+              << isc::util::durationToText(after - before) << std::endl;
+}
+
 }
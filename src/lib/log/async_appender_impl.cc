@@ -0,0 +1,316 @@
+// Copyright (C) 2026 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <log/async_appender_impl.h>
+#include <log/log_formatter.h>
+#include <log/log_messages.h>
+#include <log/message_dictionary.h>
+
+#include <log4cplus/loglevel.h>
+#include <log4cplus/version.h>
+#include <boost/lexical_cast.hpp>
+#include <boost/weak_ptr.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <map>
+
+namespace isc {
+namespace log {
+namespace internal {
+
+boost::shared_ptr<AsyncWriter>
+AsyncWriter::instance() {
+    static std::mutex instance_mutex;
+    static boost::weak_ptr<AsyncWriter> instance_weak;
+    std::lock_guard<std::mutex> lk(instance_mutex);
+    boost::shared_ptr<AsyncWriter> writer = instance_weak.lock();
+    if (!writer) {
+        writer.reset(new AsyncWriter());
+        instance_weak = writer;
+    }
+    return (writer);
+}
+
+AsyncWriter::AsyncWriter() : signaled_(false), busy_(false), running_(true) {
+    thread_ = std::thread(&AsyncWriter::run, this);
+}
+
+AsyncWriter::~AsyncWriter() {
+    {
+        std::lock_guard<std::mutex> lk(mutex_);
+        running_ = false;
+    }
+    queue_cv_.notify_all();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+void
+AsyncWriter::add(AsyncAppender* appender) {
+    std::lock_guard<std::mutex> lk(mutex_);
+    appenders_.push_back(appender);
+}
+
+void
+AsyncWriter::remove(AsyncAppender* appender) {
+    std::unique_lock<std::mutex> lk(mutex_);
+    idle_cv_.wait(lk, [this]() { return (!busy_); });
+    appenders_.erase(std::remove(appenders_.begin(), appenders_.end(), appender),
+                     appenders_.end());
+}
+
+void
+AsyncWriter::signal() {
+    {
+        std::lock_guard<std::mutex> lk(mutex_);
+        signaled_ = true;
+    }
+    queue_cv_.notify_one();
+}
+
+void
+AsyncWriter::run() {
+    // The batches taken from the appenders, in the order of appenders_.
+    std::vector<std::vector<AsyncAppender::EventPtr> > events;
+    std::vector<uint64_t> dropped;
+
+    std::unique_lock<std::mutex> lk(mutex_);
+    for (;;) {
+        queue_cv_.wait(lk, [this]() {
+            return (!running_ || signaled_);
+        });
+        if (!running_) {
+            // The appenders are gone.
+            break;
+        }
+        signaled_ = false;
+        // Take the whole buffers so the producers only contend with the
+        // writer for the time of a swap.
+        std::vector<AsyncAppender*> appenders(appenders_);
+        events.resize(appenders.size());
+        dropped.resize(appenders.size());
+        for (size_t i = 0; i < appenders.size(); ++i) {
+            // Clear the flag first so an event buffered after the take
+            // wakes up the writer again.
+            appenders[i]->signaled_ = false;
+            appenders[i]->take(events[i]);
+            dropped[i] = appenders[i]->dropped_.exchange(0);
+        }
+        busy_ = true;
+        lk.unlock();
+
+        // The appenders can't be removed while busy_ is set.
+        for (size_t i = 0; i < appenders.size(); ++i) {
+            if (!events[i].empty() || (dropped[i] > 0)) {
+                appenders[i]->write(events[i], dropped[i]);
+                events[i].clear();
+            }
+        }
+
+        lk.lock();
+        busy_ = false;
+        idle_cv_.notify_all();
+    }
+    idle_cv_.notify_all();
+}
+
+AsyncAppender::AsyncAppender(log4cplus::SharedAppenderPtr target,
+                             size_t queue_size, const std::string& root_name)
+    : writer_(AsyncWriter::instance()), target_(target),
+      queue_size_(std::max(queue_size, size_t(1))), root_name_(root_name),
+      id_(0), queued_(0), sequence_(0), dropped_(0), dropped_total_(0),
+      running_(true), signaled_(false) {
+    static std::atomic<uint64_t> next_id(0);
+    id_ = ++next_id;
+    writer_->add(this);
+}
+
+AsyncAppender::~AsyncAppender() {
+    try {
+        destructorImpl();
+    } catch (...) {
+        // Nothing can be done about it here.
+    }
+}
+
+void
+AsyncAppender::close() {
+    if (closed) {
+        return;
+    }
+    running_ = false;
+    flush();
+    writer_->remove(this);
+    target_->close();
+    closed = true;
+}
+
+void
+AsyncAppender::flush() {
+    std::unique_lock<std::mutex> lk(writer_->mutex_);
+    writer_->idle_cv_.wait(lk, [this]() {
+        return ((queued_ == 0) && (dropped_ == 0) && !writer_->busy_);
+    });
+}
+
+uint64_t
+AsyncAppender::getDropped() const {
+    return (dropped_total_);
+}
+
+AsyncAppender::ThreadBuffer*
+AsyncAppender::getBuffer() {
+    // The buffer used last by the calling thread. Identifiers are never
+    // reused and the appender owns its buffers, so the pointer is valid
+    // when the identifier matches.
+    thread_local uint64_t last_id = 0;
+    thread_local ThreadBuffer* last_buffer = 0;
+    if (last_id == id_) {
+        return (last_buffer);
+    }
+
+    // The buffers of the calling thread, by appender identifier. The
+    // entries of destroyed appenders expire.
+    thread_local std::map<uint64_t, boost::weak_ptr<ThreadBuffer> > buffers;
+    auto it = buffers.find(id_);
+    if (it != buffers.end()) {
+        ThreadBufferPtr buffer = it->second.lock();
+        if (buffer) {
+            last_id = id_;
+            last_buffer = buffer.get();
+            return (last_buffer);
+        }
+    }
+    for (it = buffers.begin(); it != buffers.end(); ) {
+        if (it->second.expired()) {
+            it = buffers.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    ThreadBufferPtr buffer(new ThreadBuffer());
+    {
+        std::lock_guard<std::mutex> lk(writer_->mutex_);
+        buffers_.push_back(buffer);
+    }
+    buffers[id_] = buffer;
+    last_id = id_;
+    last_buffer = buffer.get();
+    return (last_buffer);
+}
+
+void
+AsyncAppender::signal() {
+    // Check first to avoid a write to the shared flag for every event.
+    if (!signaled_.load() && !signaled_.exchange(true)) {
+        writer_->signal();
+    }
+}
+
+void
+AsyncAppender::take(std::vector<EventPtr>& events) {
+    // Each buffer is in emission order: merging by sequence number
+    // restores the order between threads.
+    auto before = [](const SequencedEvent& a, const SequencedEvent& b) {
+        return (a.first < b.first);
+    };
+    std::vector<SequencedEvent> taken;
+    for (auto const& buffer : buffers_) {
+        std::lock_guard<std::mutex> lk(buffer->mutex_);
+        if (buffer->events_.empty()) {
+            continue;
+        }
+        if (taken.empty()) {
+            taken.swap(buffer->events_);
+        } else {
+            size_t middle = taken.size();
+            taken.insert(taken.end(),
+                         std::make_move_iterator(buffer->events_.begin()),
+                         std::make_move_iterator(buffer->events_.end()));
+            buffer->events_.clear();
+            std::inplace_merge(taken.begin(), taken.begin() + middle,
+                               taken.end(), before);
+        }
+    }
+    if (taken.empty()) {
+        return;
+    }
+    queued_ -= taken.size();
+    events.reserve(events.size() + taken.size());
+    for (auto& event : taken) {
+        events.push_back(std::move(event.second));
+    }
+}
+
+void
+AsyncAppender::append(const log4cplus::spi::InternalLoggingEvent& event) {
+    // Clone outside of the critical section and capture the thread
+    // specific data (thread name, NDC, MDC) while still running in the
+    // thread which emitted the event.
+#if LOG4CPLUS_VERSION < LOG4CPLUS_MAKE_VERSION(2, 0, 0)
+    std::auto_ptr<log4cplus::spi::InternalLoggingEvent>
+#else
+    std::unique_ptr<log4cplus::spi::InternalLoggingEvent>
+#endif
+        event_aptr = event.clone();
+    event_aptr->gatherThreadSpecificData();
+    EventPtr queued(event_aptr.release());
+
+    if (!running_) {
+        ++dropped_total_;
+        return;
+    }
+    if (queued_++ >= queue_size_) {
+        --queued_;
+        ++dropped_;
+        ++dropped_total_;
+        signal();
+        return;
+    }
+    ThreadBuffer* buffer = getBuffer();
+    {
+        std::lock_guard<std::mutex> lk(buffer->mutex_);
+        buffer->events_.push_back(SequencedEvent(sequence_++, queued));
+    }
+    signal();
+}
+
+void
+AsyncAppender::write(const std::vector<EventPtr>& events, uint64_t dropped) {
+    for (auto const& event : events) {
+        try {
+            target_->doAppend(*event);
+        } catch (...) {
+            // The background thread must survive a failing target.
+        }
+    }
+
+    if (dropped == 0) {
+        return;
+    }
+
+    // Report the overload through the target so it ends up in the same
+    // output as the messages which were lost.
+    std::string message(std::string(LOG_ASYNC_MESSAGES_DROPPED) + " " +
+        MessageDictionary::globalDictionary()->getText(LOG_ASYNC_MESSAGES_DROPPED));
+    replacePlaceholder(message, boost::lexical_cast<std::string>(dropped), 1);
+    log4cplus::spi::InternalLoggingEvent event(root_name_,
+                                               log4cplus::WARN_LOG_LEVEL,
+                                               message, __FILE__, __LINE__);
+    try {
+        target_->doAppend(event);
+    } catch (...) {
+        // Ignore as above.
+    }
+}
+
+} // end namespace internal
+} // end namespace log
+} // end namespace isc
@@ -0,0 +1,256 @@
+// Copyright (C) 2026 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef LOG_ASYNC_APPENDER_H
+#define LOG_ASYNC_APPENDER_H
+
+#include <log4cplus/appender.h>
+#include <log4cplus/spi/loggingevent.h>
+#include <boost/shared_ptr.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace isc {
+namespace log {
+namespace internal {
+
+class AsyncAppender;
+
+/// \brief Background thread shared by the asynchronous appenders
+///
+/// All \c AsyncAppender instances are written by this single thread,
+/// so configuring several outputs does not start several threads.  The
+/// writer is created with the first appender and stopped when the last
+/// one is destroyed.  The mutex of the writer protects the list of
+/// appenders and their buffer lists; it is taken by the threads emitting
+/// log messages only to wake up the writer once per batch.
+class AsyncWriter {
+public:
+    /// \brief Returns the writer, creating it if needed
+    static boost::shared_ptr<AsyncWriter> instance();
+
+    /// \brief Destructor
+    ///
+    /// Stops the background thread.
+    ~AsyncWriter();
+
+private:
+    friend class AsyncAppender;
+
+    /// \brief Constructor
+    ///
+    /// Starts the background thread.
+    AsyncWriter();
+
+    /// \brief Register an appender
+    ///
+    /// \param appender The appender, written until it is removed.
+    void add(AsyncAppender* appender);
+
+    /// \brief Unregister an appender
+    ///
+    /// Waits for the batch being written, which may belong to the
+    /// appender, to complete.
+    ///
+    /// \param appender The appender.
+    void remove(AsyncAppender* appender);
+
+    /// \brief Wake up the background thread
+    void signal();
+
+    /// \brief Background thread body
+    void run();
+
+    /// \brief Registered appenders
+    std::vector<AsyncAppender*> appenders_;
+
+    /// \brief True when an appender has events to write
+    bool signaled_;
+
+    /// \brief True while the background thread is writing a batch
+    bool busy_;
+
+    /// \brief True while the background thread should run
+    bool running_;
+
+    /// \brief Mutex protecting the appenders and their queues
+    std::mutex mutex_;
+
+    /// \brief Signaled when events are queued or on stop
+    std::condition_variable queue_cv_;
+
+    /// \brief Signaled when a batch has been written
+    std::condition_variable idle_cv_;
+
+    /// \brief The background thread
+    std::thread thread_;
+};
+
+/// \brief Asynchronous Logger Appender
+///
+/// This class wraps another log4cplus appender (the target: a console,
+/// file or syslog appender) and decouples the threads emitting log
+/// messages from the (potentially slow) output.  Logging events passed
+/// to \c append() are cloned into a buffer owned by the calling thread
+/// and the background thread of the \c AsyncWriter takes all buffers,
+/// restores the emission order with a sequence number and hands the
+/// events over to the target appender in batches, so the caller never
+/// waits for a write or a flush.  As each thread has its own buffer
+/// the callers never contend with each other on a queue mutex, only
+/// with the writer when it takes their buffer.  The writer thread is
+/// shared by all asynchronous appenders: a stalled output delays the
+/// others, but never the callers.
+///
+/// The queue size bounds the total number of buffered events of the
+/// appender.  When it is reached the event is dropped instead of blocking
+/// the caller: logging must never be allowed to stall packet processing.
+/// The number of dropped events is counted and reported through the
+/// target appender (LOG_ASYNC_MESSAGES_DROPPED) once the background
+/// thread catches up.
+///
+/// The timestamp, thread and diagnostic context of an event are captured
+/// when it is queued so the output is identical to the synchronous case.
+class AsyncAppender : public log4cplus::Appender {
+public:
+    /// \brief Constructor
+    ///
+    /// Registers the appender with the shared writer.
+    ///
+    /// \param target The appender the events are written to.
+    /// \param queue_size Maximum number of queued events (at least 1).
+    /// \param root_name Name of the logger used to report dropped events.
+    AsyncAppender(log4cplus::SharedAppenderPtr target, size_t queue_size,
+                  const std::string& root_name);
+
+    /// \brief Destructor
+    ///
+    /// Any queued events are written before the target is closed.
+    virtual ~AsyncAppender();
+
+    /// \brief Close the appender
+    ///
+    /// Writes all queued events, unregisters the appender from the
+    /// writer and closes the target appender.
+    virtual void close();
+
+    /// \brief Wait until all queued events have been written
+    ///
+    /// Mainly useful for testing and before the process exits.
+    void flush();
+
+    /// \brief Returns the target appender
+    log4cplus::SharedAppenderPtr getTarget() const {
+        return (target_);
+    }
+
+    /// \brief Returns the maximum number of queued events
+    size_t getQueueSize() const {
+        return (queue_size_);
+    }
+
+    /// \brief Returns the shared writer
+    boost::shared_ptr<AsyncWriter> getWriter() const {
+        return (writer_);
+    }
+
+    /// \brief Returns the total number of dropped events
+    uint64_t getDropped() const;
+
+protected:
+    /// \brief Queue an event
+    ///
+    /// \param event The event to be written by the background thread.
+    virtual void append(const log4cplus::spi::InternalLoggingEvent& event);
+
+private:
+    friend class AsyncWriter;
+
+    /// \brief Convenience typedef for a pointer to a log event
+    typedef boost::shared_ptr<log4cplus::spi::InternalLoggingEvent> EventPtr;
+
+    /// \brief An event with its sequence number
+    typedef std::pair<uint64_t, EventPtr> SequencedEvent;
+
+    /// \brief Events buffered by one thread
+    struct ThreadBuffer {
+        /// \brief Mutex protecting the events
+        std::mutex mutex_;
+
+        /// \brief The buffered events
+        std::vector<SequencedEvent> events_;
+    };
+
+    /// \brief Convenience typedef for a pointer to a thread buffer
+    typedef boost::shared_ptr<ThreadBuffer> ThreadBufferPtr;
+
+    /// \brief Returns the buffer of the calling thread, creating it if needed
+    ThreadBuffer* getBuffer();
+
+    /// \brief Wake up the writer unless it was already woken up
+    void signal();
+
+    /// \brief Take the buffered events in emission order (writer mutex)
+    ///
+    /// \param events The events, appended in emission order.
+    void take(std::vector<EventPtr>& events);
+
+    /// \brief Write a batch of events to the target appender
+    ///
+    /// \param events The events.
+    /// \param dropped Number of events dropped since the last report.
+    void write(const std::vector<EventPtr>& events, uint64_t dropped);
+
+    /// \brief The writer
+    boost::shared_ptr<AsyncWriter> writer_;
+
+    /// \brief The target appender
+    log4cplus::SharedAppenderPtr target_;
+
+    /// \brief Maximum number of queued events
+    size_t queue_size_;
+
+    /// \brief Name of the logger used to report dropped events
+    std::string root_name_;
+
+    /// \brief Unique identifier of the appender, used to find the buffer
+    /// of the calling thread
+    uint64_t id_;
+
+    /// \brief Buffers of the threads which emitted events (writer mutex)
+    std::vector<ThreadBufferPtr> buffers_;
+
+    /// \brief Number of buffered events
+    std::atomic<size_t> queued_;
+
+    /// \brief Next sequence number
+    std::atomic<uint64_t> sequence_;
+
+    /// \brief Number of events dropped since the last report
+    std::atomic<uint64_t> dropped_;
+
+    /// \brief Total number of dropped events
+    std::atomic<uint64_t> dropped_total_;
+
+    /// \brief True while events are accepted
+    std::atomic<bool> running_;
+
+    /// \brief True when the writer was woken up for this appender and has
+    /// not yet taken its buffers
+    std::atomic<bool> signaled_;
+};
+
+} // end namespace internal
+} // end namespace log
+} // end namespace isc
+
+#endif // LOG_ASYNC_APPENDER_H
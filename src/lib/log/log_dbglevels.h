@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2024 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -47,44 +47,44 @@ namespace log {
 /// up, the "server started" message could be output at a severity of INFO.
 /// "Server starting" and messages indicating the stages in startup should be
 /// debug messages output at this severity.
-extern const int DBGLVL_START_SHUT;
+constexpr int DBGLVL_START_SHUT = 0;
 
 /// @brief This debug level is reserved for logging the exchange of messages/commands
 /// between processes, including configuration messages.
-extern const int DBGLVL_COMMAND;
+constexpr int DBGLVL_COMMAND = 10;
 
 /// @brief This debug level is reserved for logging the details of packet handling, such
 /// as dropping the packet for various reasons.
-extern const int DBGLVL_PKT_HANDLING;
+constexpr int DBGLVL_PKT_HANDLING = 15;
 
 /// @brief If the commands have associated data, this level is when they are printed.
 /// This includes configuration messages.
-extern const int DBGLVL_COMMAND_DATA;
+constexpr int DBGLVL_COMMAND_DATA = 20;
 
 // The following constants are suggested values for common operations.
 // Depending on the exact nature of the code, modules may or may not use these
 // levels.
 
 /// @brief Trace basic operations.
-extern const int DBGLVL_TRACE_BASIC;
+constexpr int DBGLVL_TRACE_BASIC = 40;
 
 /// @brief Trace data associated with the basic operations.
-extern const int DBGLVL_TRACE_BASIC_DATA;
+constexpr int DBGLVL_TRACE_BASIC_DATA = 45;
 
 /// @brief Trace detailed operations.
-extern const int DBGLVL_TRACE_DETAIL;
+constexpr int DBGLVL_TRACE_DETAIL = 50;
 
 /// @brief Trace data associated with detailed operations.
-extern const int DBGLVL_TRACE_DETAIL_DATA;
+constexpr int DBGLVL_TRACE_DETAIL_DATA = 55;
 
 /// @brief Trace technical operations.
-extern const int DBGLVL_TRACE_TECHNICAL;
+constexpr int DBGLVL_TRACE_TECHNICAL = 70;
 
 /// @brief Trace data associated with technical operations.
-extern const int DBGLVL_TRACE_TECHNICAL_DATA;
+constexpr int DBGLVL_TRACE_TECHNICAL_DATA = 90;
 
 /// @brief The highest level of debug logging.
-extern const int DBGLVL_TRACE_MAX;
+constexpr int DBGLVL_TRACE_MAX = 99;
 
 }  // log namespace
 }  // isc namespace
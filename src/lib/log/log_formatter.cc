@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2022 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -8,6 +8,7 @@
 #include <log/log_formatter.h>
 
 #include <cassert>
+#include <cctype>
 
 #ifdef ENABLE_LOGGER_CHECKS
 #include <iostream>
@@ -42,6 +43,75 @@ replacePlaceholder(std::string& message, const string& arg,
     }
 }
 
+void
+checkPlaceholder(const std::string& message, const string& arg,
+                 const unsigned placeholder) {
+    const string mark("%" + lexical_cast<string>(placeholder));
+    if (message.find(mark) == string::npos) {
+        isc_throw(MismatchedPlaceholders, "Missing logger placeholder '" << mark << "' for value '"
+                                                                         << arg << "' in message '"
+                                                                         << message << "'");
+    }
+}
+
+void
+replacePlaceholders(std::string& message, const FormatArgs& args) {
+    if (args.empty()) {
+        return;
+    }
+
+    size_t length(message.size());
+    for (auto const& arg : args) {
+        length += arg.size();
+    }
+    string result;
+    result.reserve(length);
+
+    boost::container::small_vector<bool, 8> used(args.size(), false);
+    size_t pos(0);
+    for (;;) {
+        const size_t mark(message.find('%', pos));
+        if (mark == string::npos) {
+            result.append(message, pos, string::npos);
+            break;
+        }
+        // Get the whole placeholder number so %1 does not match %10.
+        size_t end(mark + 1);
+        size_t placeholder(0);
+        while ((end < message.size()) && isdigit(static_cast<unsigned char>(message[end])) &&
+               (placeholder <= args.size())) {
+            placeholder = placeholder * 10 + (message[end] - '0');
+            ++end;
+        }
+        if ((placeholder == 0) || (placeholder > args.size())) {
+            // Not a placeholder or not one we have an argument for: keep it
+            // so it can be reported by checkExcessPlaceholders().
+            result.append(message, pos, end - pos);
+        } else {
+            result.append(message, pos, mark - pos);
+            result.append(args[placeholder - 1]);
+            used[placeholder - 1] = true;
+        }
+        pos = end;
+    }
+    message.swap(result);
+
+    for (size_t i = 0; i < args.size(); ++i) {
+        if (!used[i]) {
+            const string mark("%" + lexical_cast<string>(i + 1));
+#ifdef ENABLE_LOGGER_CHECKS
+            // We're missing the placeholder, so throw an exception
+            isc_throw(MismatchedPlaceholders, "Missing logger placeholder '" << mark << "' for value '"
+                                                                             << args[i] << "' in message '"
+                                                                             << message << "'");
+#else
+            // We're missing the placeholder, so add some complain
+            message.append(" @@Missing logger placeholder '" + mark + "' for value '" + args[i] + "'@@");
+#endif /* ENABLE_LOGGER_CHECKS */
+        }
+    }
+}
+
 void
 checkExcessPlaceholders(std::string& message,
                         unsigned int placeholder) {
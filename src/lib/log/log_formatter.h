@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2020 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -14,6 +14,7 @@
 #include <exceptions/exceptions.h>
 #include <log/logger_level.h>
 
+#include <boost/container/small_vector.hpp>
 #include <boost/make_shared.hpp>
 #include <boost/shared_ptr.hpp>
 #include <boost/lexical_cast.hpp>
@@ -65,6 +66,33 @@ void
 replacePlaceholder(std::string& message, const std::string& replacement,
                    const unsigned placeholder);
 
+/// \brief Arguments of a log message
+///
+/// Most messages have only a few arguments so they are kept in a small
+/// fixed buffer which does not need a memory allocation.
+typedef boost::container::small_vector<std::string, 4> FormatArgs;
+
+///
+/// \brief The internal placeholder checker
+///
+/// This is used internally by the Formatter when logger checks are
+/// enabled to verify at the time an argument is given that the message
+/// has the matching placeholder: throws MismatchedPlaceholders if it has not.
+void
+checkPlaceholder(const std::string& message, const std::string& arg,
+                 const unsigned placeholder);
+
+///
+/// \brief The internal replacement routine for all arguments
+///
+/// This is used internally by the Formatter. Replaces in a single pass
+/// all placeholders of the message by the corresponding arguments. For
+/// each argument with no placeholder a complain is added at the end.
+/// Unlike successive calls to \c replacePlaceholder, placeholders in the
+/// arguments themselves are never replaced.
+void
+replacePlaceholders(std::string& message, const FormatArgs& args);
+
 ///
 /// \brief The log message formatter
 ///
@@ -81,8 +109,9 @@ replacePlaceholder(std::string& message, const std::string& replacement,
 /// destructor to output the text (but only in case we should output anything).
 ///
 /// If there's an .arg call, we return reference to the same object, so another
-/// .arg can be called on it. After the last .arg call is done, the object is
-/// destroyed and, again, we can produce the output.
+/// .arg can be called on it. The argument is only stored: the placeholders are
+/// replaced in a single pass over the message when, after the last .arg call,
+/// the object is destroyed and we produce the output.
 ///
 /// Of course, if the logging is turned off, we don't bother with any replacing
 /// and just return.
@@ -115,9 +144,8 @@ private:
     /// \brief The messages with %1, %2... placeholders
     boost::shared_ptr<std::string> message_;
 
-    /// \brief Which will be the next placeholder to replace
-    unsigned nextPlaceholder_;
-
+    /// \brief The arguments, the first one replaces %1 and so on
+    FormatArgs args_;
 
 public:
     /// \brief Constructor of "active" formatter
@@ -137,8 +165,7 @@ public:
     Formatter(const Severity& severity = NONE,
               boost::shared_ptr<std::string> message = boost::make_shared<std::string>(),
               Logger* logger = NULL) :
-        logger_(logger), severity_(severity), message_(message),
-        nextPlaceholder_(0) {
+        logger_(logger), severity_(severity), message_(message) {
     }
 
     /// \brief Copy constructor
@@ -148,7 +175,7 @@ public:
     /// object being copied relinquishes that responsibility.
     Formatter(const Formatter& other) :
         logger_(other.logger_), severity_(other.severity_),
-        message_(other.message_), nextPlaceholder_(other.nextPlaceholder_) {
+        message_(other.message_), args_(other.args_) {
         other.logger_ = NULL;
     }
 
@@ -158,7 +185,8 @@ public:
     ~Formatter() {
         if (logger_) {
             try {
-                checkExcessPlaceholders(*message_, ++nextPlaceholder_);
+                replacePlaceholders(*message_, args_);
+                checkExcessPlaceholders(*message_, args_.size() + 1);
                 logger_->output(severity_, *message_);
             } catch (...) {
                 // Catch and ignore all exceptions here.
@@ -175,18 +203,18 @@ public:
             logger_ = other.logger_;
             severity_ = other.severity_;
             message_ = other.message_;
-            nextPlaceholder_ = other.nextPlaceholder_;
+            args_ = other.args_;
             other.logger_ = NULL;
         }
 
         return *this;
     }
 
-    /// \brief Replaces another placeholder
+    /// \brief Adds an argument for the next placeholder
     ///
-    /// Replaces another placeholder and returns a new formatter with it.
-    /// Deactivates the current formatter. In case the formatter is not active,
-    /// only produces another inactive formatter.
+    /// Converts the argument to text and returns the formatter so another
+    /// argument can be added. In case the formatter is not active, does
+    /// nothing.
     ///
     /// \param value The argument to place into the placeholder.
     template<class Arg> Formatter& arg(const Arg& value) {
@@ -218,18 +246,14 @@ public:
     /// \param arg The text to place into the placeholder.
     Formatter& arg(const std::string& arg) {
         if (logger_) {
-            // Note that this method does a replacement and returns the
-            // modified string. If there are multiple invocations of arg() (e.g.
-            // logger.info(msgid).arg(xxx).arg(yyy)...), each invocation
-            // operates on the string returned by the previous one. This
-            // sequential operation means that if we had a message like "%1 %2",
-            // and called .arg("%2").arg(42), we would get "42 42"; the first
-            // call replaces the %1" with "%2" and the second replaces all
-            // occurrences of "%2" with 42. (Conversely, the sequence
-            // .arg(42).arg("%1") would return "42 %1" - there are no recursive
-            // replacements).
+            // Note that the replacement is done only once, when the message
+            // is output, and all placeholders are replaced in a single pass.
+            // So if we had a message like "%1 %2" and called
+            // .arg("%2").arg(42), we would get "%2 42": placeholders inside
+            // the arguments are never replaced.
+#ifdef ENABLE_LOGGER_CHECKS
             try {
-                replacePlaceholder(*message_, arg, ++nextPlaceholder_);
+                checkPlaceholder(*message_, arg, args_.size() + 1);
             } catch (...) {
                 // Something went wrong here, the log message is broken, so
                 // we don't want to output it, nor we want to check all the
@@ -237,6 +261,8 @@ public:
                 deactivate();
                 throw;
             }
+#endif /* ENABLE_LOGGER_CHECKS */
+            args_.push_back(arg);
         }
         return (*this);
     }
@@ -252,6 +278,7 @@ public:
     void deactivate() {
         if (logger_) {
             message_.reset();
+            args_.clear();
             logger_ = NULL;
         }
     }
@@ -26,12 +26,14 @@
 #include <log4cplus/syslogappender.h>
 #include <log4cplus/version.h>
 
+#include <log/async_appender_impl.h>
 #include <log/logger.h>
 #include <log/logger_impl.h>
 #include <log/logger_level.h>
 #include <log/logger_level_impl.h>
 #include <log/logger_name.h>
 #include <log/logger_manager.h>
+#include <log/logger_manager_impl.h>
 #include <log/message_dictionary.h>
 #include <log/message_types.h>
 #include <log/interprocess/interprocess_sync_file.h>
@@ -151,15 +153,24 @@ LoggerImpl::setInterprocessSync(interprocess::InterprocessSync* sync) {
 
 void
 LoggerImpl::outputRaw(const Severity& severity, const string& message) {
+    // When all the output is asynchronous the appenders only queue the
+    // event for the background thread, so neither lock is needed and the
+    // threads logging messages do not wait for each other.
+    bool const serialize(!LoggerManagerImpl::isAsynchronous());
+
     // Use a mutex locker for mutual exclusion from other threads in
     // this process.
-    std::lock_guard<std::mutex> mutex_locker(LoggerManager::getMutex());
+    std::unique_lock<std::mutex> mutex_locker(LoggerManager::getMutex(),
+                                              std::defer_lock);
+    if (serialize) {
+        mutex_locker.lock();
+    }
 
     // Use an interprocess sync locker for mutual exclusion from other
     // processes to avoid log messages getting interspersed.
     interprocess::InterprocessSyncLocker locker(*sync_);
 
-    if (!locker.lock()) {
+    if (serialize && !locker.lock()) {
         LOG4CPLUS_ERROR(logger_, "Unable to lock logger lockfile");
     }
 
@@ -193,7 +204,7 @@ LoggerImpl::outputRaw(const Severity& severity, const string& message) {
                             << severity);
     }
 
-    if (!locker.unlock()) {
+    if (serialize && !locker.unlock()) {
         LOG4CPLUS_ERROR(logger_, "Unable to unlock logger lockfile");
     }
 }
@@ -209,7 +220,13 @@ LoggerImpl::hasAppender(OutputOption::Destination const destination) {
         appenders = log4cplus::Logger::getInstance(getRootLoggerName()).getAllAppenders();
     }
 
-    for (const log4cplus::helpers::SharedObjectPtr<log4cplus::Appender>& logger : appenders) {
+    for (log4cplus::helpers::SharedObjectPtr<log4cplus::Appender> logger : appenders) {
+        // Look through the asynchronous wrapper.
+        internal::AsyncAppender* async =
+            dynamic_cast<internal::AsyncAppender*>(logger.get());
+        if (async) {
+            logger = async->getTarget();
+        }
         if (destination == OutputOption::DEST_CONSOLE &&
             dynamic_cast<log4cplus::ConsoleAppender*>(logger.get())) {
             return true;
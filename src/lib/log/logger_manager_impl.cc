@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2025 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -28,6 +28,7 @@
 #include <log/logger_name.h>
 #include <log/logger_specification.h>
 #include <log/buffer_appender_impl.h>
+#include <log/async_appender_impl.h>
 
 #include <exceptions/isc_assert.h>
 
@@ -39,6 +40,8 @@ using boost::lexical_cast;
 namespace isc {
 namespace log {
 
+std::atomic<bool> LoggerManagerImpl::asynchronous_(false);
+
 // Reset hierarchy of loggers back to default settings.  This removes all
 // appenders from loggers, sets their severity to NOT_SET (so that events are
 // passed back to the parent) and resets the root logger to logging
@@ -56,6 +59,7 @@ LoggerManagerImpl::processInit() {
 void
 LoggerManagerImpl::processEnd() {
     flushBufferAppenders();
+    checkAsynchronous();
 }
 
 // Process logging specification.  Set up the common states then dispatch to
@@ -133,7 +137,7 @@ LoggerManagerImpl::createConsoleAppender(log4cplus::Logger& logger,
 
     setAppenderLayout(console, (opt.pattern.empty() ?
                                 OutputOption::DEFAULT_CONSOLE_PATTERN : opt.pattern));
-    logger.addAppender(console);
+    addOutputAppender(logger, console, opt);
 }
 
 // File appender.  Depending on whether a maximum size is given, either
@@ -188,7 +192,7 @@ LoggerManagerImpl::createFileAppender(log4cplus::Logger& logger,
 
     setAppenderLayout(fileapp, (opt.pattern.empty() ?
                                 OutputOption::DEFAULT_FILE_PATTERN : opt.pattern));
-    logger.addAppender(fileapp);
+    addOutputAppender(logger, fileapp, opt);
 }
 
 void
@@ -213,7 +217,39 @@ LoggerManagerImpl::createSyslogAppender(log4cplus::Logger& logger,
         new log4cplus::SysLogAppender(properties));
     setAppenderLayout(syslogapp, (opt.pattern.empty() ?
                                   OutputOption::DEFAULT_SYSLOG_PATTERN : opt.pattern));
-    logger.addAppender(syslogapp);
+    addOutputAppender(logger, syslogapp, opt);
+}
+
+void
+LoggerManagerImpl::addOutputAppender(log4cplus::Logger& logger,
+                                     log4cplus::SharedAppenderPtr appender,
+                                     const OutputOption& opt) {
+    if (opt.async_queue_size == 0) {
+        logger.addAppender(appender);
+        return;
+    }
+    log4cplus::SharedAppenderPtr asyncapp(
+        new internal::AsyncAppender(appender, opt.async_queue_size,
+                                    getRootLoggerName()));
+    asyncapp->setName(appender->getName());
+    logger.addAppender(asyncapp);
+}
+
+void
+LoggerManagerImpl::checkAsynchronous() {
+    log4cplus::LoggerList loggers(log4cplus::Logger::getCurrentLoggers());
+    loggers.push_back(log4cplus::Logger::getRoot());
+    bool found(false);
+    for (auto& logger : loggers) {
+        for (auto const& appender : logger.getAllAppenders()) {
+            if (!dynamic_cast<internal::AsyncAppender*>(appender.get())) {
+                asynchronous_ = false;
+                return;
+            }
+            found = true;
+        }
+    }
+    asynchronous_ = found;
 }
 
 
@@ -249,6 +285,7 @@ LoggerManagerImpl::reset(isc::log::Severity severity, int dbglevel)
 void LoggerManagerImpl::initRootLogger(isc::log::Severity severity,
                                        int dbglevel, bool buffer)
 {
+    asynchronous_ = false;
     log4cplus::Logger::getDefaultHierarchy().resetConfiguration();
 
     // Disable log4cplus' own logging, unless "-D tests=enabled" was
@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2022 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -7,6 +7,7 @@
 #ifndef LOGGER_MANAGER_IMPL_H
 #define LOGGER_MANAGER_IMPL_H
 
+#include <atomic>
 #include <string>
 
 #include <log4cplus/appender.h>
@@ -83,6 +84,15 @@ public:
     static void init(isc::log::Severity severity = isc::log::INFO,
                      int dbglevel = 0, bool buffer = false);
 
+    /// \brief Check if all the output is asynchronous
+    ///
+    /// \return true when every appender of every logger is an asynchronous
+    /// appender: logging calls then only queue the events and need no
+    /// serialization.
+    static bool isAsynchronous() {
+        return (asynchronous_);
+    }
+
     /// \brief Reset logging
     ///
     /// Resets to default configuration (root logger logging to the console
@@ -144,6 +154,20 @@ private:
     /// \param logger Log4cplus logger to which the appender must be attached.
     static void createBufferAppender(log4cplus::Logger& logger);
 
+    /// \brief Attach an output appender to a logger
+    ///
+    /// When asynchronous logging is enabled (the async-queue-size output
+    /// option is set to a positive number of messages) the appender is
+    /// wrapped in an \c internal::AsyncAppender so the output is written
+    /// by a background thread.
+    ///
+    /// \param logger Log4cplus logger to which the appender must be attached.
+    /// \param appender The console, file or syslog appender.
+    /// \param opt Output options for this appender.
+    static void addOutputAppender(log4cplus::Logger& logger,
+                                  log4cplus::SharedAppenderPtr appender,
+                                  const OutputOption& opt);
+
     /// \brief Set default layout and severity for root logger
     ///
     /// Initializes the root logger to Kea defaults - console or buffered
@@ -167,6 +191,11 @@ private:
     static void setAppenderLayout(log4cplus::SharedAppenderPtr& appender,
                                   std::string pattern);
 
+    /// \brief Update the asynchronous flag
+    ///
+    /// Checks the appenders of all loggers, see \c isAsynchronous().
+    static void checkAsynchronous();
+
     /// \brief Store all buffer appenders
     ///
     /// When processing a new specification, this method can be used
@@ -189,6 +218,9 @@ private:
     /// @brief A hard copy of the specification for the root logger used for
     /// inheritance by child loggers.
     LoggerSpecification root_spec_;
+
+    /// @brief True when all the output is asynchronous
+    static std::atomic<bool> asynchronous_;
 };
 
 } // namespace log
@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -11,10 +11,24 @@
 #include <log/log_dbglevels.h>
 
 /// \brief Macro to conveniently test debug output and log it
+///
+/// When Kea is built with a maximum debug level (the log-max-debug-level
+/// build option, KEA_LOG_MAX_DEBUG_LEVEL in config.h), debug messages with
+/// a higher level are compiled out: as debug levels are constants the
+/// first test is resolved at compile time and the logger is not even
+/// consulted.
+#ifdef KEA_LOG_MAX_DEBUG_LEVEL
+#define LOG_DEBUG(LOGGER, LEVEL, MESSAGE) \
+    if (((LEVEL) > KEA_LOG_MAX_DEBUG_LEVEL) || \
+        !(LOGGER).isDebugEnabled((LEVEL))) { \
+    } else \
+        (LOGGER).debug((LEVEL), (MESSAGE))
+#else
 #define LOG_DEBUG(LOGGER, LEVEL, MESSAGE) \
     if (!(LOGGER).isDebugEnabled((LEVEL))) { \
     } else \
         (LOGGER).debug((LEVEL), (MESSAGE))
+#endif
 
 /// \brief Macro to conveniently test info output and log it
 #define LOG_INFO(LOGGER, MESSAGE) \
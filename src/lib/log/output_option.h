@@ -60,7 +60,8 @@ struct OutputOption {
     /// \brief Constructor
     OutputOption() : destination(DEST_CONSOLE), stream(STR_STDERR),
                      flush(true), facility("LOCAL0"), filename(""),
-                     maxsize(0), maxver(0), pattern("")
+                     maxsize(0), maxver(0), pattern(""),
+                     async_queue_size(0)
     {}
 
     /// Members.
@@ -73,6 +74,7 @@ struct OutputOption {
     uint64_t        maxsize;            ///< 0 if no maximum size
     unsigned int    maxver;             ///< Maximum versions (none if <= 0)
     std::string     pattern;            ///< log content pattern
+    size_t          async_queue_size;   ///< 0 if synchronous output
 };
 
 OutputOption::Destination getDestination(const std::string& dest_str);
@@ -0,0 +1,238 @@
+// Copyright (C) 2026 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <gtest/gtest.h>
+
+#include <log/async_appender_impl.h>
+#include <log/log_messages.h>
+
+#include <log4cplus/logger.h>
+#include <log4cplus/spi/loggingevent.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace isc::log;
+using namespace isc::log::internal;
+
+namespace {
+
+/// \brief Appender recording the messages it receives
+///
+/// It can be blocked to simulate a slow output.
+class TestTargetAppender : public log4cplus::Appender {
+public:
+    TestTargetAppender() : blocked_(false), entered_(0) {}
+
+    virtual ~TestTargetAppender() {
+        destructorImpl();
+    }
+
+    virtual void close() {
+        closed = true;
+    }
+
+    /// \brief Make append() wait until unblock() is called
+    void block() {
+        std::lock_guard<std::mutex> lk(mutex_);
+        blocked_ = true;
+    }
+
+    /// \brief Release append()
+    void unblock() {
+        {
+            std::lock_guard<std::mutex> lk(mutex_);
+            blocked_ = false;
+        }
+        cv_.notify_all();
+    }
+
+    /// \brief Number of append() calls entered so far
+    size_t getEntered() const {
+        std::lock_guard<std::mutex> lk(mutex_);
+        return (entered_);
+    }
+
+    /// \brief Recorded messages
+    std::vector<std::string> getMessages() const {
+        std::lock_guard<std::mutex> lk(mutex_);
+        return (messages_);
+    }
+
+protected:
+    virtual void append(const log4cplus::spi::InternalLoggingEvent& event) {
+        std::unique_lock<std::mutex> lk(mutex_);
+        ++entered_;
+        cv_.wait(lk, [this]() { return (!blocked_); });
+        messages_.push_back(event.getMessage());
+    }
+
+private:
+    bool blocked_;
+    size_t entered_;
+    std::vector<std::string> messages_;
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+};
+
+class AsyncAppenderTest : public ::testing::Test {
+protected:
+    AsyncAppenderTest() : target_(new TestTargetAppender()),
+                          target_ptr_(target_) {
+    }
+
+    /// \brief Send a message to an appender
+    void log(log4cplus::SharedAppenderPtr& appender, const std::string& text) {
+        log4cplus::spi::InternalLoggingEvent event("async",
+                                                   log4cplus::INFO_LOG_LEVEL,
+                                                   text, "file", 123);
+        appender->doAppend(event);
+    }
+
+    TestTargetAppender* target_;
+    log4cplus::SharedAppenderPtr target_ptr_;
+};
+
+// Messages are written in order by the background thread.
+TEST_F(AsyncAppenderTest, write) {
+    AsyncAppender* async = new AsyncAppender(target_ptr_, 100, "kea");
+    log4cplus::SharedAppenderPtr appender(async);
+    EXPECT_EQ(100U, async->getQueueSize());
+    EXPECT_TRUE(async->getTarget() == target_ptr_);
+
+    for (int i = 0; i < 50; ++i) {
+        log(appender, "message " + std::to_string(i));
+    }
+    async->flush();
+
+    std::vector<std::string> messages = target_->getMessages();
+    ASSERT_EQ(50U, messages.size());
+    for (int i = 0; i < 50; ++i) {
+        EXPECT_EQ("message " + std::to_string(i), messages[i]);
+    }
+    EXPECT_EQ(0U, async->getDropped());
+}
+
+// Messages are dropped and reported when the queue is full.
+TEST_F(AsyncAppenderTest, drop) {
+    AsyncAppender* async = new AsyncAppender(target_ptr_, 2, "kea");
+    log4cplus::SharedAppenderPtr appender(async);
+
+    // Stall the output with a first message.
+    target_->block();
+    log(appender, "first");
+    for (int i = 0; (i < 1000) && (target_->getEntered() == 0); ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_EQ(1U, target_->getEntered());
+
+    // Two messages fit in the queue, the next three are dropped.
+    for (int i = 0; i < 5; ++i) {
+        log(appender, "message " + std::to_string(i));
+    }
+    EXPECT_EQ(3U, async->getDropped());
+
+    target_->unblock();
+    async->flush();
+
+    std::vector<std::string> messages = target_->getMessages();
+    ASSERT_EQ(4U, messages.size());
+    EXPECT_EQ("first", messages[0]);
+    EXPECT_EQ("message 0", messages[1]);
+    EXPECT_EQ("message 1", messages[2]);
+    EXPECT_EQ(0U, messages[3].find(LOG_ASYNC_MESSAGES_DROPPED));
+    EXPECT_NE(std::string::npos, messages[3].find("3"));
+}
+
+// The appenders share one writer thread.
+TEST_F(AsyncAppenderTest, sharedWriter) {
+    AsyncAppender* async = new AsyncAppender(target_ptr_, 100, "kea");
+    log4cplus::SharedAppenderPtr appender(async);
+    TestTargetAppender* target2 = new TestTargetAppender();
+    log4cplus::SharedAppenderPtr target2_ptr(target2);
+    AsyncAppender* async2 = new AsyncAppender(target2_ptr, 100, "kea");
+    log4cplus::SharedAppenderPtr appender2(async2);
+    ASSERT_TRUE(async->getWriter());
+    EXPECT_TRUE(async->getWriter() == async2->getWriter());
+
+    for (int i = 0; i < 10; ++i) {
+        log(appender, "first " + std::to_string(i));
+        log(appender2, "second " + std::to_string(i));
+    }
+    async->flush();
+    async2->flush();
+    ASSERT_EQ(10U, target_->getMessages().size());
+    ASSERT_EQ(10U, target2->getMessages().size());
+    EXPECT_EQ("first 9", target_->getMessages()[9]);
+    EXPECT_EQ("second 9", target2->getMessages()[9]);
+
+    // Closing one appender does not stop the other.
+    async->close();
+    log(appender2, "last");
+    async2->flush();
+    ASSERT_EQ(11U, target2->getMessages().size());
+    EXPECT_EQ("last", target2->getMessages()[10]);
+}
+
+// Messages from several threads are all written, in emission order.
+TEST_F(AsyncAppenderTest, threads) {
+    AsyncAppender* async = new AsyncAppender(target_ptr_, 10000, "kea");
+    log4cplus::SharedAppenderPtr appender(async);
+
+    const int threads = 4;
+    const int count = 1000;
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.push_back(std::thread([this, &appender, t]() {
+            for (int i = 0; i < count; ++i) {
+                log(appender, std::to_string(t) + " " + std::to_string(i));
+            }
+        }));
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    async->flush();
+    EXPECT_EQ(0U, async->getDropped());
+
+    // Each thread has its own buffer: check that the messages of each
+    // thread are in order.
+    std::vector<std::string> messages = target_->getMessages();
+    ASSERT_EQ(static_cast<size_t>(threads * count), messages.size());
+    std::vector<int> next(threads, 0);
+    for (auto const& message : messages) {
+        size_t space = message.find(' ');
+        ASSERT_NE(std::string::npos, space);
+        int t = std::stoi(message.substr(0, space));
+        ASSERT_LE(0, t);
+        ASSERT_GT(threads, t);
+        EXPECT_EQ(next[t], std::stoi(message.substr(space + 1)));
+        ++next[t];
+    }
+}
+
+// Queued messages are written when the appender is closed.
+TEST_F(AsyncAppenderTest, close) {
+    AsyncAppender* async = new AsyncAppender(target_ptr_, 100, "kea");
+    log4cplus::SharedAppenderPtr appender(async);
+
+    for (int i = 0; i < 10; ++i) {
+        log(appender, "message " + std::to_string(i));
+    }
+    async->close();
+    EXPECT_EQ(10U, target_->getMessages().size());
+
+    // Nothing is queued after close.
+    log(appender, "late");
+    EXPECT_EQ(10U, target_->getMessages().size());
+}
+
+}
@@ -178,4 +178,41 @@ TEST_F(FormatterTest, noRecurse) {
     EXPECT_EQ("%1 %1", outputs[0].second);
 }
 
+// Placeholders in the arguments are not replaced by later arguments
+TEST_F(FormatterTest, noSequentialReplace) {
+    Formatter(isc::log::INFO, s("%1 %2"), this).arg("%2").arg(42);
+    ASSERT_EQ(1U, outputs.size());
+    EXPECT_EQ("%2 42", outputs[0].second);
+}
+
+// Can use more than nine arguments
+TEST_F(FormatterTest, manyArgs) {
+    Formatter(isc::log::INFO,
+              s("%1 %2 %3 %4 %5 %6 %7 %8 %9 %10 %11"), this).
+        arg("a").arg("b").arg("c").arg("d").arg("e").arg("f").arg("g").
+        arg("h").arg("i").arg("j").arg("k");
+    ASSERT_EQ(1U, outputs.size());
+    EXPECT_EQ("a b c d e f g h i j k", outputs[0].second);
+}
+
+// Other uses of the percent sign are kept
+TEST_F(FormatterTest, percent) {
+    Formatter(isc::log::INFO, s("%1% done, 100% %x"), this).arg(50);
+    ASSERT_EQ(1U, outputs.size());
+    EXPECT_EQ("50% done, 100% %x", outputs[0].second);
+}
+
+// Test the single pass replacement routine directly
+TEST(ReplacePlaceholdersTest, replace) {
+    isc::log::FormatArgs args;
+    string message("%2 and %1 and %2");
+    isc::log::replacePlaceholders(message, args);
+    EXPECT_EQ("%2 and %1 and %2", message);
+
+    args.push_back("one");
+    args.push_back("two");
+    isc::log::replacePlaceholders(message, args);
+    EXPECT_EQ("two and one and two", message);
+}
+
 }
@@ -0,0 +1,97 @@
+// Copyright (C) 2026 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+// Force a maximum debug level whatever the build option says so that the
+// LOG_DEBUG variant which compiles out high debug levels is tested.
+#ifdef KEA_LOG_MAX_DEBUG_LEVEL
+#undef KEA_LOG_MAX_DEBUG_LEVEL
+#endif
+#define KEA_LOG_MAX_DEBUG_LEVEL 40
+
+#include <log/macros.h>
+
+#include <gtest/gtest.h>
+
+using namespace isc::log;
+
+namespace {
+
+/// @brief Logger replacement recording how LOG_DEBUG uses it.
+///
+/// Debug output is always enabled so any message reaching the logger
+/// is output.
+class FakeLogger {
+public:
+    /// @brief Constructor.
+    FakeLogger() : checks_(0), messages_(0) {
+    }
+
+    /// @brief Checks if debug is enabled: always true.
+    bool isDebugEnabled(int) {
+        ++checks_;
+        return (true);
+    }
+
+    /// @brief Outputs a debug message.
+    ///
+    /// @return The logger itself so arguments can be chained.
+    FakeLogger& debug(int, const char*) {
+        ++messages_;
+        return (*this);
+    }
+
+    /// @brief Adds an argument.
+    ///
+    /// @return The logger itself so arguments can be chained.
+    FakeLogger& arg(int) {
+        return (*this);
+    }
+
+    /// @brief Number of isDebugEnabled calls.
+    int checks_;
+
+    /// @brief Number of output messages.
+    int messages_;
+};
+
+/// @brief Returns its argument and counts calls.
+int
+countedArg(int& calls) {
+    ++calls;
+    return (calls);
+}
+
+// Checks that debug messages at or below the maximum debug level are
+// output and that higher ones are compiled out: the logger is not
+// consulted and the arguments are not evaluated.
+TEST(LogMaxDebugLevelTest, compiledOut) {
+    FakeLogger logger;
+    int evaluated = 0;
+
+    LOG_DEBUG(logger, DBGLVL_TRACE_BASIC, "basic").arg(countedArg(evaluated));
+    EXPECT_EQ(1, logger.checks_);
+    EXPECT_EQ(1, logger.messages_);
+    EXPECT_EQ(1, evaluated);
+
+    LOG_DEBUG(logger, DBGLVL_TRACE_BASIC_DATA, "data").arg(countedArg(evaluated));
+    LOG_DEBUG(logger, DBGLVL_TRACE_MAX, "max").arg(countedArg(evaluated));
+    EXPECT_EQ(1, logger.checks_);
+    EXPECT_EQ(1, logger.messages_);
+    EXPECT_EQ(1, evaluated);
+}
+
+// Checks that the test against the maximum debug level folds at compile
+// time for the standard debug levels.
+TEST(LogMaxDebugLevelTest, constantLevels) {
+    static_assert(DBGLVL_TRACE_BASIC <= KEA_LOG_MAX_DEBUG_LEVEL,
+                  "basic trace level must be enabled");
+    static_assert(DBGLVL_TRACE_DETAIL > KEA_LOG_MAX_DEBUG_LEVEL,
+                  "detail trace level must be compiled out");
+}
+
+} // end of anonymous namespace
@@ -25,6 +25,7 @@
 #include <log/logger.h>
 #include <log/logger_level.h>
 #include <log/logger_manager.h>
+#include <log/logger_manager_impl.h>
 #include <log/logger_name.h>
 #include <log/logger_specification.h>
 #include <log/message_initializer.h>
@@ -508,3 +509,57 @@ TEST_F(LoggerManagerTest, outputOptionsInheritance) {
     EXPECT_NE(result.find("INFO from foo logger 2"), string::npos);
     EXPECT_EQ(result.find("INFO from bar logger 2"), string::npos);
 }
+
+// Check that logging calls are not serialized only when all the output
+// is asynchronous.
+TEST_F(LoggerManagerTest, asynchronousOutput) {
+    LoggerManager manager;
+    SpecificationForFileLogger file_spec;
+    vector<LoggerSpecification> specs;
+
+    // Create the root logger configuration with an asynchronous file output.
+    string root_name(getRootLoggerName());
+    LoggerSpecification root_spec(root_name);
+    OutputOption root_option;
+    root_option.destination = OutputOption::DEST_FILE;
+    root_option.filename = file_spec.getFileName();
+    root_option.pattern = "%p %m\n";
+    root_option.async_queue_size = 100;
+    root_spec.addOutputOption(root_option);
+    specs.push_back(root_spec);
+
+    // The child logger inherits the asynchronous output.
+    string foo_name(root_name + ".foo");
+    LoggerSpecification foo_spec(foo_name);
+    specs.push_back(foo_spec);
+
+    manager.process(specs.begin(), specs.end());
+    EXPECT_TRUE(LoggerManagerImpl::isAsynchronous());
+
+    {
+        Logger root_logger(root_name.c_str());
+        Logger foo_logger(foo_name.c_str());
+        LOG_INFO(root_logger, "from root logger");
+        LOG_INFO(foo_logger, "from foo logger");
+    }
+
+    // Resetting the logging writes the queued messages.
+    LoggerManager::reset();
+    EXPECT_FALSE(LoggerManagerImpl::isAsynchronous());
+
+    std::ifstream ifs(file_spec.getFileName());
+    std::stringstream s;
+    s << ifs.rdbuf();
+    std::string const result(s.str());
+    EXPECT_NE(result.find("INFO from root logger"), string::npos);
+    EXPECT_NE(result.find("INFO from foo logger"), string::npos);
+
+    // A synchronous output requires the serialization.
+    LoggerSpecification bar_spec(root_name + ".bar");
+    OutputOption bar_option;
+    bar_option.destination = OutputOption::DEST_CONSOLE;
+    bar_spec.addOutputOption(bar_option);
+    specs.push_back(bar_spec);
+    manager.process(specs.begin(), specs.end());
+    EXPECT_FALSE(LoggerManagerImpl::isAsynchronous());
+}
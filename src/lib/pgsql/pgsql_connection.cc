@@ -143,6 +143,197 @@ PgSqlTransaction::commit() {
     committed_ = true;
 }
 
+PgSqlPipeline::PgSqlPipeline(PgSqlConnection& conn)
+    : conn_(conn), statements_(), results_(), pending_(0), active_(false),
+      failed_(false), broken_(false) {
+}
+
+PgSqlPipeline::~PgSqlPipeline() {
+#ifdef LIBPQ_HAS_PIPELINING
+    if (active_) {
+        try {
+            collect();
+        } catch (...) {
+            // Nothing more can be done in a destructor.
+        }
+        if (!broken_) {
+            static_cast<void>(PQexitPipelineMode(conn_));
+        }
+    }
+#endif
+}
+
+bool
+PgSqlPipeline::isSupported() {
+#ifdef LIBPQ_HAS_PIPELINING
+    return (true);
+#else
+    return (false);
+#endif
+}
+
+void
+PgSqlPipeline::add(PgSqlTaggedStatement& statement,
+                   const PsqlBindArray& in_bindings) {
+    if (static_cast<size_t>(statement.nbparams) != in_bindings.size()) {
+        isc_throw (InvalidOperation, "PgSqlPipeline::add:"
+                   << " expected: " << statement.nbparams
+                   << " parameters, given: " << in_bindings.size()
+                   << ", statement: " << statement.name
+                   << ", SQL: " << statement.text);
+    }
+
+    if (failed_) {
+        return;
+    }
+
+    conn_.checkUnusable();
+
+    const char* const* values = 0;
+    const int* lengths = 0;
+    const int* formats = 0;
+    if (statement.nbparams > 0) {
+        values = static_cast<const char* const*>(&in_bindings.values_[0]);
+        lengths = static_cast<const int *>(&in_bindings.lengths_[0]);
+        formats = static_cast<const int *>(&in_bindings.formats_[0]);
+    }
+
+    statements_.push_back(&statement);
+
+#ifdef LIBPQ_HAS_PIPELINING
+    if (!active_) {
+        if (!PQenterPipelineMode(conn_)) {
+            isc_throw(DbOperationError, "unable to enter pipeline mode: "
+                      << PQerrorMessage(conn_));
+        }
+        active_ = true;
+    }
+
+    // The values are copied into the output buffer of the connection.
+    if (!PQsendQueryPrepared(conn_, statement.name, statement.nbparams,
+                             values, lengths, formats, 0)) {
+        // The results of the statements already sent are read by
+        // execute, a null result reports this one.
+        collect();
+        if (!failed_) {
+            results_.push_back(PgSqlResultPtr(new PgSqlResult(0)));
+            failed_ = true;
+            broken_ = true;
+        }
+        return;
+    }
+
+    if (++pending_ >= MAX_DEPTH) {
+        collect();
+    }
+#else
+    PgSqlResultPtr result(new PgSqlResult(PQexecPrepared(conn_, statement.name,
+                                                         statement.nbparams,
+                                                         values, lengths,
+                                                         formats, 0)));
+    results_.push_back(result);
+    int s = PQresultStatus(*result);
+    if (s != PGRES_COMMAND_OK && s != PGRES_TUPLES_OK) {
+        failed_ = true;
+    }
+#endif
+}
+
+void
+PgSqlPipeline::collect() {
+#ifdef LIBPQ_HAS_PIPELINING
+    if (!pending_ || broken_) {
+        pending_ = 0;
+        return;
+    }
+
+    if (!PQpipelineSync(conn_)) {
+        broken_ = true;
+        pending_ = 0;
+        if (!failed_) {
+            results_.push_back(PgSqlResultPtr(new PgSqlResult(0)));
+            failed_ = true;
+        }
+        return;
+    }
+
+    for (; pending_ > 0; --pending_) {
+        PGresult* r = PQgetResult(conn_);
+        if (!r) {
+            // The connection was lost.
+            broken_ = true;
+            break;
+        }
+        if (PQresultStatus(r) == PGRES_PIPELINE_ABORTED) {
+            // Skipped by the server after a failure.
+            PQclear(r);
+        } else {
+            PgSqlResultPtr result(new PgSqlResult(r));
+            int s = PQresultStatus(r);
+            if (!failed_) {
+                results_.push_back(result);
+                if (s != PGRES_COMMAND_OK && s != PGRES_TUPLES_OK) {
+                    failed_ = true;
+                }
+            }
+        }
+        // Each statement result is terminated by a null.
+        while ((r = PQgetResult(conn_))) {
+            PQclear(r);
+        }
+    }
+
+    if (broken_) {
+        pending_ = 0;
+        if (!failed_) {
+            results_.push_back(PgSqlResultPtr(new PgSqlResult(0)));
+            failed_ = true;
+        }
+        return;
+    }
+
+    // Consume the synchronization point.
+    PgSqlResult sync(PQgetResult(conn_));
+    if (PQresultStatus(sync) != PGRES_PIPELINE_SYNC) {
+        broken_ = true;
+        if (!failed_) {
+            results_.push_back(PgSqlResultPtr(new PgSqlResult(0)));
+            failed_ = true;
+        }
+    }
+#endif
+}
+
+std::vector<PgSqlResultPtr>
+PgSqlPipeline::execute() {
+#ifdef LIBPQ_HAS_PIPELINING
+    collect();
+    if (active_) {
+        active_ = false;
+        if (!broken_ && !PQexitPipelineMode(conn_)) {
+            broken_ = true;
+        }
+    }
+#endif
+
+    if (failed_) {
+        // The failed statement has the last collected result.
+        PgSqlTaggedStatement& statement = *statements_[results_.size() - 1];
+        conn_.checkStatementError(*results_.back(), statement);
+    }
+
+    if (broken_) {
+        // Should not happen: report it as a lost connection.
+        conn_.checkStatementError(PgSqlResult(0), *statements_.back());
+    }
+
+    std::vector<PgSqlResultPtr> results;
+    results.swap(results_);
+    statements_.clear();
+    failed_ = false;
+    return (results);
+}
+
 PgSqlConnection::~PgSqlConnection() {
     if (conn_ && !isUnusable()) {
         // Deallocate the prepared queries.
@@ -18,7 +18,7 @@ namespace isc {
 namespace db {
 
 /// @brief Define the PostgreSQL backend version.
-const uint32_t PGSQL_SCHEMA_VERSION_MAJOR = 34;
+const uint32_t PGSQL_SCHEMA_VERSION_MAJOR = 35;
 const uint32_t PGSQL_SCHEMA_VERSION_MINOR = 0;
 
 // Maximum number of parameters that can be used a statement
@@ -191,6 +191,109 @@ private:
 /// @brief Defines a scoped pointer to a transaction.
 typedef boost::scoped_ptr<PgSqlTransaction> ScopedPgSqlTransactionPtr;
 
+/// @brief Executes a sequence of prepared statements in pipeline mode.
+///
+/// Each prepared statement executed with @ref PgSqlConnection methods
+/// waits for the server response before the next one is sent, so a
+/// sequence of statements costs one network round trip per statement.
+/// With libpq pipeline mode (PostgreSQL 14 and later client library)
+/// the statements are sent without waiting and the results are read
+/// at once, i.e. the whole sequence costs one round trip.
+///
+/// Statements are queued with @ref add and their results are collected
+/// by @ref execute in the order the statements were added. When the
+/// client library does not support pipeline mode statements are executed
+/// immediately by @ref add so the class can be used unconditionally.
+///
+/// The server aborts all statements following a failed one up to the
+/// end of the pipeline, so the pipeline should be used for statements
+/// which are not expected to fail (e.g. inserts skipping duplicates or
+/// updates reporting the affected row count), usually within a
+/// transaction. The first failure is reported by @ref execute with
+/// the same exceptions as @ref PgSqlConnection::executePreparedStatement.
+///
+/// No other statement can be executed on the connection while a pipeline
+/// is not executed: the instance should live in a local scope. The
+/// destructor discards pending results.
+class PgSqlPipeline : public boost::noncopyable {
+public:
+
+    /// @brief Maximum number of statements sent before results are read.
+    ///
+    /// Bounds the memory used by the client and the server for pending
+    /// results and avoids a deadlock with full socket buffers.
+    static const size_t MAX_DEPTH = 64;
+
+    /// @brief Constructor.
+    ///
+    /// @param conn PostgreSQL connection to use.
+    PgSqlPipeline(PgSqlConnection& conn);
+
+    /// @brief Destructor.
+    ///
+    /// Discards results not yet collected and leaves pipeline mode.
+    ~PgSqlPipeline();
+
+    /// @brief Queues a prepared statement.
+    ///
+    /// Parameter values are copied by the client library so the bind
+    /// array can be reused as soon as the method returns. Statements
+    /// added after a failure are ignored.
+    ///
+    /// @param statement PgSqlTaggedStatement describing the prepared
+    /// statement to execute.
+    /// @param in_bindings array of input parameter bindings.
+    /// @throw InvalidOperation if the number of parameters expected
+    /// by the statement does not match the size of the input bind array.
+    void add(PgSqlTaggedStatement& statement,
+             const PsqlBindArray& in_bindings = PsqlBindArray());
+
+    /// @brief Executes the queued statements and returns their results.
+    ///
+    /// @return The result sets in the order of the statements.
+    /// @throw DuplicateEntry, NullKeyError, DbOperationError or
+    /// DbConnectionUnusable for the first failed statement (see
+    /// @ref PgSqlConnection::checkStatementError).
+    std::vector<PgSqlResultPtr> execute();
+
+    /// @brief Returns the number of queued statements.
+    size_t size() const {
+        return (statements_.size());
+    }
+
+    /// @brief Checks if the client library supports pipeline mode.
+    ///
+    /// @return true when statements are pipelined, false when they are
+    /// executed one by one.
+    static bool isSupported();
+
+private:
+
+    /// @brief Reads the results of the statements sent to the server.
+    void collect();
+
+    /// @brief Holds reference to the PostgreSQL database connection.
+    PgSqlConnection& conn_;
+
+    /// @brief Statements in the order they were added.
+    std::vector<PgSqlTaggedStatement*> statements_;
+
+    /// @brief Results collected so far.
+    std::vector<PgSqlResultPtr> results_;
+
+    /// @brief Number of statements sent with results not yet read.
+    size_t pending_;
+
+    /// @brief Flag set when the connection is in pipeline mode.
+    bool active_;
+
+    /// @brief Flag set after a failed statement.
+    bool failed_;
+
+    /// @brief Flag set when the connection is lost or out of sync.
+    bool broken_;
+};
+
 /// @brief Common PgSql Connector Pool
 ///
 /// This class provides common operations for PgSql database connection
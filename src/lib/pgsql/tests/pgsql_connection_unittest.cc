@@ -427,6 +427,88 @@ TEST_F(PgSqlConnectionTest, deleteTest) {
     ASSERT_NO_THROW_LOG(testSelect(TestRowSet({{6, "six"}, {9, "nine"}}), 0, 10));
 }
 
+/// @brief Verify that statements can be executed with PgSqlPipeline.
+TEST_F(PgSqlConnectionTest, pipeline) {
+    // Insert more rows than the maximum depth so intermediate results
+    // are read, then update, delete and select some of them.
+    size_t count = PgSqlPipeline::MAX_DEPTH + 10;
+    PgSqlPipeline pipeline(*conn_);
+    for (size_t i = 0; i < count; ++i) {
+        // The bind array and its values can be reused.
+        PsqlBindArray in_bindings;
+        std::string text = "text" + std::to_string(i);
+        in_bindings.add(static_cast<int>(i));
+        in_bindings.add(text);
+        ASSERT_NO_THROW_LOG(pipeline.add(tagged_statements[INSERT_VALUE],
+                                         in_bindings));
+    }
+    PsqlBindArray update_bindings;
+    std::string updated("updated");
+    update_bindings.add(1);
+    update_bindings.add(updated);
+    ASSERT_NO_THROW_LOG(pipeline.add(tagged_statements[UPDATE_BY_INT_VALUE],
+                                     update_bindings));
+    PsqlBindArray delete_bindings;
+    delete_bindings.add(2);
+    delete_bindings.add(3);
+    ASSERT_NO_THROW_LOG(pipeline.add(tagged_statements[DELETE_BY_INT_RANGE],
+                                     delete_bindings));
+    PsqlBindArray select_bindings;
+    select_bindings.add(0);
+    select_bindings.add(4);
+    ASSERT_NO_THROW_LOG(pipeline.add(tagged_statements[GET_BY_INT_RANGE],
+                                     select_bindings));
+    EXPECT_EQ(count + 3, pipeline.size());
+
+    // Invalid parameters are detected when the statement is added.
+    EXPECT_THROW(pipeline.add(tagged_statements[INSERT_VALUE]),
+                 InvalidOperation);
+
+    std::vector<PgSqlResultPtr> results;
+    ASSERT_NO_THROW_LOG(results = pipeline.execute());
+    ASSERT_EQ(count + 3, results.size());
+    EXPECT_EQ("1", std::string(PQcmdTuples(*results[count])));
+    EXPECT_EQ("2", std::string(PQcmdTuples(*results[count + 1])));
+    EXPECT_EQ(3, results[count + 2]->getRows());
+
+    // The connection is usable again.
+    ASSERT_NO_THROW_LOG(testSelect(TestRowSet({{0, "text0"}, {1, "updated"},
+                                               {4, "text4"}}), 0, 4));
+
+    // The pipeline can be reused.
+    ASSERT_NO_THROW_LOG(pipeline.add(tagged_statements[DELETE_BY_INT_RANGE],
+                                     select_bindings));
+    ASSERT_NO_THROW_LOG(results = pipeline.execute());
+    ASSERT_EQ(1, results.size());
+    EXPECT_EQ("3", std::string(PQcmdTuples(*results[0])));
+}
+
+/// @brief Verify that the first failure of a pipeline is reported.
+TEST_F(PgSqlConnectionTest, pipelineFailure) {
+    ASSERT_NO_THROW_LOG(testInsert(TestRowSet({{2, "two"}})));
+
+    conn_->startTransaction();
+    {
+        PgSqlPipeline pipeline(*conn_);
+        std::vector<std::string> values = { "1", "bogus", "3" };
+        for (auto const& value : values) {
+            PsqlBindArray in_bindings;
+            in_bindings.add(value);
+            in_bindings.add(value);
+            ASSERT_NO_THROW_LOG(pipeline.add(tagged_statements[INSERT_VALUE],
+                                             in_bindings));
+        }
+
+        // The invalid integer is reported and the following insert
+        // is aborted.
+        EXPECT_THROW(pipeline.execute(), DbOperationError);
+    }
+    conn_->rollback();
+
+    // The connection is usable again.
+    ASSERT_NO_THROW_LOG(testSelect(TestRowSet({{2, "two"}}), 0, 10));
+}
+
 // Verifies that transaction nesting and operations: start, commit,
 // and rollback work correctly.
 TEST_F(PgSqlConnectionTest, transactions) {
@@ -1,4 +1,4 @@
-// Copyright (C) 2019-2024 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2019-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -92,13 +92,18 @@ public:
         FETCH_NONE
     };
 
+    /// @brief Default maximum number of audit entries applied at once.
+    static const size_t DEFAULT_MAX_AUDIT_ENTRIES = 1000;
+
     /// @brief Constructor.
     ///
     /// Sets the time of the last fetched audit entry to Jan 1st, 2000,
     /// with id 0.
     CBControlBase()
         : last_audit_revision_time_(getInitialAuditRevisionTime()),
-          last_audit_revision_id_(0) {
+          last_audit_revision_id_(0),
+          max_audit_entries_(DEFAULT_MAX_AUDIT_ENTRIES),
+          pending_updates_(false) {
     }
 
     /// @brief Virtual destructor.
@@ -116,6 +121,37 @@ public:
         databaseConfigDisconnect();
         last_audit_revision_time_ = getInitialAuditRevisionTime();
         last_audit_revision_id_ = 0;
+        pending_updates_ = false;
+    }
+
+    /// @brief Sets the maximum number of audit entries applied at once.
+    ///
+    /// When fetching configuration updates finds more audit entries than
+    /// this limit only the oldest ones are applied and the others are
+    /// left for the next fetch (see @c hasPendingUpdates). This bounds
+    /// the time spent in a single update, during which packet processing
+    /// is stopped.
+    ///
+    /// @param max_audit_entries The maximum number of audit entries
+    /// (0 means no limit).
+    void setMaxAuditEntries(size_t max_audit_entries) {
+        max_audit_entries_ = max_audit_entries;
+    }
+
+    /// @brief Returns the maximum number of audit entries applied at once.
+    ///
+    /// @return The maximum number of audit entries (0 means no limit).
+    size_t getMaxAuditEntries() const {
+        return (max_audit_entries_);
+    }
+
+    /// @brief Checks if the last fetch left configuration updates to apply.
+    ///
+    /// @return true when the last fetch of configuration updates applied
+    /// only a part of the audit entries so the caller should fetch again
+    /// soon instead of waiting for the next poll.
+    bool hasPendingUpdates() const {
+        return (pending_updates_);
     }
 
     /// @brief (Re)connects to the specified configuration backends.
@@ -180,6 +216,8 @@ public:
     /// server start up or it is called to fetch configuration updates.
     virtual void databaseConfigFetch(const ConfigPtr& srv_cfg,
                                      const FetchMode& fetch_mode = FetchMode::FETCH_ALL) {
+        pending_updates_ = false;
+
         // If the server starts up we need to connect to the database(s).
         // If there are no databases available simply do nothing.
         if (fetch_mode != FetchMode::FETCH_UPDATE && !databaseConfigConnect(srv_cfg)) {
@@ -222,6 +260,25 @@ public:
                                                                   server_selector,
                                                                   lb_modification_time,
                                                                   lb_modification_id);
+
+        // Apply large batches of updates in slices so as packet processing
+        // is not stopped for too long. The remaining audit entries are
+        // fetched again on the next call as the last audit revision time
+        // and id are set from the slice, which always ends on a revision
+        // boundary.
+        if ((fetch_mode == FetchMode::FETCH_UPDATE) && (max_audit_entries_ > 0) &&
+            (audit_entries.size() > max_audit_entries_)) {
+            db::AuditEntryCollection slice =
+                sliceAuditEntries(audit_entries, max_audit_entries_);
+            if (slice.size() < audit_entries.size()) {
+                LOG_INFO(dctl_logger, DCTL_CONFIG_FETCH_PENDING)
+                    .arg(slice.size())
+                    .arg(audit_entries.size());
+                audit_entries = slice;
+                pending_updates_ = true;
+            }
+        }
+
         // Store the last audit revision time. It should be set to the most recent
         // audit entry fetched. If returned audit is empty we don't update.
         updateLastAuditRevisionTimeId(audit_entries);
@@ -247,6 +304,7 @@ public:
                 /// the entire configuration if the update failed.
                 last_audit_revision_time_ = lb_modification_time;
                 last_audit_revision_id_ = lb_modification_id;
+                pending_updates_ = false;
                 throw;
             }
         }
@@ -335,6 +393,37 @@ protected:
         return (initial_time);
     }
 
+    /// @brief Returns the oldest audit entries of a collection.
+    ///
+    /// The slice always ends on a revision boundary: all audit entries
+    /// of an audit revision (e.g. a shared network delete and the
+    /// deletes of its subnets) are returned together, so a revision can
+    /// make the slice larger than @c count. This is required because
+    /// the next fetch resumes strictly after the last entry of the slice.
+    ///
+    /// @param audit_entries collection of audit entries.
+    /// @param count minimum number of audit entries to return (unless
+    /// the collection is smaller).
+    /// @return audit entries collection with the entries of the oldest
+    /// revisions, at least @c count of them.
+    static db::AuditEntryCollection
+    sliceAuditEntries(const db::AuditEntryCollection& audit_entries,
+                      size_t count) {
+        db::AuditEntryCollection result;
+        auto const& index = audit_entries.get<db::AuditEntryModificationTimeIdTag>();
+        db::AuditEntryPtr last;
+        for (auto const& entry : index) {
+            if (last && (result.size() >= count) &&
+                ((entry->getModificationTime() != last->getModificationTime()) ||
+                 (entry->getRevisionId() != last->getRevisionId()))) {
+                break;
+            }
+            result.insert(entry);
+            last = entry;
+        }
+        return (result);
+    }
+
     /// @brief Updates timestamp of the most recent audit entry fetched from
     /// the database.
     ///
@@ -366,6 +455,12 @@ protected:
     /// are more user friendly. Unfortunately old versions of MySQL do not
     /// support millisecond timestamps.
     uint64_t last_audit_revision_id_;
+
+    /// @brief Maximum number of audit entries applied at once.
+    size_t max_audit_entries_;
+
+    /// @brief Indicates if the last fetch left updates to apply.
+    bool pending_updates_;
 };
 
 /// @brief Checks if an object is in a collection od audit entries.
@@ -211,6 +211,16 @@ void LogConfigParser::parseOutputOptions(std::vector<LoggingDestination>& destin
             dest.pattern_ = pattern->stringValue();
         }
 
+        isc::data::ConstElementPtr queue_size = output_option->get("async-queue-size");
+        if (queue_size) {
+            int64_t value = queue_size->intValue();
+            if (value < 0) {
+                isc_throw(BadValue, "async-queue-size must not be negative ("
+                          << queue_size->getPosition() << ")");
+            }
+            dest.async_queue_size_ = static_cast<size_t>(value);
+        }
+
         destination.push_back(dest);
     }
 }
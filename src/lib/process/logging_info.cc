@@ -26,7 +26,8 @@ LoggingDestination::equals(const LoggingDestination& other) const {
             maxver_ == other.maxver_ &&
             maxsize_ == other.maxsize_ &&
             flush_ == other.flush_ &&
-            pattern_ == other.pattern_);
+            pattern_ == other.pattern_ &&
+            async_queue_size_ == other.async_queue_size_);
 }
 
 ElementPtr
@@ -42,6 +43,12 @@ LoggingDestination::toElement() const {
     // Set pattern
     result->set("pattern", Element::create(pattern_));
 
+    // Set async-queue-size only when asynchronous output is enabled
+    if (async_queue_size_ > 0) {
+        result->set("async-queue-size",
+                    Element::create(static_cast<long long>(async_queue_size_)));
+    }
+
     if ((output_ != STDOUT) && (output_ != STDERR) && (output_ != SYSLOG) &&
         (output_.find(SYSLOG_COLON) == std::string::npos)) {
         // Set maxver
@@ -154,6 +161,9 @@ LoggingInfo::toSpec() const {
         // Copy the pattern
         option.pattern = dest.pattern_;
 
+        // Copy the asynchronous logging queue size
+        option.async_queue_size = dest.async_queue_size_;
+
         // ... and set the destination
         spec.addOutputOption(option);
     }
@@ -42,6 +42,9 @@ public:
     /// It dictates what additional elements are output
     std::string pattern_;
 
+    /// @brief Asynchronous logging queue size (0 for synchronous output)
+    size_t async_queue_size_;
+
     /// @brief Compares two objects for equality.
     ///
     /// @param other Object to be compared with this object.
@@ -51,7 +54,8 @@ public:
 
     /// @brief Default constructor.
     LoggingDestination()
-        : output_("stdout"), maxver_(1), maxsize_(10240000), flush_(true), pattern_("") {
+        : output_("stdout"), maxver_(1), maxsize_(10240000), flush_(true), pattern_(""),
+          async_queue_size_(0) {
     }
 
     /// @brief Unparse a configuration object
@@ -642,6 +642,132 @@ TEST_F(CBControlBaseTest, fetchUpdates) {
     EXPECT_EQ(4567U, cb_ctl_.getLastAuditRevisionId());
 }
 
+// This test verifies that large batches of configuration changes are
+// applied in slices.
+TEST_F(CBControlBaseTest, fetchUpdatesSliced) {
+    auto config_base = makeConfigBase("type=db1");
+
+    ASSERT_TRUE(cb_ctl_.databaseConfigConnect(config_base));
+    EXPECT_EQ(static_cast<size_t>(CBControl::DEFAULT_MAX_AUDIT_ENTRIES),
+              cb_ctl_.getMaxAuditEntries());
+    cb_ctl_.setMaxAuditEntries(2);
+    EXPECT_EQ(2U, cb_ctl_.getMaxAuditEntries());
+
+    // Add 3 audit entries.
+    cb_ctl_.getMgr().getPool()->addAuditEntry(BackendSelector::UNSPEC(),
+                                              ServerSelector::ALL(),
+                                              "sql_table_1",
+                                              3456,
+                                              timestamps_["two days ago"],
+                                              4567);
+    cb_ctl_.getMgr().getPool()->addAuditEntry(BackendSelector::UNSPEC(),
+                                              ServerSelector::ALL(),
+                                              "sql_table_1",
+                                              3457,
+                                              timestamps_["yesterday"],
+                                              4568);
+    cb_ctl_.getMgr().getPool()->addAuditEntry(BackendSelector::UNSPEC(),
+                                              ServerSelector::ALL(),
+                                              "sql_table_1",
+                                              3458,
+                                              timestamps_["today"],
+                                              4569);
+
+    // Only the 2 oldest entries are applied.
+    ASSERT_NO_THROW(cb_ctl_.databaseConfigFetch(config_base,
+                                                CBControl::FetchMode::FETCH_UPDATE));
+    ASSERT_EQ(1U, cb_ctl_.getMergesNum());
+    EXPECT_EQ(2, cb_ctl_.getAuditEntriesNum());
+    EXPECT_EQ(timestamps_["yesterday"], cb_ctl_.getLastAuditRevisionTime());
+    EXPECT_EQ(4568U, cb_ctl_.getLastAuditRevisionId());
+    EXPECT_TRUE(cb_ctl_.hasPendingUpdates());
+
+    // The next fetch applies the last one.
+    ASSERT_NO_THROW(cb_ctl_.databaseConfigFetch(config_base,
+                                                CBControl::FetchMode::FETCH_UPDATE));
+    ASSERT_EQ(2U, cb_ctl_.getMergesNum());
+    EXPECT_EQ(1, cb_ctl_.getAuditEntriesNum());
+    EXPECT_EQ(timestamps_["today"], cb_ctl_.getLastAuditRevisionTime());
+    EXPECT_EQ(4569U, cb_ctl_.getLastAuditRevisionId());
+    EXPECT_FALSE(cb_ctl_.hasPendingUpdates());
+
+    // The full configuration fetch is never sliced.
+    cb_ctl_.reset();
+    ASSERT_NO_THROW(cb_ctl_.databaseConfigFetch(config_base,
+                                                CBControl::FetchMode::FETCH_ALL));
+    EXPECT_EQ(timestamps_["today"], cb_ctl_.getLastAuditRevisionTime());
+    EXPECT_EQ(4569U, cb_ctl_.getLastAuditRevisionId());
+    EXPECT_FALSE(cb_ctl_.hasPendingUpdates());
+}
+
+// This test verifies that a slice never splits an audit revision.
+TEST_F(CBControlBaseTest, fetchUpdatesSlicedRevision) {
+    auto config_base = makeConfigBase("type=db1");
+
+    ASSERT_TRUE(cb_ctl_.databaseConfigConnect(config_base));
+    cb_ctl_.setMaxAuditEntries(2);
+
+    // One entry in a first revision, then three entries sharing a second
+    // revision (e.g. a shared network delete cascading to its subnets)
+    // and one entry in a last revision.
+    cb_ctl_.getMgr().getPool()->addAuditEntry(BackendSelector::UNSPEC(),
+                                              ServerSelector::ALL(),
+                                              "sql_table_1",
+                                              3456,
+                                              timestamps_["two days ago"],
+                                              4567);
+    for (uint64_t object_id = 3457; object_id < 3460; ++object_id) {
+        cb_ctl_.getMgr().getPool()->addAuditEntry(BackendSelector::UNSPEC(),
+                                                  ServerSelector::ALL(),
+                                                  "sql_table_1",
+                                                  object_id,
+                                                  timestamps_["yesterday"],
+                                                  4568);
+    }
+    cb_ctl_.getMgr().getPool()->addAuditEntry(BackendSelector::UNSPEC(),
+                                              ServerSelector::ALL(),
+                                              "sql_table_1",
+                                              3460,
+                                              timestamps_["today"],
+                                              4569);
+
+    // The first slice takes the whole second revision even if it exceeds
+    // the limit.
+    ASSERT_NO_THROW(cb_ctl_.databaseConfigFetch(config_base,
+                                                CBControl::FetchMode::FETCH_UPDATE));
+    ASSERT_EQ(1U, cb_ctl_.getMergesNum());
+    EXPECT_EQ(4, cb_ctl_.getAuditEntriesNum());
+    EXPECT_EQ(timestamps_["yesterday"], cb_ctl_.getLastAuditRevisionTime());
+    EXPECT_EQ(4568U, cb_ctl_.getLastAuditRevisionId());
+    EXPECT_TRUE(cb_ctl_.hasPendingUpdates());
+
+    // The next fetch applies the last revision: no entry was lost.
+    ASSERT_NO_THROW(cb_ctl_.databaseConfigFetch(config_base,
+                                                CBControl::FetchMode::FETCH_UPDATE));
+    ASSERT_EQ(2U, cb_ctl_.getMergesNum());
+    EXPECT_EQ(1, cb_ctl_.getAuditEntriesNum());
+    EXPECT_EQ(timestamps_["today"], cb_ctl_.getLastAuditRevisionTime());
+    EXPECT_EQ(4569U, cb_ctl_.getLastAuditRevisionId());
+    EXPECT_FALSE(cb_ctl_.hasPendingUpdates());
+
+    // A single revision larger than the limit is not sliced at all.
+    cb_ctl_.setMaxAuditEntries(1);
+    for (uint64_t object_id = 3461; object_id < 3464; ++object_id) {
+        cb_ctl_.getMgr().getPool()->addAuditEntry(BackendSelector::UNSPEC(),
+                                                  ServerSelector::ALL(),
+                                                  "sql_table_1",
+                                                  object_id,
+                                                  timestamps_["tomorrow"],
+                                                  4570);
+    }
+    ASSERT_NO_THROW(cb_ctl_.databaseConfigFetch(config_base,
+                                                CBControl::FetchMode::FETCH_UPDATE));
+    ASSERT_EQ(3U, cb_ctl_.getMergesNum());
+    EXPECT_EQ(3, cb_ctl_.getAuditEntriesNum());
+    EXPECT_EQ(4570U, cb_ctl_.getLastAuditRevisionId());
+    EXPECT_FALSE(cb_ctl_.hasPendingUpdates());
+}
+
 // Check that the databaseConfigApply function is not called when there
 // are no more unprocessed audit entries.
 TEST_F(CBControlBaseTest, fetchNoUpdates) {
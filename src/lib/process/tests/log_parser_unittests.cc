@@ -588,6 +588,81 @@ TEST_F(LoggingTest, emptyPattern) {
     EXPECT_TRUE(storage->getLoggingInfo()[0].destinations_[0].pattern_.empty());
 }
 
+// Verifies that output option 'async-queue-size' parses correctly and
+// is reported back when unparsing.
+TEST_F(LoggingTest, asyncQueueSize) {
+    const char* config_txt =
+    "{ \"loggers\": ["
+    "    {"
+    "        \"name\": \"kea\","
+    "        \"output-options\": ["
+    "            {"
+    "                \"output\": \"stdout\","
+    "                \"async-queue-size\": 10000"
+    "            },"
+    "            {"
+    "                \"output\": \"stderr\""
+    "            }"
+    "        ],"
+    "        \"severity\": \"INFO\""
+    "    }"
+    "]}";
+
+    ConfigPtr storage(new ConfigBase());
+
+    LogConfigParser parser(storage);
+
+    ConstElementPtr config = Element::fromJSON(config_txt);
+    config = config->get("loggers");
+
+    EXPECT_NO_THROW(parser.parseConfiguration(config));
+
+    ASSERT_EQ(1U, storage->getLoggingInfo().size());
+    ASSERT_EQ(2U, storage->getLoggingInfo()[0].destinations_.size());
+    LoggingDestination dest = storage->getLoggingInfo()[0].destinations_[0];
+    EXPECT_EQ(10000U, dest.async_queue_size_);
+    ConstElementPtr unparsed = dest.toElement();
+    ASSERT_TRUE(unparsed->get("async-queue-size"));
+    EXPECT_EQ(10000, unparsed->get("async-queue-size")->intValue());
+
+    // The default is synchronous output, which is not unparsed.
+    dest = storage->getLoggingInfo()[0].destinations_[1];
+    EXPECT_EQ(0U, dest.async_queue_size_);
+    EXPECT_FALSE(dest.toElement()->get("async-queue-size"));
+
+    // The queue size is passed to the log library.
+    isc::log::LoggerSpecification spec =
+        storage->getLoggingInfo()[0].toSpec();
+    ASSERT_EQ(2U, spec.optionCount());
+    EXPECT_EQ(10000U, spec.begin()->async_queue_size);
+}
+
+// Verifies that a negative 'async-queue-size' is rejected.
+TEST_F(LoggingTest, negativeAsyncQueueSize) {
+    const char* config_txt =
+    "{ \"loggers\": ["
+    "    {"
+    "        \"name\": \"kea\","
+    "        \"output-options\": ["
+    "            {"
+    "                \"output\": \"stdout\","
+    "                \"async-queue-size\": -1"
+    "            }"
+    "        ],"
+    "        \"severity\": \"INFO\""
+    "    }"
+    "]}";
+
+    ConfigPtr storage(new ConfigBase());
+
+    LogConfigParser parser(storage);
+
+    ConstElementPtr config = Element::fromJSON(config_txt);
+    config = config->get("loggers");
+
+    EXPECT_THROW(parser.parseConfiguration(config), BadValue);
+}
+
 void testMaxSize(uint64_t maxsize_candidate, uint64_t expected_maxsize) {
     std::string const logger(R"(
     {
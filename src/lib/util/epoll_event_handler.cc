@@ -0,0 +1,143 @@
+// Copyright (C) 2026 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#ifdef HAVE_SYS_EPOLL_H
+
+#include <exceptions/exceptions.h>
+#include <util/epoll_event_handler.h>
+
+#include <cerrno>
+#include <cstring>
+
+#include <unistd.h>
+
+namespace isc {
+namespace util {
+
+EpollEventHandler::EpollEventHandler()
+    : FDEventHandler(TYPE_EPOLL), epoll_fd_(-1), events_count_(0) {
+    epoll_fd_ = epoll_create1(EPOLL_CLOEXEC);
+    if (epoll_fd_ < 0) {
+        isc_throw(Unexpected, "failed to create epoll instance: "
+                  << strerror(errno));
+    }
+    clear();
+}
+
+EpollEventHandler::~EpollEventHandler() {
+    close(epoll_fd_);
+}
+
+void EpollEventHandler::add(int fd) {
+    if (fd < 0) {
+        isc_throw(BadValue, "invalid negative value for fd");
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (registered_.count(fd)) {
+        return;
+    }
+    struct epoll_event event;
+    memset(&event, 0, sizeof(event));
+    event.events = EPOLLIN;
+    event.data.fd = fd;
+    if ((epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, fd, &event) < 0) &&
+        (errno != EEXIST)) {
+        // Report the error (e.g. EBADF for a closed file descriptor)
+        // at the next wait as select does.
+        bad_.insert(fd);
+        return;
+    }
+    registered_.insert(fd);
+}
+
+int EpollEventHandler::waitEvent(uint32_t timeout_sec, uint32_t timeout_usec /* = 0 */,
+                                 bool use_timeout /* = true */) {
+    // Sanity check for microsecond timeout.
+    if (timeout_usec >= 1000000) {
+        isc_throw(BadValue, "fractional timeout must be shorter than"
+                  " one million microseconds");
+    }
+    int timeout = -1;
+    if (use_timeout) {
+        timeout = timeout_sec * 1000 + timeout_usec / 1000;
+    }
+    // Forget the events of the previous wait.
+    for (size_t i = 0; i < events_count_; ++i) {
+        ready_.erase(events_[i].data.fd);
+    }
+    events_count_ = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!bad_.empty()) {
+            errno = EBADF;
+            return (-1);
+        }
+        events_.resize(registered_.empty() ? 1 : registered_.size());
+    }
+    int result = epoll_wait(epoll_fd_, events_.data(), events_.size(), timeout);
+    for (int i = 0; i < result; ++i) {
+        ready_[events_[i].data.fd] |= events_[i].events;
+    }
+    if (result > 0) {
+        events_count_ = result;
+    }
+    return (result);
+}
+
+bool EpollEventHandler::readReady(int fd) {
+    if (fd < 0) {
+        isc_throw(BadValue, "invalid negative value for fd");
+    }
+    auto it = ready_.find(fd);
+    if (it == ready_.end()) {
+        return (false);
+    }
+    return (it->second & (EPOLLIN | EPOLLHUP));
+}
+
+bool EpollEventHandler::hasError(int fd) {
+    if (fd < 0) {
+        isc_throw(BadValue, "invalid negative value for fd");
+    }
+    auto it = ready_.find(fd);
+    if (it == ready_.end()) {
+        return (false);
+    }
+    return (it->second & EPOLLERR);
+}
+
+void EpollEventHandler::remove(int fd) {
+    if (fd < 0) {
+        isc_throw(BadValue, "invalid negative value for fd");
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (registered_.erase(fd)) {
+        // A closed file descriptor was already removed by the kernel
+        // so errors are ignored.
+        static_cast<void>(epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, fd, 0));
+    }
+    bad_.erase(fd);
+}
+
+void EpollEventHandler::clear() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (int fd : registered_) {
+            static_cast<void>(epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, fd, 0));
+        }
+        registered_.clear();
+        bad_.clear();
+    }
+    ready_.clear();
+    events_count_ = 0;
+}
+
+} // end of namespace isc::util
+} // end of namespace isc
+
+#endif // HAVE_SYS_EPOLL_H
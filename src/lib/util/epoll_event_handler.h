@@ -0,0 +1,130 @@
+// Copyright (C) 2026 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef EPOLL_EVENT_HANDLER_H
+#define EPOLL_EVENT_HANDLER_H
+
+#include <util/fd_event_handler.h>
+
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <sys/epoll.h>
+
+namespace isc {
+namespace util {
+
+/// @brief File descriptor event handler class handles events for registered
+/// file descriptors. This class uses the Linux epoll syscalls for event
+/// handling.
+///
+/// The registrations are persistent: @c add registers the file descriptor
+/// in the kernel and @c remove unregisters it, so a wait costs one syscall
+/// whatever the number of watched file descriptors, and only the ready
+/// file descriptors are returned by the kernel and handled.
+///
+/// A file descriptor must be removed before it is closed: its number can
+/// be reused by another file which would not be registered. A closed file
+/// descriptor which is not removed is silently dropped by the kernel when
+/// the file is released, or keeps reporting the events of a file which is
+/// still referenced elsewhere (e.g. by a memory mapping).
+///
+/// The readiness is level-triggered: a file descriptor stays ready while
+/// it has data to read, as with the select and poll handlers, because
+/// the callers may read only one message after each wait.
+class EpollEventHandler : public FDEventHandler {
+public:
+    /// @brief Constructor.
+    ///
+    /// @throw isc::Unexpected if the epoll instance can't be created.
+    EpollEventHandler();
+
+    /// @brief Destructor.
+    virtual ~EpollEventHandler();
+
+    /// @brief Add file descriptor to watch for events.
+    ///
+    /// The file descriptor is registered in the kernel. As with select,
+    /// a file descriptor which can't be registered (e.g. a closed one)
+    /// makes the next waits fail with EBADF until it is removed.
+    ///
+    /// @param fd The file descriptor.
+    void add(int fd);
+
+    /// @brief Wait for events on registered file descriptors.
+    ///
+    /// @param timeout_sec The wait timeout in seconds.
+    /// @param timeout_usec The wait timeout in micro seconds.
+    /// @param use_timeout Flag which indicates if function should wait
+    /// with no timeout (wait forever).
+    /// @return -1 on error, 0 if no data is available (timeout expired),
+    /// the number of ready file descriptors if data is ready.
+    int waitEvent(uint32_t timeout_sec, uint32_t timeout_usec = 0,
+                  bool use_timeout = true);
+
+    /// @brief Check if file descriptor is ready for read operation.
+    ///
+    /// @param fd The file descriptor.
+    ///
+    /// @return True if file descriptor is ready for reading.
+    bool readReady(int fd);
+
+    /// @brief Check if file descriptor has error.
+    ///
+    /// @param fd The file descriptor.
+    ///
+    /// @return True if file descriptor has error.
+    virtual bool hasError(int fd);
+
+    /// @brief Remove file descriptor from the watched ones.
+    ///
+    /// The file descriptor is unregistered from the kernel. It may be
+    /// called from another thread than the one waiting.
+    ///
+    /// @param fd The file descriptor.
+    void remove(int fd);
+
+    /// @brief Clear registered file descriptors.
+    void clear();
+
+    /// @brief Check if the registrations are persistent.
+    ///
+    /// @return True.
+    virtual bool isPersistent() const {
+        return (true);
+    }
+
+private:
+    /// @brief The epoll file descriptor.
+    int epoll_fd_;
+
+    /// @brief The file descriptors registered in the kernel.
+    std::unordered_set<int> registered_;
+
+    /// @brief The file descriptors which could not be registered.
+    std::unordered_set<int> bad_;
+
+    /// @brief The mutex protecting the registrations.
+    std::mutex mutex_;
+
+    /// @brief The events returned by the last wait.
+    std::vector<struct epoll_event> events_;
+
+    /// @brief The number of events returned by the last wait.
+    size_t events_count_;
+
+    /// @brief The map with ready file descriptor to events.
+    ///
+    /// Only the entries of the returned events are updated at each wait.
+    std::unordered_map<int, uint32_t> ready_;
+};
+
+}  // namespace isc::util;
+}  // namespace isc
+
+#endif  // EPOLL_EVENT_HANDLER_H
@@ -1,4 +1,4 @@
-// Copyright (C) 2025 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2025-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -18,5 +18,9 @@ FDEventHandler::HandlerType FDEventHandler::type() {
     return (type_);
 }
 
+bool FDEventHandler::isPersistent() const {
+    return (false);
+}
+
 } // end of namespace isc::util
 } // end of namespace isc
@@ -1,4 +1,4 @@
-// Copyright (C) 2025 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2025-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -21,6 +21,7 @@ public:
         TYPE_UNKNOWN = 0,
         TYPE_SELECT = 1,
         TYPE_POLL = 2,
+        TYPE_EPOLL = 3,
     };
 
     /// @brief Constructor.
@@ -61,9 +62,27 @@ public:
     /// @return True if file descriptor has error.
     virtual bool hasError(int fd) = 0;
 
+    /// @brief Remove file descriptor from the watched ones.
+    ///
+    /// Removing a file descriptor which is not watched has no effect.
+    ///
+    /// @param fd The file descriptor.
+    virtual void remove(int fd) = 0;
+
     /// @brief Clear registered file descriptors.
     virtual void clear() = 0;
 
+    /// @brief Check if the registrations are persistent.
+    ///
+    /// A persistent handler keeps its registrations in the kernel between
+    /// two waits: the file descriptors are added once, and must be removed
+    /// before they are closed as the descriptor can be reused by another
+    /// file. The other handlers pass their whole set at each wait, so they
+    /// are usually cleared and filled before each wait.
+    ///
+    /// @return True if the registrations are persistent.
+    virtual bool isPersistent() const;
+
     /// @brief Return the event handler type.
     HandlerType type();
 
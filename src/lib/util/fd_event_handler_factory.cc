@@ -9,6 +9,9 @@
 #include <exceptions/exceptions.h>
 
 #include <util/fd_event_handler_factory.h>
+#ifdef HAVE_SYS_EPOLL_H
+#include <util/epoll_event_handler.h>
+#endif
 #include <util/poll_event_handler.h>
 #include <util/select_event_handler.h>
 
@@ -31,12 +34,22 @@ FDEventHandlerPtr FDEventHandlerFactory::factoryFDEventHandler() {
         if (string(env_type) == string("poll")) {
             type = FDEventHandler::TYPE_POLL;
         }
+        if (string(env_type) == string("epoll")) {
+            type = FDEventHandler::TYPE_EPOLL;
+        }
     }
     switch(type) {
     case FDEventHandler::TYPE_SELECT:
         return (FDEventHandlerPtr(new SelectEventHandler()));
     case FDEventHandler::TYPE_POLL:
         return (FDEventHandlerPtr(new PollEventHandler()));
+    case FDEventHandler::TYPE_EPOLL:
+#ifdef HAVE_SYS_EPOLL_H
+        return (FDEventHandlerPtr(new EpollEventHandler()));
+#else
+        // Not supported on this system.
+        return (FDEventHandlerPtr(new PollEventHandler()));
+#endif
     default:
         return (FDEventHandlerPtr(new SelectEventHandler()));
     }
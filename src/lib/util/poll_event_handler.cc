@@ -1,4 +1,4 @@
-// Copyright (C) 2025 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2025-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -9,6 +9,7 @@
 #include <exceptions/exceptions.h>
 #include <util/poll_event_handler.h>
 
+#include <algorithm>
 #include <cstring>
 
 namespace isc {
@@ -69,6 +70,19 @@ bool PollEventHandler::hasError(int fd) {
     return (map_[fd]->revents & POLLERR);
 }
 
+void PollEventHandler::remove(int fd) {
+    if (fd < 0) {
+        isc_throw(BadValue, "invalid negative value for fd");
+    }
+    data_.erase(std::remove_if(data_.begin(), data_.end(),
+                               [fd](const struct pollfd& data) {
+                                   return (data.fd == fd);
+                               }),
+                data_.end());
+    // The map points to the data.
+    map_.clear();
+}
+
 void PollEventHandler::clear() {
     data_.clear();
     map_.clear();
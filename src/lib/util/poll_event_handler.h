@@ -58,6 +58,11 @@ public:
     /// @return True if file descriptor has error.
     virtual bool hasError(int fd);
 
+    /// @brief Remove file descriptor from the watched ones.
+    ///
+    /// @param fd The file descriptor.
+    void remove(int fd);
+
     /// @brief Clear registered file descriptors.
     void clear();
 
@@ -81,6 +81,16 @@ bool SelectEventHandler::hasError(int fd) {
     return (false);
 }
 
+void SelectEventHandler::remove(int fd) {
+    if (fd < 0) {
+        isc_throw(BadValue, "invalid negative value for fd");
+    }
+    // A too large fd can't have been added.
+    if (fd < FD_SETSIZE) {
+        FD_CLR(fd, &read_fd_set_);
+    }
+}
+
 void SelectEventHandler::clear() {
     FD_ZERO(&read_fd_set_);
     max_fd_ = 0;
@@ -1,4 +1,4 @@
-// Copyright (C) 2025 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2025-2026 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -54,6 +54,11 @@ public:
     /// @return True if file descriptor has error.
     virtual bool hasError(int fd);
 
+    /// @brief Remove file descriptor from the watched ones.
+    ///
+    /// @param fd The file descriptor.
+    void remove(int fd);
+
     /// @brief Clear registered file descriptors.
     void clear();
 
@@ -0,0 +1,16 @@
+// Copyright (C) 2026 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#ifdef HAVE_SYS_EPOLL_H
+
+#define FDEventHandlerType EpollEventHandler
+#define FDEventHandlerTest EpollEventHandlerTest
+
+#include <fd_event_handler_unittests.h>
+
+#endif
@@ -9,6 +9,9 @@
 #include <exceptions/exceptions.h>
 #include <testutils/gtest_utils.h>
 #include <util/fd_event_handler.h>
+#ifdef HAVE_SYS_EPOLL_H
+#include <util/epoll_event_handler.h>
+#endif
 #include <util/poll_event_handler.h>
 #include <util/select_event_handler.h>
 
@@ -199,12 +202,89 @@ TEST_F(FDEventHandlerTest, badFD) {
         EXPECT_FALSE(handler_->readReady(fd));
         EXPECT_FALSE(handler_->hasError(fd));
         EXPECT_EQ(0, errno);
+    } else if (handler_->type() == FDEventHandler::TYPE_EPOLL) {
+        // The kernel removed the closed fd from the registrations.
+        EXPECT_EQ(0, handler_->waitEvent(0, 1000));
+        EXPECT_FALSE(handler_->readReady(fd));
+        EXPECT_FALSE(handler_->hasError(fd));
+        EXPECT_EQ(0, errno);
+
+        // Adding a closed fd fails as with select.
+        handler_->remove(fd);
+        EXPECT_NO_THROW(handler_->add(fd));
+        EXPECT_EQ(-1, handler_->waitEvent(0, 1000));
+        EXPECT_EQ(EBADF, errno);
+
+        // Until it is removed.
+        handler_->remove(fd);
+        EXPECT_EQ(0, handler_->waitEvent(0, 1000));
     }
 
     close(pipe_fd_[1]);
     EXPECT_EQ(pipe(pipe_fd_), 0);
 }
 
+TEST_F(FDEventHandlerTest, remove) {
+    EXPECT_THROW(handler_->remove(-1), BadValue);
+
+    EXPECT_NO_THROW(handler_->add(pipe_fd_[0]));
+    EXPECT_EQ(1, write(pipe_fd_[1], &MARKER, sizeof(MARKER)));
+    EXPECT_EQ(1, handler_->waitEvent(0, 1000));
+    EXPECT_TRUE(handler_->readReady(pipe_fd_[0]));
+
+    // A removed fd is no longer watched.
+    EXPECT_NO_THROW(handler_->remove(pipe_fd_[0]));
+    EXPECT_EQ(0, handler_->waitEvent(0, 1000));
+    EXPECT_FALSE(handler_->readReady(pipe_fd_[0]));
+
+    // Removing it again or removing an unknown fd is harmless.
+    EXPECT_NO_THROW(handler_->remove(pipe_fd_[0]));
+    EXPECT_NO_THROW(handler_->remove(pipe_fd_[1]));
+
+    // It can be added back.
+    EXPECT_NO_THROW(handler_->add(pipe_fd_[0]));
+    EXPECT_EQ(1, handler_->waitEvent(0, 1000));
+    EXPECT_TRUE(handler_->readReady(pipe_fd_[0]));
+}
+
+TEST_F(FDEventHandlerTest, reopen) {
+    int fd = pipe_fd_[0];
+    EXPECT_NO_THROW(handler_->add(fd));
+    EXPECT_EQ(1, write(pipe_fd_[1], &MARKER, sizeof(MARKER)));
+    EXPECT_EQ(1, handler_->waitEvent(0, 1000));
+    EXPECT_TRUE(handler_->readReady(fd));
+
+    // Replace the pipe by a new one with the same read fd.
+    close(pipe_fd_[1]);
+    int new_pipe_fd[2];
+    ASSERT_EQ(pipe(new_pipe_fd), 0);
+    ASSERT_EQ(fd, dup2(new_pipe_fd[0], fd));
+    close(new_pipe_fd[0]);
+    pipe_fd_[1] = new_pipe_fd[1];
+
+    EXPECT_EQ(1, write(pipe_fd_[1], &MARKER, sizeof(MARKER)));
+    if (handler_->isPersistent()) {
+        // The registration of the previous pipe was dropped by the
+        // kernel and adding the fd again does not replace it.
+        EXPECT_NO_THROW(handler_->add(fd));
+        EXPECT_EQ(0, handler_->waitEvent(0, 1000));
+        EXPECT_FALSE(handler_->readReady(fd));
+    }
+
+    // The new pipe is watched once the fd has been removed and added.
+    handler_->remove(fd);
+    EXPECT_NO_THROW(handler_->add(fd));
+    EXPECT_EQ(1, handler_->waitEvent(0, 1000));
+    EXPECT_TRUE(handler_->readReady(fd));
+    EXPECT_FALSE(handler_->hasError(fd));
+
+    // Watching another set of fds.
+    handler_->clear();
+    EXPECT_NO_THROW(handler_->add(pipe_fd_[1]));
+    EXPECT_EQ(0, handler_->waitEvent(0, 1000));
+    EXPECT_FALSE(handler_->readReady(fd));
+}
+
 TEST_F(FDEventHandlerTest, hup) {
     EXPECT_NO_THROW(handler_->add(pipe_fd_[0]));
     close(pipe_fd_[1]);